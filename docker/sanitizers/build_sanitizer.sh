@@ -14,7 +14,7 @@
 # 3) Download external dependencies required for instrumentation.
 # 4) Build libc++ with the instrumentation specified by <LLVM Sanitizer Name>.
 # 5) Build sanitizer-instrumented dependencies including BDE, NTF, GoogleTest,
-#    Google Benchmark and zlib.
+#    Google Benchmark, zlib, LZ4 and Zstandard.
 # 6) Build sanitizer-instrumented BlazingMQ unit tests.
 # 7) Generate scripts to run unit tests:
 #      ./cmake.bld/Linux/run-unittests.sh
@@ -154,6 +154,14 @@ checkoutGitRepo "$(github_url google/googletest)" "${GOOGLETEST_TAG}" "googletes
 ZLIB_TAG="v1.3.1"
 checkoutGitRepo "$(github_url madler/zlib)" "${ZLIB_TAG}" "zlib"
 
+# Download LZ4
+LZ4_TAG="v1.10.0"
+checkoutGitRepo "$(github_url lz4/lz4)" "${LZ4_TAG}" "lz4"
+
+# Download Zstandard
+ZSTD_TAG="v1.5.6"
+checkoutGitRepo "$(github_url facebook/zstd)" "${ZSTD_TAG}" "zstd"
+
 # Download bde-tools, bde and ntf-core sources
 cd "${DIR_EXTERNAL}"
 "${DIR_ROOT}"/docker/build_deps.sh "--only-download"
@@ -307,6 +315,36 @@ cmake --install "${DIR_SRCS_EXT}/zlib/cmake.bld"
 rm -rf "${DIR_SRCS_EXT}/zlib"
 print_disk_usage "zlib"
 
+# Build LZ4
+cmake -B "${DIR_SRCS_EXT}/lz4/cmake.bld" -S "${DIR_SRCS_EXT}/lz4/build/cmake" \
+        -D CMAKE_INSTALL_PREFIX="/opt/bb" \
+        "${CMAKE_OPTIONS[@]}" \
+        -DBUILD_SHARED_LIBS=OFF \
+        -DBUILD_STATIC_LIBS=ON \
+        -DLZ4_BUILD_CLI=OFF
+# Make and install LZ4.
+cmake --build "${DIR_SRCS_EXT}/lz4/cmake.bld" -j"${PARALLELISM}"
+cmake --install "${DIR_SRCS_EXT}/lz4/cmake.bld"
+# Cleanup LZ4 source and build artifacts
+rm -rf "${DIR_SRCS_EXT}/lz4"
+print_disk_usage "LZ4"
+
+# Build Zstandard
+cmake -B "${DIR_SRCS_EXT}/zstd/cmake.bld" -S "${DIR_SRCS_EXT}/zstd/build/cmake" \
+        -D CMAKE_INSTALL_PREFIX="/opt/bb" \
+        "${CMAKE_OPTIONS[@]}" \
+        -DZSTD_BUILD_PROGRAMS=OFF \
+        -DZSTD_BUILD_TESTS=OFF \
+        -DZSTD_BUILD_SHARED=OFF \
+        -DZSTD_BUILD_STATIC=ON \
+        -DZSTD_MULTITHREAD_SUPPORT=OFF
+# Make and install Zstandard.
+cmake --build "${DIR_SRCS_EXT}/zstd/cmake.bld" -j"${PARALLELISM}"
+cmake --install "${DIR_SRCS_EXT}/zstd/cmake.bld"
+# Cleanup Zstandard source and build artifacts
+rm -rf "${DIR_SRCS_EXT}/zstd"
+print_disk_usage "Zstandard"
+
 # Remove any remaining un-needed folders (safety net)
 rm -rf "${DIR_BUILD_EXT}"
 for dir in "${DIR_SRCS_EXT}"/*; do
@@ -16,9 +16,17 @@ macro(setup_package_provider)
         # pkg-config style names BdeBuildSystem is trying to use.
         find_package(benchmark CONFIG REQUIRED)
         find_package(ZLIB REQUIRED)
+        find_package(lz4 CONFIG REQUIRED)
+        find_package(zstd CONFIG REQUIRED)
 
         add_library(benchmark ALIAS benchmark::benchmark)
         add_library(zlib ALIAS ZLIB::ZLIB)
+        add_library(liblz4 ALIAS lz4::lz4)
+        if(TARGET zstd::libzstd_shared)
+            add_library(libzstd ALIAS zstd::libzstd_shared)
+        else()
+            add_library(libzstd ALIAS zstd::libzstd_static)
+        endif()
 
         find_package(GTest CONFIG REQUIRED)
         add_library(gmock ALIAS GTest::gmock)
@@ -222,6 +222,12 @@ static bool parseArgs(Parameters* parameters, int argc, const char* argv[])
          "where to generate the JSON latency report",
          balcl::TypeInfo(&params.latencyReport()),
          balcl::OccurrenceInfo(params.latencyReport())},
+        {"event-queue-spin-time",
+         "us",
+         "time (in microseconds) to busy poll the event queue before blocking "
+         "(to measure latency without thread wake ups)",
+         balcl::TypeInfo(&params.eventQueueSpinTimeUs()),
+         balcl::OccurrenceInfo(params.eventQueueSpinTimeUs())},
         {"d|dumpmsg",
          "dumpmsg",
          "dump received message content",
@@ -479,6 +479,7 @@ int Application::initialize()
         .setCloseQueueTimeout(d_parameters.timeout())
         .setNumProcessingThreads(d_parameters.numProcessingThreads())
         .configureEventQueue(1000, 10 * 1000)
+        .setEventQueueSpinTime(d_parameters.eventQueueSpinTime())
         .setUserAgentPrefix("bmqtool");
 
     if (!d_parameters.authnMechanism().empty()) {
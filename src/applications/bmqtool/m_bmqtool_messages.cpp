@@ -4374,6 +4374,9 @@ const char CommandLineParameters::DEFAULT_INITIALIZER_AUTHN_MECHANISM[] = "";
 
 const char CommandLineParameters::DEFAULT_INITIALIZER_AUTHN_DATA[] = "";
 
+const int CommandLineParameters::DEFAULT_INITIALIZER_EVENT_QUEUE_SPIN_TIME_US =
+    0;
+
 const bdlat_AttributeInfo CommandLineParameters::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_MODE,
      "mode",
@@ -4529,14 +4532,19 @@ const bdlat_AttributeInfo CommandLineParameters::ATTRIBUTE_INFO_ARRAY[] = {
      "authnData",
      sizeof("authnData") - 1,
      "",
-     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_EVENT_QUEUE_SPIN_TIME_US,
+     "eventQueueSpinTimeUs",
+     sizeof("eventQueueSpinTimeUs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 CommandLineParameters::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 31; ++i) {
+    for (int i = 0; i < 32; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             CommandLineParameters::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -4613,6 +4621,8 @@ const bdlat_AttributeInfo* CommandLineParameters::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AUTHN_MECHANISM];
     case ATTRIBUTE_ID_AUTHN_DATA:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AUTHN_DATA];
+    case ATTRIBUTE_ID_EVENT_QUEUE_SPIN_TIME_US:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_EVENT_QUEUE_SPIN_TIME_US];
     default: return 0;
     }
 }
@@ -4648,6 +4658,7 @@ CommandLineParameters::CommandLineParameters(bslma::Allocator* basicAllocator)
 , d_shutdownGrace(DEFAULT_INITIALIZER_SHUTDOWN_GRACE)
 , d_autoPubSubModulo(DEFAULT_INITIALIZER_AUTO_PUB_SUB_MODULO)
 , d_timeoutSec(DEFAULT_INITIALIZER_TIMEOUT_SEC)
+, d_eventQueueSpinTimeUs(DEFAULT_INITIALIZER_EVENT_QUEUE_SPIN_TIME_US)
 , d_dumpMsg(DEFAULT_INITIALIZER_DUMP_MSG)
 , d_confirmMsg(DEFAULT_INITIALIZER_CONFIRM_MSG)
 , d_memoryDebug(DEFAULT_INITIALIZER_MEMORY_DEBUG)
@@ -4686,6 +4697,7 @@ CommandLineParameters::CommandLineParameters(
 , d_shutdownGrace(original.d_shutdownGrace)
 , d_autoPubSubModulo(original.d_autoPubSubModulo)
 , d_timeoutSec(original.d_timeoutSec)
+, d_eventQueueSpinTimeUs(original.d_eventQueueSpinTimeUs)
 , d_dumpMsg(original.d_dumpMsg)
 , d_confirmMsg(original.d_confirmMsg)
 , d_memoryDebug(original.d_memoryDebug)
@@ -4724,6 +4736,7 @@ CommandLineParameters::CommandLineParameters(
   d_shutdownGrace(bsl::move(original.d_shutdownGrace)),
   d_autoPubSubModulo(bsl::move(original.d_autoPubSubModulo)),
   d_timeoutSec(bsl::move(original.d_timeoutSec)),
+  d_eventQueueSpinTimeUs(bsl::move(original.d_eventQueueSpinTimeUs)),
   d_dumpMsg(bsl::move(original.d_dumpMsg)),
   d_confirmMsg(bsl::move(original.d_confirmMsg)),
   d_memoryDebug(bsl::move(original.d_memoryDebug)),
@@ -4761,6 +4774,7 @@ CommandLineParameters::CommandLineParameters(CommandLineParameters&& original,
 , d_shutdownGrace(bsl::move(original.d_shutdownGrace))
 , d_autoPubSubModulo(bsl::move(original.d_autoPubSubModulo))
 , d_timeoutSec(bsl::move(original.d_timeoutSec))
+, d_eventQueueSpinTimeUs(bsl::move(original.d_eventQueueSpinTimeUs))
 , d_dumpMsg(bsl::move(original.d_dumpMsg))
 , d_confirmMsg(bsl::move(original.d_confirmMsg))
 , d_memoryDebug(bsl::move(original.d_memoryDebug))
@@ -4810,6 +4824,7 @@ CommandLineParameters::operator=(const CommandLineParameters& rhs)
         d_timeoutSec               = rhs.d_timeoutSec;
         d_authnMechanism           = rhs.d_authnMechanism;
         d_authnData                = rhs.d_authnData;
+        d_eventQueueSpinTimeUs     = rhs.d_eventQueueSpinTimeUs;
     }
 
     return *this;
@@ -4852,6 +4867,7 @@ CommandLineParameters::operator=(CommandLineParameters&& rhs)
         d_timeoutSec               = bsl::move(rhs.d_timeoutSec);
         d_authnMechanism           = bsl::move(rhs.d_authnMechanism);
         d_authnData                = bsl::move(rhs.d_authnData);
+        d_eventQueueSpinTimeUs     = bsl::move(rhs.d_eventQueueSpinTimeUs);
     }
 
     return *this;
@@ -4888,10 +4904,11 @@ void CommandLineParameters::reset()
         DEFAULT_INITIALIZER_SEQUENTIAL_MESSAGE_PATTERN;
     bdlat_ValueTypeFunctions::reset(&d_messageProperties);
     bdlat_ValueTypeFunctions::reset(&d_subscriptions);
-    d_autoPubSubModulo = DEFAULT_INITIALIZER_AUTO_PUB_SUB_MODULO;
-    d_timeoutSec       = DEFAULT_INITIALIZER_TIMEOUT_SEC;
-    d_authnMechanism   = DEFAULT_INITIALIZER_AUTHN_MECHANISM;
-    d_authnData        = DEFAULT_INITIALIZER_AUTHN_DATA;
+    d_autoPubSubModulo     = DEFAULT_INITIALIZER_AUTO_PUB_SUB_MODULO;
+    d_timeoutSec           = DEFAULT_INITIALIZER_TIMEOUT_SEC;
+    d_authnMechanism       = DEFAULT_INITIALIZER_AUTHN_MECHANISM;
+    d_authnData            = DEFAULT_INITIALIZER_AUTHN_DATA;
+    d_eventQueueSpinTimeUs = DEFAULT_INITIALIZER_EVENT_QUEUE_SPIN_TIME_US;
 }
 
 // ACCESSORS
@@ -4935,6 +4952,8 @@ bsl::ostream& CommandLineParameters::print(bsl::ostream& stream,
     printer.printAttribute("timeoutSec", this->timeoutSec());
     printer.printAttribute("authnMechanism", this->authnMechanism());
     printer.printAttribute("authnData", this->authnData());
+    printer.printAttribute("eventQueueSpinTimeUs",
+                           this->eventQueueSpinTimeUs());
     printer.end();
     return stream;
 }
@@ -5423,6 +5423,7 @@ class CommandLineParameters {
     int                          d_shutdownGrace;
     int                          d_autoPubSubModulo;
     int                          d_timeoutSec;
+    int                          d_eventQueueSpinTimeUs;
     bool                         d_dumpMsg;
     bool                         d_confirmMsg;
     bool                         d_memoryDebug;
@@ -5469,10 +5470,11 @@ class CommandLineParameters {
         ATTRIBUTE_ID_AUTO_PUB_SUB_MODULO        = 27,
         ATTRIBUTE_ID_TIMEOUT_SEC                = 28,
         ATTRIBUTE_ID_AUTHN_MECHANISM            = 29,
-        ATTRIBUTE_ID_AUTHN_DATA                 = 30
+        ATTRIBUTE_ID_AUTHN_DATA                 = 30,
+        ATTRIBUTE_ID_EVENT_QUEUE_SPIN_TIME_US   = 31
     };
 
-    enum { NUM_ATTRIBUTES = 31 };
+    enum { NUM_ATTRIBUTES = 32 };
 
     enum {
         ATTRIBUTE_INDEX_MODE                       = 0,
@@ -5505,7 +5507,8 @@ class CommandLineParameters {
         ATTRIBUTE_INDEX_AUTO_PUB_SUB_MODULO        = 27,
         ATTRIBUTE_INDEX_TIMEOUT_SEC                = 28,
         ATTRIBUTE_INDEX_AUTHN_MECHANISM            = 29,
-        ATTRIBUTE_INDEX_AUTHN_DATA                 = 30
+        ATTRIBUTE_INDEX_AUTHN_DATA                 = 30,
+        ATTRIBUTE_INDEX_EVENT_QUEUE_SPIN_TIME_US   = 31
     };
 
     // CONSTANTS
@@ -5570,6 +5573,8 @@ class CommandLineParameters {
 
     static const char DEFAULT_INITIALIZER_AUTHN_DATA[];
 
+    static const int DEFAULT_INITIALIZER_EVENT_QUEUE_SPIN_TIME_US;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -5787,6 +5792,10 @@ class CommandLineParameters {
     /// object.
     bsl::string& authnData();
 
+    /// Return a reference to the modifiable "EventQueueSpinTimeUs" attribute
+    /// of this object.
+    int& eventQueueSpinTimeUs();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -5944,6 +5953,10 @@ class CommandLineParameters {
     /// attribute of this object.
     const bsl::string& authnData() const;
 
+    /// Return the value of the "EventQueueSpinTimeUs" attribute of this
+    /// object.
+    int eventQueueSpinTimeUs() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -10852,6 +10865,7 @@ void CommandLineParameters::hashAppendImpl(
     hashAppend(hashAlgorithm, this->timeoutSec());
     hashAppend(hashAlgorithm, this->authnMechanism());
     hashAppend(hashAlgorithm, this->authnData());
+    hashAppend(hashAlgorithm, this->eventQueueSpinTimeUs());
 }
 
 inline bool
@@ -10886,7 +10900,8 @@ CommandLineParameters::isEqualTo(const CommandLineParameters& rhs) const
            this->autoPubSubModulo() == rhs.autoPubSubModulo() &&
            this->timeoutSec() == rhs.timeoutSec() &&
            this->authnMechanism() == rhs.authnMechanism() &&
-           this->authnData() == rhs.authnData();
+           this->authnData() == rhs.authnData() &&
+           this->eventQueueSpinTimeUs() == rhs.eventQueueSpinTimeUs();
 }
 
 // CLASS METHODS
@@ -11083,6 +11098,13 @@ int CommandLineParameters::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_eventQueueSpinTimeUs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_EVENT_QUEUE_SPIN_TIME_US]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -11227,6 +11249,11 @@ int CommandLineParameters::manipulateAttribute(t_MANIPULATOR& manipulator,
         return manipulator(&d_authnData,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AUTHN_DATA]);
     }
+    case ATTRIBUTE_ID_EVENT_QUEUE_SPIN_TIME_US: {
+        return manipulator(
+            &d_eventQueueSpinTimeUs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_EVENT_QUEUE_SPIN_TIME_US]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -11402,6 +11429,11 @@ inline bsl::string& CommandLineParameters::authnData()
     return d_authnData;
 }
 
+inline int& CommandLineParameters::eventQueueSpinTimeUs()
+{
+    return d_eventQueueSpinTimeUs;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int CommandLineParameters::accessAttributes(t_ACCESSOR& accessor) const
@@ -11588,6 +11620,13 @@ int CommandLineParameters::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_eventQueueSpinTimeUs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_EVENT_QUEUE_SPIN_TIME_US]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -11723,6 +11762,11 @@ int CommandLineParameters::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_authnData,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AUTHN_DATA]);
     }
+    case ATTRIBUTE_ID_EVENT_QUEUE_SPIN_TIME_US: {
+        return accessor(
+            d_eventQueueSpinTimeUs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_EVENT_QUEUE_SPIN_TIME_US]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -11901,6 +11945,11 @@ inline const bsl::string& CommandLineParameters::authnData() const
     return d_authnData;
 }
 
+inline int CommandLineParameters::eventQueueSpinTimeUs() const
+{
+    return d_eventQueueSpinTimeUs;
+}
+
 // --------------------
 // class JournalCommand
 // --------------------
@@ -334,6 +334,7 @@ Parameters::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("messageProperties", d_messageProperties);
     printer.printAttribute("subscriptions", d_subscriptions);
     printer.printAttribute("timeout", d_timeout);
+    printer.printAttribute("eventQueueSpinTime", d_eventQueueSpinTime);
     printer.end();
 
     return stream;
@@ -414,6 +415,14 @@ bool Parameters::from(bsl::ostream&                stream,
     }
     bsls::TimeInterval timeout(params.timeoutSec(), 0);
 
+    if (params.eventQueueSpinTimeUs() < 0) {
+        stream << "Negative eventQueueSpinTimeUs values are not supported"
+               << "\n";
+        return false;  // RETURN
+    }
+    bsls::TimeInterval eventQueueSpinTime;
+    eventQueueSpinTime.addMicroseconds(params.eventQueueSpinTimeUs());
+
     // Populate output parameters struct
     setVerbosity(paramVerbosity);
     setLogFormat(params.logFormat());
@@ -445,6 +454,7 @@ bool Parameters::from(bsl::ostream&                stream,
     setTimeout(timeout);
     setAuthnMechanism(params.authnMechanism());
     setAuthnData(params.authnData());
+    setEventQueueSpinTime(eventQueueSpinTime);
 
     return true;
 }
@@ -286,6 +286,10 @@ class Parameters {
     bsl::string d_authnData;
     // Authentication data/credentials string.
 
+    bsls::TimeInterval d_eventQueueSpinTime;
+    // Time for which a thread waiting for events busy polls the event queue
+    // of the session before blocking.  Default: 0 (no busy polling)
+
   public:
     // CREATORS
 
@@ -325,6 +329,7 @@ class Parameters {
     Parameters& setTimeout(const bsls::TimeInterval& value);
     Parameters& setAuthnMechanism(const bsl::string& value);
     Parameters& setAuthnData(const bsl::string& value);
+    Parameters& setEventQueueSpinTime(const bsls::TimeInterval& value);
 
     // Set the corresponding member to the specified 'value' and return a
     // reference offering modifiable access to this object.
@@ -387,6 +392,7 @@ class Parameters {
     const bsls::TimeInterval&           timeout() const;
     const bsl::string&                  authnMechanism() const;
     const bsl::string&                  authnData() const;
+    const bsls::TimeInterval&           eventQueueSpinTime() const;
 
     const char* autoPubSubPropertyName() const;
 };
@@ -624,6 +630,13 @@ inline Parameters& Parameters::setAuthnData(const bsl::string& value)
     return *this;
 }
 
+inline Parameters&
+Parameters::setEventQueueSpinTime(const bsls::TimeInterval& value)
+{
+    d_eventQueueSpinTime = value;
+    return *this;
+}
+
 // ACCESSORS
 inline ParametersMode::Value Parameters::mode() const
 {
@@ -791,6 +804,11 @@ inline const bsl::string& Parameters::authnData() const
     return d_authnData;
 }
 
+inline const bsls::TimeInterval& Parameters::eventQueueSpinTime() const
+{
+    return d_eventQueueSpinTime;
+}
+
 }  // close package namespace
 
 // --------------------------
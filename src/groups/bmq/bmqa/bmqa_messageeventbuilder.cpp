@@ -26,6 +26,7 @@
 #include <bmqt_queueflags.h>
 
 // BDE
+#include <bsl_limits.h>
 #include <bsl_memory.h>
 #include <bslma_managedptr.h>
 #include <bslmf_assert.h>
@@ -41,6 +42,51 @@ BSLMF_ASSERT(sizeof(Message) == sizeof(MessageImpl));
 BSLMF_ASSERT(sizeof(MessageEvent) == sizeof(bsl::shared_ptr<bmqimp::Event>));
 BSLMF_ASSERT(sizeof(QueueId) == sizeof(bsl::shared_ptr<bmqimp::Queue>));
 
+/// Return `e_SUCCESS` if PUT messages can be posted to the specified
+/// `queue`, or the reason why they cannot otherwise.
+bmqt::EventBuilderResult::Enum validateQueue(const bmqimp::Queue& queue)
+{
+    // Check that the queue is valid, which means not only the OPENED state but
+    // it also may be in PENDING or REOPENING states and still accept PUT
+    // messages.
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!queue.isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return bmqt::EventBuilderResult::e_QUEUE_INVALID;  // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            !bmqt::QueueFlagsUtil::isWriter(queue.flags()))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return bmqt::EventBuilderResult::e_QUEUE_READONLY;  // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(queue.isSuspended())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return bmqt::EventBuilderResult::e_QUEUE_SUSPENDED;  // RETURN
+    }
+
+    return bmqt::EventBuilderResult::e_SUCCESS;
+}
+
+/// Account, in the specified `event` and `queue`, for the message with the
+/// specified `guid` and `correlationId` which was just packed by the
+/// specified `builder`.
+void onMessagePacked(bmqimp::Event*                        event,
+                     const bsl::shared_ptr<bmqimp::Queue>& queue,
+                     const bmqp::PutEventBuilder&          builder,
+                     const bmqt::MessageGUID&              guid,
+                     const bmqt::CorrelationId&            correlationId)
+{
+    if (builder.lastPackedMesageCompressionRatio() != 1) {
+        BSLS_ASSERT_SAFE(builder.lastPackedMesageCompressionRatio() != -1);
+        queue->statReportCompressionRatio(
+            builder.lastPackedMesageCompressionRatio());
+    }
+
+    // Add message related info into the event on success.
+    event->addMessageInfo(queue, guid, correlationId);
+}
+
 }  // close unnamed namespace
 
 // -------------------------
@@ -97,23 +143,11 @@ MessageEventBuilder::packMessage(const bmqa::QueueId& queueId)
     typedef bsl::shared_ptr<bmqimp::Queue> QueueSP;
     const QueueSP& queueSpRef = reinterpret_cast<const QueueSP&>(queueId);
 
-    // Check that the queue is valid, which means not only the OPENED state but
-    // it also may be in PENDING or REOPENING states and still accept PUT
-    // messages.
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!queueSpRef->isValid())) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return bmqt::EventBuilderResult::e_QUEUE_INVALID;  // RETURN
-    }
-
+    bmqt::EventBuilderResult::Enum rc = validateQueue(*queueSpRef);
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-            !bmqt::QueueFlagsUtil::isWriter(queueSpRef->flags()))) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return bmqt::EventBuilderResult::e_QUEUE_READONLY;  // RETURN
-    }
-
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(queueSpRef->isSuspended())) {
+            rc != bmqt::EventBuilderResult::e_SUCCESS)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return bmqt::EventBuilderResult::e_QUEUE_SUSPENDED;  // RETURN
+        return rc;  // RETURN
     }
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(builder->unpackedMessageSize() <=
@@ -134,8 +168,7 @@ MessageEventBuilder::packMessage(const bmqa::QueueId& queueId)
         builder->setFlags(bmqp::PutHeaderFlags::e_ACK_REQUESTED);
     }
 
-    bmqt::EventBuilderResult::Enum rc;
-    bmqt::MessageGUID              guid;
+    bmqt::MessageGUID guid;
     d_impl.d_guidGenerator_sp->generateGUID(&guid);
     builder->setMessageGUID(guid);
 
@@ -154,18 +187,124 @@ MessageEventBuilder::packMessage(const bmqa::QueueId& queueId)
 
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
             rc == bmqt::EventBuilderResult::e_SUCCESS)) {
-        if (builder->lastPackedMesageCompressionRatio() != 1) {
-            BSLS_ASSERT_SAFE(builder->lastPackedMesageCompressionRatio() !=
-                             -1);
-            queueSpRef->statReportCompressionRatio(
-                builder->lastPackedMesageCompressionRatio());
+        onMessagePacked(msgImplRef.d_event_p,
+                        queueSpRef,
+                        *builder,
+                        guid,
+                        corrId);
+    }
+
+    return rc;
+}
+
+bmqt::EventBuilderResult::Enum
+MessageEventBuilder::packMessages(const bmqa::QueueId&              queueId,
+                                  bsl::span<const bsl::string_view> payloads)
+{
+    return packMessages(queueId,
+                        payloads,
+                        bsl::span<const bmqt::CorrelationId>());
+}
+
+bmqt::EventBuilderResult::Enum MessageEventBuilder::packMessages(
+    const bmqa::QueueId&                 queueId,
+    bsl::span<const bsl::string_view>    payloads,
+    bsl::span<const bmqt::CorrelationId> correlationIds)
+{
+    // Get bmqa::MessageImpl from bmqa::Message
+    MessageImpl& msgImplRef = reinterpret_cast<MessageImpl&>(d_impl.d_msg);
+    BSLS_ASSERT_OPT(msgImplRef.d_event_p &&
+                    "StartMessage must be called before 'packMessages'.");
+    BSLS_ASSERT_OPT(correlationIds.empty() ||
+                    correlationIds.size() == payloads.size());
+    BSLS_ASSERT_SAFE(d_impl.d_guidGenerator_sp);
+
+    bmqp::PutEventBuilder* builder = msgImplRef.d_event_p->putEventBuilder();
+    BSLS_ASSERT_SAFE(builder->messageGUID().isUnset());
+
+    // Extract internal queueId; in order to do that, first get the rep
+    typedef bsl::shared_ptr<bmqimp::Queue> QueueSP;
+    const QueueSP& queueSpRef = reinterpret_cast<const QueueSP&>(queueId);
+
+    bmqt::EventBuilderResult::Enum rc = validateQueue(*queueSpRef);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            rc != bmqt::EventBuilderResult::e_SUCCESS)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc;  // RETURN
+    }
+
+    const bool isOldStyle = queueSpRef->isOldStyle();
+    if (!isOldStyle) {
+        // Encode the properties once for all the messages.  Note that the
+        // prepared properties are discarded by the next 'startMessage',
+        // 'setPropertiesRef' or 'packMessage', which all (re)set the
+        // properties or their info, so that modifying the properties after
+        // this call is safe.
+        bmqp::MessagePropertiesInfo info =
+            queueSpRef->schemaGenerator().getSchemaId(
+                builder->messageProperties());
+        builder->setMessagePropertiesInfo(info);
+        builder->prepareMessageProperties();
+    }
+
+    const bool isAck = bmqt::QueueFlagsUtil::isAck(queueSpRef->flags());
+
+    const bmqt::CorrelationId noCorrelationId;
+
+    for (size_t i = 0; i < payloads.size(); ++i) {
+        const bsl::string_view& payload = payloads[i];
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(payload.empty())) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return bmqt::EventBuilderResult::e_PAYLOAD_EMPTY;  // RETURN
+        }
+        BSLS_ASSERT_SAFE(payload.size() <=
+                         static_cast<size_t>(bsl::numeric_limits<int>::max()));
+
+        const bmqt::CorrelationId& corrId = correlationIds.empty()
+                                                ? noCorrelationId
+                                                : correlationIds[i];
+        if (corrId.isUnset()) {
+            if (isAck) {
+                // A queue opened with ackFlag requires a CorrelationId for
+                // every message posted.
+                return bmqt::EventBuilderResult::e_MISSING_CORRELATION_ID;
+                // RETURN
+            }
+        }
+        else {
+            builder->setFlags(bmqp::PutHeaderFlags::e_ACK_REQUESTED);
+        }
+
+        builder->setMessagePayload(payload.data(),
+                                   static_cast<int>(payload.size()));
+
+        bmqt::MessageGUID guid;
+        d_impl.d_guidGenerator_sp->generateGUID(&guid);
+        builder->setMessageGUID(guid);
+
+        if (isOldStyle) {
+            // Temporary; shall remove after 2nd roll out of "new style"
+            // brokers.
+            rc = builder->packMessageInOldStyle(queueSpRef->id());
+        }
+        else {
+            rc = builder->packMessage(queueSpRef->id());
         }
 
-        // Add message related info into the event on success.
-        msgImplRef.d_event_p->addMessageInfo(queueSpRef, guid, corrId);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                rc != bmqt::EventBuilderResult::e_SUCCESS)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return rc;  // RETURN
+        }
+
+        onMessagePacked(msgImplRef.d_event_p,
+                        queueSpRef,
+                        *builder,
+                        guid,
+                        corrId);
     }
 
-    return rc;
+    return bmqt::EventBuilderResult::e_SUCCESS;
 }
 
 void MessageEventBuilder::reset()
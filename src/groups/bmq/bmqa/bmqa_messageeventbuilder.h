@@ -74,6 +74,17 @@
 ///     being packing the message again.  Refer to [usage example
 ///     2](#bmqa_messageeventbuilder_ex2) for an illustration.
 ///
+///   - If it is desired to post many messages differing only by their
+///     payload (and correlation ID) to the same queue,
+///     @bbref{bmqa::MessageEventBuilder::packMessages} packs one message per
+///     payload of a span, using the current message as a template: its
+///     properties are encoded (and their checksum calculated) only once for
+///     the whole span, instead of once per message.  The properties may be
+///     modified in between two calls to
+///     @bbref{bmqa::MessageEventBuilder::packMessages}, but not while a call
+///     is in progress.  Refer to [usage example
+///     3](#bmqa_messageeventbuilder_ex3) for an illustration.
+///
 /// Example 1 - Basic Usage                     {#bmqa_messageeventbuilder_ex1}
 /// -----------------------
 ///
@@ -244,6 +255,37 @@
 /// builder.reset();
 /// ```
 ///
+/// Example 3 - Packing a span of payloads      {#bmqa_messageeventbuilder_ex3}
+/// --------------------------------------
+///
+/// ```
+/// // Note that error handling is omitted below for the sake of brevity
+///
+/// // 'session', 'properties' and 'builder' are set up as in the examples
+/// // above, and 'payloads' and 'correlationIds' are two vectors of the same
+/// // size, of 'bsl::string_view' and 'bmqt::CorrelationId' respectively.
+///
+/// bmqa::Message& msg = builder.startMessage();
+///
+/// // The properties set on the current message apply to all the messages.
+/// msg.setPropertiesRef(&properties);
+///
+/// // Pack one message per payload.
+/// int rc = builder.packMessages(queueId, payloads, correlationIds);
+///
+/// // Update the properties and pack another batch of messages, possibly in
+/// // the same message event.
+/// rc = properties.setPropertyAsInt64(
+///              "timestamp",
+///              bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::now()));
+///
+/// rc = builder.packMessages(queueId, otherPayloads, otherCorrelationIds);
+///
+/// rc = session.post(builder.messageEvent());
+///
+/// builder.reset();
+/// ```
+///
 /// Thread Safety                            {#bmqa_messageeventbuilder_thread}
 /// =============
 ///
@@ -255,11 +297,14 @@
 
 #include <bmqa_message.h>
 #include <bmqa_messageevent.h>
+#include <bmqt_correlationid.h>
 #include <bmqt_resultcode.h>
 
 // BDE
 #include <bsl_functional.h>
 #include <bsl_memory.h>
+#include <bsl_span.h>
+#include <bsl_string_view.h>
 
 namespace BloombergLP {
 
@@ -357,6 +402,32 @@ class MessageEventBuilder {
     /// the `correlationId` which is cleared.
     bmqt::EventBuilderResult::Enum packMessage(const bmqa::QueueId& queueId);
 
+    /// Add one message per element of the specified `payloads` into the
+    /// message event under construction, in order, with the specified
+    /// `queueId` as their destination queue, and the element at the same
+    /// index in the optionally specified `correlationIds`, if any, as their
+    /// correlation ID.  All the other attributes of these messages
+    /// (properties, group ID, compression algorithm) are those of the
+    /// current message, whose properties are encoded only once for all of
+    /// them.  Return zero on success, non-zero value otherwise.  In case of
+    /// failure, the messages of `payloads` preceding the one which could not
+    /// be added remain in the message event, and `messageCount` tells how
+    /// many were added.  The behavior is undefined unless `correlationIds`
+    /// is empty or of the same size as `payloads`, and the properties of the
+    /// current message are not modified during the call.  The result is one
+    /// of the values from the `bmqt::EventBuilderResult::Enum` enum.  Note
+    /// that `correlationIds` must be provided if `queueId` was opened with
+    /// the ACK flag.  Also note that on return, the payload of the current
+    /// message refers to the last element of `payloads`, and must be set
+    /// again before calling `packMessage`.
+    bmqt::EventBuilderResult::Enum
+    packMessages(const bmqa::QueueId&              queueId,
+                 bsl::span<const bsl::string_view> payloads);
+    bmqt::EventBuilderResult::Enum
+    packMessages(const bmqa::QueueId&                 queueId,
+                 bsl::span<const bsl::string_view>    payloads,
+                 bsl::span<const bmqt::CorrelationId> correlationIds);
+
     /// Reset the builder, effectively discarding the `MessageEvent` under
     /// construction.
     void reset();
@@ -16,9 +16,12 @@
 #include <bmqa_messageeventbuilder.h>
 
 // BDE
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
 #include <bsla_annotations.h>
 
 // BMQ
+#include <bmqa_messageproperties.h>
 #include <bmqa_mocksession.h>
 #include <bmqt_queueflags.h>
 
@@ -160,6 +163,119 @@ static void test2_testMessageEventSizeCount()
     BMQTST_ASSERT_EQ(0, builder.messageCount());
 }
 
+static void test3_packMessages()
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // Can't ensure no default memory is allocated because a default
+    // QueueId is instantiated and that uses the default allocator to
+    // allocate memory for an automatically generated CorrelationId.
+
+    bmqtst::TestHelper::printTestName("PACK MESSAGES TEST");
+
+    // Stage 1: preparation
+    // Start a session and open a queue
+    bmqa::MockSession session(
+        bmqt::SessionOptions(bmqtst::TestHelperUtil::allocator()),
+        bmqtst::TestHelperUtil::allocator());
+
+    {
+        // Start session
+        BMQA_EXPECT_CALL(session, start()).returning(0);
+        const int rc = session.start();
+        BMQTST_ASSERT_EQ(rc, 0);
+    }
+
+    bmqt::Uri uri(bmqtst::TestHelperUtil::allocator());
+
+    {
+        // Parse uri
+        bsl::string error(bmqtst::TestHelperUtil::allocator());
+        bsl::string input("bmq://my.domain/queue",
+                          bmqtst::TestHelperUtil::allocator());
+        const int   rc = bmqt::UriParser::parse(&uri, &error, input);
+        BMQTST_ASSERT_EQ(rc, 0);
+    }
+
+    bmqt::CorrelationId queueCId = bmqt::CorrelationId::autoValue();
+    bmqa::QueueId       queueId(queueCId, bmqtst::TestHelperUtil::allocator());
+
+    {
+        // Open queue
+        BMQA_EXPECT_CALL(session,
+                         openQueue(&queueId, uri, bmqt::QueueFlags::e_WRITE))
+            .returning(0);
+        const int rc = session.openQueue(&queueId,
+                                         uri,
+                                         bmqt::QueueFlags::e_WRITE);
+        BMQTST_ASSERT_EQ(rc, 0);
+    }
+
+    bmqa::MessageProperties properties(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, properties.setPropertyAsInt32("encoding", 3));
+    BMQTST_ASSERT_EQ(0, properties.setPropertyAsString("producerId", "id"));
+
+    bsl::vector<bsl::string_view> payloads(
+        bmqtst::TestHelperUtil::allocator());
+    payloads.push_back("first payload");
+    payloads.push_back("second payload");
+    payloads.push_back("third payload");
+
+    bsl::vector<bmqt::CorrelationId> correlationIds(
+        bmqtst::TestHelperUtil::allocator());
+    for (size_t i = 0; i < payloads.size(); ++i) {
+        correlationIds.push_back(bmqt::CorrelationId::autoValue());
+    }
+
+    // Stage 2: pack a span of payloads, and the same payloads one by one
+    bmqa::MessageEventBuilder builder;
+    session.loadMessageEventBuilder(&builder);
+
+    bmqa::MessageEventBuilder expected;
+    session.loadMessageEventBuilder(&expected);
+
+    builder.startMessage().setPropertiesRef(&properties);
+    BMQTST_ASSERT_EQ(builder.packMessages(queueId, payloads, correlationIds),
+                     bmqt::EventBuilderResult::e_SUCCESS);
+    BMQTST_ASSERT_EQ(static_cast<int>(payloads.size()),
+                     builder.messageCount());
+
+    bmqa::Message& msg = expected.startMessage();
+    msg.setPropertiesRef(&properties);
+    for (size_t i = 0; i < payloads.size(); ++i) {
+        msg.setCorrelationId(correlationIds[i]);
+        msg.setDataRef(payloads[i].data(), payloads[i].size());
+        BMQTST_ASSERT_EQ(expected.packMessage(queueId),
+                         bmqt::EventBuilderResult::e_SUCCESS);
+    }
+
+    // Both events only differ by the GUIDs of their messages
+    BMQTST_ASSERT_EQ(expected.messageCount(), builder.messageCount());
+    BMQTST_ASSERT_EQ(expected.messageEventSize(), builder.messageEventSize());
+
+    // Stage 3: modify the properties and pack the payloads again, without
+    // correlation IDs
+    BMQTST_ASSERT_EQ(0, properties.setPropertyAsInt64("timestamp", 123));
+    BMQTST_ASSERT_EQ(builder.packMessages(queueId, payloads),
+                     bmqt::EventBuilderResult::e_SUCCESS);
+    BMQTST_ASSERT_EQ(static_cast<int>(2 * payloads.size()),
+                     builder.messageCount());
+    BMQTST_ASSERT_LT(2 * expected.messageEventSize(),
+                     builder.messageEventSize());
+
+    // Stage 4: an empty payload stops the packing, keeping the messages
+    // preceding it
+    const int countBefore = builder.messageCount();
+
+    payloads[1] = bsl::string_view();
+    BMQTST_ASSERT_EQ(builder.packMessages(queueId, payloads),
+                     bmqt::EventBuilderResult::e_PAYLOAD_EMPTY);
+    BMQTST_ASSERT_EQ(countBefore + 1, builder.messageCount());
+
+    // Stage 5: build MessageEvent
+    static_cast<void>(builder.messageEvent());
+    BMQTST_ASSERT_EQ(countBefore + 1, builder.messageCount());
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -172,6 +288,7 @@ int main(int argc, char* argv[])
     case 0:
     case 1: test1_breathingTest(); break;
     case 2: test2_testMessageEventSizeCount(); break;
+    case 3: test3_packMessages(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
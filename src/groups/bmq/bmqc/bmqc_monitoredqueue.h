@@ -329,6 +329,10 @@ class MonitoredQueue {
     /// Return `true` if this queue is empty and `false` otherwise.
     bool isEmpty() const;
 
+    /// Return `true` if queuing is disabled on this queue, and `false`
+    /// otherwise.
+    bool isPushBackDisabled() const;
+
     /// Return the low watermark set by the last call to `setWatermarks`.
     bsls::Types::Int64 lowWatermark() const;
 
@@ -584,14 +588,13 @@ inline int MonitoredQueue<QUEUE, QUEUE_TRAITS>::pushBack(
 {
     const bsls::Types::Int64 currentQueueLen = numElements();
     if (currentQueueLen + 1 >= capacity()) {
-        // We've filled the queue.  Alarm
+        // We've filled the queue.  Alarm, and block in the underlying queue
+        // until space is available, as documented.
         if (!Traits::isPushBackDisabled(d_queue) &&
             setState(MonitoredQueueState::e_QUEUE_FILLED) &&
             d_stateChangedCb) {
             d_stateChangedCb(MonitoredQueueState::e_QUEUE_FILLED);
         }
-
-        return -1;  // RETURN
     }
 
     if (d_queue.pushBack(bslmf::MovableRefUtil::move(value)) != 0) {
@@ -734,6 +737,12 @@ inline bool MonitoredQueue<QUEUE, QUEUE_TRAITS>::isEmpty() const
     return d_queue.isEmpty();
 }
 
+template <class QUEUE, class QUEUE_TRAITS>
+inline bool MonitoredQueue<QUEUE, QUEUE_TRAITS>::isPushBackDisabled() const
+{
+    return Traits::isPushBackDisabled(d_queue);
+}
+
 template <class QUEUE, class QUEUE_TRAITS>
 inline bsls::Types::Int64
 MonitoredQueue<QUEUE, QUEUE_TRAITS>::lowWatermark() const
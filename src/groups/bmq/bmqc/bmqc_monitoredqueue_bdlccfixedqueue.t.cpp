@@ -17,14 +17,19 @@
 
 // BDE
 #include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
 #include <bdlmt_threadpool.h>
 #include <bdlt_timeunitratio.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
+#include <bsl_vector.h>
 #include <bsla_annotations.h>
+#include <bslmf_movableref.h>
 #include <bslmt_barrier.h>
 #include <bslmt_latch.h>
 #include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
 #include <bsls_timeinterval.h>
 #include <bsls_timeutil.h>
 #include <bsls_types.h>
@@ -195,6 +200,25 @@ static void runPerformanceTest(bmqtst::Table* table,
     addResult(table, queueName, numPushers, numIterations, elapsed);
 }
 
+/// Append the specified `value` to the back of the specified `queue` using
+/// the blocking `pushBack` taking a movable reference, load the result into
+/// the specified `rc`, and then set the specified `isDone` flag.
+template <class QUEUE>
+static void
+movePusher(QUEUE* queue, int value, int* rc, bsls::AtomicBool* isDone)
+{
+    *rc = queue->pushBack(bslmf::MovableRefUtil::move(value));
+    *isDone = true;
+}
+
+/// Record the specified `state` in the specified `states`.
+static void
+onStateChanged(bsl::vector<bmqc::MonitoredQueueState::Enum>* states,
+               bmqc::MonitoredQueueState::Enum               state)
+{
+    states->push_back(state);
+}
+
 }  // Close anonymous namespace
 
 // Check that all member functions can be instantiated.
@@ -420,6 +444,133 @@ static void test2_MonitoredQueue_reset()
     BMQTST_ASSERT_EQ(queue.state(), bmqc::MonitoredQueueState::e_NORMAL);
 }
 
+static void test3_MonitoredQueue_pushBackFullQueue()
+// ------------------------------------------------------------------------
+// MONITORED QUEUE - PUSH BACK TO A FULL QUEUE
+//
+// Concerns:
+//   1. Filling the queue with 'pushBack(MovableRef)' raises the
+//      'e_QUEUE_FILLED' alarm.
+//   2. 'pushBack(MovableRef)' to a full queue blocks until space is
+//      available, and then appends the value to the queue, as does
+//      'pushBack(const ElementType&)'.
+//   3. 'pushBack(MovableRef)' blocked on a full queue fails once the queue
+//      is disabled.
+//
+// Plan:
+//   1. Fill the queue with 'pushBack(MovableRef)' and verify the state of
+//      the queue and that the state callback was invoked.
+//   2. Push one more value from another thread, verify that the push is
+//      blocked, pop a value and verify that the push completes.
+//   3. Push one more value from another thread, verify that the push is
+//      blocked, disable the queue and verify that the push fails.
+//
+// Testing:
+//   pushBack(bslmf::MovableRef<ElementType> value)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckGblAlloc() = true;
+    // Can't ensure no global memory is allocated because
+    // 'bslmt::ThreadUtil::create()' uses the global allocator to allocate
+    // memory.
+
+    bmqtst::TestHelper::printTestName(
+        "MONITORED QUEUE - PUSH BACK TO A FULL QUEUE");
+
+    // CONSTANTS
+    const int                k_QUEUE_SIZE      = 10;
+    const int                k_LOW_WATERMARK   = 3;
+    const int                k_HIGH_WATERMARK  = 6;
+    const int                k_HIGH_WATERMARK2 = 9;
+    const bsls::TimeInterval k_BLOCKED_DELAY(
+        0,
+        50 * bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MILLISECOND);
+
+    typedef bmqc::MonitoredQueue<bdlcc::FixedQueue<int> > Queue;
+
+    bsl::vector<bmqc::MonitoredQueueState::Enum> states(
+        bmqtst::TestHelperUtil::allocator());
+
+    Queue queue(k_QUEUE_SIZE, bmqtst::TestHelperUtil::allocator());
+    queue.setWatermarks(k_LOW_WATERMARK, k_HIGH_WATERMARK, k_HIGH_WATERMARK2);
+    queue.setStateCallback(
+        bdlf::BindUtil::bind(&onStateChanged,
+                             &states,
+                             bdlf::PlaceHolders::_1));  // state
+
+    // 1. Fill the queue
+    for (int i = 0; i < k_QUEUE_SIZE; ++i) {
+        int value = i;
+        BMQTST_ASSERT_EQ_D(i,
+                           queue.pushBack(bslmf::MovableRefUtil::move(value)),
+                           0);
+    }
+
+    BMQTST_ASSERT_EQ(queue.numElements(), k_QUEUE_SIZE);
+    BMQTST_ASSERT_EQ(queue.state(), bmqc::MonitoredQueueState::e_QUEUE_FILLED);
+    BMQTST_ASSERT_EQ(states.empty(), false);
+    BMQTST_ASSERT_EQ(states.back(), bmqc::MonitoredQueueState::e_QUEUE_FILLED);
+
+    // 2. Push to the full queue, and make room
+    {
+        int                       rc = -1;
+        bsls::AtomicBool          isDone(false);
+        bslmt::ThreadUtil::Handle handle;
+        BSLS_ASSERT_OPT(bslmt::ThreadUtil::create(
+                            &handle,
+                            bdlf::BindUtil::bind(&movePusher<Queue>,
+                                                 &queue,
+                                                 k_QUEUE_SIZE,
+                                                 &rc,
+                                                 &isDone)) == 0);
+
+        bslmt::ThreadUtil::sleep(k_BLOCKED_DELAY);
+        BMQTST_ASSERT_EQ(isDone.load(), false);
+        BMQTST_ASSERT_EQ(queue.numElements(), k_QUEUE_SIZE);
+
+        int item = -1;
+        BMQTST_ASSERT_EQ(queue.popFront(&item), 0);
+        BMQTST_ASSERT_EQ(item, 0);
+
+        bslmt::ThreadUtil::join(handle);
+        BMQTST_ASSERT_EQ(isDone.load(), true);
+        BMQTST_ASSERT_EQ(rc, 0);
+        BMQTST_ASSERT_EQ(queue.numElements(), k_QUEUE_SIZE);
+    }
+
+    // 3. Push to the full queue, and disable it
+    {
+        int                       rc = 0;
+        bsls::AtomicBool          isDone(false);
+        bslmt::ThreadUtil::Handle handle;
+        BSLS_ASSERT_OPT(bslmt::ThreadUtil::create(
+                            &handle,
+                            bdlf::BindUtil::bind(&movePusher<Queue>,
+                                                 &queue,
+                                                 k_QUEUE_SIZE + 1,
+                                                 &rc,
+                                                 &isDone)) == 0);
+
+        bslmt::ThreadUtil::sleep(k_BLOCKED_DELAY);
+        BMQTST_ASSERT_EQ(isDone.load(), false);
+
+        queue.disablePushBack();
+
+        bslmt::ThreadUtil::join(handle);
+        BMQTST_ASSERT_EQ(isDone.load(), true);
+        BMQTST_ASSERT_NE(rc, 0);
+        BMQTST_ASSERT_EQ(queue.numElements(), k_QUEUE_SIZE);
+    }
+
+    // The values are in order
+    for (int i = 1; i <= k_QUEUE_SIZE; ++i) {
+        int item = -1;
+        BMQTST_ASSERT_EQ_D(i, queue.tryPopFront(&item), 0);
+        BMQTST_ASSERT_EQ_D(i, item, i);
+    }
+    BMQTST_ASSERT_EQ(queue.isEmpty(), true);
+}
+
 static void testN1_performance()
 // ------------------------------------------------------------------------
 // PERFORMANCE TEST
@@ -493,6 +644,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 3: test3_MonitoredQueue_pushBackFullQueue(); break;
     case 2: test2_MonitoredQueue_reset(); break;
     case 1: test1_MonitoredQueue_breathingTest(); break;
     case -1: testN1_performance(); break;
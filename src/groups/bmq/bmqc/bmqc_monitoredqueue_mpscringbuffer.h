@@ -0,0 +1,125 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BMQC_MONITOREDQUEUE_MPSCRINGBUFFER
+#define INCLUDED_BMQC_MONITOREDQUEUE_MPSCRINGBUFFER
+
+//@PURPOSE: Provide 'MonitoredQueueTraits' for 'bmqc::MPSCRingBuffer'.
+//
+//@CLASSES:
+//  MonitoredQueueTraits: specialization for 'bmqc::MPSCRingBuffer'
+//
+//@SEE_ALSO: bmqc_monitoredqueue, bmqc_mpscringbuffer
+//
+//@DESCRIPTION: This component defines a partial specialization of
+// 'bmqc::MonitoredQueueTraits' that interfaces 'bmqc::MonitoredQueue' with
+// 'bmqc::MPSCRingBuffer'.
+
+#include <bmqc_monitoredqueue.h>
+#include <bmqc_mpscringbuffer.h>
+
+// BDE
+#include <bslma_allocator.h>
+
+namespace BloombergLP {
+
+namespace bmqc {
+
+// =====================================================
+// struct MonitoredQueueTraits< MPSCRingBuffer<ELEMENT> >
+// =====================================================
+
+/// This specialization provides the types and functions necessary to
+/// interface a `bmqc::MonitoredQueue` with a `bmqc::MPSCRingBuffer`.
+template <typename ELEMENT>
+struct MonitoredQueueTraits<MPSCRingBuffer<ELEMENT> > {
+    // PUBLIC TYPES
+    typedef ELEMENT                 ElementType;
+    typedef int                     InitialCapacityType;
+    typedef MPSCRingBuffer<ELEMENT> QueueType;
+
+    // CLASS METHODS
+
+    /// Return the maximum number of elements that may be stored in the
+    /// specified `queue`.  See the documentation of `bmqc::MPSCRingBuffer`
+    /// for more details.
+    static int capacity(const QueueType& queue);
+
+    /// Return `true` if the specified `queue` is enqueue disabled, and
+    /// `false` otherwise.
+    static bool isPushBackDisabled(const QueueType& queue);
+
+    /// Disable enqueuing into the specified `queue`.
+    static void disablePushBack(QueueType* queue);
+
+    /// Enable enqueuing into the specified `queue`.
+    static void enablePushBack(QueueType* queue);
+
+    /// Remove the element from the front of the specified `queue` and load
+    /// that element into the specified `buffer`, blocking until the queue is
+    /// not empty if necessary.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    static int popFront(QueueType* queue, ElementType* buffer);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -----------------------------------------------------
+// struct MonitoredQueueTraits< MPSCRingBuffer<ELEMENT> >
+// -----------------------------------------------------
+
+template <typename ELEMENT>
+inline int MonitoredQueueTraits<MPSCRingBuffer<ELEMENT> >::capacity(
+    const QueueType& queue)
+{
+    return queue.capacity();
+}
+
+template <typename ELEMENT>
+inline bool
+MonitoredQueueTraits<MPSCRingBuffer<ELEMENT> >::isPushBackDisabled(
+    const QueueType& queue)
+{
+    return queue.isPushBackDisabled();
+}
+
+template <typename ELEMENT>
+inline void MonitoredQueueTraits<MPSCRingBuffer<ELEMENT> >::disablePushBack(
+    QueueType* queue)
+{
+    queue->disablePushBack();
+}
+
+template <typename ELEMENT>
+inline void MonitoredQueueTraits<MPSCRingBuffer<ELEMENT> >::enablePushBack(
+    QueueType* queue)
+{
+    queue->enablePushBack();
+}
+
+template <typename ELEMENT>
+inline int MonitoredQueueTraits<MPSCRingBuffer<ELEMENT> >::popFront(
+    QueueType*   queue,
+    ElementType* buffer)
+{
+    return queue->popFront(buffer);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,629 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BMQC_MPSCRINGBUFFER
+#define INCLUDED_BMQC_MPSCRINGBUFFER
+
+//@PURPOSE: Provide a bounded lock-free multi-producer single-consumer queue.
+//
+//@CLASSES:
+//  bmqc::MPSCRingBuffer: bounded lock-free MPSC queue
+//
+//@SEE_ALSO: bdlcc_singleconsumerqueue, bdlcc_fixedqueue
+//
+//@DESCRIPTION: This component defines a mechanism, 'bmqc::MPSCRingBuffer',
+// which is a bounded, thread-aware, queue of values of the parameterized
+// 'TYPE', supporting any number of concurrent producers but only one
+// consumer.
+//
+// All the slots of the queue are allocated at construction, and values are
+// stored inline in their slot: contrary to 'bdlcc::SingleConsumerQueue',
+// enqueuing and dequeuing never allocate memory.  A value is moved (if
+// possible) in its slot on enqueue, and out of its slot on dequeue.  The
+// capacity of the queue is the capacity requested at construction, rounded up
+// to the next power of two.
+//
+// Producers claim a slot using an atomic counter and publish the value by
+// updating a sequence number stored in the slot, so that neither producers nor
+// the consumer ever lock on the fast path.  The counters of the producers and
+// of the consumer are padded to their own cache line, in order to avoid false
+// sharing between them.  The consumer (respectively, producers) only lock a
+// mutex when it has to block because the queue is empty (respectively, full).
+//
+/// Thread Safety
+///-------------
+// The push manipulators ('pushBack', 'tryPushBack') are thread-safe and may be
+// called concurrently from any number of threads.  The pop manipulators
+// ('popFront', 'tryPopFront', 'removeAll') must only be called from a single
+// thread at a time (the consumer).  The accessors may be called from any
+// thread, but, except when called from the consumer, their result is only a
+// snapshot which may be outdated by the time it is returned.
+//
+/// Usage
+///-----
+// First, create a queue of integers:
+//..
+//  bmqc::MPSCRingBuffer<int> queue(1024, allocator);
+//  assert(queue.capacity() == 1024);
+//..
+// Then, enqueue some items, potentially from multiple threads:
+//..
+//  queue.pushBack(1);
+//  queue.pushBack(2);
+//..
+// Finally, dequeue them from a single thread:
+//..
+//  int value;
+//  queue.popFront(&value);
+//  assert(value == 1);
+//  queue.popFront(&value);
+//  assert(value == 2);
+//  assert(queue.tryPopFront(&value) != 0);
+//..
+
+// BDE
+#include <bsl_new.h>
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bmqc {
+
+// ====================
+// class MPSCRingBuffer
+// ====================
+
+/// Bounded lock-free queue of values of the parameterized `TYPE`, supporting
+/// multiple concurrent producers and a single consumer.
+template <class TYPE>
+class MPSCRingBuffer BSLS_KEYWORD_FINAL {
+  public:
+    // PUBLIC TYPES
+    typedef TYPE value_type;
+
+  private:
+    // PRIVATE TYPES
+
+    /// A slot of the ring buffer.  The slot at position `p` is free for the
+    /// producer claiming the position `p` when its `d_sequence` is `p`, and
+    /// holds the value published at position `p` when its `d_sequence` is
+    /// `p + 1`.
+    struct Cell {
+        bsls::AtomicInt64        d_sequence;
+        bsls::ObjectBuffer<TYPE> d_value;
+    };
+
+    enum {
+        /// Size of a cache line, used to pad the counters of the producers
+        /// and the consumer.
+        k_CACHE_LINE_SIZE = 64
+    };
+
+    /// Enum for the various RC error categories
+    enum RcEnum {
+        rc_SUCCESS  = 0,
+        rc_EMPTY    = -1,
+        rc_FULL     = -2,
+        rc_DISABLED = -3
+    };
+
+    // DATA
+
+    /// Slots of the ring buffer.
+    Cell* d_cells_p;
+
+    /// Number of slots in `d_cells_p`, always a power of two.
+    const bsls::Types::Int64 d_capacity;
+
+    /// Mask to apply to a position to get the index of its slot.
+    const bsls::Types::Int64 d_mask;
+
+    /// Allocator used to supply memory.
+    bslma::Allocator* d_allocator_p;
+
+    char d_producersPadding[k_CACHE_LINE_SIZE];
+
+    /// Next position to be claimed by a producer.
+    bsls::AtomicInt64 d_pushPosition;
+
+    char d_consumerPadding[k_CACHE_LINE_SIZE - sizeof(bsls::AtomicInt64)];
+
+    /// Next position to be read by the consumer.  Only modified by the
+    /// consumer.
+    bsls::AtomicInt64 d_popPosition;
+
+    char d_statePadding[k_CACHE_LINE_SIZE - sizeof(bsls::AtomicInt64)];
+
+    /// Whether enqueuing is disabled.
+    bsls::AtomicBool d_isPushBackDisabled;
+
+    /// Whether the consumer is, or is about to be, blocked on
+    /// `d_notEmptyCondition`.
+    bsls::AtomicBool d_isConsumerWaiting;
+
+    /// Number of producers blocked, or about to be blocked, on
+    /// `d_notFullCondition`.
+    bsls::AtomicInt d_numWaitingProducers;
+
+    /// Mutex used by the threads which have to block.
+    bslmt::Mutex d_mutex;
+
+    /// Condition signaled when a value is published while the consumer is
+    /// waiting.
+    bslmt::Condition d_notEmptyCondition;
+
+    /// Condition signaled when a slot is freed while producers are waiting,
+    /// or when enqueuing is disabled.
+    bslmt::Condition d_notFullCondition;
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Return the smallest power of two greater than or equal to the
+    /// specified `capacity`, and to 2.
+    static bsls::Types::Int64 roundUpCapacity(int capacity);
+
+    // PRIVATE MANIPULATORS
+
+    /// Claim a slot for a new value.  Return a pointer to the claimed slot
+    /// on success, and 0 with the reason loaded in the specified `rc`
+    /// otherwise.
+    Cell* claimSlot(int* rc);
+
+    /// Publish the value constructed in the specified `cell`, having been
+    /// claimed at the specified `position`, and wake up the consumer if
+    /// necessary.
+    void publishSlot(Cell* cell, bsls::Types::Int64 position);
+
+    /// Release the slot of the value at the front of this queue, having
+    /// been read, and wake up the producers if necessary.
+    void releaseSlot(Cell* cell, bsls::Types::Int64 position);
+
+    /// Block until the queue is not full or enqueuing is disabled.
+    void waitUntilNotFull();
+
+    // PRIVATE ACCESSORS
+
+    /// Return `true` if the slot at the front of this queue holds a
+    /// published value.  Note that this uses sequentially consistent loads
+    /// to avoid missed wake-ups.
+    bool isFrontPublished() const;
+
+    /// Return `true` if the slot at the back of this queue is not free.
+    /// Note that this uses sequentially consistent loads to avoid missed
+    /// wake-ups.
+    bool isBackClaimed() const;
+
+  private:
+    // NOT IMPLEMENTED
+    MPSCRingBuffer(const MPSCRingBuffer&) BSLS_KEYWORD_DELETED;
+    MPSCRingBuffer& operator=(const MPSCRingBuffer&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MPSCRingBuffer, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a queue having a capacity of at least the specified
+    /// `capacity` values.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.  The behavior is undefined unless
+    /// `0 < capacity`.
+    explicit MPSCRingBuffer(int               capacity,
+                            bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object, and all the values it holds.
+    ~MPSCRingBuffer();
+
+    // MANIPULATORS
+
+    /// Append the specified `value` to the back of this queue, blocking
+    /// until space is available if necessary.  Return 0 on success, and a
+    /// non-zero value if enqueuing is disabled.
+    int pushBack(const TYPE& value);
+
+    /// Append the specified move-insertable `value` to the back of this
+    /// queue, blocking until space is available if necessary.  Return 0 on
+    /// success, and a non-zero value if enqueuing is disabled, in which case
+    /// `value` is not modified.
+    int pushBack(bslmf::MovableRef<TYPE> value);
+
+    /// Attempt to append the specified `value` to the back of this queue
+    /// without blocking.  Return 0 on success, and a non-zero value if the
+    /// queue is full or enqueuing is disabled.
+    int tryPushBack(const TYPE& value);
+
+    /// Attempt to append the specified move-insertable `value` to the back
+    /// of this queue without blocking.  Return 0 on success, and a non-zero
+    /// value if the queue is full or enqueuing is disabled, in which case
+    /// `value` is not modified.
+    int tryPushBack(bslmf::MovableRef<TYPE> value);
+
+    /// Remove the value at the front of this queue and load it into the
+    /// specified `value`, blocking until this queue is not empty if
+    /// necessary.  Return 0.  Note that, contrary to enqueuing, dequeuing
+    /// is never disabled.  The behavior is undefined unless called from
+    /// the consumer.
+    int popFront(TYPE* value);
+
+    /// Attempt to remove the value at the front of this queue without
+    /// blocking and, on success, load it into the specified `value`.
+    /// Return 0 on success, and a non-zero value if this queue is empty.
+    /// The behavior is undefined unless called from the consumer.
+    int tryPopFront(TYPE* value);
+
+    /// Remove and destroy all the values in this queue.  The behavior is
+    /// undefined unless called from the consumer.
+    void removeAll();
+
+    /// Disable enqueuing into this queue.  All subsequent calls to
+    /// `pushBack` and `tryPushBack` fail immediately, as do the blocked
+    /// calls to `pushBack`.
+    void disablePushBack();
+
+    /// Enable enqueuing into this queue.
+    void enablePushBack();
+
+    // ACCESSORS
+
+    /// Return the maximum number of values that may be stored in this
+    /// queue.
+    int capacity() const;
+
+    /// Return the number of values in this queue.
+    bsls::Types::Int64 numElements() const;
+
+    /// Return `true` if this queue is empty, and `false` otherwise.
+    bool isEmpty() const;
+
+    /// Return `true` if enqueuing into this queue is disabled, and `false`
+    /// otherwise.
+    bool isPushBackDisabled() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// --------------------
+// class MPSCRingBuffer
+// --------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+inline bsls::Types::Int64 MPSCRingBuffer<TYPE>::roundUpCapacity(int capacity)
+{
+    bsls::Types::Int64 result = 2;
+    while (result < capacity) {
+        result <<= 1;
+    }
+    return result;
+}
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+inline typename MPSCRingBuffer<TYPE>::Cell*
+MPSCRingBuffer<TYPE>::claimSlot(int* rc)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(rc);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            d_isPushBackDisabled.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        *rc = rc_DISABLED;
+        return 0;  // RETURN
+    }
+
+    bsls::Types::Int64 position = d_pushPosition.loadRelaxed();
+    while (true) {
+        Cell&                    cell     = d_cells_p[position & d_mask];
+        const bsls::Types::Int64 sequence = cell.d_sequence.loadAcquire();
+
+        if (sequence == position) {
+            // The slot is free: try to claim it.
+            const bsls::Types::Int64 previous =
+                d_pushPosition.testAndSwapAcqRel(position, position + 1);
+            if (previous == position) {
+                return &cell;  // RETURN
+            }
+            position = previous;
+        }
+        else if (sequence < position) {
+            // The slot still holds the value published one lap ago.
+            *rc = rc_FULL;
+            return 0;  // RETURN
+        }
+        else {
+            // Another producer claimed this position.
+            position = d_pushPosition.loadRelaxed();
+        }
+    }
+}
+
+template <class TYPE>
+inline void MPSCRingBuffer<TYPE>::publishSlot(Cell*              cell,
+                                              bsls::Types::Int64 position)
+{
+    // The sequentially consistent store of the sequence, followed by the
+    // sequentially consistent load of 'd_isConsumerWaiting', pairs with the
+    // opposite sequence in 'popFront' so that either the consumer sees the
+    // value, or this producer sees the consumer waiting.
+    cell->d_sequence.store(position + 1);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_isConsumerWaiting.load())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        d_notEmptyCondition.signal();
+    }
+}
+
+template <class TYPE>
+inline void MPSCRingBuffer<TYPE>::releaseSlot(Cell*              cell,
+                                              bsls::Types::Int64 position)
+{
+    bslma::DestructionUtil::destroy(cell->d_value.address());
+
+    d_popPosition.storeRelease(position + 1);
+
+    // See 'publishSlot'.
+    cell->d_sequence.store(position + d_capacity);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_numWaitingProducers.load())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        d_notFullCondition.broadcast();
+    }
+}
+
+template <class TYPE>
+inline void MPSCRingBuffer<TYPE>::waitUntilNotFull()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    d_numWaitingProducers.add(1);
+    while (isBackClaimed() && !d_isPushBackDisabled.load()) {
+        d_notFullCondition.wait(&d_mutex);
+    }
+    d_numWaitingProducers.add(-1);
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+inline bool MPSCRingBuffer<TYPE>::isFrontPublished() const
+{
+    const bsls::Types::Int64 position = d_popPosition.loadRelaxed();
+    return d_cells_p[position & d_mask].d_sequence.load() == position + 1;
+}
+
+template <class TYPE>
+inline bool MPSCRingBuffer<TYPE>::isBackClaimed() const
+{
+    const bsls::Types::Int64 position = d_pushPosition.load();
+    return d_cells_p[position & d_mask].d_sequence.load() < position;
+}
+
+// CREATORS
+template <class TYPE>
+inline MPSCRingBuffer<TYPE>::MPSCRingBuffer(int               capacity,
+                                            bslma::Allocator* basicAllocator)
+: d_cells_p(0)
+, d_capacity(roundUpCapacity(capacity))
+, d_mask(d_capacity - 1)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_pushPosition(0)
+, d_popPosition(0)
+, d_isPushBackDisabled(false)
+, d_isConsumerWaiting(false)
+, d_numWaitingProducers(0)
+, d_mutex()
+, d_notEmptyCondition()
+, d_notFullCondition()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(0 < capacity);
+
+    d_cells_p = static_cast<Cell*>(
+        d_allocator_p->allocate(d_capacity * sizeof(Cell)));
+    for (bsls::Types::Int64 i = 0; i < d_capacity; ++i) {
+        new (&d_cells_p[i].d_sequence) bsls::AtomicInt64(i);
+    }
+}
+
+template <class TYPE>
+inline MPSCRingBuffer<TYPE>::~MPSCRingBuffer()
+{
+    removeAll();
+    d_allocator_p->deallocate(d_cells_p);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline int MPSCRingBuffer<TYPE>::tryPushBack(const TYPE& value)
+{
+    int   rc   = rc_SUCCESS;
+    Cell* cell = claimSlot(&rc);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cell)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc;  // RETURN
+    }
+
+    // The slot is exclusively owned by this producer until published.
+    const bsls::Types::Int64 position = cell->d_sequence.loadRelaxed();
+    bslma::ConstructionUtil::construct(cell->d_value.address(),
+                                       d_allocator_p,
+                                       value);
+    publishSlot(cell, position);
+
+    return rc_SUCCESS;
+}
+
+template <class TYPE>
+inline int MPSCRingBuffer<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
+{
+    int   rc   = rc_SUCCESS;
+    Cell* cell = claimSlot(&rc);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cell)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc;  // RETURN
+    }
+
+    // The slot is exclusively owned by this producer until published.
+    const bsls::Types::Int64 position = cell->d_sequence.loadRelaxed();
+    bslma::ConstructionUtil::construct(cell->d_value.address(),
+                                       d_allocator_p,
+                                       bslmf::MovableRefUtil::move(value));
+    publishSlot(cell, position);
+
+    return rc_SUCCESS;
+}
+
+template <class TYPE>
+inline int MPSCRingBuffer<TYPE>::pushBack(const TYPE& value)
+{
+    int rc;
+    while ((rc = tryPushBack(value)) == rc_FULL) {
+        waitUntilNotFull();
+    }
+
+    return rc;
+}
+
+template <class TYPE>
+inline int MPSCRingBuffer<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
+{
+    // 'tryPushBack' does not modify 'value' on failure.
+    TYPE& valueRef = bslmf::MovableRefUtil::access(value);
+
+    int rc;
+    while ((rc = tryPushBack(bslmf::MovableRefUtil::move(valueRef))) ==
+           rc_FULL) {
+        waitUntilNotFull();
+    }
+
+    return rc;
+}
+
+template <class TYPE>
+inline int MPSCRingBuffer<TYPE>::tryPopFront(TYPE* value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(value);
+
+    const bsls::Types::Int64 position = d_popPosition.loadRelaxed();
+    Cell&                    cell     = d_cells_p[position & d_mask];
+    if (cell.d_sequence.loadAcquire() != position + 1) {
+        return rc_EMPTY;  // RETURN
+    }
+
+    *value = bslmf::MovableRefUtil::move(cell.d_value.object());
+    releaseSlot(&cell, position);
+
+    return rc_SUCCESS;
+}
+
+template <class TYPE>
+inline int MPSCRingBuffer<TYPE>::popFront(TYPE* value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(value);
+
+    while (tryPopFront(value) != rc_SUCCESS) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+        // See 'publishSlot'.
+        d_isConsumerWaiting.store(true);
+        while (!isFrontPublished()) {
+            d_notEmptyCondition.wait(&d_mutex);
+        }
+        d_isConsumerWaiting.store(false);
+    }
+
+    return rc_SUCCESS;
+}
+
+template <class TYPE>
+inline void MPSCRingBuffer<TYPE>::removeAll()
+{
+    while (isFrontPublished()) {
+        const bsls::Types::Int64 position = d_popPosition.loadRelaxed();
+        releaseSlot(&d_cells_p[position & d_mask], position);
+    }
+}
+
+template <class TYPE>
+inline void MPSCRingBuffer<TYPE>::disablePushBack()
+{
+    d_isPushBackDisabled.store(true);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+    d_notFullCondition.broadcast();
+}
+
+template <class TYPE>
+inline void MPSCRingBuffer<TYPE>::enablePushBack()
+{
+    d_isPushBackDisabled.store(false);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline int MPSCRingBuffer<TYPE>::capacity() const
+{
+    return static_cast<int>(d_capacity);
+}
+
+template <class TYPE>
+inline bsls::Types::Int64 MPSCRingBuffer<TYPE>::numElements() const
+{
+    const bsls::Types::Int64 popPosition  = d_popPosition.loadAcquire();
+    const bsls::Types::Int64 pushPosition = d_pushPosition.loadAcquire();
+
+    // The positions are loaded separately, so 'popPosition' may be ahead of
+    // 'pushPosition' if values were enqueued and dequeued in between.
+    return pushPosition > popPosition ? pushPosition - popPosition : 0;
+}
+
+template <class TYPE>
+inline bool MPSCRingBuffer<TYPE>::isEmpty() const
+{
+    return !isFrontPublished();
+}
+
+template <class TYPE>
+inline bool MPSCRingBuffer<TYPE>::isPushBackDisabled() const
+{
+    return d_isPushBackDisabled.load();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,414 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqc_mpscringbuffer.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+#include <bslma_testallocator.h>
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Factor used to encode the producer id and the sequence number of an item
+/// in a single integer.
+const int k_PRODUCER_FACTOR = 1000 * 1000;
+
+/// Wait on the specified `startBarrier`, then push the specified
+/// `numItems` items, encoding the specified `producerId` and their
+/// sequence number, onto the specified `queue`.
+static void producerThread(bmqc::MPSCRingBuffer<int>* queue,
+                           bslmt::Barrier*            startBarrier,
+                           int                        producerId,
+                           int                        numItems)
+{
+    startBarrier->wait();
+
+    for (int i = 0; i < numItems; ++i) {
+        BMQTST_ASSERT_EQ(queue->pushBack(producerId * k_PRODUCER_FACTOR + i),
+                         0);
+    }
+}
+
+/// Push an item onto the specified `queue`, and store the result in the
+/// specified `rc`.
+static void blockedPusherThread(bmqc::MPSCRingBuffer<int>* queue,
+                                bsls::AtomicInt*           rc)
+{
+    rc->store(queue->pushBack(1));
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise basic functionality before beginning testing in earnest.
+//   Probe that functionality to discover basic errors.
+//
+// Testing:
+//   Basic functionality.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    bmqc::MPSCRingBuffer<int> queue(4, bmqtst::TestHelperUtil::allocator());
+
+    BMQTST_ASSERT_EQ(queue.capacity(), 4);
+    BMQTST_ASSERT_EQ(queue.numElements(), 0);
+    BMQTST_ASSERT_EQ(queue.isEmpty(), true);
+    BMQTST_ASSERT_EQ(queue.isPushBackDisabled(), false);
+
+    BMQTST_ASSERT_EQ(queue.pushBack(1), 0);
+    BMQTST_ASSERT_EQ(queue.tryPushBack(2), 0);
+    BMQTST_ASSERT_EQ(queue.numElements(), 2);
+    BMQTST_ASSERT_EQ(queue.isEmpty(), false);
+
+    int item = -1;
+    BMQTST_ASSERT_EQ(queue.tryPopFront(&item), 0);
+    BMQTST_ASSERT_EQ(item, 1);
+    BMQTST_ASSERT_EQ(queue.popFront(&item), 0);
+    BMQTST_ASSERT_EQ(item, 2);
+    BMQTST_ASSERT_EQ(queue.numElements(), 0);
+    BMQTST_ASSERT_EQ(queue.isEmpty(), true);
+
+    item = -1;
+    BMQTST_ASSERT_NE(queue.tryPopFront(&item), 0);
+    BMQTST_ASSERT_EQ(item, -1);
+}
+
+static void test2_capacity()
+// ------------------------------------------------------------------------
+// CAPACITY
+//
+// Concerns:
+//   1. The capacity is rounded up to the next power of two.
+//   2. Enqueuing into a full queue fails without blocking with
+//      'tryPushBack'.
+//   3. The queue keeps the FIFO order while wrapping around its slots.
+//
+// Plan:
+//   Fill and drain queues of various capacities several times.
+//
+// Testing:
+//   capacity()
+//   tryPushBack(const TYPE&)
+//   tryPopFront(TYPE*)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("CAPACITY");
+
+    struct Test {
+        int d_line;
+        int d_requestedCapacity;
+        int d_expectedCapacity;
+    } k_DATA[] = {{L_, 1, 2},
+                  {L_, 2, 2},
+                  {L_, 3, 4},
+                  {L_, 10, 16},
+                  {L_, 1024, 1024},
+                  {L_, 1025, 2048}};
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const Test& test = k_DATA[idx];
+
+        PVV(test.d_line << ": requested capacity "
+                        << test.d_requestedCapacity);
+
+        bmqc::MPSCRingBuffer<int> queue(test.d_requestedCapacity,
+                                        bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ_D(test.d_line,
+                           queue.capacity(),
+                           test.d_expectedCapacity);
+
+        int next = 0;
+        for (int round = 0; round < 3; ++round) {
+            for (int i = 0; i < queue.capacity(); ++i) {
+                BMQTST_ASSERT_EQ_D(test.d_line,
+                                   queue.tryPushBack(next + i),
+                                   0);
+            }
+            BMQTST_ASSERT_NE_D(test.d_line, queue.tryPushBack(-1), 0);
+            BMQTST_ASSERT_EQ_D(test.d_line,
+                               queue.numElements(),
+                               queue.capacity());
+
+            for (int i = 0; i < queue.capacity(); ++i) {
+                int item = -1;
+                BMQTST_ASSERT_EQ_D(test.d_line, queue.tryPopFront(&item), 0);
+                BMQTST_ASSERT_EQ_D(test.d_line, item, next + i);
+            }
+            BMQTST_ASSERT_EQ_D(test.d_line, queue.isEmpty(), true);
+
+            next += queue.capacity();
+        }
+    }
+}
+
+static void test3_moveSemantics()
+// ------------------------------------------------------------------------
+// MOVE SEMANTICS
+//
+// Concerns:
+//   1. Values are moved in and out of the queue, without being copied.
+//   2. Enqueuing and dequeuing do not allocate memory.
+//   3. A failed enqueue leaves the value untouched.
+//   4. 'removeAll' and the destructor destroy the values held by the queue.
+//
+// Testing:
+//   pushBack(bslmf::MovableRef<TYPE>)
+//   tryPushBack(bslmf::MovableRef<TYPE>)
+//   removeAll()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("MOVE SEMANTICS");
+
+    typedef bsl::shared_ptr<int> Item;
+
+    bslma::TestAllocator queueAllocator(bmqtst::TestHelperUtil::allocator());
+    Item                 value;
+    bsl::weak_ptr<int>   weakValue;
+    bsls::Types::Int64   numAllocations = 0;
+
+    {
+        bmqc::MPSCRingBuffer<Item> queue(2, &queueAllocator);
+        numAllocations = queueAllocator.numAllocations();
+
+        value = bsl::allocate_shared<int>(bmqtst::TestHelperUtil::allocator(),
+                                          1);
+        weakValue = value;
+
+        // 1. Move in and out
+        BMQTST_ASSERT_EQ(queue.pushBack(bslmf::MovableRefUtil::move(value)),
+                         0);
+        BMQTST_ASSERT(!value);
+        BMQTST_ASSERT_EQ(weakValue.use_count(), 1);
+
+        BMQTST_ASSERT_EQ(queue.popFront(&value), 0);
+        BMQTST_ASSERT_EQ(*value, 1);
+        BMQTST_ASSERT_EQ(weakValue.use_count(), 1);
+
+        // 2. No allocation
+        BMQTST_ASSERT_EQ(queueAllocator.numAllocations(), numAllocations);
+
+        // 3. Failed enqueue
+        Item other = bsl::allocate_shared<int>(
+            bmqtst::TestHelperUtil::allocator(),
+            2);
+        BMQTST_ASSERT_EQ(queue.tryPushBack(other), 0);
+        BMQTST_ASSERT_EQ(queue.tryPushBack(other), 0);
+        BMQTST_ASSERT_NE(
+            queue.tryPushBack(bslmf::MovableRefUtil::move(value)),
+            0);
+        BMQTST_ASSERT(value);
+        BMQTST_ASSERT_EQ(weakValue.use_count(), 1);
+
+        queue.disablePushBack();
+        BMQTST_ASSERT_NE(queue.pushBack(bslmf::MovableRefUtil::move(value)),
+                         0);
+        BMQTST_ASSERT(value);
+        queue.enablePushBack();
+
+        // 4. 'removeAll'
+        BMQTST_ASSERT_EQ(other.use_count(), 3);
+        queue.removeAll();
+        BMQTST_ASSERT_EQ(other.use_count(), 1);
+        BMQTST_ASSERT_EQ(queue.isEmpty(), true);
+
+        BMQTST_ASSERT_EQ(
+            queue.tryPushBack(bslmf::MovableRefUtil::move(value)),
+            0);
+        BMQTST_ASSERT_EQ(weakValue.use_count(), 1);
+    }
+
+    // 4. Destructor
+    BMQTST_ASSERT_EQ(weakValue.use_count(), 0);
+    BMQTST_ASSERT_EQ(queueAllocator.numBlocksInUse(), 0);
+}
+
+static void test4_disablePushBack()
+// ------------------------------------------------------------------------
+// DISABLE PUSH BACK
+//
+// Concerns:
+//   1. 'pushBack' blocks while the queue is full.
+//   2. Disabling enqueuing wakes up the blocked producers, which fail.
+//   3. Dequeuing is still possible while enqueuing is disabled.
+//
+// Testing:
+//   pushBack(const TYPE&)
+//   disablePushBack()
+//   enablePushBack()
+//   isPushBackDisabled()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("DISABLE PUSH BACK");
+
+    bmqc::MPSCRingBuffer<int> queue(2, bmqtst::TestHelperUtil::allocator());
+
+    BMQTST_ASSERT_EQ(queue.pushBack(1), 0);
+    BMQTST_ASSERT_EQ(queue.pushBack(2), 0);
+
+    // 1. Block a producer on the full queue
+    bsls::AtomicInt           rc(-42);
+    bslmt::ThreadUtil::Handle threadHandle;
+    BMQTST_ASSERT_EQ(bslmt::ThreadUtil::createWithAllocator(
+                         &threadHandle,
+                         bdlf::BindUtil::bind(&blockedPusherThread,
+                                              &queue,
+                                              &rc),
+                         bmqtst::TestHelperUtil::allocator()),
+                     0);
+
+    bslmt::ThreadUtil::sleep(bsls::TimeInterval(0.05));
+    BMQTST_ASSERT_EQ(rc.load(), -42);
+
+    // 2. Disable enqueuing
+    queue.disablePushBack();
+    bslmt::ThreadUtil::join(threadHandle);
+
+    BMQTST_ASSERT_NE(rc.load(), 0);
+    BMQTST_ASSERT_EQ(queue.isPushBackDisabled(), true);
+    BMQTST_ASSERT_NE(queue.tryPushBack(3), 0);
+
+    // 3. Dequeuing is still possible
+    int item = -1;
+    BMQTST_ASSERT_EQ(queue.popFront(&item), 0);
+    BMQTST_ASSERT_EQ(item, 1);
+    BMQTST_ASSERT_NE(queue.tryPushBack(3), 0);
+
+    queue.enablePushBack();
+    BMQTST_ASSERT_EQ(queue.isPushBackDisabled(), false);
+    BMQTST_ASSERT_EQ(queue.tryPushBack(3), 0);
+    BMQTST_ASSERT_EQ(queue.numElements(), 2);
+}
+
+static void test5_concurrentProducers()
+// ------------------------------------------------------------------------
+// CONCURRENT PRODUCERS
+//
+// Concerns:
+//   1. All the items enqueued by concurrent producers are dequeued exactly
+//      once by the consumer.
+//   2. The items enqueued by a given producer are dequeued in the order
+//      they were enqueued.
+//   3. Producers and consumer blocking on a full (respectively empty) queue
+//      are woken up.
+//
+// Plan:
+//   Have several producers enqueue items into a small queue, while this
+//   thread dequeues them and checks their order.
+//
+// Testing:
+//   pushBack(const TYPE&)
+//   popFront(TYPE*)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("CONCURRENT PRODUCERS");
+
+    const int k_NUM_PRODUCERS = 4;
+    const int k_NUM_ITEMS     = 100 * 1000;
+
+    bmqc::MPSCRingBuffer<int> queue(16, bmqtst::TestHelperUtil::allocator());
+    bslmt::Barrier            startBarrier(k_NUM_PRODUCERS + 1);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(
+        k_NUM_PRODUCERS,
+        bmqtst::TestHelperUtil::allocator());
+
+    for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+        BMQTST_ASSERT_EQ(bslmt::ThreadUtil::createWithAllocator(
+                             &handles[i],
+                             bdlf::BindUtil::bind(&producerThread,
+                                                  &queue,
+                                                  &startBarrier,
+                                                  i,
+                                                  k_NUM_ITEMS),
+                             bmqtst::TestHelperUtil::allocator()),
+                         0);
+    }
+
+    bsl::vector<int> nextItems(k_NUM_PRODUCERS,
+                               0,
+                               bmqtst::TestHelperUtil::allocator());
+
+    startBarrier.wait();
+    for (int i = 0; i < k_NUM_PRODUCERS * k_NUM_ITEMS; ++i) {
+        int item = -1;
+        BMQTST_ASSERT_EQ(queue.popFront(&item), 0);
+
+        const int producerId = item / k_PRODUCER_FACTOR;
+        BMQTST_ASSERT_GE(producerId, 0);
+        BMQTST_ASSERT_LT(producerId, k_NUM_PRODUCERS);
+        BMQTST_ASSERT_EQ(item % k_PRODUCER_FACTOR, nextItems[producerId]);
+        ++nextItems[producerId];
+    }
+
+    for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+        BMQTST_ASSERT_EQ(nextItems[i], k_NUM_ITEMS);
+    }
+
+    BMQTST_ASSERT_EQ(queue.isEmpty(), true);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 5: test5_concurrentProducers(); break;
+    case 4: test4_disablePushBack(); break;
+    case 3: test3_moveSemantics(); break;
+    case 2: test2_capacity(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -17,10 +17,52 @@
 
 #include <bmqscm_version.h>
 
+// BDE
+#include <bslmt_once.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+
 namespace BloombergLP {
 namespace bmqc {
 
-// NOTHING
+namespace {
+
+/// Value of the thread-specific flag of the threads processing a queue.
+const char s_processingThreadFlag = 1;
+
+/// Return the key of the thread-specific flag of the threads processing a
+/// queue, creating it on first use.
+bslmt::ThreadUtil::Key& processingThreadKey()
+{
+    static bslmt::ThreadUtil::Key s_key;
+
+    BSLMT_ONCE_DO
+    {
+        const int rc = bslmt::ThreadUtil::createKey(&s_key, 0);
+        BSLS_ASSERT_OPT(rc == 0);
+    }
+
+    return s_key;
+}
+
+}  // close unnamed namespace
+
+// --------------------------------------
+// struct MultiQueueThreadPool_ThreadUtil
+// --------------------------------------
+
+void MultiQueueThreadPool_ThreadUtil::setProcessingThread(bool value)
+{
+    const int rc = bslmt::ThreadUtil::setSpecific(
+        processingThreadKey(),
+        value ? &s_processingThreadFlag : 0);
+    BSLS_ASSERT_OPT(rc == 0);
+}
+
+bool MultiQueueThreadPool_ThreadUtil::isProcessingThread()
+{
+    return 0 != bslmt::ThreadUtil::getSpecific(processingThreadKey());
+}
 
 }  // close package namespace
 }  // close enterprise namespace
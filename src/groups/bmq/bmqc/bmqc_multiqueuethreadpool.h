@@ -34,6 +34,18 @@
 // - Creating it with a 'bdlmt::EventScheduler' allows the
 //   'bmqc::MultiQueueThreadPool' to enqueue items on the appropriate queue at
 //   the requested time.
+// - Providing a ring buffer queue creator (see
+//   'MultiQueueThreadPoolConfig::setRingBufferQueueCreator') makes the
+//   'bmqc::MultiQueueThreadPool' use bounded lock-free
+//   'bmqc::MPSCRingBuffer' queues instead of the default unbounded
+//   'bdlcc::SingleConsumerQueue' queues.  Events are then stored inline in
+//   the preallocated slots of the ring buffer, so that enqueuing and
+//   dequeuing do not allocate, but enqueuing blocks when a queue is full.
+//   Note that, to avoid a deadlock, an event enqueued to a full queue from
+//   a thread processing a queue of any 'bmqc::MultiQueueThreadPool' (e.g.,
+//   a processor of a dispatcher enqueuing to another processor) does not
+//   block, but is kept aside in an unbounded list, and processed after the
+//   events already in the queue.
 //
 /// Usage
 ///-----
@@ -151,6 +163,7 @@
 //..
 
 #include <bmqc_monitoredqueue_bdlccsingleconsumerqueue.h>
+#include <bmqc_monitoredqueue_mpscringbuffer.h>
 #include <bmqu_printutil.h>
 
 // BDE
@@ -158,6 +171,7 @@
 #include <bdlf_bind.h>
 #include <bdlmt_eventscheduler.h>
 #include <bdlmt_threadpool.h>
+#include <bsl_deque.h>
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
@@ -167,9 +181,12 @@
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bslmt_latch.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_timedsemaphore.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_keyword.h>
 #include <bsls_performancehint.h>
 #include <bsls_timeinterval.h>
@@ -191,11 +208,19 @@ class MultiQueueThreadPoolConfig {
 
     typedef MonitoredQueue<bdlcc::SingleConsumerQueue<EventSp> > Queue;
 
+    typedef MonitoredQueue<MPSCRingBuffer<EventSp> > RingBufferQueue;
+
     /// Create the queue for the specified `queueId` using the specified
     /// `allocator`.
     typedef bsl::function<Queue*(int queueId, bslma::Allocator* allocator)>
         QueueCreatorFn;
 
+    /// Create the ring buffer queue for the specified `queueId` using the
+    /// specified `allocator`.
+    typedef bsl::function<RingBufferQueue*(int               queueId,
+                                           bslma::Allocator* allocator)>
+        RingBufferQueueCreatorFn;
+
     /// Callback invoked to process the specified `event`.
     typedef bsl::function<void(const EventSp& event)> EventFn;
 
@@ -226,6 +251,10 @@ class MultiQueueThreadPoolConfig {
 
     QueueCreatorFn d_queueCreatorFn;
 
+    /// Optional creator of ring buffer queues, used instead of
+    /// `d_queueCreatorFn` if set.
+    RingBufferQueueCreatorFn d_ringBufferQueueCreatorFn;
+
     bsl::string d_name;
 
     bsl::string d_monitorAlarmString;
@@ -276,6 +305,14 @@ class MultiQueueThreadPoolConfig {
     /// reference offering modifiable access to this object.
     MultiQueueThreadPoolConfig<TYPE>& setName(bslstl::StringRef name);
 
+    /// Use the specified `queueCreator` to create the queues of the MQTP,
+    /// instead of the queue creator specified at construction, and return a
+    /// reference offering modifiable access to this object.  The queues
+    /// created by `queueCreator` are bounded: enqueuing an event into a full
+    /// queue blocks until the queue has space available.
+    MultiQueueThreadPoolConfig<TYPE>&
+    setRingBufferQueueCreator(const RingBufferQueueCreatorFn& queueCreator);
+
     /// Monitor the queues of the MQTP to make sure events can pass through
     /// each queue in at most `timeout` time, and print an error message
     /// with the specified `alarmString` if any of the queues is processing
@@ -291,6 +328,27 @@ class MultiQueueThreadPoolConfig {
     setMonitorWarningTimeout(const bsls::TimeInterval& timeout);
 };
 
+// ======================================
+// struct MultiQueueThreadPool_ThreadUtil
+// ======================================
+
+/// PRIVATE.  Utilities flagging the threads processing a queue of any
+/// `MultiQueueThreadPool`, which must never block enqueuing to a full
+/// queue.  This struct is an implementation detail of
+/// `MultiQueueThreadPool` and should not be used by clients.
+struct MultiQueueThreadPool_ThreadUtil {
+    // CLASS METHODS
+
+    /// Flag the calling thread as processing a queue of a
+    /// `MultiQueueThreadPool` if the specified `value` is true, and clear
+    /// that flag otherwise.
+    static void setProcessingThread(bool value);
+
+    /// Return `true` if the calling thread is processing a queue of a
+    /// `MultiQueueThreadPool`, and `false` otherwise.
+    static bool isProcessingThread();
+};
+
 // ==========================
 // class MultiQueueThreadPool
 // ==========================
@@ -308,6 +366,9 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
     typedef typename Config::Queue           Queue;
     typedef typename Config::QueueCreatorFn  QueueCreatorFn;
     typedef typename Config::EventFn         EventFn;
+    typedef typename Config::RingBufferQueue RingBufferQueue;
+    typedef typename Config::RingBufferQueueCreatorFn
+        RingBufferQueueCreatorFn;
 
   private:
     // PRIVATE TYPES
@@ -324,9 +385,24 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
 
     struct QueueInfo {
         // PUBLIC DATA
-        /// Pointer to the queue
+        /// Pointer to the queue, if created with the queue creator
         Queue* d_queue_p;
 
+        /// Pointer to the queue, if created with the ring buffer queue
+        /// creator
+        RingBufferQueue* d_ringBuffer_p;
+
+        /// Events enqueued to the full ring buffer queue from threads
+        /// processing a queue, which must not block, in order.  Protected
+        /// by `d_overflowMutex`.
+        bsl::deque<EventSp> d_overflow;
+
+        /// Number of events in `d_overflow`, readable without locking
+        /// `d_overflowMutex`.
+        bsls::AtomicInt d_numOverflowEvents;
+
+        bslmt::Mutex d_overflowMutex;
+
         /// Name of the queue
         bsl::string d_name;
 
@@ -363,6 +439,10 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
         // CREATORS
         explicit QueueInfo(bslma::Allocator* basicAllocator = 0)
         : d_queue_p(0)
+        , d_ringBuffer_p(0)
+        , d_overflow(basicAllocator)
+        , d_numOverflowEvents(0)
+        , d_overflowMutex()
         , d_name(basicAllocator)
         , d_eventCallback(bsl::allocator_arg, basicAllocator)
         , d_monitorState(e_MONITOR_PROCESSED)
@@ -374,6 +454,193 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
             // NOTHING
         }
 
+        // MANIPULATORS
+
+        /// Append the specified `event` to the back of the queue, blocking
+        /// if the queue is full, unless called from a thread processing a
+        /// queue.  Return 0 on success, and a non-zero value otherwise.
+        int pushBack(const EventSp& event)
+        {
+            if (!d_ringBuffer_p) {
+                return d_queue_p->pushBack(event);  // RETURN
+            }
+
+            if (MultiQueueThreadPool_ThreadUtil::isProcessingThread()) {
+                return pushBackWithOverflow(event);  // RETURN
+            }
+
+            return d_ringBuffer_p->pushBack(event);
+        }
+
+        /// Append the specified `event` to the back of the queue, blocking
+        /// if the queue is full, unless called from a thread processing a
+        /// queue.  Return 0 on success, and a non-zero value otherwise.
+        int pushBack(bslmf::MovableRef<EventSp> event)
+        {
+            if (!d_ringBuffer_p) {
+                return d_queue_p->pushBack(
+                    bslmf::MovableRefUtil::move(event));  // RETURN
+            }
+
+            if (MultiQueueThreadPool_ThreadUtil::isProcessingThread()) {
+                return pushBackWithOverflow(
+                    bslmf::MovableRefUtil::access(event));  // RETURN
+            }
+
+            return d_ringBuffer_p->pushBack(
+                bslmf::MovableRefUtil::move(event));
+        }
+
+        /// Append the specified `event` to the back of the ring buffer
+        /// queue, or to the overflow events if the queue is full or the
+        /// overflow events are not empty, so that this never blocks.
+        /// Return 0 on success, and a non-zero value if enqueuing is
+        /// disabled.
+        int pushBackWithOverflow(const EventSp& event)
+        {
+            if (0 == d_numOverflowEvents &&
+                0 == d_ringBuffer_p->tryPushBack(event)) {
+                return 0;  // RETURN
+            }
+
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_overflowMutex);  // LOCK
+
+            // Check again under the lock, as the overflow events may have
+            // been processed in the meantime.  Note that the processing
+            // thread only blocks on the ring buffer queue once it has found
+            // it empty and then the overflow events empty, hence an event is
+            // only kept aside if the ring buffer queue is full or another
+            // event already is.
+            if (d_overflow.empty() &&
+                0 == d_ringBuffer_p->tryPushBack(event)) {
+                return 0;  // RETURN
+            }
+
+            if (d_ringBuffer_p->isPushBackDisabled()) {
+                return -1;  // RETURN
+            }
+
+            d_overflow.push_back(event);
+            ++d_numOverflowEvents;
+            return 0;
+        }
+
+        /// Move as many overflow events as possible to the ring buffer
+        /// queue, in order.  The behavior is undefined unless called from
+        /// the thread processing the queue.
+        void flushOverflow()
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_overflowMutex);  // LOCK
+
+            while (!d_overflow.empty() &&
+                   d_ringBuffer_p->tryPushBack(d_overflow.front()) == 0) {
+                d_overflow.pop_front();
+                --d_numOverflowEvents;
+            }
+        }
+
+        /// Remove the oldest overflow event, if any, and load it into the
+        /// specified `event`.  Return 0 on success, and a non-zero value if
+        /// there is no overflow event.  Note that this allows processing the
+        /// overflow events even once enqueuing to the ring buffer queue is
+        /// disabled.  The behavior is undefined unless called from the
+        /// thread processing the queue.
+        int tryPopOverflow(EventSp* event)
+        {
+            if (0 == d_numOverflowEvents) {
+                return -1;  // RETURN
+            }
+
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_overflowMutex);  // LOCK
+
+            if (d_overflow.empty()) {
+                return -1;  // RETURN
+            }
+
+            *event = bslmf::MovableRefUtil::move(d_overflow.front());
+            d_overflow.pop_front();
+            --d_numOverflowEvents;
+            return 0;
+        }
+
+        /// Attempt to append the specified `event` to the back of the queue
+        /// without blocking.  Return 0 on success, and a non-zero value
+        /// otherwise.
+        int tryPushBack(const EventSp& event)
+        {
+            return d_ringBuffer_p ? d_ringBuffer_p->tryPushBack(event)
+                                  : d_queue_p->tryPushBack(event);
+        }
+
+        /// Attempt to remove the event at the front of the queue without
+        /// blocking, and load it into the specified `event`.  Return 0 on
+        /// success, and a non-zero value if the queue is empty.
+        int tryPopFront(EventSp* event)
+        {
+            return d_ringBuffer_p ? d_ringBuffer_p->tryPopFront(event)
+                                  : d_queue_p->tryPopFront(event);
+        }
+
+        /// Disable enqueuing into the queue.
+        void disablePushBack()
+        {
+            if (d_ringBuffer_p) {
+                d_ringBuffer_p->disablePushBack();
+            }
+            else {
+                d_queue_p->disablePushBack();
+            }
+        }
+
+        /// Destroy the queue, using the specified `allocator`, which must be
+        /// the one used to create it.
+        void deleteQueue(bslma::Allocator* allocator)
+        {
+            if (d_ringBuffer_p) {
+                allocator->deleteObject(d_ringBuffer_p);
+                d_ringBuffer_p = 0;
+            }
+            else {
+                allocator->deleteObject(d_queue_p);
+                d_queue_p = 0;
+            }
+        }
+
+        // ACCESSORS
+
+        /// Return the number of events in the queue, including the
+        /// overflow events.
+        bsls::Types::Int64 numElements() const
+        {
+            return d_ringBuffer_p
+                       ? d_ringBuffer_p->numElements() + d_numOverflowEvents
+                       : d_queue_p->numElements();
+        }
+
+        /// Return `true` if the queue, including the overflow events, is
+        /// empty, and `false` otherwise.
+        bool isEmpty() const
+        {
+            return d_ringBuffer_p
+                       ? d_ringBuffer_p->isEmpty() && 0 == d_numOverflowEvents
+                       : d_queue_p->isEmpty();
+        }
+
+        /// Return `true` if enqueuing into the queue is disabled, and
+        /// `false` otherwise.
+        bool isPushBackDisabled() const
+        {
+            return d_ringBuffer_p ? d_ringBuffer_p->isPushBackDisabled()
+                                  : d_queue_p->isPushBackDisabled();
+        }
+
+        /// Return the address of the queue.
+        const void* queueAddress() const
+        {
+            return d_ringBuffer_p ? static_cast<const void*>(d_ringBuffer_p)
+                                  : static_cast<const void*>(d_queue_p);
+        }
+
       private:
         // NOT IMPLEMENTED
         QueueInfo(const QueueInfo&) BSLS_KEYWORD_DELETED;
@@ -403,10 +670,14 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
         void operator()()
         {
             d_queueInfo_sp->d_threadId = bslmt::ThreadUtil::selfId();
+            MultiQueueThreadPool_ThreadUtil::setProcessingThread(true);
             d_ready_p->arrive();
             d_ready_p = 0;
 
             d_pool_p->processQueue(*d_queueInfo_sp);
+
+            // The thread of the pool may be reused for other jobs.
+            MultiQueueThreadPool_ThreadUtil::setProcessingThread(false);
         }
     };
 
@@ -451,6 +722,13 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
     /// until a `0` event is popped off.
     void processQueue(QueueInfo& info);
 
+    /// Pop and process events from the specified `queue` of the specified
+    /// `info` until a `0` event is popped off.  Note that this is templated
+    /// on the type of the queue so that the processing loop does not have to
+    /// dispatch on it for each event.
+    template <class QUEUE>
+    void processQueueImpl(QueueInfo& info, QUEUE* queue);
+
   private:
     // NOT IMPLEMENTED
     MultiQueueThreadPool(const MultiQueueThreadPool&) BSLS_KEYWORD_DELETED;
@@ -487,13 +765,25 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
     /// @param event Event to enqueue.
     /// @param queueId Queue id of the destination queue for the event.
     /// @return 0 on success, non-zero on failure.
-    /// NOTE: if the requested queue is full, this will block.
+    /// NOTE: if the requested queue is full, this will block, unless
+    ///       called from a thread processing a queue of any MQTP.
     int enqueueEvent(bslmf::MovableRef<EventSp> event, int queueId);
 
+    /// @brief Enqueue an event to the specified queue, without blocking.
+    /// @param event Event to enqueue.
+    /// @param queueId Queue id of the destination queue for the event.
+    /// @return 0 on success, a positive value if the queue is full, and a
+    ///         negative value if enqueuing into the queue is disabled.
+    /// NOTE: an event enqueued from a thread processing a queue of any MQTP
+    ///       is never rejected because the queue is full (see
+    ///       `enqueueEvent`).
+    int tryEnqueueEvent(const EventSp& event, int queueId);
+
     /// @brief Enqueue an event to all queues.
     /// @param event Event to enqueue.
     /// @return 0 on success, non-zero on failure.
-    /// NOTE: if the requested queue is full, this will block.
+    /// NOTE: if the requested queue is full, this will block, unless
+    ///       called from a thread processing a queue of any MQTP.
     int enqueueEventOnAllQueues(bslmf::MovableRef<EventSp> event);
 
     /// Block until all queues are empty.  Note that calling this only makes
@@ -546,6 +836,7 @@ inline MultiQueueThreadPoolConfig<TYPE>::MultiQueueThreadPoolConfig(
                            basicAllocator,
                            eventCallbackCreator)
 , d_queueCreatorFn(bsl::allocator_arg, basicAllocator, queueCreator)
+, d_ringBufferQueueCreatorFn(bsl::allocator_arg, basicAllocator)
 , d_name(basicAllocator)
 , d_monitorAlarmString(basicAllocator)
 , d_monitorAlarmTimeout()
@@ -567,6 +858,9 @@ inline MultiQueueThreadPoolConfig<TYPE>::MultiQueueThreadPoolConfig(
                            basicAllocator,
                            other.d_eventCallbackCreatorFn)
 , d_queueCreatorFn(bsl::allocator_arg, basicAllocator, other.d_queueCreatorFn)
+, d_ringBufferQueueCreatorFn(bsl::allocator_arg,
+                             basicAllocator,
+                             other.d_ringBufferQueueCreatorFn)
 , d_name(other.d_name, basicAllocator)
 , d_monitorAlarmString(other.d_monitorAlarmString, basicAllocator)
 , d_monitorAlarmTimeout(other.d_monitorAlarmTimeout)
@@ -592,6 +886,15 @@ MultiQueueThreadPoolConfig<TYPE>::setName(bslstl::StringRef name)
     return *this;
 }
 
+template <typename TYPE>
+inline MultiQueueThreadPoolConfig<TYPE>&
+MultiQueueThreadPoolConfig<TYPE>::setRingBufferQueueCreator(
+    const RingBufferQueueCreatorFn& queueCreator)
+{
+    d_ringBufferQueueCreatorFn = queueCreator;
+    return *this;
+}
+
 template <typename TYPE>
 inline MultiQueueThreadPoolConfig<TYPE>&
 MultiQueueThreadPoolConfig<TYPE>::setMonitorAlarm(
@@ -648,8 +951,7 @@ inline void MultiQueueThreadPool<TYPE>::processMonitorEvents()
                     << queue.d_name << "' hasn't processed an event enqueued "
                     << bmqu::PrintUtil::prettyTimeInterval(
                            d_config.d_monitorAlarmTimeout.totalNanoseconds())
-                    << " ago. Current queue size: "
-                    << queue.d_queue_p->numElements();
+                    << " ago. Current queue size: " << queue.numElements();
             }
 
             queue.d_monitorState.testAndSwap(e_MONITOR_PENDING,
@@ -659,8 +961,7 @@ inline void MultiQueueThreadPool<TYPE>::processMonitorEvents()
             // Enqueue next monitor event
 
             queue.d_processQueueRefCount.addRelaxed(1);
-            const int ret = queue.d_queue_p->tryPushBack(
-                NULL /* monitor event */);
+            const int ret = queue.tryPushBack(NULL /* monitor event */);
             if (ret != 0) {
                 BALL_LOG_ERROR << d_config.d_monitorAlarmString
                                << " Couldn't enqueue monitor event on queue '"
@@ -699,7 +1000,7 @@ inline void MultiQueueThreadPool<TYPE>::checkStuckEvents()
                     << "' started processing an event "
                     << bmqu::PrintUtil::prettyTimeInterval(processingTime)
                     << " ago and still has not finished. Current queue size: "
-                    << queue.d_queue_p->numElements();
+                    << queue.numElements();
             }
         }
     }
@@ -707,14 +1008,33 @@ inline void MultiQueueThreadPool<TYPE>::checkStuckEvents()
 
 template <typename TYPE>
 inline void MultiQueueThreadPool<TYPE>::processQueue(QueueInfo& info)
+{
+    if (info.d_ringBuffer_p) {
+        processQueueImpl(info, info.d_ringBuffer_p);
+    }
+    else {
+        processQueueImpl(info, info.d_queue_p);
+    }
+}
+
+template <typename TYPE>
+template <class QUEUE>
+inline void MultiQueueThreadPool<TYPE>::processQueueImpl(QueueInfo& info,
+                                                         QUEUE*     queue)
 {
     while (true) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 !=
+                                                  info.d_numOverflowEvents)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            info.flushOverflow();
+        }
+
         EventSp   event;
-        const int popRet = info.d_queue_p->tryPopFront(&event);
-        if (popRet != 0) {
+        const int popRet = queue->tryPopFront(&event);
+        if (popRet != 0 && info.tryPopOverflow(&event) != 0) {
             // Queue is empty
             info.d_eventCallback(d_queueEmptyEvent_sp);
-            info.d_queue_p->popFront(&event);
+            queue->popFront(&event);
         }
 
         if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == event)) {
@@ -811,9 +1131,16 @@ inline int MultiQueueThreadPool<TYPE>::start()
         name += "Queue ";
         name += bsl::to_string(i);
 
-        queue.d_name          = name;
-        queue.d_queue_p       = d_config.d_queueCreatorFn(static_cast<int>(i),
-                                                    d_allocator_p);
+        queue.d_name = name;
+        if (d_config.d_ringBufferQueueCreatorFn) {
+            queue.d_ringBuffer_p = d_config.d_ringBufferQueueCreatorFn(
+                static_cast<int>(i),
+                d_allocator_p);
+        }
+        else {
+            queue.d_queue_p = d_config.d_queueCreatorFn(static_cast<int>(i),
+                                                        d_allocator_p);
+        }
         queue.d_eventCallback = d_config.d_eventCallbackCreatorFn(
             static_cast<int>(i),
             &queue.d_lastProcessingStartTime);
@@ -879,10 +1206,10 @@ inline void MultiQueueThreadPool<TYPE>::stop()
         // These two updates balance each other (+1 -1 = 0), so we can keep
         // the current value of `info.d_processQueueRefCount` unchanged.
 
-        info.d_queue_p->pushBack(NULL /* monitor event */);
+        info.pushBack(NULL /* monitor event */);
         // It is possible that something is enqueued to the queue between the
         // last monitor event and `disablePushBack()` call, this is expected.
-        info.d_queue_p->disablePushBack();
+        info.disablePushBack();
     }
 
     // Wait for all queues to finish, then drain and delete.
@@ -897,17 +1224,20 @@ inline void MultiQueueThreadPool<TYPE>::stop()
             BALL_LOG_ERROR << "#MQTP_STOP_FAILURE MQTP failed to stop in "
                            << k_MAX_WAIT_SECONDS_AT_SHUTDOWN
                            << " seconds while shutting down the queue (" << i
-                           << ", " << info.d_name << ", " << info.d_queue_p
+                           << ", " << info.d_name << ", "
+                           << info.queueAddress()
                            << "), rc:  " << rc;
             BSLS_ASSERT_OPT(false && "#EXIT Failed to stop MQTP, exiting...");
         }
 
         EventSp event;
-        while (!info.d_queue_p->tryPopFront(&event)) {
+        while (!info.tryPopFront(&event)) {
             event.reset();
         }
+        info.d_overflow.clear();
+        info.d_numOverflowEvents = 0;
 
-        d_allocator_p->deleteObject(info.d_queue_p);
+        info.deleteQueue(d_allocator_p);
     }
 
     d_queues.clear();
@@ -924,8 +1254,30 @@ MultiQueueThreadPool<TYPE>::enqueueEvent(bslmf::MovableRef<EventSp> event,
     BSLS_ASSERT_SAFE(isStarted() && "MQTP has not been started");
 
     // [try to] Push back item
-    return d_queues[queueId]->d_queue_p->pushBack(
-        bslmf::MovableRefUtil::move(event));
+    return d_queues[queueId]->pushBack(bslmf::MovableRefUtil::move(event));
+}
+
+template <typename TYPE>
+inline int MultiQueueThreadPool<TYPE>::tryEnqueueEvent(const EventSp& event,
+                                                       int            queueId)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(event);
+    BSLS_ASSERT(0 <= queueId && queueId < numQueues());
+    BSLS_ASSERT_SAFE(isStarted() && "MQTP has not been started");
+
+    QueueInfo& info = *d_queues[queueId];
+
+    if (info.d_ringBuffer_p &&
+        MultiQueueThreadPool_ThreadUtil::isProcessingThread()) {
+        return info.pushBackWithOverflow(event);  // RETURN
+    }
+
+    if (info.tryPushBack(event) == 0) {
+        return 0;  // RETURN
+    }
+
+    return info.isPushBackDisabled() ? -1 : 1;
 }
 
 template <typename TYPE>
@@ -942,7 +1294,7 @@ inline int MultiQueueThreadPool<TYPE>::enqueueEventOnAllQueues(
     int lastError = 0;
     for (size_t queueIdx = 0; queueIdx < d_queues.size(); ++queueIdx) {
         // [try to] Push back item
-        const int pushRet = d_queues[queueIdx]->d_queue_p->pushBack(eventObj);
+        const int pushRet = d_queues[queueIdx]->pushBack(eventObj);
 
         if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != pushRet)) {
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
@@ -960,7 +1312,7 @@ inline void MultiQueueThreadPool<TYPE>::waitUntilEmpty()
     while (!fullPass) {
         fullPass = true;
         for (size_t i = 0; i < d_queues.size(); ++i) {
-            while (!d_queues[i]->d_queue_p->isEmpty()) {
+            while (!d_queues[i]->isEmpty()) {
                 bslmt::ThreadUtil::yield();
                 fullPass = false;
             }
@@ -999,9 +1351,9 @@ MultiQueueThreadPool<TYPE>::numElements(int queueId) const
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(0 <= queueId);
     BSLS_ASSERT_SAFE(queueId < numQueues());
-    BSLS_ASSERT_SAFE(d_queues[queueId]->d_queue_p);
+    BSLS_ASSERT_SAFE(d_queues[queueId]->queueAddress());
 
-    return d_queues[queueId]->d_queue_p->numElements();
+    return d_queues[queueId]->numElements();
 }
 
 template <typename TYPE>
@@ -1011,7 +1363,7 @@ MultiQueueThreadPool<TYPE>::queueName(int queueId) const
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(0 <= queueId);
     BSLS_ASSERT_SAFE(queueId < numQueues());
-    BSLS_ASSERT_SAFE(d_queues[queueId]->d_queue_p);
+    BSLS_ASSERT_SAFE(d_queues[queueId]->queueAddress());
 
     return d_queues[queueId]->d_name;
 }
@@ -29,18 +29,23 @@
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bsl_map.h>
+#include <bsl_string.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
 #include <bsla_annotations.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
+#include <bslmt_latch.h>
+#include <bslmt_semaphore.h>
 #include <bslmt_threadattributes.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
 #include <bsls_timeinterval.h>
 #include <bsls_timeutil.h>
+#include <bsls_types.h>
 
 // TEST DRIVER
+#include <bmqtst_table.h>
 #include <bmqtst_testhelper.h>
 
 // BENCHMARKING LIBRARY
@@ -90,6 +95,20 @@ queueCreator(int                               queueId,
     return new (*allocator) MQTP::Queue(fixedQueueSize, allocator);
 }
 
+static MQTP::RingBufferQueue*
+ringBufferQueueCreator(int                               queueId,
+                       bslma::Allocator*                 allocator,
+                       int                               queueSize,
+                       bsl::map<int, bsl::vector<int> >* queueContextMap)
+{
+    PV("Creating ring buffer queue [queueId: " << queueId << "]\n");
+
+    queueContextMap->insert(
+        bsl::make_pair(queueId, bsl::vector<int>(allocator)));
+
+    return new (*allocator) MQTP::RingBufferQueue(queueSize, allocator);
+}
+
 static void eventCb(bsl::map<int, bsl::vector<int> >* queueContextMap,
                     int                               queueId,
                     const MQTP::EventSp&              event)
@@ -117,6 +136,174 @@ eventCbCreator(bsl::map<int, bsl::vector<int> >* queueContextMap,
                                  bdlf::PlaceHolders::_1);
 }
 
+/// Context of the event callback of `test3_ringBufferSelfEnqueue`.
+struct SelfEnqueueContext {
+    /// MQTP the events are enqueued to
+    MQTP* d_mqtp_p;
+
+    /// Number of events to enqueue when processing the initial event
+    int d_numEvents;
+
+    /// Values of the processed events, in order
+    bsl::vector<int> d_values;
+
+    /// Latch arrived at for each processed event
+    bslmt::Latch* d_latch_p;
+};
+
+/// Record the value of the specified `event` in the specified `context`,
+/// and, if it is the initial event (having the value 0), enqueue
+/// `context->d_numEvents` events to the queue 0 from this thread.
+static void selfEnqueueEventCb(SelfEnqueueContext*  context,
+                               const MQTP::EventSp& event)
+{
+    if (!event) {
+        return;  // RETURN
+    }
+
+    context->d_values.push_back(event->value());
+
+    if (event->value() == 0) {
+        for (int i = 1; i <= context->d_numEvents; ++i) {
+            MQTP::EventSp newEvent;
+            newEvent.createInplace(bmqtst::TestHelperUtil::allocator());
+            newEvent->value() = i;
+            BMQTST_ASSERT_EQ(
+                context->d_mqtp_p->enqueueEvent(
+                    bslmf::MovableRefUtil::move(newEvent),
+                    0),
+                0);
+        }
+    }
+
+    context->d_latch_p->arrive();
+}
+
+static MQTP::EventFn selfEnqueueEventCbCreator(
+    SelfEnqueueContext*                  context,
+    BSLA_MAYBE_UNUSED int                queueId,
+    BSLA_MAYBE_UNUSED bsls::AtomicInt64* lastProcessingStartTime,
+    bslma::Allocator*                    allocator)
+{
+    return bdlf::BindUtil::bindS(allocator,
+                                 &selfEnqueueEventCb,
+                                 context,
+                                 bdlf::PlaceHolders::_1);
+}
+
+/// Context of the event callback of `test4_ringBufferTryEnqueue`.
+struct BlockingContext {
+    /// Values of the processed events, in order
+    bsl::vector<int> d_values;
+
+    /// Latch arrived at when the initial event is being processed
+    bslmt::Latch* d_started_p;
+
+    /// Semaphore waited on when processing the initial event
+    bslmt::Semaphore* d_release_p;
+};
+
+/// Record the value of the specified `event` in the specified `context`,
+/// and, if it is the initial event (having the value 0), block until
+/// `context->d_release_p` is posted.
+static void blockingEventCb(BlockingContext*     context,
+                            const MQTP::EventSp& event)
+{
+    if (!event) {
+        return;  // RETURN
+    }
+
+    context->d_values.push_back(event->value());
+
+    if (event->value() == 0) {
+        context->d_started_p->arrive();
+        context->d_release_p->wait();
+    }
+}
+
+static MQTP::EventFn blockingEventCbCreator(
+    BlockingContext*                     context,
+    BSLA_MAYBE_UNUSED int                queueId,
+    BSLA_MAYBE_UNUSED bsls::AtomicInt64* lastProcessingStartTime,
+    bslma::Allocator*                    allocator)
+{
+    return bdlf::BindUtil::bindS(allocator,
+                                 &blockingEventCb,
+                                 context,
+                                 bdlf::PlaceHolders::_1);
+}
+
+/// Context of the event callbacks of `test5_ringBufferCrossEnqueue`.
+struct CrossEnqueueContext {
+    /// MQTP the events are enqueued to
+    MQTP* d_mqtp_p;
+
+    /// Number of events to enqueue to the queue 1 when the queue 0 processes
+    /// an event
+    int d_numEvents;
+
+    /// Values of the events processed by the queue 1, in order
+    bsl::vector<int> d_values;
+
+    /// Latch arrived at once the queue 0 enqueued all the events
+    bslmt::Latch* d_enqueued_p;
+
+    /// Latch arrived at when the queue 1 is processing its initial event
+    bslmt::Latch* d_started_p;
+
+    /// Semaphore waited on by the queue 1 when processing its initial event
+    bslmt::Semaphore* d_release_p;
+};
+
+/// If the specified `queueId` is 0, enqueue `context->d_numEvents` events to
+/// the queue 1 from this thread.  Otherwise, record the value of the
+/// specified `event` in the specified `context` and, if it is the initial
+/// event (having the value 0), block until `context->d_release_p` is posted.
+static void crossEnqueueEventCb(CrossEnqueueContext* context,
+                                int                  queueId,
+                                const MQTP::EventSp& event)
+{
+    if (!event) {
+        return;  // RETURN
+    }
+
+    if (queueId == 0) {
+        for (int i = 1; i <= context->d_numEvents; ++i) {
+            MQTP::EventSp newEvent;
+            newEvent.createInplace(bmqtst::TestHelperUtil::allocator());
+            newEvent->value() = i;
+            BMQTST_ASSERT_EQ(
+                context->d_mqtp_p->enqueueEvent(
+                    bslmf::MovableRefUtil::move(newEvent),
+                    1),
+                0);
+        }
+
+        context->d_enqueued_p->arrive();
+        return;  // RETURN
+    }
+
+    context->d_values.push_back(event->value());
+
+    if (event->value() == 0) {
+        context->d_started_p->arrive();
+        context->d_release_p->wait();
+    }
+}
+
+static MQTP::EventFn crossEnqueueEventCbCreator(
+    CrossEnqueueContext*                 context,
+    int                                  queueId,
+    BSLA_MAYBE_UNUSED bsls::AtomicInt64* lastProcessingStartTime,
+    bslma::Allocator*                    allocator)
+{
+    return bdlf::BindUtil::bindS(allocator,
+                                 &crossEnqueueEventCb,
+                                 context,
+                                 queueId,
+                                 bdlf::PlaceHolders::_1);
+}
+
 static MQTP::Queue* performanceTestQueueCreator(BSLA_MAYBE_UNUSED int queueId,
                                                 bslma::Allocator* allocator,
                                                 int fixedQueueSize)
@@ -124,6 +311,14 @@ static MQTP::Queue* performanceTestQueueCreator(BSLA_MAYBE_UNUSED int queueId,
     return new (*allocator) MQTP::Queue(fixedQueueSize, allocator);
 }
 
+static MQTP::RingBufferQueue*
+performanceTestRingBufferQueueCreator(BSLA_MAYBE_UNUSED int queueId,
+                                      bslma::Allocator*     allocator,
+                                      int                   queueSize)
+{
+    return new (*allocator) MQTP::RingBufferQueue(queueSize, allocator);
+}
+
 void performanceTestEventCb(BSLA_MAYBE_UNUSED const MQTP::EventSp&)
 {
     // NOTHING
@@ -159,6 +354,91 @@ static void performanceTestFixedQueuePopper(
     }
 }
 
+/// Enqueue the specified `numItems` events to the queue 0 of the specified
+/// `mqtp`, then arrive at the specified `doneLatch`.  The events share the
+/// same underlying object, so that the measurement is not dominated by their
+/// allocation.
+static void performanceTestProducer(MQTP*         mqtp,
+                                    int           numItems,
+                                    bslmt::Latch* doneLatch)
+{
+    MQTP::EventSp event;
+    event.createInplace(bmqtst::TestHelperUtil::allocator());
+
+    for (int i = 0; i < numItems; ++i) {
+        MQTP::EventSp copy(event);
+        mqtp->enqueueEvent(bslmf::MovableRefUtil::move(copy), 0);
+    }
+
+    doneLatch->arrive();
+}
+
+/// Create a MQTP with a single queue of the specified `queueSize`, using
+/// ring buffer queues if the specified `useRingBuffer` is `true`, and
+/// enqueue the specified `numItems` events to it from the specified
+/// `numProducers` threads.  Return the time, in nanoseconds, it took for
+/// all the events to be processed.
+static bsls::Types::Int64 runBackendPerformanceTest(bool useRingBuffer,
+                                                    int  queueSize,
+                                                    int  numItems,
+                                                    int  numProducers)
+{
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        numProducers + 1,                 // minThreads
+        numProducers + 1,                 // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        allocator);
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    MQTP::Config config(
+        1,
+        &threadPool,
+        bdlf::BindUtil::bindS(allocator,
+                              &performanceTestEventCbCreator,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // lastProcessingStart
+                              allocator),
+        bdlf::BindUtil::bindS(allocator,
+                              &performanceTestQueueCreator,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // allocator
+                              queueSize),
+        allocator);
+    if (useRingBuffer) {
+        config.setRingBufferQueueCreator(
+            bdlf::BindUtil::bindS(allocator,
+                                  &performanceTestRingBufferQueueCreator,
+                                  bdlf::PlaceHolders::_1,  // queueId
+                                  bdlf::PlaceHolders::_2,  // allocator
+                                  queueSize));
+    }
+
+    MQTP mqtp(config, allocator);
+    BSLS_ASSERT_OPT(mqtp.start() == 0);
+
+    bslmt::Latch             doneLatch(numProducers);
+    const bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numProducers; ++i) {
+        threadPool.enqueueJob(
+            bdlf::BindUtil::bindS(allocator,
+                                  &performanceTestProducer,
+                                  &mqtp,
+                                  numItems / numProducers,
+                                  &doneLatch));
+    }
+    doneLatch.wait();
+    mqtp.waitUntilEmpty();
+    const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() - startTime;
+
+    mqtp.stop();
+    threadPool.stop();
+
+    return elapsed;
+}
+
 static void printProcessedItems(int numItems, bsls::Types::Int64 elapsedTime)
 {
     const double numSeconds = static_cast<double>(elapsedTime) / 1000000000LL;
@@ -282,6 +562,421 @@ static void test1_breathingTest()
     threadPool.stop();
 }
 
+static void test2_ringBufferBreathingTest()
+// ------------------------------------------------------------------------
+// RING BUFFER BREATHING TEST
+//
+// Concerns:
+//   1. The MQTP uses the ring buffer queues when a ring buffer queue
+//      creator is provided.
+//   2. Enqueuing more events than the capacity of a ring buffer queue
+//      blocks until the queue has space available, and all the events are
+//      processed in order.
+//
+// Testing:
+//   MultiQueueThreadPoolConfig::setRingBufferQueueCreator
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // See 'test1_breathingTest'.
+
+    bmqtst::TestHelper::printTestName("RING BUFFER BREATHING TEST");
+
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    // CONSTANTS
+    const int k_NUM_QUEUES = 2;
+    const int k_QUEUE_SIZE = 4;
+    const int k_NUM_EVENTS = 100;
+
+    bsl::map<int, bsl::vector<int> > queueContextMap(allocator);
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        k_NUM_QUEUES,                     // minThreads
+        k_NUM_QUEUES,                     // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        allocator);
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    MQTP::Config config(
+        k_NUM_QUEUES,
+        &threadPool,
+        bdlf::BindUtil::bindS(
+            allocator,
+            &eventCbCreator,
+            &queueContextMap,
+            bdlf::PlaceHolders::_1,  // queueId
+            bdlf::PlaceHolders::_2,  // lastProcessingStartTime
+            allocator),
+        bdlf::BindUtil::bindS(allocator,
+                              &queueCreator,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // allocator
+                              k_QUEUE_SIZE,
+                              &queueContextMap),
+        allocator);
+    config.setRingBufferQueueCreator(
+        bdlf::BindUtil::bindS(allocator,
+                              &ringBufferQueueCreator,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // allocator
+                              k_QUEUE_SIZE,
+                              &queueContextMap));
+
+    MQTP mqtp(config, allocator);
+    BMQTST_ASSERT_EQ(mqtp.start(), 0);
+    BMQTST_ASSERT_EQ(mqtp.numQueues(), k_NUM_QUEUES);
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        MQTP::EventSp event;
+        event.createInplace(allocator);
+        event->value() = i;
+        BMQTST_ASSERT_EQ(
+            mqtp.enqueueEvent(bslmf::MovableRefUtil::move(event), 0),
+            0);
+        BMQTST_ASSERT_LE(mqtp.numElements(0), k_QUEUE_SIZE);
+    }
+    {
+        MQTP::EventSp event;
+        event.createInplace(allocator);
+        event->value() = k_NUM_EVENTS;
+        BMQTST_ASSERT_EQ(
+            mqtp.enqueueEventOnAllQueues(bslmf::MovableRefUtil::move(event)),
+            0);
+    }
+
+    mqtp.waitUntilEmpty();
+    mqtp.stop();
+    BMQTST_ASSERT_EQ(mqtp.isStarted(), false);
+
+    BMQTST_ASSERT_EQ(queueContextMap[0].size(), k_NUM_EVENTS + 1U);
+    for (int i = 0; i <= k_NUM_EVENTS; ++i) {
+        BMQTST_ASSERT_EQ_D(i, queueContextMap[0][i], i);
+    }
+
+    BMQTST_ASSERT_EQ(queueContextMap[1].size(), 1U);
+    BMQTST_ASSERT_EQ(queueContextMap[1][0], k_NUM_EVENTS);
+
+    threadPool.stop();
+}
+
+static void test3_ringBufferSelfEnqueue()
+// ------------------------------------------------------------------------
+// RING BUFFER SELF ENQUEUE
+//
+// Concerns:
+//   Enqueuing more events than the capacity of a ring buffer queue from
+//   the thread processing that queue does not block (which would be a
+//   deadlock), and all the events are processed in order.
+//
+// Testing:
+//   enqueueEvent from the processing thread with ring buffer queues
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // See 'test1_breathingTest'.
+
+    bmqtst::TestHelper::printTestName("RING BUFFER SELF ENQUEUE");
+
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    // CONSTANTS
+    const int k_QUEUE_SIZE = 4;
+    const int k_NUM_EVENTS = 50;
+
+    bsl::map<int, bsl::vector<int> > queueContextMap(allocator);
+    bslmt::Latch                     latch(k_NUM_EVENTS + 1);
+    SelfEnqueueContext               context = {
+        0,
+        k_NUM_EVENTS,
+        bsl::vector<int>(allocator),
+        &latch};
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        1,                                // minThreads
+        1,                                // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        allocator);
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    MQTP::Config config(
+        1,
+        &threadPool,
+        bdlf::BindUtil::bindS(allocator,
+                              &selfEnqueueEventCbCreator,
+                              &context,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // lastProcessingStart
+                              allocator),
+        bdlf::BindUtil::bindS(allocator,
+                              &queueCreator,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // allocator
+                              k_QUEUE_SIZE,
+                              &queueContextMap),
+        allocator);
+    config.setRingBufferQueueCreator(
+        bdlf::BindUtil::bindS(allocator,
+                              &ringBufferQueueCreator,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // allocator
+                              k_QUEUE_SIZE,
+                              &queueContextMap));
+
+    MQTP mqtp(config, allocator);
+    context.d_mqtp_p = &mqtp;
+    BMQTST_ASSERT_EQ(mqtp.start(), 0);
+
+    {
+        MQTP::EventSp event;
+        event.createInplace(allocator);
+        event->value() = 0;
+        BMQTST_ASSERT_EQ(
+            mqtp.enqueueEvent(bslmf::MovableRefUtil::move(event), 0),
+            0);
+    }
+
+    latch.wait();
+    mqtp.stop();
+
+    BMQTST_ASSERT_EQ(context.d_values.size(), k_NUM_EVENTS + 1U);
+    for (int i = 0; i <= k_NUM_EVENTS; ++i) {
+        BMQTST_ASSERT_EQ_D(i, context.d_values[i], i);
+    }
+
+    threadPool.stop();
+}
+
+static void test4_ringBufferTryEnqueue()
+// ------------------------------------------------------------------------
+// RING BUFFER TRY ENQUEUE
+//
+// Concerns:
+//   1. 'tryEnqueueEvent' enqueues events to a ring buffer queue having
+//      space available.
+//   2. 'tryEnqueueEvent' does not block, and reports that the queue is
+//      full, if the ring buffer queue has no space available.
+//
+// Plan:
+//   Block the processing thread on an initial event, fill its queue with
+//   'tryEnqueueEvent', and make sure one more event is rejected.  Unblock
+//   the processing thread and make sure all the accepted events are
+//   processed in order.
+//
+// Testing:
+//   tryEnqueueEvent
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // See 'test1_breathingTest'.
+
+    bmqtst::TestHelper::printTestName("RING BUFFER TRY ENQUEUE");
+
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    // CONSTANTS
+    const int k_QUEUE_SIZE = 4;
+
+    bsl::map<int, bsl::vector<int> > queueContextMap(allocator);
+    bslmt::Latch                     started(1);
+    bslmt::Semaphore                 release;
+    BlockingContext                  context = {bsl::vector<int>(allocator),
+                                                &started,
+                                                &release};
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        1,                                // minThreads
+        1,                                // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        allocator);
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    MQTP::Config config(
+        1,
+        &threadPool,
+        bdlf::BindUtil::bindS(allocator,
+                              &blockingEventCbCreator,
+                              &context,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // lastProcessingStart
+                              allocator),
+        bdlf::BindUtil::bindS(allocator,
+                              &queueCreator,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // allocator
+                              k_QUEUE_SIZE,
+                              &queueContextMap),
+        allocator);
+    config.setRingBufferQueueCreator(
+        bdlf::BindUtil::bindS(allocator,
+                              &ringBufferQueueCreator,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // allocator
+                              k_QUEUE_SIZE,
+                              &queueContextMap));
+
+    MQTP mqtp(config, allocator);
+    BMQTST_ASSERT_EQ(mqtp.start(), 0);
+
+    {
+        MQTP::EventSp event;
+        event.createInplace(allocator);
+        event->value() = 0;
+        BMQTST_ASSERT_EQ(
+            mqtp.enqueueEvent(bslmf::MovableRefUtil::move(event), 0),
+            0);
+    }
+
+    // The processing thread is now blocked, and its queue is empty
+    started.wait();
+
+    for (int i = 1; i <= k_QUEUE_SIZE; ++i) {
+        MQTP::EventSp event;
+        event.createInplace(allocator);
+        event->value() = i;
+        BMQTST_ASSERT_EQ_D(i, mqtp.tryEnqueueEvent(event, 0), 0);
+    }
+    BMQTST_ASSERT_EQ(mqtp.numElements(0), k_QUEUE_SIZE);
+
+    {
+        MQTP::EventSp event;
+        event.createInplace(allocator);
+        event->value() = k_QUEUE_SIZE + 1;
+        BMQTST_ASSERT_GT(mqtp.tryEnqueueEvent(event, 0), 0);
+        BMQTST_ASSERT_EQ(event.use_count(), 1);
+    }
+
+    release.post();
+    mqtp.waitUntilEmpty();
+    mqtp.stop();
+
+    BMQTST_ASSERT_EQ(context.d_values.size(), k_QUEUE_SIZE + 1U);
+    for (int i = 0; i <= k_QUEUE_SIZE; ++i) {
+        BMQTST_ASSERT_EQ_D(i, context.d_values[i], i);
+    }
+
+    threadPool.stop();
+}
+
+static void test5_ringBufferCrossEnqueue()
+// ------------------------------------------------------------------------
+// RING BUFFER CROSS ENQUEUE
+//
+// Concerns:
+//   Enqueuing more events than the capacity of a ring buffer queue from
+//   the thread processing another queue does not block (which could be a
+//   deadlock if both queues enqueue to each other), and all the events are
+//   processed in order.
+//
+// Plan:
+//   Block the thread processing the queue 1 on an initial event, and have
+//   the thread processing the queue 0 enqueue more events than its capacity
+//   to the queue 1.  Make sure the queue 0 is done enqueuing before the
+//   queue 1 is unblocked, and that all the events are processed in order.
+//
+// Testing:
+//   enqueueEvent from another processing thread with ring buffer queues
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // See 'test1_breathingTest'.
+
+    bmqtst::TestHelper::printTestName("RING BUFFER CROSS ENQUEUE");
+
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    // CONSTANTS
+    const int k_NUM_QUEUES = 2;
+    const int k_QUEUE_SIZE = 4;
+    const int k_NUM_EVENTS = 50;
+
+    bsl::map<int, bsl::vector<int> > queueContextMap(allocator);
+    bslmt::Latch                     enqueued(1);
+    bslmt::Latch                     started(1);
+    bslmt::Semaphore                 release;
+    CrossEnqueueContext              context = {0,
+                                                k_NUM_EVENTS,
+                                                bsl::vector<int>(allocator),
+                                                &enqueued,
+                                                &started,
+                                                &release};
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        k_NUM_QUEUES,                     // minThreads
+        k_NUM_QUEUES,                     // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        allocator);
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    MQTP::Config config(
+        k_NUM_QUEUES,
+        &threadPool,
+        bdlf::BindUtil::bindS(allocator,
+                              &crossEnqueueEventCbCreator,
+                              &context,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // lastProcessingStart
+                              allocator),
+        bdlf::BindUtil::bindS(allocator,
+                              &queueCreator,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // allocator
+                              k_QUEUE_SIZE,
+                              &queueContextMap),
+        allocator);
+    config.setRingBufferQueueCreator(
+        bdlf::BindUtil::bindS(allocator,
+                              &ringBufferQueueCreator,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // allocator
+                              k_QUEUE_SIZE,
+                              &queueContextMap));
+
+    MQTP mqtp(config, allocator);
+    context.d_mqtp_p = &mqtp;
+    BMQTST_ASSERT_EQ(mqtp.start(), 0);
+
+    {
+        MQTP::EventSp event;
+        event.createInplace(allocator);
+        event->value() = 0;
+        BMQTST_ASSERT_EQ(
+            mqtp.enqueueEvent(bslmf::MovableRefUtil::move(event), 1),
+            0);
+    }
+
+    // The thread processing the queue 1 is now blocked
+    started.wait();
+
+    {
+        MQTP::EventSp event;
+        event.createInplace(allocator);
+        event->value() = 0;
+        BMQTST_ASSERT_EQ(
+            mqtp.enqueueEvent(bslmf::MovableRefUtil::move(event), 0),
+            0);
+    }
+
+    // Would never return if enqueuing to the full queue 1 blocked
+    enqueued.wait();
+    BMQTST_ASSERT_EQ(mqtp.numElements(1), k_NUM_EVENTS);
+
+    release.post();
+    mqtp.waitUntilEmpty();
+    mqtp.stop();
+
+    BMQTST_ASSERT_EQ(context.d_values.size(), k_NUM_EVENTS + 1U);
+    for (int i = 0; i <= k_NUM_EVENTS; ++i) {
+        BMQTST_ASSERT_EQ_D(i, context.d_values[i], i);
+    }
+
+    threadPool.stop();
+}
+
 BSLA_MAYBE_UNUSED
 static void testN1_performance()
 // ------------------------------------------------------------------------
@@ -435,6 +1130,64 @@ static void testN1_performance()
     printProcessedItems(k_NUM_ITERATIONS, endTime - startTime);
 }
 
+BSLA_MAYBE_UNUSED
+static void testN2_backendPerformance()
+// ------------------------------------------------------------------------
+// BACKEND PERFORMANCE TEST
+//
+// Concerns:
+//  a) Compare the throughput of the MQTP using the default
+//     'bdlcc::SingleConsumerQueue' queues, and using the
+//     'bmqc::MPSCRingBuffer' queues, varying the number of producer
+//     threads.
+//
+// Plan:
+//  1) For each backend and each number of producers, create a MQTP with a
+//     single queue and enqueue events as quickly as possible on it, and
+//     measure the time it takes to process all of them.
+//  2) Tabulate the results.
+//
+// Testing:
+//  Performance
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    bmqtst::TestHelper::printTestName("BACKEND PERFORMANCE TEST");
+
+    // CONSTANTS
+    const int k_NUM_ITERATIONS    = 10 * 1000 * 1000;  // 10 M
+    const int k_QUEUE_SIZE        = 250 * 1000;        // 250K
+    const int k_PRODUCERS[]       = {1, 4};
+    const int k_NUM_PRODUCER_SETS = sizeof(k_PRODUCERS) /
+                                    sizeof(k_PRODUCERS[0]);
+
+    bmqtst::Table table(bmqtst::TestHelperUtil::allocator());
+
+    for (int i = 0; i < k_NUM_PRODUCER_SETS; ++i) {
+        for (int useRingBuffer = 0; useRingBuffer < 2; ++useRingBuffer) {
+            const bsls::Types::Int64 elapsed = runBackendPerformanceTest(
+                useRingBuffer,
+                k_QUEUE_SIZE,
+                k_NUM_ITERATIONS,
+                k_PRODUCERS[i]);
+
+            table.column("Queue").insertValue(
+                useRingBuffer ? "bmqc::MPSCRingBuffer"
+                              : "bdlcc::SingleConsumerQueue");
+            table.column("Producers")
+                .insertValue(static_cast<bsls::Types::Uint64>(k_PRODUCERS[i]));
+            table.column("Time (ns)")
+                .insertValue(static_cast<bsls::Types::Uint64>(elapsed));
+            table.column("Per op (ns)")
+                .insertValue(static_cast<bsls::Types::Uint64>(
+                    elapsed / k_NUM_ITERATIONS));
+        }
+    }
+
+    table.print(bsl::cout);
+}
+
 #ifdef BMQTST_BENCHMARK_ENABLED
 static void testN1_performance_GoogleBenchmark(benchmark::State& state)
 // ------------------------------------------------------------------------
@@ -572,6 +1325,37 @@ static void testN1_fixedPerformance_GoogleBenchmark(benchmark::State& state)
         }
     }
 }
+
+static void testN2_backendPerformance_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BACKEND PERFORMANCE TEST
+//
+// Concerns:
+//  a) Compare the throughput of the MQTP using the default
+//     'bdlcc::SingleConsumerQueue' queues (first argument 0), and using the
+//     'bmqc::MPSCRingBuffer' queues (first argument 1), with the number of
+//     producer threads specified by the second argument.
+//
+// Testing:
+//  Performance
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    // CONSTANTS
+    const int k_NUM_ITERATIONS = 1000 * 1000;  // 1 M
+    const int k_QUEUE_SIZE     = 250 * 1000;   // 250K
+
+    for (auto _ : state) {
+        const bsls::Types::Int64 elapsed = runBackendPerformanceTest(
+            state.range(0) != 0,
+            k_QUEUE_SIZE,
+            k_NUM_ITERATIONS,
+            static_cast<int>(state.range(1)));
+        state.SetIterationTime(static_cast<double>(elapsed) / 1e9);
+    }
+    state.SetItemsProcessed(state.iterations() * k_NUM_ITERATIONS);
+}
 #endif  // BMQTST_BENCHMARK_ENABLED
 
 //=============================================================================
@@ -584,6 +1368,10 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_ringBufferCrossEnqueue(); break;
+    case 4: test4_ringBufferTryEnqueue(); break;
+    case 3: test3_ringBufferSelfEnqueue(); break;
+    case 2: test2_ringBufferBreathingTest(); break;
     case 1: test1_breathingTest(); break;
     case -1:
 #ifdef BMQTST_BENCHMARK_ENABLED
@@ -595,6 +1383,21 @@ int main(int argc, char* argv[])
         benchmark::RunSpecifiedBenchmarks();
 #else
         testN1_performance();
+#endif
+        break;
+    case -2:
+#ifdef BMQTST_BENCHMARK_ENABLED
+        BENCHMARK(testN2_backendPerformance_GoogleBenchmark)
+            ->Args({0, 1})
+            ->Args({1, 1})
+            ->Args({0, 4})
+            ->Args({1, 4})
+            ->UseManualTime()
+            ->Unit(benchmark::kMillisecond);
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+#else
+        testN2_backendPerformance();
 #endif
         break;
     default: {
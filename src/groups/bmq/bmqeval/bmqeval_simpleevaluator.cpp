@@ -19,12 +19,198 @@
 #include <bmqeval_simpleevaluatorscanner.h>
 
 // BDE
+#include <bsl_limits.h>
 #include <bsl_utility.h>
-#include <bsla_annotations.h>
+#include <bslstl_stringref.h>
 
 namespace BloombergLP {
 namespace bmqeval {
 
+namespace {
+
+// TYPES
+typedef SimpleEvaluator_Instruction Instruction;
+
+/// A value on the stack of the machine evaluating a compiled expression.
+/// Note that strings refer to either the program or the value returned by
+/// the properties reader, both of which outlive the evaluation.
+struct Value {
+    // TYPES
+    enum Type {
+        /// The value of a property that has not been read yet.
+        e_UNDEFINED,
+
+        /// A property that could not be read; `d_integer` holds the error
+        /// code returned by the reader.
+        e_ERROR,
+
+        /// A value of a type not supported in expressions.
+        e_OTHER,
+
+        e_BOOLEAN,
+        e_INTEGER,
+        e_STRING
+    };
+
+    // DATA
+    Type d_type;
+
+    // The value of a boolean or an integer, or an error code.
+    bsls::Types::Int64 d_integer;
+
+    // The value of a string.
+    bslstl::StringRef d_string;
+
+    // CREATORS
+    Value()
+    : d_type(e_UNDEFINED)
+    , d_integer(0)
+    , d_string()
+    {
+    }
+
+    // MANIPULATORS
+    void setBoolean(bool value)
+    {
+        d_type    = e_BOOLEAN;
+        d_integer = value;
+    }
+
+    void setInteger(bsls::Types::Int64 value)
+    {
+        d_type    = e_INTEGER;
+        d_integer = value;
+    }
+
+    /// Load into this object the value held by the specified `datum`.
+    void load(const bdld::Datum& datum)
+    {
+        if (datum.isError()) {
+            d_type    = e_ERROR;
+            d_integer = datum.theError().code();
+        }
+        else if (datum.isBoolean()) {
+            setBoolean(datum.theBoolean());
+        }
+        else if (datum.isInteger64()) {
+            setInteger(datum.theInteger64());
+        }
+        else if (datum.isInteger()) {
+            setInteger(datum.theInteger());
+        }
+        else if (datum.isString()) {
+            d_type   = e_STRING;
+            d_string = datum.theString();
+        }
+        else {
+            d_type = e_OTHER;
+        }
+    }
+
+    // ACCESSORS
+    bool isBoolean() const { return d_type == e_BOOLEAN; }
+
+    bool isInteger() const { return d_type == e_INTEGER; }
+
+    bool isString() const { return d_type == e_STRING; }
+};
+
+/// Return the result of comparing the specified `lhs` and `rhs` with the
+/// comparison operator identified by the specified `opCode`.
+template <class TYPE>
+bool compare(Instruction::OpCode opCode, const TYPE& lhs, const TYPE& rhs)
+{
+    switch (opCode) {
+    case Instruction::e_EQ: return lhs == rhs;  // RETURN
+    case Instruction::e_NE: return lhs != rhs;  // RETURN
+    case Instruction::e_LT: return lhs < rhs;   // RETURN
+    case Instruction::e_LE: return lhs <= rhs;  // RETURN
+    case Instruction::e_GT: return lhs > rhs;   // RETURN
+    case Instruction::e_GE: return lhs >= rhs;  // RETURN
+    default: {
+        BSLS_ASSERT_SAFE(false && "Not a comparison");
+        return false;  // RETURN
+    }
+    }
+}
+
+/// Return the error corresponding to the specified `code`, returned by a
+/// properties reader that failed to read a property.
+ErrorType::Enum toErrorType(bsls::Types::Int64 code)
+{
+    // ErrorType::e_EVALUATION_LAST and ErrorType::e_EVALUATION_FIRST are
+    // negative, hence the flipped conditional.
+    if (ErrorType::e_EVALUATION_LAST <= code &&
+        code <= ErrorType::e_EVALUATION_FIRST) {
+        return static_cast<ErrorType::Enum>(code);  // RETURN
+    }
+
+    return ErrorType::e_UNDEFINED;
+}
+
+}  // close unnamed namespace
+
+// -----------------------------
+// class SimpleEvaluator_Program
+// -----------------------------
+
+size_t SimpleEvaluator_Program::emit(Instruction::OpCode opCode,
+                                     bsls::Types::Int64  operand)
+{
+    switch (opCode) {
+    case Instruction::e_PROPERTY:
+    case Instruction::e_EXISTS:
+    case Instruction::e_INTEGER:
+    case Instruction::e_STRING:
+    case Instruction::e_BOOLEAN: {
+        ++d_depth;
+    } break;
+    case Instruction::e_NEGATE:
+    case Instruction::e_NOT:
+    case Instruction::e_BOOL: {
+        // Replace the value on top of the stack.
+    } break;
+    default: {
+        // Binary operations pop two values and push their result.  Jumps
+        // either keep the value on top of the stack, which then stands for
+        // the result of the right operand, or pop it.
+        --d_depth;
+    } break;
+    }
+
+    if (d_maxDepth < d_depth) {
+        d_maxDepth = d_depth;
+    }
+
+    const Instruction instruction = {opCode, operand};
+    d_code.push_back(instruction);
+
+    return d_code.size() - 1;
+}
+
+int SimpleEvaluator_Program::propertyIndex(const bsl::string& name)
+{
+    // Expressions use at most 'SimpleEvaluator::k_MAX_PROPERTIES' properties,
+    // a linear search is good enough.
+    for (size_t i = 0; i < d_properties.size(); ++i) {
+        if (d_properties[i] == name) {
+            return static_cast<int>(i);  // RETURN
+        }
+    }
+
+    d_properties.push_back(name);
+
+    return static_cast<int>(d_properties.size() - 1);
+}
+
+int SimpleEvaluator_Program::stringIndex(const bsl::string& value)
+{
+    d_strings.push_back(value);
+
+    return static_cast<int>(d_strings.size() - 1);
+}
+
+
 // ----------------------
 // class PropertiesReader
 // ----------------------
@@ -40,7 +226,7 @@ PropertiesReader::~PropertiesReader()
 // ---------------------
 
 SimpleEvaluator::SimpleEvaluator()
-: d_expression(0)
+: d_program()
 , d_isCompiled(false)
 {
     // NOTHING
@@ -57,15 +243,34 @@ int SimpleEvaluator::compile(const bsl::string&  expression,
     context.d_validationOnly = false;
     parse(expression, context);
 
+    d_program.reset();
+    d_isCompiled = true;
+
     if (context.hasError()) {
-        d_expression.reset();
+        return context.lastError();  // RETURN
     }
-    else {
-        d_expression = context.d_expression;
+
+    bsl::shared_ptr<SimpleEvaluator_Program> program;
+    program.createInplace(context.d_allocator, context.d_allocator);
+    context.d_expression->generate(program.get());
+
+    // The limits enforced by 'parse' guarantee that the program fits the
+    // fixed-size storage used by 'evaluate'.  Check anyway, since a violation
+    // would be a buffer overflow rather than a wrong result.
+    if (program->maxDepth() > k_MAX_STACK_SIZE ||
+        program->numProperties() >
+            static_cast<size_t>(k_MAX_PROPERTIES)) {
+        context.d_os << "expression is too complex";
+        context.d_lastError = ErrorType::e_TOO_COMPLEX;
+        return context.lastError();  // RETURN
     }
-    d_isCompiled = true;
 
-    return context.lastError();
+    d_program = program;
+
+    // The AST is no longer needed.
+    context.d_expression.reset();
+
+    return ErrorType::e_OK;
 }
 
 bool SimpleEvaluator::validate(const bsl::string&  expression,
@@ -127,23 +332,230 @@ void SimpleEvaluator::parse(const bsl::string&  expression,
 
 bool SimpleEvaluator::evaluate(EvaluationContext& context) const
 {
-    BSLS_ASSERT_SAFE(d_expression.get());
+    BSLS_ASSERT_SAFE(d_program);
     BSLS_ASSERT_SAFE(context.d_propertiesReader);
 
     context.reset();
 
-    bdld::Datum value = d_expression->evaluate(context);
+    // The properties, read on first use.
+    Value properties[k_MAX_PROPERTIES];
+
+    // The evaluation stack, 'top' pointing past the last pushed value.
+    Value  stack[k_MAX_STACK_SIZE];
+    Value* top = stack;
+
+    const SimpleEvaluator_Program& program = *d_program;
+    const Instruction* const       begin   = program.code();
+    const Instruction* const end = begin + program.numInstructions();
+
+    for (const Instruction* instruction = begin; instruction != end;
+         ++instruction) {
+        const bsls::Types::Int64 operand = instruction->d_operand;
+
+        switch (instruction->d_opCode) {
+        case Instruction::e_PROPERTY:
+        case Instruction::e_EXISTS: {
+            Value& property = properties[operand];
+            if (property.d_type == Value::e_UNDEFINED) {
+                property.load(context.d_propertiesReader->get(
+                    program.property(operand),
+                    context.d_allocator));
+            }
+
+            if (instruction->d_opCode == Instruction::e_EXISTS) {
+                (top++)->setBoolean(property.d_type != Value::e_ERROR);
+            }
+            else if (property.d_type == Value::e_ERROR) {
+                context.setError(toErrorType(property.d_integer));
+                return false;  // RETURN
+            }
+            else {
+                *top++ = property;
+            }
+        } break;
+        case Instruction::e_INTEGER: {
+            (top++)->setInteger(operand);
+        } break;
+        case Instruction::e_STRING: {
+            top->d_type   = Value::e_STRING;
+            top->d_string = program.string(operand);
+            ++top;
+        } break;
+        case Instruction::e_BOOLEAN: {
+            (top++)->setBoolean(operand != 0);
+        } break;
+        case Instruction::e_EQ:
+        case Instruction::e_NE:
+        case Instruction::e_LT:
+        case Instruction::e_LE:
+        case Instruction::e_GT:
+        case Instruction::e_GE: {
+            const Value& right = *--top;
+            Value&       left  = top[-1];
+
+            if (left.isString() && right.isString()) {
+                left.setBoolean(compare(instruction->d_opCode,
+                                        left.d_string,
+                                        right.d_string));
+            }
+            else if (left.isInteger() && right.isInteger()) {
+                left.setBoolean(compare(instruction->d_opCode,
+                                        left.d_integer,
+                                        right.d_integer));
+            }
+            else {
+                context.setError(ErrorType::e_TYPE);
+                return false;  // RETURN
+            }
+        } break;
+        case Instruction::e_ADD:
+        case Instruction::e_SUB:
+        case Instruction::e_MUL:
+        case Instruction::e_DIV:
+        case Instruction::e_MOD: {
+            const Value& right = *--top;
+            Value&       left  = top[-1];
+
+            if (!left.isInteger() || !right.isInteger()) {
+                context.setError(ErrorType::e_TYPE);
+                return false;  // RETURN
+            }
+
+            const bsls::Types::Int64 a = left.d_integer;
+            const bsls::Types::Int64 b = right.d_integer;
+
+            switch (instruction->d_opCode) {
+            case Instruction::e_ADD: {
+                left.setInteger(a + b);
+            } break;
+            case Instruction::e_SUB: {
+                left.setInteger(a - b);
+            } break;
+            case Instruction::e_MUL: {
+                left.setInteger(a * b);
+            } break;
+            default: {
+                if (b == 0 ||
+                    (a == bsl::numeric_limits<bsls::Types::Int64>::min() &&
+                     b == -1)) {
+                    context.setError(ErrorType::e_ARITHMETIC);
+                    return false;  // RETURN
+                }
+                left.setInteger(instruction->d_opCode == Instruction::e_DIV
+                                    ? a / b
+                                    : a % b);
+            } break;
+            }
+        } break;
+        case Instruction::e_NEGATE: {
+            Value& value = top[-1];
+            if (!value.isInteger()) {
+                context.setError(ErrorType::e_TYPE);
+                return false;  // RETURN
+            }
+            value.setInteger(-value.d_integer);
+        } break;
+        case Instruction::e_NOT: {
+            Value& value = top[-1];
+            if (!value.isBoolean()) {
+                context.setError(ErrorType::e_TYPE);
+                return false;  // RETURN
+            }
+            value.setBoolean(!value.d_integer);
+        } break;
+        case Instruction::e_OR:
+        case Instruction::e_AND: {
+            const Value& value = top[-1];
+            if (!value.isBoolean()) {
+                context.setError(ErrorType::e_TYPE);
+                return false;  // RETURN
+            }
+
+            if ((value.d_integer != 0) ==
+                (instruction->d_opCode == Instruction::e_OR)) {
+                // Short-circuit: the left operand is the result.  Compensate
+                // for the increment of the loop.
+                instruction = begin + operand - 1;
+            }
+            else {
+                --top;
+            }
+        } break;
+        case Instruction::e_BOOL: {
+            if (!top[-1].isBoolean()) {
+                context.setError(ErrorType::e_TYPE);
+                return false;  // RETURN
+            }
+        } break;
+        }
+    }
 
-    if (context.hasError()) {
+    BSLS_ASSERT_SAFE(top == stack + 1);
+
+    if (!stack[0].isBoolean()) {
+        context.setError(ErrorType::e_TYPE);
         return false;  // RETURN
     }
 
-    if (!value.isBoolean()) {
-        context.setError(ErrorType::e_TYPE);
+    return stack[0].d_integer != 0;
+}
+
+bool SimpleEvaluator::loadPredicate(Predicate* predicate) const
+{
+    BSLS_ASSERT_SAFE(predicate);
+
+    if (!d_program || d_program->numInstructions() != 3) {
+        return false;  // RETURN
+    }
+
+    const Instruction* code = d_program->code();
+
+    // Either 'property op literal' or 'literal op property', in which case
+    // the operator is reversed.
+    const bool isReversed = code[1].d_opCode == Instruction::e_PROPERTY;
+    const Instruction& property = code[isReversed ? 1 : 0];
+    const Instruction& literal  = code[isReversed ? 0 : 1];
+
+    if (property.d_opCode != Instruction::e_PROPERTY ||
+        (literal.d_opCode != Instruction::e_INTEGER &&
+         literal.d_opCode != Instruction::e_STRING)) {
         return false;  // RETURN
     }
 
-    return value.theBoolean();
+    Predicate::Operator op;
+    switch (code[2].d_opCode) {
+    case Instruction::e_EQ: op = Predicate::e_EQ; break;
+    case Instruction::e_NE: op = Predicate::e_NE; break;
+    case Instruction::e_LT:
+        op = isReversed ? Predicate::e_GT : Predicate::e_LT;
+        break;
+    case Instruction::e_LE:
+        op = isReversed ? Predicate::e_GE : Predicate::e_LE;
+        break;
+    case Instruction::e_GT:
+        op = isReversed ? Predicate::e_LT : Predicate::e_GT;
+        break;
+    case Instruction::e_GE:
+        op = isReversed ? Predicate::e_LE : Predicate::e_GE;
+        break;
+    default: return false;  // RETURN
+    }
+
+    predicate->d_property = d_program->property(property.d_operand);
+    predicate->d_operator = op;
+
+    if (literal.d_opCode == Instruction::e_INTEGER) {
+        predicate->d_isString = false;
+        predicate->d_integer  = literal.d_operand;
+        predicate->d_string   = bslstl::StringRef();
+    }
+    else {
+        predicate->d_isString = true;
+        predicate->d_integer  = 0;
+        predicate->d_string   = d_program->string(literal.d_operand);
+    }
+
+    return true;
 }
 
 // ---------------------------------
@@ -172,78 +584,41 @@ SimpleEvaluator::Property::Property(bsl::string&& name) noexcept
 }
 #endif
 
-bdld::Datum
-SimpleEvaluator::Property::evaluate(EvaluationContext& context) const
+void SimpleEvaluator::Property::generate(
+    SimpleEvaluator_Program* program) const
 {
-    bdld::Datum value = context.d_propertiesReader->get(d_name,
-                                                        context.d_allocator);
-
-    if (value.isError()) {
-        const int rc = value.theError().code();
-
-        // ErrorType::e_EVALUATION_LAST and ErrorType::e_EVALUATION_FIRST are
-        // negative, hence the flipped conditional.
-        if (ErrorType::e_EVALUATION_LAST <= rc &&
-            rc <= ErrorType::e_EVALUATION_FIRST) {
-            context.setError(static_cast<ErrorType::Enum>(rc));
-        }
-        else {
-            context.setError(ErrorType::e_UNDEFINED);
-        }
-    }
-
-    return value;
+    program->emit(Instruction::e_PROPERTY, program->propertyIndex(d_name));
 }
 
 // -------------------------------------
 // class SimpleEvaluator::IntegerLiteral
 // -------------------------------------
 
-bdld::Datum
-SimpleEvaluator::IntegerLiteral::evaluate(EvaluationContext& context) const
+void SimpleEvaluator::IntegerLiteral::generate(
+    SimpleEvaluator_Program* program) const
 {
-    // It looks like we could save a bit of time by storing a *datum* in
-    // 'd_value', but it would have to use the compile-time allocator. We don't
-    // want to require that that allocator is still alive at runtime.
-    return bdld::Datum::createInteger64(d_value, context.d_allocator);
+    program->emit(Instruction::e_INTEGER, d_value);
 }
 
 // -------------------------------------
 // class SimpleEvaluator::BooleanLiteral
 // -------------------------------------
 
-bdld::Datum SimpleEvaluator::BooleanLiteral::evaluate(
-    BSLA_MAYBE_UNUSED EvaluationContext& context) const
+void SimpleEvaluator::BooleanLiteral::generate(
+    SimpleEvaluator_Program* program) const
 {
-    return bdld::Datum::createBoolean(d_value);
+    program->emit(Instruction::e_BOOLEAN, d_value);
 }
 
 // ---------------------------------
 // class SimpleEvaluator::UnaryMinus
 // ---------------------------------
 
-bdld::Datum
-SimpleEvaluator::UnaryMinus::evaluate(EvaluationContext& context) const
+void SimpleEvaluator::UnaryMinus::generate(
+    SimpleEvaluator_Program* program) const
 {
-    bdld::Datum expr = d_expression->evaluate(context);
-    if (context.hasError()) {
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    bsls::Types::Int64 value;
-
-    if (expr.isInteger64()) {
-        value = expr.theInteger64();
-    }
-    else if (expr.isInteger()) {
-        value = expr.theInteger();
-    }
-    else {
-        context.setError(ErrorType::e_TYPE);
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    return bdld::Datum::createInteger64(-value, context.d_allocator);
+    d_expression->generate(program);
+    program->emit(Instruction::e_NEGATE);
 }
 
 // ------------------------------------
@@ -263,99 +638,46 @@ SimpleEvaluator::StringLiteral::StringLiteral(bsl::string&& value) noexcept
 }
 #endif
 
-bdld::Datum
-SimpleEvaluator::StringLiteral::evaluate(EvaluationContext& context) const
+void SimpleEvaluator::StringLiteral::generate(
+    SimpleEvaluator_Program* program) const
 {
-    // Same remark as above wrt allocators.
-
-    return bdld::Datum::createStringRef(d_value.data(),
-                                        d_value.length(),
-                                        context.d_allocator);
+    program->emit(Instruction::e_STRING, program->stringIndex(d_value));
 }
 
 // -------------------------
 // class SimpleEvaluator::Or
 // -------------------------
 
-bdld::Datum SimpleEvaluator::Or::evaluate(EvaluationContext& context) const
+void SimpleEvaluator::Or::generate(SimpleEvaluator_Program* program) const
 {
-    bdld::Datum left = d_left->evaluate(context);
-    if (context.hasError()) {
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    if (!left.isBoolean()) {
-        context.setError(ErrorType::e_TYPE);
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    if (left.theBoolean()) {
-        return left;  // RETURN
-    }
-
-    bdld::Datum right = d_right->evaluate(context);
-    if (context.hasError()) {
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    if (!right.isBoolean()) {
-        context.setError(ErrorType::e_TYPE);
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    return right;
+    d_left->generate(program);
+    const size_t jump = program->emit(Instruction::e_OR);
+    d_right->generate(program);
+    program->emit(Instruction::e_BOOL);
+    program->patch(jump);
 }
 
 // --------------------------
 // class SimpleEvaluator::And
 // --------------------------
 
-bdld::Datum SimpleEvaluator::And::evaluate(EvaluationContext& context) const
+void SimpleEvaluator::And::generate(SimpleEvaluator_Program* program) const
 {
-    bdld::Datum left = d_left->evaluate(context);
-    if (context.hasError()) {
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    if (!left.isBoolean()) {
-        context.setError(ErrorType::e_TYPE);
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    if (!left.theBoolean()) {
-        return left;  // RETURN
-    }
-
-    bdld::Datum right = d_right->evaluate(context);
-    if (context.hasError()) {
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    if (!right.isBoolean()) {
-        context.setError(ErrorType::e_TYPE);
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    return right;
+    d_left->generate(program);
+    const size_t jump = program->emit(Instruction::e_AND);
+    d_right->generate(program);
+    program->emit(Instruction::e_BOOL);
+    program->patch(jump);
 }
 
 // --------------------------
 // class SimpleEvaluator::Not
 // --------------------------
 
-bdld::Datum SimpleEvaluator::Not::evaluate(EvaluationContext& context) const
+void SimpleEvaluator::Not::generate(SimpleEvaluator_Program* program) const
 {
-    bdld::Datum value = d_expression->evaluate(context);
-    if (context.hasError()) {
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    if (!value.isBoolean()) {
-        context.setError(ErrorType::e_TYPE);
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    return bdld::Datum::createBoolean(!value.theBoolean());
+    d_expression->generate(program);
+    program->emit(Instruction::e_NOT);
 }
 
 // -----------------------------
@@ -375,12 +697,9 @@ SimpleEvaluator::Exists::Exists(bsl::string&& name) noexcept
 }
 #endif
 
-bdld::Datum SimpleEvaluator::Exists::evaluate(EvaluationContext& context) const
+void SimpleEvaluator::Exists::generate(SimpleEvaluator_Program* program) const
 {
-    bdld::Datum value = context.d_propertiesReader->get(d_name,
-                                                        context.d_allocator);
-
-    return bdld::Datum::createBoolean(!value.isError());
+    program->emit(Instruction::e_EXISTS, program->propertyIndex(d_name));
 }
 
 }  // close package namespace
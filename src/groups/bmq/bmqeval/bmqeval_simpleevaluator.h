@@ -28,6 +28,14 @@
 //
 //@DESCRIPTION: 'SimpleEvaluator' handles expression evaluation.
 //
+// An expression is parsed into an abstract syntax tree, which 'compile' then
+// translates into a flat program for a small stack machine.  Property names
+// are resolved to indices at compilation time, so that each property is read
+// at most once per evaluation, and literals and intermediate results are
+// kept as plain typed values rather than 'bdld::Datum' objects.  Logical
+// operators short-circuit: the right operand of '&&' and '||' is skipped when
+// the left operand determines the result.
+//
 /// Thread Safety
 ///-------------
 //: o SimpleEvaluator is thread safe
@@ -62,10 +70,13 @@
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_issame.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
 #include <bsls_types.h>
 
 #include <bmqu_memoutstream.h>
@@ -134,6 +145,176 @@ class PropertiesReader {
                             bslma::Allocator*  allocator) = 0;
 };
 
+// ==================================
+// struct SimpleEvaluator_Instruction
+// ==================================
+
+/// Component-private struct.  DO NOT USE.  A single instruction of the stack
+/// machine that `SimpleEvaluator` compiles expressions to.
+struct SimpleEvaluator_Instruction {
+    // TYPES
+    enum OpCode {
+        /// Push the value of the property at index `d_operand`.  Stop the
+        /// evaluation if the property cannot be read.
+        e_PROPERTY,
+
+        /// Push `true` if the property at index `d_operand` can be read, and
+        /// `false` otherwise.
+        e_EXISTS,
+
+        /// Push the integer `d_operand`.
+        e_INTEGER,
+
+        /// Push the string literal at index `d_operand`.
+        e_STRING,
+
+        /// Push the boolean `d_operand != 0`.
+        e_BOOLEAN,
+
+        /// Pop two values of the same type, integer or string, and push the
+        /// result of comparing them.
+        e_EQ,
+        e_NE,
+        e_LT,
+        e_LE,
+        e_GT,
+        e_GE,
+
+        /// Pop two integers and push the result of the arithmetic operation.
+        e_ADD,
+        e_SUB,
+        e_MUL,
+        e_DIV,
+        e_MOD,
+
+        /// Replace the integer on top of the stack with its negation.
+        e_NEGATE,
+
+        /// Replace the boolean on top of the stack with its negation.
+        e_NOT,
+
+        /// If the boolean on top of the stack is `true`, jump to the
+        /// instruction at index `d_operand`; otherwise pop it.
+        e_OR,
+
+        /// If the boolean on top of the stack is `false`, jump to the
+        /// instruction at index `d_operand`; otherwise pop it.
+        e_AND,
+
+        /// Check that the value on top of the stack is a boolean.
+        e_BOOL
+    };
+
+    // DATA
+
+    // The operation to perform.
+    OpCode d_opCode;
+
+    // The operand of the operation, if any: a literal, the index of a
+    // property or of a string literal, or the target of a jump.
+    bsls::Types::Int64 d_operand;
+
+    // CLASS METHODS
+
+    /// Return the comparison opcode corresponding to `Op`, one of the
+    /// standard comparison functors (`equal_to`, etc).
+    template <template <typename> class Op>
+    static OpCode comparison();
+
+    /// Return the arithmetic opcode corresponding to `Op`, one of the
+    /// standard binary arithmetic operation functors (`plus`, etc).
+    template <template <typename> class Op>
+    static OpCode arithmetic();
+};
+
+// =============================
+// class SimpleEvaluator_Program
+// =============================
+
+/// Component-private class.  DO NOT USE.  The result of the compilation of
+/// an expression: a sequence of instructions, together with the names of
+/// the properties and the string literals they refer to by index.
+class SimpleEvaluator_Program {
+  public:
+    // PUBLIC TYPES
+    typedef SimpleEvaluator_Instruction Instruction;
+
+  private:
+    // DATA
+
+    // The instructions.
+    bsl::vector<Instruction> d_code;
+
+    // The names of the properties, in order of first appearance.
+    bsl::vector<bsl::string> d_properties;
+
+    // The string literals.
+    bsl::vector<bsl::string> d_strings;
+
+    // The number of values on the stack after executing `d_code`
+    // sequentially, without taking any jump.
+    int d_depth;
+
+    // The maximum number of values on the stack during an evaluation.
+    int d_maxDepth;
+
+  private:
+    // NOT IMPLEMENTED
+    SimpleEvaluator_Program(const SimpleEvaluator_Program&)
+        BSLS_KEYWORD_DELETED;
+    SimpleEvaluator_Program&
+    operator=(const SimpleEvaluator_Program&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SimpleEvaluator_Program,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty program, using the specified `allocator` to supply
+    /// memory.
+    explicit SimpleEvaluator_Program(bslma::Allocator* allocator);
+
+    // MANIPULATORS
+
+    /// Append an instruction with the specified `opCode` and optionally
+    /// specified `operand`, and return its index.
+    size_t emit(Instruction::OpCode opCode, bsls::Types::Int64 operand = 0);
+
+    /// Set the target of the jump instruction at the specified `index` to
+    /// the index of the next instruction to be emitted.
+    void patch(size_t index);
+
+    /// Return the index of the property with the specified `name`, adding
+    /// it if it is not referred to yet.
+    int propertyIndex(const bsl::string& name);
+
+    /// Add the specified string literal `value` and return its index.
+    int stringIndex(const bsl::string& value);
+
+    // ACCESSORS
+
+    /// Return the address of the first instruction.
+    const Instruction* code() const;
+
+    /// Return the number of instructions.
+    size_t numInstructions() const;
+
+    /// Return the name of the property at the specified `index`.
+    const bsl::string& property(bsls::Types::Int64 index) const;
+
+    /// Return the number of distinct properties.
+    size_t numProperties() const;
+
+    /// Return the string literal at the specified `index`.
+    const bsl::string& string(bsls::Types::Int64 index) const;
+
+    /// Return the maximum number of values on the stack during an
+    /// evaluation.
+    int maxDepth() const;
+};
+
 // =====================
 // class SimpleEvaluator
 // =====================
@@ -153,8 +334,9 @@ class SimpleEvaluator {
       public:
         virtual ~Expression();
 
-        /// Evaluate an Expression.
-        virtual bdld::Datum evaluate(EvaluationContext& context) const = 0;
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression.
+        virtual void generate(SimpleEvaluator_Program* program) const = 0;
     };
 
     // Bison generates different code for different available standards:
@@ -197,11 +379,11 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Return the boolean value of the property. If the property is not
-        /// a boolean, stop evaluation, set last error to e_TYPE, and return
-        /// `false`;
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Append to the specified `program` the instruction pushing the
+        /// value of the property.  If the property cannot be read, the
+        /// evaluation stops with the error reported by the reader.
+        void generate(SimpleEvaluator_Program* program) const
+            BSLS_KEYWORD_OVERRIDE;
     };
 
     // --------------
@@ -224,9 +406,10 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Return the integer passed to the constructor, as an Int64 Datum.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Append to the specified `program` the instruction pushing the
+        /// integer passed to the constructor.
+        void generate(SimpleEvaluator_Program* program) const
+            BSLS_KEYWORD_OVERRIDE;
     };
 
     // -------------
@@ -255,9 +438,10 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Return the string passed to the constructor, as StringRef Datum.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Append to the specified `program` the instruction pushing the
+        /// string passed to the constructor.
+        void generate(SimpleEvaluator_Program* program) const
+            BSLS_KEYWORD_OVERRIDE;
     };
 
     // --------------
@@ -280,10 +464,10 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Return the boolean value passed to the constructor, as a boolean
-        /// Datum.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Append to the specified `program` the instruction pushing the
+        /// boolean passed to the constructor.
+        void generate(SimpleEvaluator_Program* program) const
+            BSLS_KEYWORD_OVERRIDE;
 
         /// Return `d_value`.
         bool value() const;
@@ -313,13 +497,12 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Evaluate the `left` and `right` expressions passed to the
-        /// constructor.  If they have the same type, compare them using
-        /// `Op`, and return the result as a boolean Datum. Otherwise, set
-        /// the error in the context to  e_TYPE, stop the evaluation, and
-        /// return a null datum.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Append to the specified `program` the instructions evaluating
+        /// the `left` and `right` expressions passed to the constructor
+        /// and, if they have the same type, comparing them using `Op`.
+        /// Otherwise, the evaluation stops with e_TYPE.
+        void generate(SimpleEvaluator_Program* program) const
+            BSLS_KEYWORD_OVERRIDE;
     };
 
     // --
@@ -345,16 +528,14 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Evaluate the `left` expression passed to the constructor. If it
-        /// is `true`, return `true` as a boolean Datum. If it is `false`,
-        /// evaluate the `right` expression and return its value as a
-        /// boolean Datum. If an expression evaluates to a non-boolean
-        /// Datum, set the error in the context to  e_TYPE, stop the
-        /// evaluation, and return a null datum. Note that the `right`
-        /// expression is not evaluated if `left` evaluates to `true`, and
-        /// its type is not checked.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Append to the specified `program` the instructions evaluating
+        /// the `left` expression passed to the constructor and, if it is
+        /// `false`, the `right` expression.  If an expression evaluates to
+        /// a non-boolean, the evaluation stops with e_TYPE.  Note that the
+        /// `right` expression is not evaluated if `left` evaluates to
+        /// `true`, and its type is not checked.
+        void generate(SimpleEvaluator_Program* program) const
+            BSLS_KEYWORD_OVERRIDE;
     };
 
     // ---
@@ -380,16 +561,14 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Evaluate the `left` expression passed to the constructor. If it
-        /// is `false`, return `false` as a boolean Datum. If it is `true`,
-        /// evaluate the `right` expression and return its value as a
-        /// boolean Datum. If an expression evaluates to a non-boolean
-        /// Datum, set the error in the context to  e_TYPE, stop the
-        /// evaluation, and return a null datum. Note that the `right`
-        /// expression is not evaluated if `left` evaluates to `false`, and
-        /// its type is not checked.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Append to the specified `program` the instructions evaluating
+        /// the `left` expression passed to the constructor and, if it is
+        /// `true`, the `right` expression.  If an expression evaluates to a
+        /// non-boolean, the evaluation stops with e_TYPE.  Note that the
+        /// `right` expression is not evaluated if `left` evaluates to
+        /// `false`, and its type is not checked.
+        void generate(SimpleEvaluator_Program* program) const
+            BSLS_KEYWORD_OVERRIDE;
     };
 
     // ------------------
@@ -417,13 +596,12 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Evaluate the `left` and `right` expressions passed to the
-        /// constructor. If they have are both integers, apply `Op`, and
-        /// return the result as a Int64 Datum. Otherwise, set the error in
-        /// the context to  e_TYPE, stop the evaluation, and return a null
-        /// datum.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Append to the specified `program` the instructions evaluating
+        /// the `left` and `right` expressions passed to the constructor
+        /// and, if they are both integers, applying `Op`.  Otherwise, the
+        /// evaluation stops with e_TYPE.
+        void generate(SimpleEvaluator_Program* program) const
+            BSLS_KEYWORD_OVERRIDE;
     };
 
     // ----------
@@ -445,12 +623,11 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Evaluate `expression` passed to the constructor. If it is an
-        /// integer, return the negated value as an Int64 Datum. Otherwise,
-        /// set the error in the context to  e_TYPE, stop the evaluation,
-        /// and return a null datum.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Append to the specified `program` the instructions evaluating
+        /// `expression` passed to the constructor and, if it is an integer,
+        /// negating it.  Otherwise, the evaluation stops with e_TYPE.
+        void generate(SimpleEvaluator_Program* program) const
+            BSLS_KEYWORD_OVERRIDE;
     };
 
     // ---
@@ -472,12 +649,11 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Evaluate `expression` passed to the constructor. If it is a
-        /// boolean, return the negated value as a boolean Datum.
-        /// Otherwise, set the error in the context to  e_TYPE, stop the
-        /// evaluation, and return a null datum.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Append to the specified `program` the instructions evaluating
+        /// `expression` passed to the constructor and, if it is a boolean,
+        /// negating it.  Otherwise, the evaluation stops with e_TYPE.
+        void generate(SimpleEvaluator_Program* program) const
+            BSLS_KEYWORD_OVERRIDE;
     };
 
     // ------
@@ -507,12 +683,10 @@ class SimpleEvaluator {
 
         // ACCESSORS
 
-        /// Evaluate `expression` passed to the constructor.  If it is a
-        /// boolean, return the negated value as a boolean Datum.
-        /// Otherwise, set the error in the context to e_TYPE, stop the
-        /// evaluation, and return a null datum.
-        bdld::Datum
-        evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+        /// Append to the specified `program` the instruction pushing
+        /// whether the property can be read.
+        void generate(SimpleEvaluator_Program* program) const
+            BSLS_KEYWORD_OVERRIDE;
     };
 
   private:
@@ -522,8 +696,8 @@ class SimpleEvaluator {
 
     // DATA
 
-    // The expression to evaluate.
-    bsl::shared_ptr<Expression> d_expression;
+    // The compiled expression to evaluate.
+    bsl::shared_ptr<const SimpleEvaluator_Program> d_program;
 
     // The flag indicating that `compile` was called for this expression.
     bool d_isCompiled;
@@ -545,7 +719,40 @@ class SimpleEvaluator {
         k_MAX_OPERATORS = 10,
 
         /// The maximum number of properties allowed in a single expression.
-        k_MAX_PROPERTIES = 10
+        k_MAX_PROPERTIES = 10,
+
+        /// The maximum number of values on the stack when evaluating an
+        /// expression.  Each binary operator consumes two values, and each
+        /// value is pushed by a leaf of the expression, hence there are at
+        /// most `k_MAX_OPERATORS + 1` values on the stack at any time.
+        k_MAX_STACK_SIZE = k_MAX_OPERATORS + 1
+    };
+
+    // PUBLIC TYPES
+
+    /// The comparison of a property with a literal that some expressions
+    /// consist of, exposed so that callers can index such expressions.  See
+    /// `loadPredicate`.
+    struct Predicate {
+        // TYPES
+        enum Operator { e_EQ, e_NE, e_LT, e_LE, e_GT, e_GE };
+
+        // DATA
+
+        // The name of the property.
+        bslstl::StringRef d_property;
+
+        // The comparison, with the property as its left operand.
+        Operator d_operator;
+
+        // `true` if the literal is a string, and `false` if it is an integer.
+        bool d_isString;
+
+        // The literal, if it is an integer.
+        bsls::Types::Int64 d_integer;
+
+        // The literal, if it is a string.
+        bslstl::StringRef d_string;
     };
 
     // CREATORS
@@ -574,6 +781,15 @@ class SimpleEvaluator {
     /// only if `isValid()` returns `true`.
     bool isValid() const;
 
+    /// If the compiled expression is a single comparison of a property with
+    /// an integer or a string literal, load it into the specified
+    /// `predicate` and return `true`.  Otherwise, return `false` and leave
+    /// `predicate` unchanged.  The expression evaluates to `true` if and
+    /// only if the property has the type of the literal and the comparison
+    /// holds.  The references held by `predicate` remain valid until this
+    /// object is destroyed or compiled again.
+    bool loadPredicate(Predicate* predicate) const;
+
     // PUBLIC STATIC FUNCTIONS
 
     /// Check `expression`. Return true if it is syntactically correct, and
@@ -790,6 +1006,119 @@ inline const char* ErrorType::toString(ErrorType::Enum value)
     }
 }
 
+// ----------------------------------
+// struct SimpleEvaluator_Instruction
+// ----------------------------------
+
+template <template <typename> class Op>
+inline SimpleEvaluator_Instruction::OpCode
+SimpleEvaluator_Instruction::comparison()
+{
+    if (bsl::is_same<Op<int>, bsl::equal_to<int> >::value) {
+        return e_EQ;  // RETURN
+    }
+    if (bsl::is_same<Op<int>, bsl::not_equal_to<int> >::value) {
+        return e_NE;  // RETURN
+    }
+    if (bsl::is_same<Op<int>, bsl::less<int> >::value) {
+        return e_LT;  // RETURN
+    }
+    if (bsl::is_same<Op<int>, bsl::less_equal<int> >::value) {
+        return e_LE;  // RETURN
+    }
+    if (bsl::is_same<Op<int>, bsl::greater<int> >::value) {
+        return e_GT;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE((bsl::is_same<Op<int>, bsl::greater_equal<int> >::value));
+    return e_GE;
+}
+
+template <template <typename> class Op>
+inline SimpleEvaluator_Instruction::OpCode
+SimpleEvaluator_Instruction::arithmetic()
+{
+    if (bsl::is_same<Op<int>, bsl::plus<int> >::value) {
+        return e_ADD;  // RETURN
+    }
+    if (bsl::is_same<Op<int>, bsl::minus<int> >::value) {
+        return e_SUB;  // RETURN
+    }
+    if (bsl::is_same<Op<int>, bsl::multiplies<int> >::value) {
+        return e_MUL;  // RETURN
+    }
+    if (bsl::is_same<Op<int>, bsl::divides<int> >::value) {
+        return e_DIV;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE((bsl::is_same<Op<int>, bsl::modulus<int> >::value));
+    return e_MOD;
+}
+
+// -----------------------------
+// class SimpleEvaluator_Program
+// -----------------------------
+
+inline SimpleEvaluator_Program::SimpleEvaluator_Program(
+    bslma::Allocator* allocator)
+: d_code(allocator)
+, d_properties(allocator)
+, d_strings(allocator)
+, d_depth(0)
+, d_maxDepth(0)
+{
+}
+
+inline void SimpleEvaluator_Program::patch(size_t index)
+{
+    BSLS_ASSERT_SAFE(index < d_code.size());
+    BSLS_ASSERT_SAFE(d_code[index].d_opCode == Instruction::e_OR ||
+                     d_code[index].d_opCode == Instruction::e_AND);
+
+    d_code[index].d_operand = static_cast<bsls::Types::Int64>(d_code.size());
+}
+
+inline const SimpleEvaluator_Program::Instruction*
+SimpleEvaluator_Program::code() const
+{
+    return d_code.data();
+}
+
+inline size_t SimpleEvaluator_Program::numInstructions() const
+{
+    return d_code.size();
+}
+
+inline const bsl::string&
+SimpleEvaluator_Program::property(bsls::Types::Int64 index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index &&
+                     index < static_cast<bsls::Types::Int64>(
+                                 d_properties.size()));
+
+    return d_properties[static_cast<size_t>(index)];
+}
+
+inline size_t SimpleEvaluator_Program::numProperties() const
+{
+    return d_properties.size();
+}
+
+inline const bsl::string&
+SimpleEvaluator_Program::string(bsls::Types::Int64 index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index &&
+                     index < static_cast<bsls::Types::Int64>(
+                                 d_strings.size()));
+
+    return d_strings[static_cast<size_t>(index)];
+}
+
+inline int SimpleEvaluator_Program::maxDepth() const
+{
+    return d_maxDepth;
+}
+
 // ---------------------
 // class SimpleEvaluator
 // ---------------------
@@ -801,7 +1130,7 @@ inline bool SimpleEvaluator::isCompiled() const
 
 inline bool SimpleEvaluator::isValid() const
 {
-    return d_expression != 0;
+    return d_program != 0;
 }
 
 // -------------------------------------
@@ -841,56 +1170,12 @@ inline SimpleEvaluator::Comparison<Op>::Comparison(ExpressionPtr left,
 }
 
 template <template <typename> class Op>
-bdld::Datum
-SimpleEvaluator::Comparison<Op>::evaluate(EvaluationContext& context) const
+void SimpleEvaluator::Comparison<Op>::generate(
+    SimpleEvaluator_Program* program) const
 {
-    bdld::Datum left = d_left->evaluate(context);
-    if (context.hasError()) {
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    bdld::Datum right = d_right->evaluate(context);
-    if (context.hasError()) {
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    if (left.isString()) {
-        if (right.isString()) {
-            return bdld::Datum::createBoolean(
-                Op<bslstl::StringRef>()(left.theString(), right.theString()));
-            // RETURN
-        }
-
-        context.setError(ErrorType::e_TYPE);
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    bsls::Types::Int64 a;
-    bsls::Types::Int64 b;
-
-    if (left.isInteger64()) {
-        a = left.theInteger64();
-    }
-    else if (left.isInteger()) {
-        a = left.theInteger();
-    }
-    else {
-        context.setError(ErrorType::e_TYPE);
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    if (right.isInteger64()) {
-        b = right.theInteger64();
-    }
-    else if (right.isInteger()) {
-        b = right.theInteger();
-    }
-    else {
-        context.setError(ErrorType::e_TYPE);
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    return bdld::Datum::createBoolean(Op<bsls::Types::Int64>()(a, b));
+    d_left->generate(program);
+    d_right->generate(program);
+    program->emit(SimpleEvaluator_Instruction::comparison<Op>());
 }
 
 // ----------------------------------
@@ -927,55 +1212,12 @@ inline SimpleEvaluator::NumBinaryOperation<Op>::NumBinaryOperation(
 }
 
 template <template <typename> class Op>
-bdld::Datum SimpleEvaluator::NumBinaryOperation<Op>::evaluate(
-    EvaluationContext& context) const
+void SimpleEvaluator::NumBinaryOperation<Op>::generate(
+    SimpleEvaluator_Program* program) const
 {
-    bdld::Datum left = d_left->evaluate(context);
-    if (context.hasError()) {
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    bdld::Datum right = d_right->evaluate(context);
-    if (context.hasError()) {
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    bsls::Types::Int64 a;
-    bsls::Types::Int64 b;
-
-    if (left.isInteger64()) {
-        a = left.theInteger64();
-    }
-    else if (left.isInteger()) {
-        a = left.theInteger();
-    }
-    else {
-        context.setError(ErrorType::e_TYPE);
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    if (right.isInteger64()) {
-        b = right.theInteger64();
-    }
-    else if (right.isInteger()) {
-        b = right.theInteger();
-    }
-    else {
-        context.setError(ErrorType::e_TYPE);
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    if ((bsl::is_same<Op<int>, bsl::divides<int> >::value ||
-         bsl::is_same<Op<int>, bsl::modulus<int> >::value) &&
-        (b == 0 ||
-         (a == bsl::numeric_limits<bsls::Types::Int64>::min() && b == -1))) {
-        context.setError(ErrorType::e_ARITHMETIC);
-        return bdld::Datum::createNull();  // RETURN
-    }
-
-    bsls::Types::Int64 result = Op<bsls::Types::Int64>()(a, b);
-
-    return bdld::Datum::createInteger64(result, context.d_allocator);
+    d_left->generate(program);
+    d_right->generate(program);
+    program->emit(SimpleEvaluator_Instruction::arithmetic<Op>());
 }
 
 // ------------------------------------------
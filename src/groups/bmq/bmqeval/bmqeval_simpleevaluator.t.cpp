@@ -25,6 +25,8 @@
 #include <bdlma_localsequentialallocator.h>
 #include <bsl_limits.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
+#include <bslma_testallocator.h>
 
 // BENCHMARKING LIBRARY
 #ifdef BMQTST_BENCHMARK_ENABLED
@@ -85,6 +87,36 @@ bdld::Datum MockPropertiesReader::get(const bsl::string& name,
     return iter->second;
 }
 
+/// PropertiesReader counting the number of times each property is read.
+class CountingPropertiesReader : public MockPropertiesReader {
+  public:
+    // PUBLIC DATA
+    bsl::unordered_map<bsl::string, int> d_numReads;
+
+    // CREATORS
+    CountingPropertiesReader(bslma::Allocator* allocator);
+
+    // MANIPULATORS
+
+    /// Count the read, and return the value for the specified `name`.
+    bdld::Datum get(const bsl::string& name,
+                    bslma::Allocator*  allocator) BSLS_KEYWORD_OVERRIDE;
+};
+
+CountingPropertiesReader::CountingPropertiesReader(
+    bslma::Allocator* allocator)
+: MockPropertiesReader(allocator)
+, d_numReads(allocator)
+{
+}
+
+bdld::Datum CountingPropertiesReader::get(const bsl::string& name,
+                                          bslma::Allocator*  allocator)
+{
+    ++d_numReads[name];
+    return MockPropertiesReader::get(name, allocator);
+}
+
 #ifdef BMQTST_BENCHMARK_ENABLED
 static void testN1_SimpleEvaluator_GoogleBenchmark(benchmark::State& state)
 {
@@ -116,6 +148,57 @@ static void testN1_SimpleEvaluator()
 }
 #endif
 
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void
+testN2_SimpleEvaluatorExpressions_GoogleBenchmark(benchmark::State& state)
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: SimpleEvaluator Expressions");
+
+    // Evaluate 'state.range(0)' distinct expressions against the same
+    // message, as a queue with that many subscriptions does, and report the
+    // time per evaluation.
+
+    bslma::Allocator*    allocator = bmqtst::TestHelperUtil::allocator();
+    MockPropertiesReader reader(allocator);
+    EvaluationContext    evaluationContext(&reader, allocator);
+
+    const int numExpressions = static_cast<int>(state.range(0));
+    bsl::vector<SimpleEvaluator> evaluators(numExpressions, allocator);
+
+    for (int i = 0; i < numExpressions; ++i) {
+        CompilationContext compilationContext(allocator);
+        bmqu::MemOutStream os(allocator);
+        os << "i64_42 == " << i << " || (b_true && s_foo != \"bar\")";
+
+        BMQTST_ASSERT_EQ(evaluators[i].compile(os.str(), compilationContext),
+                         0);
+        BMQTST_ASSERT_EQ(evaluators[i].evaluate(evaluationContext), true);
+    }
+
+    // <time>
+    for (auto _ : state) {
+        for (int i = 0; i < numExpressions; ++i) {
+            benchmark::DoNotOptimize(
+                evaluators[i].evaluate(evaluationContext));
+        }
+    }
+    // </time>
+
+    state.counters["evaluation"] = benchmark::Counter(
+        numExpressions,
+        benchmark::Counter::kIsIterationInvariantRate |
+            benchmark::Counter::kInvert);
+}
+#else
+static void testN2_SimpleEvaluatorExpressions()
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: SimpleEvaluator Expressions");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+#endif
+
 // ============================================================================
 //                                    TESTS
 // ----------------------------------------------------------------------------
@@ -653,6 +736,171 @@ static void test4_evaluationErrors()
     }
 }
 
+static void test5_compiledEvaluation()
+{
+    // Evaluate with a test allocator to check that, once compiled,
+    // expressions evaluate without allocating memory.
+    bslma::TestAllocator     evaluationAllocator("evaluation");
+    CountingPropertiesReader reader(bmqtst::TestHelperUtil::allocator());
+    EvaluationContext        evaluationContext(&reader, &evaluationAllocator);
+
+    struct TestParameters {
+        const char* expression;
+        bool        expected;
+        const char* property;
+        int         expectedNumReads;
+    } testParameters[] = {
+        // properties used several times are read once
+        {"i_42 > 41 && i_42 < 43 && i_42 != 0", true, "i_42", 1},
+        {"exists(i_42) && i_42 > 41", true, "i_42", 1},
+        {"s_foo == \"foo\" || s_foo == \"bar\"", true, "s_foo", 1},
+        {"i_1 + i_1 * i_1 == 2", true, "i_1", 1},
+
+        // short-circuit
+        {"b_false && i_42 > 41", false, "i_42", 0},
+        {"b_true || i_42 > 41", true, "i_42", 0},
+        {"b_true || (b_false && i_42 > 41)", true, "b_false", 0},
+        {"b_false || i_42 > 41", true, "i_42", 1},
+        {"b_true && (b_false || i_42 > 41)", true, "i_42", 1},
+        {"b_true || non_existing_property", true, "non_existing_property", 0},
+        {"b_false && non_existing_property",
+         false,
+         "non_existing_property",
+         0},
+        {"!b_true && s_foo == 42", false, "s_foo", 0},
+
+        // nested
+        {"(b_false || b_true) && (i_1 == 2 || i_2 == 2)", true, "i_2", 1},
+        {"(b_false || b_false) || (i_1 == 2 || i_2 == 3)", false, "i_2", 1},
+    };
+    const TestParameters* testParametersEnd = testParameters +
+                                              sizeof(testParameters) /
+                                                  sizeof(*testParameters);
+
+    for (const TestParameters* parameters = testParameters;
+         parameters < testParametersEnd;
+         ++parameters) {
+        PV(bsl::string("TESTING ") + parameters->expression);
+
+        CompilationContext compilationContext(
+            bmqtst::TestHelperUtil::allocator());
+        SimpleEvaluator evaluator;
+
+        if (evaluator.compile(parameters->expression, compilationContext)) {
+            PV(bsl::string("UNEXPECTED: ") +
+               compilationContext.lastErrorMessage());
+            BMQTST_ASSERT(false);
+            continue;  // CONTINUE
+        }
+
+        reader.d_numReads.clear();
+
+        BMQTST_ASSERT_EQ(evaluator.evaluate(evaluationContext),
+                         parameters->expected);
+        BMQTST_ASSERT_EQ(evaluationContext.lastError(), ErrorType::e_OK);
+        BMQTST_ASSERT_EQ(reader.d_numReads[parameters->property],
+                         parameters->expectedNumReads);
+
+        // Evaluating again reads the properties again.
+        BMQTST_ASSERT_EQ(evaluator.evaluate(evaluationContext),
+                         parameters->expected);
+        BMQTST_ASSERT_EQ(reader.d_numReads[parameters->property],
+                         2 * parameters->expectedNumReads);
+
+        // Copies share the compiled expression.
+        SimpleEvaluator copy(evaluator);
+        BMQTST_ASSERT(copy.isValid());
+        BMQTST_ASSERT_EQ(copy.evaluate(evaluationContext),
+                         parameters->expected);
+    }
+
+    BMQTST_ASSERT_EQ(evaluationAllocator.numBlocksTotal(), 0);
+}
+
+static void test6_loadPredicate()
+{
+    typedef SimpleEvaluator::Predicate P;
+
+    struct TestParameters {
+        const char* expression;
+        bool        expected;
+        const char* property;
+        P::Operator op;
+        bool        isString;
+        int         integer;
+        const char* string;
+    } testParameters[] = {
+        {"i_42 == 42", true, "i_42", P::e_EQ, false, 42, ""},
+        {"i_42 != 42", true, "i_42", P::e_NE, false, 42, ""},
+        {"i_42 < 1", true, "i_42", P::e_LT, false, 1, ""},
+        {"i_42 <= 1", true, "i_42", P::e_LE, false, 1, ""},
+        {"i_42 > 1", true, "i_42", P::e_GT, false, 1, ""},
+        {"i_42 >= 1", true, "i_42", P::e_GE, false, 1, ""},
+        {"s_foo == \"foo\"", true, "s_foo", P::e_EQ, true, 0, "foo"},
+        {"s_foo > \"bar\"", true, "s_foo", P::e_GT, true, 0, "bar"},
+
+        // literal on the left
+        {"42 == i_42", true, "i_42", P::e_EQ, false, 42, ""},
+        {"1 < i_42", true, "i_42", P::e_GT, false, 1, ""},
+        {"1 <= i_42", true, "i_42", P::e_GE, false, 1, ""},
+        {"1 > i_42", true, "i_42", P::e_LT, false, 1, ""},
+        {"1 >= i_42", true, "i_42", P::e_LE, false, 1, ""},
+        {"\"foo\" == s_foo", true, "s_foo", P::e_EQ, true, 0, "foo"},
+
+        // not a single comparison with a literal
+        {"i_42 == -1", false, "", P::e_EQ, false, 0, ""},
+        {"i_42 == i_1", false, "", P::e_EQ, false, 0, ""},
+        {"i_42 + 1 == 43", false, "", P::e_EQ, false, 0, ""},
+        {"i_42 == 42 && i_1 == 1", false, "", P::e_EQ, false, 0, ""},
+        {"!(i_42 == 42)", false, "", P::e_EQ, false, 0, ""},
+        {"b_true == true", false, "", P::e_EQ, false, 0, ""},
+        {"b_true", false, "", P::e_EQ, false, 0, ""},
+        {"exists(i_42)", false, "", P::e_EQ, false, 0, ""},
+        {"1 == 1", false, "", P::e_EQ, false, 0, ""},
+    };
+    const TestParameters* testParametersEnd = testParameters +
+                                              sizeof(testParameters) /
+                                                  sizeof(*testParameters);
+
+    for (const TestParameters* parameters = testParameters;
+         parameters < testParametersEnd;
+         ++parameters) {
+        PV(bsl::string("TESTING ") + parameters->expression);
+
+        CompilationContext compilationContext(
+            bmqtst::TestHelperUtil::allocator());
+        SimpleEvaluator evaluator;
+        P               predicate;
+
+        // Nothing to load before compilation.
+        BMQTST_ASSERT(!evaluator.loadPredicate(&predicate));
+
+        if (evaluator.compile(parameters->expression, compilationContext)) {
+            PV(bsl::string("UNEXPECTED: ") +
+               compilationContext.lastErrorMessage());
+            BMQTST_ASSERT(false);
+            continue;  // CONTINUE
+        }
+
+        BMQTST_ASSERT_EQ(evaluator.loadPredicate(&predicate),
+                         parameters->expected);
+
+        if (!parameters->expected) {
+            continue;  // CONTINUE
+        }
+
+        BMQTST_ASSERT_EQ(predicate.d_property, parameters->property);
+        BMQTST_ASSERT_EQ(predicate.d_operator, parameters->op);
+        BMQTST_ASSERT_EQ(predicate.d_isString, parameters->isString);
+        if (parameters->isString) {
+            BMQTST_ASSERT_EQ(predicate.d_string, parameters->string);
+        }
+        else {
+            BMQTST_ASSERT_EQ(predicate.d_integer, parameters->integer);
+        }
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -663,11 +911,17 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 6: test6_loadPredicate(); break;
+    case 5: test5_compiledEvaluation(); break;
     case 4: test4_evaluationErrors(); break;
     case 3: test3_evaluation(); break;
     case 2: test2_propertyNames(); break;
     case 1: test1_compilationErrors(); break;
     case -1: BMQTST_BENCHMARK(testN1_SimpleEvaluator); break;
+    case -2:
+        BMQTST_BENCHMARK_WITH_ARGS(testN2_SimpleEvaluatorExpressions,
+                                   Arg(1)->Arg(10)->Arg(100));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
@@ -3465,19 +3465,23 @@ void BrokerSession::processControlEvent(const bmqp::Event& event)
 }
 
 void BrokerSession::enableMessageRetransmission(
-    const bmqp::PutMessageIterator& putIter,
-    const bsls::TimeInterval&       sentTime)
+    const bsl::shared_ptr<const bdlbb::Blob>& event,
+    const bmqp::PutMessageIterator&           putIter,
+    const bsls::TimeInterval&                 sentTime)
 {
     // executed by the FSM thread
 
     BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+    BSLS_ASSERT_SAFE(event);
     BSLS_ASSERT_SAFE(putIter.isValid());
     BSLS_ASSERT_SAFE(!putIter.header().messageGUID().isUnset());
 
-    bdlbb::Blob appData(d_bufferFactory_p, d_allocator_p);
+    // Refer to the application data in the event rather than copying it:
+    // the iterator does not decompress, so the data is in the event.
+    bmqu::BlobPosition appDataPosition;
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-            putIter.loadApplicationData(&appData) != 0)) {
+            putIter.loadApplicationDataPosition(&appDataPosition) != 0)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
         BALL_LOG_ERROR << id() << "Failed to load message payload";
@@ -3502,9 +3506,12 @@ void BrokerSession::enableMessageRetransmission(
                                             qId);
     }
 
-    d_messageCorrelationIdContainer.associateMessageData(putIter.header(),
-                                                         appData,
-                                                         sentTime);
+    d_messageCorrelationIdContainer.associateMessageData(
+        putIter.header(),
+        event,
+        appDataPosition,
+        putIter.applicationDataSize(),
+        sentTime);
 }
 
 void BrokerSession::processPutEvent(const bmqp::Event& event)
@@ -3538,6 +3545,16 @@ void BrokerSession::processPutEvent(const bmqp::Event& event)
     const bsls::TimeInterval sentTime = bmqu::Time::nowMonotonicClock();
     bmqp::PutMessageIterator putIter(d_bufferFactory_p, d_allocator_p);
 
+    // Messages kept for retransmission refer to the event blob, which must
+    // therefore be shared.
+    bsl::shared_ptr<const bdlbb::Blob> event_sp = event.sharedBlob();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!event_sp)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        event_sp = bsl::allocate_shared<bdlbb::Blob>(d_allocator_p,
+                                                     *event.blob(),
+                                                     d_allocator_p);
+    }
+
     // Get PUT iterator without decompression
     event.loadPutMessageIterator(&putIter);
 
@@ -3562,7 +3579,7 @@ void BrokerSession::processPutEvent(const bmqp::Event& event)
         // Enable retransmission for the message.  Such message will be either
         // ACKed by the broker, or retransmitted, or NACKed if the session goes
         // down.
-        enableMessageRetransmission(putIter, sentTime);
+        enableMessageRetransmission(event_sp, putIter, sentTime);
     }
 }
 
@@ -3645,17 +3662,50 @@ void BrokerSession::processPushEvent(const bmqp::Event& event)
         return;  // RETURN
     }
 
-    // Flatten event if needed
-    if (hasMessageWithMultipleSubQueueIds) {
-        // Need to flatten the PushEvent
+    // When the events of each queue are processed in order by one of
+    // several threads, split the event per processing thread so that the
+    // messages of queues of different threads are processed in parallel.
+    const int numShards    = d_eventQueue.numShards();
+    bool      needsRebuild = hasMessageWithMultipleSubQueueIds;
+    if (numShards > 1 && !needsRebuild) {
+        const int shard = bmqp::EventUtil::pushMessagePartition(
+            eventInfos[0].d_ids[0].d_header.queueId(),
+            numShards);
+        for (QueueManager::EventInfos::size_type i = 1;
+             i < eventInfos.size();
+             ++i) {
+            if (bmqp::EventUtil::pushMessagePartition(
+                    eventInfos[i].d_ids[0].d_header.queueId(),
+                    numShards) != shard) {
+                needsRebuild = true;
+                break;  // BREAK
+            }
+        }
+    }
+
+    // Flatten or split event if needed
+    if (needsRebuild) {
         eventInfos.clear();
 
-        rc = bmqp::EventUtil::flattenPushEvent(&eventInfos,
-                                               event,
-                                               d_bufferFactory_p,
-                                               d_blobSpPool_p,
-                                               d_queueManager.schemaLearner(),
-                                               d_allocator_p);
+        if (numShards > 1) {
+            rc = bmqp::EventUtil::partitionPushEvent(
+                &eventInfos,
+                event,
+                numShards,
+                d_bufferFactory_p,
+                d_blobSpPool_p,
+                d_queueManager.schemaLearner(),
+                d_allocator_p);
+        }
+        else {
+            rc = bmqp::EventUtil::flattenPushEvent(
+                &eventInfos,
+                event,
+                d_bufferFactory_p,
+                d_blobSpPool_p,
+                d_queueManager.schemaLearner(),
+                d_allocator_p);
+        }
         if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
             BALL_LOG_ERROR << id() << "Unable to flatten PUSH event"
@@ -3669,7 +3719,7 @@ void BrokerSession::processPushEvent(const bmqp::Event& event)
             return;  // RETURN
         }
     }
-    else {  // !hasMessageWithMultipleSubQueueIds
+    else {  // !needsRebuild
         // No need to flatten, can use the original blob.
     }
 
@@ -3678,7 +3728,7 @@ void BrokerSession::processPushEvent(const bmqp::Event& event)
     for (QueueManager::EventInfos::size_type i = 0; i < eventInfos.size();) {
         const bmqp::EventUtilEventInfo& currEventInfo = eventInfos[i];
 
-        if (hasMessageWithMultipleSubQueueIds) {
+        if (needsRebuild) {
             queueEvent = createEvent();
             const bmqp::Event rawEvent(currEventInfo.d_blob_sp, d_allocator_p);
             queueEvent->configureAsMessageEvent(rawEvent);
@@ -3701,7 +3751,7 @@ void BrokerSession::processPushEvent(const bmqp::Event& event)
 
         ++i;
 
-        if (hasMessageWithMultipleSubQueueIds || i == eventInfos.size()) {
+        if (needsRebuild || i == eventInfos.size()) {
             // Dump if enabled
             if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
                     d_messageDumper
@@ -4760,7 +4810,7 @@ bool BrokerSession::retransmitControlMessage(
     BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
     BSLS_ASSERT_SAFE(qac.d_messageType == bmqp::EventType::e_CONTROL);
     BSLS_ASSERT_SAFE(qac.d_requestContext);
-    BSLS_ASSERT_SAFE(qac.d_messageData.length() > 0);
+    BSLS_ASSERT_SAFE(qac.d_blob_sp && qac.d_blob_sp->length() > 0);
 
     *deleteItem = false;
 
@@ -4771,7 +4821,7 @@ bool BrokerSession::retransmitControlMessage(
     // should't be deleted from the retransmission buffer until the response
     // comes or the request timeout happens.
     bmqt::GenericResult::Enum res = writeOrBuffer(
-        qac.d_messageData,
+        *qac.d_blob_sp,
         d_sessionOptions.channelHighWatermark());
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
@@ -4797,12 +4847,17 @@ bool BrokerSession::appendOrSend(
 
     BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
     BSLS_ASSERT_SAFE(qac.d_messageType == bmqp::EventType::e_PUT);
-    BSLS_ASSERT_SAFE(qac.d_messageData.length() > 0);
+    BSLS_ASSERT_SAFE(qac.d_messageDataSize > 0);
 
     *interrupt = false;
 
+    // The message data is shared with the event it was posted in.
+    bdlbb::Blob messageData(d_bufferFactory_p, d_allocator_p);
+    BSLA_MAYBE_UNUSED const int rc = qac.loadMessageData(&messageData);
+    BSLS_ASSERT_SAFE(rc == 0);
+
     builder.startMessage();
-    builder.setMessagePayload(&qac.d_messageData)
+    builder.setMessagePayload(&messageData)
         .setMessageGUID(qac.d_header.messageGUID())
         .setCrc32c(qac.d_header.crc32c())
         .setCompressionAlgorithmType(qac.d_header.compressionAlgorithmType())
@@ -4879,7 +4934,7 @@ bool BrokerSession::handlePendingMessage(
     }
 
     BSLS_ASSERT_SAFE(qac.d_messageType == bmqp::EventType::e_PUT);
-    BSLS_ASSERT_SAFE(qac.d_messageData.length() > 0);
+    BSLS_ASSERT_SAFE(qac.d_messageDataSize > 0);
 
     bmqp::PutEventBuilder& builder      = *putBuilder;
     const bool             ackRequested = bmqp::PutHeaderFlagUtil::isSet(
@@ -5625,7 +5680,7 @@ BrokerSession::requestWriterCb(const RequestManagerType::RequestSp& context,
 
     if (isBuffered) {
         const bmqt::MessageGUID guid =
-            d_messageCorrelationIdContainer.add(context, queueId, *blob_sp);
+            d_messageCorrelationIdContainer.add(context, queueId, blob_sp);
         char guidHex[bmqt::MessageGUID::e_SIZE_HEX];
         guid.toHex(guidHex);
         context->adoptUserData(
@@ -5753,6 +5808,7 @@ BrokerSession::BrokerSession(
                // supply an empty handler callback if session is not
                // configured to use event handler
                (eventHandlerCb ? sessionOptions.numProcessingThreads() : 0),
+               sessionOptions.perQueueOrderedProcessing(),
                sessionId,
                d_allocators.get("EventQueue"))
 , d_requestManager(bmqp::EventType::e_CONTROL,
@@ -5800,6 +5856,9 @@ BrokerSession::BrokerSession(
     // remain in sync to prevent misleading values.
     resetState();
 
+    // Configure busy polling of the user event queue, before starting it
+    d_eventQueue.setSpinTime(sessionOptions.eventQueueSpinTime());
+
     // Spawn the FSM thread
     bslmt::ThreadAttributes threadAttributes;
     threadAttributes.setThreadName("bmqFSMEvtQ");
@@ -5849,6 +5908,10 @@ void BrokerSession::initializeStats(
                                     d_allocator_p);
 
     d_eventsStats.initializeStats(rootStatContext, start, end);
+
+    d_messageCorrelationIdContainer.initializeStats(rootStatContext,
+                                                    start,
+                                                    end);
 }
 
 bmqt::GenericResult::Enum
@@ -7519,6 +7582,9 @@ void BrokerSession::printStats(bsl::ostream& stream, bool includeDelta) const
 
     stream << "::::: Event Queue >>";
     d_eventQueue.printStats(stream, includeDelta);
+
+    stream << "::::: Pending PUTs >>";
+    d_messageCorrelationIdContainer.printStats(stream, includeDelta);
 }
 
 void BrokerSession::processDumpCommand(
@@ -992,8 +992,14 @@ class BrokerSession BSLS_CPP11_FINAL {
     /// the broker) is available on the channel.
     void processControlEvent(const bmqp::Event& event);
 
-    void enableMessageRetransmission(const bmqp::PutMessageIterator& putIter,
-                                     const bsls::TimeInterval&       sentTime);
+    /// Keep the PUT message currently pointed to by the specified `putIter`
+    /// over the specified `event` for retransmission, as sent at the
+    /// specified `sentTime`.  The message data is not copied: the pending
+    /// message refers to the `event`.
+    void enableMessageRetransmission(
+        const bsl::shared_ptr<const bdlbb::Blob>& event,
+        const bmqp::PutMessageIterator&           putIter,
+        const bsls::TimeInterval&                 sentTime);
 
     /// Process the put event represented by the specified `event`.  This
     /// method gets called each time a new put event is poseted by the user.
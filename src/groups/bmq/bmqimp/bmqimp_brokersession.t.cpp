@@ -26,9 +26,11 @@
 #include <bmqp_crc32c.h>
 #include <bmqp_ctrlmsg_messages.h>
 #include <bmqp_event.h>
+#include <bmqp_eventutil.h>
 #include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocol.h>
 #include <bmqp_puteventbuilder.h>
+#include <bmqp_pusheventbuilder.h>
 #include <bmqp_queueid.h>
 #include <bmqp_schemaeventbuilder.h>
 #include <bmqpi_dtcontext.h>
@@ -46,6 +48,7 @@
 #include <bmqu_time.h>
 
 // BDE
+#include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlcc_deque.h>
 #include <bdlf_memfn.h>
@@ -53,12 +56,14 @@
 #include <bdlmt_signaler.h>
 #include <bsl_memory.h>
 #include <bslma_managedptr.h>
+#include <bslmt_latch.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bslmt_semaphore.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_timedsemaphore.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
 #include <bsls_systemclocktype.h>
 #include <bsls_systemtime.h>
@@ -292,6 +297,66 @@ bool waitRealTime(bslmt::TimedSemaphore* sem)
     return rc == 0;
 }
 
+/// Context of the PUSH event handler of the parallel PUSH processing test.
+struct ParallelPushContext {
+    // DATA
+    bslmt::Latch d_latch;
+    // Released once all the
+    // processing threads are in the
+    // handler
+
+    bsls::AtomicInt d_numParallelEvents;
+    // Number of events processed while
+    // all threads were in the handler
+
+    bsls::AtomicInt d_numMultiQueueEvents;
+    // Number of events holding messages
+    // of several queues
+
+    bsls::AtomicInt d_numMessages[2];
+    // Number of messages received, per
+    // queue id
+
+    bslmt::TimedSemaphore d_eventSem;
+    // Posted for each event processed
+
+    // CREATORS
+    explicit ParallelPushContext(int numThreads)
+    : d_latch(numThreads)
+    , d_numParallelEvents(0)
+    , d_numMultiQueueEvents(0)
+    , d_eventSem()
+    {
+    }
+};
+
+void parallelPushEventHandler(ParallelPushContext*                  context,
+                              const bsl::shared_ptr<bmqimp::Event>& event)
+{
+    PV_SAFE("Incoming PUSH event: " << *event);
+
+    const bmqimp::Event::QueuesBySubscriptionId& queues =
+        event->queuesBySubscriptionId();
+    if (queues.size() != 1) {
+        ++context->d_numMultiQueueEvents;
+    }
+    else {
+        const int queueId = queues.begin()->second->id();
+        BSLS_ASSERT_OPT(0 <= queueId && queueId < 2);
+        context->d_numMessages[queueId] += event->numCorrrelationIds();
+    }
+
+    // Wait for the other processing threads to be in the handler as well,
+    // which only happens if they process their events in parallel.
+    context->d_latch.arrive();
+    if (context->d_latch.timedWait(
+            bsls::SystemTime::nowRealtimeClock().addSeconds(5)) == 0) {
+        ++context->d_numParallelEvents;
+    }
+
+    context->d_eventSem.post();
+}
+
 bool isConfigure(const bmqp_ctrlmsg::ControlMessage& request)
 {
     return request.choice().isConfigureStreamValue() ||
@@ -427,6 +492,10 @@ struct TestSession BSLS_CPP11_FINAL {
     // thread-safe deque to store
     // incoming BlazingMQ events
 
+    /// Handler of the incoming PUSH events, if set before starting the
+    /// session, in place of storing them to `d_eventQueue`.
+    bmqimp::EventQueue::EventHandlerCallback d_pushEventHandler;
+
     bmqimp::BrokerSession d_brokerSession;
     // the broker session object
     // under the test
@@ -776,6 +845,10 @@ struct TestSession BSLS_CPP11_FINAL {
     /// in case of internal timeout.
     bool verifySessionIsStopped();
 
+    /// The event handler provided to the BrokerSession, invoked with the
+    /// specified `event`.
+    void onEvent(const bsl::shared_ptr<bmqimp::Event>& event);
+
     /// A callback provided to the BrokerSession to be called when the
     /// session switches from the specified `oldState` to the specified
     /// `newState` upon the specified `event`.
@@ -853,14 +926,13 @@ TestSession::TestSession(const bmqt::SessionOptions& sessionOptions,
 , d_scheduler(scheduler)
 , d_testChannel(d_allocator_p)
 , d_eventQueue(bsls::SystemClockType::e_MONOTONIC, d_allocator_p)
+, d_pushEventHandler(bsl::allocator_arg, d_allocator_p)
 , d_brokerSession(&d_scheduler,
                   &d_blobBufferFactory,
                   d_blobSpPool_sp.get(),
                   sessionOptions,
                   useEventHandler
-                      ? bdlf::BindUtil::bind(&sessionEventHandler,
-                                             &d_eventQueue,
-                                             bdlf::PlaceHolders::_1)  // event
+                      ? bdlf::MemFnUtil::memFn(&TestSession::onEvent, this)
                       : bmqimp::EventQueue::EventHandlerCallback(),
                   bdlf::MemFnUtil::memFn(&TestSession::stateCb, this),
                   bmqimp::SessionId(),
@@ -890,14 +962,13 @@ TestSession::TestSession(const bmqt::SessionOptions& sessionOptions,
 , d_scheduler(testClock.d_scheduler)
 , d_testChannel(d_allocator_p)
 , d_eventQueue(bsls::SystemClockType::e_MONOTONIC, d_allocator_p)
+, d_pushEventHandler(bsl::allocator_arg, d_allocator_p)
 , d_brokerSession(&d_scheduler,
                   &d_blobBufferFactory,
                   d_blobSpPool_sp.get(),
                   sessionOptions,
                   useEventHandler
-                      ? bdlf::BindUtil::bind(&sessionEventHandler,
-                                             &d_eventQueue,
-                                             bdlf::PlaceHolders::_1)  // event
+                      ? bdlf::MemFnUtil::memFn(&TestSession::onEvent, this)
                       : bmqimp::EventQueue::EventHandlerCallback(),
                   bdlf::MemFnUtil::memFn(&TestSession::stateCb, this),
                   bmqimp::SessionId(),
@@ -2179,6 +2250,18 @@ bool TestSession::verifySessionIsStopped()
     return d_brokerSession.state() == bmqimp::BrokerSession::State::e_STOPPED;
 }
 
+void TestSession::onEvent(const bsl::shared_ptr<bmqimp::Event>& event)
+{
+    if (d_pushEventHandler &&
+        event->type() == bmqimp::Event::EventType::e_MESSAGE &&
+        event->rawEvent().isPushEvent()) {
+        d_pushEventHandler(event);
+        return;  // RETURN
+    }
+
+    sessionEventHandler(&d_eventQueue, event);
+}
+
 int TestSession::stateCb(bmqimp::BrokerSession::State::Enum    oldState,
                          bmqimp::BrokerSession::State::Enum    newState,
                          bmqimp::BrokerSession::FsmEvent::Enum event)
@@ -9751,6 +9834,118 @@ static void test68_queueLateAsyncCanceledHybrid3()
                            bmqimp::QueueState::e_PENDING);
 }
 
+static void test71_parallelPushProcessing()
+// ------------------------------------------------------------------------
+// PARALLEL PUSH PROCESSING TEST
+//
+// Concerns:
+//   1. When processing events in order per queue with several threads, a
+//      PUSH event holding messages of queues processed by different
+//      threads is split into one event per thread, holding the messages of
+//      its queues in order.
+//   2. The threads process the events split out of a PUSH event in
+//      parallel.
+//
+// Plan:
+//   1. Create bmqimp::BrokerSession test wrapper object with 2 processing
+//      threads processing events in order per queue, and with a PUSH event
+//      handler waiting for both threads to be in the handler.
+//   2. Open two reader queues processed by different threads.
+//   3. Inject a PUSH event with messages of both queues interleaved.
+//   4. Verify that each thread received an event holding the messages of
+//      its queue only, and that both events were processed in parallel.
+//   5. Close the queues and stop the session.
+//
+// Testing manipulators:
+//   - processPacket
+//   ----------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PARALLEL PUSH PROCESSING TEST");
+
+    const int k_NUM_THREADS            = 2;
+    const int k_NUM_MESSAGES_PER_QUEUE = 3;
+
+    bmqt::SessionOptions sessionOptions;
+    sessionOptions.setNumProcessingThreads(k_NUM_THREADS)
+        .setPerQueueOrderedProcessing(true);
+
+    bdlmt::EventScheduler scheduler(bsls::SystemClockType::e_MONOTONIC,
+                                    bmqtst::TestHelperUtil::allocator());
+    TestSession           obj(sessionOptions, scheduler);
+    ParallelPushContext   context(k_NUM_THREADS);
+
+    obj.d_pushEventHandler = bdlf::BindUtil::bind(&parallelPushEventHandler,
+                                                  &context,
+                                                  bdlf::PlaceHolders::_1);
+
+    PVV_SAFE("Step 1. Start the session");
+    obj.startAndConnect();
+
+    PVV_SAFE("Step 2. Open two reader queues");
+    bmqt::QueueOptions             queueOptions;
+    bsl::shared_ptr<bmqimp::Queue> queues[] = {
+        obj.createQueue("bmq://ts.trades.myapp/queue.0",
+                        bmqt::QueueFlags::e_READ,
+                        queueOptions),
+        obj.createQueue("bmq://ts.trades.myapp/queue.1",
+                        bmqt::QueueFlags::e_READ,
+                        queueOptions)};
+
+    obj.openQueue(queues[0]);
+    obj.openQueue(queues[1]);
+
+    BMQTST_ASSERT_EQ(queues[0]->id(), 0);
+    BMQTST_ASSERT_EQ(queues[1]->id(), 1);
+    BMQTST_ASSERT_NE(
+        bmqp::EventUtil::pushMessagePartition(queues[0]->id(), k_NUM_THREADS),
+        bmqp::EventUtil::pushMessagePartition(queues[1]->id(),
+                                              k_NUM_THREADS));
+
+    PVV_SAFE("Step 3. Inject a PUSH event with messages of both queues");
+    bmqp::PushEventBuilder builder(&obj.blobSpPool(),
+                                   bmqtst::TestHelperUtil::allocator());
+    bmqp::Protocol::SubQueueInfosArray subQueueInfos(
+        1,
+        bmqp::SubQueueInfo(bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID),
+        bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob payload(&obj.d_blobBufferFactory,
+                        bmqtst::TestHelperUtil::allocator());
+    bdlbb::BlobUtil::append(&payload, "payload", 7);
+
+    for (int i = 0; i < k_NUM_MESSAGES_PER_QUEUE; ++i) {
+        for (int q = 0; q < 2; ++q) {
+            bmqt::EventBuilderResult::Enum rc =
+                builder.addSubQueueInfosOption(subQueueInfos);
+            BMQTST_ASSERT_EQ(rc, bmqt::EventBuilderResult::e_SUCCESS);
+
+            rc = builder.packMessage(payload,
+                                     queues[q]->id(),
+                                     bmqp::MessageGUIDGenerator::testGUID(),
+                                     0,  // flags
+                                     bmqt::CompressionAlgorithmType::e_NONE);
+            BMQTST_ASSERT_EQ(rc, bmqt::EventBuilderResult::e_SUCCESS);
+        }
+    }
+
+    obj.session().processPacket(builder.blob());
+
+    PVV_SAFE("Step 4. Verify the events were processed in parallel");
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        BMQTST_ASSERT(waitRealTime(&context.d_eventSem));
+    }
+
+    BMQTST_ASSERT_EQ(context.d_numMultiQueueEvents, 0);
+    BMQTST_ASSERT_EQ(context.d_numMessages[0], k_NUM_MESSAGES_PER_QUEUE);
+    BMQTST_ASSERT_EQ(context.d_numMessages[1], k_NUM_MESSAGES_PER_QUEUE);
+    BMQTST_ASSERT_EQ(context.d_numParallelEvents, k_NUM_THREADS);
+
+    PVV_SAFE("Step 5. Close the queues and stop the session");
+    obj.closeQueue(queues[0]);
+    obj.closeQueue(queues[1]);
+
+    obj.stopGracefully();
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -9763,6 +9958,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 71: test71_parallelPushProcessing(); break;
     case 70: /* removed test */ break;
     case 69: /* removed test */ break;
     case 68: test68_queueLateAsyncCanceledHybrid3(); break;
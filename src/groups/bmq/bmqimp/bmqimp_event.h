@@ -414,6 +414,11 @@ class Event {
     /// to use because it is populated once.
     const QueuesMap& queues() const;
 
+    /// Return a reference not offering modifiable access to the map of
+    /// queues, by subscription, associated with this event.  The returned
+    /// map is thread-safe to use because it is populated once.
+    const QueuesBySubscriptionId& queuesBySubscriptionId() const;
+
     // - - - - - - - - - - - - - - - -
     // SessionEvent specific operations
     // ACCESSORS
@@ -669,6 +674,12 @@ inline const Event::QueuesMap& Event::queues() const
     return d_queues;
 }
 
+inline const Event::QueuesBySubscriptionId&
+Event::queuesBySubscriptionId() const
+{
+    return d_queuesBySubscriptionId;
+}
+
 inline bmqt::SessionEventType::Enum Event::sessionEventType() const
 {
     // PRECONDITIONS
@@ -18,6 +18,9 @@
 #include <bmqscm_version.h>
 
 // BMQ
+#include <bmqimp_queue.h>
+#include <bmqimp_stat.h>
+#include <bmqp_eventutil.h>
 #include <bmqt_correlationid.h>
 #include <bmqt_resultcode.h>
 
@@ -35,16 +38,23 @@
 #include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
 #include <bdlma_localsequentialallocator.h>
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bsla_annotations.h>
 #include <bslma_allocator.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
 #include <bsls_timeutil.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(BSLS_PLATFORM_CPU_X86)
+#include <emmintrin.h>  // _mm_pause
+#endif
+
 namespace BloombergLP {
 namespace bmqimp {
 
@@ -62,8 +72,44 @@ enum {
     k_STAT_TIME = 1
 };
 
+/// Maximum number of CPU pauses between two consecutive polls of a queue by
+/// a busy polling thread.
+const int k_MAX_SPIN_BACKOFF = 16;
+
+/// Hint the CPU that the calling thread is busy polling, so that it does not
+/// speculatively run the polling loop ahead and leaves the execution
+/// resources of the core to its sibling hardware thread.
+inline void spinPause()
+{
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(BSLS_PLATFORM_CPU_X86)
+    _mm_pause();
+#elif defined(__aarch64__) &&                                                 \
+    (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/// Return the index of the shard processing the events of the specified
+/// `queue`, out of the specified `numShards`.  Note that this must be the
+/// partition the `BrokerSession` splits the PUSH events into.
+int shardIndex(const Queue& queue, int numShards)
+{
+    return bmqp::EventUtil::pushMessagePartition(queue.id(), numShards);
+}
+
 }  // close unnamed namespace
 
+// --------------------------
+// struct EventQueue::Barrier
+// --------------------------
+
+EventQueue::Barrier::Barrier(int numShards)
+: d_numPending(numShards)
+, d_done(1)
+{
+    // NOTHING
+}
+
 // ----------------------------
 // struct EventQueue::QueueItem
 // ----------------------------
@@ -71,6 +117,7 @@ enum {
 EventQueue::QueueItem::QueueItem()
 : d_event_sp(0)
 , d_enqueueTime(0)
+, d_barrier_sp()
 {
     // NOTHING
 }
@@ -79,6 +126,18 @@ EventQueue::QueueItem::QueueItem(const bsl::shared_ptr<Event>& event,
                                  bsls::Types::Int64            enqueueTime)
 : d_event_sp(event)
 , d_enqueueTime(enqueueTime)
+, d_barrier_sp()
+{
+    // NOTHING
+}
+
+// ------------------------
+// struct EventQueue::Shard
+// ------------------------
+
+EventQueue::Shard::Shard(int initialCapacity, bslma::Allocator* allocator)
+: d_queue(initialCapacity, true, allocator)
+, d_stats_mp(0)
 {
     // NOTHING
 }
@@ -162,7 +221,33 @@ void EventQueue::stateCallback(bmqc::MonitoredQueueState::Enum state)
     }
 }
 
-bool EventQueue::hasPriorityEvents(bsl::shared_ptr<Event>* event)
+void EventQueue::shardStateCallback(int                             index,
+                                    bmqc::MonitoredQueueState::Enum state)
+{
+    // Only report the transitions of the shards as a whole: the first shard
+    // reaching its high watermark, and the last one going back to its low
+    // watermark.
+    switch (state) {
+    case bmqc::MonitoredQueueState::e_NORMAL: {
+        if (d_numShardsAboveHighWatermark.subtract(1) != 0) {
+            return;  // RETURN
+        }
+    } break;
+    case bmqc::MonitoredQueueState::e_HIGH_WATERMARK_REACHED: {
+        BALL_LOG_INFO << id() << "EventQueue shard " << index
+                      << " has reached its high-watermark";
+        if (d_numShardsAboveHighWatermark.add(1) != 1) {
+            return;  // RETURN
+        }
+    } break;
+    default: break;
+    }
+
+    stateCallback(state);
+}
+
+bool EventQueue::hasPriorityEvents(bsl::shared_ptr<Event>* event,
+                                   bmqst::StatContext*     stats)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(event);
@@ -178,8 +263,8 @@ bool EventQueue::hasPriorityEvents(bsl::shared_ptr<Event>* event)
             bmqt::SessionEventType::e_SLOWCONSUMER_HIGHWATERMARK);
 
         // Update stats
-        if (d_stats_mp) {
-            d_stats_mp->adjustValue(k_STAT_QUEUE, 1);
+        if (stats) {
+            stats->adjustValue(k_STAT_QUEUE, 1);
         }
 
         return true;  // RETURN
@@ -188,7 +273,8 @@ bool EventQueue::hasPriorityEvents(bsl::shared_ptr<Event>* event)
     return false;
 }
 
-void EventQueue::afterEventPopped(const QueueItem& item)
+void EventQueue::afterEventPopped(const QueueItem&    item,
+                                  bmqst::StatContext* stats)
 {
     const bsls::Types::Int64 popOutTime = bmqu::Time::highResolutionTimer();
     const bsls::Types::Int64 queuedTime = popOutTime - item.d_enqueueTime;
@@ -214,10 +300,150 @@ void EventQueue::afterEventPopped(const QueueItem& item)
     }
 
     // Update stats
-    if (d_stats_mp) {
-        d_stats_mp->adjustValue(k_STAT_QUEUE, -1);
-        d_stats_mp->reportValue(k_STAT_TIME, queuedTime);
+    if (stats) {
+        stats->adjustValue(k_STAT_QUEUE, -1);
+        stats->reportValue(k_STAT_TIME, queuedTime);
+    }
+}
+
+int EventQueue::spinPopFront(QueueItem*           item,
+                             MonitoredEventQueue* queue,
+                             bsls::AtomicBool*    spinner,
+                             bsls::Types::Int64   maxSpinTime)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(item);
+    BSLS_ASSERT_SAFE(queue);
+
+    if (queue->tryPopFront(item) == 0) {
+        return 0;  // RETURN
+    }
+
+    if (d_spinTime == 0) {
+        return -1;  // RETURN
+    }
+
+    // Only one thread busy polls a queue shared by several threads, the
+    // other ones block right away.
+    if (spinner && spinner->testAndSwap(false, true)) {
+        return -1;  // RETURN
+    }
+
+    const bsls::Types::Int64 end = bmqu::Time::highResolutionTimer() +
+                                   bsl::min(d_spinTime, maxSpinTime);
+
+    // Back off exponentially between polls, so that an idle queue does not
+    // keep the core busy polling its cache line.
+    int rc      = -1;
+    int backoff = 1;
+    do {
+        for (int i = 0; i < backoff; ++i) {
+            spinPause();
+        }
+        if (backoff < k_MAX_SPIN_BACKOFF) {
+            backoff *= 2;
+        }
+
+        rc = queue->tryPopFront(item);
+    } while (rc != 0 && bmqu::Time::highResolutionTimer() < end);
+
+    if (spinner) {
+        *spinner = false;
+    }
+
+    return rc;
+}
+
+int EventQueue::pushBackToShards(QueueItem& item)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!d_shards.empty());
+
+    const int numShards = static_cast<int>(d_shards.size());
+
+    // Find the shards of the queues associated with the event, if any
+    bdlma::LocalSequentialAllocator<128> localAllocator(d_allocator_p);
+    bsl::vector<int>                     shards(&localAllocator);
+    shards.reserve(numShards);
+
+    if (item.d_event_sp) {
+        bsl::vector<bool> isInvolved(numShards, false, &localAllocator);
+
+        const Event::QueuesMap& queues = item.d_event_sp->queues();
+        for (Event::QueuesMap::const_iterator cit = queues.begin();
+             cit != queues.end();
+             ++cit) {
+            isInvolved[shardIndex(*cit->second, numShards)] = true;
+        }
+
+        const Event::QueuesBySubscriptionId& queuesBySubscriptionId =
+            item.d_event_sp->queuesBySubscriptionId();
+        for (Event::QueuesBySubscriptionId::const_iterator cit =
+                 queuesBySubscriptionId.begin();
+             cit != queuesBySubscriptionId.end();
+             ++cit) {
+            isInvolved[shardIndex(*cit->second, numShards)] = true;
+        }
+
+        for (int i = 0; i < numShards; ++i) {
+            if (isInvolved[i]) {
+                shards.push_back(i);
+            }
+        }
+    }
+
+    if (shards.empty()) {
+        // Either a poison pill, or an event which is not associated with any
+        // queue and which must therefore be ordered with respect to the
+        // events of all the shards.
+        for (int i = 0; i < numShards; ++i) {
+            shards.push_back(i);
+        }
+    }
+
+    // PUSH events are split per shard by the BrokerSession, so that only
+    // the session and ACK events may have to synchronize several shards.
+    BSLS_ASSERT_SAFE(shards.size() == 1 || !item.d_event_sp ||
+                     item.d_event_sp->type() !=
+                         Event::EventType::e_MESSAGE ||
+                     !item.d_event_sp->rawEvent().isPushEvent());
+
+    if (item.d_event_sp && shards.size() > 1) {
+        item.d_barrier_sp = bsl::allocate_shared<Barrier>(
+            d_allocator_p,
+            static_cast<int>(shards.size()));
+    }
+
+    int rc = 0;
+
+    {  // d_pushBackSpinlock   LOCKED
+        // Enqueuing to all the shards under the lock guarantees that all the
+        // events spanning several shards are enqueued in the same order to
+        // each of them, which the barriers rely upon to not deadlock.
+        bsls::SpinLockGuard guard(&d_pushBackSpinlock);
+        for (bsl::vector<int>::const_iterator cit = shards.begin();
+             cit != shards.end();
+             ++cit) {
+            rc += d_shards[*cit]->d_queue.tryPushBack(item);
+        }
+    }  // d_pushBackSpinlock UNLOCKED
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BSLS_ASSERT_SAFE(false && "Impossible - failed to enqueue");
+        return -1;  // RETURN
     }
+
+    // Update stats
+    for (bsl::vector<int>::const_iterator cit = shards.begin();
+         cit != shards.end();
+         ++cit) {
+        if (d_shards[*cit]->d_stats_mp) {
+            d_shards[*cit]->d_stats_mp->adjustValue(k_STAT_QUEUE, 1);
+        }
+    }
+
+    return 0;
 }
 
 void EventQueue::printLastEventTime(bsl::ostream& stream)
@@ -269,20 +495,85 @@ void EventQueue::dispatchNextEvent()
                   << "[id: " << bslmt::ThreadUtil::selfIdAsUint64() << "]";
 }
 
+void EventQueue::dispatchShardEvents(int index)
+{
+    // executed by (one of) the *EVENT_THREAD_POOL* thread
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(d_eventHandler);
+    BSLS_ASSERT_OPT(0 <= index && index < numShards());
+
+    BALL_LOG_INFO << id() << "EventHandler thread started "
+                  << "[id: " << bslmt::ThreadUtil::selfIdAsUint64()
+                  << ", shard: " << index << "]";
+
+    Shard& shard = *d_shards[index];
+
+    while (true) {
+        QueueItem item;
+
+        // Check for priority events first
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                hasPriorityEvents(&item.d_event_sp,
+                                  shard.d_stats_mp.get()))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            item.d_enqueueTime = bmqu::Time::highResolutionTimer();
+        }
+        else if (spinPopFront(&item, &shard.d_queue, 0) != 0) {
+            BSLA_MAYBE_UNUSED const int rc = shard.d_queue.popFront(&item);
+            BSLS_ASSERT_SAFE(rc == 0);
+        }
+        afterEventPopped(item, shard.d_stats_mp.get());
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!item.d_event_sp)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            // Empty event is the poison pill signal; terminate the thread
+            break;  // BREAK
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(item.d_barrier_sp)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            // The event was enqueued to several shards: it is processed by the
+            // last thread reaching it, once all the others have processed the
+            // events enqueued before it.
+            Barrier& barrier = *item.d_barrier_sp;
+            if (barrier.d_numPending.subtract(1) != 0) {
+                barrier.d_done.wait();
+                continue;  // CONTINUE
+            }
+
+            d_eventHandler(item.d_event_sp);
+            barrier.d_done.arrive();
+            continue;  // CONTINUE
+        }
+
+        d_eventHandler(item.d_event_sp);
+    }
+
+    BALL_LOG_INFO << id() << "EventHandler thread terminated "
+                  << "[id: " << bslmt::ThreadUtil::selfIdAsUint64()
+                  << ", shard: " << index << "]";
+}
+
 EventQueue::EventQueue(EventPool*                  eventPool,
                        int                         initialCapacity,
                        int                         lowWatermark,
                        int                         highWatermark,
                        const EventHandlerCallback& eventHandler,
                        int                         numProcessingThreads,
+                       bool                        perQueueOrderedProcessing,
                        const SessionId&            sessionId,
                        bslma::Allocator*           allocator)
 : d_allocator_p(allocator)
 , d_eventPool_p(eventPool)
 , d_queue(initialCapacity, true, allocator)
+, d_shards(allocator)
+, d_numShardsAboveHighWatermark(0)
 , d_threadPool_mp()
 , d_eventHandler(bsl::allocator_arg, allocator, eventHandler)
 , d_numProcessingThreads(numProcessingThreads)
+, d_spinTime(0)
+, d_isSpinning(false)
 , d_shouldEmitHighWatermark(0)
 , d_lastPoppedOutSpinLock(bsls::SpinLock::s_unlocked)
 , d_lastPoppedOutTime(0)
@@ -306,7 +597,11 @@ EventQueue::EventQueue(EventPool*                  eventPool,
               << ", initialCapacity: "
               << bmqu::PrintUtil::prettyNumber(initialCapacity);
     if (eventHandler) {
-        outStream << ", using " << d_numProcessingThreads << " threads]";
+        outStream << ", using " << d_numProcessingThreads << " threads";
+        if (perQueueOrderedProcessing && numProcessingThreads > 1) {
+            outStream << " processing events in order per queue";
+        }
+        outStream << "]";
     }
     else {
         outStream << ", NOT using eventHandler]";
@@ -319,6 +614,27 @@ EventQueue::EventQueue(EventPool*                  eventPool,
         bdlf::BindUtil::bind(&EventQueue::stateCallback,
                              this,
                              bdlf::PlaceHolders::_1));  // state
+
+    if (!eventHandler || !perQueueOrderedProcessing ||
+        numProcessingThreads <= 1) {
+        return;  // RETURN
+    }
+
+    // Create one shard per processing thread, each having the watermarks of
+    // the queue.
+    d_shards.reserve(numProcessingThreads);
+    for (int i = 0; i < numProcessingThreads; ++i) {
+        ShardSp shard = bsl::allocate_shared<Shard>(d_allocator_p,
+                                                    initialCapacity,
+                                                    d_allocator_p);
+        shard->d_queue.setWatermarks(lowWatermark, highWatermark);
+        shard->d_queue.setStateCallback(
+            bdlf::BindUtil::bind(&EventQueue::shardStateCallback,
+                                 this,
+                                 i,                         // index
+                                 bdlf::PlaceHolders::_1));  // state
+        d_shards.push_back(shard);
+    }
 }
 
 EventQueue::~EventQueue()
@@ -339,8 +655,20 @@ void EventQueue::initializeStats(
 
     bmqst::StatContextConfiguration config(k_STAT_NAME, &localAllocator);
     config.value("Queue").value("Time", bmqst::StatValue::e_DISCRETE);
+    if (!d_shards.empty()) {
+        config.isTable(true);
+    }
     d_stats_mp = rootStatContext->addSubcontext(config);
 
+    // Create one sub-context per shard, if any, aggregated by the one of the
+    // queue
+    for (bsl::vector<ShardSp>::size_type i = 0; i < d_shards.size(); ++i) {
+        bmqu::MemOutStream name(&localAllocator);
+        name << "shard " << i;
+        d_shards[i]->d_stats_mp = d_stats_mp->addSubcontext(
+            bmqst::StatContextConfiguration(name.str(), &localAllocator));
+    }
+
     // Create table
 
     // NOTE: Refer to the component documentation in the header for the meaning
@@ -348,6 +676,9 @@ void EventQueue::initializeStats(
 
     // Configure schema
     bmqst::TableSchema& schema = d_statTable.schema();
+    if (!d_shards.empty()) {
+        schema.addDefaultIdColumn("id");
+    }
     schema.addColumn("enqueue_delta",
                      k_STAT_QUEUE,
                      bmqst::StatUtil::incrementsDifference,
@@ -388,9 +719,16 @@ void EventQueue::initializeStats(
     // Configure records
     bmqst::TableRecords& records = d_statTable.records();
     records.setContext(d_stats_mp.get());
+    if (!d_shards.empty()) {
+        records.setFilter(&StatUtil::filterDirect);
+    }
     records.update();
 
     // Configure tip (With Delta)
+    if (!d_shards.empty()) {
+        d_statTip.setColumnGroup("");
+        d_statTip.addColumn("id", "").justifyLeft();
+    }
     d_statTip.setColumnGroup("Queue");
     d_statTip.addColumn("enqueue_delta", "Enqueue (delta)").zeroString("");
     d_statTip.addColumn("dequeue_delta", "Dequeue (delta)").zeroString("");
@@ -413,6 +751,10 @@ void EventQueue::initializeStats(
         .extremeValueString("");
 
     // Configure tip (without delta)
+    if (!d_shards.empty()) {
+        d_statTipNoDelta.setColumnGroup("");
+        d_statTipNoDelta.addColumn("id", "").justifyLeft();
+    }
     d_statTipNoDelta.setColumnGroup("Queue");
     d_statTipNoDelta.addColumn("size_absmax", "Abs. Max");
 
@@ -422,11 +764,32 @@ void EventQueue::initializeStats(
         .extremeValueString("");
 }
 
+void EventQueue::setSpinTime(const bsls::TimeInterval& value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(value >= bsls::TimeInterval());
+    BSLS_ASSERT_OPT(!d_threadPool_mp && "Must be called before 'start'");
+
+    d_spinTime = value.totalNanoseconds();
+
+    if (d_spinTime != 0) {
+        BALL_LOG_INFO << id() << "EventQueue busy polling for up to "
+                      << bmqu::PrintUtil::prettyTimeInterval(d_spinTime)
+                      << " before blocking";
+    }
+}
+
 int EventQueue::start()
 {
     // Make sure the queue is empty (so that we can do start, stop, start, ...
     // sequence of operations).
     d_queue.reset();
+    for (bsl::vector<ShardSp>::iterator it = d_shards.begin();
+         it != d_shards.end();
+         ++it) {
+        (*it)->d_queue.reset();
+    }
+    d_numShardsAboveHighWatermark = 0;
 
     // Resets the stats
     if (d_stats_mp) {
@@ -468,10 +831,19 @@ int EventQueue::start()
         return -1;  // RETURN
     }
 
-    // Enqueue 'numProcessingThreads' jobs
+    // Enqueue 'numProcessingThreads' jobs, each processing its own shard if
+    // processing events in order per queue
     for (int i = 0; i < d_threadPool_mp->numThreads(); ++i) {
-        rc = d_threadPool_mp->tryEnqueueJob(
-            bdlf::MemFnUtil::memFn(&EventQueue::dispatchNextEvent, this));
+        if (d_shards.empty()) {
+            rc = d_threadPool_mp->tryEnqueueJob(
+                bdlf::MemFnUtil::memFn(&EventQueue::dispatchNextEvent, this));
+        }
+        else {
+            rc = d_threadPool_mp->tryEnqueueJob(
+                bdlf::BindUtil::bind(&EventQueue::dispatchShardEvents,
+                                     this,
+                                     i));  // index
+        }
         if (rc != 0) {
             BALL_LOG_ERROR << id()
                            << "Failed to enqueue job to EventQueue ThreadPool "
@@ -489,8 +861,11 @@ int EventQueue::start()
 void EventQueue::stop()
 {
     if (d_threadPool_mp && d_threadPool_mp->isStarted()) {
-        // Enqueue one poison pill for each thread
-        for (int i = 0; i < d_numProcessingThreads; ++i) {
+        // Enqueue one poison pill for each thread (a single call enqueues
+        // one to each shard, i.e. to each thread, if any)
+        const int numPoisonPills = d_shards.empty() ? d_numProcessingThreads
+                                                    : 1;
+        for (int i = 0; i < numPoisonPills; ++i) {
             enqueuePoisonPill();
         }
 
@@ -516,6 +891,16 @@ int EventQueue::pushBack(bsl::shared_ptr<Event>& event)
     QueueItem item(event, bmqu::Time::highResolutionTimer());
     int       rc = 0;
 
+    if (!d_shards.empty()) {
+        rc = pushBackToShards(item);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            BALL_LOG_ERROR << id() << "Failed to enqueue: "
+                           << *item.d_event_sp;
+        }
+        return rc;  // RETURN
+    }
+
     {  // d_pushBackSpinlock   LOCKED
         bsls::SpinLockGuard guard(&d_pushBackSpinlock);
         rc = d_queue.tryPushBack(item);
@@ -538,21 +923,28 @@ int EventQueue::pushBack(bsl::shared_ptr<Event>& event)
 
 bsl::shared_ptr<Event> EventQueue::popFront()
 {
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_shards.empty());
+
     bsl::shared_ptr<Event> event;
 
     // Check for priority events first
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(hasPriorityEvents(&event))) {
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            hasPriorityEvents(&event, d_stats_mp.get()))) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        afterEventPopped(QueueItem(event, bmqu::Time::highResolutionTimer()));
+        afterEventPopped(QueueItem(event, bmqu::Time::highResolutionTimer()),
+                         d_stats_mp.get());
         return event;  // RETURN
     }
 
     // Look in the queue
-    QueueItem                   item;
-    BSLA_MAYBE_UNUSED const int rc = d_queue.popFront(&item);
-    BSLS_ASSERT_SAFE(rc == 0);
+    QueueItem item;
+    if (spinPopFront(&item, &d_queue, &d_isSpinning) != 0) {
+        BSLA_MAYBE_UNUSED const int rc = d_queue.popFront(&item);
+        BSLS_ASSERT_SAFE(rc == 0);
+    }
     event = item.d_event_sp;
-    afterEventPopped(item);
+    afterEventPopped(item, d_stats_mp.get());
     return event;
 }
 
@@ -560,19 +952,30 @@ bsl::shared_ptr<Event>
 EventQueue::timedPopFront(const bsls::TimeInterval& timeout,
                           const bsls::TimeInterval& now)
 {
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_shards.empty());
+
     bsl::shared_ptr<Event> event;
 
     // Check for priority events first
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(hasPriorityEvents(&event))) {
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            hasPriorityEvents(&event, d_stats_mp.get()))) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        afterEventPopped(QueueItem(event, bmqu::Time::highResolutionTimer()));
+        afterEventPopped(QueueItem(event, bmqu::Time::highResolutionTimer()),
+                         d_stats_mp.get());
         return event;  // RETURN
     }
 
     const bsls::TimeInterval absTimeOut = timeout + now;
-    // Look in the queue
+    // Look in the queue, busy polling it for no longer than the timeout
     QueueItem item;
-    const int rc = d_queue.timedPopFront(&item, absTimeOut);
+    int       rc = spinPopFront(&item,
+                          &d_queue,
+                          &d_isSpinning,
+                          timeout.totalNanoseconds());
+    if (rc != 0) {
+        rc = d_queue.timedPopFront(&item, absTimeOut);
+    }
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
@@ -611,7 +1014,7 @@ EventQueue::timedPopFront(const bsls::TimeInterval& timeout,
         event = item.d_event_sp;
     }
 
-    afterEventPopped(item);
+    afterEventPopped(item, d_stats_mp.get());
     return event;
 }
 
@@ -620,6 +1023,11 @@ void EventQueue::enqueuePoisonPill()
     // PoisonPill has a null event
     QueueItem item(0, bmqu::Time::highResolutionTimer());
 
+    if (!d_shards.empty()) {
+        pushBackToShards(item);
+        return;  // RETURN
+    }
+
     {  // d_pushBackSpinlock   LOCKED
         bsls::SpinLockGuard guard(&d_pushBackSpinlock);
         d_queue.tryPushBack(item);
@@ -636,6 +1044,9 @@ void EventQueue::printStats(bsl::ostream& stream, bool includeDelta) const
     // PRECONDITIONS
     BSLS_ASSERT_OPT(d_stats_mp && "Stats NOT initialized");
 
+    // Refresh the records, to list the stat contexts of the shards
+    d_statTable.records().update();
+
     if (includeDelta) {
         bmqst::TableUtil::printTable(stream, d_statTip);
     }
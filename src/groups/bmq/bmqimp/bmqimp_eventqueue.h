@@ -32,6 +32,45 @@
 // The queue has a built-in monitoring mechanism that will emit alarms when it
 // reaches certain user-customizable thresholds.
 //
+/// Per-queue ordered processing
+///----------------------------
+// When using more than one processing thread, the events are by default
+// delivered to whichever thread is available, so that two messages of the
+// same queue may be processed concurrently, or out of order.  If
+// 'perQueueOrderedProcessing' is requested at construction, the EventQueue
+// instead keeps one queue (a 'shard') per processing thread, each thread only
+// processing the events of its own shard.  An event associated with queues
+// which all map to the same shard (by their queue id) is enqueued to that
+// shard only, so that the events of a queue are processed in order by a
+// single thread while the processing of different queues scales across
+// threads.  An event associated with queues mapping to several shards (e.g.,
+// an ACK event), or not associated with any queue (e.g., a session event), is
+// enqueued to each of the shards involved (all of them if no queue is
+// involved) and is processed once, by the last thread reaching it, after all
+// the events enqueued before it to these shards have been processed; the
+// other threads wait for it to be processed before moving on.  Since this
+// serializes the threads, PUSH events must instead be split per shard before
+// being enqueued (see `bmqp::EventUtil::partitionPushEvent`), so that the
+// messages of the queues of different shards are processed in parallel.
+//
+// In this mode, the watermarks apply to each of the shards: the high
+// watermark event is emitted when a first shard reaches its high watermark,
+// and the back to normal event when all shards are back to their low
+// watermark.
+//
+/// Busy polling
+///------------
+// By default, a thread popping an event from an empty queue (either one of
+// the internal processing threads, or the user calling 'popFront' or
+// 'timedPopFront') blocks until an event is pushed, which requires the thread
+// pushing the event to wake it up.  If a spin time is configured (see
+// 'setSpinTime'), the popping thread instead busy polls the queue for up to
+// that time before blocking, so that an event pushed within that time is
+// picked up without the latency of putting the thread to sleep and waking it
+// up, at the expense of keeping a CPU busy.  The polling thread pauses the
+// CPU between polls, backing off exponentially up to a few pauses, and only
+// one of the threads popping from the same queue busy polls it at a time.
+//
 /// Statistics
 ///----------
 // If configured for the queue can keep keep track of the following statistics:
@@ -60,6 +99,11 @@
 //:
 //: o !QueueTime::Abs.Max!: maximum time ever spent in the queue by an event
 //
+// When processing events in order per queue, the table additionally reports
+// these statistics for each shard, the first line aggregating all of them.
+// Note that an event enqueued to several shards is accounted for in each of
+// them.
+//
 /// Thread Safety
 ///-------------
 // Thread safe with minimal locking.
@@ -149,12 +193,15 @@
 #include <bdlmt_fixedthreadpool.h>
 #include <bdlt_currenttime.h>
 #include <bsl_functional.h>
+#include <bsl_limits.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_latch.h>
 #include <bsls_atomic.h>
 #include <bsls_cpp11.h>
 #include <bsls_spinlock.h>
@@ -194,6 +241,23 @@ class EventQueue {
     /// Shortcut alias
     typedef bslma::ManagedPtr<bdlmt::FixedThreadPool> FixedThreadPoolMP;
 
+    /// Struct synchronizing the threads of the shards an event was enqueued
+    /// to, so that it is processed once all of them have processed the
+    /// events enqueued before it.
+    struct Barrier {
+        // PUBLIC DATA
+        bsls::AtomicInt d_numPending;
+        // Number of shards which have not
+        // reached the event yet
+
+        bslmt::Latch d_done;
+        // Released once the event has
+        // been processed
+
+        // CREATORS
+        explicit Barrier(int numShards);
+    };
+
     /// Struct holding a pointer to the enqueued event and a timestamp
     /// representing the time the event was pushed into the queue.
     struct QueueItem {
@@ -204,6 +268,11 @@ class EventQueue {
         bsls::Types::Int64 d_enqueueTime;
         // Enqueue time
 
+        bsl::shared_ptr<Barrier> d_barrier_sp;
+        // Barrier to reach before
+        // processing the event, if it was
+        // enqueued to several shards
+
         // CREATORS
         QueueItem();
         QueueItem(const bsl::shared_ptr<Event>& event,
@@ -213,6 +282,23 @@ class EventQueue {
     typedef bmqc::MonitoredQueue<bdlcc::SingleProducerQueue<QueueItem> >
         MonitoredEventQueue;
 
+    /// Struct holding the queue of events of one of the processing threads,
+    /// when processing events in order per queue.
+    struct Shard {
+        // PUBLIC DATA
+        MonitoredEventQueue d_queue;
+        // The queue
+
+        bslma::ManagedPtr<bmqst::StatContext> d_stats_mp;
+        // Stat context of the shard, if
+        // stats are configured
+
+        // CREATORS
+        Shard(int initialCapacity, bslma::Allocator* allocator);
+    };
+
+    typedef bsl::shared_ptr<Shard> ShardSp;
+
   private:
     // DATA
     bslma::Allocator* d_allocator_p;
@@ -225,6 +311,16 @@ class EventQueue {
     MonitoredEventQueue d_queue;
     // The queue
 
+    bsl::vector<ShardSp> d_shards;
+    // One queue per processing thread
+    // when processing events in order
+    // per queue, empty otherwise
+
+    bsls::AtomicInt d_numShardsAboveHighWatermark;
+    // Number of shards which reached
+    // their high watermark and are not
+    // back to their low watermark yet
+
     FixedThreadPoolMP d_threadPool_mp;
     // Thread pool to process items
     // from the queue
@@ -238,6 +334,16 @@ class EventQueue {
     // number of threads to configure
     // the internal thread pool with.
 
+    bsls::Types::Int64 d_spinTime;
+    // Time, in nanoseconds, for which a
+    // thread popping from an empty queue
+    // busy polls it before blocking.
+
+    bsls::AtomicBool d_isSpinning;
+    // Whether a thread is busy polling
+    // 'd_queue', so that only one of the
+    // threads popping from it does.
+
     bsls::AtomicInt d_shouldEmitHighWatermark;
     // 1 means next
     // popFront/timedPopFront should
@@ -263,7 +369,7 @@ class EventQueue {
     bslma::ManagedPtr<bmqst::StatContext> d_stats_mp;
     // Stat context to use
 
-    bmqst::Table d_statTable;
+    mutable bmqst::Table d_statTable;
     // Table to use for dumping the
     // stats
 
@@ -301,14 +407,38 @@ class EventQueue {
     /// the specified `state`.
     void stateCallback(bmqc::MonitoredQueueState::Enum state);
 
+    /// Callback invoked by the queue of the shard at the specified `index`
+    /// when it has changed to the specified `state`.
+    void shardStateCallback(int index, bmqc::MonitoredQueueState::Enum state);
+
     /// Return true and populate the specified `event` if any prioritized
     /// one was pending; return false and leave `event` untouched if no
-    /// prioritized events was scheduled.
-    bool hasPriorityEvents(bsl::shared_ptr<Event>* event);
+    /// prioritized events was scheduled.  Account for the event in the
+    /// specified `stats`, if any.
+    bool hasPriorityEvents(bsl::shared_ptr<Event>* event,
+                           bmqst::StatContext*     stats);
 
     /// Called after the specified `item` was successfully popped out from
-    /// the queue, just before it being delivered to the caller.
-    void afterEventPopped(const QueueItem& item);
+    /// the queue, just before it being delivered to the caller.  Account
+    /// for the item in the specified `stats`, if any.
+    void afterEventPopped(const QueueItem& item, bmqst::StatContext* stats);
+
+    /// Pop the front item of the specified `queue` into the specified `item`
+    /// if the queue is not empty, or if an item is pushed to it within the
+    /// spin time, but no later than the optionally specified `maxSpinTime`
+    /// nanoseconds.  If the specified `spinner` is not null, the queue is
+    /// shared by several threads and only busy polled if no other thread is
+    /// already, as indicated by `spinner`.  Return 0 on success, or a
+    /// non-zero value otherwise.
+    int spinPopFront(QueueItem*           item,
+                     MonitoredEventQueue* queue,
+                     bsls::AtomicBool*    spinner,
+                     bsls::Types::Int64   maxSpinTime =
+                         bsl::numeric_limits<bsls::Types::Int64>::max());
+
+    /// Push the specified `item` to the shards its event must be processed
+    /// by, returning 0 on success or non-zero on failure to push.
+    int pushBackToShards(QueueItem& item);
 
     /// Print to the specified `stream` a message describing timings of the
     /// latest event that was successfully popped out from the queue.
@@ -318,6 +448,11 @@ class EventQueue {
     /// the queue and call out the provided EventHandler.
     void dispatchNextEvent();
 
+    /// Main method of the thread processing the shard at the specified
+    /// `index`: reads messages from the shard and call out the provided
+    /// EventHandler.
+    void dispatchShardEvents(int index);
+
     // PRIVATE ACCESSORS
     const SessionId& id() const;
 
@@ -331,14 +466,19 @@ class EventQueue {
     /// `lowWatermark` and `highWatermark`.  If the specified `eventHandler`
     /// is callable, a thread pool having the specified
     /// `numProcessingThreads` will be created and used to dispatch
-    /// processing of the events by invoking the `eventHandler`.  Use the
-    /// specified `allocator` for any memory allocations.
+    /// processing of the events by invoking the `eventHandler`; if the
+    /// specified `perQueueOrderedProcessing` is true and
+    /// `numProcessingThreads` is greater than 1, the events of a queue are
+    /// processed in order, by the same thread (see the component
+    /// documentation).  Use the specified `allocator` for any memory
+    /// allocations.
     EventQueue(EventPool*                  eventPool,
                int                         initialCapacity,
                int                         lowWatermark,
                int                         highWatermark,
                const EventHandlerCallback& eventHandler,
                int                         numProcessingThreads,
+               bool                        perQueueOrderedProcessing,
                const SessionId&            sessionId,
                bslma::Allocator*           allocator);
 
@@ -354,6 +494,13 @@ class EventQueue {
                          const bmqst::StatValue::SnapshotLocation& start,
                          const bmqst::StatValue::SnapshotLocation& end);
 
+    /// Configure this object so that a thread popping from an empty queue
+    /// busy polls it for up to the specified `value` before blocking (see
+    /// the component documentation).  A `value` of 0 disables busy polling.
+    /// The behavior is undefined unless `value` is not negative and this
+    /// method is called before `start`.
+    void setSpinTime(const bsls::TimeInterval& value);
+
     /// Start the EventQueue and return 0 on success, or a non zero code on
     /// error.  If an `eventHandler` was provided at construction, this will
     /// start the thread pool.
@@ -369,7 +516,8 @@ class EventQueue {
     int pushBack(bsl::shared_ptr<Event>& event);
 
     /// Return the front item of the queue, if the queue is not empty; or
-    /// block and wait until an item is being pushed to the queue.
+    /// block and wait until an item is being pushed to the queue.  The
+    /// behavior is undefined if events are processed in order per queue.
     bsl::shared_ptr<Event> popFront();
 
     /// Return the front item of the queue, if the queue is not empty; or
@@ -381,13 +529,16 @@ class EventQueue {
     /// `bmqt::SessionEventType::e_TIMEOUT`.  If an error occurs while
     /// attempting to pop an item from the front of the queue, the method
     /// will return a `SessionEvent` of type
-    /// `bmqt::SessionEventType::e_ERROR`.
+    /// `bmqt::SessionEventType::e_ERROR`.  The behavior is undefined if
+    /// events are processed in order per queue.
     bsl::shared_ptr<Event> timedPopFront(
         const bsls::TimeInterval& timeout,
         const bsls::TimeInterval& now = bsls::SystemTime::nowMonotonicClock());
 
     /// Enqueue a PoisonPill event; this event represents the termination
-    /// condition for the thread reading items from the queue.
+    /// condition for the thread reading items from the queue.  If events are
+    /// processed in order per queue, enqueue one to each shard instead,
+    /// terminating all the processing threads.
     void enqueuePoisonPill();
 
     // ACCESSORS
@@ -395,6 +546,10 @@ class EventQueue {
     /// Return the event pool use by this object.
     EventPool* eventPool() const;
 
+    /// Return the number of shards the events are dispatched to when
+    /// processing them in order per queue, or 0 otherwise.
+    int numShards() const;
+
     /// Print the statistics of this `EventQueue` to the specified `stream`.
     /// If the specified `includeDelta` is true, the printed report will
     /// include delta statistics (if any) representing variations since the
@@ -416,6 +571,11 @@ inline EventQueue::EventPool* EventQueue::eventPool() const
     return d_eventPool_p;
 }
 
+inline int EventQueue::numShards() const
+{
+    return static_cast<int>(d_shards.size());
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
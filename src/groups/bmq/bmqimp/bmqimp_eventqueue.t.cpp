@@ -16,6 +16,7 @@
 #include <bmqimp_eventqueue.h>
 
 // BMQ
+#include <bmqimp_queue.h>
 #include <bmqst_statcontext.h>
 #include <bmqst_statvalue.h>
 #include <bmqt_resultcode.h>
@@ -31,16 +32,21 @@
 #include <bdlt_timeunitratio.h>
 #include <bmqimp_stat.h>
 #include <bslma_managedptr.h>
+#include <bslmt_threadutil.h>
 #include <bsls_atomic.h>
+#include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
 #include <bsls_timeutil.h>
 
 // TEST DRIVER
 #include <bmqtst_testhelper.h>
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 
 // CONVENIENCE
 using namespace BloombergLP;
@@ -58,6 +64,60 @@ void eventHandler(const bsl::shared_ptr<bmqimp::Event>& event,
     ++eventCounter;
 }
 
+/// Context of the event handler of the per-queue ordered processing test.
+struct OrderingContext {
+    // DATA
+    bsl::unordered_map<const bmqimp::Event*, int> d_sequenceNumbers;
+    // Position of each message event in
+    // the order of the pushes
+
+    bsl::vector<int> d_lastSequenceNumbers;
+    // Position of the last message event
+    // processed, per queue
+
+    bsls::AtomicInt d_numOutOfOrder;
+    // Number of message events processed
+    // before a previous one of their
+    // queue
+
+    bsls::AtomicInt d_numMessageEvents;
+    // Number of message events processed
+
+    int d_numMessageEventsAtBarrier;
+    // Number of message events processed
+    // when processing the session event
+
+    // CREATORS
+    OrderingContext(int numQueues, bslma::Allocator* allocator)
+    : d_sequenceNumbers(allocator)
+    , d_lastSequenceNumbers(numQueues, -1, allocator)
+    , d_numOutOfOrder(0)
+    , d_numMessageEvents(0)
+    , d_numMessageEventsAtBarrier(-1)
+    {
+    }
+};
+
+void orderingEventHandler(const bsl::shared_ptr<bmqimp::Event>& event,
+                          OrderingContext*                      context)
+{
+    if (event->type() == bmqimp::Event::EventType::e_SESSION) {
+        context->d_numMessageEventsAtBarrier = context->d_numMessageEvents;
+        return;  // RETURN
+    }
+
+    BSLS_ASSERT_OPT(event->queues().size() == 1);
+
+    const int queueId        = event->queues().begin()->second->id();
+    const int sequenceNumber =
+        context->d_sequenceNumbers.find(event.get())->second;
+    if (sequenceNumber < context->d_lastSequenceNumbers[queueId]) {
+        ++context->d_numOutOfOrder;
+    }
+    context->d_lastSequenceNumbers[queueId] = sequenceNumber;
+    ++context->d_numMessageEvents;
+}
+
 /// Create an `Event` object at the specified `address` using the supplied
 /// allocator `allocator`; This is used by the Object Pool.
 void poolCreateEvent(void*                     address,
@@ -164,7 +224,8 @@ void queuePerformance(int                       numReaders,
         queueSize / 3,  // lowWatermark
         queueSize / 2,  // highWatermark
         emptyEventHandler,
-        0,  // numProcessingThreads
+        0,      // numProcessingThreads
+        false,  // perQueueOrderedProcessing
         bmqimp::SessionId(bmqp_ctrlmsg::NegotiationMessage()),
         bmqtst::TestHelperUtil::allocator());
 
@@ -190,6 +251,115 @@ void queuePerformance(int                       numReaders,
     printProcessedItems(numIter, endTime - startTime);
 }
 
+/// Push the specified `numEvents` events to the specified `queue`, one
+/// every `intervalUs` microseconds, recording in the specified `pushTimes`
+/// the time each was pushed at.
+void latencyTestQueuePusher(bmqimp::EventQueue*              queue,
+                            bsl::vector<bsls::Types::Int64>* pushTimes,
+                            int                              numEvents,
+                            int                              intervalUs)
+{
+    for (int i = 0; i < numEvents; ++i) {
+        bsl::shared_ptr<bmqimp::Event> event = queue->eventPool()->getObject();
+        event->configureAsSessionEvent(bmqt::SessionEventType::e_UNDEFINED);
+        (*pushTimes)[i] = bsls::TimeUtil::getTimer();
+        queue->pushBack(event);
+        bslmt::ThreadUtil::microSleep(intervalUs);
+    }
+}
+
+/// Pop an event from the specified `queue` and increment the specified
+/// `numPopped` if it is not a timeout event.
+void spinTestQueuePopper(bmqimp::EventQueue* queue, bsls::AtomicInt* numPopped)
+{
+    bsl::shared_ptr<bmqimp::Event> event = queue->timedPopFront(
+        bsls::TimeInterval(10));
+    if (event->sessionEventType() == bmqt::SessionEventType::e_UNDEFINED) {
+        ++(*numPopped);
+    }
+}
+
+/// Measure the time it takes for an event pushed to an EventQueue busy
+/// polling for up to the specified `spinTime` to be popped by a thread
+/// waiting for it, and print the percentiles of the measurements.
+void popLatency(const bsls::TimeInterval& spinTime,
+                bdlbb::BlobBufferFactory* bufferFactory)
+{
+    const int k_NUM_EVENTS = 100 * 1000;
+    const int k_INTERVAL   = 50;  // microseconds between two pushes
+
+    bmqimp::EventQueue::EventPool eventPool(
+        bdlf::BindUtil::bind(&poolCreateEvent,
+                             bdlf::PlaceHolders::_1,  // address
+                             bufferFactory,
+                             bdlf::PlaceHolders::_2),  // allocator
+        -1,
+        bmqtst::TestHelperUtil::allocator());
+
+    bmqimp::EventQueue::EventHandlerCallback emptyEventHandler;
+    bmqimp::EventQueue                       obj(
+        &eventPool,
+        1000,              // initialCapacity
+        100,               // lowWatermark
+        k_NUM_EVENTS + 1,  // highWatermark
+        emptyEventHandler,
+        0,      // numProcessingThreads
+        false,  // perQueueOrderedProcessing
+        bmqimp::SessionId(),
+        bmqtst::TestHelperUtil::allocator());
+    obj.setSpinTime(spinTime);
+    BSLS_ASSERT_OPT(obj.start() == 0);
+
+    bsl::vector<bsls::Types::Int64> pushTimes(
+        k_NUM_EVENTS,
+        0,
+        bmqtst::TestHelperUtil::allocator());
+    bsl::vector<bsls::Types::Int64> latencies(
+        bmqtst::TestHelperUtil::allocator());
+    latencies.reserve(k_NUM_EVENTS);
+
+    bslmt::ThreadUtil::Handle pusher;
+    BSLS_ASSERT_OPT(
+        bslmt::ThreadUtil::createWithAllocator(
+            &pusher,
+            bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                                  &latencyTestQueuePusher,
+                                  &obj,
+                                  &pushTimes,
+                                  k_NUM_EVENTS,
+                                  k_INTERVAL),
+            bmqtst::TestHelperUtil::allocator()) == 0);
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        bsl::shared_ptr<bmqimp::Event> event = obj.timedPopFront(
+            bsls::TimeInterval(1));
+        latencies.push_back(bsls::TimeUtil::getTimer() - pushTimes[i]);
+        BSLS_ASSERT_OPT(event->sessionEventType() ==
+                        bmqt::SessionEventType::e_UNDEFINED);
+    }
+
+    bslmt::ThreadUtil::join(pusher);
+    obj.stop();
+
+    bsl::sort(latencies.begin(), latencies.end());
+
+    bsl::cout << "spinTime: "
+              << bmqu::PrintUtil::prettyTimeInterval(
+                     spinTime.totalNanoseconds())
+              << ", p50: "
+              << bmqu::PrintUtil::prettyTimeInterval(
+                     latencies[k_NUM_EVENTS / 2])
+              << ", p99: "
+              << bmqu::PrintUtil::prettyTimeInterval(
+                     latencies[k_NUM_EVENTS * 99 / 100])
+              << ", p99.9: "
+              << bmqu::PrintUtil::prettyTimeInterval(
+                     latencies[k_NUM_EVENTS * 999 / 1000])
+              << ", max: "
+              << bmqu::PrintUtil::prettyTimeInterval(latencies.back())
+              << bsl::endl;
+}
+
 }  // close unnamed namespace
 
 // TBD: Add a test case that tests the stats
@@ -219,7 +389,8 @@ static void test1_breathingTest()
                            3,  // lowWatermark
                            6,  // highWatermark
                            emptyEventHandler,
-                           0,  // numProcessingThreads
+                           0,      // numProcessingThreads
+                           false,  // perQueueOrderedProcessing
                            bmqimp::SessionId(),
                            bmqtst::TestHelperUtil::allocator());
 
@@ -290,7 +461,8 @@ static void test2_capacityTest()
                            0,                       // lowWatermark
                            k_INITIAL_CAPACITY - 1,  // highWatermark
                            emptyEventHandler,
-                           0,  // numProcessingThreads
+                           0,      // numProcessingThreads
+                           false,  // perQueueOrderedProcessing
                            bmqimp::SessionId(),
                            bmqtst::TestHelperUtil::allocator());
 
@@ -351,7 +523,8 @@ static void test3_watermark()
                            3,  // lowWatermark
                            6,  // highWatermark
                            emptyEventHandler,
-                           0,  // numProcessingThreads
+                           0,      // numProcessingThreads
+                           false,  // perQueueOrderedProcessing
                            bmqimp::SessionId(),
                            bmqtst::TestHelperUtil::allocator());
 
@@ -437,6 +610,7 @@ static void test4_basicEventHandlerTest()
                                                 bdlf::PlaceHolders::_1,
                                                 bsl::ref(eventCounter)),
                            k_NUM_THREADS,  // numProcessingThreads
+                           false,          // perQueueOrderedProcessing
                            bmqimp::SessionId(),
                            bmqtst::TestHelperUtil::allocator());
 
@@ -524,7 +698,8 @@ static void test5_emptyStatsTest()
                            3,  // lowWatermark
                            6,  // highWatermark
                            emptyEventHandler,
-                           0,  // numProcessingThreads
+                           0,      // numProcessingThreads
+                           false,  // perQueueOrderedProcessing
                            bmqimp::SessionId(),
                            bmqtst::TestHelperUtil::allocator());
 
@@ -635,7 +810,8 @@ static void test6_workingStatsTest()
                            k_QUEUE_LWM,         // lowWatermark
                            k_QUEUE_HWM,         // highWatermark
                            emptyEventHandler,
-                           0,  // numProcessingThreads
+                           0,      // numProcessingThreads
+                           false,  // perQueueOrderedProcessing
                            bmqimp::SessionId(),
                            bmqtst::TestHelperUtil::allocator());
 
@@ -698,6 +874,262 @@ static void test6_workingStatsTest()
                      k_INITIAL_CAPACITY * k_MILL_SEC + k_QUEUE_WAIT);
 }
 
+static void test7_perQueueOrderedProcessing()
+// ------------------------------------------------------------------------
+// PER-QUEUE ORDERED PROCESSING TEST
+//
+// Concerns:
+//   1. When processing events in order per queue with several threads,
+//      the message events of a queue are processed in the order they were
+//      pushed.
+//   2. An event not associated with any queue is processed once all the
+//      events pushed before it have been processed.
+//   3. The statistics report the backlog of each shard.
+//
+// Plan:
+//   1. Create bmqimp::EventQueue with 'k_NUM_THREADS' processing threads
+//      processing events in order per queue.
+//   2. Push message events of 'k_NUM_QUEUES' queues interleaved, with a
+//      session event in the middle.
+//   3. Stop the queue and check that the message events of each queue were
+//      processed in order, and that the session event was processed after
+//      all the message events pushed before it.
+//
+// Testing manipulators:
+//   - pushBack
+//   - initializeStats
+//   - printStats
+//   ----------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PER-QUEUE ORDERED PROCESSING");
+
+    const int k_NUM_THREADS          = 4;
+    const int k_NUM_QUEUES           = 10;
+    const int k_NUM_EVENTS_PER_QUEUE = 1000;
+    const int k_NUM_EVENTS           = k_NUM_QUEUES * k_NUM_EVENTS_PER_QUEUE;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+    bmqp::PutEventBuilder         builder(blobSpPool.get(),
+                                  bmqtst::TestHelperUtil::allocator());
+    bmqimp::EventQueue::EventPool eventPool(
+        bdlf::BindUtil::bind(&poolCreateEvent,
+                             bdlf::PlaceHolders::_1,  // address
+                             &bufferFactory,
+                             bdlf::PlaceHolders::_2),  // allocator
+        -1,
+        bmqtst::TestHelperUtil::allocator());
+
+    bmqst::StatContextConfiguration config(
+        "stats",
+        bmqtst::TestHelperUtil::allocator());
+    config.defaultHistorySize(2);
+    bmqst::StatContext rootStatContext(config,
+                                       bmqtst::TestHelperUtil::allocator());
+
+    bmqst::StatValue::SnapshotLocation start;
+    bmqst::StatValue::SnapshotLocation end;
+    start.setLevel(0).setIndex(0);
+    end.setLevel(0).setIndex(1);
+
+    OrderingContext context(k_NUM_QUEUES,
+                            bmqtst::TestHelperUtil::allocator());
+
+    bmqimp::EventQueue obj(&eventPool,
+                           k_NUM_EVENTS,      // initialCapacity
+                           k_NUM_EVENTS / 2,  // lowWatermark
+                           k_NUM_EVENTS + 1,  // highWatermark
+                           bdlf::BindUtil::bind(&orderingEventHandler,
+                                                bdlf::PlaceHolders::_1,
+                                                &context),
+                           k_NUM_THREADS,  // numProcessingThreads
+                           true,           // perQueueOrderedProcessing
+                           bmqimp::SessionId(),
+                           bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(obj.numShards(), k_NUM_THREADS);
+
+    obj.initializeStats(&rootStatContext, start, end);
+
+    // Prepare the events, before starting processing them
+    bsl::vector<bsl::shared_ptr<bmqimp::Queue> > queues(
+        bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_NUM_QUEUES; ++i) {
+        bsl::shared_ptr<bmqimp::Queue> queue =
+            bsl::allocate_shared<bmqimp::Queue, bslma::Allocator>(
+                bmqtst::TestHelperUtil::allocator());
+        queue->setId(i);
+        queues.push_back(queue);
+    }
+
+    builder.startMessage();
+    const bdlbb::Blob& eventBlob = *builder.blob();
+
+    bmqp::Event rawEvent(&eventBlob, bmqtst::TestHelperUtil::allocator());
+
+    bsl::vector<bsl::shared_ptr<bmqimp::Event> > events(
+        bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        bsl::shared_ptr<bmqimp::Event> event = eventPool.getObject();
+        event->configureAsMessageEvent(rawEvent);
+        event->insertQueue(queues[i % k_NUM_QUEUES]);
+        context.d_sequenceNumbers[event.get()] = i;
+        events.push_back(event);
+    }
+
+    BMQTST_ASSERT_EQ(obj.start(), 0);
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        if (i == k_NUM_EVENTS / 2) {
+            bsl::shared_ptr<bmqimp::Event> event = eventPool.getObject();
+            event->configureAsSessionEvent(
+                bmqt::SessionEventType::e_UNDEFINED);
+            BMQTST_ASSERT_EQ(obj.pushBack(event), 0);
+        }
+        BMQTST_ASSERT_EQ_D(i, obj.pushBack(events[i]), 0);
+    }
+
+    obj.stop();
+
+    BMQTST_ASSERT_EQ(context.d_numMessageEvents, k_NUM_EVENTS);
+    BMQTST_ASSERT_EQ(context.d_numOutOfOrder, 0);
+    BMQTST_ASSERT_EQ(context.d_numMessageEventsAtBarrier, k_NUM_EVENTS / 2);
+
+    // One line per shard, in addition to the line of the whole queue
+    rootStatContext.snapshot();
+    bmqu::MemOutStream out(bmqtst::TestHelperUtil::allocator());
+    obj.printStats(out, true);
+    PVV(out.str());
+
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        bmqu::MemOutStream shardName(bmqtst::TestHelperUtil::allocator());
+        shardName << "shard " << i;
+        BMQTST_ASSERT_NE(out.str().find(shardName.str()), bsl::string::npos);
+    }
+}
+
+static void test8_spinTime()
+// ------------------------------------------------------------------------
+// SPIN TIME TEST
+//
+// Concerns:
+//   1. An EventQueue busy polling before blocking delivers the events
+//      pushed to it.
+//   2. Busy polling does not extend the timeout of 'timedPopFront'.
+//   3. Threads popping at the same time, of which only one busy polls,
+//      all get the events pushed to the queue.
+//
+// Plan:
+//   1. Create bmqimp::EventQueue busy polling for a long time.
+//   2. Check that 'timedPopFront' returns a timeout event, on an empty
+//      queue, after the specified timeout.
+//   3. Push an event from another thread and check it is popped.
+//   4. Pop from several threads at once, push as many events and check
+//      that each thread popped one.
+//
+// Testing manipulators:
+//   - setSpinTime
+//   - popFront
+//   - timedPopFront
+//   ----------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("SPIN TIME");
+
+    bmqimp::EventQueue::EventHandlerCallback emptyEventHandler;
+    bdlbb::PooledBlobBufferFactory           bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqimp::EventQueue::EventPool eventPool(
+        bdlf::BindUtil::bind(&poolCreateEvent,
+                             bdlf::PlaceHolders::_1,  // address
+                             &bufferFactory,
+                             bdlf::PlaceHolders::_2),  // allocator
+        -1,
+        bmqtst::TestHelperUtil::allocator());
+
+    bmqimp::EventQueue obj(&eventPool,
+                           10,  // initialCapacity
+                           3,   // lowWatermark
+                           6,   // highWatermark
+                           emptyEventHandler,
+                           0,      // numProcessingThreads
+                           false,  // perQueueOrderedProcessing
+                           bmqimp::SessionId(),
+                           bmqtst::TestHelperUtil::allocator());
+    obj.setSpinTime(bsls::TimeInterval(60));
+    BMQTST_ASSERT_EQ(obj.start(), 0);
+
+    PV("Timing out while busy polling");
+    const bsls::TimeInterval timeout(0, 10 * 1000 * 1000);  // 10ms
+    const bsls::TimeInterval before = bsls::SystemTime::nowMonotonicClock();
+
+    bsl::shared_ptr<bmqimp::Event> event = obj.timedPopFront(timeout);
+    BMQTST_ASSERT_EQ(event->sessionEventType(),
+                     bmqt::SessionEventType::e_TIMEOUT);
+    BMQTST_ASSERT_LT(bsls::SystemTime::nowMonotonicClock() - before,
+                     bsls::TimeInterval(30));
+
+    PV("Popping an event pushed while busy polling");
+    bsl::vector<bsls::Types::Int64> pushTimes(
+        1,
+        0,
+        bmqtst::TestHelperUtil::allocator());
+
+    bslmt::ThreadUtil::Handle pusher;
+    BMQTST_ASSERT_EQ(
+        bslmt::ThreadUtil::createWithAllocator(
+            &pusher,
+            bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                                  &latencyTestQueuePusher,
+                                  &obj,
+                                  &pushTimes,
+                                  1,       // numEvents
+                                  10000),  // intervalUs
+            bmqtst::TestHelperUtil::allocator()),
+        0);
+
+    event = obj.popFront();
+    BMQTST_ASSERT_EQ(event->sessionEventType(),
+                     bmqt::SessionEventType::e_UNDEFINED);
+
+    bslmt::ThreadUtil::join(pusher);
+
+    PV("Popping from several threads at once");
+    const int       k_NUM_POPPERS = 3;
+    bsls::AtomicInt numPopped(0);
+
+    bsl::vector<bslmt::ThreadUtil::Handle> poppers(
+        k_NUM_POPPERS,
+        bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_NUM_POPPERS; ++i) {
+        BMQTST_ASSERT_EQ_D(
+            i,
+            bslmt::ThreadUtil::createWithAllocator(
+                &poppers[i],
+                bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                                      &spinTestQueuePopper,
+                                      &obj,
+                                      &numPopped),
+                bmqtst::TestHelperUtil::allocator()),
+            0);
+    }
+
+    pushTimes.resize(k_NUM_POPPERS);
+    latencyTestQueuePusher(&obj,
+                           &pushTimes,
+                           k_NUM_POPPERS,
+                           10000);  // intervalUs
+
+    for (int i = 0; i < k_NUM_POPPERS; ++i) {
+        bslmt::ThreadUtil::join(poppers[i]);
+    }
+    BMQTST_ASSERT_EQ(numPopped.load(), k_NUM_POPPERS);
+}
+
 static void testN1_performance()
 // ------------------------------------------------------------------------
 // QUEUE - PERFORMANCE TEST
@@ -749,6 +1181,36 @@ static void testN1_performance()
                      &bufferFactory);
 }
 
+static void testN2_popLatency()
+// ------------------------------------------------------------------------
+// QUEUE - POP LATENCY TEST
+//
+// Concerns:
+//  a) Check the latency of delivering an event to a thread waiting for it,
+//     with and without busy polling.
+//
+// Plan:
+//  1) Create a bmqimp::EventQueue, push events to it at a low rate from one
+//     thread and pop them from another one, measuring the time between the
+//     push and the pop of each event.
+//  2) Report the percentiles of the measurements, blocking as soon as the
+//     queue is empty, and busy polling it instead.
+//
+// Testing:
+//  Performance
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("QUEUE - POP LATENCY TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+
+    popLatency(bsls::TimeInterval(), &bufferFactory);
+    popLatency(bsls::TimeInterval(0, 100 * 1000), &bufferFactory);
+    popLatency(bsls::TimeInterval(0, 1000 * 1000), &bufferFactory);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -761,6 +1223,8 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 8: test8_spinTime(); break;
+    case 7: test7_perQueueOrderedProcessing(); break;
     case 6: test6_workingStatsTest(); break;
     case 5: test5_emptyStatsTest(); break;
     case 4: test4_basicEventHandlerTest(); break;
@@ -768,6 +1232,7 @@ int main(int argc, char* argv[])
     case 2: test2_capacityTest(); break;
     case 1: test1_breathingTest(); break;
     case -1: testN1_performance(); break;
+    case -2: testN2_popLatency(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
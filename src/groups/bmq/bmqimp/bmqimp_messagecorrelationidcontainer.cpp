@@ -21,51 +21,74 @@
 #include <bmqp_protocol.h>
 #include <bmqp_protocolutil.h>
 #include <bmqp_queueid.h>
+#include <bmqst_statcontext.h>
+#include <bmqst_statutil.h>
 
 // BDE
+#include <bdlma_localsequentialallocator.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
+#include <bsls_assert.h>
 #include <bsls_performancehint.h>
 
 namespace BloombergLP {
 namespace bmqimp {
 
+namespace {
+/// Name of the stat context to create (holding the pending PUTs statistics)
+const char k_STAT_NAME[] = "pendingPuts";
+
+enum {
+    /// value = number of pending PUT messages
+    k_STAT_MESSAGE = 0,
+    /// value = size of the data of the pending PUT messages
+    k_STAT_BYTES = 1
+};
+}  // close unnamed namespace
+
 // ----------------------------------------------------------
 // class MessageCorrelationIdContainer::QueueAndCorrelationId
 // ----------------------------------------------------------
 
-MessageCorrelationIdContainer::QueueAndCorrelationId::QueueAndCorrelationId(
-    bslma::Allocator* allocator)
+MessageCorrelationIdContainer::QueueAndCorrelationId::QueueAndCorrelationId()
 : d_correlationId()
 , d_queueId(bmqp::QueueId::k_UNASSIGNED_QUEUE_ID)
 , d_messageType(bmqp::EventType::e_UNDEFINED)
-, d_messageData(allocator)
+, d_blob_sp()
+, d_messageDataPosition()
+, d_messageDataSize(0)
 {
     // NOTHING
 }
 
 MessageCorrelationIdContainer::QueueAndCorrelationId::QueueAndCorrelationId(
     const bmqt::CorrelationId& correlationId,
-    const bmqp::QueueId&       queueId,
-    bslma::Allocator*          allocator)
+    const bmqp::QueueId&       queueId)
 : d_correlationId(correlationId)
 , d_queueId(queueId)
 , d_messageType(bmqp::EventType::e_UNDEFINED)
-, d_messageData(allocator)
+, d_blob_sp()
+, d_messageDataPosition()
+, d_messageDataSize(0)
 {
     // NOTHING
 }
 
-MessageCorrelationIdContainer::QueueAndCorrelationId::QueueAndCorrelationId(
-    const MessageCorrelationIdContainer::QueueAndCorrelationId& other,
-    bslma::Allocator*                                           allocator)
-: d_correlationId(other.d_correlationId)
-, d_queueId(other.d_queueId)
-, d_messageType(other.d_messageType)
-, d_messageData(other.d_messageData, allocator)
-, d_requestContext(other.d_requestContext)
+int MessageCorrelationIdContainer::QueueAndCorrelationId::loadMessageData(
+    bdlbb::Blob* blob) const
 {
-    // NOTHING
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(blob);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_blob_sp)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return -1;  // RETURN
+    }
+
+    return bmqu::BlobUtil::appendToBlob(blob,
+                                        *d_blob_sp,
+                                        d_messageDataPosition,
+                                        d_messageDataSize);
 }
 
 // -----------------------------------
@@ -107,6 +130,8 @@ MessageCorrelationIdContainer::MessageCorrelationIdContainer(
 , d_queueItems(allocator)
 , d_numPuts(0)
 , d_numControls(0)
+, d_numPutBytes(0)
+, d_stat(allocator)
 , d_allocator_p(allocator)
 {
     // NOTHING
@@ -115,8 +140,17 @@ MessageCorrelationIdContainer::MessageCorrelationIdContainer(
 void MessageCorrelationIdContainer::reset()
 {
     bsls::SpinLockGuard guard(&d_lock);  // LOCK
+
+    if (d_stat.d_statContext_mp) {
+        d_stat.d_statContext_mp->adjustValue(
+            k_STAT_MESSAGE,
+            -static_cast<bsls::Types::Int64>(d_numPuts));
+        d_stat.d_statContext_mp->adjustValue(k_STAT_BYTES, -d_numPutBytes);
+    }
+
     d_numPuts     = 0;
     d_numControls = 0;
+    d_numPutBytes = 0;
     d_correlationIds.clear();
     d_queueItems.clear();
 }
@@ -128,22 +162,26 @@ void MessageCorrelationIdContainer::add(
 {
     bsls::SpinLockGuard guard(&d_lock);  // LOCK
 
-    QueueAndCorrelationId toInsert(correlationId, queueId, d_allocator_p);
+    QueueAndCorrelationId toInsert(correlationId, queueId);
     d_correlationIds.insert(bsl::make_pair(key, toInsert));
 }
 
 bmqt::MessageGUID MessageCorrelationIdContainer::add(
     const RequestManagerType::RequestSp& context,
     const bmqp::QueueId&                 queueId,
-    const bdlbb::Blob&                   blob)
+    const ConstBlobSp&                   blob)
 {
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(blob);
+
     bsls::SpinLockGuard guard(&d_lock);  // LOCK
 
-    QueueAndCorrelationId toInsert(d_allocator_p);
-    toInsert.d_messageType    = bmqp::EventType::e_CONTROL;
-    toInsert.d_requestContext = context;
-    toInsert.d_queueId        = queueId;
-    toInsert.d_messageData    = blob;
+    QueueAndCorrelationId toInsert;
+    toInsert.d_messageType     = bmqp::EventType::e_CONTROL;
+    toInsert.d_requestContext  = context;
+    toInsert.d_queueId         = queueId;
+    toInsert.d_blob_sp         = blob;
+    toInsert.d_messageDataSize = blob->length();
 
     // Use internal GUID as a key to add the control message
     bmqt::MessageGUID key = bmqp::MessageGUIDGenerator::testGUID();
@@ -162,6 +200,13 @@ MessageCorrelationIdContainer::removeLocked(
     if (cit->second.d_messageType == bmqp::EventType::e_PUT) {
         BSLS_ASSERT_SAFE(d_numPuts > 0);
         --d_numPuts;
+        d_numPutBytes -= cit->second.d_messageDataSize;
+        if (d_stat.d_statContext_mp) {
+            d_stat.d_statContext_mp->adjustValue(k_STAT_MESSAGE, -1);
+            d_stat.d_statContext_mp->adjustValue(
+                k_STAT_BYTES,
+                -cit->second.d_messageDataSize);
+        }
         const bool isAckRequested = bmqp::PutHeaderFlagUtil::isSet(
             cit->second.d_header.flags(),
             bmqp::PutHeaderFlags::e_ACK_REQUESTED);
@@ -202,9 +247,15 @@ int MessageCorrelationIdContainer::remove(const bmqt::MessageGUID& key,
 
 void MessageCorrelationIdContainer::associateMessageData(
     const bmqp::PutHeader&    header,
-    const bdlbb::Blob&        appData,
+    const ConstBlobSp&        event,
+    const bmqu::BlobPosition& appDataPosition,
+    int                       appDataSize,
     const bsls::TimeInterval& sentTime)
 {
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(event);
+    BSLS_ASSERT_SAFE(appDataSize > 0);
+
     bsls::SpinLockGuard guard(&d_lock);  // LOCK
 
     CorrelationIdsMap::iterator it = d_correlationIds.find(
@@ -215,11 +266,18 @@ void MessageCorrelationIdContainer::associateMessageData(
         return;  // RETURN
     }
     bmqp::QueueId qid(header.queueId());
-    it->second.d_messageType = bmqp::EventType::e_PUT;
-    it->second.d_header      = header;
-    it->second.d_messageData = appData;
-    it->second.d_queueId     = qid;
+    it->second.d_messageType         = bmqp::EventType::e_PUT;
+    it->second.d_header              = header;
+    it->second.d_blob_sp             = event;
+    it->second.d_messageDataPosition = appDataPosition;
+    it->second.d_messageDataSize     = appDataSize;
+    it->second.d_queueId             = qid;
     ++d_numPuts;
+    d_numPutBytes += appDataSize;
+    if (d_stat.d_statContext_mp) {
+        d_stat.d_statContext_mp->adjustValue(k_STAT_MESSAGE, 1);
+        d_stat.d_statContext_mp->adjustValue(k_STAT_BYTES, appDataSize);
+    }
 
     const bool isAckRequested = bmqp::PutHeaderFlagUtil::isSet(
         header.flags(),
@@ -231,6 +289,76 @@ void MessageCorrelationIdContainer::associateMessageData(
     }
 }
 
+void MessageCorrelationIdContainer::initializeStats(
+    bmqst::StatContext*                       rootStatContext,
+    const bmqst::StatValue::SnapshotLocation& start,
+    const bmqst::StatValue::SnapshotLocation& end)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(!d_stat.d_statContext_mp && "Stats already initialized");
+
+    bdlma::LocalSequentialAllocator<2048> localAllocator(d_allocator_p);
+
+    // Create the stat context
+    // -----------------------
+    bmqst::StatContextConfiguration config(k_STAT_NAME, &localAllocator);
+    config.value("message").value("bytes");
+    d_stat.d_statContext_mp = rootStatContext->addSubcontext(config);
+
+    // Create table (with Delta stats)
+    // -------------------------------
+    bmqst::TableSchema& schema = d_stat.d_table.schema();
+    schema.addColumn("messages",
+                     k_STAT_MESSAGE,
+                     bmqst::StatUtil::value,
+                     start);
+    schema.addColumn("messages_max",
+                     k_STAT_MESSAGE,
+                     bmqst::StatUtil::rangeMax,
+                     start,
+                     end);
+    schema.addColumn("bytes", k_STAT_BYTES, bmqst::StatUtil::value, start);
+    schema.addColumn("bytes_max",
+                     k_STAT_BYTES,
+                     bmqst::StatUtil::rangeMax,
+                     start,
+                     end);
+    schema.addColumn("bytes_absmax",
+                     k_STAT_BYTES,
+                     bmqst::StatUtil::absoluteMax);
+
+    // Configure records
+    d_stat.d_table.records().setContext(d_stat.d_statContext_mp.get());
+
+    // Create the tip
+    d_stat.d_tip.setTable(&d_stat.d_table);
+    d_stat.d_tip.setColumnGroup("Pending PUTs");
+    d_stat.d_tip.addColumn("messages", "Messages").zeroString("");
+    d_stat.d_tip.addColumn("messages_max", "Max").zeroString("");
+    d_stat.d_tip.addColumn("bytes", "Bytes").zeroString("").printAsMemory();
+    d_stat.d_tip.addColumn("bytes_max", "Max").zeroString("").printAsMemory();
+    d_stat.d_tip.addColumn("bytes_absmax", "Abs. Max")
+        .zeroString("")
+        .printAsMemory();
+
+    // Create the table (without Delta stats)
+    // --------------------------------------
+    bmqst::TableSchema& schemaNoDelta = d_stat.d_tableNoDelta.schema();
+    schemaNoDelta.addColumn("bytes_absmax",
+                            k_STAT_BYTES,
+                            bmqst::StatUtil::absoluteMax);
+
+    // Configure records
+    d_stat.d_tableNoDelta.records().setContext(d_stat.d_statContext_mp.get());
+
+    // Create the tip
+    d_stat.d_tipNoDelta.setTable(&d_stat.d_tableNoDelta);
+    d_stat.d_tipNoDelta.setColumnGroup("Pending PUTs");
+    d_stat.d_tipNoDelta.addColumn("bytes_absmax", "Abs. Max Bytes")
+        .zeroString("")
+        .printAsMemory();
+}
+
 bool MessageCorrelationIdContainer::iterateAndInvoke(const KeyIdsCb& callback)
 {
     bsls::SpinLockGuard guard(&d_lock);  // LOCK
@@ -28,11 +28,19 @@
 // is returned which can be used later on to assign the 'queueId' as well as
 // retrieve and remove the 'correlationId'.
 //
+// The container also keeps the data of the pending PUT messages and control
+// requests, so that they can be retransmitted.  The data is not copied: each
+// item refers to the blob it was sent in (for a PUT message, the whole PUT
+// event), which is kept alive until the item is removed.  The number and size
+// of the pending PUT messages are reported in a stat context when
+// 'initializeStats' has been called.
+//
 /// Thread Safety
 ///-------------
 // Thread safe.
 
 // BMQ
+#include <bmqimp_stat.h>
 #include <bmqp_protocol.h>
 #include <bmqp_queueid.h>
 #include <bmqp_requestmanager.h>
@@ -40,15 +48,22 @@
 #include <bmqt_messageguid.h>
 
 #include <bmqc_orderedhashmap.h>
+#include <bmqst_statcontext.h>
+#include <bmqst_statvalue.h>
+#include <bmqu_blob.h>
 
 // BDE
+#include <bdlbb_blob.h>
 #include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_ostream.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_cpp11.h>
 #include <bsls_spinlock.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace bmqimp {
@@ -66,6 +81,8 @@ class MessageCorrelationIdContainer {
                                  bmqp_ctrlmsg::ControlMessage>
         RequestManagerType;
 
+    typedef bsl::shared_ptr<const bdlbb::Blob> ConstBlobSp;
+
     /// Struct representing the correlationId and queueId for a given
     /// message.
     struct QueueAndCorrelationId {
@@ -81,27 +98,32 @@ class MessageCorrelationIdContainer {
         bmqp::PutHeader d_header;
         // PUT message header.
 
-        bdlbb::Blob d_messageData;
-        // Message data.
+        ConstBlobSp d_blob_sp;
+        // Blob holding the message data: the PUT event the message was
+        // posted in, or the control request.
+
+        bmqu::BlobPosition d_messageDataPosition;
+        // Position of the message data in 'd_blob_sp'.
+
+        int d_messageDataSize;
+        // Size of the message data.
 
         RequestManagerType::RequestSp d_requestContext;
         // Control request context.
 
-        /// Create a `QueueAndCorrelationId` having an invalid queueId and
-        /// empty correlationId using the specified `allocator`.
-        QueueAndCorrelationId(bslma::Allocator* allocator);
+        /// Create a `QueueAndCorrelationId` having an invalid queueId,
+        /// empty correlationId and no message data.
+        QueueAndCorrelationId();
 
         /// Create a `QueueAndCorrelationId` having the specified `queueId`
-        /// and the specified `correlationId` using the specified
-        /// `allocator`.
+        /// and the specified `correlationId`, and no message data.
         QueueAndCorrelationId(const bmqt::CorrelationId& correlationId,
-                              const bmqp::QueueId&       queueId,
-                              bslma::Allocator*          allocator);
+                              const bmqp::QueueId&       queueId);
 
-        /// Copy constructor from the specified `other` using the specified
-        /// `allocator`.
-        QueueAndCorrelationId(const QueueAndCorrelationId& other,
-                              bslma::Allocator*            allocator);
+        /// Append the message data to the specified `blob`, sharing the
+        /// buffers of the blob holding it.  Return 0 on success, or a
+        /// non-zero value if there is no message data.
+        int loadMessageData(bdlbb::Blob* blob) const;
     };
 
     /// Callback signature for iterating over all elements in the container.
@@ -140,6 +162,13 @@ class MessageCorrelationIdContainer {
     size_t d_numControls;
     // Number of pending control requests.
 
+    bsls::Types::Int64 d_numPutBytes;
+    // Size of the data of the pending PUT
+    // messages.
+
+    Stat d_stat;
+    // Stats of the pending PUT messages.
+
     bslma::Allocator* d_allocator_p;
     // Allocator to use.
 
@@ -203,10 +232,11 @@ class MessageCorrelationIdContainer {
              const bmqp::QueueId&       queueId);
 
     /// Add the specified `context` and the `blob` and return a GUID key
-    /// that can be used to retrieve it later.
+    /// that can be used to retrieve it later.  The `blob` is shared, not
+    /// copied.
     bmqt::MessageGUID add(const RequestManagerType::RequestSp& context,
                           const bmqp::QueueId&                 queueId,
-                          const bdlbb::Blob&                   blob);
+                          const ConstBlobSp&                   blob);
 
     /// Remove the item uniquely identified by the specified `key`,
     /// and populate the optionally specified `correlationId` with the
@@ -215,14 +245,28 @@ class MessageCorrelationIdContainer {
     int remove(const bmqt::MessageGUID& key,
                bmqt::CorrelationId*     correlationId = 0);
 
-    /// Associate the specified message data to the item having the key
-    /// equals to the GUID from the specified PUT `header`.  The behavior is
-    /// undefined if the GUID does not correspond to a previously registered
-    /// item.
+    /// Associate the message data of the specified `appDataSize` at the
+    /// specified `appDataPosition` in the specified `event` to the item
+    /// having the key equals to the GUID from the specified PUT `header`.
+    /// The `event` is shared, not copied, until the item is removed.  The
+    /// behavior is undefined if the GUID does not correspond to a
+    /// previously registered item.
     void associateMessageData(const bmqp::PutHeader&    header,
-                              const bdlbb::Blob&        appData,
+                              const ConstBlobSp&        event,
+                              const bmqu::BlobPosition& appDataPosition,
+                              int                       appDataSize,
                               const bsls::TimeInterval& sentTime);
 
+    /// Create the stat context, table and tips for the stats of the pending
+    /// PUT messages, as a subcontext of the specified `rootStatContext`.
+    /// Delta stats correspond to stats between the specified `start` and
+    /// `end` snapshot locations.  The behavior is undefined if this method
+    /// is called more than once on the same object.
+    void
+    initializeStats(bmqst::StatContext*                       rootStatContext,
+                    const bmqst::StatValue::SnapshotLocation& start,
+                    const bmqst::StatValue::SnapshotLocation& end);
+
     // ACCESSORS
 
     /// Iterate and invoke the specified `callback` on every inserted item.
@@ -259,6 +303,15 @@ class MessageCorrelationIdContainer {
 
     /// Return the current number of control requests in the container.
     size_t numberOfControls() const;
+
+    /// Return the size of the data of the PUT messages in the container.
+    bsls::Types::Int64 numberOfPutBytes() const;
+
+    /// Print the stats of the pending PUT messages to the specified
+    /// `stream`; print the `delta` stats columns if the specified
+    /// `includeDelta` is true.  The behavior is undefined unless
+    /// `initializeStats` has been called.
+    void printStats(bsl::ostream& stream, bool includeDelta) const;
 };
 
 // ============================================================================
@@ -284,6 +337,19 @@ inline size_t MessageCorrelationIdContainer::numberOfControls() const
     return d_numControls;
 }
 
+inline bsls::Types::Int64
+MessageCorrelationIdContainer::numberOfPutBytes() const
+{
+    return d_numPutBytes;
+}
+
+inline void
+MessageCorrelationIdContainer::printStats(bsl::ostream& stream,
+                                          bool          includeDelta) const
+{
+    d_stat.printStats(stream, includeDelta);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
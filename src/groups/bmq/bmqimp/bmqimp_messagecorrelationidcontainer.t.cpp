@@ -17,16 +17,32 @@
 
 // BMQ
 #include <bmqimp_queue.h>
+#include <bmqp_blobpoolutil.h>
+#include <bmqp_event.h>
 #include <bmqp_messageguidgenerator.h>
+#include <bmqp_protocol.h>
+#include <bmqp_puteventbuilder.h>
+#include <bmqp_putmessageiterator.h>
 #include <bmqt_correlationid.h>
 #include <bmqt_messageguid.h>
+#include <bmqt_resultcode.h>
+#include <bmqu_blob.h>
+#include <bmqu_printutil.h>
+#include <bmqu_time.h>
 
 // BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlf_bind.h>
 #include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
 #include <bsl_unordered_map.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
+#include <bslma_testallocator.h>
+#include <bsls_types.h>
 
 // TEST DRIVER
 #include <bmqtst_testhelper.h>
@@ -216,6 +232,295 @@ static void test3_associate()
     }
 }
 
+static void test4_messageData()
+// ------------------------------------------------------------------------
+// MESSAGE DATA
+//
+// Concerns:
+//   1. The data of a PUT message refers to the event it was posted in,
+//      which is kept alive until the message is removed.
+//   2. The number and size of the pending PUT messages are maintained.
+//   3. A control request refers to its blob.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("MESSAGE DATA");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+
+    bmqimp::MessageCorrelationIdContainer container(
+        bmqtst::TestHelperUtil::allocator());
+    IterateAndInvokeHelper helper(bmqtst::TestHelperUtil::allocator());
+
+    Callback callback = bdlf::BindUtil::bind(
+        &IterateAndInvokeHelper::insertIntoMap,
+        &helper,
+        bdlf::PlaceHolders::_1,
+        bdlf::PlaceHolders::_2,
+        bdlf::PlaceHolders::_3);
+
+    const char              k_PAYLOAD[]   = "abcdefghijklmnopqrstuvwxyz";
+    const int               k_PAYLOAD_LEN = sizeof(k_PAYLOAD) - 1;
+    const bmqt::MessageGUID guid1 = bmqp::MessageGUIDGenerator::testGUID();
+    const bmqt::MessageGUID guid2 = bmqp::MessageGUIDGenerator::testGUID();
+    const bmqt::MessageGUID guids[] = {guid1, guid2};
+
+    bsl::weak_ptr<const bdlbb::Blob> weakEvent;
+
+    {
+        bmqp::PutEventBuilder builder(blobSpPool.get(),
+                                      bmqtst::TestHelperUtil::allocator());
+        for (int i = 0; i < 2; ++i) {
+            builder.startMessage();
+            builder.setMessagePayload(k_PAYLOAD, k_PAYLOAD_LEN)
+                .setMessageGUID(guids[i])
+                .setFlags(bmqp::PutHeaderFlags::e_ACK_REQUESTED);
+            BMQTST_ASSERT_EQ(builder.packMessage(1),
+                             bmqt::EventBuilderResult::e_SUCCESS);
+        }
+
+        const bsl::shared_ptr<const bdlbb::Blob> event_sp = builder.blob();
+        weakEvent                                         = event_sp;
+
+        bmqp::Event              event(event_sp,
+                          bmqtst::TestHelperUtil::allocator());
+        bmqp::PutMessageIterator putIter(&bufferFactory,
+                                         bmqtst::TestHelperUtil::allocator());
+        event.loadPutMessageIterator(&putIter);
+        BMQTST_ASSERT(putIter.isValid());
+
+        while (putIter.next() == 1) {
+            bmqu::BlobPosition position;
+            BMQTST_ASSERT_EQ(putIter.loadApplicationDataPosition(&position),
+                             0);
+
+            container.add(putIter.header().messageGUID(),
+                          bmqt::CorrelationId(1),
+                          bmqp::QueueId(1));
+            container.associateMessageData(putIter.header(),
+                                           event_sp,
+                                           position,
+                                           putIter.applicationDataSize(),
+                                           bsls::TimeInterval(0));
+        }
+    }
+
+    {
+        PVV("PUT messages refer to the event");
+        BMQTST_ASSERT(!weakEvent.expired());
+        BMQTST_ASSERT_EQ(container.numberOfPuts(), 2U);
+        BMQTST_ASSERT_EQ(container.numberOfPutBytes(), 2 * k_PAYLOAD_LEN);
+
+        container.iterateAndInvoke(callback);
+        const QAC& qac = helper.d_corrIdMap[guid1];
+        BMQTST_ASSERT_EQ(qac.d_messageType, bmqp::EventType::e_PUT);
+        BMQTST_ASSERT_EQ(qac.d_messageDataSize, k_PAYLOAD_LEN);
+
+        bdlbb::Blob data(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(qac.loadMessageData(&data), 0);
+        BMQTST_ASSERT_EQ(data.length(), k_PAYLOAD_LEN);
+
+        bsl::string payload(bmqtst::TestHelperUtil::allocator());
+        payload.resize(k_PAYLOAD_LEN);
+        bmqu::BlobUtil::copyToRawBufferFromIndex(&payload[0],
+                                                 data,
+                                                 0,
+                                                 0,
+                                                 k_PAYLOAD_LEN);
+        BMQTST_ASSERT_EQ(payload, k_PAYLOAD);
+
+        helper.d_corrIdMap.clear();
+    }
+
+    {
+        PVV("Removing the PUT messages releases the event");
+        BMQTST_ASSERT_EQ(container.remove(guid1), 0);
+        BMQTST_ASSERT(!weakEvent.expired());
+        BMQTST_ASSERT_EQ(container.numberOfPutBytes(), k_PAYLOAD_LEN);
+
+        BMQTST_ASSERT_EQ(container.remove(guid2), 0);
+        BMQTST_ASSERT(weakEvent.expired());
+        BMQTST_ASSERT_EQ(container.numberOfPuts(), 0U);
+        BMQTST_ASSERT_EQ(container.numberOfPutBytes(), 0);
+    }
+
+    {
+        PVV("Control requests refer to their blob");
+        bsl::shared_ptr<bdlbb::Blob> blob_sp =
+            bsl::allocate_shared<bdlbb::Blob>(
+                bmqtst::TestHelperUtil::allocator(),
+                &bufferFactory,
+                bmqtst::TestHelperUtil::allocator());
+        bdlbb::BlobUtil::append(blob_sp.get(), k_PAYLOAD, k_PAYLOAD_LEN);
+
+        bmqimp::MessageCorrelationIdContainer::RequestManagerType::RequestSp
+            context;
+        const bmqt::MessageGUID guid = container.add(context,
+                                                     bmqp::QueueId(1),
+                                                     blob_sp);
+        BMQTST_ASSERT_EQ(container.numberOfControls(), 1U);
+        BMQTST_ASSERT_EQ(container.numberOfPutBytes(), 0);
+
+        container.iterateAndInvoke(callback);
+        const QAC& qac = helper.d_corrIdMap[guid];
+        BMQTST_ASSERT_EQ(qac.d_messageType, bmqp::EventType::e_CONTROL);
+        BMQTST_ASSERT_EQ(qac.d_blob_sp.get(), blob_sp.get());
+        BMQTST_ASSERT_EQ(qac.d_messageDataSize, k_PAYLOAD_LEN);
+    }
+}
+
+static void testN1_pendingPutsPerformance()
+// ------------------------------------------------------------------------
+// PENDING PUTS PERFORMANCE
+//
+// Concerns:
+//   Measure the cost of keeping PUT messages with ACK requested for
+//   retransmission, as the session does for every message it posts.
+//
+// Plan:
+//   - Post 1M messages of 1KB, in events of 100 messages, keeping each
+//     message in the container and removing the messages of an event
+//     (as if they were ACKed) once the next event has been posted.
+//   - Report the allocations and bytes allocated per message by the
+//     container, and the bytes of message data copied, alongside the
+//     allocations a copy of the message data into its own blob (without
+//     copying the bytes) would add.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PENDING PUTS PERFORMANCE");
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const int k_NUM_MESSAGES = 1000 * 1000;
+    const int k_EVENT_SIZE   = 100;
+    const int k_PAYLOAD_SIZE = 1024;
+    const int k_NUM_EVENTS   = k_NUM_MESSAGES / k_EVENT_SIZE;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        4 * 1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+
+    bslma::TestAllocator                  containerAllocator("container");
+    bslma::TestAllocator                  copyAllocator("copy");
+    bmqimp::MessageCorrelationIdContainer container(&containerAllocator);
+    bmqp::MessageGUIDGenerator            guidGenerator(0, false);
+    bmqp::PutEventBuilder                 builder(
+        blobSpPool.get(),
+        bmqtst::TestHelperUtil::allocator());
+    bsl::vector<bmqt::MessageGUID> previousGuids(
+        bmqtst::TestHelperUtil::allocator());
+    bsl::vector<bmqt::MessageGUID> guids(bmqtst::TestHelperUtil::allocator());
+    const bsl::string              payload(k_PAYLOAD_SIZE,
+                              'x',
+                              bmqtst::TestHelperUtil::allocator());
+
+    bsls::Types::Int64 numCopyAllocations = 0;
+    bsls::Types::Int64 maxPutBytes        = 0;
+    bsls::Types::Int64 elapsed            = 0;
+
+    const bsls::Types::Int64 numAllocationsBegin =
+        containerAllocator.numAllocations();
+    const bsls::Types::Int64 numBytesBegin =
+        containerAllocator.numBytesTotal();
+
+    for (int e = 0; e < k_NUM_EVENTS; ++e) {
+        // Build the event (not measured)
+        builder.reset();
+        guids.clear();
+        for (int i = 0; i < k_EVENT_SIZE; ++i) {
+            bmqt::MessageGUID guid;
+            guidGenerator.generateGUID(&guid);
+            guids.push_back(guid);
+
+            builder.startMessage();
+            builder.setMessagePayload(payload.data(), k_PAYLOAD_SIZE)
+                .setMessageGUID(guid)
+                .setFlags(bmqp::PutHeaderFlags::e_ACK_REQUESTED);
+            builder.packMessage(1);
+        }
+
+        const bsl::shared_ptr<const bdlbb::Blob> event_sp = builder.blob();
+        bmqp::Event              event(event_sp,
+                          bmqtst::TestHelperUtil::allocator());
+        bmqp::PutMessageIterator putIter(&bufferFactory,
+                                         bmqtst::TestHelperUtil::allocator());
+        event.loadPutMessageIterator(&putIter);
+
+        // Keep the messages of the event, as the session does when posting
+        // it.
+        const bsls::Types::Int64 begin = bmqu::Time::highResolutionTimer();
+        while (putIter.next() == 1) {
+            bmqu::BlobPosition position;
+            putIter.loadApplicationDataPosition(&position);
+
+            container.add(putIter.header().messageGUID(),
+                          bmqt::CorrelationId(),
+                          bmqp::QueueId(1));
+            container.associateMessageData(putIter.header(),
+                                           event_sp,
+                                           position,
+                                           putIter.applicationDataSize(),
+                                           bsls::TimeInterval(0));
+        }
+        maxPutBytes = bsl::max(maxPutBytes, container.numberOfPutBytes());
+
+        // ACK the messages of the previous event.
+        for (size_t i = 0; i < previousGuids.size(); ++i) {
+            container.remove(previousGuids[i]);
+        }
+        elapsed += bmqu::Time::highResolutionTimer() - begin;
+        previousGuids.swap(guids);
+
+        // Baseline: copy the message data into its own blob (sharing the
+        // buffers of the event), and that blob into the container's item.
+        event.loadPutMessageIterator(&putIter);
+        const bsls::Types::Int64 numAllocations =
+            copyAllocator.numAllocations();
+        while (putIter.next() == 1) {
+            bdlbb::Blob appData(&bufferFactory, &copyAllocator);
+            putIter.loadApplicationData(&appData);
+            bdlbb::Blob item(&copyAllocator);
+            item = appData;
+        }
+        numCopyAllocations += copyAllocator.numAllocations() - numAllocations;
+    }
+
+    for (size_t i = 0; i < previousGuids.size(); ++i) {
+        container.remove(previousGuids[i]);
+    }
+    BMQTST_ASSERT_EQ(container.size(), 0U);
+
+    const bsls::Types::Int64 numAllocations =
+        containerAllocator.numAllocations() - numAllocationsBegin;
+    const bsls::Types::Int64 numBytes = containerAllocator.numBytesTotal() -
+                                        numBytesBegin;
+
+    cout << k_NUM_MESSAGES << " messages of " << k_PAYLOAD_SIZE
+         << " bytes kept for retransmission in "
+         << bmqu::PrintUtil::prettyTimeInterval(elapsed) << " ("
+         << bmqu::PrintUtil::prettyTimeInterval(elapsed / k_NUM_MESSAGES)
+         << " per message).\n"
+         << "  per message: "
+         << static_cast<double>(numAllocations) / k_NUM_MESSAGES
+         << " allocations, "
+         << static_cast<double>(numBytes) / k_NUM_MESSAGES
+         << " bytes allocated, 0 bytes of message data copied\n"
+         << "  copying the message data into a blob would add "
+         << static_cast<double>(numCopyAllocations) / k_NUM_MESSAGES
+         << " allocations per message\n"
+         << "  max size of pending messages: "
+         << bmqu::PrintUtil::prettyBytes(maxPutBytes) << "\n";
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -226,9 +531,11 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 4: test4_messageData(); break;
     case 3: test3_associate(); break;
     case 2: test2_iterateAndInvoke(); break;
     case 1: test1_addFindRemove(); break;
+    case -1: testN1_pendingPutsPerformance(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
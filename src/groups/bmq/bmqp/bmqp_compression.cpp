@@ -22,11 +22,23 @@
 // BDE
 #include <bdlbb_blobutil.h>
 #include <bdlma_sequentialallocator.h>
+#include <bsl_cstring.h>
 #include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_once.h>
+#include <bsls_objectbuffer.h>
+
+// LZ4
+#include <lz4frame.h>
 
 // ZLIB
 #include <zlib.h>
 
+// ZSTD
+#include <zstd.h>
+
 // MemorySanitizer
 #if defined(__has_feature)
 #if __has_feature(memory_sanitizer)
@@ -332,6 +344,322 @@ int ZLib::writeOutput(bdlbb::Blob*              output,
     return rc_SUCCESS;
 }
 
+// ================
+// class BlobOutput
+// ================
+
+/// Mechanism accumulating into a blob the output of a streaming
+/// decompression, one buffer supplied by a factory at a time.
+class BlobOutput {
+  private:
+    // DATA
+
+    // Blob to append the output to.
+    bdlbb::Blob* d_blob_p;
+
+    // Factory supplying the buffers of the output.
+    bdlbb::BlobBufferFactory* d_factory_p;
+
+    // Buffer being filled, not yet appended to 'd_blob_p'.
+    bdlbb::BlobBuffer d_buffer;
+
+    // Number of bytes written in 'd_buffer'.
+    int d_position;
+
+    // Total number of bytes written.
+    bsls::Types::Uint64 d_length;
+
+  private:
+    // NOT IMPLEMENTED
+    BlobOutput(const BlobOutput&);
+    BlobOutput& operator=(const BlobOutput&);
+
+  public:
+    // CREATORS
+
+    /// Create an object appending the output to the specified `blob`,
+    /// using the specified `factory` to supply its buffers.
+    BlobOutput(bdlbb::Blob* blob, bdlbb::BlobBufferFactory* factory);
+
+    // MANIPULATORS
+
+    /// Return the address of the free space of the buffer being filled,
+    /// and load its size, which is non-zero, into the specified `capacity`.
+    /// If the buffer being filled is full, append it to the blob and
+    /// allocate a new one beforehand.
+    char* reserve(size_t* capacity);
+
+    /// Mark the specified `numBytes` at the beginning of the space returned
+    /// by the last call to `reserve` as written.
+    void commit(size_t numBytes);
+
+    /// Append the part of the buffer being filled that has been written, if
+    /// any, to the blob.
+    void finalize();
+
+    // ACCESSORS
+
+    /// Return the total number of bytes written.
+    bsls::Types::Uint64 length() const;
+};
+
+BlobOutput::BlobOutput(bdlbb::Blob* blob, bdlbb::BlobBufferFactory* factory)
+: d_blob_p(blob)
+, d_factory_p(factory)
+, d_buffer()
+, d_position(0)
+, d_length(0)
+{
+    // NOTHING
+}
+
+char* BlobOutput::reserve(size_t* capacity)
+{
+    if (d_position == d_buffer.size()) {
+        if (d_position != 0) {
+            d_blob_p->appendDataBuffer(d_buffer);
+        }
+        d_factory_p->allocate(&d_buffer);
+        d_position = 0;
+    }
+
+    *capacity = d_buffer.size() - d_position;
+    return d_buffer.data() + d_position;
+}
+
+void BlobOutput::commit(size_t numBytes)
+{
+    d_position += static_cast<int>(numBytes);
+    d_length += numBytes;
+}
+
+void BlobOutput::finalize()
+{
+    if (d_position != 0) {
+        d_buffer.setSize(d_position);
+        d_blob_p->appendDataBuffer(d_buffer);
+        d_buffer.reset();
+        d_position = 0;
+    }
+}
+
+bsls::Types::Uint64 BlobOutput::length() const
+{
+    return d_length;
+}
+
+/// Return a buffer of the specified `size` bytes, using the specified
+/// `allocator` to supply memory.
+bdlbb::BlobBuffer allocateBuffer(size_t size, bslma::Allocator* allocator)
+{
+    return bdlbb::BlobBuffer(
+        bslstl::SharedPtrUtil::createInplaceUninitializedBuffer(
+            size,
+            bslma::Default::allocator(allocator)),
+        static_cast<int>(size));
+}
+
+/// If the specified `stream` is non-zero, output the specified
+/// `baseMessage`.  Optionally specify an output `message` to follow it.  If
+/// `message` is 0, no additional output is generated.
+void setError(bsl::ostream*            stream,
+              const bslstl::StringRef& baseMessage,
+              const char*              message = 0)
+{
+    if (stream) {
+        (*stream) << baseMessage;
+        if (message) {
+            (*stream) << ", Message: " << message;
+        }
+    }
+}
+
+// ==========
+// struct Lz4
+// ==========
+
+/// This struct provides the utilities for enabling compression using the
+/// LZ4 frame format.
+struct Lz4 {
+    // TYPES
+
+    /// Proctor freeing an LZ4 decompression context on destruction.
+    struct DecompressionContextGuard {
+        LZ4F_dctx* d_context_p;
+
+        ~DecompressionContextGuard()
+        {
+            LZ4F_freeDecompressionContext(d_context_p);
+        }
+    };
+};
+
+// ===========
+// struct Zstd
+// ===========
+
+/// This struct provides the utilities for enabling compression using the
+/// Zstandard frame format.
+struct Zstd {
+    // CLASS METHODS
+
+    /// Return a new compression context, or 0 if it could not be created.
+    static ZSTD_CCtx* create(ZSTD_CCtx*);
+
+    /// Return a new decompression context, or 0 if it could not be created.
+    static ZSTD_DCtx* create(ZSTD_DCtx*);
+
+    /// Free the specified compression `context`.
+    static void destroy(ZSTD_CCtx* context);
+
+    /// Free the specified decompression `context`.
+    static void destroy(ZSTD_DCtx* context);
+};
+
+ZSTD_CCtx* Zstd::create(ZSTD_CCtx*)
+{
+    return ZSTD_createCCtx();
+}
+
+ZSTD_DCtx* Zstd::create(ZSTD_DCtx*)
+{
+    return ZSTD_createDCtx();
+}
+
+void Zstd::destroy(ZSTD_CCtx* context)
+{
+    ZSTD_freeCCtx(context);
+}
+
+void Zstd::destroy(ZSTD_DCtx* context)
+{
+    ZSTD_freeDCtx(context);
+}
+
+// ==================
+// class ContextCache
+// ==================
+
+/// Mechanism keeping up to `k_CAPACITY` Zstandard contexts of the
+/// parameterized `CONTEXT` type for reuse across calls and threads.
+/// Creating a context allocates and initializes in the order of a hundred
+/// kilobytes, which would otherwise dominate the cost of compressing or
+/// decompressing a typical message.
+template <class CONTEXT>
+class ContextCache {
+  private:
+    // PRIVATE CONSTANTS
+    enum { k_CAPACITY = 16 };
+
+    // DATA
+
+    // Protects the cached contexts.
+    bslmt::Mutex d_mutex;
+
+    // Cached contexts, in 'd_contexts[0 .. d_numContexts - 1]'.
+    CONTEXT* d_contexts[k_CAPACITY];
+
+    // Number of cached contexts.
+    int d_numContexts;
+
+  private:
+    // NOT IMPLEMENTED
+    ContextCache(const ContextCache&);
+    ContextCache& operator=(const ContextCache&);
+
+  public:
+    // CLASS METHODS
+
+    /// Return a reference to the process-wide cache of contexts of the
+    /// parameterized `CONTEXT` type.
+    static ContextCache& instance();
+
+    // CREATORS
+
+    /// Create an empty cache.
+    ContextCache();
+
+    // MANIPULATORS
+
+    /// Return a cached context, or a new one if the cache is empty, or 0 if
+    /// a new context could not be created.  Note that the returned context
+    /// may hold the state of the session it was last used for.
+    CONTEXT* acquire();
+
+    /// Return the specified `context` to the cache, or free it if the cache
+    /// is full.
+    void release(CONTEXT* context);
+};
+
+/// Proctor acquiring a context from a `ContextCache` on construction and
+/// returning it on destruction.
+template <class CONTEXT>
+struct ContextProctor {
+    // DATA
+    CONTEXT* d_context_p;
+
+    // CREATORS
+    ContextProctor()
+    : d_context_p(ContextCache<CONTEXT>::instance().acquire())
+    {
+    }
+
+    ~ContextProctor()
+    {
+        if (d_context_p) {
+            ContextCache<CONTEXT>::instance().release(d_context_p);
+        }
+    }
+};
+
+template <class CONTEXT>
+ContextCache<CONTEXT>& ContextCache<CONTEXT>::instance()
+{
+    // Never destroyed, so that contexts can be released by threads still
+    // running at exit.
+    static bsls::ObjectBuffer<ContextCache> cache;
+    BSLMT_ONCE_DO
+    {
+        new (cache.buffer()) ContextCache();
+    }
+    return cache.object();
+}
+
+template <class CONTEXT>
+ContextCache<CONTEXT>::ContextCache()
+: d_mutex()
+, d_numContexts(0)
+{
+    // NOTHING
+}
+
+template <class CONTEXT>
+CONTEXT* ContextCache<CONTEXT>::acquire()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        if (d_numContexts != 0) {
+            return d_contexts[--d_numContexts];  // RETURN
+        }
+    }
+
+    return Zstd::create(static_cast<CONTEXT*>(0));
+}
+
+template <class CONTEXT>
+void ContextCache<CONTEXT>::release(CONTEXT* context)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        if (d_numContexts != k_CAPACITY) {
+            d_contexts[d_numContexts++] = context;
+            return;  // RETURN
+        }
+    }
+
+    Zstd::destroy(context);
+}
+
 }  // close unnamed namespace
 
 // ==================
@@ -359,6 +687,18 @@ int Compression::compress(bdlbb::Blob*                         output,
                                               Z_DEFAULT_COMPRESSION,
                                               errorStream,
                                               allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_LZ4:
+        return Compression_Impl::compressLz4(output,
+                                             input,
+                                             0,  // default (fast) level
+                                             errorStream,
+                                             allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_ZSTD:
+        return Compression_Impl::compressZstd(output,
+                                              input,
+                                              ZSTD_CLEVEL_DEFAULT,
+                                              errorStream,
+                                              allocator);  // RETURN
     case bmqt::CompressionAlgorithmType::e_NONE:
         if (output->length() == 0) {
             *output = input;
@@ -389,7 +729,9 @@ int Compression::compress(bdlbb::Blob*                         output,
 
     bdlbb::Blob inputBlob(factory, allocator);
     switch (algorithm) {
-    case bmqt::CompressionAlgorithmType::e_ZLIB: {
+    case bmqt::CompressionAlgorithmType::e_ZLIB:
+    case bmqt::CompressionAlgorithmType::e_LZ4:
+    case bmqt::CompressionAlgorithmType::e_ZSTD: {
         bsl::shared_ptr<char> inputBufferSp(const_cast<char*>(input),
                                             bslstl::SharedPtrNilDeleter(),
                                             allocator);
@@ -399,12 +741,12 @@ int Compression::compress(bdlbb::Blob*                         output,
             inputBlob.appendDataBuffer(inputBlobBuffer);
         }
 
-        return Compression_Impl::compressZlib(output,
-                                              factory,
-                                              inputBlob,
-                                              Z_DEFAULT_COMPRESSION,
-                                              errorStream,
-                                              allocator);  // RETURN
+        return compress(output,
+                        factory,
+                        algorithm,
+                        inputBlob,
+                        errorStream,
+                        allocator);  // RETURN
     }
     case bmqt::CompressionAlgorithmType::e_NONE:
         // deep copy of input character array to output Blob
@@ -433,6 +775,18 @@ int Compression::decompress(bdlbb::Blob*                         output,
                                                 maxOutputSize,
                                                 errorStream,
                                                 allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_LZ4:
+        return Compression_Impl::decompressLz4(output,
+                                               factory,
+                                               input,
+                                               maxOutputSize,
+                                               errorStream);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_ZSTD:
+        return Compression_Impl::decompressZstd(output,
+                                                factory,
+                                                input,
+                                                maxOutputSize,
+                                                errorStream);  // RETURN
     case bmqt::CompressionAlgorithmType::e_NONE:
         if (output->length() == 0) {
             *output = input;
@@ -522,5 +876,356 @@ int Compression_Impl::decompressZlib(bdlbb::Blob*              output,
                              maxOutputSize);
 }
 
+int Compression_Impl::compressLz4(bdlbb::Blob*       output,
+                                  const bdlbb::Blob& input,
+                                  int                level,
+                                  bsl::ostream*      errorStream,
+                                  bslma::Allocator*  allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(output);
+
+    enum RcEnum { rc_SUCCESS = 0, rc_STREAM_PROCESS_FAILURE = -2 };
+
+    // The input is compressed at once, which requires neither a compression
+    // context nor the block staging buffers of the streaming API, both of
+    // which are heap allocated and would otherwise dominate the cost of
+    // compressing a small message.  Gather the input if it spans multiple
+    // buffers: copying is an order of magnitude faster than compressing.
+    const int         inputLength = input.length();
+    const char*       src         = 0;
+    bdlbb::BlobBuffer flatInput;
+    if (input.numDataBuffers() == 1) {
+        src = input.buffer(0).data();
+    }
+    else if (inputLength != 0) {
+        flatInput = allocateBuffer(inputLength, allocator);
+        bdlbb::BlobUtil::copy(flatInput.data(), input, 0, inputLength);
+        src = flatInput.data();
+    }
+
+    LZ4F_preferences_t preferences;
+    bsl::memset(&preferences, 0, sizeof(preferences));
+    preferences.frameInfo.contentSize = inputLength;
+    preferences.compressionLevel      = level;
+
+    // The frame bound accounts for the frame header, the worst case of every
+    // block being stored uncompressed and the end mark: the whole frame is
+    // written into a single buffer.
+    const size_t bound = LZ4F_compressFrameBound(inputLength, &preferences);
+    bdlbb::BlobBuffer outBuffer = allocateBuffer(bound, allocator);
+
+    const size_t rc = LZ4F_compressFrame(outBuffer.data(),
+                                         bound,
+                                         src,
+                                         inputLength,
+                                         &preferences);
+    if (LZ4F_isError(rc)) {
+        setError(errorStream,
+                 "Error processing LZ4 frame",
+                 LZ4F_getErrorName(rc));
+        return rc_STREAM_PROCESS_FAILURE;  // RETURN
+    }
+
+    outBuffer.setSize(static_cast<int>(rc));
+    output->appendDataBuffer(outBuffer);
+
+    return rc_SUCCESS;
+}
+
+int Compression_Impl::decompressLz4(bdlbb::Blob*              output,
+                                    bdlbb::BlobBufferFactory* factory,
+                                    const bdlbb::Blob&        input,
+                                    bsls::Types::Uint64       maxOutputSize,
+                                    bsl::ostream*             errorStream)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(output);
+    BSLS_ASSERT_SAFE(factory);
+
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3,
+        rc_MAX_SIZE_EXCEEDED      = -4
+    };
+
+    Lz4::DecompressionContextGuard context = {0};
+    size_t                         rc      = LZ4F_createDecompressionContext(
+        &context.d_context_p,
+        LZ4F_VERSION);
+    if (LZ4F_isError(rc)) {
+        setError(errorStream,
+                 "Error initializing LZ4 decompression context",
+                 LZ4F_getErrorName(rc));
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    BlobOutput out(output, factory);
+
+    // 'rc' holds, after each call to 'LZ4F_decompress', a hint of the number
+    // of input bytes still expected, which is 0 once the frame has been fully
+    // decoded and flushed.
+    rc = 1;
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        const char* src       = input.buffer(i).data();
+        size_t      remaining = bmqu::BlobUtil::bufferSize(input, i);
+
+        while (remaining != 0) {
+            size_t capacity;
+            char*  dst     = out.reserve(&capacity);
+            size_t srcSize = remaining;
+
+            rc = LZ4F_decompress(context.d_context_p,
+                                 dst,
+                                 &capacity,
+                                 src,
+                                 &srcSize,
+                                 0);
+            if (LZ4F_isError(rc)) {
+                setError(errorStream,
+                         "Error processing LZ4 frame",
+                         LZ4F_getErrorName(rc));
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+
+            out.commit(capacity);
+            src += srcSize;
+            remaining -= srcSize;
+
+            if (maxOutputSize != 0 && out.length() > maxOutputSize) {
+                setError(errorStream,
+                         "Decompressed output exceeds maximum size");
+                return rc_MAX_SIZE_EXCEEDED;  // RETURN
+            }
+        }
+    }
+
+    // Flush the output still held by the context, if any.
+    while (rc != 0) {
+        size_t capacity;
+        char*  dst     = out.reserve(&capacity);
+        size_t srcSize = 0;
+
+        rc = LZ4F_decompress(context.d_context_p,
+                             dst,
+                             &capacity,
+                             0,
+                             &srcSize,
+                             0);
+        if (LZ4F_isError(rc)) {
+            setError(errorStream,
+                     "Error processing LZ4 frame",
+                     LZ4F_getErrorName(rc));
+            return rc_STREAM_PROCESS_FAILURE;  // RETURN
+        }
+        if (rc != 0 && capacity == 0) {
+            // No progress: the input ends in the middle of the frame.
+            setError(errorStream,
+                     "Error finishing LZ4 frame",
+                     "truncated input");
+            return rc_STREAM_END_FAILURE;  // RETURN
+        }
+
+        out.commit(capacity);
+
+        if (maxOutputSize != 0 && out.length() > maxOutputSize) {
+            setError(errorStream, "Decompressed output exceeds maximum size");
+            return rc_MAX_SIZE_EXCEEDED;  // RETURN
+        }
+    }
+
+    out.finalize();
+
+    return rc_SUCCESS;
+}
+
+int Compression_Impl::compressZstd(bdlbb::Blob*       output,
+                                   const bdlbb::Blob& input,
+                                   int                level,
+                                   bsl::ostream*      errorStream,
+                                   bslma::Allocator*  allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(output);
+
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3
+    };
+
+    ContextProctor<ZSTD_CCtx> context;
+    if (!context.d_context_p) {
+        setError(errorStream,
+                 "Error initializing Zstandard compression context",
+                 "out of memory");
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    // Pledging the size of the input lets the context size its tables and
+    // window to the input, which matters for small messages, and records the
+    // size in the frame header.
+    size_t rc = ZSTD_CCtx_reset(context.d_context_p, ZSTD_reset_session_only);
+    if (!ZSTD_isError(rc)) {
+        rc = ZSTD_CCtx_setParameter(context.d_context_p,
+                                    ZSTD_c_compressionLevel,
+                                    level);
+    }
+    if (!ZSTD_isError(rc)) {
+        rc = ZSTD_CCtx_setPledgedSrcSize(context.d_context_p, input.length());
+    }
+    if (ZSTD_isError(rc)) {
+        setError(errorStream,
+                 "Error initializing Zstandard compression context",
+                 ZSTD_getErrorName(rc));
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    // An output of 'ZSTD_compressBound' bytes is guaranteed to hold the whole
+    // frame: it is written into a single buffer, without intermediate copy.
+    const size_t      bound     = ZSTD_compressBound(input.length());
+    bdlbb::BlobBuffer outBuffer = allocateBuffer(bound, allocator);
+    ZSTD_outBuffer    out       = {outBuffer.data(), bound, 0};
+
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        ZSTD_inBuffer in = {input.buffer(i).data(),
+                            static_cast<size_t>(
+                                bmqu::BlobUtil::bufferSize(input, i)),
+                            0};
+        while (in.pos != in.size) {
+            rc = ZSTD_compressStream2(context.d_context_p,
+                                      &out,
+                                      &in,
+                                      ZSTD_e_continue);
+            if (ZSTD_isError(rc)) {
+                setError(errorStream,
+                         "Error processing Zstandard frame",
+                         ZSTD_getErrorName(rc));
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+        }
+    }
+
+    ZSTD_inBuffer in = {0, 0, 0};
+    rc = ZSTD_compressStream2(context.d_context_p, &out, &in, ZSTD_e_end);
+    if (rc != 0) {
+        setError(errorStream,
+                 "Error finishing Zstandard frame",
+                 ZSTD_isError(rc) ? ZSTD_getErrorName(rc)
+                                  : "output bound exceeded");
+        return rc_STREAM_END_FAILURE;  // RETURN
+    }
+
+    outBuffer.setSize(static_cast<int>(out.pos));
+    output->appendDataBuffer(outBuffer);
+
+    return rc_SUCCESS;
+}
+
+int Compression_Impl::decompressZstd(bdlbb::Blob*              output,
+                                     bdlbb::BlobBufferFactory* factory,
+                                     const bdlbb::Blob&        input,
+                                     bsls::Types::Uint64       maxOutputSize,
+                                     bsl::ostream*             errorStream)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(output);
+    BSLS_ASSERT_SAFE(factory);
+
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3,
+        rc_MAX_SIZE_EXCEEDED      = -4
+    };
+
+    ContextProctor<ZSTD_DCtx> context;
+    if (!context.d_context_p) {
+        setError(errorStream,
+                 "Error initializing Zstandard decompression context",
+                 "out of memory");
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    // The context may hold the state of an aborted session.
+    size_t rc = ZSTD_DCtx_reset(context.d_context_p, ZSTD_reset_session_only);
+    if (ZSTD_isError(rc)) {
+        setError(errorStream,
+                 "Error initializing Zstandard decompression context",
+                 ZSTD_getErrorName(rc));
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    BlobOutput out(output, factory);
+
+    // 'rc' holds, after each call to 'ZSTD_decompressStream', a hint of the
+    // number of input bytes still expected, which is 0 once the frame has
+    // been fully decoded and flushed.
+    rc = 1;
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        ZSTD_inBuffer in = {input.buffer(i).data(),
+                            static_cast<size_t>(
+                                bmqu::BlobUtil::bufferSize(input, i)),
+                            0};
+        while (in.pos != in.size) {
+            size_t         capacity;
+            ZSTD_outBuffer dst = {out.reserve(&capacity), capacity, 0};
+
+            rc = ZSTD_decompressStream(context.d_context_p, &dst, &in);
+            if (ZSTD_isError(rc)) {
+                setError(errorStream,
+                         "Error processing Zstandard frame",
+                         ZSTD_getErrorName(rc));
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+
+            out.commit(dst.pos);
+
+            if (maxOutputSize != 0 && out.length() > maxOutputSize) {
+                setError(errorStream,
+                         "Decompressed output exceeds maximum size");
+                return rc_MAX_SIZE_EXCEEDED;  // RETURN
+            }
+        }
+    }
+
+    // Flush the output still held by the context, if any.
+    while (rc != 0) {
+        size_t         capacity;
+        ZSTD_outBuffer dst = {out.reserve(&capacity), capacity, 0};
+        ZSTD_inBuffer  in  = {0, 0, 0};
+
+        rc = ZSTD_decompressStream(context.d_context_p, &dst, &in);
+        if (ZSTD_isError(rc)) {
+            setError(errorStream,
+                     "Error processing Zstandard frame",
+                     ZSTD_getErrorName(rc));
+            return rc_STREAM_PROCESS_FAILURE;  // RETURN
+        }
+        if (rc != 0 && dst.pos == 0) {
+            // No progress: the input ends in the middle of the frame.
+            setError(errorStream,
+                     "Error finishing Zstandard frame",
+                     "truncated input");
+            return rc_STREAM_END_FAILURE;  // RETURN
+        }
+
+        out.commit(dst.pos);
+
+        if (maxOutputSize != 0 && out.length() > maxOutputSize) {
+            setError(errorStream, "Decompressed output exceeds maximum size");
+            return rc_MAX_SIZE_EXCEEDED;  // RETURN
+        }
+    }
+
+    out.finalize();
+
+    return rc_SUCCESS;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -28,6 +28,24 @@
 // provides implementation for compression and decompression for all supported
 // types of compression algorithms.
 //
+/// Supported Algorithms
+///--------------------
+//: o 'e_ZLIB': DEFLATE stream with a zlib wrapper.  Compression is CPU
+//:   intensive, which makes it ill-suited to latency sensitive producers.
+//: o 'e_LZ4': LZ4 frame format (linked 64 KiB blocks, no checksum).  Trades
+//:   compression ratio for an order of magnitude faster compression and
+//:   decompression than zlib.
+//: o 'e_ZSTD': Zstandard frame format.  Yields a compression ratio on par
+//:   with or better than zlib while compressing and decompressing
+//:   significantly faster.
+//
+// The LZ4 and Zstandard frames written by this component record the size of
+// the uncompressed data, and no checksum since the integrity of the
+// application data is already ensured by the CRC32-C of the message.  Note
+// that, contrary to zlib, the LZ4 and Zstandard libraries supply their
+// working memory themselves: the optionally specified 'allocator' is only
+// used to supply the memory of the compressed output.
+//
 
 // BMQ
 
@@ -150,6 +168,63 @@ struct Compression_Impl {
                               bsls::Types::Uint64       maxOutputSize,
                               bsl::ostream*             errorStream,
                               bslma::Allocator*         allocator);
+
+    /// Compress the data within the specified `input` in the LZ4 frame
+    /// format, and append the compressed data, as a single buffer, to the
+    /// specified `output`.  Specify a compression `level`, with 0 (or a
+    /// negative value) indicating the default fast compression and values
+    /// up to 12 trading speed for compression ratio.  Specify an
+    /// `errorStream` to record details on any errors that may occur during
+    /// this operation.  Finally, specify `allocator` which will be used to
+    /// supply the memory of the output buffer.  Return 0 on success, and
+    /// non-zero otherwise.
+    static int compressLz4(bdlbb::Blob*       output,
+                           const bdlbb::Blob& input,
+                           int                level,
+                           bsl::ostream*      errorStream,
+                           bslma::Allocator*  allocator);
+
+    /// Decompress the data within the specified `input` in the LZ4 frame
+    /// format, and load the uncompressed data into the specified `output`
+    /// blob, using the specified `factory` to supply needed data buffers.
+    /// If the specified `maxOutputSize` is non-zero, fail as soon as the
+    /// accumulated output would exceed `maxOutputSize` bytes.  Specify an
+    /// `errorStream` to record details on any errors that may occur during
+    /// this operation.  Return 0 on success, and non-zero otherwise.
+    static int decompressLz4(bdlbb::Blob*              output,
+                             bdlbb::BlobBufferFactory* factory,
+                             const bdlbb::Blob&        input,
+                             bsls::Types::Uint64       maxOutputSize,
+                             bsl::ostream*             errorStream);
+
+    /// Compress the data within the specified `input` in the Zstandard
+    /// frame format, and append the compressed data, as a single buffer, to
+    /// the specified `output`.  Specify a compression `level`, with 0
+    /// indicating the default level (3), negative values favoring speed and
+    /// values up to 22 favoring compression ratio.  Specify an
+    /// `errorStream` to record details on any errors that may occur during
+    /// this operation.  Finally, specify `allocator` which will be used to
+    /// supply the memory of the output buffer.  Return 0 on success, and
+    /// non-zero otherwise.
+    static int compressZstd(bdlbb::Blob*       output,
+                            const bdlbb::Blob& input,
+                            int                level,
+                            bsl::ostream*      errorStream,
+                            bslma::Allocator*  allocator);
+
+    /// Decompress the data within the specified `input` in the Zstandard
+    /// frame format, and load the uncompressed data into the specified
+    /// `output` blob, using the specified `factory` to supply needed data
+    /// buffers.  If the specified `maxOutputSize` is non-zero, fail as soon
+    /// as the accumulated output would exceed `maxOutputSize` bytes.
+    /// Specify an `errorStream` to record details on any errors that may
+    /// occur during this operation.  Return 0 on success, and non-zero
+    /// otherwise.
+    static int decompressZstd(bdlbb::Blob*              output,
+                              bdlbb::BlobBufferFactory* factory,
+                              const bdlbb::Blob&        input,
+                              bsls::Types::Uint64       maxOutputSize,
+                              bsl::ostream*             errorStream);
 };
 
 }  // close package namespace
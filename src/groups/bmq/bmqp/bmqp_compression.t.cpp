@@ -83,6 +83,66 @@ static void generateRandomString(bsl::string* str, size_t len)
     }
 }
 
+/// Enumeration of the kinds of representative payloads used to compare the
+/// compression algorithms.
+struct PayloadKind {
+    enum Enum {
+        e_JSON         = 0,  // JSON records
+        e_ALPHANUMERIC = 1   // random alphanumeric characters
+    };
+
+    enum { k_COUNT = 2 };
+
+    /// Return the name of the specified `value`.
+    static const char* toAscii(Enum value)
+    {
+        switch (value) {
+        case e_JSON: return "JSON";
+        case e_ALPHANUMERIC: return "Alphanumeric";
+        default: return "(* UNKNOWN *)";
+        }
+    }
+};
+
+/// Load into the specified `payload` a representative payload of the
+/// specified `kind` and `length` bytes.
+static void generatePayload(bsl::string*      payload,
+                            PayloadKind::Enum kind,
+                            size_t            length)
+{
+    payload->clear();
+
+    if (kind == PayloadKind::e_ALPHANUMERIC) {
+        generateRandomString(payload, length);
+        return;  // RETURN
+    }
+
+    // Sequence of order records, as typically posted by a producer.
+    while (payload->length() < length) {
+        bmqu::MemOutStream record(bmqtst::TestHelperUtil::allocator());
+        record << "{\"id\":" << rand() << ",\"side\":\""
+               << (rand() % 2 ? "BUY" : "SELL") << "\",\"qty\":"
+               << rand() % 1000 << ",\"price\":" << rand() % 100000
+               << ",\"currency\":\"USD\"}";
+        payload->append(record.str().data(), record.str().length());
+    }
+    payload->resize(length);
+}
+
+/// Append to the specified `blob` the specified `data`, in buffers of at
+/// most the specified `bufferSize` bytes.
+static void appendInBuffers(bdlbb::Blob*       blob,
+                            const bsl::string& data,
+                            int                bufferSize)
+{
+    const int length = static_cast<int>(data.length());
+    for (int offset = 0; offset < length; offset += bufferSize) {
+        bdlbb::BlobUtil::append(blob,
+                                data.data() + offset,
+                                bsl::min(bufferSize, length - offset));
+    }
+}
+
 /// Print the specified `headers` to the specified `out` in the following
 /// format:
 ///
@@ -769,7 +829,9 @@ static void test4_decompressionSizeLimit()
 //   continuing to allocate memory.
 //
 // Plan:
-//   - Compress a large run of zero bytes (which zlib shrinks dramatically).
+//   For each of the ZLIB, LZ4 and ZSTD algorithms:
+//   - Compress a large run of zero bytes (which each algorithm shrinks
+//     dramatically).
 //   - Decompress with no cap and confirm the full round-trip (control).
 //   - Decompress with a cap below the true output size and confirm it fails
 //     with a non-zero code while producing output bounded near the cap (not
@@ -798,73 +860,310 @@ static void test4_decompressionSizeLimit()
     bdlbb::Blob input(&bufferFactory, bmqtst::TestHelperUtil::allocator());
     bdlbb::BlobUtil::append(&input, zeros.data(), k_INPUT_SIZE);
 
-    bdlbb::Blob compressed(&bufferFactory,
-                           bmqtst::TestHelperUtil::allocator());
-    int         rc = bmqp::Compression::compress(
-        &compressed,
-        &bufferFactory,
+    const bmqt::CompressionAlgorithmType::Enum k_ALGORITHMS[] = {
         bmqt::CompressionAlgorithmType::e_ZLIB,
-        input,
-        &error,
-        bmqtst::TestHelperUtil::allocator());
-    BMQTST_ASSERT_EQ(rc, 0);
-    // Highly-compressible: compressed form is a tiny fraction of the input.
-    BMQTST_ASSERT_LT(compressed.length(), k_INPUT_SIZE);
+        bmqt::CompressionAlgorithmType::e_LZ4,
+        bmqt::CompressionAlgorithmType::e_ZSTD};
+    const size_t k_NUM_ALGORITHMS = sizeof(k_ALGORITHMS) /
+                                    sizeof(*k_ALGORITHMS);
 
-    {
-        PVV("Control: no cap decompresses fully");
-        bdlbb::Blob decompressed(&bufferFactory,
-                                 bmqtst::TestHelperUtil::allocator());
-        rc = bmqp::Compression::decompress(
-            &decompressed,
+    for (size_t algIdx = 0; algIdx < k_NUM_ALGORITHMS; ++algIdx) {
+        const bmqt::CompressionAlgorithmType::Enum algorithm =
+            k_ALGORITHMS[algIdx];
+
+        PV("Algorithm: " << algorithm);
+
+        bdlbb::Blob compressed(&bufferFactory,
+                               bmqtst::TestHelperUtil::allocator());
+        int         rc = bmqp::Compression::compress(
+            &compressed,
             &bufferFactory,
-            bmqt::CompressionAlgorithmType::e_ZLIB,
-            compressed,
-            0,  // no cap
+            algorithm,
+            input,
             &error,
             bmqtst::TestHelperUtil::allocator());
-        BMQTST_ASSERT_EQ(rc, 0);
-        BMQTST_ASSERT_EQ(decompressed.length(), k_INPUT_SIZE);
+        BMQTST_ASSERT_EQ_D(algorithm, rc, 0);
+        // Highly-compressible: compressed form is a tiny fraction of the
+        // input.
+        BMQTST_ASSERT_LT_D(algorithm, compressed.length(), k_INPUT_SIZE);
+
+        {
+            PVV("Control: no cap decompresses fully");
+            bdlbb::Blob decompressed(&bufferFactory,
+                                     bmqtst::TestHelperUtil::allocator());
+            rc = bmqp::Compression::decompress(
+                &decompressed,
+                &bufferFactory,
+                algorithm,
+                compressed,
+                0,  // no cap
+                &error,
+                bmqtst::TestHelperUtil::allocator());
+            BMQTST_ASSERT_EQ_D(algorithm, rc, 0);
+            BMQTST_ASSERT_EQ_D(algorithm,
+                               decompressed.length(),
+                               k_INPUT_SIZE);
+        }
+
+        {
+            PVV("Cap below decompressed size fails closed");
+            const bsls::Types::Uint64 k_CAP = 1024 * 1024;  // 1 MB < 8 MB
+            bdlbb::Blob               decompressed(&bufferFactory,
+                                     bmqtst::TestHelperUtil::allocator());
+            rc = bmqp::Compression::decompress(
+                &decompressed,
+                &bufferFactory,
+                algorithm,
+                compressed,
+                k_CAP,
+                &error,
+                bmqtst::TestHelperUtil::allocator());
+            // Fails with a non-zero code ...
+            BMQTST_ASSERT_NE_D(algorithm, rc, 0);
+            // ... and stops well short of fully expanding the input, bounded
+            // near the cap rather than the full 8 MB.
+            BMQTST_ASSERT_LT_D(algorithm,
+                               decompressed.length(),
+                               k_INPUT_SIZE);
+            BMQTST_ASSERT_LE_D(
+                algorithm,
+                static_cast<bsls::Types::Uint64>(decompressed.length()),
+                k_CAP + 1024);
+        }
+
+        {
+            PVV("Cap above decompressed size succeeds");
+            const bsls::Types::Uint64 k_CAP = 64 * 1024 * 1024;  // 64 MB
+            bdlbb::Blob               decompressed(&bufferFactory,
+                                     bmqtst::TestHelperUtil::allocator());
+            rc = bmqp::Compression::decompress(
+                &decompressed,
+                &bufferFactory,
+                algorithm,
+                compressed,
+                k_CAP,
+                &error,
+                bmqtst::TestHelperUtil::allocator());
+            BMQTST_ASSERT_EQ_D(algorithm, rc, 0);
+            BMQTST_ASSERT_EQ_D(algorithm,
+                               decompressed.length(),
+                               k_INPUT_SIZE);
+        }
     }
+}
+
+static void test5_lz4AndZstd()
+// ------------------------------------------------------------------------
+// LZ4 AND ZSTD ALGORITHMS
+//
+// Concerns:
+//   - Data compressed with LZ4 or Zstandard decompresses to the original
+//     data, whatever the number and size of the buffers of the input, and
+//     across the boundaries of the blocks of each format.
+//   - Data already present in the output of the decompression is preserved.
+//   - Explicit compression levels are honored.
+//   - A truncated input fails to decompress.
+//
+// Plan:
+//   - For each algorithm, compress payloads of various lengths split in
+//     buffers of various sizes, decompress them after some existing data
+//     and compare the result with the existing data followed by the
+//     original payload.
+//   - Decompress the compressed payload without its last byte and verify
+//     that it fails.
+//   - Compress and decompress a payload using the lowest and highest
+//     compression levels of each algorithm.
+//
+// Testing:
+//   bmqp::Compression::compress
+//   bmqp::Compression::decompress
+//   bmqp::Compression_Impl::compressLz4
+//   bmqp::Compression_Impl::decompressLz4
+//   bmqp::Compression_Impl::compressZstd
+//   bmqp::Compression_Impl::decompressZstd
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("LZ4 AND ZSTD ALGORITHMS");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqu::MemOutStream error(bmqtst::TestHelperUtil::allocator());
+
+    const bmqt::CompressionAlgorithmType::Enum k_ALGORITHMS[] = {
+        bmqt::CompressionAlgorithmType::e_LZ4,
+        bmqt::CompressionAlgorithmType::e_ZSTD};
+    const size_t k_NUM_ALGORITHMS = sizeof(k_ALGORITHMS) /
+                                    sizeof(*k_ALGORITHMS);
+
+    // Lengths around the 64 KiB blocks of LZ4, and beyond the 128 KiB blocks
+    // of Zstandard.
+    const int    k_LENGTHS[]       = {0, 1, 100, 65535, 65536, 65537, 300000};
+    const size_t k_NUM_LENGTHS     = sizeof(k_LENGTHS) / sizeof(*k_LENGTHS);
+    const int    k_BUFFER_SIZES[]  = {7, 1000, 4096, 1024 * 1024};
+    const size_t k_NUM_BUFFER_SIZES = sizeof(k_BUFFER_SIZES) /
+                                      sizeof(*k_BUFFER_SIZES);
+    const char   k_PREFIX[]         = "existing";
 
     {
-        PVV("Cap below decompressed size fails closed");
-        const bsls::Types::Uint64 k_CAP = 1024 * 1024;  // 1 MB < 8 MB
-        bdlbb::Blob               decompressed(&bufferFactory,
-                                 bmqtst::TestHelperUtil::allocator());
-        rc = bmqp::Compression::decompress(
-            &decompressed,
-            &bufferFactory,
-            bmqt::CompressionAlgorithmType::e_ZLIB,
-            compressed,
-            k_CAP,
-            &error,
-            bmqtst::TestHelperUtil::allocator());
-        // Fails with a non-zero code ...
-        BMQTST_ASSERT_NE(rc, 0);
-        // ... and stops well short of fully expanding the input, bounded
-        // near the cap rather than the full 8 MB.
-        BMQTST_ASSERT_LT(decompressed.length(), k_INPUT_SIZE);
-        BMQTST_ASSERT_LE(
-            static_cast<bsls::Types::Uint64>(decompressed.length()),
-            k_CAP + 1024);
+        PV("ROUND TRIP");
+
+        for (size_t algIdx = 0; algIdx < k_NUM_ALGORITHMS; ++algIdx) {
+            const bmqt::CompressionAlgorithmType::Enum algorithm =
+                k_ALGORITHMS[algIdx];
+
+            for (size_t lenIdx = 0; lenIdx < k_NUM_LENGTHS; ++lenIdx) {
+                bsl::string data(bmqtst::TestHelperUtil::allocator());
+                generatePayload(&data,
+                                PayloadKind::e_JSON,
+                                k_LENGTHS[lenIdx]);
+
+                for (size_t bufIdx = 0; bufIdx < k_NUM_BUFFER_SIZES;
+                     ++bufIdx) {
+                    PVV(algorithm << ", length: " << k_LENGTHS[lenIdx]
+                                  << ", buffer size: "
+                                  << k_BUFFER_SIZES[bufIdx]);
+
+                    bdlbb::Blob input(&bufferFactory,
+                                      bmqtst::TestHelperUtil::allocator());
+                    appendInBuffers(&input, data, k_BUFFER_SIZES[bufIdx]);
+
+                    bdlbb::Blob compressed(
+                        &bufferFactory,
+                        bmqtst::TestHelperUtil::allocator());
+                    int rc = bmqp::Compression::compress(
+                        &compressed,
+                        &bufferFactory,
+                        algorithm,
+                        input,
+                        &error,
+                        bmqtst::TestHelperUtil::allocator());
+                    BMQTST_ASSERT_EQ_D(algorithm, rc, 0);
+
+                    bdlbb::Blob expected(&bufferFactory,
+                                         bmqtst::TestHelperUtil::allocator());
+                    bdlbb::BlobUtil::append(&expected,
+                                            k_PREFIX,
+                                            sizeof(k_PREFIX));
+                    bdlbb::BlobUtil::append(&expected, input);
+
+                    bdlbb::Blob decompressed(
+                        &bufferFactory,
+                        bmqtst::TestHelperUtil::allocator());
+                    bdlbb::BlobUtil::append(&decompressed,
+                                            k_PREFIX,
+                                            sizeof(k_PREFIX));
+                    rc = bmqp::Compression::decompress(
+                        &decompressed,
+                        &bufferFactory,
+                        algorithm,
+                        compressed,
+                        0,  // no output cap
+                        &error,
+                        bmqtst::TestHelperUtil::allocator());
+                    BMQTST_ASSERT_EQ_D(algorithm, rc, 0);
+                    BMQTST_ASSERT_EQ_D(
+                        algorithm,
+                        bdlbb::BlobUtil::compare(decompressed, expected),
+                        0);
+
+                    PVV("Truncated input fails to decompress");
+                    bdlbb::Blob truncated(
+                        &bufferFactory,
+                        bmqtst::TestHelperUtil::allocator());
+                    bdlbb::BlobUtil::append(&truncated,
+                                            compressed,
+                                            0,
+                                            compressed.length() - 1);
+                    bdlbb::Blob truncatedOutput(
+                        &bufferFactory,
+                        bmqtst::TestHelperUtil::allocator());
+                    rc = bmqp::Compression::decompress(
+                        &truncatedOutput,
+                        &bufferFactory,
+                        algorithm,
+                        truncated,
+                        0,  // no output cap
+                        &error,
+                        bmqtst::TestHelperUtil::allocator());
+                    BMQTST_ASSERT_NE_D(algorithm, rc, 0);
+                }
+            }
+        }
     }
 
     {
-        PVV("Cap above decompressed size succeeds");
-        const bsls::Types::Uint64 k_CAP = 64 * 1024 * 1024;  // 64 MB > 8 MB
-        bdlbb::Blob               decompressed(&bufferFactory,
-                                 bmqtst::TestHelperUtil::allocator());
-        rc = bmqp::Compression::decompress(
-            &decompressed,
-            &bufferFactory,
-            bmqt::CompressionAlgorithmType::e_ZLIB,
-            compressed,
-            k_CAP,
-            &error,
-            bmqtst::TestHelperUtil::allocator());
-        BMQTST_ASSERT_EQ(rc, 0);
-        BMQTST_ASSERT_EQ(decompressed.length(), k_INPUT_SIZE);
+        PV("COMPRESSION LEVELS");
+
+        bsl::string data(bmqtst::TestHelperUtil::allocator());
+        generatePayload(&data, PayloadKind::e_JSON, 100000);
+
+        bdlbb::Blob input(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+        appendInBuffers(&input, data, 4096);
+
+        const int k_LZ4_LEVELS[]  = {-1, 0, 12};
+        const int k_ZSTD_LEVELS[] = {-5, 0, 1, 19};
+
+        for (size_t i = 0; i < sizeof(k_LZ4_LEVELS) / sizeof(*k_LZ4_LEVELS);
+             ++i) {
+            PVV("LZ4 level: " << k_LZ4_LEVELS[i]);
+
+            bdlbb::Blob compressed(&bufferFactory,
+                                   bmqtst::TestHelperUtil::allocator());
+            bdlbb::Blob decompressed(&bufferFactory,
+                                     bmqtst::TestHelperUtil::allocator());
+            int         rc = bmqp::Compression_Impl::compressLz4(
+                &compressed,
+                input,
+                k_LZ4_LEVELS[i],
+                &error,
+                bmqtst::TestHelperUtil::allocator());
+            BMQTST_ASSERT_EQ_D(k_LZ4_LEVELS[i], rc, 0);
+            BMQTST_ASSERT_LT_D(k_LZ4_LEVELS[i],
+                               compressed.length(),
+                               input.length());
+
+            rc = bmqp::Compression_Impl::decompressLz4(&decompressed,
+                                                       &bufferFactory,
+                                                       compressed,
+                                                       0,  // no output cap
+                                                       &error);
+            BMQTST_ASSERT_EQ_D(k_LZ4_LEVELS[i], rc, 0);
+            BMQTST_ASSERT_EQ_D(k_LZ4_LEVELS[i],
+                               bdlbb::BlobUtil::compare(decompressed, input),
+                               0);
+        }
+
+        for (size_t i = 0;
+             i < sizeof(k_ZSTD_LEVELS) / sizeof(*k_ZSTD_LEVELS);
+             ++i) {
+            PVV("ZSTD level: " << k_ZSTD_LEVELS[i]);
+
+            bdlbb::Blob compressed(&bufferFactory,
+                                   bmqtst::TestHelperUtil::allocator());
+            bdlbb::Blob decompressed(&bufferFactory,
+                                     bmqtst::TestHelperUtil::allocator());
+            int         rc = bmqp::Compression_Impl::compressZstd(
+                &compressed,
+                input,
+                k_ZSTD_LEVELS[i],
+                &error,
+                bmqtst::TestHelperUtil::allocator());
+            BMQTST_ASSERT_EQ_D(k_ZSTD_LEVELS[i], rc, 0);
+            BMQTST_ASSERT_LT_D(k_ZSTD_LEVELS[i],
+                               compressed.length(),
+                               input.length());
+
+            rc = bmqp::Compression_Impl::decompressZstd(&decompressed,
+                                                        &bufferFactory,
+                                                        compressed,
+                                                        0,  // no output cap
+                                                        &error);
+            BMQTST_ASSERT_EQ_D(k_ZSTD_LEVELS[i], rc, 0);
+            BMQTST_ASSERT_EQ_D(k_ZSTD_LEVELS[i],
+                               bdlbb::BlobUtil::compare(decompressed, input),
+                               0);
+        }
     }
 }
 
@@ -1135,6 +1434,132 @@ static void testN3_performanceCompressionRatio()
     }
 }
 
+BSLA_MAYBE_UNUSED
+static void testN4_compareAlgorithms()
+// ------------------------------------------------------------------------
+// BENCHMARK: COMPARE COMPRESSION ALGORITHMS
+//
+// Concerns:
+//   Compare the compression ratio (InputSize/CompressedSize) and the
+//   compression and decompression throughput of the ZLIB, LZ4 and ZSTD
+//   algorithms, at their default level, on representative payloads in a
+//   single thread environment.
+//
+// Plan:
+//   - For each kind of payload, each payload size and each algorithm,
+//     time the compression and then the decompression of about 64 MiB of
+//     payloads and report the resulting ratio and throughputs.
+//
+// Testing:
+//   Compression ratio and throughput (MB/s) of each algorithm.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // The default allocator check fails in this test case because the
+    // printing utilities use the default allocator.
+
+    bmqtst::TestHelper::printTestName(
+        "BENCHMARK: COMPARE COMPRESSION ALGORITHMS");
+
+    const bsls::Types::Int64 k_BYTES_PER_RUN = 64 * 1024 * 1024;  // 64 Mi
+    const int                k_SIZES[]       = {1024, 16 * 1024, 256 * 1024};
+    const size_t k_NUM_SIZES = sizeof(k_SIZES) / sizeof(*k_SIZES);
+    const bmqt::CompressionAlgorithmType::Enum k_ALGORITHMS[] = {
+        bmqt::CompressionAlgorithmType::e_ZLIB,
+        bmqt::CompressionAlgorithmType::e_LZ4,
+        bmqt::CompressionAlgorithmType::e_ZSTD};
+    const size_t k_NUM_ALGORITHMS = sizeof(k_ALGORITHMS) /
+                                    sizeof(*k_ALGORITHMS);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        4096,
+        bmqtst::TestHelperUtil::allocator());
+
+    bmqu::OutStreamFormatSaver fmtSaver(bsl::cout);
+
+    bsl::cout << "\n| " << bsl::setw(12) << "Payload"
+              << " | " << bsl::setw(8) << "Size"
+              << " | " << bsl::setw(9) << "Algorithm"
+              << " | " << bsl::setw(7) << "Ratio"
+              << " | " << bsl::setw(16) << "Compress (MB/s)"
+              << " | " << bsl::setw(18) << "Decompress (MB/s)" << " |\n";
+    bsl::cout << bsl::fixed << bsl::setprecision(2);
+
+    for (int kind = 0; kind < PayloadKind::k_COUNT; ++kind) {
+        const PayloadKind::Enum payloadKind = static_cast<PayloadKind::Enum>(
+            kind);
+
+        for (size_t sizeIdx = 0; sizeIdx < k_NUM_SIZES; ++sizeIdx) {
+            const int   size = k_SIZES[sizeIdx];
+            bsl::string data(bmqtst::TestHelperUtil::allocator());
+            generatePayload(&data, payloadKind, size);
+
+            bdlbb::Blob input(&bufferFactory,
+                              bmqtst::TestHelperUtil::allocator());
+            bdlbb::BlobUtil::append(&input, data.data(), size);
+
+            const bsls::Types::Int64 numIters = k_BYTES_PER_RUN / size;
+
+            for (size_t algIdx = 0; algIdx < k_NUM_ALGORITHMS; ++algIdx) {
+                const bmqt::CompressionAlgorithmType::Enum algorithm =
+                    k_ALGORITHMS[algIdx];
+
+                bdlbb::Blob compressed(&bufferFactory,
+                                       bmqtst::TestHelperUtil::allocator());
+
+                // <time>
+                const bsls::Types::Int64 compressStart =
+                    bsls::TimeUtil::getTimer();
+                for (bsls::Types::Int64 i = 0; i < numIters; ++i) {
+                    compressed.removeAll();
+                    bmqp::Compression::compress(
+                        &compressed,
+                        &bufferFactory,
+                        algorithm,
+                        input,
+                        0,
+                        bmqtst::TestHelperUtil::allocator());
+                }
+                const bsls::Types::Int64 compressTime =
+                    bsls::TimeUtil::getTimer() - compressStart;
+
+                const bsls::Types::Int64 decompressStart =
+                    bsls::TimeUtil::getTimer();
+                for (bsls::Types::Int64 i = 0; i < numIters; ++i) {
+                    bdlbb::Blob decompressed(
+                        &bufferFactory,
+                        bmqtst::TestHelperUtil::allocator());
+                    bmqp::Compression::decompress(
+                        &decompressed,
+                        &bufferFactory,
+                        algorithm,
+                        compressed,
+                        0,  // no output cap
+                        0,
+                        bmqtst::TestHelperUtil::allocator());
+                }
+                const bsls::Types::Int64 decompressTime =
+                    bsls::TimeUtil::getTimer() - decompressStart;
+                // </time>
+
+                // Bytes per microsecond are MB per second.
+                const double totalBytes = static_cast<double>(numIters) *
+                                          size;
+                bsl::cout << "| " << bsl::setw(12)
+                          << PayloadKind::toAscii(payloadKind) << " | "
+                          << bsl::setw(8) << size << " | " << bsl::setw(9)
+                          << algorithm << " | " << bsl::setw(7)
+                          << static_cast<double>(size) / compressed.length()
+                          << " | " << bsl::setw(16)
+                          << totalBytes * 1000 / compressTime << " | "
+                          << bsl::setw(18)
+                          << totalBytes * 1000 / decompressTime << " |\n";
+            }
+        }
+    }
+    bsl::cout << bsl::endl;
+}
+
 // Begin Benchmarking Tests
 #ifdef BMQTST_BENCHMARK_ENABLED
 static void testN1_performanceCompressionDecompressionDefault_GoogleBenchmark(
@@ -1215,6 +1640,80 @@ static void testN2_calculateThroughput_GoogleBenchmark(benchmark::State& state)
     }
     // </time>
 }
+
+static void testN4_compareAlgorithms_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: COMPARE COMPRESSION ALGORITHMS
+//
+// Concerns:
+//   Compare the compression ratio and the throughput of compressing and
+//   decompressing JSON payloads using the ZLIB, LZ4 and ZSTD algorithms.
+//
+// Plan:
+//   - Compress and decompress a JSON payload of the size specified by the
+//     first argument using the algorithm specified by the second argument,
+//     and report the number of bytes processed per second along with the
+//     compression ratio.
+//
+// Testing:
+//   Compression ratio and throughput of each algorithm.
+// ------------------------------------------------------------------------
+{
+    const int                                  size = state.range(0);
+    const bmqt::CompressionAlgorithmType::Enum algorithm =
+        static_cast<bmqt::CompressionAlgorithmType::Enum>(state.range(1));
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        4096,
+        bmqtst::TestHelperUtil::allocator());
+
+    bsl::string data(bmqtst::TestHelperUtil::allocator());
+    generatePayload(&data, PayloadKind::e_JSON, size);
+
+    bdlbb::Blob input(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+    bdlbb::BlobUtil::append(&input, data.data(), size);
+
+    int compressedLength = 0;
+    for (auto _ : state) {
+        bdlbb::Blob compressed(&bufferFactory,
+                               bmqtst::TestHelperUtil::allocator());
+        bdlbb::Blob decompressed(&bufferFactory,
+                                 bmqtst::TestHelperUtil::allocator());
+        bmqp::Compression::compress(&compressed,
+                                    &bufferFactory,
+                                    algorithm,
+                                    input,
+                                    0,
+                                    bmqtst::TestHelperUtil::allocator());
+        bmqp::Compression::decompress(&decompressed,
+                                      &bufferFactory,
+                                      algorithm,
+                                      compressed,
+                                      0,  // no output cap
+                                      0,
+                                      bmqtst::TestHelperUtil::allocator());
+        compressedLength = compressed.length();
+    }
+
+    state.SetBytesProcessed(state.iterations() * size);
+    state.SetLabel(bmqt::CompressionAlgorithmType::toAscii(algorithm));
+    state.counters["ratio"] = static_cast<double>(size) / compressedLength;
+}
+
+/// Apply to the specified `b` Google Benchmark the arguments of
+/// `testN4_compareAlgorithms`: JSON payload sizes from 1 KiB to 256 KiB,
+/// for each of the ZLIB, LZ4 and ZSTD algorithms.
+static void
+populateAlgorithmsArgs_GoogleBenchmark(benchmark::internal::Benchmark* b)
+{
+    for (int algorithm = bmqt::CompressionAlgorithmType::e_ZLIB;
+         algorithm <= bmqt::CompressionAlgorithmType::e_ZSTD;
+         ++algorithm) {
+        for (int size = 1024; size <= 256 * 1024; size *= 16) {
+            b->Args({size, algorithm});
+        }
+    }
+}
 #endif  // BMQTST_BENCHMARK_ENABLED
 // ============================================================================
 //                                 MAIN PROGRAM
@@ -1226,6 +1725,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_lz4AndZstd(); break;
     case 1: test1_breathingTest(); break;
     case 2: test2_compression_cluster_message(); break;
     case 3: test3_compression_decompression_none(); break;
@@ -1244,6 +1744,11 @@ int main(int argc, char* argv[])
                                        ->Unit(benchmark::kMillisecond));
         break;
     case -3: testN3_performanceCompressionRatio(); break;
+    case -4:
+        BMQTST_BENCHMARK_WITH_ARGS(
+            testN4_compareAlgorithms,
+            Apply(populateAlgorithmsArgs_GoogleBenchmark));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
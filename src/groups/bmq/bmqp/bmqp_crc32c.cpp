@@ -16,19 +16,463 @@
 #include <bmqp_crc32c.h>
 
 #include <bmqscm_version.h>
+/// IMPLEMENTATION NOTES
+///--------------------
+// All implementations operate on the raw CRC register ('state' below), which
+// is the bitwise complement of the CRC32-C value exposed by the public API.
+//
+// The software implementation processes 8 bytes per iteration using 8 lookup
+// tables ("slicing-by-8").
+//
+// The 'crc32' instruction (SSE4.2 on x86-64, CRC extension on AArch64) has a
+// latency of 3 cycles but a throughput of one instruction per cycle, so a
+// single dependent chain of instructions only uses a third of the capacity
+// of the CPU.  The parallel implementation therefore splits the input in
+// blocks of 3 contiguous streams of equal length, computes the CRC of each
+// stream independently (the second and third ones starting from a null
+// register), and then combines them.  Because a CRC is linear:
+//..
+//  crc(A || B) = shift(crc(A), |B|) ^ crc(B)
+//..
+// where 'shift(r, n)' is the register 'r' after processing 'n' null bytes,
+// which is the product of 'r' and 'x^(8n) mod P' in GF(2)[x]/P.  The constant
+// 'x^(8n) mod P' is precomputed for the (fixed) length of the streams, and
+// the product is computed with a single carry-less multiplication
+// (PCLMULQDQ) of the two 32 bit values, whose 64 bit result is folded back to
+// 32 bits using the 'crc32' instruction.  Long streams are used first, so
+// that the cost of the combination is amortized over a large number of
+// bytes, then short ones, and the remainder of the input is processed
+// serially.
 
 // BDE
-#include <ball_log.h>
-#include <bdlde_crc32c.h>
-#include <bsla_maybeunused.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) &&                                      \
+    (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BMQP_CRC32C_X86_64 1
+#include <nmmintrin.h>  // SSE4.2
+#include <wmmintrin.h>  // PCLMULQDQ
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define BMQP_CRC32C_AARCH64 1
+#include <arm_acle.h>
+#endif
 
 namespace BloombergLP {
 namespace bmqp {
 
 namespace {
 
-BSLA_MAYBE_UNUSED const char k_LOG_CATEGORY[] = "BMQP.CRC32C";
+// CONSTANTS
+
+/// Castagnoli polynomial, in reversed bit order.
+const unsigned int k_POLYNOMIAL = 0x82F63B78;
+
+/// Length (in bytes) of each of the 3 streams of a short block.
+const bsl::size_t k_SHORT_STREAM_LENGTH = 256;
+
+/// Length (in bytes) of each of the 3 streams of a long block.
+const bsl::size_t k_LONG_STREAM_LENGTH = 8192;
+
+// TYPES
+
+/// Signature of a function updating the specified raw CRC register `state`
+/// with the specified `length` bytes of the specified `data`, and returning
+/// the updated register.
+typedef unsigned int (*UpdateFn)(unsigned int         state,
+                                 const unsigned char* data,
+                                 bsl::size_t          length);
+
+// FUNCTIONS
+
+/// Return the product of the specified `lhs` and `rhs` polynomials (in
+/// reversed bit order) modulo the Castagnoli polynomial.
+unsigned int multiplyModP(unsigned int lhs, unsigned int rhs)
+{
+    unsigned int product = 0;
+    for (unsigned int mask = 1u << 31; mask != 0; mask >>= 1) {
+        if (lhs & mask) {
+            product ^= rhs;
+        }
+        rhs = (rhs & 1) ? (rhs >> 1) ^ k_POLYNOMIAL : rhs >> 1;
+    }
+
+    return product;
+}
+
+/// Return `x^(8 * numBytes) mod P` (in reversed bit order), which is the
+/// value to multiply a raw CRC register by to shift it by the specified
+/// `numBytes` null bytes.
+unsigned int shiftOperator(bsl::size_t numBytes)
+{
+    unsigned int result = 1u << 31;  // x^0
+    unsigned int power  = 1u << 30;  // x^1
+    for (bsl::size_t exponent = numBytes * 8; exponent != 0; exponent >>= 1) {
+        if (exponent & 1) {
+            result = multiplyModP(result, power);
+        }
+        power = multiplyModP(power, power);
+    }
+
+    return result;
+}
+
+// =============
+// struct Tables
+// =============
+
+/// Constants computed once, on first use.
+struct Tables {
+    // DATA
+
+    /// Lookup tables of the software implementation: `d_lookup[k][b]` is the
+    /// raw CRC register resulting from processing the byte `b` followed by
+    /// `k` null bytes from a null register.
+    unsigned int d_lookup[8][256];
+
+    /// Operator shifting a raw CRC register by `k_SHORT_STREAM_LENGTH`
+    /// bytes.
+    unsigned int d_shortShift;
+
+    /// Operator shifting a raw CRC register by `k_LONG_STREAM_LENGTH` bytes.
+    unsigned int d_longShift;
+
+    // CREATORS
+    Tables();
+};
+
+Tables::Tables()
+: d_shortShift(shiftOperator(k_SHORT_STREAM_LENGTH))
+, d_longShift(shiftOperator(k_LONG_STREAM_LENGTH))
+{
+    for (unsigned int byte = 0; byte < 256; ++byte) {
+        unsigned int state = byte;
+        for (int bit = 0; bit < 8; ++bit) {
+            state = (state & 1) ? (state >> 1) ^ k_POLYNOMIAL : state >> 1;
+        }
+        d_lookup[0][byte] = state;
+    }
+
+    for (int k = 1; k < 8; ++k) {
+        for (unsigned int byte = 0; byte < 256; ++byte) {
+            const unsigned int previous = d_lookup[k - 1][byte];
+            d_lookup[k][byte] = (previous >> 8) ^
+                                d_lookup[0][previous & 0xFF];
+        }
+    }
+}
+
+/// Return the tables, computing them on first use.
+const Tables& tables()
+{
+    static const Tables s_tables;
+    return s_tables;
+}
+
+/// Software implementation of `UpdateFn`.
+unsigned int updateSoftware(unsigned int         state,
+                            const unsigned char* data,
+                            bsl::size_t          length)
+{
+    const unsigned int(*lookup)[256] = tables().d_lookup;
+
+    // Bytes are assembled explicitly so that this is independent of the
+    // endianness and of the alignment of 'data'.
+    for (; length >= 8; length -= 8, data += 8) {
+        const unsigned int low = state ^
+                                 (static_cast<unsigned int>(data[0]) |
+                                  (static_cast<unsigned int>(data[1]) << 8) |
+                                  (static_cast<unsigned int>(data[2]) << 16) |
+                                  (static_cast<unsigned int>(data[3]) << 24));
+
+        state = lookup[7][low & 0xFF] ^ lookup[6][(low >> 8) & 0xFF] ^
+                lookup[5][(low >> 16) & 0xFF] ^ lookup[4][low >> 24] ^
+                lookup[3][data[4]] ^ lookup[2][data[5]] ^
+                lookup[1][data[6]] ^ lookup[0][data[7]];
+    }
+
+    for (; length != 0; --length, ++data) {
+        state = lookup[0][(state ^ *data) & 0xFF] ^ (state >> 8);
+    }
+
+    return state;
+}
+
+#if defined(BMQP_CRC32C_X86_64)
+
+/// Return the 8 bytes at the specified `data` (which need not be aligned).
+inline bsls::Types::Uint64 load64(const unsigned char* data)
+{
+    bsls::Types::Uint64 word;
+    bsl::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+/// Return true if the running CPU supports the `crc32` instruction.
+bool isSerialSupported()
+{
+    return __builtin_cpu_supports("sse4.2");
+}
+
+/// Return true if the running CPU supports the instructions used by
+/// `updateParallel`.
+bool isParallelSupported()
+{
+    return __builtin_cpu_supports("sse4.2") &&
+           __builtin_cpu_supports("pclmul");
+}
+
+/// Hardware implementation of `UpdateFn` computing a single stream.
+__attribute__((target("sse4.2"))) unsigned int
+updateSerial(unsigned int         state,
+             const unsigned char* data,
+             bsl::size_t          length)
+{
+    for (; length != 0 && (reinterpret_cast<bsls::Types::UintPtr>(data) & 7);
+         --length, ++data) {
+        state = _mm_crc32_u8(state, *data);
+    }
+
+    bsls::Types::Uint64 state64 = state;
+    for (; length >= 8; length -= 8, data += 8) {
+        state64 = _mm_crc32_u64(state64, load64(data));
+    }
+    state = static_cast<unsigned int>(state64);
+
+    for (; length != 0; --length, ++data) {
+        state = _mm_crc32_u8(state, *data);
+    }
+
+    return state;
+}
+
+/// Return the specified raw CRC register `state` multiplied by the
+/// specified `shiftOp` operator (see `shiftOperator`).
+__attribute__((target("sse4.2,pclmul"))) inline unsigned int
+shiftState(unsigned int state, unsigned int shiftOp)
+{
+    // The 63 bit carry-less product is shifted left by one bit, so that its
+    // upper half is the (reversed) remainder of degree lower than 32, and its
+    // lower half is the (reversed) quotient by 'x^32', which is reduced with
+    // the 'crc32' instruction.
+
+    const __m128i product = _mm_clmulepi64_si128(
+        _mm_cvtsi32_si128(static_cast<int>(state)),
+        _mm_cvtsi32_si128(static_cast<int>(shiftOp)),
+        0x00);
+    const bsls::Types::Uint64 folded =
+        static_cast<bsls::Types::Uint64>(_mm_cvtsi128_si64(product)) << 1;
+
+    return _mm_crc32_u32(0, static_cast<unsigned int>(folded)) ^
+           static_cast<unsigned int>(folded >> 32);
+}
+
+/// Update the specified raw CRC register `state` with as many blocks of 3
+/// streams of `STREAM_LENGTH` bytes as are available in the specified
+/// `length` bytes of the specified `data`, using the specified `shiftOp`
+/// operator to combine the streams, and return the updated register.  Load
+/// into `data` and `length` the remainder of the input.
+template <bsl::size_t STREAM_LENGTH>
+__attribute__((target("sse4.2,pclmul"))) inline unsigned int
+updateBlocks(unsigned int          state,
+             const unsigned char** data,
+             bsl::size_t*          length,
+             unsigned int          shiftOp)
+{
+    const unsigned char* cursor    = *data;
+    bsl::size_t          remaining = *length;
+
+    for (; remaining >= 3 * STREAM_LENGTH; remaining -= 3 * STREAM_LENGTH) {
+        bsls::Types::Uint64        crc0 = state;
+        bsls::Types::Uint64        crc1 = 0;
+        bsls::Types::Uint64        crc2 = 0;
+        const unsigned char* const end  = cursor + STREAM_LENGTH;
+        do {
+            crc0 = _mm_crc32_u64(crc0, load64(cursor));
+            crc1 = _mm_crc32_u64(crc1, load64(cursor + STREAM_LENGTH));
+            crc2 = _mm_crc32_u64(crc2, load64(cursor + 2 * STREAM_LENGTH));
+            cursor += 8;
+        } while (cursor != end);
+
+        state = shiftState(static_cast<unsigned int>(crc0), shiftOp) ^
+                static_cast<unsigned int>(crc1);
+        state = shiftState(state, shiftOp) ^ static_cast<unsigned int>(crc2);
+        cursor += 2 * STREAM_LENGTH;
+    }
+
+    *data   = cursor;
+    *length = remaining;
+    return state;
+}
+
+/// Hardware implementation of `UpdateFn` computing 3 streams in parallel.
+__attribute__((target("sse4.2,pclmul"))) unsigned int
+updateParallel(unsigned int         state,
+               const unsigned char* data,
+               bsl::size_t          length)
+{
+    if (length < 3 * k_SHORT_STREAM_LENGTH) {
+        return updateSerial(state, data, length);  // RETURN
+    }
+
+    for (; reinterpret_cast<bsls::Types::UintPtr>(data) & 7;
+         --length, ++data) {
+        state = _mm_crc32_u8(state, *data);
+    }
+
+    const Tables& constants = tables();
+
+    state = updateBlocks<k_LONG_STREAM_LENGTH>(state,
+                                               &data,
+                                               &length,
+                                               constants.d_longShift);
+    state = updateBlocks<k_SHORT_STREAM_LENGTH>(state,
+                                                &data,
+                                                &length,
+                                                constants.d_shortShift);
+
+    return updateSerial(state, data, length);
+}
+
+#elif defined(BMQP_CRC32C_AARCH64)
+
+/// Return the 8 bytes at the specified `data` (which need not be aligned).
+inline bsls::Types::Uint64 load64(const unsigned char* data)
+{
+    bsls::Types::Uint64 word;
+    bsl::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+/// Return true if the running CPU supports the `crc32` instructions, which
+/// the compiler was told it does.
+bool isSerialSupported()
+{
+    return true;
+}
+
+/// Return true if the running CPU supports the instructions used by
+/// `updateParallel`.
+bool isParallelSupported()
+{
+    return true;
+}
+
+/// Hardware implementation of `UpdateFn` computing a single stream.
+unsigned int updateSerial(unsigned int         state,
+                          const unsigned char* data,
+                          bsl::size_t          length)
+{
+    for (; length != 0 && (reinterpret_cast<bsls::Types::UintPtr>(data) & 7);
+         --length, ++data) {
+        state = __crc32cb(state, *data);
+    }
+
+    for (; length >= 8; length -= 8, data += 8) {
+        state = __crc32cd(state, load64(data));
+    }
+
+    for (; length != 0; --length, ++data) {
+        state = __crc32cb(state, *data);
+    }
+
+    return state;
+}
+
+/// Hardware implementation of `UpdateFn` computing 3 streams in parallel.
+/// Note that streams are combined in software, so only long streams are
+/// used.
+unsigned int updateParallel(unsigned int         state,
+                            const unsigned char* data,
+                            bsl::size_t          length)
+{
+    if (length < 3 * k_LONG_STREAM_LENGTH) {
+        return updateSerial(state, data, length);  // RETURN
+    }
+
+    for (; reinterpret_cast<bsls::Types::UintPtr>(data) & 7;
+         --length, ++data) {
+        state = __crc32cb(state, *data);
+    }
+
+    const unsigned int shiftOp = tables().d_longShift;
+    for (; length >= 3 * k_LONG_STREAM_LENGTH;
+         length -= 3 * k_LONG_STREAM_LENGTH) {
+        unsigned int               crc0 = state;
+        unsigned int               crc1 = 0;
+        unsigned int               crc2 = 0;
+        const unsigned char* const end  = data + k_LONG_STREAM_LENGTH;
+        do {
+            crc0 = __crc32cd(crc0, load64(data));
+            crc1 = __crc32cd(crc1, load64(data + k_LONG_STREAM_LENGTH));
+            crc2 = __crc32cd(crc2, load64(data + 2 * k_LONG_STREAM_LENGTH));
+            data += 8;
+        } while (data != end);
+
+        state = multiplyModP(crc0, shiftOp) ^ crc1;
+        state = multiplyModP(state, shiftOp) ^ crc2;
+        data += 2 * k_LONG_STREAM_LENGTH;
+    }
+
+    return updateSerial(state, data, length);
+}
+
+#else
+
+/// Return false: hardware acceleration is not supported on this platform.
+bool isSerialSupported()
+{
+    return false;
+}
+
+/// Return false: hardware acceleration is not supported on this platform.
+bool isParallelSupported()
+{
+    return false;
+}
+
+/// Fall back to the software implementation.
+unsigned int updateSerial(unsigned int         state,
+                          const unsigned char* data,
+                          bsl::size_t          length)
+{
+    return updateSoftware(state, data, length);
+}
+
+/// Fall back to the software implementation.
+unsigned int updateParallel(unsigned int         state,
+                            const unsigned char* data,
+                            bsl::size_t          length)
+{
+    return updateSoftware(state, data, length);
+}
+
+#endif
+
+/// Return the fastest implementation supported by the running CPU.
+UpdateFn selectDefault()
+{
+    if (isParallelSupported()) {
+        return &updateParallel;  // RETURN
+    }
+
+    if (isSerialSupported()) {
+        return &updateSerial;  // RETURN
+    }
+
+    return &updateSoftware;
+}
+
+/// Return the implementation used by `Crc32c::calculate`, selecting it on
+/// first use.
+UpdateFn defaultUpdateFn()
+{
+    static const UpdateFn s_updateFn = selectDefault();
+    return s_updateFn;
+}
 
 }  // close unnamed namespace
 
@@ -36,12 +480,14 @@ BSLA_MAYBE_UNUSED const char k_LOG_CATEGORY[] = "BMQP.CRC32C";
 // struct Crc32c
 // -------------
 
-const unsigned int Crc32c::k_NULL_CRC32C = bdlde::Crc32c::k_NULL_CRC32C;
+const unsigned int Crc32c::k_NULL_CRC32C = 0;
 
 unsigned int
 Crc32c::calculate(const void* data, unsigned int length, unsigned int crc)
 {
-    return bdlde::Crc32c::calculate(data, length, crc);
+    return ~defaultUpdateFn()(~crc,
+                              static_cast<const unsigned char*>(data),
+                              length);
 }
 
 unsigned int Crc32c::calculate(const bdlbb::Blob& blob, unsigned int crc)
@@ -52,18 +498,58 @@ unsigned int Crc32c::calculate(const bdlbb::Blob& blob, unsigned int crc)
         return crc;  // RETURN
     }
 
+    // Update the raw register buffer after buffer, rather than calling
+    // 'calculate' on each of them, to save the conditioning of the CRC
+    // between buffers.
+    const UpdateFn updateFn = defaultUpdateFn();
+    unsigned int   state    = ~crc;
+
     for (int i = 0; i < (numBuffers - 1); ++i) {
         const bdlbb::BlobBuffer& buffer = blob.buffer(i);
 
-        crc = calculate(buffer.data(), buffer.size(), crc);
+        state = updateFn(state,
+                         reinterpret_cast<const unsigned char*>(buffer.data()),
+                         buffer.size());
     }
 
     // Handle last data buffer
-    crc = calculate(blob.buffer(numBuffers - 1).data(),
-                    blob.lastDataBufferLength(),
-                    crc);
+    state = updateFn(state,
+                     reinterpret_cast<const unsigned char*>(
+                         blob.buffer(numBuffers - 1).data()),
+                     blob.lastDataBufferLength());
+
+    return ~state;
+}
+
+// ------------------
+// struct Crc32c_Impl
+// ------------------
+
+bool Crc32c_Impl::isHardwareAccelerated()
+{
+    return isSerialSupported();
+}
+
+unsigned int Crc32c_Impl::calculateSoftware(const void*  data,
+                                            unsigned int length,
+                                            unsigned int crc)
+{
+    return ~updateSoftware(~crc,
+                           static_cast<const unsigned char*>(data),
+                           length);
+}
+
+unsigned int Crc32c_Impl::calculateHardwareSerial(const void*  data,
+                                                  unsigned int length,
+                                                  unsigned int crc)
+{
+    if (!isSerialSupported()) {
+        return calculateSoftware(data, length, crc);  // RETURN
+    }
 
-    return crc;
+    return ~updateSerial(~crc,
+                         static_cast<const unsigned char*>(data),
+                         length);
 }
 
 }  // close package namespace
@@ -25,6 +25,7 @@
 // BDE
 #include <bdlbb_blobutil.h>
 #include <bdlde_crc32.h>
+#include <bdlde_crc32c.h>
 #include <bdlf_bind.h>
 #include <bdlt_timeunitratio.h>
 #include <bsl_algorithm.h>
@@ -191,6 +192,79 @@ static void populateBufferLengthsSorted_GoogleBenchmark_Large(
 }
 #endif
 
+/// Populate the specified `bufferLengths` with the payload sizes, from 64
+/// bytes to 1 Mi, over which the throughput of the implementations is
+/// compared.  Note that `bufferLengths` will be cleared.
+static void populateThroughputLengths(bsl::vector<int>* bufferLengths)
+{
+    BSLS_ASSERT_SAFE(bufferLengths);
+
+    bufferLengths->clear();
+    for (int length = 64; length <= 1048576; length *= 4) {
+        bufferLengths->push_back(length);
+    }
+}
+
+/// Enumeration of the implementations whose throughput is compared.
+struct Implementation {
+    enum Enum {
+        e_DEFAULT         = 0,
+        e_HARDWARE_SERIAL = 1,
+        e_SOFTWARE        = 2,
+        e_BDE             = 3
+    };
+
+    enum { k_COUNT = 4 };
+
+    /// Return the name of the specified `value`.
+    static const char* toAscii(Enum value)
+    {
+        switch (value) {
+        case e_DEFAULT: return "Default";
+        case e_HARDWARE_SERIAL: return "HW serial";
+        case e_SOFTWARE: return "Software";
+        case e_BDE: return "bdlde::Crc32c";
+        default: return "(* UNKNOWN *)";
+        }
+    }
+};
+
+/// Return the CRC32-C of the specified `length` bytes of the specified
+/// `buffer` computed with the specified `implementation`.
+static unsigned int calculateWith(Implementation::Enum implementation,
+                                  const char*          buffer,
+                                  unsigned int         length)
+{
+    switch (implementation) {
+    case Implementation::e_DEFAULT:
+        return bmqp::Crc32c::calculate(buffer, length);  // RETURN
+    case Implementation::e_HARDWARE_SERIAL:
+        return bmqp::Crc32c_Impl::calculateHardwareSerial(buffer,
+                                                          length);  // RETURN
+    case Implementation::e_SOFTWARE:
+        return bmqp::Crc32c_Impl::calculateSoftware(buffer, length);  // RETURN
+    case Implementation::e_BDE:
+    default: return bdlde::Crc32c::calculate(buffer, length);  // RETURN
+    }
+}
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+/// Apply to the specified `b` Google Benchmark the arguments of
+/// `testN7_calculateThroughputBySize`: each payload size returned by
+/// `populateThroughputLengths`, for each implementation.
+static void
+populateThroughputArgs_GoogleBenchmark(benchmark::internal::Benchmark* b)
+{
+    bsl::vector<int> bufferLengths;
+    populateThroughputLengths(&bufferLengths);
+    for (int impl = 0; impl < Implementation::k_COUNT; ++impl) {
+        for (size_t i = 0; i < bufferLengths.size(); ++i) {
+            b->Args({bufferLengths[i], impl});
+        }
+    }
+}
+#endif
+
 /// Print the specified `headers` to the specified `out` in the following
 /// format:
 ///
@@ -567,10 +641,26 @@ static void test3_calculateOnMisalignedBuffer()
             unsigned int crc32cDefault =
                 bmqp::Crc32c::calculate(allocPtr + i, testBufLength);
 
+            // Software
+            unsigned int crc32cSoftware =
+                bmqp::Crc32c_Impl::calculateSoftware(allocPtr + i,
+                                                     testBufLength);
+
+            // Hardware serial
+            unsigned int crc32cHwSerial =
+                bmqp::Crc32c_Impl::calculateHardwareSerial(allocPtr + i,
+                                                           testBufLength);
+
             // Verify correctness
             BMQTST_ASSERT_EQ_D("line " << test.d_line << " (Default)",
                                crc32cDefault,
                                test.d_expectedCrc32c);
+            BMQTST_ASSERT_EQ_D("line " << test.d_line << " (Software)",
+                               crc32cSoftware,
+                               test.d_expectedCrc32c);
+            BMQTST_ASSERT_EQ_D("line " << test.d_line << " (HW serial)",
+                               crc32cHwSerial,
+                               test.d_expectedCrc32c);
         }
     }
 }
@@ -765,6 +855,98 @@ static void test5_multithreadedCrc32cDefault()
     }
 }
 
+static void test6_calculateImplementationsConsistency()
+// ------------------------------------------------------------------------
+// CALCULATE CRC32-C IMPLEMENTATIONS CONSISTENCY
+//
+// Concerns:
+//   Ensure that the default implementation, which may process the input as
+//   interleaved streams of various lengths, and the alternative
+//   implementations all yield the same CRC32-C as BDE's implementation,
+//   for any length, alignment and previous CRC.
+//
+// Plan:
+//   - For lengths around every boundary between the way the input is split
+//     into streams, and for every misalignment, calculate CRC32-C with each
+//     implementation using a random previous CRC, and compare the results
+//     to the one computed by 'bdlde::Crc32c'.
+//
+// Testing:
+//   - bmqp::Crc32c::calculate(const void   *data,
+//                             unsigned int  length,
+//                             unsigned int  crc = k_NULL_CRC32C);
+//   - bmqp::Crc32c_Impl::calculateSoftware(...);
+//   - bmqp::Crc32c_Impl::calculateHardwareSerial(...);
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName(
+        "CALCULATE CRC32-C IMPLEMENTATIONS CONSISTENCY");
+
+    PV("Hardware accelerated: " << bsl::boolalpha
+                                << bmqp::Crc32c_Impl::isHardwareAccelerated());
+
+    // Lengths, in bytes, of each stream of short and long blocks (see the
+    // implementation notes of the component).
+    const int k_SHORT = 256;
+    const int k_LONG  = 8192;
+    const int k_BASE_LENGTHS[] = {0,
+                                  1,
+                                  7,
+                                  8,
+                                  9,
+                                  3 * k_SHORT,
+                                  2 * 3 * k_SHORT,
+                                  3 * k_LONG,
+                                  3 * k_LONG + 3 * k_SHORT,
+                                  2 * 3 * k_LONG + 2 * 3 * k_SHORT + 8};
+    const int k_NUM_BASE_LENGTHS = sizeof(k_BASE_LENGTHS) /
+                                   sizeof(*k_BASE_LENGTHS);
+    const int k_MAX_OFFSET       = 8;
+    const int k_MAX_DELTA        = 9;
+    const int k_BUFFER_SIZE      = k_BASE_LENGTHS[k_NUM_BASE_LENGTHS - 1] +
+                              k_MAX_DELTA + k_MAX_OFFSET;
+
+    bsl::vector<char> buffer(k_BUFFER_SIZE,
+                             bmqtst::TestHelperUtil::allocator());
+    bsl::generate(buffer.begin(), buffer.end(), bsl::rand);
+
+    for (int lIdx = 0; lIdx < k_NUM_BASE_LENGTHS; ++lIdx) {
+        for (int delta = -k_MAX_DELTA; delta <= k_MAX_DELTA; ++delta) {
+            const int length = k_BASE_LENGTHS[lIdx] + delta;
+            if (length < 0) {
+                continue;  // CONTINUE
+            }
+
+            for (int offset = 0; offset < k_MAX_OFFSET; ++offset) {
+                const char*        data = buffer.data() + offset;
+                const unsigned int previousCrc =
+                    static_cast<unsigned int>(bsl::rand());
+                const unsigned int expected =
+                    bdlde::Crc32c::calculate(data, length, previousCrc);
+
+                PVVV("length: " << length << ", offset: " << offset);
+
+                BMQTST_ASSERT_EQ_D(
+                    "length " << length << ", offset " << offset,
+                    bmqp::Crc32c::calculate(data, length, previousCrc),
+                    expected);
+                BMQTST_ASSERT_EQ_D(
+                    "length " << length << ", offset " << offset,
+                    bmqp::Crc32c_Impl::calculateSoftware(data,
+                                                         length,
+                                                         previousCrc),
+                    expected);
+                BMQTST_ASSERT_EQ_D(
+                    "length " << length << ", offset " << offset,
+                    bmqp::Crc32c_Impl::calculateHardwareSerial(data,
+                                                               length,
+                                                               previousCrc),
+                    expected);
+            }
+        }
+    }
+}
+
 static void test7_calculateOnBlob()
 // ------------------------------------------------------------------------
 // CALCULATE CRC32-C ON BLOB w/o PREVIOUS CRC
@@ -1682,6 +1864,88 @@ static void testN6_bdldPerformanceDefault()
     bmqtst::TestHelperUtil::allocator()->deallocate(buffer);
 }
 
+BSLA_MAYBE_UNUSED
+static void testN7_calculateThroughputBySize()
+// ------------------------------------------------------------------------
+// BENCHMARK: CALCULATE CRC32-C THROUGHPUT BY PAYLOAD SIZE
+//
+// Concerns:
+//   Compare the throughput (GB/s) of CRC32-C calculation using the default,
+//   the hardware-accelerated serial, the software and BDE's
+//   implementations, for payloads from 64 bytes to 1 Mi, in a single
+//   thread environment.
+//
+// Plan:
+//   - For each payload size, time the calculation of CRC32-C on about
+//     1 GiB of data using each implementation, and report the resulting
+//     throughput.
+//
+// Testing:
+//   Throughput (GB/s) of CRC32-C calculation by payload size.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    bmqtst::TestHelperUtil::ignoreCheckGblAlloc() = true;
+    bmqtst::TestHelper::printTestName(
+        "BENCHMARK: CALCULATE CRC32-C THROUGHPUT BY PAYLOAD SIZE");
+
+    const bsls::Types::Int64 k_BYTES_PER_RUN = 1024 * 1024 * 1024;  // 1 Gi
+
+    bsl::vector<int> bufferLengths(bmqtst::TestHelperUtil::allocator());
+    populateThroughputLengths(&bufferLengths);
+
+    // Read in random input
+    bsl::vector<char> buffer(bufferLengths.back(),
+                             bmqtst::TestHelperUtil::allocator());
+    bsl::generate(buffer.begin(), buffer.end(), bsl::rand);
+
+    bmqu::OutStreamFormatSaver fmtSaver(bsl::cout);
+
+    cout << "\nHardware accelerated: " << bsl::boolalpha
+         << bmqp::Crc32c_Impl::isHardwareAccelerated() << "\n\n";
+
+    cout << "| " << bsl::setw(8) << "Size(B)";
+    for (int impl = 0; impl < Implementation::k_COUNT; ++impl) {
+        cout << " | " << bsl::setw(14)
+             << Implementation::toAscii(
+                    static_cast<Implementation::Enum>(impl));
+    }
+    cout << " |  (GB/s)\n";
+
+    cout << bsl::fixed << bsl::setprecision(3);
+    for (size_t i = 0; i < bufferLengths.size(); ++i) {
+        const int                length   = bufferLengths[i];
+        const bsls::Types::Int64 numIters = k_BYTES_PER_RUN / length;
+
+        cout << "| " << bsl::setw(8) << length;
+        for (int impl = 0; impl < Implementation::k_COUNT; ++impl) {
+            const Implementation::Enum implementation =
+                static_cast<Implementation::Enum>(impl);
+
+            unsigned int crc32c = calculateWith(implementation,
+                                                buffer.data(),
+                                                length);
+
+            // <time>
+            const bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+            for (bsls::Types::Int64 iter = 0; iter < numIters; ++iter) {
+                crc32c ^= calculateWith(implementation, buffer.data(), length);
+            }
+            const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() -
+                                               startTime;
+            // </time>
+
+            // Bytes per nanosecond are GB per second.
+            const double throughput = static_cast<double>(numIters * length) /
+                                      static_cast<double>(elapsed);
+            cout << " | " << bsl::setw(14) << throughput;
+            static_cast<void>(crc32c);
+        }
+        cout << " |\n";
+    }
+    cout << endl;
+}
+
 #ifdef BMQTST_BENCHMARK_ENABLED
 
 static void
@@ -1943,6 +2207,41 @@ testN6_bdldPerformanceDefault_GoogleBenchmark(benchmark::State& state)
     bmqtst::TestHelperUtil::allocator()->deallocate(buffer);
 }
 
+static void
+testN7_calculateThroughputBySize_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: CALCULATE CRC32-C THROUGHPUT BY PAYLOAD SIZE
+//
+// Concerns:
+//   Compare the throughput of CRC32-C calculation using the default, the
+//   hardware-accelerated serial, the software and BDE's implementations,
+//   for payloads from 64 bytes to 1 Mi.
+//
+// Plan:
+//   - Calculate CRC32-C on a payload of the size specified by the first
+//     argument, using the implementation specified by the second argument,
+//     and report the number of bytes processed per second.
+//
+// Testing:
+//   Throughput (GB/s) of CRC32-C calculation by payload size.
+// ------------------------------------------------------------------------
+{
+    const int                  length = static_cast<int>(state.range(0));
+    const Implementation::Enum implementation =
+        static_cast<Implementation::Enum>(state.range(1));
+
+    bsl::vector<char> buffer(length, bmqtst::TestHelperUtil::allocator());
+    bsl::generate(buffer.begin(), buffer.end(), bsl::rand);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            calculateWith(implementation, buffer.data(), length));
+    }
+
+    state.SetBytesProcessed(state.iterations() * length);
+    state.SetLabel(Implementation::toAscii(implementation));
+}
+
 #endif  // BMQTST_BENCHMARK_ENABLED
 
 // ============================================================================
@@ -1965,7 +2264,7 @@ int main(int argc, char* argv[])
     case 0:
     case 8: test8_calculateOnBlobWithPreviousCrc(); break;
     case 7: test7_calculateOnBlob(); break;
-    case 6: break;
+    case 6: test6_calculateImplementationsConsistency(); break;
     case 5: test5_multithreadedCrc32cDefault(); break;
     case 4: test4_calculateOnBufferWithPreviousCrc(); break;
     case 3: test3_calculateOnMisalignedBuffer(); break;
@@ -2001,6 +2300,11 @@ int main(int argc, char* argv[])
             testN6_bdldPerformanceDefault,
             Apply(populateBufferLengthsSorted_GoogleBenchmark_Large));
         break;
+    case -7:
+        BMQTST_BENCHMARK_WITH_ARGS(
+            testN7_calculateThroughputBySize,
+            Apply(populateThroughputArgs_GoogleBenchmark));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
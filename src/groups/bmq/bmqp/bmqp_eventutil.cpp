@@ -113,6 +113,15 @@ class Flattener {
 
     bmqp::SchemaLearner& d_schemaLearner;
 
+    int d_numPartitions;
+    // Number of partitions the
+    // messages are split into
+
+    int d_partition;
+    // Partition of the messages to
+    // flatten, the other ones being
+    // skipped
+
     // PRIVATE TYPES
     typedef bdlma::LocalSequentialAllocator<
         32 * sizeof(Protocol::SubQueueIdsArrayOld::value_type)>
@@ -180,18 +189,23 @@ class Flattener {
     // CREATORS
 
     /// Create a `Flattener` using the specified `eventInfos`, `event`,
-    /// `blobSpPool_p`, `bufferFactory` and `allocator`
+    /// `blobSpPool_p`, `bufferFactory` and `allocator`.  Only flatten the
+    /// messages of the specified `event` belonging to the specified
+    /// `partition` out of the specified `numPartitions` (see
+    /// `EventUtil::partitionPushEvent`).
     Flattener(bsl::vector<EventUtilEventInfo>* eventInfos,
               const Event&                     event,
               bdlbb::BlobBufferFactory*        bufferFactory,
               BlobSpPool*                      blobSpPool_p,
               bmqp::SchemaLearner&             schemaLearner,
+              int                              numPartitions,
+              int                              partition,
               bslma::Allocator*                allocator = 0);
 
     // MANIPULATORS
 
-    /// Iterate over each message and pack that message once per subQueueId
-    /// (or once if there is no subQueueId)
+    /// Iterate over each message of the partition and pack that message
+    /// once per subQueueId (or once if there is no subQueueId)
     int flattenPushEvent();
 };
 
@@ -433,6 +447,8 @@ Flattener::Flattener(bsl::vector<EventUtilEventInfo>* eventInfos,
                      bdlbb::BlobBufferFactory*        bufferFactory,
                      BlobSpPool*                      blobSpPool_p,
                      bmqp::SchemaLearner&             schemaLearner,
+                     int                              numPartitions,
+                     int                              partition,
                      bslma::Allocator*                allocator)
 : d_eventInfos_p(eventInfos)
 , d_allocator_p(bslma::Default::allocator(allocator))
@@ -442,7 +458,13 @@ Flattener::Flattener(bsl::vector<EventUtilEventInfo>* eventInfos,
 , d_appData(bufferFactory, allocator)
 , d_optionsView(allocator)
 , d_schemaLearner(schemaLearner)
+, d_numPartitions(numPartitions)
+, d_partition(partition)
 {
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < numPartitions);
+    BSLS_ASSERT_SAFE(0 <= partition && partition < numPartitions);
+
     event.loadPushMessageIterator(&d_msgIterator);
     BSLS_ASSERT_SAFE(d_msgIterator.isValid());
 }
@@ -455,6 +477,13 @@ int Flattener::flattenPushEvent()
     //       the following iteration will happen at least once.
     while (BSLS_PERFORMANCEHINT_PREDICT_LIKELY((rc = d_msgIterator.next()) ==
                                                1)) {
+        if (d_numPartitions > 1 &&
+            EventUtil::pushMessagePartition(d_msgIterator.header().queueId(),
+                                            d_numPartitions) != d_partition) {
+            // Message belonging to another partition
+            continue;  // CONTINUE
+        }
+
         // Reset because it might have data from previous iterations.
         d_appData.removeAll();
 
@@ -506,8 +535,10 @@ int Flattener::flattenPushEvent()
     }
 
     // Flush the last.  Since the event was valid, there will always be at
-    // least one message.
-    advanceEvent();
+    // least one message, unless all of them belong to other partitions.
+    if (d_builder.messageCount() > 0) {
+        advanceEvent();
+    }
 
     return rc_SUCCESS;
 }
@@ -536,9 +567,50 @@ int EventUtil::flattenPushEvent(bsl::vector<EventUtilEventInfo>* eventInfos,
                         bufferFactory,
                         blobSpPool_p,
                         schemaLearner,
+                        1,  // numPartitions
+                        0,  // partition
                         allocator);
     return flattener.flattenPushEvent();
 }
 
+int EventUtil::partitionPushEvent(
+    bsl::vector<EventUtilEventInfo>* eventInfos,
+    const Event&                     event,
+    int                              numPartitions,
+    bdlbb::BlobBufferFactory*        bufferFactory,
+    BlobSpPool*                      blobSpPool_p,
+    bmqp::SchemaLearner&             schemaLearner,
+    bslma::Allocator*                allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(eventInfos);
+    BSLS_ASSERT_SAFE(eventInfos->empty());
+    BSLS_ASSERT_SAFE(event.isValid() && event.isPushEvent());
+    BSLS_ASSERT_SAFE(0 < numPartitions);
+    BSLS_ASSERT_SAFE(bufferFactory);
+    BSLS_ASSERT_SAFE(allocator);
+
+    // Go through the event once per partition, so that the events built for
+    // each of them are appended to 'eventInfos' in the order of the
+    // partitions.
+    for (int partition = 0; partition < numPartitions; ++partition) {
+        Flattener flattener(eventInfos,
+                            event,
+                            bufferFactory,
+                            blobSpPool_p,
+                            schemaLearner,
+                            numPartitions,
+                            partition,
+                            allocator);
+
+        const int rc = flattener.flattenPushEvent();
+        if (rc != 0) {
+            return rc;  // RETURN
+        }
+    }
+
+    return 0;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -42,6 +42,7 @@
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
 
 namespace BloombergLP {
 
@@ -139,6 +140,30 @@ struct EventUtil {
                                 BlobSpPool*                      blobSpPool_p,
                                 bmqp::SchemaLearner&             schemaLearner,
                                 bslma::Allocator*                allocator);
+
+    /// Split the specified `event` into events holding each the messages
+    /// of one of the specified `numPartitions`, flattened as by
+    /// `flattenPushEvent`, and append them to the specified `eventInfos`
+    /// using the specified `bufferFactory`, `blobSpPool_p`, `schemaLearner`
+    /// and `allocator`.  A message belongs to the partition returned by
+    /// `pushMessagePartition` for its queue id, and the messages of a
+    /// partition keep their relative order; no event is appended for a
+    /// partition without any message.  Return 0 on success, or non-zero
+    /// error code in case of failure.  The behavior is undefined unless the
+    /// `event` is a valid push event and `0 < numPartitions`.
+    static int
+    partitionPushEvent(bsl::vector<EventUtilEventInfo>* eventInfos,
+                       const Event&                     event,
+                       int                              numPartitions,
+                       bdlbb::BlobBufferFactory*        bufferFactory,
+                       BlobSpPool*                      blobSpPool_p,
+                       bmqp::SchemaLearner&             schemaLearner,
+                       bslma::Allocator*                allocator);
+
+    /// Return the partition, out of the specified `numPartitions`, of a
+    /// message of the queue having the specified `queueId`.  The behavior
+    /// is undefined unless `0 < numPartitions`.
+    static int pushMessagePartition(int queueId, int numPartitions);
 };
 
 // ============================================================================
@@ -193,6 +218,19 @@ inline EventUtilEventInfo::EventUtilEventInfo(
     // NOTHING
 }
 
+// ----------------
+// struct EventUtil
+// ----------------
+
+inline int EventUtil::pushMessagePartition(int queueId, int numPartitions)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < numPartitions);
+
+    return static_cast<int>(static_cast<unsigned int>(queueId) %
+                            static_cast<unsigned int>(numPartitions));
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -854,6 +854,125 @@ static void test3_flattenWithMessageProperties()
     }
 }
 
+static void test4_partitionPushEvent()
+// ------------------------------------------------------------------------
+// PARTITION PUSH EVENT
+//
+// Concerns:
+//   Partitioning an event results in one event per partition holding, in
+//   their original order, the messages of the queues of that partition,
+//   flattened, and no event for the partitions without any message.
+//
+// Plan:
+//   1) Create an event composed of 6 messages of queues 0 to 5, the
+//      message of queue 4 having two SubQueueIds.
+//   2) Partition the event in 4 partitions.
+//   3) Verify that the partitioning results in 3 events, respectively
+//      holding the messages of queues 0 and 4 (twice), 1 and 5, and 2,
+//      while partition 3 is empty.
+//
+// Testing:
+//   - 'partitionPushEvent(...)'
+//   - 'pushMessagePartition(...)'
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PARTITION PUSH EVENT");
+
+    const int k_NUM_MESSAGES   = 6;
+    const int k_NUM_PARTITIONS = 4;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+    bmqp::PushEventBuilder pushEventBuilder(
+        blobSpPool.get(),
+        bmqtst::TestHelperUtil::allocator());
+    bsl::vector<Data> data(bmqtst::TestHelperUtil::allocator());
+
+    BMQTST_ASSERT_EQ(bmqp::EventUtil::pushMessagePartition(0, 4), 0);
+    BMQTST_ASSERT_EQ(bmqp::EventUtil::pushMessagePartition(5, 4), 1);
+    BMQTST_ASSERT_EQ(bmqp::EventUtil::pushMessagePartition(7, 1), 0);
+
+    // 1) Event composed of 6 messages, of queues 0 to 5
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        appendDatum(&data,
+                    i == 4 ? 2 : 1,  // numSubQueueInfos
+                    generateRandomInteger(1, 120),
+                    &bufferFactory,
+                    bmqtst::TestHelperUtil::allocator());
+    }
+
+    appendMessages(&pushEventBuilder, data);
+    bmqp::Event event(pushEventBuilder.blob(),
+                      bmqtst::TestHelperUtil::allocator());
+
+    // 2) Partition the event
+    bsl::vector<bmqp::EventUtilEventInfo> eventInfos(
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::SchemaLearner theLearner(bmqtst::TestHelperUtil::allocator());
+    int                 rc = bmqp::EventUtil::partitionPushEvent(
+        &eventInfos,
+        event,
+        k_NUM_PARTITIONS,
+        &bufferFactory,
+        blobSpPool.get(),
+        theLearner,
+        bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(rc, 0);
+    BMQTST_ASSERT_EQ(eventInfos.size(), 3u);
+
+    // 3) Verify the messages of each partition
+    // Queue ids of the messages of each partition, padded with -1
+    const int k_EXPECTED_QUEUE_IDS[][3] = {{0, 4, 4},
+                                           {1, 5, -1},
+                                           {2, -1, -1}};
+    const int k_EXPECTED_NUM_MESSAGES[] = {3, 2, 1};
+
+    for (bsl::size_t i = 0; i < eventInfos.size(); ++i) {
+        bmqp::Event               partitionEvent(eventInfos[i].d_blob_sp,
+                                   bmqtst::TestHelperUtil::allocator());
+        bmqp::PushMessageIterator msgIterator(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator());
+        partitionEvent.loadPushMessageIterator(&msgIterator, true);
+        BSLS_ASSERT_OPT(msgIterator.isValid());
+
+        int numMessages = 0;
+        while ((rc = msgIterator.next()) == 1) {
+            BSLS_ASSERT_OPT(numMessages < 3);
+
+            const int queueId = msgIterator.header().queueId();
+            BMQTST_ASSERT_EQ_D(i,
+                               queueId,
+                               k_EXPECTED_QUEUE_IDS[i][numMessages]);
+            BMQTST_ASSERT_EQ_D(i,
+                               eventInfos[i].d_ids[numMessages]
+                                   .d_header.queueId(),
+                               queueId);
+
+            bdlbb::Blob payload(&bufferFactory,
+                                bmqtst::TestHelperUtil::allocator());
+            rc = msgIterator.loadMessagePayload(&payload);
+            BSLS_ASSERT_OPT(rc == 0);
+            BMQTST_ASSERT_EQ_D(
+                i,
+                bdlbb::BlobUtil::compare(data[queueId].d_payload, payload),
+                0);
+
+            ++numMessages;
+        }
+        BMQTST_ASSERT_EQ_D(i, rc, 0);
+        BMQTST_ASSERT_EQ_D(i,
+                           eventInfos[i].d_ids.size(),
+                           static_cast<bsl::size_t>(numMessages));
+        BMQTST_ASSERT_EQ_D(i, numMessages, k_EXPECTED_NUM_MESSAGES[i]);
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -868,6 +987,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 4: test4_partitionPushEvent(); break;
     case 3: test3_flattenWithMessageProperties(); break;
     case 2: test2_flattenExplodesEvent(); break;
     case 1: test1_breathingTest(); break;
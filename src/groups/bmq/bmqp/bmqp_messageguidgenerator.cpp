@@ -26,16 +26,20 @@
 #include <ball_log.h>
 #include <bdlb_bigendian.h>
 #include <bdlb_bitmaskutil.h>
+#include <bdlb_bitutil.h>
 #include <bdlb_print.h>
 #include <bdlde_md5.h>
 #include <bdlma_localsequentialallocator.h>
 #include <bdls_processutil.h>
+#include <bsl_cstdint.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bsl_string.h>
+#include <bslmf_assert.h>
 #include <bsls_assert.h>
 #include <bsls_keyword.h>
+#include <bsls_performancehint.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeutil.h>
 
@@ -66,6 +70,13 @@ static const int k_COUNTER_START_IDX = 8;
 static const int k_COUNTER_MASK = bdlb::BitMaskUtil::one(k_COUNTER_START_IDX,
                                                          k_COUNTER_BITS);
 
+// The counter is made of the index of a thread range in its most significant
+// bits, followed by 'k_THREAD_COUNTER_BITS' bits of a counter within that
+// range.
+static const int          k_THREAD_COUNTER_BITS = 16;
+static const unsigned int k_THREAD_COUNTER_MASK =
+    bdlb::BitMaskUtil::lt(k_THREAD_COUNTER_BITS);
+
 const int k_GUID_VERSION_AND_COUNTER_BYTES = 3;
 
 /// Number of bytes used to encode those various fields.
@@ -79,11 +90,84 @@ const BSLS_KEYWORD_CONSTEXPR int k_HOSTNAME_LEN = 128;
 // class MessageGUIDGenerator
 // --------------------------
 
+// PRIVATE CLASS METHODS
+void MessageGUIDGenerator::onThreadExit(void* threadRange)
+{
+    ThreadRange* range = static_cast<ThreadRange*>(threadRange);
+    if (range->d_index == 0) {
+        // Shared range, which is never handed out.
+        return;  // RETURN
+    }
+
+    // Give the range back, for the next thread to continue incrementing its
+    // counter.
+    bsls::AtomicUint64& freeRanges = range->d_generator_p->d_freeThreadRanges;
+
+    const bsls::Types::Uint64 bit = bsls::Types::Uint64(1) << range->d_index;
+
+    bsls::Types::Uint64 expected = freeRanges.load();
+    for (;;) {
+        const bsls::Types::Uint64 previous =
+            freeRanges.testAndSwap(expected, expected | bit);
+        if (previous == expected) {
+            break;  // BREAK
+        }
+        expected = previous;
+    }
+}
+
+// PRIVATE MANIPULATORS
+MessageGUIDGenerator::ThreadRange* MessageGUIDGenerator::threadRange()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_hasThreadRangeKey)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return &d_threadRanges[0];  // RETURN
+    }
+
+    ThreadRange* range = static_cast<ThreadRange*>(
+        bslmt::ThreadUtil::getSpecific(d_threadRangeKey));
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(range)) {
+        return range;  // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    // First GUID generated by this thread: hand it the free range with the
+    // lowest index, if any, or the shared range otherwise.
+    range = &d_threadRanges[0];
+
+    bsls::Types::Uint64 freeRanges = d_freeThreadRanges.load();
+    while (freeRanges != 0) {
+        const int index = bdlb::BitUtil::numTrailingUnsetBits(
+            static_cast<bsl::uint64_t>(freeRanges));
+        const bsls::Types::Uint64 previous = d_freeThreadRanges.testAndSwap(
+            freeRanges,
+            freeRanges & ~(bsls::Types::Uint64(1) << index));
+        if (previous == freeRanges) {
+            range = &d_threadRanges[index];
+            break;  // BREAK
+        }
+        freeRanges = previous;
+    }
+
+    if (0 != bslmt::ThreadUtil::setSpecific(d_threadRangeKey, range)) {
+        // The range would never be given back: give it back right away.
+        onThreadExit(range);
+        return &d_threadRanges[0];  // RETURN
+    }
+
+    return range;
+}
+
 // CREATORS
 MessageGUIDGenerator::MessageGUIDGenerator(int sessionId, bool doIpResolving)
 : d_clientId()
 , d_clientIdHex()
 , d_counter(0)
+, d_freeThreadRanges(~bsls::Types::Uint64(1))  // all ranges but range 0
+, d_threadRangeKey()
+, d_hasThreadRangeKey(false)
+, d_threadRanges()
 , d_nanoSecondsFromEpoch(
       bsls::SystemTime::nowRealtimeClock().totalNanoseconds())
 , d_timerBaseOffset(bsls::TimeUtil::getTimer())
@@ -91,6 +175,24 @@ MessageGUIDGenerator::MessageGUIDGenerator(int sessionId, bool doIpResolving)
     // NOTE: 'BE' suffix in variable name implies that variable's value is
     //       big-endian (network byte order).
 
+    BSLMF_ASSERT(k_NUM_THREAD_RANGES ==
+                 (1 << (k_COUNTER_BITS - k_THREAD_COUNTER_BITS)));
+    BSLMF_ASSERT(k_NUM_THREAD_RANGES <= 64);  // 'd_freeThreadRanges' bits
+    BSLMF_ASSERT(sizeof(ThreadRange) == k_CACHE_LINE_SIZE);
+
+    for (int i = 0; i < k_NUM_THREAD_RANGES; ++i) {
+        d_threadRanges[i].d_counter     = 0;
+        d_threadRanges[i].d_index       = i;
+        d_threadRanges[i].d_generator_p = this;
+    }
+
+    d_hasThreadRangeKey = (0 == bslmt::ThreadUtil::createKey(&d_threadRangeKey,
+                                                             &onThreadExit));
+    if (!d_hasThreadRangeKey) {
+        BALL_LOG_WARN << "Failed to create a thread-specific storage key, "
+                      << "all threads will share the same GUID counter.";
+    }
+
     // Get hostname
     bdlma::LocalSequentialAllocator<k_HOSTNAME_LEN> hostnameAlloc;
     bsl::string                                     hostname(&hostnameAlloc);
@@ -180,6 +282,16 @@ MessageGUIDGenerator::MessageGUIDGenerator(int sessionId, bool doIpResolving)
                   << ", clientID: " << d_clientIdHex << "]";
 }
 
+MessageGUIDGenerator::~MessageGUIDGenerator()
+{
+    if (d_hasThreadRangeKey) {
+        // Note that the ranges handed to threads still alive are not given
+        // back when they exit, once the key is deleted.
+        bslmt::ThreadUtil::deleteKey(d_threadRangeKey);
+    }
+}
+
+// MANIPULATORS
 void MessageGUIDGenerator::generateGUID(bmqt::MessageGUID* guid)
 {
     // PRECONDITIONS
@@ -188,10 +300,16 @@ void MessageGUIDGenerator::generateGUID(bmqt::MessageGUID* guid)
     // NOTE: 'BE' suffix in variable name implies that variable's value is
     //       big-endian (network byte order)
 
+    ThreadRange* range = threadRange();
+
     // Get a snapshot of timer tick and counter values
     const bsls::Types::Int64 timerTickDiff = bsls::TimeUtil::getTimer() -
                                              d_timerBaseOffset;
-    const unsigned int counter = d_counter++;
+    const unsigned int rangeCounter = range->d_index == 0
+                                          ? d_counter++
+                                          : range->d_counter++;
+    const unsigned int counter = (range->d_index << k_THREAD_COUNTER_BITS) |
+                                 (rangeCounter & k_THREAD_COUNTER_MASK);
 
     // Below, we use our knowledge of internal memory layout of
     // bmqt::MessageGUID to populate its data member.  Alternatives are:
@@ -55,8 +55,10 @@
 /// MessageGUID format notes and limitation
 ///---------------------------------------
 //: o !counter!: used to account for potential lack of resolution of the timer.
-//:   With 22 bits, this scheme allows up to 2^22 - 1 = 4,194,303 unique GUID
-//:   generation per timer clock resolution.
+//:   The 22 bits are made of a 6 bits thread range, followed by a 16 bits
+//:   counter within that range (see 'Thread ranges' below), which allows up
+//:   to 2^16 = 65,536 unique GUID generation per timer clock resolution and
+//:   per thread.
 //: o !timerTick!: represents the number of nanoseconds since this
 //:   'MessageGUIDGenerator' was instantiated.  In order to account for
 //:   potentially low resolution timers on some platforms, the counter field is
@@ -70,6 +72,19 @@
 //:   counter) allows to retrieve creation time of a given GUID, which is
 //:   useful upon troubleshooting.
 //
+/// Thread ranges
+///-------------
+// In order for threads to generate GUIDs concurrently without contending on a
+// shared counter, the counter space is divided into 64 ranges: a thread
+// generating its first GUID is handed a range for its exclusive use (until
+// it exits), and then only increments a counter of its own.  Two threads
+// therefore never generate the same counter, and neither do two GUIDs of the
+// same thread within a timer clock resolution, which makes GUIDs unique.
+// Range 0 is reserved to the threads which could not be handed a range of
+// their own, either because more than 63 threads are generating GUIDs, or
+// because thread-specific storage is unavailable: such threads share a
+// single atomic counter instead.
+//
 /// MessageGUID deciphering
 ///-----------------------
 // See test case -1 of the associated unit test for extracting fields and
@@ -82,6 +97,7 @@
 // BDE
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
+#include <bslmt_threadutil.h>
 #include <bsls_atomic.h>
 #include <bsls_cpp11.h>
 #include <bsls_types.h>
@@ -112,6 +128,34 @@ class MessageGUIDGenerator {
     // Number of bytes used to store the clientId in binary and hex format.
     static const int k_CLIENT_ID_LEN_HEX = 2 * k_CLIENT_ID_LEN_BINARY;
 
+    // Number of ranges the counter space is divided into (see `Thread
+    // ranges` section of the component level documentation).
+    static const int k_NUM_THREAD_RANGES = 64;
+
+    static const int k_CACHE_LINE_SIZE = 64;
+
+  private:
+    // PRIVATE TYPES
+
+    /// Range of counters used by one thread at a time, padded to a cache
+    /// line so that threads do not write to the same one.
+    struct ThreadRange {
+        // DATA
+
+        /// Counter of the next GUID generated in this range.  Only modified
+        /// by the thread this range is handed to.
+        unsigned int d_counter;
+
+        /// Index of this range.
+        unsigned int d_index;
+
+        /// Generator this range belongs to.
+        MessageGUIDGenerator* d_generator_p;
+
+        char d_padding[k_CACHE_LINE_SIZE - 2 * sizeof(unsigned int) -
+                       sizeof(MessageGUIDGenerator*)];
+    };
+
   private:
     // DATA
     char d_clientId[k_CLIENT_ID_LEN_BINARY];
@@ -120,9 +164,23 @@ class MessageGUIDGenerator {
     //       null character.
     char d_clientIdHex[k_CLIENT_ID_LEN_HEX + 1];
 
-    // Monotonically incrementing counter per every GUID generated.
+    // Monotonically incrementing counter per every GUID generated by the
+    // threads sharing range 0.
     bsls::AtomicUint d_counter;
 
+    // Bit mask of the ranges which are not handed to any thread.  Note that
+    // range 0 is never handed out.
+    bsls::AtomicUint64 d_freeThreadRanges;
+
+    // Key to the range handed to the calling thread.
+    bslmt::ThreadUtil::Key d_threadRangeKey;
+
+    // Whether `d_threadRangeKey` was successfully created.
+    bool d_hasThreadRangeKey;
+
+    // Ranges of the counter space.
+    ThreadRange d_threadRanges[k_NUM_THREAD_RANGES];
+
     // This can be used to retrieve the timestamp from the TimerTick part
     // of the GUID (see test -1 of this component).
     const bsls::Types::Int64 d_nanoSecondsFromEpoch;
@@ -140,6 +198,20 @@ class MessageGUIDGenerator {
     MessageGUIDGenerator&
     operator=(const MessageGUIDGenerator&) BSLS_CPP11_DELETED;
 
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Give back the specified `threadRange` to its generator.  This method
+    /// is invoked when a thread which was handed `threadRange` exits.
+    static void onThreadExit(void* threadRange);
+
+    // PRIVATE MANIPULATORS
+
+    /// Return the range to use by the calling thread, handing it one of the
+    /// free ranges on the first call from that thread, or range 0 if there
+    /// is none.
+    ThreadRange* threadRange();
+
   public:
     // CREATORS
 
@@ -148,11 +220,16 @@ class MessageGUIDGenerator {
     /// hostname ip address is done if `doIpResolving` flag is set.
     explicit MessageGUIDGenerator(int sessionId, bool doIpResolving = true);
 
+    /// Destroy this object.  The behavior is undefined unless no thread is
+    /// generating a GUID with this object.
+    ~MessageGUIDGenerator();
+
     // MANIPULATORS
 
     /// Generate a new MessageGUID. This method can be called simultaneously
-    /// from multiple threads.  Behavior is undefined unless specified
-    /// `guid` is non-null.
+    /// from multiple threads, which do not contend with each other (see
+    /// `Thread ranges` section of the component level documentation).
+    /// Behavior is undefined unless specified `guid` is non-null.
     void generateGUID(bmqt::MessageGUID* guid);
 
     // ACCESSORS
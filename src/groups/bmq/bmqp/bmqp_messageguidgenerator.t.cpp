@@ -84,6 +84,40 @@ static void threadFunction(bsl::vector<bmqt::MessageGUID>* out,
     }
 }
 
+/// Thread function: wait on the specified `barrier` and then generate the
+/// specified `numGUIDs` (in a tight loop) with the specified `generator`,
+/// without storing them.
+static void generateGUIDs(bslmt::Barrier*             barrier,
+                          bmqp::MessageGUIDGenerator* generator,
+                          int                         numGUIDs)
+{
+    barrier->wait();
+
+    while (--numGUIDs >= 0) {
+        bmqt::MessageGUID guid;
+        generator->generateGUID(&guid);
+    }
+}
+
+/// Return the index of the thread range the specified `guid` was generated
+/// from (i.e., the most significant bits of its counter).
+static unsigned int threadRangeIndex(const bmqt::MessageGUID& guid)
+{
+    int                version;
+    unsigned int       counter;
+    bsls::Types::Int64 timerTick;
+    bsl::string        clientId(bmqtst::TestHelperUtil::allocator());
+
+    const int rc = bmqp::MessageGUIDGenerator::extractFields(&version,
+                                                             &counter,
+                                                             &timerTick,
+                                                             &clientId,
+                                                             guid);
+    BSLS_ASSERT_OPT(rc == 0);
+
+    return counter >> 16;
+}
+
 /// This class provides a legacy custom implementation of hashing algorithm for
 /// `bmqt::MessageGUID`.  The implementation uses the unrolled djb2 hash, that
 /// was faster than the default hashing algorithm that comes with `bslh`
@@ -958,6 +992,133 @@ static void test7_customHashUniqueness()
 // ----------------------------------------------------------------------------
 
 BSLA_MAYBE_UNUSED
+static void test8_threadRanges()
+// ------------------------------------------------------------------------
+// THREAD RANGES
+//
+// Concerns:
+//   1. Each thread generating GUIDs is handed a range of counters of its
+//      own, as long as there are free ranges, and the other threads share
+//      range 0.
+//   2. GUIDs are unique across threads, whether they have a range of their
+//      own or share range 0.
+//   3. The range handed to a thread is given back when it exits.
+//
+// Plan:
+//   - Spawn more threads than there are ranges and have them generate
+//     GUIDs concurrently.  Once they are done, make sure each generated
+//     GUID is unique, that all the GUIDs of a thread are from the same
+//     range, and that the threads which were handed a range of their own
+//     were handed different ones.
+//   - Spawn new threads, and make sure they were handed ranges of their
+//     own.
+//
+// Testing:
+//   Thread ranges of bmqp::MessageGUIDGenerator::generateGUID()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckGblAlloc() = true;
+    // Can't ensure no global memory is allocated because
+    // 'bslmt::ThreadUtil::create()' uses the global allocator to allocate
+    // memory.
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // 'bmqp::MessageGUIDGenerator::ctor' prints a BALL_LOG_INFO which
+    // allocates using the default allocator.
+
+    bmqtst::TestHelper::printTestName("THREAD RANGES");
+
+    // There are 63 ranges which can be handed out, in addition to range 0.
+    const int k_NUM_OWN_RANGES = 63;
+    const int k_NUM_THREADS    = k_NUM_OWN_RANGES + 17;
+    const int k_NUM_GUIDS      = 10000;
+
+    bmqp::MessageGUIDGenerator generator(0);
+
+    {
+        PV("More threads than ranges");
+
+        bslmt::ThreadGroup threadGroup(bmqtst::TestHelperUtil::allocator());
+
+        // Barrier to get each thread to start at the same time; `+1` for
+        // this (main) thread.
+        bslmt::Barrier barrier(k_NUM_THREADS + 1);
+
+        bsl::vector<bsl::vector<bmqt::MessageGUID> > threadsData(
+            bmqtst::TestHelperUtil::allocator());
+        threadsData.resize(k_NUM_THREADS);
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            int rc = threadGroup.addThread(
+                bdlf::BindUtil::bind(&threadFunction,
+                                     &threadsData[i],
+                                     &barrier,
+                                     &generator,
+                                     k_NUM_GUIDS));
+            BMQTST_ASSERT_EQ_D(i, rc, 0);
+        }
+
+        barrier.wait();
+        threadGroup.joinAll();
+
+        bsl::set<bmqt::MessageGUID> allGUIDs(
+            bmqtst::TestHelperUtil::allocator());
+        bsl::set<unsigned int> ownRanges(bmqtst::TestHelperUtil::allocator());
+        int                    numSharingThreads = 0;
+
+        for (int tIt = 0; tIt < k_NUM_THREADS; ++tIt) {
+            const bsl::vector<bmqt::MessageGUID>& guids = threadsData[tIt];
+            const unsigned int range = threadRangeIndex(guids[0]);
+
+            for (int gIt = 0; gIt < k_NUM_GUIDS; ++gIt) {
+                BMQTST_ASSERT_EQ(allGUIDs.insert(guids[gIt]).second, true);
+                BMQTST_ASSERT_EQ_D(gIt, threadRangeIndex(guids[gIt]), range);
+            }
+
+            if (range == 0) {
+                ++numSharingThreads;
+            }
+            else {
+                BMQTST_ASSERT_EQ_D(tIt, ownRanges.insert(range).second, true);
+            }
+        }
+
+        BMQTST_ASSERT_EQ(static_cast<int>(ownRanges.size()),
+                         k_NUM_OWN_RANGES);
+        BMQTST_ASSERT_EQ(numSharingThreads, k_NUM_THREADS - k_NUM_OWN_RANGES);
+    }
+
+    {
+        PV("Ranges are given back when threads exit");
+
+        const int k_NUM_NEW_THREADS = 10;
+
+        bslmt::ThreadGroup threadGroup(bmqtst::TestHelperUtil::allocator());
+        bslmt::Barrier     barrier(k_NUM_NEW_THREADS + 1);
+
+        bsl::vector<bsl::vector<bmqt::MessageGUID> > threadsData(
+            bmqtst::TestHelperUtil::allocator());
+        threadsData.resize(k_NUM_NEW_THREADS);
+
+        for (int i = 0; i < k_NUM_NEW_THREADS; ++i) {
+            int rc = threadGroup.addThread(
+                bdlf::BindUtil::bind(&threadFunction,
+                                     &threadsData[i],
+                                     &barrier,
+                                     &generator,
+                                     k_NUM_GUIDS));
+            BMQTST_ASSERT_EQ_D(i, rc, 0);
+        }
+
+        barrier.wait();
+        threadGroup.joinAll();
+
+        for (int tIt = 0; tIt < k_NUM_NEW_THREADS; ++tIt) {
+            BMQTST_ASSERT_NE_D(tIt, threadRangeIndex(threadsData[tIt][0]), 0u);
+        }
+    }
+}
+
 static void testN1_decode()
 // ------------------------------------------------------------------------
 // DECODE
@@ -1112,6 +1273,79 @@ static void testN2_bmqtPerformance()
          << endl;
 }
 
+BSLA_MAYBE_UNUSED
+static void testN2_bmqtPerformanceMultithread()
+// ------------------------------------------------------------------------
+// MULTITHREAD PERFORMANCE
+//
+// Concerns:
+//   Test the throughput of bmqp::MessageGUIDGenerator::generateGUID()
+//   when called concurrently from multiple threads.
+//
+// Plan:
+//   - For 1 to 32 threads, time the generation of a huge number of
+//     bmqt::MessageGUIDs in a tight loop from each thread, all sharing the
+//     same generator, and report the overall throughput.
+//
+// Testing:
+//   Performance of the bmqt::MessageGUID generation from multiple threads.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckGblAlloc() = true;
+    // Can't ensure no global memory is allocated because
+    // 'bslmt::ThreadUtil::create()' uses the global allocator to allocate
+    // memory.
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // 'bmqp::MessageGUIDGenerator::ctor' prints a BALL_LOG_INFO which
+    // allocates using the default allocator.
+
+    bmqtst::TestHelper::printTestName("MULTITHREAD PERFORMANCE");
+
+    const int k_MAX_NUM_THREADS      = 32;
+    const int k_NUM_GUIDS_PER_THREAD = 10000000;  // 10 million
+
+    bmqp::MessageGUIDGenerator generator(0);
+    bmqtst::Table              table(bmqtst::TestHelperUtil::allocator());
+
+    for (int numThreads = 1; numThreads <= k_MAX_NUM_THREADS;
+         numThreads *= 2) {
+        bslmt::ThreadGroup threadGroup(bmqtst::TestHelperUtil::allocator());
+
+        // `+1` for this (main) thread.
+        bslmt::Barrier barrier(numThreads + 1);
+
+        for (int i = 0; i < numThreads; ++i) {
+            int rc = threadGroup.addThread(
+                bdlf::BindUtil::bind(&generateGUIDs,
+                                     &barrier,
+                                     &generator,
+                                     k_NUM_GUIDS_PER_THREAD));
+            BSLS_ASSERT_OPT(rc == 0);
+        }
+
+        barrier.wait();
+        const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+        threadGroup.joinAll();
+        const bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+
+        const bsls::Types::Uint64 numGUIDs =
+            static_cast<bsls::Types::Uint64>(numThreads) *
+            k_NUM_GUIDS_PER_THREAD;
+        const bsls::Types::Uint64 elapsed = end - start;
+
+        table.column("Threads").insertValue(
+            static_cast<bsls::Types::Uint64>(numThreads));
+        table.column("GUIDs").insertValue(numGUIDs);
+        table.column("Total time (ns)").insertValue(elapsed);
+        table.column("GUIDs per second")
+            .insertValue(numGUIDs * bdlt::TimeUnitRatio::k_NS_PER_S /
+                         elapsed);
+    }
+
+    table.print(bsl::cout);
+}
+
 BSLA_MAYBE_UNUSED
 static void testN2_bdlbPerformance()
 // ------------------------------------------------------------------------
@@ -1767,6 +2001,41 @@ static void testN2_bmqtPerformance_GoogleBenchmark(benchmark::State& state)
     }
 }
 
+static void
+testN2_bmqtPerformanceMultithread_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// MULTITHREAD PERFORMANCE
+//
+// Concerns:
+//   Test the throughput of bmqp::MessageGUIDGenerator::generateGUID()
+//   when called concurrently from multiple threads.
+//
+// Plan:
+//   - Time the generation of a huge number of bmqt::MessageGUIDs in a
+//     tight loop from each of the benchmark threads, all sharing the same
+//     generator.
+//
+// Testing:
+//   Performance of the bmqt::MessageGUID generation from multiple threads.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckGblAlloc() = true;
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    // Shared by all the benchmark threads.
+    static bmqp::MessageGUIDGenerator s_generator(0);
+
+    for (auto _ : state) {
+        for (bsls::Types::Int64 i = 0; i < state.range(0); ++i) {
+            bmqt::MessageGUID guid;
+            s_generator.generateGUID(&guid);
+            benchmark::DoNotOptimize(guid);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
 static void testN2_bdlbPerformance_GoogleBenchmark(benchmark::State& state)
 {
     // ---------------------
@@ -2044,6 +2313,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 8: test8_threadRanges(); break;
     case 7: test7_customHashUniqueness(); break;
     case 6: test6_defaultHashUniqueness(); break;
     case 5: test5_print(); break;
@@ -2064,6 +2334,11 @@ int main(int argc, char* argv[])
                                    RangeMultiplier(10)
                                        ->Range(10, 10000000)
                                        ->Unit(benchmark::kMillisecond));
+        BMQTST_BENCHMARK_WITH_ARGS(testN2_bmqtPerformanceMultithread,
+                                   Arg(1000000)
+                                       ->ThreadRange(1, 32)
+                                       ->UseRealTime()
+                                       ->Unit(benchmark::kMillisecond));
         break;
     case -3:
         BMQTST_BENCHMARK_WITH_ARGS(testN3_defaultHashBenchmark,
@@ -372,6 +372,172 @@ bool MessageProperties::streamInPropertyValue(const Property& p) const
     return rc == 0;
 }
 
+bool MessageProperties::lookupWireEntry(const WireEntry** entry,
+                                        bsl::string_view  name) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(entry);
+
+    if (!d_schema || d_properties.find(name) != d_properties.end()) {
+        return false;  // RETURN
+    }
+
+    int index;
+    *entry = d_schema->loadIndex(&index, name) ? loadWireEntry(index) : 0;
+
+    return true;
+}
+
+const MessageProperties::WireEntry*
+MessageProperties::loadWireEntry(int index) const
+{
+    if (index < 0 || static_cast<int>(d_wireEntries.size()) <= index) {
+        return 0;  // RETURN
+    }
+
+    WireEntry& entry = d_wireEntries[index];
+    if (entry.d_type != bmqt::PropertyType::e_UNDEFINED) {
+        // Already loaded.
+        return &entry;  // RETURN
+    }
+
+    Property  theProperty;
+    int       totalLength = d_dataOffset;
+    const int offset      = d_mphOffset + index * d_mphSize;
+
+    // We have to read two headers (unless this is the last property) to
+    // calculate 'theProperty' length from two offsets.
+    int rc = streamInPropertyHeader(&theProperty,
+                                    0,
+                                    0,
+                                    &totalLength,
+                                    true,
+                                    offset,
+                                    index);
+    if (rc) {
+        return 0;  // RETURN
+    }
+
+    if (index < (d_originalNumProps - 1)) {
+        Property next;
+        rc = streamInPropertyHeader(&next,
+                                    0,
+                                    &theProperty,
+                                    &totalLength,
+                                    true,
+                                    offset + d_mphSize,
+                                    index + 1);
+        if (rc) {
+            return 0;  // RETURN
+        }
+    }
+
+    entry.d_offset = theProperty.d_offset;
+    entry.d_length = theProperty.d_length;
+    entry.d_type   = theProperty.d_type;
+
+    return &entry;
+}
+
+bool MessageProperties::loadPropertyRef(bdld::Datum*      result,
+                                        const WireEntry&  entry,
+                                        bslma::Allocator* basicAllocator) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(bmqt::PropertyType::e_UNDEFINED != entry.d_type);
+    BSLS_ASSERT_SAFE(entry.d_offset);
+
+    if (bmqt::PropertyType::e_STRING == entry.d_type && entry.d_length == 0) {
+        *result = bdld::Datum::createStringRef(bsl::string_view(),
+                                               basicAllocator);
+        return true;  // RETURN
+    }
+
+    bmqu::BlobPosition position;
+    int rc = bmqu::BlobUtil::findOffsetSafe(&position,
+                                            *d_blob_p,
+                                            entry.d_offset);
+    if (rc) {
+        return false;  // RETURN
+    }
+
+    switch (entry.d_type) {
+    case bmqt::PropertyType::e_BOOL: {
+        char value;
+        rc = bmqu::BlobUtil::readNBytes(&value,
+                                        *d_blob_p,
+                                        position,
+                                        sizeof(value));
+
+        *result = bdld::Datum::createBoolean(value == 1);
+    } break;
+    case bmqt::PropertyType::e_CHAR: {
+        char value;
+        rc = bmqu::BlobUtil::readNBytes(&value,
+                                        *d_blob_p,
+                                        position,
+                                        sizeof(value));
+
+        *result = bdld::Datum::createInteger(value);
+    } break;
+    case bmqt::PropertyType::e_SHORT: {
+        bdlb::BigEndianInt16 nboValue;
+        rc = bmqu::BlobUtil::readNBytes(reinterpret_cast<char*>(&nboValue),
+                                        *d_blob_p,
+                                        position,
+                                        sizeof(nboValue));
+
+        *result = bdld::Datum::createInteger(static_cast<short>(nboValue));
+    } break;
+    case bmqt::PropertyType::e_INT32: {
+        bdlb::BigEndianInt32 nboValue;
+        rc = bmqu::BlobUtil::readNBytes(reinterpret_cast<char*>(&nboValue),
+                                        *d_blob_p,
+                                        position,
+                                        sizeof(nboValue));
+
+        *result = bdld::Datum::createInteger(static_cast<int>(nboValue));
+    } break;
+    case bmqt::PropertyType::e_INT64: {
+        bdlb::BigEndianInt64 nboValue;
+        rc = bmqu::BlobUtil::readNBytes(reinterpret_cast<char*>(&nboValue),
+                                        *d_blob_p,
+                                        position,
+                                        sizeof(nboValue));
+
+        *result = bdld::Datum::createInteger64(
+            static_cast<bsls::Types::Int64>(nboValue),
+            basicAllocator);
+    } break;
+    case bmqt::PropertyType::e_STRING: {
+        bmqu::BlobPosition end;
+        if (bmqu::BlobUtil::findOffset(&end,
+                                       *d_blob_p,
+                                       position,
+                                       entry.d_length) != 0 ||
+            !bmqu::BlobUtil::isDataContinuous(position, end)) {
+            // Cannot refer to the string without copying it.
+            return false;  // RETURN
+        }
+
+        const char* start = d_blob_p->buffer(position.buffer()).data() +
+                            position.byte();
+        *result           = bdld::Datum::createStringRef(
+            bsl::string_view(start, entry.d_length),
+            basicAllocator);
+    } break;
+    case bmqt::PropertyType::e_BINARY: {
+        // do not want to use binary
+        *result = bdld::Datum::createError(-2);
+    } break;
+    case bmqt::PropertyType::e_UNDEFINED:
+    default: *result = bdld::Datum::createError(-3);
+    }
+
+    return rc == 0;
+}
+
 // CREATORS
 MessageProperties::MessageProperties(bslma::Allocator* basicAllocator)
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
@@ -386,6 +552,9 @@ MessageProperties::MessageProperties(bslma::Allocator* basicAllocator)
 , d_dataOffset(0)
 , d_schema()
 , d_originalNumProps(0)
+, d_wireEntries(basicAllocator)
+, d_wireAreaSize(0)
+, d_isWireExtended(false)
 , d_isBlobConstructed(false)
 , d_isDirty(true)  // by default, this should be true
 , d_doDeepCopy(true)
@@ -406,6 +575,9 @@ MessageProperties::MessageProperties(const MessageProperties& other,
 , d_dataOffset(other.d_dataOffset)
 , d_schema(other.d_schema)
 , d_originalNumProps(other.d_originalNumProps)
+, d_wireEntries(other.d_wireEntries, basicAllocator)
+, d_wireAreaSize(other.d_isBlobConstructed ? other.d_wireAreaSize : 0)
+, d_isWireExtended(other.d_isWireExtended)
 , d_isBlobConstructed(false)
 , d_isDirty(other.d_isDirty)
 , d_doDeepCopy(other.d_doDeepCopy)
@@ -451,6 +623,9 @@ MessageProperties& MessageProperties::operator=(const MessageProperties& rhs)
     d_dataOffset       = rhs.d_dataOffset;
     d_schema           = rhs.d_schema;
     d_originalNumProps = rhs.d_originalNumProps;
+    d_wireEntries      = rhs.d_wireEntries;
+    d_wireAreaSize     = rhs.d_isBlobConstructed ? rhs.d_wireAreaSize : 0;
+    d_isWireExtended   = rhs.d_isWireExtended;
 
     return *this;
 }
@@ -468,6 +643,9 @@ void MessageProperties::clear()
     d_schema.clear();
 
     d_originalNumProps = 0;
+    d_wireEntries.clear();
+    d_wireAreaSize   = 0;
+    d_isWireExtended = false;
 
     if (d_isBlobConstructed) {
         d_blob.object().bdlbb::Blob::~Blob();
@@ -528,7 +706,8 @@ bool MessageProperties::remove(bsl::string_view          name,
         d_totalSize = 0;
     }
 
-    d_isDirty = true;
+    d_isDirty      = true;
+    d_wireAreaSize = 0;
     return true;
 }
 
@@ -596,16 +775,19 @@ int MessageProperties::streamInHeader(const bdlbb::Blob& blob)
     }
 
     if (d_doDeepCopy) {
+        // Keep the padding so that the copy is a valid wire representation
+        // that 'streamOut' can return as is.
         new (d_blob.buffer()) bdlbb::Blob(d_allocator_p);
-        bdlbb::BlobUtil::append(d_blob.address(), blob, 0, d_totalSize);
+        bdlbb::BlobUtil::append(d_blob.address(), blob, 0, msgPropsAreaSize);
         d_blob_p            = d_blob.address();
         d_isBlobConstructed = true;
     }
     else {
         d_blob_p = &blob;
     }
-    d_originalSize      = d_totalSize;
-    d_originalNumProps  = d_numProps;
+    d_originalSize     = d_totalSize;
+    d_originalNumProps = d_numProps;
+    d_wireAreaSize     = msgPropsAreaSize;
 
     return rc_SUCCESS;
 }
@@ -851,6 +1033,8 @@ int MessageProperties::streamIn(const bdlbb::Blob& blob,
         return rc;  // RETURN
     }
 
+    d_isWireExtended = isNewStyleProperties;
+
     cleanOnFailure.release();
 
     return rc_SUCCESS;
@@ -864,7 +1048,11 @@ int MessageProperties::streamIn(const bdlbb::Blob&           blob,
     if (schema) {
         rc = streamInHeader(blob);
         if (rc == 0) {
-            d_schema = schema;
+            d_schema         = schema;
+            d_isWireExtended = info.isExtended();
+
+            // Reuses the capacity of the table, if any.
+            d_wireEntries.resize(d_originalNumProps);
         }
     }
     else {
@@ -879,6 +1067,19 @@ bdld::Datum
 MessageProperties::getPropertyRef(bsl::string_view  name,
                                   bslma::Allocator* basicAllocator) const
 {
+    const WireEntry* entry;
+    if (lookupWireEntry(&entry, name)) {
+        if (!entry) {
+            return bdld::Datum::createError(-1);  // RETURN
+        }
+
+        bdld::Datum result;
+        if (loadPropertyRef(&result, *entry, basicAllocator)) {
+            return result;  // RETURN
+        }
+        // else the value needs a copy which 'd_properties' keeps
+    }
+
     PropertyMapIter it = findProperty(name);
     if (it == d_properties.end()) {
         return bdld::Datum::createError(-1);  // RETURN
@@ -918,6 +1119,19 @@ MessageProperties::getPropertyRef(bsl::string_view  name,
 bool MessageProperties::hasProperty(bsl::string_view          name,
                                     bmqt::PropertyType::Enum* type) const
 {
+    const WireEntry* entry;
+    if (lookupWireEntry(&entry, name)) {
+        if (!entry) {
+            return false;  // RETURN
+        }
+
+        if (type) {
+            *type = entry->d_type;
+        }
+
+        return true;  // RETURN
+    }
+
     PropertyMapConstIter cit = findProperty(name);
     if (cit == d_properties.end()) {
         return false;  // RETURN
@@ -933,6 +1147,13 @@ bool MessageProperties::hasProperty(bsl::string_view          name,
 bmqt::PropertyType::Enum
 MessageProperties::propertyType(bsl::string_view name) const
 {
+    const WireEntry* entry;
+    if (lookupWireEntry(&entry, name)) {
+        BSLS_ASSERT(entry && "Property does not exist");
+
+        return entry->d_type;  // RETURN
+    }
+
     PropertyMapConstIter cit = findProperty(name);
     BSLS_ASSERT((cit != d_properties.end()) && "Property does not exist");
 
@@ -948,6 +1169,30 @@ MessageProperties::streamOut(bdlbb::BlobBufferFactory*          bufferFactory,
         return d_blob.object();  // RETURN
     }
 
+    if (d_wireAreaSize && info.isExtended() == d_isWireExtended) {
+        // Unchanged since read from the wire in the requested encoding: the
+        // wire representation (including the padding) is the result.
+
+        if (!d_isBlobConstructed) {
+            // Not a deep copy; refer to the buffers of the original blob.
+
+            BSLS_ASSERT_SAFE(d_blob_p != d_blob.address());
+
+            new (d_blob.buffer()) bdlbb::Blob(bufferFactory, d_allocator_p);
+            bdlbb::BlobUtil::append(d_blob.address(),
+                                    *d_blob_p,
+                                    0,
+                                    d_wireAreaSize);
+            d_blob_p            = d_blob.address();
+            d_isBlobConstructed = true;
+        }
+
+        BSLS_ASSERT_SAFE(d_blob.object().length() == d_wireAreaSize);
+
+        d_isDirty = false;
+        return d_blob.object();  // RETURN
+    }
+
     // Make sure all Properties are read.
     for (PropertyMapConstIter cit = d_properties.begin();
          cit != d_properties.end();
@@ -973,6 +1218,7 @@ MessageProperties::streamOut(bdlbb::BlobBufferFactory*          bufferFactory,
 
     d_blob_p            = d_blob.address();
     d_isBlobConstructed = true;
+    d_wireAreaSize      = 0;
 
     if (0 == numProperties()) {
         BSLS_ASSERT(0 == totalSize());
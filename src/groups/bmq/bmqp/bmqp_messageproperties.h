@@ -175,6 +175,26 @@ class MessageProperties {
 
     typedef bsl::pair<PropertyMapIter, bool> PropertyMapInsertRc;
 
+    /// Flat description of a property as it is on the wire, loaded from
+    /// its `MessagePropertyHeader` without reading the name nor the value.
+    struct WireEntry {
+        int d_offset;
+        // Offset in the blob to the value (not the name).
+
+        int d_length;
+        // Length of the value (not the name).
+
+        bmqt::PropertyType::Enum d_type;
+        // Type of the value, or 'e_UNDEFINED' if the entry
+        // has not been loaded yet.
+
+        WireEntry();
+    };
+
+    /// Table of the properties on the wire indexed by their position in
+    /// the schema.
+    typedef bsl::vector<WireEntry> WireEntries;
+
     typedef bsls::ObjectBuffer<bdlbb::Blob> BlobObjectBuffer;
 
     enum RcEnum {
@@ -243,6 +263,33 @@ class MessageProperties {
     // Incremental reading needs it to
     // recognize last property.
 
+    mutable WireEntries d_wireEntries;
+    // Properties on the wire indexed by
+    // their position in 'd_schema' and
+    // loaded on demand, so that reading
+    // one property neither parses the
+    // others nor populates
+    // 'd_properties'.  Empty unless read
+    // with a schema.  The capacity is kept
+    // across 'clear' to avoid allocating
+    // when reading subsequent messages.
+
+    mutable int d_wireAreaSize;
+    // Size, including the padding, of the
+    // properties area read from the wire
+    // by the last 'streamIn', or '0' if
+    // there is none or if this instance
+    // has changed since.  When not '0',
+    // 'streamOut' returns the wire
+    // representation instead of encoding
+    // the properties again.
+
+    bool d_isWireExtended;
+    // Flag indicating if the properties
+    // area read from the wire is encoded
+    // in the new style (offsets instead of
+    // lengths).
+
     mutable bool d_isBlobConstructed;
     // Flag indicating if an instance of
     // the blob has been constructed in
@@ -309,6 +356,30 @@ class MessageProperties {
 
     PropertyMapIter findProperty(bsl::string_view name) const;
 
+    /// Load into the specified `entry` the address of the flat description
+    /// of the property with the specified `name` read from the wire using
+    /// the schema, or `0` if there is no such property.  Return `true` on
+    /// success, and `false` if the property cannot be looked up this way,
+    /// either because there is no schema or because the property has
+    /// already been loaded into `d_properties` (which then takes
+    /// precedence, as the property may have changed).
+    bool lookupWireEntry(const WireEntry** entry, bsl::string_view name) const;
+
+    /// Return the address of the flat description of the property at the
+    /// specified `index` in the schema, loading it from the corresponding
+    /// `MessagePropertyHeader`s if needed, or `0` if the index is out of
+    /// range or the headers are malformed.
+    const WireEntry* loadWireEntry(int index) const;
+
+    /// Load into the specified `result` a reference to the value of the
+    /// property described by the specified `entry`, using the specified
+    /// `basicAllocator` if needed.  Return `true` on success and `false` if
+    /// the value cannot be referred to without copying it (a string
+    /// spanning multiple blob buffers) or cannot be read.
+    bool loadPropertyRef(bdld::Datum*      result,
+                         const WireEntry&  entry,
+                         bslma::Allocator* basicAllocator) const;
+
     /// Parse one `MessagePropertyHeader` out of the specified `blob` at the
     /// specified `offset`, at the specified `index`, using the specified
     /// `isNewStyleProperties` as an indicator of encoding style.
@@ -420,8 +491,10 @@ class MessageProperties {
     /// Parse `MessagePropertiesHeader` out of the specified `blob` using
     /// the specified `info` as an indicator of encoding format.  If the
     /// specified `schema` is not empty, return without parsing properties
-    /// headers.  Otherwise, populate this instance with properties names,
-    /// lengths, types, and offsets.
+    /// headers: each property is then located in O(1) by its index in the
+    /// `schema`, and read on demand without parsing the other ones.
+    /// Otherwise, populate this instance with properties names, lengths,
+    /// types, and offsets.
     /// Return zero on success, and a non-zero value otherwise.
     int streamIn(const bdlbb::Blob&           blob,
                  const MessagePropertiesInfo& info,
@@ -488,7 +561,8 @@ class MessageProperties {
     // property with such a name exists.  Return 'bdld::Datum::createError'
     // if property with 'name' does not exist.  Behavior is undefined when
     // accessing the returned reference after this object changes its
-    // state.
+    // state.  Note that if this object was read with a schema, the
+    // property is read directly from the wire representation.
 
     SchemaPtr makeSchema(bslma::Allocator* allocator);
 
@@ -498,7 +572,10 @@ class MessageProperties {
     /// instead of property lengths.  Behavior is undefined unless specified
     /// `bufferFactory` is non-null.  Note that if this instance is empty
     /// (i.e.,`numProperties()` == 0), returned blob will be empty.  In
-    /// other words, an empty instance has no wire representation.
+    /// other words, an empty instance has no wire representation.  Also
+    /// note that if this instance has not changed since it was read from
+    /// the wire in the same encoding as the one requested, the returned
+    /// blob refers to the original wire representation.
     const bdlbb::Blob&
     streamOut(bdlbb::BlobBufferFactory*          bufferFactory,
               const bmqp::MessagePropertiesInfo& info) const;
@@ -617,6 +694,18 @@ inline MessageProperties::Property::Property()
 {
     // NOTHING
 }
+
+// ----------------------------------
+// class MessageProperties::WireEntry
+// ----------------------------------
+inline MessageProperties::WireEntry::WireEntry()
+: d_offset(0)
+, d_length(0)
+, d_type(bmqt::PropertyType::e_UNDEFINED)
+{
+    // NOTHING
+}
+
 // -----------------------
 // class MessageProperties
 // -----------------------
@@ -674,7 +763,8 @@ bmqt::GenericResult::Enum MessageProperties::setProperty(bsl::string_view name,
         delta -= existing.d_length;
 
         BSLS_ASSERT(0 < totalSize());
-        d_isDirty = true;
+        d_isDirty      = true;
+        d_wireAreaSize = 0;
     }
     else {
         delta += static_cast<int>(name.length() +
@@ -708,8 +798,9 @@ bmqt::GenericResult::Enum MessageProperties::setProperty(bsl::string_view name,
 
     // This cannot have `bsl::string_view` type.
     p.d_type    = static_cast<bmqt::PropertyType::Enum>(p.d_value.typeIndex());
-    p.d_isValid = true;
-    d_isDirty   = true;
+    p.d_isValid    = true;
+    d_isDirty      = true;
+    d_wireAreaSize = 0;
 
     return bmqt::GenericResult::e_SUCCESS;
 }
@@ -819,43 +910,17 @@ MessageProperties::findProperty(bsl::string_view name) const
     if (d_schema->loadIndex(&index, name)) {
         // Starts with '0'
 
-        Property theProperty;
-        int      totalLength = d_dataOffset;
-        int      offset      = d_mphOffset + index * d_mphSize;
-        int      rc          = 0;
-        // We have to call twice (unless this is the last property) to
-        // calculate 'theProperty' length from two offsets.
-
-        bsl::string temp;  // Can be '0'; using it to double-check
-        rc = streamInPropertyHeader(&theProperty,
-                                    &temp,
-                                    0,
-                                    &totalLength,
-                                    true,
-                                    offset,
-                                    index);
-        BSLS_ASSERT_SAFE(name == temp);
-        if (rc) {
+        const WireEntry* entry = loadWireEntry(index);
+        if (!entry) {
             // REVISIT: there are no means to report the error other than
             //          returning 'end()'
             return d_properties.end();  // RETURN
         }
 
-        if (index < (d_originalNumProps - 1)) {
-            Property next;
-            rc = streamInPropertyHeader(&next,
-                                        0,
-                                        &theProperty,
-                                        &totalLength,
-                                        true,
-                                        offset + d_mphSize,
-                                        index + 1);
-            if (rc) {
-                // REVISIT: there is no means to report the error other than
-                //          returning 'end()'
-                return d_properties.end();  // RETURN
-            }
-        }
+        Property theProperty;
+        theProperty.d_offset = entry->d_offset;
+        theProperty.d_length = entry->d_length;
+        theProperty.d_type   = entry->d_type;
 
         PropertyMapInsertRc insert = d_properties.insert(
             bsl::make_pair(name, theProperty));
@@ -29,11 +29,14 @@
 #include <bdlb_variant.h>
 #include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
+#include <bdld_datum.h>
+#include <bdlma_sequentialallocator.h>
 #include <bsl_ios.h>
 #include <bsl_limits.h>
 #include <bsl_map.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
+#include <bslma_testallocator.h>
 #include <bslmf_assert.h>
 #include <bsls_types.h>
 
@@ -1450,6 +1453,157 @@ static void test13_streamInMalformedHeaderTest()
     BMQTST_ASSERT_EQ(0, dst.numProperties());
 }
 
+static void test14_readWithSchemaTest()
+// ------------------------------------------------------------------------
+// READ WITH SCHEMA TEST
+//
+// Concerns:
+//   1. Properties read with a schema have the same values and types as
+//      when all properties are parsed.
+//   2. Reading properties with a schema into an instance reused across
+//      messages does not allocate memory once warmed up.
+//   3. An unchanged instance streams out its wire representation as is,
+//      and a changed one encodes the properties again.
+//   4. Properties read with a schema can be removed and updated.
+//
+// Plan:
+//   1. Encode properties, parse them all, and learn the schema.
+//   2. Repeatedly read the encoded properties with the schema into an
+//      instance that does not copy the blob and compare each property
+//      with the fully parsed instance, while counting allocations.
+//   3. Stream out both instances and compare them with the encoded
+//      properties, then modify them and verify the result.
+//
+// Testing:
+//   int streamIn(const bdlbb::Blob&,
+//                const MessagePropertiesInfo&,
+//                const SchemaPtr&);
+//   bdld::Datum getPropertyRef(bsl::string_view, bslma::Allocator*) const;
+//   bool hasProperty(bsl::string_view, bmqt::PropertyType::Enum*) const;
+//   bmqt::PropertyType::Enum propertyType(bsl::string_view) const;
+//   const bdlbb::Blob& streamOut(bdlbb::BlobBufferFactory*,
+//                                const MessagePropertiesInfo&) const;
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("READ WITH SCHEMA TEST");
+
+    // Large buffers so that strings are contiguous in the blob and can be
+    // referred to without copying them.
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        64 * 1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::MessagePropertiesInfo logic =
+        bmqp::MessagePropertiesInfo::makeInvalidSchema();
+    BSLS_ASSERT_OPT(logic.isExtended());
+
+    const size_t numProps = 57;
+    PropertyMap  pmap(bmqtst::TestHelperUtil::allocator());
+
+    bmqp::MessageProperties src(bmqtst::TestHelperUtil::allocator());
+    populateProperties(&src, &pmap, numProps);
+
+    bdlbb::Blob wireRep(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+    wireRep = src.streamOut(&bufferFactory, logic);
+
+    bmqp::MessageProperties parsed(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, parsed.streamIn(wireRep, logic.isExtended()));
+
+    const bmqp::MessageProperties::SchemaPtr schema = parsed.makeSchema(
+        bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT(schema);
+
+    bslma::TestAllocator    ta("testAlloc");
+    bmqp::MessageProperties obj(&ta);
+    obj.setDeepCopy(false);
+
+    bsls::Types::Int64 numAllocations = 0;
+
+    {
+        PV("Reading with schema matches full parsing");
+
+        for (int round = 0; round < 3; ++round) {
+            // Datums may allocate on 32-bit platforms.
+            bdlma::SequentialAllocator datumAllocator(
+                bmqtst::TestHelperUtil::allocator());
+
+            BMQTST_ASSERT_EQ_D(round,
+                               0,
+                               obj.streamIn(wireRep, logic, schema));
+            BMQTST_ASSERT_EQ_D(round,
+                               static_cast<int>(numProps),
+                               obj.numProperties());
+
+            for (PropertyMapConstIter cit = pmap.begin(); cit != pmap.end();
+                 ++cit) {
+                const bsl::string& name = cit->first;
+
+                bmqt::PropertyType::Enum type =
+                    bmqt::PropertyType::e_UNDEFINED;
+                BMQTST_ASSERT_EQ_D(name, true, obj.hasProperty(name, &type));
+                BMQTST_ASSERT_EQ_D(name, cit->second.first.first, type);
+                BMQTST_ASSERT_EQ_D(name,
+                                   cit->second.first.first,
+                                   obj.propertyType(name));
+                BMQTST_ASSERT_EQ_D(
+                    name,
+                    parsed.getPropertyRef(name, &datumAllocator),
+                    obj.getPropertyRef(name, &datumAllocator));
+            }
+
+            BMQTST_ASSERT(!obj.hasProperty("noSuchProperty"));
+            BMQTST_ASSERT(
+                obj.getPropertyRef("noSuchProperty", &datumAllocator)
+                    .isError());
+
+            if (round == 0) {
+                // Warm up the capacity of the table of properties.
+                numAllocations = ta.numAllocations();
+            }
+            else {
+                BMQTST_ASSERT_EQ_D(round, numAllocations, ta.numAllocations());
+            }
+        }
+    }
+
+    {
+        PV("Unchanged properties stream out as read");
+
+        const bdlbb::Blob& out = obj.streamOut(&bufferFactory, logic);
+        BMQTST_ASSERT_EQ(0, bdlbb::BlobUtil::compare(wireRep, out));
+
+        const bdlbb::Blob& parsedOut = parsed.streamOut(&bufferFactory,
+                                                        logic);
+        BMQTST_ASSERT_EQ(0, bdlbb::BlobUtil::compare(wireRep, parsedOut));
+    }
+
+    {
+        PV("Properties read with schema can be removed and updated");
+
+        BMQTST_ASSERT_EQ(0, obj.streamIn(wireRep, logic, schema));
+
+        const bsl::string& removed = pmap.begin()->first;
+        BMQTST_ASSERT(obj.hasProperty(removed));
+        BMQTST_ASSERT(obj.remove(removed));
+        BMQTST_ASSERT(!obj.hasProperty(removed));
+        BMQTST_ASSERT(obj.getPropertyRef(removed, 0).isError());
+        BMQTST_ASSERT_EQ(static_cast<int>(numProps - 1), obj.numProperties());
+
+        BMQTST_ASSERT_EQ(0, obj.setPropertyAsString("newProperty", "value"));
+        BMQTST_ASSERT_EQ(static_cast<int>(numProps), obj.numProperties());
+
+        // Re-encoded: differs from the original representation.
+        bdlbb::Blob out(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+        out = obj.streamOut(&bufferFactory, logic);
+        BMQTST_ASSERT_NE(0, bdlbb::BlobUtil::compare(wireRep, out));
+
+        bmqp::MessageProperties check(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(0, check.streamIn(out, logic.isExtended()));
+        BMQTST_ASSERT_EQ(static_cast<int>(numProps), check.numProperties());
+        BMQTST_ASSERT(!check.hasProperty(removed));
+        BMQTST_ASSERT_EQ(check.getPropertyAsString("newProperty"), "value");
+    }
+}
+
 #ifdef BMQTST_BENCHMARK_ENABLED
 
 struct MessagePropertiesBenchmark_getPropertyRef {
@@ -1565,6 +1719,113 @@ struct MessagePropertiesBenchmark_streamIn {
     }
 };
 
+struct MessagePropertiesBenchmark_getPropertyRefWithSchema {
+    static void bench(bslmt::Latch*   initLatch_p,
+                      bslmt::Barrier* startBarrier_p,
+                      bslmt::Latch*   finishLatch_p)
+    {
+        // PRECONDITIONS
+        BSLS_ASSERT_OPT(initLatch_p);
+        BSLS_ASSERT_OPT(startBarrier_p);
+        BSLS_ASSERT_OPT(finishLatch_p);
+
+        bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+        const size_t k_NUM_ITERATIONS = 1000000;
+
+        // Number of properties read from each message, as a subscription
+        // expression typically refers to a few of them.
+        const size_t k_NUM_READS = 4;
+
+        bdlbb::PooledBlobBufferFactory bufferFactory(64 * 1024, alloc);
+        bdlbb::Blob                    wireRep(&bufferFactory, alloc);
+        PropertyMap                    pmap(alloc);
+        bmqp::MessagePropertiesInfo    logic =
+            bmqp::MessagePropertiesInfo::makeInvalidSchema();
+
+        const size_t numProps =
+            bmqp::MessagePropertiesHeader::k_MAX_NUM_PROPERTIES;
+
+        bmqp::MessageProperties src(alloc);
+        populateProperties(&src, &pmap, numProps);
+        wireRep = src.streamOut(&bufferFactory, logic);
+
+        // Learn the schema, as 'bmqp::SchemaLearner' does upon the first
+        // message.
+        bmqp::MessageProperties learner(alloc);
+        BMQTST_ASSERT_EQ(0, learner.streamIn(wireRep, logic.isExtended()));
+        const bmqp::MessageProperties::SchemaPtr schema = learner.makeSchema(
+            alloc);
+
+        bsl::vector<bsl::string> propertyNames(alloc);
+        for (PropertyMapConstIter cit = pmap.cbegin();
+             propertyNames.size() < k_NUM_READS;
+             ++cit) {
+            propertyNames.push_back(cit->first);
+        }
+
+        // Reuse the same instance for all messages, as the broker does.
+        bmqp::MessageProperties props(alloc);
+        props.setDeepCopy(false);
+
+        initLatch_p->arrive();
+        startBarrier_p->wait();
+
+        for (size_t i = 0; i < k_NUM_ITERATIONS; ++i) {
+            props.streamIn(wireRep, logic, schema);
+
+            for (size_t j = 0; j < propertyNames.size(); j++) {
+                // Don't use slow `bmqtst::TestHelperUtil::allocator`:
+                (void)props.getPropertyRef(propertyNames[j], 0);
+            }
+        }
+
+        finishLatch_p->arrive();
+    }
+};
+
+struct MessagePropertiesBenchmark_streamOutUnchanged {
+    static void bench(bslmt::Latch*   initLatch_p,
+                      bslmt::Barrier* startBarrier_p,
+                      bslmt::Latch*   finishLatch_p)
+    {
+        // PRECONDITIONS
+        BSLS_ASSERT_OPT(initLatch_p);
+        BSLS_ASSERT_OPT(startBarrier_p);
+        BSLS_ASSERT_OPT(finishLatch_p);
+
+        bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+        const size_t k_NUM_ITERATIONS = 1000000;
+
+        bdlbb::PooledBlobBufferFactory bufferFactory(1024, alloc);
+        bdlbb::Blob                    wireRep(&bufferFactory, alloc);
+        PropertyMap                    pmap(alloc);
+        bmqp::MessagePropertiesInfo    logic =
+            bmqp::MessagePropertiesInfo::makeInvalidSchema();
+
+        const size_t numProps = 16;
+
+        bmqp::MessageProperties src(alloc);
+        populateProperties(&src, &pmap, numProps);
+        wireRep = src.streamOut(&bufferFactory, logic);
+
+        initLatch_p->arrive();
+        startBarrier_p->wait();
+
+        for (size_t i = 0; i < k_NUM_ITERATIONS; ++i) {
+            // Forward received properties, as a consumer republishing a
+            // message does.
+            bmqp::MessageProperties props(alloc);
+            props.setDeepCopy(false);
+            props.streamIn(wireRep, logic.isExtended());
+            (void)props.streamOut(&bufferFactory, logic);
+        }
+
+        finishLatch_p->arrive();
+    }
+};
+
 template <size_t NUM_THREADS, typename BENCHMARK>
 static void testN1_benchmark(benchmark::State& state)
 // ------------------------------------------------------------------------
@@ -1627,6 +1888,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 14: test14_readWithSchemaTest(); break;
     case 13: test13_streamInMalformedHeaderTest(); break;
     case 12: test12_emptyPropertyValueStreamOutTest(); break;
     case 11: test11_binaryPropertyRvalueTest(); break;
@@ -1656,6 +1918,23 @@ int main(int argc, char* argv[])
             ->Repetitions(10)
             ->Unit(benchmark::kMillisecond);
 
+        BENCHMARK(
+            testN1_benchmark<
+                1,
+                MessagePropertiesBenchmark_getPropertyRefWithSchema>)
+            ->Name("bmqp::MessageProperties::getPropertyRef (schema)")
+            ->Iterations(1)
+            ->Repetitions(10)
+            ->Unit(benchmark::kMillisecond);
+
+        BENCHMARK(
+            testN1_benchmark<1,
+                             MessagePropertiesBenchmark_streamOutUnchanged>)
+            ->Name("bmqp::MessageProperties::streamOut (unchanged)")
+            ->Iterations(1)
+            ->Repetitions(10)
+            ->Unit(benchmark::kMillisecond);
+
         benchmark::Initialize(&argc, argv);
         benchmark::RunSpecifiedBenchmarks();
 #else
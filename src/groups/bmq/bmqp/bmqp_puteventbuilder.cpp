@@ -77,14 +77,17 @@ void PutEventBuilder::resetFields()
 }
 
 bmqt::EventBuilderResult::Enum
-PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
+PutEventBuilder::packMessageHeader(int* numPaddingBytes,
+                                   int  appDataLength,
+                                   int  queueId)
 {
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(numPaddingBytes);
+
     typedef bmqt::EventBuilderResult Result;
     typedef OptionUtil::OptionMeta   OptionMeta;
 
-    int       appDataLength   = appData.length();
-    int       numPaddingBytes = 0;
-    const int numWords = ProtocolUtil::calcNumWordsAndPadding(&numPaddingBytes,
+    const int numWords = ProtocolUtil::calcNumWordsAndPadding(numPaddingBytes,
                                                               appDataLength);
 
     // Validate payload is not too big
@@ -96,7 +99,7 @@ PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
 
     const int sizeNoOptions = eventSize() +
                               static_cast<int>(sizeof(PutHeader)) +
-                              appDataLength + numPaddingBytes;
+                              appDataLength + *numPaddingBytes;
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(sizeNoOptions >
                                               PutHeader::k_MAX_SIZE_SOFT)) {
@@ -162,6 +165,23 @@ PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
     // Just a sanity test.  Should still be word aligned.
     BSLS_ASSERT_SAFE(isWordAligned(*d_blob_sp));
 
+    return Result::e_SUCCESS;
+}
+
+bmqt::EventBuilderResult::Enum
+PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
+{
+    typedef bmqt::EventBuilderResult Result;
+
+    int numPaddingBytes = 0;
+
+    const Result::Enum rc =
+        packMessageHeader(&numPaddingBytes, appData.length(), queueId);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != Result::e_SUCCESS)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc;  // RETURN
+    }
+
     bdlbb::BlobUtil::append(d_blob_sp.get(), appData);
 
     // Add padding
@@ -172,6 +192,87 @@ PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
     return Result::e_SUCCESS;
 }
 
+bmqt::EventBuilderResult::Enum
+PutEventBuilder::packUncompressedMessage(int queueId)
+{
+    typedef bmqt::EventBuilderResult Result;
+
+    // Unlike 'packMessageInternal', neither the properties nor the payload
+    // are first gathered into an intermediate blob: the CRC-32C is
+    // calculated over them in turn, and they are appended directly to the
+    // event blob.
+    const bdlbb::Blob* propertiesBlob = d_preparedProperties_p;
+    unsigned int       crc32c         = d_preparedPropertiesCrc32c;
+
+    if (!propertiesBlob) {
+        crc32c = Crc32c::k_NULL_CRC32C;
+
+        if (d_properties_p && 0 != d_properties_p->numProperties()) {
+            // Note that '0 != d_properties_p->numProperties()' check is
+            // required because application can set an empty instance of
+            // properties with a message.
+
+            if (!d_messagePropertiesInfo.isExtended()) {
+                // Did not 'setMessagePropertiesLogic'.
+                d_messagePropertiesInfo =
+                    MessagePropertiesInfo::makeInvalidSchema();
+            }
+
+            // propertiesBlob include 6 byte mph along with properties
+            propertiesBlob = &d_properties_p->streamOut(
+                d_blob_sp->factory(),
+                d_messagePropertiesInfo);
+            crc32c = Crc32c::calculate(*propertiesBlob);
+        }
+        else {
+            BSLS_ASSERT_SAFE(!d_messagePropertiesInfo.isPresent());
+        }
+    }
+
+    int appDataLength = propertiesBlob ? propertiesBlob->length() : 0;
+    if (d_rawPayload_p) {
+        appDataLength += d_rawPayloadLength;
+        crc32c = Crc32c::calculate(d_rawPayload_p, d_rawPayloadLength, crc32c);
+    }
+    else {
+        appDataLength += d_blobPayload_p->length();
+        crc32c = Crc32c::calculate(*d_blobPayload_p, crc32c);
+    }
+
+    d_compressionAlgorithmType = bmqt::CompressionAlgorithmType::e_NONE;
+    d_crc32c                   = crc32c;
+    d_lastPackedMessageCompressionRatio = 1;
+
+    int numPaddingBytes = 0;
+
+    const Result::Enum rc =
+        packMessageHeader(&numPaddingBytes, appDataLength, queueId);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != Result::e_SUCCESS)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc;  // RETURN
+    }
+
+    if (propertiesBlob) {
+        bdlbb::BlobUtil::append(d_blob_sp.get(), *propertiesBlob);
+    }
+
+    if (d_rawPayload_p) {
+        bdlbb::BlobUtil::append(d_blob_sp.get(),
+                                d_rawPayload_p,
+                                d_rawPayloadLength);
+    }
+    else {
+        bdlbb::BlobUtil::append(d_blob_sp.get(), *d_blobPayload_p);
+    }
+
+    // Add padding
+    ProtocolUtil::appendPaddingRaw(d_blob_sp.get(), numPaddingBytes);
+
+    ++d_msgCount;
+
+    return Result::e_SUCCESS;
+}
+
 PutEventBuilder::PutEventBuilder(BlobSpPool*       blobSpPool_p,
                                  bslma::Allocator* allocator)
 : d_allocator_p(bslma::Default::allocator(allocator))
@@ -190,6 +291,8 @@ PutEventBuilder::PutEventBuilder(BlobSpPool*       blobSpPool_p,
 , d_compressionAlgorithmType(bmqt::CompressionAlgorithmType::e_NONE)
 , d_lastPackedMessageCompressionRatio(-1)
 , d_messagePropertiesInfo()
+, d_preparedProperties_p(0)
+, d_preparedPropertiesCrc32c(0)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(blobSpPool_p);
@@ -218,6 +321,8 @@ int PutEventBuilder::reset()
     d_crc32c                            = 0;
     d_lastPackedMessageCompressionRatio = -1;
     d_messagePropertiesInfo             = MessagePropertiesInfo();
+    d_preparedProperties_p              = 0;
+    d_preparedPropertiesCrc32c          = 0;
 
     // NOTE: Since PutEventBuilder owns the blob and we just reset it, we have
     //       guarantee that buffer(0) will contain the entire header (unless
@@ -334,6 +439,12 @@ bmqt::EventBuilderResult::Enum PutEventBuilder::packMessage(int queueId)
     // success or failure).  Create a proctor to auto reset them.
     const ResetGuard guard(*this);
 
+    if (d_compressionAlgorithmType == bmqt::CompressionAlgorithmType::e_NONE ||
+        unpackedMessageSize() < Protocol::k_COMPRESSION_MIN_APPDATA_SIZE) {
+        // The payload will not be compressed.
+        return packUncompressedMessage(queueId);  // RETURN
+    }
+
     // Calculate length of entire application data (includes payload, message
     // properties and padding, if any).
     bsl::shared_ptr<bdlbb::Blob> bufferBlob_sp = d_blobSpPool_p->getObject();
@@ -429,6 +540,32 @@ bmqt::EventBuilderResult::Enum PutEventBuilder::packMessageRaw(int queueId)
     return packMessageInternal(*d_blobPayload_p, queueId);
 }
 
+PutEventBuilder& PutEventBuilder::prepareMessageProperties()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_msgStarted);
+
+    d_preparedProperties_p     = 0;
+    d_preparedPropertiesCrc32c = Crc32c::k_NULL_CRC32C;
+
+    if (!d_properties_p || 0 == d_properties_p->numProperties()) {
+        // Nothing to prepare; 'packMessage' skips the properties anyway.
+        return *this;  // RETURN
+    }
+
+    if (!d_messagePropertiesInfo.isExtended()) {
+        // Did not 'setMessagePropertiesLogic'.
+        d_messagePropertiesInfo = MessagePropertiesInfo::makeInvalidSchema();
+    }
+
+    d_preparedProperties_p     = &d_properties_p->streamOut(
+        d_blob_sp->factory(),
+        d_messagePropertiesInfo);
+    d_preparedPropertiesCrc32c = Crc32c::calculate(*d_preparedProperties_p);
+
+    return *this;
+}
+
 const bsl::shared_ptr<bdlbb::Blob>& PutEventBuilder::blob() const
 {
     // Fix packet's length in header now that we know it ..  Following is valid
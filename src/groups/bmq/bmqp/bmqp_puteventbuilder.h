@@ -32,6 +32,19 @@
 // Each message added to the PutEvent is padded, so that multiple messages can
 // be added in the same event, without impacting the alignment of the headers.
 //
+/// Prepared Message Properties
+///---------------------------
+// Packing a message with properties requires their wire representation and
+// a CRC-32C calculated over it, followed by the payload.  When many messages
+// sharing the same properties are packed in a row, 'prepareMessageProperties'
+// can be called once after the properties of the current message have been
+// set: their wire representation and its CRC-32C are then computed only once,
+// and reused by every subsequent 'packMessage' which only has to account for
+// the payload.  The prepared properties are discarded by 'startMessage',
+// 'setMessageProperties', 'setMessagePropertiesInfo',
+// 'clearMessageProperties' and 'reset'; the behavior is undefined if the
+// properties are modified while they are prepared.
+//
 /// Thread Safety
 ///-------------
 // NOT thread safe
@@ -178,6 +191,16 @@ class PutEventBuilder {
 
     MessagePropertiesInfo d_messagePropertiesInfo;
 
+    const bdlbb::Blob* d_preparedProperties_p;
+    // Wire representation of the
+    // properties of the current message,
+    // if they were prepared, or 0
+    // otherwise.
+
+    unsigned int d_preparedPropertiesCrc32c;
+    // CRC-32C of the prepared
+    // properties, if any.
+
   private:
     // NOT IMPLEMENTED
     PutEventBuilder(const PutEventBuilder&) BSLS_CPP11_DELETED;
@@ -190,9 +213,25 @@ class PutEventBuilder {
     /// Reset flags and message guid of this object.
     void resetFields();
 
+    /// Append to the underlying event blob the PutHeader and options of the
+    /// current message, whose application data is of the specified
+    /// `appDataLength`, with the specified `queueId` as the destination
+    /// queue, and load into the specified `numPaddingBytes` the number of
+    /// bytes to pad the application data with.  Return zero on success, and
+    /// a meaningful non-zero error code otherwise.
+    bmqt::EventBuilderResult::Enum
+    packMessageHeader(int* numPaddingBytes, int appDataLength, int queueId);
+
     bmqt::EventBuilderResult::Enum
     packMessageInternal(const bdlbb::Blob& appData, int queueId);
 
+    /// Add the current message, whose payload is not compressed, to the
+    /// underlying event blob with the specified `queueId` as the
+    /// destination queue, appending the properties and the payload directly
+    /// to the event blob.  Return zero on success, and a meaningful non-zero
+    /// error code otherwise.
+    bmqt::EventBuilderResult::Enum packUncompressedMessage(int queueId);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(PutEventBuilder, bslma::UsesBslmaAllocator)
@@ -275,6 +314,19 @@ class PutEventBuilder {
     /// reference offering modifiable access to this object.
     PutEventBuilder& clearMsgGroupId();
 
+    /// Compute the wire representation of the properties of the current
+    /// message, if any, and its CRC-32C, so that they are reused by all
+    /// subsequent calls to `packMessage` instead of being computed for
+    /// every message, and return a reference offering modifiable access to
+    /// this object.  The behavior is undefined unless the properties and
+    /// their `MessagePropertiesInfo`, if any, have been set, and unless the
+    /// properties are left unmodified for as long as they are prepared.
+    /// Note that the prepared properties are discarded by `startMessage`,
+    /// `setMessageProperties`, `setMessagePropertiesInfo`,
+    /// `clearMessageProperties` and `reset`, and that they are not used by
+    /// `packMessageInOldStyle`, nor when the payload gets compressed.
+    PutEventBuilder& prepareMessageProperties();
+
     /// Add the current message to the underlying event blob with the
     /// specified `queueId` as the destination queue.  Return zero on
     /// success, and a meaningful non-zero error code otherwise.  In case of
@@ -328,6 +380,10 @@ class PutEventBuilder {
     /// builder sets this number to zero.
     int messageCount() const;
 
+    /// Return `true` if the properties of the current message are prepared
+    /// (see `prepareMessageProperties`), and `false` otherwise.
+    bool hasPreparedMessageProperties() const;
+
     /// Return CRC32C of the current message.  Note that if `setCrc32c` has
     /// not been invoked, then zero will be returned.
     unsigned int crc32c() const;
@@ -434,7 +490,8 @@ PutEventBuilder::setMessageProperties(const MessageProperties* value)
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(value);
 
-    d_properties_p = value;
+    d_properties_p         = value;
+    d_preparedProperties_p = 0;
     return *this;
 }
 
@@ -458,6 +515,7 @@ inline PutEventBuilder&
 PutEventBuilder::setMessagePropertiesInfo(const MessagePropertiesInfo& value)
 {
     d_messagePropertiesInfo = value;
+    d_preparedProperties_p  = 0;
     return *this;
 }
 
@@ -465,6 +523,7 @@ inline PutEventBuilder& PutEventBuilder::clearMessageProperties()
 {
     d_properties_p          = 0;
     d_messagePropertiesInfo = MessagePropertiesInfo();
+    d_preparedProperties_p  = 0;
     return *this;
 }
 
@@ -489,6 +548,7 @@ inline void PutEventBuilder::startMessage()
     d_msgGroupId.reset();
     d_crc32c                = 0;
     d_messagePropertiesInfo = MessagePropertiesInfo();
+    d_preparedProperties_p  = 0;
 }
 
 // ACCESSORS
@@ -527,6 +587,11 @@ inline int PutEventBuilder::messageCount() const
     return d_msgCount;
 }
 
+inline bool PutEventBuilder::hasPreparedMessageProperties() const
+{
+    return d_preparedProperties_p != 0;
+}
+
 inline unsigned int PutEventBuilder::crc32c() const
 {
     return d_crc32c;
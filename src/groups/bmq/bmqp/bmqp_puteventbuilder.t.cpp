@@ -28,6 +28,7 @@
 
 #include <bmqu_blob.h>
 #include <bmqu_memoutstream.h>
+#include <bmqu_printutil.h>
 
 // BDE
 #include <bdlb_guid.h>
@@ -37,10 +38,12 @@
 #include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlf_bind.h>
+#include <bdlt_timeunitratio.h>
 #include <bsl_algorithm.h>
 #include <bsl_cmath.h>    // for bsl::fabs
 #include <bsl_cstring.h>  // for bsl::strlen
 #include <bsl_fstream.h>
+#include <bsl_iomanip.h>
 #include <bsl_ios.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
@@ -49,6 +52,7 @@
 #include <bslmf_assert.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_assert.h>
+#include <bsls_timeutil.h>
 
 // TEST DRIVER
 #include <bmqtst_testhelper.h>
@@ -158,6 +162,76 @@ unsigned int findExpectedCrc32(
     return expectedCrc32;
 }
 
+/// Pack the specified `numMessages` messages having the specified `payload`
+/// and `properties` with the specified `builder`, resetting it every
+/// `k_MESSAGES_PER_EVENT` messages, and encoding the properties and
+/// calculating the CRC-32C of every message in an intermediate blob obtained
+/// from the specified `blobSpPool` if the specified `encodePerMessage` is
+/// true (i.e., the way `packMessage` used to), or relying on `packMessage`
+/// with prepared properties if the specified `prepareProperties` is true, or
+/// on `packMessage` alone otherwise.  Return the elapsed time in
+/// nanoseconds.
+bsls::Types::Int64
+packMessages(bmqp::PutEventBuilder*          builder,
+             bmqp::BlobPoolUtil::BlobSpPool* blobSpPool,
+             const bsl::string&              payload,
+             const bmqp::MessageProperties&  properties,
+             int                             numMessages,
+             bool                            encodePerMessage,
+             bool                            prepareProperties)
+{
+    const int               k_MESSAGES_PER_EVENT = 1000;
+    const int               k_QID                = 9876;
+    const bmqt::MessageGUID guid = bmqp::MessageGUIDGenerator::testGUID();
+    const bmqp::MessagePropertiesInfo info =
+        bmqp::MessagePropertiesInfo::makeInvalidSchema();
+
+    builder->reset();
+
+    const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+
+    for (int i = 0; i < numMessages; ++i) {
+        if (i % k_MESSAGES_PER_EVENT == 0) {
+            builder->reset();
+            builder->startMessage();
+            builder->setMessageProperties(&properties);
+            builder->setMessagePropertiesInfo(info);
+            if (prepareProperties) {
+                builder->prepareMessageProperties();
+            }
+        }
+
+        bmqt::EventBuilderResult::Enum rc;
+        if (encodePerMessage) {
+            bsl::shared_ptr<bdlbb::Blob> payloadBlob_sp =
+                blobSpPool->getObject();
+            bsl::shared_ptr<bdlbb::Blob> appData_sp = blobSpPool->getObject();
+
+            bdlbb::BlobUtil::append(payloadBlob_sp.get(),
+                                    payload.data(),
+                                    static_cast<int>(payload.size()));
+            bdlbb::BlobUtil::append(
+                appData_sp.get(),
+                properties.streamOut(payloadBlob_sp->factory(), info));
+            bdlbb::BlobUtil::append(appData_sp.get(), *payloadBlob_sp);
+
+            builder->setMessagePayload(appData_sp.get())
+                .setCrc32c(bmqp::Crc32c::calculate(*appData_sp))
+                .setMessageGUID(guid);
+            rc = builder->packMessageRaw(k_QID);
+        }
+        else {
+            builder->setMessagePayload(payload.data(),
+                                       static_cast<int>(payload.size()))
+                .setMessageGUID(guid);
+            rc = builder->packMessage(k_QID);
+        }
+        BSLS_ASSERT_OPT(rc == bmqt::EventBuilderResult::e_SUCCESS);
+    }
+
+    return bsls::TimeUtil::getTimer() - begin;
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -2485,6 +2559,223 @@ static void test8_compressionRatioAccessor()
     BMQTST_ASSERT_GT(ratio, 1.0);
 }
 
+static void test9_prepareMessageProperties()
+// ------------------------------------------------------------------------
+// PREPARE MESSAGE PROPERTIES
+//
+// Concerns:
+//   1. Packing messages with prepared properties builds the same event as
+//      packing them without.
+//   2. The prepared properties are discarded by 'startMessage',
+//      'setMessageProperties', 'setMessagePropertiesInfo',
+//      'clearMessageProperties' and 'reset'.
+//   3. Preparing a message without properties is a no-op.
+//
+// Plan:
+//   1. Pack a few messages with properties, with and without preparing
+//      them, in two builders, and compare the built events.
+//   2. Prepare the properties, invoke each of the discarding manipulators,
+//      and verify that the properties are not prepared anymore.
+//   3. Prepare a message without properties and verify that the
+//      properties are not prepared.
+//
+// Testing:
+//   prepareMessageProperties()
+//   hasPreparedMessageProperties()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PREPARE MESSAGE PROPERTIES");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+
+    const char* k_PAYLOADS[] = {"a",
+                                "abcdefghijklmnopqrstuvwxyz",
+                                "0123456789"};
+    const int   k_NUM_PAYLOADS = sizeof(k_PAYLOADS) / sizeof(*k_PAYLOADS);
+    const int   k_QID          = 9876;
+
+    bmqp::MessageProperties msgProps(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, msgProps.setPropertyAsInt32("encoding", 3));
+    BMQTST_ASSERT_EQ(0, msgProps.setPropertyAsString("id", "myCoolId"));
+
+    bmqp::PutEventBuilder expected(blobSpPool.get(),
+                                   bmqtst::TestHelperUtil::allocator());
+    bmqp::PutEventBuilder obj(blobSpPool.get(),
+                              bmqtst::TestHelperUtil::allocator());
+
+    {
+        PV("Same event with and without prepared properties");
+
+        expected.startMessage();
+        expected.setMessageProperties(&msgProps);
+
+        obj.startMessage();
+        obj.setMessageProperties(&msgProps);
+        BMQTST_ASSERT(!obj.hasPreparedMessageProperties());
+
+        obj.prepareMessageProperties();
+        BMQTST_ASSERT(obj.hasPreparedMessageProperties());
+
+        for (int i = 0; i < k_NUM_PAYLOADS; ++i) {
+            const bmqt::MessageGUID guid =
+                bmqp::MessageGUIDGenerator::testGUID();
+
+            expected
+                .setMessagePayload(k_PAYLOADS[i], bsl::strlen(k_PAYLOADS[i]))
+                .setFlags(bmqp::PutHeaderFlags::e_ACK_REQUESTED)
+                .setMessageGUID(guid);
+            BMQTST_ASSERT_EQ(expected.packMessage(k_QID),
+                             bmqt::EventBuilderResult::e_SUCCESS);
+
+            obj
+                .setMessagePayload(k_PAYLOADS[i], bsl::strlen(k_PAYLOADS[i]))
+                .setFlags(bmqp::PutHeaderFlags::e_ACK_REQUESTED)
+                .setMessageGUID(guid);
+            BMQTST_ASSERT_EQ(obj.packMessage(k_QID),
+                             bmqt::EventBuilderResult::e_SUCCESS);
+            BMQTST_ASSERT(obj.hasPreparedMessageProperties());
+        }
+
+        BMQTST_ASSERT_EQ(obj.messageCount(), k_NUM_PAYLOADS);
+        BMQTST_ASSERT_EQ(
+            bdlbb::BlobUtil::compare(*obj.blob(), *expected.blob()),
+            0);
+    }
+
+    {
+        PV("Prepared properties are discarded");
+
+        obj.prepareMessageProperties();
+        obj.startMessage();
+        BMQTST_ASSERT(!obj.hasPreparedMessageProperties());
+
+        obj.setMessageProperties(&msgProps).prepareMessageProperties();
+        obj.setMessageProperties(&msgProps);
+        BMQTST_ASSERT(!obj.hasPreparedMessageProperties());
+
+        obj.prepareMessageProperties();
+        obj.setMessagePropertiesInfo(
+            bmqp::MessagePropertiesInfo::makeInvalidSchema());
+        BMQTST_ASSERT(!obj.hasPreparedMessageProperties());
+
+        obj.prepareMessageProperties();
+        obj.clearMessageProperties();
+        BMQTST_ASSERT(!obj.hasPreparedMessageProperties());
+
+        obj.setMessageProperties(&msgProps).prepareMessageProperties();
+        obj.reset();
+        BMQTST_ASSERT(!obj.hasPreparedMessageProperties());
+    }
+
+    {
+        PV("Nothing to prepare without properties");
+
+        obj.startMessage();
+        obj.prepareMessageProperties();
+        BMQTST_ASSERT(!obj.hasPreparedMessageProperties());
+    }
+}
+
+static void testN2_packMessageBenchmark()
+// ------------------------------------------------------------------------
+// BENCHMARK: PACK MESSAGE
+//
+// Concerns:
+//   Measure the number of messages per second 'packMessage' can pack for
+//   small messages sharing the same properties.
+//
+// Plan:
+//   Pack a large number of 100 bytes messages having a few properties:
+//   1. encoding the properties and calculating the CRC-32C over an
+//      intermediate blob for every message (i.e., what 'packMessage' used
+//      to do), and packing them with 'packMessageRaw'.
+//   2. with 'packMessage'.
+//   3. with 'packMessage' and prepared properties.
+//   Report the throughput of each and their speedup relative to 1.
+//
+// Testing:
+//   Performance of packMessage()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    bmqtst::TestHelper::printTestName("BENCHMARK: PACK MESSAGE");
+
+    const int k_NUM_MESSAGES = 5 * 1000 * 1000;
+    const int k_PAYLOAD_SIZE = 100;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        4 * 1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+    bmqp::PutEventBuilder builder(blobSpPool.get(),
+                                  bmqtst::TestHelperUtil::allocator());
+
+    const bsl::string payload(k_PAYLOAD_SIZE,
+                              'x',
+                              bmqtst::TestHelperUtil::allocator());
+
+    bmqp::MessageProperties properties(bmqtst::TestHelperUtil::allocator());
+    properties.setPropertyAsInt32("encoding", 3);
+    properties.setPropertyAsString("producerId", "myProducerId");
+    properties.setPropertyAsInt64("timestamp", 1234567890LL);
+
+    struct Variant {
+        const char* d_name;
+        bool        d_encodePerMessage;
+        bool        d_prepareProperties;
+    };
+
+    const Variant k_VARIANTS[] = {{"per-message encoding", true, false},
+                                  {"packMessage", false, false},
+                                  {"prepared properties", false, true}};
+
+    const int k_NUM_VARIANTS = sizeof(k_VARIANTS) / sizeof(*k_VARIANTS);
+
+    double baseline = 0;
+    for (int i = 0; i < k_NUM_VARIANTS; ++i) {
+        const Variant& variant = k_VARIANTS[i];
+
+        // Warm up the pools.
+        packMessages(&builder,
+                     blobSpPool.get(),
+                     payload,
+                     properties,
+                     k_NUM_MESSAGES / 10,
+                     variant.d_encodePerMessage,
+                     variant.d_prepareProperties);
+
+        const bsls::Types::Int64 elapsed = packMessages(
+            &builder,
+            blobSpPool.get(),
+            payload,
+            properties,
+            k_NUM_MESSAGES,
+            variant.d_encodePerMessage,
+            variant.d_prepareProperties);
+
+        const double rate = static_cast<double>(k_NUM_MESSAGES) *
+                            bdlt::TimeUnitRatio::k_NS_PER_S / elapsed;
+        if (i == 0) {
+            baseline = rate;
+        }
+
+        cout << bsl::setw(22) << variant.d_name << ": "
+             << bmqu::PrintUtil::prettyNumber(
+                    static_cast<bsls::Types::Int64>(rate))
+             << " msgs/s (x" << rate / baseline << ")" << endl;
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2511,6 +2802,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 9: test9_prepareMessageProperties(); break;
     case 8: test8_compressionRatioAccessor(); break;
     case 7: test7_multiplePackMessage(); break;
     case 6: test6_emptyBuilder(); break;
@@ -2520,6 +2812,7 @@ int main(int argc, char* argv[])
     case 2: test2_manipulators_one(); break;
     case 1: test1_breathingTest(); break;
     case -1: testN1_decodeFromFile(); break;
+    case -2: testN2_packMessageBenchmark(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
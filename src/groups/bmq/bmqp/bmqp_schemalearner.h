@@ -203,7 +203,8 @@ class SchemaLearner {
     /// Set up the specified `mps` to retrieve Message Properties from the
     /// specified `blob`.  If the sequence of Properties denoted by the
     /// specified `logic; is known, the `mps' will just keep a reference to
-    /// to the schema and consult it when retrieving Properties.  Otherwise,
+    /// to the schema and consult it when retrieving Properties, locating
+    /// and reading each of them directly from the `blob`.  Otherwise,
     /// populate the `mps` by parsing the `blob` and remember the sequence.
     /// The `logic` must be a result of previous `translate` call.
     int read(Context&                     context,
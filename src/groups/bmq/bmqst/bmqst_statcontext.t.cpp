@@ -56,6 +56,8 @@ using namespace bmqst;
 // [ 4] Usage example with value level
 // [ 4] Test updates
 // [ 5] Usage examples with updates
+// [ 9] Histogram values
+// [10] Histogram values updates
 //-----------------------------------------------------------------------------
 
 //=============================================================================
@@ -1090,6 +1092,249 @@ static void testUserData(bslma::Allocator* allocator)
     ASSERT(NULL == ptr);
 }
 
+static void testHistogram(bslma::Allocator* allocator)
+{
+    // ------------------------------------------------------------------------
+    // HISTOGRAM TEST
+    //
+    // Concerns:
+    //  1. Every value maps to a histogram bucket whose bounds contain it,
+    //     except values too large for the histogram which go to the last
+    //     bucket.
+    //  2. Percentiles computed between two snapshots of a 'e_HISTOGRAM'
+    //     value fall in the bucket of the exact percentile of the values
+    //     reported in between, and are 0 if nothing was reported.
+    //  3. The histograms of subcontexts, including deleted ones, are
+    //     aggregated in the totals of their parent.
+    //
+    // Plan:
+    //  1. Check the bucket of a variety of values against its bounds.
+    //  2. Report known distributions to a table context and its
+    //     subcontexts, and compare the percentiles between different
+    //     snapshots to the exact ones.
+    //
+    // Testing:
+    //  StatValue::histogramBucket()
+    //  StatValue::histogramBucketLowerBound()
+    //  StatValue::histogramBucketUpperBound()
+    //  StatValue::histogram()
+    //  StatUtil::percentile()
+    //  StatUtil::histogramDifference()
+    // ------------------------------------------------------------------------
+
+    typedef bsls::Types::Int64 Int64;
+
+    PV("Verify values are mapped to the bucket containing them.");
+
+    ASSERT_EQUALS(0, StatValue::histogramBucket(-5));
+    ASSERT_EQUALS(0, StatValue::histogramBucket(0));
+    ASSERT_EQUALS(StatValue::k_NUM_HISTOGRAM_BUCKETS - 1,
+                  StatValue::histogramBucket(MAX_INT));
+
+    int previousBucket = 0;
+    const Int64 k_MAX_VALUE = static_cast<Int64>(1)
+                              << StatValue::k_HISTOGRAM_MAX_BITS;
+    for (Int64 value = 1; value < k_MAX_VALUE; value += 1 + value / 7) {
+        const int bucket = StatValue::histogramBucket(value);
+        ASSERT(previousBucket <= bucket);
+        ASSERT(StatValue::histogramBucketLowerBound(bucket) <= value);
+        ASSERT(value < StatValue::histogramBucketUpperBound(bucket));
+        previousBucket = bucket;
+    }
+
+    for (int bucket = 1; bucket < StatValue::k_NUM_HISTOGRAM_BUCKETS;
+         ++bucket) {
+        ASSERT_EQUALS(StatValue::histogramBucketUpperBound(bucket - 1),
+                      StatValue::histogramBucketLowerBound(bucket));
+        ASSERT_EQUALS(bucket,
+                      StatValue::histogramBucket(
+                          StatValue::histogramBucketLowerBound(bucket)));
+    }
+
+    PV("Verify percentiles between snapshots.");
+
+    StatContext context(StatContextConfiguration("context")
+                            .isTable(true)
+                            .value("h", StatValue::e_HISTOGRAM, 3),
+                        allocator);
+
+    const StatValue::SnapshotLocation latest(0, 0);
+    const StatValue::SnapshotLocation previous(0, 1);
+    const StatValue::SnapshotLocation oldest(0, 2);
+
+    context.snapshot();
+    ASSERT_EQUALS(
+        0,
+        StatUtil::percentile50(direct(context, 0), latest, previous));
+
+    for (Int64 value = 1; value <= 100; ++value) {
+        context.reportValue(0, value);
+    }
+    context.snapshot();
+
+#define ASSERT_PERCENTILE(EXPECTED, VALUE, FIRST, SECOND, PERCENTILE)        \
+    ASSERT_EQUALS(StatValue::histogramBucket(EXPECTED),                       \
+                  StatValue::histogramBucket(                                 \
+                      StatUtil::percentile(VALUE, FIRST, SECOND, PERCENTILE)))
+
+    ASSERT_PERCENTILE(1, direct(context, 0), latest, previous, 0);
+    ASSERT_PERCENTILE(50, direct(context, 0), latest, previous, 50);
+    ASSERT_PERCENTILE(90, direct(context, 0), latest, previous, 90);
+    ASSERT_PERCENTILE(99, direct(context, 0), latest, previous, 99);
+    ASSERT_PERCENTILE(100, direct(context, 0), latest, previous, 100);
+
+    for (int i = 0; i < 100; ++i) {
+        context.reportValue(0, 1000000);
+    }
+    context.snapshot();
+
+    ASSERT_PERCENTILE(1000000, direct(context, 0), latest, previous, 0);
+    ASSERT_PERCENTILE(1000000, direct(context, 0), latest, previous, 50);
+    ASSERT_PERCENTILE(50, direct(context, 0), latest, oldest, 25);
+    ASSERT_PERCENTILE(100, direct(context, 0), latest, oldest, 50);
+    ASSERT_PERCENTILE(1000000, direct(context, 0), latest, oldest, 50.5);
+    ASSERT_EQUALS(StatUtil::percentile50(direct(context, 0), latest, oldest),
+                  StatUtil::percentile(direct(context, 0),
+                                       latest,
+                                       oldest,
+                                       50));
+
+    bsl::vector<Int64> counts(allocator);
+    ASSERT_EQUALS(200,
+                  StatUtil::histogramDifference(&counts,
+                                                direct(context, 0),
+                                                latest,
+                                                oldest));
+    ASSERT_EQUALS(static_cast<size_t>(StatValue::k_NUM_HISTOGRAM_BUCKETS),
+                  counts.size());
+    ASSERT_EQUALS(100, counts[StatValue::histogramBucket(1000000)]);
+
+    PV("Verify histograms of subcontexts are aggregated.");
+
+    bslma::ManagedPtr<StatContext> sub1 = context.addSubcontext(
+        StatContextConfiguration("sub1"));
+    bslma::ManagedPtr<StatContext> sub2 = context.addSubcontext(
+        StatContextConfiguration("sub2"));
+
+    for (Int64 value = 1; value <= 100; ++value) {
+        sub1->reportValue(0, value * 1000);
+    }
+    sub2->reportValue(0, 10);
+    context.snapshot();
+
+    const StatValue& total = context.value(StatContext::e_TOTAL_VALUE, 0);
+    ASSERT_PERCENTILE(10, total, latest, previous, 0);
+    ASSERT_PERCENTILE(50000, total, latest, previous, 50);
+    ASSERT_PERCENTILE(100000, total, latest, previous, 100);
+
+    // Deleting a subcontext keeps its values in the totals of its parent.
+    sub1.clear();
+    sub2->reportValue(0, 20);
+    context.snapshot();
+
+    ASSERT_PERCENTILE(20, total, latest, previous, 0);
+    ASSERT_PERCENTILE(20, total, latest, previous, 100);
+    ASSERT_PERCENTILE(10, total, latest, oldest, 0);
+    ASSERT_PERCENTILE(100000, total, latest, oldest, 100);
+
+#undef ASSERT_PERCENTILE
+}
+
+static void testHistogramUpdates(bslma::Allocator* allocator)
+{
+    // ------------------------------------------------------------------------
+    // HISTOGRAM UPDATES TEST
+    //
+    // Concerns:
+    //  The buckets of a 'e_HISTOGRAM' value are carried by updates, so that
+    //  percentiles computed on a context built and snapshotted from updates
+    //  match the ones of the original context.
+    //
+    // Plan:
+    //  Report known distributions to a context collecting updates, apply
+    //  the updates to another context and compare the percentiles of both.
+    //
+    // Testing:
+    //  StatValue::setFromUpdate()
+    //  StatValueUtil::loadUpdate()
+    //  StatValueUtil::loadFullUpdate()
+    // ------------------------------------------------------------------------
+
+    typedef bsls::Types::Int64      Int64;
+    typedef bmqstm::StatValueFields Fields;
+
+    const StatValue::SnapshotLocation latest(0, 0);
+    const StatValue::SnapshotLocation previous(0, 1);
+    const StatValue::SnapshotLocation oldest(0, 2);
+
+#define ASSERT_SAME_PERCENTILE(FIRST, SECOND, PERCENTILE)                     \
+    ASSERT_EQUALS(                                                            \
+        StatUtil::percentile(direct(c1, 0), FIRST, SECOND, PERCENTILE),       \
+        StatUtil::percentile(direct(c2, 0), FIRST, SECOND, PERCENTILE))
+
+    PV("Verify a full update carries the buckets.");
+
+    bmqstm::StatContextUpdate u1(allocator);
+    bmqstm::StatContextUpdate u2(allocator);
+    StatContext c1(StatContextConfiguration("context1", allocator)
+                       .value("h", StatValue::e_HISTOGRAM, 3)
+                       .enableUpdateCollection(&u1),
+                   allocator);
+
+    for (Int64 value = 1; value <= 100; ++value) {
+        c1.reportValue(0, value);
+    }
+    c1.snapshot();
+
+    ASSERT(hasField(u1, 0, Fields::E_EVENTS));
+    ASSERT_EQUALS(2 * direct(c1, 0).histogram(latest).size(),
+                  u1.directValues()[0].buckets().size());
+
+    StatContext c2(
+        StatContextConfiguration(u1, allocator).enableUpdateCollection(&u2),
+        allocator);
+    ASSERT(direct(c1, 0).histogram(latest) ==
+           direct(c2, 0).histogram(latest));
+    ASSERT_SAME_PERCENTILE(latest, previous, 50);
+    ASSERT_SAME_PERCENTILE(latest, previous, 99);
+
+    PV("Verify a partial update carries the buckets.");
+
+    for (int i = 0; i < 100; ++i) {
+        c1.reportValue(0, 1000000);
+    }
+    c1.snapshot();
+    ASSERT(hasField(u1, 0, Fields::E_EVENTS));
+
+    c2.snapshotFromUpdate(u1);
+    ASSERT(direct(c1, 0).histogram(latest) ==
+           direct(c2, 0).histogram(latest));
+    ASSERT_SAME_PERCENTILE(latest, previous, 0);
+    ASSERT_SAME_PERCENTILE(latest, previous, 50);
+    ASSERT_SAME_PERCENTILE(latest, oldest, 25);
+    ASSERT_SAME_PERCENTILE(latest, oldest, 75);
+    ASSERT_EQUALS(StatValue::histogramBucket(1000000),
+                  StatValue::histogramBucket(StatUtil::percentile50(
+                      direct(c2, 0),
+                      latest,
+                      previous)));
+
+    PV("Verify an update without new values keeps the buckets.");
+
+    c1.snapshot();
+    ASSERT(!hasField(u1, 0, Fields::E_EVENTS));
+    ASSERT(u1.directValues()[0].buckets().empty());
+
+    c2.snapshotFromUpdate(u1);
+    ASSERT(direct(c1, 0).histogram(latest) ==
+           direct(c2, 0).histogram(latest));
+    ASSERT_EQUALS(MAX_INT,
+                  StatUtil::percentile50(direct(c2, 0), latest, previous));
+    ASSERT_SAME_PERCENTILE(latest, oldest, 50);
+
+#undef ASSERT_SAME_PERCENTILE
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -1125,6 +1370,30 @@ int main(int argc, char** argv)
 
     switch (test) {
     case 0:  // Zero is always the leading case.
+    case 10: {
+        // --------------------------------------------------------------------
+        // TEST HISTOGRAM UPDATES
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "TEST HISTOGRAM UPDATES" << endl
+                 << "======================" << endl;
+        testHistogramUpdates(&ta);
+    } break;
+
+    case 9: {
+        // --------------------------------------------------------------------
+        // TEST HISTOGRAM
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "TEST HISTOGRAM" << endl
+                 << "==============" << endl;
+        testHistogram(&ta);
+    } break;
+
     case 8: {
         // --------------------------------------------------------------------
         // TEST USER DATA ABI COMPATIBILITY
@@ -17,6 +17,7 @@
 
 #include <bmqscm_version.h>
 #include <bsl_algorithm.h>
+#include <bsl_cmath.h>
 #include <bsl_limits.h>
 
 namespace BloombergLP {
@@ -347,7 +348,7 @@ bsls::Types::Int64
 StatUtil::events(const StatValue&                   value,
                  const StatValue::SnapshotLocation& snapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::e_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::e_CONTINUOUS);
     return value.snapshot(snapshot).events();
 }
 
@@ -356,7 +357,7 @@ StatUtil::eventsDifference(const StatValue&                   value,
                            const StatValue::SnapshotLocation& firstSnapshot,
                            const StatValue::SnapshotLocation& secondSnapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::e_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::e_CONTINUOUS);
 
     return value.snapshot(firstSnapshot).events() -
            value.snapshot(secondSnapshot).events();
@@ -365,7 +366,7 @@ StatUtil::eventsDifference(const StatValue&                   value,
 bsls::Types::Int64 StatUtil::sum(const StatValue&                   value,
                                  const StatValue::SnapshotLocation& snapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::e_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::e_CONTINUOUS);
     return value.snapshot(snapshot).sum();
 }
 
@@ -374,7 +375,7 @@ StatUtil::sumDifference(const StatValue&                   value,
                         const StatValue::SnapshotLocation& firstSnapshot,
                         const StatValue::SnapshotLocation& secondSnapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::e_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::e_CONTINUOUS);
 
     return value.snapshot(firstSnapshot).sum() -
            value.snapshot(secondSnapshot).sum();
@@ -385,7 +386,7 @@ StatUtil::averagePerEvent(const StatValue&                   value,
                           const StatValue::SnapshotLocation& firstSnapshot,
                           const StatValue::SnapshotLocation& secondSnapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::e_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::e_CONTINUOUS);
 
     bsls::Types::Int64 events = eventsDifference(value,
                                                  firstSnapshot,
@@ -406,7 +407,7 @@ double StatUtil::averagePerEventReal(
     const StatValue::SnapshotLocation& firstSnapshot,
     const StatValue::SnapshotLocation& secondSnapshot)
 {
-    BSLS_ASSERT(value.type() == StatValue::e_DISCRETE);
+    BSLS_ASSERT(value.type() != StatValue::e_CONTINUOUS);
 
     bsls::Types::Int64 events = eventsDifference(value,
                                                  firstSnapshot,
@@ -422,5 +423,125 @@ double StatUtil::averagePerEventReal(
     }
 }
 
+bsls::Types::Int64
+StatUtil::percentile(const StatValue&                   value,
+                     const StatValue::SnapshotLocation& firstSnapshot,
+                     const StatValue::SnapshotLocation& secondSnapshot,
+                     double                             percentile)
+{
+    BSLS_ASSERT(value.type() == StatValue::e_HISTOGRAM);
+    BSLS_ASSERT(0 <= percentile && percentile <= 100);
+
+    const StatValue::Histogram& first  = value.histogram(firstSnapshot);
+    const StatValue::Histogram& second = value.histogram(secondSnapshot);
+
+    // Both histograms are sorted by bucket, and every bucket of 'second' is
+    // also in 'first' since buckets are cumulative.  Walk them in parallel to
+    // find the bucket holding the value of the requested rank.
+    bsls::Types::Int64 total = eventsDifference(value,
+                                                firstSnapshot,
+                                                secondSnapshot);
+    if (total <= 0) {
+        // Unlike the maximum or the average, a percentile is reported for
+        // every interval, so report an empty one as 0 rather than as an
+        // undefined value.
+        return 0;  // RETURN
+    }
+
+    bsls::Types::Int64 rank = static_cast<bsls::Types::Int64>(
+        bsl::ceil(percentile * static_cast<double>(total) / 100.0));
+    rank = bsl::max(rank, static_cast<bsls::Types::Int64>(1));
+
+    StatValue::Histogram::const_iterator secondIt = second.begin();
+    bsls::Types::Int64                   count    = 0;
+    int                                  bucket   = 0;
+    for (StatValue::Histogram::const_iterator firstIt = first.begin();
+         firstIt != first.end();
+         ++firstIt) {
+        bucket                   = firstIt->first;
+        bsls::Types::Int64 delta = firstIt->second;
+        while (secondIt != second.end() && secondIt->first < bucket) {
+            ++secondIt;
+        }
+        if (secondIt != second.end() && secondIt->first == bucket) {
+            delta -= secondIt->second;
+        }
+
+        count += delta;
+        if (count >= rank) {
+            break;  // BREAK
+        }
+    }
+
+    const bsls::Types::Int64 lower = StatValue::histogramBucketLowerBound(
+        bucket);
+    const bsls::Types::Int64 upper = StatValue::histogramBucketUpperBound(
+        bucket);
+    return lower + (upper - lower - 1) / 2;
+}
+
+bsls::Types::Int64
+StatUtil::percentile50(const StatValue&                   value,
+                       const StatValue::SnapshotLocation& firstSnapshot,
+                       const StatValue::SnapshotLocation& secondSnapshot)
+{
+    return percentile(value, firstSnapshot, secondSnapshot, 50.0);
+}
+
+bsls::Types::Int64
+StatUtil::percentile90(const StatValue&                   value,
+                       const StatValue::SnapshotLocation& firstSnapshot,
+                       const StatValue::SnapshotLocation& secondSnapshot)
+{
+    return percentile(value, firstSnapshot, secondSnapshot, 90.0);
+}
+
+bsls::Types::Int64
+StatUtil::percentile99(const StatValue&                   value,
+                       const StatValue::SnapshotLocation& firstSnapshot,
+                       const StatValue::SnapshotLocation& secondSnapshot)
+{
+    return percentile(value, firstSnapshot, secondSnapshot, 99.0);
+}
+
+bsls::Types::Int64
+StatUtil::percentile999(const StatValue&                   value,
+                        const StatValue::SnapshotLocation& firstSnapshot,
+                        const StatValue::SnapshotLocation& secondSnapshot)
+{
+    return percentile(value, firstSnapshot, secondSnapshot, 99.9);
+}
+
+bsls::Types::Int64 StatUtil::histogramDifference(
+    bsl::vector<bsls::Types::Int64>*   counts,
+    const StatValue&                   value,
+    const StatValue::SnapshotLocation& firstSnapshot,
+    const StatValue::SnapshotLocation& secondSnapshot)
+{
+    BSLS_ASSERT(counts);
+    BSLS_ASSERT(value.type() == StatValue::e_HISTOGRAM);
+
+    counts->assign(StatValue::k_NUM_HISTOGRAM_BUCKETS, 0);
+
+    const StatValue::Histogram& first  = value.histogram(firstSnapshot);
+    const StatValue::Histogram& second = value.histogram(secondSnapshot);
+
+    bsls::Types::Int64 total = 0;
+    for (StatValue::Histogram::const_iterator it = first.begin();
+         it != first.end();
+         ++it) {
+        (*counts)[it->first] += it->second;
+        total += it->second;
+    }
+    for (StatValue::Histogram::const_iterator it = second.begin();
+         it != second.end();
+         ++it) {
+        (*counts)[it->first] -= it->second;
+        total -= it->second;
+    }
+
+    return total;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
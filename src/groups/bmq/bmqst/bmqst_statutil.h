@@ -40,6 +40,8 @@
 #include <bsls_types.h>
 #endif
 
+#include <bsl_vector.h>
+
 namespace BloombergLP {
 namespace bmqst {
 
@@ -210,9 +212,9 @@ struct StatUtil {
     /// returned.
     static bsls::Types::Int64 absoluteMax(const StatValue& value);
 
-    // ** Discrete StatValue functions only       **
-    // ** The behavior is undefined unless        **
-    // ** 'value.type() == StatValue::e_DISCRETE' **
+    // ** Discrete StatValue functions only         **
+    // ** The behavior is undefined unless          **
+    // ** 'value.type() != StatValue::e_CONTINUOUS' **
 
     /// Return the total number of events recorded by the
     /// specified `value` up to the specified `snapshot`.
@@ -256,6 +258,55 @@ struct StatUtil {
     averagePerEventReal(const StatValue&                   value,
                         const StatValue::SnapshotLocation& firstSnapshot,
                         const StatValue::SnapshotLocation& secondSnapshot);
+
+    // ** Histogram StatValue functions only       **
+    // ** The behavior is undefined unless         **
+    // ** 'value.type() == StatValue::e_HISTOGRAM' **
+
+    /// Return an estimate of the specified `percentile` of the values
+    /// reported to the specified `value` between the specified
+    /// `firstSnapshot` and the specified `secondSnapshot`, i.e. the middle
+    /// of the histogram bucket containing the value ranked at `percentile`
+    /// percent of these values.  If nothing was reported, 0 is returned.  The
+    /// behavior is undefined unless `0 <= percentile <= 100`.
+    static bsls::Types::Int64
+    percentile(const StatValue&                   value,
+               const StatValue::SnapshotLocation& firstSnapshot,
+               const StatValue::SnapshotLocation& secondSnapshot,
+               double                             percentile);
+
+    /// Return an estimate of the 50th, 90th, 99th or 99.9th percentile
+    /// (respectively) of the values reported to the specified `value`
+    /// between the specified `firstSnapshot` and the specified
+    /// `secondSnapshot`, as returned by `percentile`.  If nothing was
+    /// reported, 0 is returned.
+    static bsls::Types::Int64
+    percentile50(const StatValue&                   value,
+                 const StatValue::SnapshotLocation& firstSnapshot,
+                 const StatValue::SnapshotLocation& secondSnapshot);
+    static bsls::Types::Int64
+    percentile90(const StatValue&                   value,
+                 const StatValue::SnapshotLocation& firstSnapshot,
+                 const StatValue::SnapshotLocation& secondSnapshot);
+    static bsls::Types::Int64
+    percentile99(const StatValue&                   value,
+                 const StatValue::SnapshotLocation& firstSnapshot,
+                 const StatValue::SnapshotLocation& secondSnapshot);
+    static bsls::Types::Int64
+    percentile999(const StatValue&                   value,
+                  const StatValue::SnapshotLocation& firstSnapshot,
+                  const StatValue::SnapshotLocation& secondSnapshot);
+
+    /// Load into the specified `counts` the number of values reported to
+    /// the specified `value` into each histogram bucket between the
+    /// specified `firstSnapshot` and the specified `secondSnapshot`, and
+    /// return the total number of these values.  `counts` is resized to
+    /// `StatValue::k_NUM_HISTOGRAM_BUCKETS`.
+    static bsls::Types::Int64
+    histogramDifference(bsl::vector<bsls::Types::Int64>*   counts,
+                        const StatValue&                   value,
+                        const StatValue::SnapshotLocation& firstSnapshot,
+                        const StatValue::SnapshotLocation& secondSnapshot);
 };
 
 }  // close package namespace
@@ -36,6 +36,11 @@ bsls::Types::Int64 MIN_INT = bsl::numeric_limits<bsls::Types::Int64>::min();
 // class StatValue
 // ---------------
 
+// PUBLIC CONSTANTS
+const int StatValue::k_HISTOGRAM_SUB_BUCKET_BITS;
+const int StatValue::k_HISTOGRAM_MAX_BITS;
+const int StatValue::k_NUM_HISTOGRAM_BUCKETS;
+
 // PRIVATE MANIPULATORS
 void StatValue::aggregateLevel(int level, bsls::Types::Int64 snapshotTime)
 {
@@ -48,8 +53,9 @@ void StatValue::aggregateLevel(int level, bsls::Types::Int64 snapshotTime)
                     d_levelStartIndices[level + 1];
     d_curSnapshotIndices[level + 1] = (d_curSnapshotIndices[level + 1] + 1) %
                                       levelSize;
-    Snapshot& aggSnapshot = d_history[d_curSnapshotIndices[level + 1] +
-                                      d_levelStartIndices[level + 1]];
+    const int aggIndex    = d_curSnapshotIndices[level + 1] +
+                         d_levelStartIndices[level + 1];
+    Snapshot& aggSnapshot = d_history[aggIndex];
 
     // 'd_levelStartIndices[level]' will be the most recent snapshot of the
     // previous level (being aggregated here) since we call 'aggregateLevel'
@@ -62,6 +68,12 @@ void StatValue::aggregateLevel(int level, bsls::Types::Int64 snapshotTime)
     aggSnapshot.d_decrementsOrSum    = firstSnapshot.d_decrementsOrSum;
     aggSnapshot.d_snapshotTime       = snapshotTime;
 
+    if (d_type == e_HISTOGRAM) {
+        // Buckets are cumulative, like the sum and number of events
+        d_histogramHistory[aggIndex] =
+            d_histogramHistory[d_levelStartIndices[level]];
+    }
+
     for (int i = d_levelStartIndices[level] + 1;
          i < d_levelStartIndices[level + 1];
          ++i) {
@@ -85,6 +97,8 @@ StatValue::StatValue(bslma::Allocator* basicAllocator)
 , d_curSnapshotIndices(basicAllocator)
 , d_min(0)
 , d_max(0)
+, d_currentBuckets(basicAllocator)
+, d_histogramHistory(basicAllocator)
 {
 }
 
@@ -99,6 +113,8 @@ StatValue::StatValue(const bsl::vector<int>& sizes,
 , d_curSnapshotIndices(basicAllocator)
 , d_min(0)
 , d_max(0)
+, d_currentBuckets(basicAllocator)
+, d_histogramHistory(basicAllocator)
 {
     init(sizes, type, initTime);
 }
@@ -111,6 +127,8 @@ StatValue::StatValue(const StatValue& other, bslma::Allocator* basicAllocator)
 , d_curSnapshotIndices(other.d_curSnapshotIndices, basicAllocator)
 , d_min(other.d_min)
 , d_max(other.d_max)
+, d_currentBuckets(other.d_currentBuckets, basicAllocator)
+, d_histogramHistory(other.d_histogramHistory, basicAllocator)
 {
 }
 
@@ -123,6 +141,8 @@ StatValue& StatValue::operator=(const StatValue& rhs)
     d_curSnapshotIndices = rhs.d_curSnapshotIndices;
     d_min                = rhs.d_min;
     d_max                = rhs.d_max;
+    d_currentBuckets     = rhs.d_currentBuckets;
+    d_histogramHistory   = rhs.d_histogramHistory;
 
     return *this;
 }
@@ -163,6 +183,17 @@ void StatValue::addSnapshot(const StatValue& other)
 
     d_currentStats.d_incrementsOrEvents += otherSnapshot.d_incrementsOrEvents;
     d_currentStats.d_decrementsOrSum += otherSnapshot.d_decrementsOrSum;
+
+    if (d_type == e_HISTOGRAM) {
+        const Histogram& otherHistogram =
+            other.d_histogramHistory[other.d_curSnapshotIndices[0]];
+        for (Histogram::const_iterator it = otherHistogram.begin();
+             it != otherHistogram.end();
+             ++it) {
+            bsls::AtomicOperations::addInt64(&d_currentBuckets[it->first],
+                                             it->second);
+        }
+    }
 }
 
 void StatValue::setFromUpdate(const bmqstm::StatValueUpdate& update)
@@ -206,6 +237,24 @@ void StatValue::setFromUpdate(const bmqstm::StatValueUpdate& update)
             ++f;
         }
     }
+
+    if (d_type == e_HISTOGRAM &&
+        bdlb::BitUtil::isBitSet(update.fieldMask(), Fields::E_EVENTS)) {
+        // The buckets are sent along with the number of events, as they only
+        // change together.
+
+        BSLS_ASSERT(update.buckets().size() % 2 == 0);
+
+        for (int i = 0; i < k_NUM_HISTOGRAM_BUCKETS; ++i) {
+            bsls::AtomicOperations::setInt64(&d_currentBuckets[i], 0);
+        }
+        for (bsl::size_t i = 0; i + 1 < update.buckets().size(); i += 2) {
+            const bsls::Types::Int64 bucket = update.buckets()[i];
+            BSLS_ASSERT(0 <= bucket && bucket < k_NUM_HISTOGRAM_BUCKETS);
+            bsls::AtomicOperations::setInt64(&d_currentBuckets[bucket],
+                                             update.buckets()[i + 1]);
+        }
+    }
 }
 
 void StatValue::takeSnapshot(bsls::Types::Int64 snapshotTime)
@@ -242,6 +291,20 @@ void StatValue::takeSnapshot(bsls::Types::Int64 snapshotTime)
     snapshot.d_decrementsOrSum    = decrementsOrSum;
     snapshot.d_snapshotTime       = snapshotTime;
 
+    if (d_type == e_HISTOGRAM) {
+        // Only keep the non-empty buckets, reusing the capacity of the
+        // histogram being overwritten.
+        Histogram& histogram = d_histogramHistory[d_curSnapshotIndices[0]];
+        histogram.clear();
+        for (int i = 0; i < k_NUM_HISTOGRAM_BUCKETS; ++i) {
+            const bsls::Types::Int64 count = bsls::AtomicOperations::getInt64(
+                &d_currentBuckets[i]);
+            if (count != 0) {
+                histogram.push_back(bsl::make_pair(i, count));
+            }
+        }
+    }
+
     if (d_curSnapshotIndices[0] == 0) {
         // We've performed enough snapshots to advance to the next aggregation
         // level
@@ -251,14 +314,18 @@ void StatValue::takeSnapshot(bsls::Types::Int64 snapshotTime)
 
 void StatValue::clear(bsls::Types::Int64 snapshotTime)
 {
-    d_currentStats.reset(d_type == e_DISCRETE, 0);
+    clearCurrentStats();
     d_curSnapshotIndices.assign(d_curSnapshotIndices.size(), 0);
 
     for (size_t i = 0; i < d_history.size(); ++i) {
-        d_history[i].reset(d_type == e_DISCRETE, snapshotTime);
+        d_history[i].reset(d_type != e_CONTINUOUS, snapshotTime);
+    }
+
+    for (size_t i = 0; i < d_histogramHistory.size(); ++i) {
+        d_histogramHistory[i].clear();
     }
 
-    if (d_type == e_DISCRETE) {
+    if (d_type != e_CONTINUOUS) {
         d_min = MAX_INT;
         d_max = MIN_INT;
     }
@@ -275,9 +342,9 @@ void StatValue::init(const bsl::vector<int>& sizes,
     d_type = type;
     d_levelStartIndices.resize(sizes.size() + 1);
     d_curSnapshotIndices.assign(sizes.size(), 0);
-    d_min = (d_type == e_DISCRETE ? MAX_INT : 0);
-    d_max = (d_type == e_DISCRETE ? MIN_INT : 0);
-    d_currentStats.reset(d_type == e_DISCRETE, 0);
+    d_min = (d_type != e_CONTINUOUS ? MAX_INT : 0);
+    d_max = (d_type != e_CONTINUOUS ? MIN_INT : 0);
+    d_currentStats.reset(d_type != e_CONTINUOUS, 0);
 
     int historySize = 0;
     for (size_t i = 0; i < sizes.size(); ++i) {
@@ -290,7 +357,17 @@ void StatValue::init(const bsl::vector<int>& sizes,
     d_history.resize(historySize);
 
     for (size_t i = 0; i < d_history.size(); ++i) {
-        d_history[i].reset(d_type == e_DISCRETE, snapshotTime);
+        d_history[i].reset(d_type != e_CONTINUOUS, snapshotTime);
+    }
+
+    d_currentBuckets.clear();
+    d_histogramHistory.clear();
+    if (d_type == e_HISTOGRAM) {
+        d_currentBuckets.resize(k_NUM_HISTOGRAM_BUCKETS);
+        for (size_t i = 0; i < d_currentBuckets.size(); ++i) {
+            bsls::AtomicOperations::initInt64(&d_currentBuckets[i], 0);
+        }
+        d_histogramHistory.resize(historySize);
     }
 }
 
@@ -408,14 +485,14 @@ void StatValueUtil::loadUpdateImp(bmqstm::StatValueUpdate* update,
                 }
             } break;
             case Fields::E_EVENTS: {
-                if (StatValue::e_DISCRETE == value.type() &&
+                if (StatValue::e_CONTINUOUS != value.type() &&
                     (full || current.events() != last->events())) {
                     update->fields().push_back(current.events());
                     mask = bdlb::BitUtil::withBitSet(mask, i);
                 }
             } break;
             case Fields::E_SUM: {
-                if (StatValue::e_DISCRETE == value.type() &&
+                if (StatValue::e_CONTINUOUS != value.type() &&
                     (full || current.sum() != last->sum())) {
                     update->fields().push_back(current.sum());
                     mask = bdlb::BitUtil::withBitSet(mask, i);
@@ -428,6 +505,22 @@ void StatValueUtil::loadUpdateImp(bmqstm::StatValueUpdate* update,
         }
     }
     update->fieldMask() = mask;
+
+    if (StatValue::e_HISTOGRAM == value.type() &&
+        bdlb::BitUtil::isBitSet(mask, Fields::E_EVENTS)) {
+        // The cumulative buckets change exactly when the number of events
+        // does, so send them along with it.
+
+        const StatValue::Histogram& histogram = value.histogram(
+            StatValue::SnapshotLocation());
+        update->buckets().reserve(2 * histogram.size());
+        for (StatValue::Histogram::const_iterator it = histogram.begin();
+             it != histogram.end();
+             ++it) {
+            update->buckets().push_back(it->first);
+            update->buckets().push_back(it->second);
+        }
+    }
 }
 
 }  // close package namespace
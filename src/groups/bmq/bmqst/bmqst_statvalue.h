@@ -30,6 +30,18 @@
 // maintains a value and collects statistics about it and changes to it.  It
 // can be asked to calculate a number of statistics over its history.
 //
+// A 'bmqst::StatValue' of type 'e_HISTOGRAM' behaves like a discrete value,
+// but additionally records the distribution of the reported values into a
+// fixed set of log-linear buckets: each power of two is split into
+// '2^k_HISTOGRAM_SUB_BUCKET_BITS' equally sized sub-buckets, so that the
+// width of a bucket is at most 1/8th of its lower bound.  The buckets are
+// cumulative, like the sum and number of events of a discrete value, so that
+// the distribution of the values reported between any two snapshots (and
+// therefore its percentiles, see 'bmqst::StatUtil') can be computed from the
+// difference of their histograms.  Histograms are merged by 'addSnapshot',
+// and are therefore aggregated across subcontexts by 'bmqst::StatContext'.
+// Note that a snapshot only stores its non-empty buckets.
+//
 // You probably should not use this class directly.  Instead, you should use
 // the 'bmqst::StatContext' component.  Refer to the usage examples in the
 // documentation of that component.
@@ -41,12 +53,15 @@
 #include <bslim_printer.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bdlb_bitutil.h>
 #include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_cstdint.h>
 #include <bsl_limits.h>
 #include <bsl_ostream.h>
+#include <bsl_utility.h>
 #include <bsl_vector.h>
 #include <bsls_types.h>
 
@@ -185,6 +200,11 @@ class StatValue {
     typedef StatValue_Value<bsls::Types::Int64> Snapshot;
     typedef StatValue_SnapshotLocation          SnapshotLocation;
 
+    /// Histogram of a snapshot of an `e_HISTOGRAM` StatValue: the
+    /// cumulative number of values reported into each non-empty bucket,
+    /// as `(bucket, count)` pairs sorted by bucket.
+    typedef bsl::vector<bsl::pair<int, bsls::Types::Int64> > Histogram;
+
     enum Type {
         /// A continuous value logically represents a curve that is moved
         /// with `adjustValue` and `setValue`.  When adding two continuous
@@ -198,14 +218,37 @@ class StatValue {
         /// are added, their set of reported events is simply considered as
         /// a single stream of events.  For example, the max of two added
         /// discrete values will be the max of all the individual maxes.
-        e_DISCRETE = 1
+        e_DISCRETE = 1,
+
+        /// A histogram value is a discrete value which also records the
+        /// distribution of the reported events into log-linear buckets, so
+        /// that percentiles of the reported values can be computed.  When
+        /// two histogram values are added, their buckets are summed.
+        e_HISTOGRAM = 2
     };
 
+    // PUBLIC CONSTANTS
+
+    /// Each power of two is split into `2^k_HISTOGRAM_SUB_BUCKET_BITS`
+    /// linear sub-buckets.
+    static const int k_HISTOGRAM_SUB_BUCKET_BITS = 3;
+
+    /// Values greater than or equal to `2^k_HISTOGRAM_MAX_BITS` are all
+    /// recorded in the last bucket.
+    static const int k_HISTOGRAM_MAX_BITS = 48;
+
+    /// Number of buckets of an `e_HISTOGRAM` StatValue.
+    static const int k_NUM_HISTOGRAM_BUCKETS =
+        (k_HISTOGRAM_MAX_BITS - k_HISTOGRAM_SUB_BUCKET_BITS + 1)
+        << k_HISTOGRAM_SUB_BUCKET_BITS;
+
   private:
     // PRIVATE TYPES
     typedef StatValue_Value<bsls::AtomicInt64, bsls::Types::Int64>
         AtomicValueStats;
 
+    typedef bsls::AtomicOperations::AtomicTypes::Int64 AtomicBucket;
+
     // DATA
     Type d_type;
 
@@ -229,6 +272,17 @@ class StatValue {
 
     bsls::Types::Int64 d_max;  // max value since creation
 
+    bsl::vector<AtomicBucket> d_currentBuckets;
+    // Cumulative number of values
+    // reported into each bucket, only
+    // populated for histogram values
+
+    bsl::vector<Histogram> d_histogramHistory;
+    // Histogram of each snapshot in
+    // 'd_history', using the same
+    // indexing, only populated for
+    // histogram values
+
     // PRIVATE MANIPULATORS
     void updateMinMax(bsls::Types::Int64 value);
 
@@ -240,6 +294,24 @@ class StatValue {
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(StatValue, bslma::UsesBslmaAllocator)
 
+    // CLASS METHODS
+
+    /// Return the index of the histogram bucket into which the specified
+    /// `value` is recorded.  Negative values are recorded into the first
+    /// bucket.
+    static int histogramBucket(bsls::Types::Int64 value);
+
+    /// Return the smallest value recorded into the specified histogram
+    /// `bucket`.  The behavior is undefined unless
+    /// `0 <= bucket < k_NUM_HISTOGRAM_BUCKETS`.
+    static bsls::Types::Int64 histogramBucketLowerBound(int bucket);
+
+    /// Return the smallest value greater than all the values recorded into
+    /// the specified histogram `bucket`, ignoring the clamping of large
+    /// values into the last bucket.  The behavior is undefined unless
+    /// `0 <= bucket < k_NUM_HISTOGRAM_BUCKETS`.
+    static bsls::Types::Int64 histogramBucketUpperBound(int bucket);
+
     // CREATORS
     StatValue(bslma::Allocator* basicAllocator = 0);
     StatValue(const bsl::vector<int>& sizes,
@@ -260,7 +332,7 @@ class StatValue {
     void setValue(bsls::Types::Int64 value);
 
     /// Report the specified `value` to this StatValue.  The behavior is
-    /// undefined unless this is a discrete StatValue.
+    /// undefined unless this is a discrete or histogram StatValue.
     void reportValue(bsls::Types::Int64 value);
 
     /// Add the snapshot of the specified `other` StatValue to the current
@@ -268,8 +340,9 @@ class StatValue {
     void addSnapshot(const StatValue& other);
 
     /// Set the values of this `StatValue` from the field values within the
-    /// specified `update`.  Note that any value changes made since the last
-    /// snapshot may be lost.
+    /// specified `update`, including the buckets of a histogram value.
+    /// Note that any value changes made since the last snapshot may be
+    /// lost.
     void setFromUpdate(const bmqstm::StatValueUpdate& update);
 
     void takeSnapshot(bsls::Types::Int64 snapshotTime);
@@ -317,6 +390,12 @@ class StatValue {
     /// `location.index() < historySize(location.level())`
     const Snapshot& snapshot(const SnapshotLocation& location) const;
 
+    /// Return the histogram of the snapshot referred to by the specified
+    /// `location`.  The behavior is undefined unless
+    /// `type() == e_HISTOGRAM`, `location.level() < numLevels()` and
+    /// `location.index() < historySize(location.level())`.
+    const Histogram& histogram(const SnapshotLocation& location) const;
+
     /// Return the minimum value of this StatValue since creation.
     bsls::Types::Int64 min() const;
 
@@ -585,6 +664,57 @@ StatValue_SnapshotLocation::print(bsl::ostream& stream,
 // class StatValue
 // ---------------
 
+// CLASS METHODS
+inline int StatValue::histogramBucket(bsls::Types::Int64 value)
+{
+    const int k_NUM_SUB_BUCKETS = 1 << k_HISTOGRAM_SUB_BUCKET_BITS;
+    if (value < k_NUM_SUB_BUCKETS) {
+        return value < 0 ? 0 : static_cast<int>(value);  // RETURN
+    }
+
+    if (value >> k_HISTOGRAM_MAX_BITS) {
+        return k_NUM_HISTOGRAM_BUCKETS - 1;  // RETURN
+    }
+
+    // Index of the most significant bit set, i.e. 'value' is in the range
+    // '[2^msb, 2^(msb + 1))', which is split into 'k_NUM_SUB_BUCKETS'.
+    const int msb = 63 - bdlb::BitUtil::numLeadingUnsetBits(
+                             static_cast<bsl::uint64_t>(value));
+    const int shift = msb - k_HISTOGRAM_SUB_BUCKET_BITS;
+
+    return ((shift + 1) << k_HISTOGRAM_SUB_BUCKET_BITS) +
+           static_cast<int>((value >> shift) - k_NUM_SUB_BUCKETS);
+}
+
+inline bsls::Types::Int64 StatValue::histogramBucketLowerBound(int bucket)
+{
+    BSLS_ASSERT(0 <= bucket && bucket < k_NUM_HISTOGRAM_BUCKETS);
+
+    const int k_NUM_SUB_BUCKETS = 1 << k_HISTOGRAM_SUB_BUCKET_BITS;
+    if (bucket < k_NUM_SUB_BUCKETS) {
+        return bucket;  // RETURN
+    }
+
+    const int shift     = (bucket >> k_HISTOGRAM_SUB_BUCKET_BITS) - 1;
+    const int subBucket = bucket & (k_NUM_SUB_BUCKETS - 1);
+    return static_cast<bsls::Types::Int64>(k_NUM_SUB_BUCKETS + subBucket)
+           << shift;
+}
+
+inline bsls::Types::Int64 StatValue::histogramBucketUpperBound(int bucket)
+{
+    BSLS_ASSERT(0 <= bucket && bucket < k_NUM_HISTOGRAM_BUCKETS);
+
+    const int k_NUM_SUB_BUCKETS = 1 << k_HISTOGRAM_SUB_BUCKET_BITS;
+    if (bucket < k_NUM_SUB_BUCKETS) {
+        return bucket + 1;  // RETURN
+    }
+
+    const int shift = (bucket >> k_HISTOGRAM_SUB_BUCKET_BITS) - 1;
+    return histogramBucketLowerBound(bucket) +
+           (static_cast<bsls::Types::Int64>(1) << shift);
+}
+
 // PRIVATE MANIPULATORS
 inline void StatValue::updateMinMax(bsls::Types::Int64 value)
 {
@@ -635,17 +765,26 @@ inline void StatValue::setValue(bsls::Types::Int64 value)
 
 inline void StatValue::reportValue(bsls::Types::Int64 value)
 {
-    BSLS_ASSERT(d_type == e_DISCRETE);
+    BSLS_ASSERT(d_type != e_CONTINUOUS);
 
     d_currentStats.d_decrementsOrSum += value;
     d_currentStats.d_incrementsOrEvents++;
 
     updateMinMax(value);
+
+    if (d_type == e_HISTOGRAM) {
+        bsls::AtomicOperations::addInt64(
+            &d_currentBuckets[histogramBucket(value)],
+            1);
+    }
 }
 
 inline void StatValue::clearCurrentStats()
 {
-    d_currentStats.reset(d_type == e_DISCRETE, 0);
+    d_currentStats.reset(d_type != e_CONTINUOUS, 0);
+    for (size_t i = 0; i < d_currentBuckets.size(); ++i) {
+        bsls::AtomicOperations::setInt64(&d_currentBuckets[i], 0);
+    }
 }
 
 // ACCESSORS
@@ -684,6 +823,24 @@ StatValue::snapshot(const SnapshotLocation& location) const
     return d_history[historyIndex + d_levelStartIndices[location.level()]];
 }
 
+inline const StatValue::Histogram&
+StatValue::histogram(const SnapshotLocation& location) const
+{
+    BSLS_ASSERT(d_type == e_HISTOGRAM);
+    BSLS_ASSERT(location.level() < numLevels());
+    BSLS_ASSERT(location.index() < historySize(location.level()));
+
+    int snapshotIndex = d_curSnapshotIndices[location.level()];
+
+    int historyIndex = snapshotIndex - location.index();
+    if (historyIndex < 0) {
+        historyIndex += historySize(location.level());
+    }
+
+    return d_histogramHistory[historyIndex +
+                              d_levelStartIndices[location.level()]];
+}
+
 inline bsls::Types::Int64 StatValue::min() const
 {
     return d_min;
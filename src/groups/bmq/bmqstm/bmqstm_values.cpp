@@ -608,7 +608,11 @@ const bdlat_EnumeratorInfo StatValueType::ENUMERATOR_INFO_ARRAY[] = {
      "E_CONTINUOUS",
      sizeof("E_CONTINUOUS") - 1,
      ""},
-    {StatValueType::E_DISCRETE, "E_DISCRETE", sizeof("E_DISCRETE") - 1, ""}};
+    {StatValueType::E_DISCRETE, "E_DISCRETE", sizeof("E_DISCRETE") - 1, ""},
+    {StatValueType::E_HISTOGRAM,
+     "E_HISTOGRAM",
+     sizeof("E_HISTOGRAM") - 1,
+     ""}};
 
 // CLASS METHODS
 
@@ -617,6 +621,7 @@ int StatValueType::fromInt(StatValueType::Value* result, int number)
     switch (number) {
     case StatValueType::E_CONTINUOUS:
     case StatValueType::E_DISCRETE:
+    case StatValueType::E_HISTOGRAM:
         *result = static_cast<StatValueType::Value>(number);
         return 0;
     default: return -1;
@@ -627,7 +632,7 @@ int StatValueType::fromString(StatValueType::Value* result,
                               const char*           string,
                               int                   stringLength)
 {
-    for (int i = 0; i < 2; ++i) {
+    for (int i = 0; i < 3; ++i) {
         const bdlat_EnumeratorInfo& enumeratorInfo =
             StatValueType::ENUMERATOR_INFO_ARRAY[i];
 
@@ -651,6 +656,9 @@ const char* StatValueType::toString(StatValueType::Value value)
     case E_DISCRETE: {
         return "E_DISCRETE";
     }
+    case E_HISTOGRAM: {
+        return "E_HISTOGRAM";
+    }
     default: {
         BSLS_ASSERT(false && "invalid enumerator");
         BSLS_ASSERT_INVOKE_NORETURN("");
@@ -676,6 +684,11 @@ const bdlat_AttributeInfo StatValueUpdate::ATTRIBUTE_INFO_ARRAY[] = {
      "fields",
      sizeof("fields") - 1,
      "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_BUCKETS,
+     "buckets",
+     sizeof("buckets") - 1,
+     "",
      bdlat_FormattingMode::e_DEC}};
 
 // CLASS METHODS
@@ -683,7 +696,7 @@ const bdlat_AttributeInfo StatValueUpdate::ATTRIBUTE_INFO_ARRAY[] = {
 const bdlat_AttributeInfo*
 StatValueUpdate::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 2; ++i) {
+    for (int i = 0; i < 3; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             StatValueUpdate::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -703,6 +716,8 @@ const bdlat_AttributeInfo* StatValueUpdate::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIELD_MASK];
     case ATTRIBUTE_ID_FIELDS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIELDS];
+    case ATTRIBUTE_ID_BUCKETS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_BUCKETS];
     default: return 0;
     }
 }
@@ -711,6 +726,7 @@ const bdlat_AttributeInfo* StatValueUpdate::lookupAttributeInfo(int id)
 
 StatValueUpdate::StatValueUpdate(bslma::Allocator* basicAllocator)
 : d_fields(basicAllocator)
+, d_buckets(basicAllocator)
 , d_fieldMask()
 {
 }
@@ -718,6 +734,7 @@ StatValueUpdate::StatValueUpdate(bslma::Allocator* basicAllocator)
 StatValueUpdate::StatValueUpdate(const StatValueUpdate& original,
                                  bslma::Allocator*      basicAllocator)
 : d_fields(original.d_fields, basicAllocator)
+, d_buckets(original.d_buckets, basicAllocator)
 , d_fieldMask(original.d_fieldMask)
 {
 }
@@ -726,6 +743,7 @@ StatValueUpdate::StatValueUpdate(const StatValueUpdate& original,
     defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
 StatValueUpdate::StatValueUpdate(StatValueUpdate&& original) noexcept
 : d_fields(bsl::move(original.d_fields)),
+  d_buckets(bsl::move(original.d_buckets)),
   d_fieldMask(bsl::move(original.d_fieldMask))
 {
 }
@@ -733,6 +751,7 @@ StatValueUpdate::StatValueUpdate(StatValueUpdate&& original) noexcept
 StatValueUpdate::StatValueUpdate(StatValueUpdate&& original,
                                  bslma::Allocator* basicAllocator)
 : d_fields(bsl::move(original.d_fields), basicAllocator)
+, d_buckets(bsl::move(original.d_buckets), basicAllocator)
 , d_fieldMask(bsl::move(original.d_fieldMask))
 {
 }
@@ -749,6 +768,7 @@ StatValueUpdate& StatValueUpdate::operator=(const StatValueUpdate& rhs)
     if (this != &rhs) {
         d_fieldMask = rhs.d_fieldMask;
         d_fields    = rhs.d_fields;
+        d_buckets   = rhs.d_buckets;
     }
 
     return *this;
@@ -761,6 +781,7 @@ StatValueUpdate& StatValueUpdate::operator=(StatValueUpdate&& rhs)
     if (this != &rhs) {
         d_fieldMask = bsl::move(rhs.d_fieldMask);
         d_fields    = bsl::move(rhs.d_fields);
+        d_buckets   = bsl::move(rhs.d_buckets);
     }
 
     return *this;
@@ -771,6 +792,7 @@ void StatValueUpdate::reset()
 {
     bdlat_ValueTypeFunctions::reset(&d_fieldMask);
     bdlat_ValueTypeFunctions::reset(&d_fields);
+    bdlat_ValueTypeFunctions::reset(&d_buckets);
 }
 
 // ACCESSORS
@@ -783,6 +805,7 @@ bsl::ostream& StatValueUpdate::print(bsl::ostream& stream,
     printer.start();
     printer.printAttribute("fieldMask", this->fieldMask());
     printer.printAttribute("fields", this->fields());
+    printer.printAttribute("buckets", this->buckets());
     printer.end();
     return stream;
 }
@@ -539,13 +539,13 @@ namespace bmqstm {
 
 struct StatValueType {
     // This type enumerates the different types of stat values, specifically
-    // 'CONTINUOUS' and 'DISCRETE' values.
+    // 'CONTINUOUS', 'DISCRETE' and 'HISTOGRAM' values.
 
   public:
     // TYPES
-    enum Value { E_CONTINUOUS = 0, E_DISCRETE = 1 };
+    enum Value { E_CONTINUOUS = 0, E_DISCRETE = 1, E_HISTOGRAM = 2 };
 
-    enum { NUM_ENUMERATORS = 2 };
+    enum { NUM_ENUMERATORS = 3 };
 
     // CONSTANTS
     static const char CLASS_NAME[];
@@ -608,18 +608,31 @@ class StatValueUpdate {
     // question is a continuous value, and 'fieldMask' is 0b001100, then
     // 'fields' should contain two elements, with 'fields[0]' being the update
     // to the 'min' value, and 'fields[1]' being the update to the 'max' value.
+    //  For a histogram value, 'buckets' holds the cumulative number of values
+    // reported into each non-empty bucket, as pairs of elements made of the
+    // index of the bucket followed by its count, and is only meaningful if
+    // 'fieldMask' includes the 'events' field.
 
     // INSTANCE DATA
     bsl::vector<bsls::Types::Int64> d_fields;
+    bsl::vector<bsls::Types::Int64> d_buckets;
     unsigned int                    d_fieldMask;
 
   public:
     // TYPES
-    enum { ATTRIBUTE_ID_FIELD_MASK = 0, ATTRIBUTE_ID_FIELDS = 1 };
+    enum {
+        ATTRIBUTE_ID_FIELD_MASK = 0,
+        ATTRIBUTE_ID_FIELDS     = 1,
+        ATTRIBUTE_ID_BUCKETS    = 2
+    };
 
-    enum { NUM_ATTRIBUTES = 2 };
+    enum { NUM_ATTRIBUTES = 3 };
 
-    enum { ATTRIBUTE_INDEX_FIELD_MASK = 0, ATTRIBUTE_INDEX_FIELDS = 1 };
+    enum {
+        ATTRIBUTE_INDEX_FIELD_MASK = 0,
+        ATTRIBUTE_INDEX_FIELDS     = 1,
+        ATTRIBUTE_INDEX_BUCKETS    = 2
+    };
 
     // CONSTANTS
     static const char CLASS_NAME[];
@@ -725,6 +738,10 @@ class StatValueUpdate {
     // Return a reference to the modifiable "Fields" attribute of this
     // object.
 
+    bsl::vector<bsls::Types::Int64>& buckets();
+    // Return a reference to the modifiable "Buckets" attribute of this
+    // object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -775,6 +792,10 @@ class StatValueUpdate {
     // Return a reference offering non-modifiable access to the "Fields"
     // attribute of this object.
 
+    const bsl::vector<bsls::Types::Int64>& buckets() const;
+    // Return a reference offering non-modifiable access to the "Buckets"
+    // attribute of this object.
+
     // HIDDEN FRIENDS
     friend bool operator==(const StatValueUpdate& lhs,
                            const StatValueUpdate& rhs)
@@ -783,7 +804,7 @@ class StatValueUpdate {
     // have the same value if each respective attribute has the same value.
     {
         return lhs.fieldMask() == rhs.fieldMask() &&
-               lhs.fields() == rhs.fields();
+               lhs.fields() == rhs.fields() && lhs.buckets() == rhs.buckets();
     }
 
     friend bool operator!=(const StatValueUpdate& lhs,
@@ -812,6 +833,7 @@ class StatValueUpdate {
         using bslh::hashAppend;
         hashAppend(hashAlg, object.fieldMask());
         hashAppend(hashAlg, object.fields());
+        hashAppend(hashAlg, object.buckets());
     }
 };
 
@@ -2046,6 +2068,12 @@ int StatValueUpdate::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_buckets,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_BUCKETS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -2063,6 +2091,10 @@ int StatValueUpdate::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_fields,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIELDS]);
     }
+    case ATTRIBUTE_ID_BUCKETS: {
+        return manipulator(&d_buckets,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_BUCKETS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -2093,6 +2125,11 @@ inline bsl::vector<bsls::Types::Int64>& StatValueUpdate::fields()
     return d_fields;
 }
 
+inline bsl::vector<bsls::Types::Int64>& StatValueUpdate::buckets()
+{
+    return d_buckets;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int StatValueUpdate::accessAttributes(t_ACCESSOR& accessor) const
@@ -2110,6 +2147,11 @@ int StatValueUpdate::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_buckets, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_BUCKETS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -2127,6 +2169,10 @@ int StatValueUpdate::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_fields,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIELDS]);
     }
+    case ATTRIBUTE_ID_BUCKETS: {
+        return accessor(d_buckets,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_BUCKETS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -2157,6 +2203,11 @@ inline const bsl::vector<bsls::Types::Int64>& StatValueUpdate::fields() const
     return d_fields;
 }
 
+inline const bsl::vector<bsls::Types::Int64>& StatValueUpdate::buckets() const
+{
+    return d_buckets;
+}
+
 // -------------------------
 // class StatValueDefinition
 // -------------------------
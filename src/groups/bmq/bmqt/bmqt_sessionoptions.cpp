@@ -34,6 +34,7 @@ SessionOptions::SessionOptions(bslma::Allocator* allocator)
 : d_brokerUri(k_BROKER_DEFAULT_URI, allocator)
 , d_processNameOverride(allocator)
 , d_numProcessingThreads(1)
+, d_perQueueOrderedProcessing(false)
 , d_blobBufferSize(4 * 1024)
 , d_channelHighWatermark(128 * 1024 * 1024)
 , d_statsDumpInterval(5 * 60.0)
@@ -44,6 +45,7 @@ SessionOptions::SessionOptions(bslma::Allocator* allocator)
 , d_closeQueueTimeout(k_QUEUE_OPERATION_DEFAULT_TIMEOUT)
 , d_eventQueueLowWatermark(50)
 , d_eventQueueHighWatermark(2 * 1000)
+, d_eventQueueSpinTime(0)
 , d_eventQueueSize(-1)  // DEPRECATED: will be removed in future release
 , d_authnCredentialCb(bsl::allocator_arg, allocator)
 , d_hostHealthMonitor_sp()
@@ -60,6 +62,7 @@ SessionOptions::SessionOptions(const SessionOptions& other,
 : d_brokerUri(other.brokerUri(), allocator)
 , d_processNameOverride(other.processNameOverride(), allocator)
 , d_numProcessingThreads(other.numProcessingThreads())
+, d_perQueueOrderedProcessing(other.perQueueOrderedProcessing())
 , d_blobBufferSize(other.blobBufferSize())
 , d_channelHighWatermark(other.channelHighWatermark())
 , d_statsDumpInterval(other.statsDumpInterval())
@@ -70,6 +73,7 @@ SessionOptions::SessionOptions(const SessionOptions& other,
 , d_closeQueueTimeout(other.closeQueueTimeout())
 , d_eventQueueLowWatermark(other.eventQueueLowWatermark())
 , d_eventQueueHighWatermark(other.eventQueueHighWatermark())
+, d_eventQueueSpinTime(other.eventQueueSpinTime())
 , d_eventQueueSize(-1)  // DEPRECATED: will be removed in future release
 , d_authnCredentialCb(bsl::allocator_arg, allocator, other.authnCredentialCb())
 , d_hostHealthMonitor_sp(other.hostHealthMonitor())
@@ -84,25 +88,27 @@ SessionOptions::SessionOptions(const SessionOptions& other,
 SessionOptions& SessionOptions::operator=(const SessionOptions& other)
 {
     if (this != &other) {
-        d_brokerUri               = other.d_brokerUri;
-        d_processNameOverride     = other.d_processNameOverride;
-        d_numProcessingThreads    = other.d_numProcessingThreads;
-        d_blobBufferSize          = other.d_blobBufferSize;
-        d_channelHighWatermark    = other.d_channelHighWatermark;
-        d_statsDumpInterval       = other.d_statsDumpInterval;
-        d_connectTimeout          = other.d_connectTimeout;
-        d_disconnectTimeout       = other.d_disconnectTimeout;
-        d_openQueueTimeout        = other.d_openQueueTimeout;
-        d_configureQueueTimeout   = other.d_configureQueueTimeout;
-        d_closeQueueTimeout       = other.d_closeQueueTimeout;
-        d_eventQueueLowWatermark  = other.d_eventQueueLowWatermark;
-        d_eventQueueHighWatermark = other.d_eventQueueHighWatermark;
-        d_authnCredentialCb       = other.d_authnCredentialCb;
-        d_hostHealthMonitor_sp    = other.d_hostHealthMonitor_sp;
-        d_dtContext_sp            = other.d_dtContext_sp;
-        d_dtTracer_sp             = other.d_dtTracer_sp;
-        d_userAgentPrefix         = other.d_userAgentPrefix;
-        d_channelWriteTimeout     = other.d_channelWriteTimeout;
+        d_brokerUri                 = other.d_brokerUri;
+        d_processNameOverride       = other.d_processNameOverride;
+        d_numProcessingThreads      = other.d_numProcessingThreads;
+        d_perQueueOrderedProcessing = other.d_perQueueOrderedProcessing;
+        d_blobBufferSize            = other.d_blobBufferSize;
+        d_channelHighWatermark      = other.d_channelHighWatermark;
+        d_statsDumpInterval         = other.d_statsDumpInterval;
+        d_connectTimeout            = other.d_connectTimeout;
+        d_disconnectTimeout         = other.d_disconnectTimeout;
+        d_openQueueTimeout          = other.d_openQueueTimeout;
+        d_configureQueueTimeout     = other.d_configureQueueTimeout;
+        d_closeQueueTimeout         = other.d_closeQueueTimeout;
+        d_eventQueueLowWatermark    = other.d_eventQueueLowWatermark;
+        d_eventQueueHighWatermark   = other.d_eventQueueHighWatermark;
+        d_eventQueueSpinTime        = other.d_eventQueueSpinTime;
+        d_authnCredentialCb         = other.d_authnCredentialCb;
+        d_hostHealthMonitor_sp      = other.d_hostHealthMonitor_sp;
+        d_dtContext_sp              = other.d_dtContext_sp;
+        d_dtTracer_sp               = other.d_dtTracer_sp;
+        d_userAgentPrefix           = other.d_userAgentPrefix;
+        d_channelWriteTimeout       = other.d_channelWriteTimeout;
 
         // DEPRECATED: preserve current behavior from constructors.
         d_eventQueueSize = -1;
@@ -131,6 +137,8 @@ bsl::ostream& SessionOptions::print(bsl::ostream& stream,
     printer.printAttribute("brokerUri", d_brokerUri);
     printer.printAttribute("processNameOverride", d_processNameOverride);
     printer.printAttribute("numProcessingThreads", d_numProcessingThreads);
+    printer.printAttribute("perQueueOrderedProcessing",
+                           d_perQueueOrderedProcessing);
     printer.printAttribute("blobBufferSize", d_blobBufferSize);
     printer.printAttribute("channelHighWatermark", d_channelHighWatermark);
     printer.printAttribute("statsDumpInterval",
@@ -148,6 +156,8 @@ bsl::ostream& SessionOptions::print(bsl::ostream& stream,
     printer.printAttribute("eventQueueLowWatermark", d_eventQueueLowWatermark);
     printer.printAttribute("eventQueueHighWatermark",
                            d_eventQueueHighWatermark);
+    printer.printAttribute("eventQueueSpinTime",
+                           d_eventQueueSpinTime.totalSecondsAsDouble());
     printer.printAttribute("hasAuthnCredentialCb",
                            d_authnCredentialCb != NULL);
     printer.printAttribute("hasHostHealthMonitor",
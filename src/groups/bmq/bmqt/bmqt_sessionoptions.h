@@ -60,6 +60,23 @@
 ///     this setting has an effect only if providing a
 ///     @bbref{bmqa::SessionEventHandler} to the session.
 ///
+///   - *perQueueOrderedProcessing*:
+///     Whether to preserve the order of the events of a queue when using
+///     more than one processing thread.  If `true`, each queue is assigned to
+///     one of the processing threads, which delivers all the messages of
+///     that queue in the order they were received, so that the processing
+///     of the queues scales across threads without reordering their
+///     messages.  The messages received together for queues of several
+///     threads are delivered as separate events by each of these threads.
+///     Other events which are not related to a single thread's queues
+///     (e.g., session events, or acknowledgements of several queues) are
+///     delivered once all the events received before them have been
+///     processed.  Default is `false`, in which case
+///     events are delivered to whichever processing thread is available.
+///     Note that this setting has an effect only if providing a
+///     @bbref{bmqa::SessionEventHandler} to the session and
+///     `numProcessingThreads` is greater than 1.
+///
 ///   - *blobBufferSize*:
 ///      Size (in bytes) of the blob buffers to use. Default value is 4k.
 ///
@@ -105,6 +122,18 @@
 ///     to avoid a constant back and forth toggling of state resulting from
 ///     push pop of events.
 ///
+///   - *eventQueueSpinTime*:
+///     Time for which a thread waiting for events from the EventQueue (the
+///     application thread calling @bbref{bmqa::Session::nextEvent}, or the
+///     processing threads if providing a @bbref{bmqa::SessionEventHandler})
+///     busy polls the EventQueue, before blocking until an event is pushed to
+///     it.  Busy polling avoids the cost of putting the thread to sleep and
+///     waking it up when an event arrives, reducing the latency of the events
+///     delivered within that time, at the expense of keeping a CPU busy
+///     while waiting.  This is typically only suitable for latency sensitive
+///     applications having a dedicated core for each such thread.  Default
+///     is 0, i.e. the threads block as soon as the EventQueue is empty.
+///
 ///   - *hostHealthMonitor*:
 ///     Optional instance of a class derived from
 ///     @bbref{bmqpi::HostHealthMonitor}, responsible for notifying the
@@ -211,6 +240,10 @@ class SessionOptions {
     /// Number of processing threads. Default is 1 thread.
     int d_numProcessingThreads;
 
+    /// Whether the events of a queue are processed in order when using
+    /// several processing threads.  Default is `false`.
+    bool d_perQueueOrderedProcessing;
+
     /// Size of the blobs buffer.
     int d_blobBufferSize;
 
@@ -236,6 +269,10 @@ class SessionOptions {
     /// Parameters to configure the EventQueue.
     int d_eventQueueHighWatermark;
 
+    /// Time for which threads waiting for events busy poll the EventQueue
+    /// before blocking.
+    bsls::TimeInterval d_eventQueueSpinTime;
+
     /// DEPRECATED: This parameter is no longer relevant and will be removed in
     /// future release of libbmq.
     int d_eventQueueSize;
@@ -293,6 +330,10 @@ class SessionOptions {
     /// Set the number of processing threads to the specified `value`.
     SessionOptions& setNumProcessingThreads(int value);
 
+    /// Set whether the events of a queue are processed in order when using
+    /// several processing threads to the specified `value`.
+    SessionOptions& setPerQueueOrderedProcessing(bool value);
+
     /// Set the specified `value` for the size of blobs buffers.
     SessionOptions& setBlobBufferSize(int value);
 
@@ -352,6 +393,12 @@ class SessionOptions {
     /// The behavior is undefined unless `lowWatermark < highWatermark`.
     SessionOptions& configureEventQueue(int lowWatermark, int highWatermark);
 
+    /// Set the time for which threads waiting for events busy poll the
+    /// EventQueue before blocking to the specified `value`.  Refer to the
+    /// component level documentation for details.  The behavior is undefined
+    /// unless `value` is not negative.
+    SessionOptions& setEventQueueSpinTime(const bsls::TimeInterval& value);
+
     /// Sets the user agent prefix to the specified `value`.  This string is
     /// prefixed to a user agent constructed by `libbmq`.  This is intended
     /// ONLY for libraries that wrap `libbmq` to identify themselves for broker
@@ -377,6 +424,10 @@ class SessionOptions {
     /// Get the number of processing threads.
     int numProcessingThreads() const;
 
+    /// Get whether the events of a queue are processed in order when using
+    /// several processing threads.
+    bool perQueueOrderedProcessing() const;
+
     /// Get the size of the blobs buffer.
     int blobBufferSize() const;
 
@@ -415,6 +466,10 @@ class SessionOptions {
     int eventQueueLowWatermark() const;
     int eventQueueHighWatermark() const;
 
+    /// Get the time for which threads waiting for events busy poll the
+    /// EventQueue before blocking.
+    const bsls::TimeInterval& eventQueueSpinTime() const;
+
     BSLS_DEPRECATE_FEATURE("bmqt",
                            "eventQueueSize",
                            "This API is no longer supported and will be "
@@ -485,6 +540,12 @@ inline SessionOptions& SessionOptions::setNumProcessingThreads(int value)
     return *this;
 }
 
+inline SessionOptions& SessionOptions::setPerQueueOrderedProcessing(bool value)
+{
+    d_perQueueOrderedProcessing = value;
+    return *this;
+}
+
 inline SessionOptions& SessionOptions::setBlobBufferSize(int value)
 {
     d_blobBufferSize = value;
@@ -599,6 +660,16 @@ inline SessionOptions& SessionOptions::configureEventQueue(int lowWatermark,
     return *this;
 }
 
+inline SessionOptions&
+SessionOptions::setEventQueueSpinTime(const bsls::TimeInterval& value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(value >= bsls::TimeInterval());
+
+    d_eventQueueSpinTime = value;
+    return *this;
+}
+
 inline SessionOptions&
 SessionOptions::setUserAgentPrefix(bsl::string_view value)
 {
@@ -634,6 +705,11 @@ inline int SessionOptions::numProcessingThreads() const
     return d_numProcessingThreads;
 }
 
+inline bool SessionOptions::perQueueOrderedProcessing() const
+{
+    return d_perQueueOrderedProcessing;
+}
+
 inline int SessionOptions::blobBufferSize() const
 {
     return d_blobBufferSize;
@@ -707,6 +783,11 @@ inline int SessionOptions::eventQueueHighWatermark() const
     return d_eventQueueHighWatermark;
 }
 
+inline const bsls::TimeInterval& SessionOptions::eventQueueSpinTime() const
+{
+    return d_eventQueueSpinTime;
+}
+
 inline int SessionOptions::eventQueueSize() const
 {
     return d_eventQueueSize;
@@ -733,6 +814,8 @@ inline bool bmqt::operator==(const bmqt::SessionOptions& lhs,
 {
     return lhs.brokerUri() == rhs.brokerUri() &&
            lhs.numProcessingThreads() == rhs.numProcessingThreads() &&
+           lhs.perQueueOrderedProcessing() ==
+               rhs.perQueueOrderedProcessing() &&
            lhs.blobBufferSize() == rhs.blobBufferSize() &&
            lhs.channelHighWatermark() == rhs.channelHighWatermark() &&
            lhs.statsDumpInterval() == rhs.statsDumpInterval() &&
@@ -742,6 +825,7 @@ inline bool bmqt::operator==(const bmqt::SessionOptions& lhs,
            lhs.closeQueueTimeout() == rhs.closeQueueTimeout() &&
            lhs.eventQueueLowWatermark() == rhs.eventQueueLowWatermark() &&
            lhs.eventQueueHighWatermark() == rhs.eventQueueHighWatermark() &&
+           lhs.eventQueueSpinTime() == rhs.eventQueueSpinTime() &&
            lhs.hostHealthMonitor() == rhs.hostHealthMonitor() &&
            lhs.traceContext() == rhs.traceContext() &&
            lhs.tracer() == rhs.tracer() &&
@@ -753,6 +837,8 @@ inline bool bmqt::operator!=(const bmqt::SessionOptions& lhs,
 {
     return lhs.brokerUri() != rhs.brokerUri() ||
            lhs.numProcessingThreads() != rhs.numProcessingThreads() ||
+           lhs.perQueueOrderedProcessing() !=
+               rhs.perQueueOrderedProcessing() ||
            lhs.blobBufferSize() != rhs.blobBufferSize() ||
            lhs.channelHighWatermark() != rhs.channelHighWatermark() ||
            lhs.statsDumpInterval() != rhs.statsDumpInterval() ||
@@ -762,6 +848,7 @@ inline bool bmqt::operator!=(const bmqt::SessionOptions& lhs,
            lhs.closeQueueTimeout() != rhs.closeQueueTimeout() ||
            lhs.eventQueueLowWatermark() != rhs.eventQueueLowWatermark() ||
            lhs.eventQueueHighWatermark() != rhs.eventQueueHighWatermark() ||
+           lhs.eventQueueSpinTime() != rhs.eventQueueSpinTime() ||
            lhs.hostHealthMonitor() != rhs.hostHealthMonitor() ||
            lhs.traceContext() != rhs.traceContext() ||
            lhs.tracer() != rhs.tracer() ||
@@ -58,12 +58,13 @@ static void test2_printTest()
 {
     const char* const sampleSessionOptionsLayout =
         "[ brokerUri = \"tcp://localhost:30114\" processNameOverride = \"\" "
-        "numProcessingThreads = 1 "
+        "numProcessingThreads = 1 perQueueOrderedProcessing = false "
         "blobBufferSize = 4096 channelHighWatermark = 134217728 "
         "statsDumpInterval = 300 connectTimeout = 60 disconnectTimeout = 30 "
         "openQueueTimeout = 300 configureQueueTimeout = 300 "
         "closeQueueTimeout = 300 eventQueueLowWatermark = 50 "
-        "eventQueueHighWatermark = 2000 hasAuthnCredentialCb = false "
+        "eventQueueHighWatermark = 2000 eventQueueSpinTime = 0 "
+        "hasAuthnCredentialCb = false "
         "hasHostHealthMonitor = false hasDistributedTracing = false "
         "userAgentPrefix = \"\" ]";
     bmqtst::TestHelper::printTestName("PRINT");
@@ -100,6 +101,11 @@ static void test3_setterGetterAndCopyTest()
     obj.setNumProcessingThreads(numProcessingThreads);
     BMQTST_ASSERT_EQ(obj.numProcessingThreads(), numProcessingThreads);
 
+    PVV("Checking setter and getter for perQueueOrderedProcessing");
+    BMQTST_ASSERT(!obj.perQueueOrderedProcessing());
+    obj.setPerQueueOrderedProcessing(true);
+    BMQTST_ASSERT(obj.perQueueOrderedProcessing());
+
     PVV("Checking setter and getter for blobBufferSize");
     const int blobBufferSize = 8 * 1024;
     BMQTST_ASSERT_NE(obj.blobBufferSize(), blobBufferSize);
@@ -154,6 +160,12 @@ static void test3_setterGetterAndCopyTest()
     BMQTST_ASSERT_EQ(obj.eventQueueLowWatermark(), eventQueueLowWatermark);
     BMQTST_ASSERT_EQ(obj.eventQueueHighWatermark(), eventQueueHighWatermark);
 
+    PVV("Checking setter and getter for eventQueueSpinTime");
+    const bsls::TimeInterval eventQueueSpinTime(0, 50 * 1000);
+    BMQTST_ASSERT_NE(obj.eventQueueSpinTime(), eventQueueSpinTime);
+    obj.setEventQueueSpinTime(eventQueueSpinTime);
+    BMQTST_ASSERT_EQ(obj.eventQueueSpinTime(), eventQueueSpinTime);
+
     PVV("Checking setter and getter for userAgentPrefix");
     // 127 character long user agent with all printable characters.
     const char* const userAgentPrefix       = "0123456789"
@@ -174,6 +186,7 @@ static void test3_setterGetterAndCopyTest()
     bmqt::SessionOptions objCopy(obj, bmqtst::TestHelperUtil::allocator());
     BMQTST_ASSERT_EQ(objCopy.brokerUri(), brokerUri);
     BMQTST_ASSERT_EQ(objCopy.numProcessingThreads(), numProcessingThreads);
+    BMQTST_ASSERT(objCopy.perQueueOrderedProcessing());
     BMQTST_ASSERT_EQ(objCopy.blobBufferSize(), blobBufferSize);
     BMQTST_ASSERT_EQ(objCopy.channelHighWatermark(), channelHighWatermark);
     BMQTST_ASSERT_EQ(objCopy.statsDumpInterval(), statsDumpInterval);
@@ -184,6 +197,7 @@ static void test3_setterGetterAndCopyTest()
     BMQTST_ASSERT_EQ(objCopy.eventQueueLowWatermark(), eventQueueLowWatermark);
     BMQTST_ASSERT_EQ(objCopy.eventQueueHighWatermark(),
                      eventQueueHighWatermark);
+    BMQTST_ASSERT_EQ(objCopy.eventQueueSpinTime(), eventQueueSpinTime);
     BMQTST_ASSERT_EQ(objCopy.userAgentPrefix(), userAgentPrefix);
 }
 
@@ -207,6 +221,7 @@ static void test4_copyAssignmentTest()
         bmqt::SessionOptions::k_QUEUE_OPERATION_DEFAULT_TIMEOUT + 12);
     const int                eventQueueLowWatermark  = 71;
     const int                eventQueueHighWatermark = 3001;
+    const bsls::TimeInterval eventQueueSpinTime(0, 20 * 1000);
     const char* const        userAgentPrefix         = "wrapper-lib/1.2.3";
     const bsls::TimeInterval channelWriteTimeout(8);
 
@@ -214,6 +229,7 @@ static void test4_copyAssignmentTest()
     source.setBrokerUri(brokerUri)
         .setProcessNameOverride(processNameOverride)
         .setNumProcessingThreads(numProcessingThreads)
+        .setPerQueueOrderedProcessing(true)
         .setBlobBufferSize(blobBufferSize)
         .setChannelHighWatermark(channelHighWatermark)
         .setStatsDumpInterval(statsDumpInterval)
@@ -223,6 +239,7 @@ static void test4_copyAssignmentTest()
         .setConfigureQueueTimeout(configureQueueTimeout)
         .setCloseQueueTimeout(closeQueueTimeout)
         .configureEventQueue(eventQueueLowWatermark, eventQueueHighWatermark)
+        .setEventQueueSpinTime(eventQueueSpinTime)
         .setUserAgentPrefix(userAgentPrefix)
         .setChannelWriteTimeout(channelWriteTimeout);
 
@@ -233,6 +250,7 @@ static void test4_copyAssignmentTest()
     BMQTST_ASSERT_EQ(copyAssigned.processNameOverride(), processNameOverride);
     BMQTST_ASSERT_EQ(copyAssigned.numProcessingThreads(),
                      numProcessingThreads);
+    BMQTST_ASSERT(copyAssigned.perQueueOrderedProcessing());
     BMQTST_ASSERT_EQ(copyAssigned.blobBufferSize(), blobBufferSize);
     BMQTST_ASSERT_EQ(copyAssigned.channelHighWatermark(),
                      channelHighWatermark);
@@ -247,6 +265,7 @@ static void test4_copyAssignmentTest()
                      eventQueueLowWatermark);
     BMQTST_ASSERT_EQ(copyAssigned.eventQueueHighWatermark(),
                      eventQueueHighWatermark);
+    BMQTST_ASSERT_EQ(copyAssigned.eventQueueSpinTime(), eventQueueSpinTime);
     BMQTST_ASSERT_EQ(copyAssigned.userAgentPrefix(), userAgentPrefix);
     BMQTST_ASSERT_EQ(copyAssigned.channelWriteTimeout(), channelWriteTimeout);
 }
@@ -24,15 +24,19 @@
 
 // BMQ
 #include <bmqu_memoutstream.h>
+#include <bmqu_printutil.h>
 #include <bmqu_time.h>
 
 // MQB
 #include <mqbstat_dispatcherstats.h>
+#include <mqbu_threadutil.h>
 
 // BDE
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 #include <bdlmt_eventscheduler.h>
+#include <bdlt_timeunitratio.h>
+#include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
@@ -40,6 +44,8 @@
 #include <bsl_string.h>
 #include <bsla_annotations.h>
 #include <bslma_managedptr.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutexassert.h>
 #include <bslmt_semaphore.h>
 #include <bslmt_threadattributes.h>
 #include <bslmt_threadutil.h>
@@ -49,6 +55,49 @@
 namespace BloombergLP {
 namespace mqba {
 
+namespace {
+
+/// Minimum time (in nanoseconds) the busiest processor must have spent
+/// processing events since the previous rebalancing round for a migration
+/// to be considered.
+const bsls::Types::Int64 k_REBALANCE_MIN_LOAD_NS =
+    bdlt::TimeUnitRatio::k_NS_PER_MS;
+
+/// Minimum difference, in percent of the load of the busiest processor,
+/// between the load of the busiest and the least busy processors for a
+/// migration to be considered.
+const bsls::Types::Int64 k_REBALANCE_MIN_IMBALANCE_PERCENT = 25;
+
+// =========================
+// class PendingEnqueueGuard
+// =========================
+
+/// Guard notifying a potential concurrent migration of a dispatcher client
+/// that an event is being enqueued to the processor currently associated to
+/// the client.
+class PendingEnqueueGuard {
+  private:
+    // DATA
+    mqbi::DispatcherClientData* d_data_p;
+
+  private:
+    // NOT IMPLEMENTED
+    PendingEnqueueGuard(const PendingEnqueueGuard&);
+    PendingEnqueueGuard& operator=(const PendingEnqueueGuard&);
+
+  public:
+    // CREATORS
+    explicit PendingEnqueueGuard(mqbi::DispatcherClientData* data)
+    : d_data_p(data)
+    {
+        d_data_p->incrementPendingEnqueues();
+    }
+
+    ~PendingEnqueueGuard() { d_data_p->decrementPendingEnqueues(); }
+};
+
+}  // close unnamed namespace
+
 // -------------------------
 // class Dispatcher_Executor
 // -------------------------
@@ -137,11 +186,30 @@ void Dispatcher_Executor::dispatch(const bsl::function<void()>& f) const
     }
 }
 
+// ----------------------------
+// struct Dispatcher::Migration
+// ----------------------------
+
+Dispatcher::Migration::Migration(mqbi::DispatcherClient*          client,
+                                 mqbi::DispatcherClientType::Enum type,
+                                 int                              source,
+                                 int                              target)
+: d_client_p(client)
+, d_type(type)
+, d_source(source)
+, d_target(target)
+, d_startTime(bmqu::Time::highResolutionTimer())
+, d_isCancelled(false)
+{
+    // NOTHING
+}
+
 // ------------------------------------
 // struct Dispatcher::DispatcherContext
 // ------------------------------------
 
 Dispatcher::DispatcherContext::DispatcherContext(
+    mqbi::DispatcherClientType::Enum         type,
     const mqbcfg::DispatcherProcessorConfig& config,
     bslma::Allocator*                        allocator)
 : d_threadPool_mp()
@@ -150,16 +218,43 @@ Dispatcher::DispatcherContext::DispatcherContext(
 , d_flushList(config.numProcessors(),
               DispatcherClientPtrVector(allocator),
               allocator)
+, d_maxBatchSize(config.processorConfig().maxBatchSize())
+, d_batchSizes(config.numProcessors(), 0, allocator)
 , d_eventSources(config.numProcessors(), allocator)
 , d_clientStatContext_mp()
 , d_statContexts(config.numProcessors(), allocator)
+, d_processorLoads(allocator)
+, d_deferredEvents(config.numProcessors(),
+                   DispatcherEventSpVector(allocator),
+                   allocator)
+, d_replayedEvents(config.numProcessors(),
+                   DispatcherEventSpVector(allocator),
+                   allocator)
+, d_migratingClient(0)
+, d_migrationTarget(mqbi::Dispatcher::k_INVALID_PROCESSOR_HANDLE)
+, d_migration_sp()
+, d_migrationMutex()
+, d_rebalanceEventHandle()
 {
-    typedef bsl::vector<bsl::shared_ptr<mqbi::DispatcherEventSource> >
-        EventSources;
-    for (EventSources::iterator it = d_eventSources.begin();
-         it != d_eventSources.end();
-         ++it) {
-        *it = bsl::allocate_shared<mqba::DispatcherEventSource>(allocator);
+    for (size_t i = 0; i < d_eventSources.size(); ++i) {
+        // Name the event source of each processor so that the allocations
+        // of its pools can be told apart in the allocator statistics.
+        bsl::string name("EventSource-", allocator);
+        name += mqbi::DispatcherClientType::toAscii(type);
+        name += "-";
+        name += bsl::to_string(i);
+
+        d_eventSources[i] = bsl::allocate_shared<mqba::DispatcherEventSource>(
+            allocator,
+            name);
+    }
+
+    if (config.rebalanceIntervalMs() > 0) {
+        d_processorLoads.reserve(config.numProcessors());
+        for (int i = 0; i < config.numProcessors(); ++i) {
+            d_processorLoads.push_back(
+                bsl::allocate_shared<bsls::AtomicInt64>(allocator, 0));
+        }
     }
 }
 
@@ -167,6 +262,39 @@ Dispatcher::DispatcherContext::DispatcherContext(
 // class Dispatcher
 // ----------------
 
+void Dispatcher::dropEvent(mqbi::Dispatcher::DispatcherEventSp* event,
+                           mqbi::DispatcherClientType::Enum     type,
+                           mqbi::Dispatcher::ProcessorHandle    handle)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(event);
+
+    const bsls::Types::Int64 numDropped = ++d_numDroppedEvents;
+
+    BALL_LOG_WARN_BLOCK
+    {
+        BALL_LOG_OUTPUT_STREAM
+            << "#DISPATCHER_EVENT_DROPPED Dropping event for processor "
+            << handle << " of " << type
+            << " which no longer accepts events [event: ";
+        if (*event) {
+            BALL_LOG_OUTPUT_STREAM << **event;
+        }
+        else {
+            // The queue of the processor may have moved from the event.
+            BALL_LOG_OUTPUT_STREAM << "N/A";
+        }
+        BALL_LOG_OUTPUT_STREAM << ", numDroppedEvents: " << numDropped
+                               << "]";
+    }
+
+    // A processor only stops accepting events once the dispatcher is
+    // stopping.
+    BSLS_ASSERT_SAFE(!d_isStarted && "Event dropped while started");
+
+    event->reset();
+}
+
 int Dispatcher::startContext(bsl::ostream&                    errorDescription,
                              mqbi::DispatcherClientType::Enum type,
                              const mqbcfg::DispatcherProcessorConfig& config)
@@ -182,7 +310,9 @@ int Dispatcher::startContext(bsl::ostream&                    errorDescription,
 
     DispatcherContextSp& context = d_contexts[type];
 
-    context = bsl::allocate_shared<DispatcherContext>(d_allocator_p, config);
+    context = bsl::allocate_shared<DispatcherContext>(d_allocator_p,
+                                                      type,
+                                                      config);
 
     // Create client stat context
     context->d_clientStatContext_mp =
@@ -226,6 +356,17 @@ int Dispatcher::startContext(bsl::ostream&                    errorDescription,
                              bdlf::PlaceHolders::_2),  // allocator*
         d_allocator_p);
 
+    if (d_config.processorQueueType() ==
+        mqbcfg::DispatcherQueueType::E_RING_BUFFER) {
+        processorPoolConfig.setRingBufferQueueCreator(
+            bdlf::BindUtil::bind(&Dispatcher::ringBufferQueueCreator,
+                                 this,
+                                 type,
+                                 config.processorConfig(),
+                                 bdlf::PlaceHolders::_1,    // queueId
+                                 bdlf::PlaceHolders::_2));  // allocator*
+    }
+
     processorPoolConfig.setName(mqbi::DispatcherClientType::toAscii(type))
         .setEventScheduler(d_scheduler_p)
         .setMonitorAlarm(
@@ -249,22 +390,53 @@ int Dispatcher::startContext(bsl::ostream&                    errorDescription,
         return rc_PROCESSOR_POOL_START_FAILED;  // RETURN
     }
 
+    if (config.rebalanceIntervalMs() > 0 && config.numProcessors() > 1) {
+        d_scheduler_p->scheduleRecurringEvent(
+            &context->d_rebalanceEventHandle,
+            bsls::TimeInterval(config.rebalanceIntervalMs() / 1000.0),
+            bdlf::BindUtil::bind(&Dispatcher::rebalance, this, type));
+    }
+
     return rc_SUCCESS;
 }
 
-Dispatcher::ProcessorPool::Queue*
-Dispatcher::queueCreator(mqbi::DispatcherClientType::Enum             type,
-                         const mqbcfg::DispatcherProcessorParameters& config,
-                         int               processorId,
-                         bslma::Allocator* allocator)
+void Dispatcher::pinProcessors(mqbi::DispatcherClientType::Enum         type,
+                               const mqbcfg::DispatcherProcessorConfig& config)
+{
+    if (config.numCpus() <= 0) {
+        return;  // RETURN
+    }
+
+    for (int i = 0; i < config.numProcessors(); ++i) {
+        bsl::shared_ptr<mqbevt::DispatcherEvent> event_sp =
+            d_defaultEventSource_sp->getEvent<mqbevt::DispatcherEvent>();
+        (*event_sp).setCallback(
+            bdlf::BindUtil::bind(&Dispatcher::pinProcessor,
+                                 type,
+                                 i,
+                                 config.firstCpu() + i % config.numCpus()));
+        dispatchEvent(bslmf::MovableRefUtil::move(event_sp), type, i);
+    }
+
+    // Wait for all processors to be pinned, so that the clients registering
+    // once the dispatcher is started (and the memory they initialize) are
+    // only ever executed by pinned threads.
+    for (int i = 0; i < config.numProcessors(); ++i) {
+        synchronize(type, i);
+    }
+}
+
+template <class QUEUE>
+void Dispatcher::initializeProcessorQueue(
+    QUEUE*                                       queue,
+    mqbi::DispatcherClientType::Enum             type,
+    const mqbcfg::DispatcherProcessorParameters& config,
+    int                                          processorId)
 {
     bmqu::MemOutStream os;
     os << "ProcessorQueue " << processorId << " for '" << type << "'";
     bsl::string queueName(os.str().data(), os.str().length());
 
-    ProcessorPool::Queue* queue = new (*allocator)
-        ProcessorPool::Queue(config.queueSizeLowWatermark(), allocator);
-
     queue->setWatermarks(config.queueSizeLowWatermark(),
                          config.queueSizeHighWatermark());
     queue->setStateCallback(
@@ -286,6 +458,35 @@ Dispatcher::queueCreator(mqbi::DispatcherClientType::Enum             type,
             mqbi::DispatcherClientType::toAscii(type),
             processorId,
             d_allocator_p);
+}
+
+Dispatcher::ProcessorPool::Queue*
+Dispatcher::queueCreator(mqbi::DispatcherClientType::Enum             type,
+                         const mqbcfg::DispatcherProcessorParameters& config,
+                         int               processorId,
+                         bslma::Allocator* allocator)
+{
+    ProcessorPool::Queue* queue = new (*allocator)
+        ProcessorPool::Queue(config.queueSizeLowWatermark(), allocator);
+
+    initializeProcessorQueue(queue, type, config, processorId);
+
+    return queue;
+}
+
+Dispatcher::ProcessorPool::RingBufferQueue* Dispatcher::ringBufferQueueCreator(
+    mqbi::DispatcherClientType::Enum             type,
+    const mqbcfg::DispatcherProcessorParameters& config,
+    int                                          processorId,
+    bslma::Allocator*                            allocator)
+{
+    // The ring buffer is bounded and preallocated: size it with the
+    // configured capacity of the queue, rather than its low watermark.
+    ProcessorPool::RingBufferQueue* queue = new (*allocator)
+        ProcessorPool::RingBufferQueue(config.queueSize(), allocator);
+
+    initializeProcessorQueue(queue, type, config, processorId);
+
     return queue;
 }
 
@@ -300,10 +501,13 @@ Dispatcher::Dispatcher(const mqbcfg::DispatcherConfig& config,
 , d_contexts(allocator)
 , d_statContext_p(statContext)
 , d_defaultEventSource_sp(
-      bsl::allocate_shared<mqba::DispatcherEventSource>(allocator))
+      bsl::allocate_shared<mqba::DispatcherEventSource>(
+          allocator,
+          bsl::string("DefaultEventSource", allocator)))
 , d_customEventSources(allocator)
 , d_customEventSources_mtx()
 , d_flushClientsGate()
+, d_numDroppedEvents(0)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_scheduler_p);
@@ -367,6 +571,10 @@ int Dispatcher::start(bsl::ostream& errorDescription)
                                             "bmqDispCluster"),
                        mqbi::DispatcherClientType::e_CLUSTER);
 
+    pinProcessors(mqbi::DispatcherClientType::e_SESSION, d_config.sessions());
+    pinProcessors(mqbi::DispatcherClientType::e_QUEUE, d_config.queues());
+    pinProcessors(mqbi::DispatcherClientType::e_CLUSTER, d_config.clusters());
+
     d_isStarted = true;
 
     return 0;
@@ -393,6 +601,13 @@ void Dispatcher::stop()
 
     DispatcherContext* context = 0;
 
+    // Stop rebalancing before stopping any processor, so that no migration
+    // gets started while processors are being stopped.
+    for (size_t i = 0; i < d_contexts.size(); ++i) {
+        d_scheduler_p->cancelEventAndWait(
+            &d_contexts[i]->d_rebalanceEventHandle);
+    }
+
     // Shutdown the queue dispatcher before the session one
     // After the application stops and invalidates sessions, they are not
     // source of events for queues anymore.  The reverse is not true, a queue
@@ -473,7 +688,23 @@ void Dispatcher::unregisterClient(mqbi::DispatcherClient* client)
     case mqbi::DispatcherClientType::e_SESSION:
     case mqbi::DispatcherClientType::e_QUEUE:
     case mqbi::DispatcherClientType::e_CLUSTER: {
-        d_contexts[type]->d_loadBalancer.removeClient(client);
+        DispatcherContext& context = *(d_contexts[type]);
+
+        // Synchronize with 'rebalance', which expects the clients it samples
+        // to stay alive while it holds the mutex.
+        bslmt::LockGuard<bslmt::Mutex> guard(&context.d_migrationMutex);
+
+        if (context.d_migration_sp &&
+            context.d_migration_sp->d_client_p == client) {
+            // The client is being migrated; let the migration know it must no
+            // longer access it, and stop putting aside the events for it so
+            // that the events of a client later registered at the same
+            // address are not mistaken for its own.
+            context.d_migration_sp->d_isCancelled = true;
+            context.d_migratingClient = 0;
+        }
+
+        context.d_loadBalancer.removeClient(client);
     } break;
     case mqbi::DispatcherClientType::e_UNDEFINED:
     default: {
@@ -504,9 +735,45 @@ void Dispatcher::dispatchEvent(mqbi::Dispatcher::DispatcherEventRvRef event,
 
     bslmf::MovableRefUtil::access(event)->setDestination(destination);
 
+    mqbi::DispatcherClientData& data = destination->dispatcherClientData();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(data.isMigratable())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Let a concurrent migration know that an event is being enqueued to
+        // the processor currently associated to the client, so that it does
+        // not proceed before the event is enqueued.  The migration waits for
+        // such enqueues while holding its mutex, so never block while one is
+        // pending: if the queue of the processor is full (which only happens
+        // when not enqueuing from a processor, see
+        // 'bmqc::MultiQueueThreadPool'), back off and retry with the
+        // processor associated to the client by then.
+        mqbi::Dispatcher::DispatcherEventSp& event_sp =
+            bslmf::MovableRefUtil::access(event);
+        while (true) {
+            {
+                PendingEnqueueGuard guard(&data);
+                const mqbi::Dispatcher::ProcessorHandle handle =
+                    data.processorHandle();
+                const int rc = tryDispatchEvent(event_sp,
+                                                data.clientType(),
+                                                handle);
+                if (rc == 0) {
+                    return;  // RETURN
+                }
+
+                if (rc < 0) {
+                    dropEvent(&event_sp, data.clientType(), handle);
+                    return;  // RETURN
+                }
+            }
+
+            bslmt::ThreadUtil::yield();
+        }
+    }
+
     dispatchEvent(bslmf::MovableRefUtil::move(event),
-                  destination->dispatcherClientData().clientType(),
-                  destination->dispatcherClientData().processorHandle());
+                  data.clientType(),
+                  data.processorHandle());
 }
 
 void Dispatcher::dispatchEvent(mqbi::Dispatcher::DispatcherEventRvRef event,
@@ -530,9 +797,16 @@ void Dispatcher::dispatchEvent(mqbi::Dispatcher::DispatcherEventRvRef event,
         bslmf::MovableRefUtil::access(event)->setEnqueueTime(
             bmqu::Time::highResolutionTimer());
 
-        dispatcherContext->d_processorPool_mp->enqueueEvent(
-            bslmf::MovableRefUtil::move(event),
-            handle);
+        mqbi::Dispatcher::DispatcherEventSp& event_sp =
+            bslmf::MovableRefUtil::access(event);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                dispatcherContext->d_processorPool_mp->enqueueEvent(
+                    bslmf::MovableRefUtil::move(event_sp),
+                    handle) != 0)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            dropEvent(&event_sp, type, handle);
+            return;  // RETURN
+        }
 
         // Update stats
         mqbstat::DispatcherStats::onEnqueue(
@@ -546,6 +820,38 @@ void Dispatcher::dispatchEvent(mqbi::Dispatcher::DispatcherEventRvRef event,
     }
 }
 
+int Dispatcher::tryDispatchEvent(
+    const mqbi::Dispatcher::DispatcherEventSp& event,
+    mqbi::DispatcherClientType::Enum           type,
+    mqbi::Dispatcher::ProcessorHandle          handle)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(handle != mqbi::Dispatcher::k_INVALID_PROCESSOR_HANDLE);
+    BSLS_ASSERT_SAFE(type == mqbi::DispatcherClientType::e_SESSION ||
+                     type == mqbi::DispatcherClientType::e_QUEUE ||
+                     type == mqbi::DispatcherClientType::e_CLUSTER);
+
+    BALL_LOG_TRACE << "Enqueuing Event to processor " << handle << " of "
+                   << type << ": " << *event;
+
+    DispatcherContext* dispatcherContext = d_contexts[type].get();
+
+    BSLS_ASSERT_SAFE(dispatcherContext->d_processorPool_mp);
+
+    event->setEnqueueTime(bmqu::Time::highResolutionTimer());
+
+    const int rc = dispatcherContext->d_processorPool_mp->tryEnqueueEvent(
+        event,
+        handle);
+    if (rc == 0) {
+        // Update stats
+        mqbstat::DispatcherStats::onEnqueue(
+            dispatcherContext->d_statContexts[handle].get());
+    }
+
+    return rc;
+}
+
 void Dispatcher::executeOnAllQueues(
     const mqbi::Dispatcher::VoidFunction& functor,
     mqbi::DispatcherClientType::Enum      type,
@@ -628,8 +934,23 @@ void Dispatcher::execute(const mqbi::Dispatcher::VoidFunction& functor,
 
 void Dispatcher::synchronize(mqbi::DispatcherClient* client)
 {
-    synchronize(client->dispatcherClientData().clientType(),
-                client->dispatcherClientData().processorHandle());
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!client->inDispatcherThread());  // Deadlock detection
+
+    typedef void (bslmt::Semaphore::*PostFn)();
+
+    // Dispatch the event to the 'client' (as opposed to its processor) so
+    // that it is ordered with the other events for that client, should it be
+    // migrating to another processor.
+    bslmt::Semaphore                         semaphore;
+    bsl::shared_ptr<mqbevt::DispatcherEvent> event_sp =
+        d_defaultEventSource_sp->getEvent<mqbevt::DispatcherEvent>();
+    (*event_sp).setEnqueueTime(bmqu::Time::highResolutionTimer());
+    (*event_sp).setCallback(
+        bdlf::BindUtil::bind(static_cast<PostFn>(&bslmt::Semaphore::post),
+                             &semaphore));
+    dispatchEvent(bslmf::MovableRefUtil::move(event_sp), client);
+    semaphore.wait();
 }
 
 void Dispatcher::synchronize(mqbi::DispatcherClientType::Enum  type,
@@ -653,6 +974,99 @@ void Dispatcher::synchronize(mqbi::DispatcherClientType::Enum  type,
     semaphore.wait();
 }
 
+bool Dispatcher::rebalance(mqbi::DispatcherClientType::Enum type)
+{
+    // executed by the *SCHEDULER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(type != mqbi::DispatcherClientType::e_UNDEFINED);
+
+    DispatcherContext& context = *(d_contexts[type]);
+
+    if (context.d_processorLoads.size() < 2) {
+        // Rebalancing disabled, or nothing to rebalance
+        return false;  // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&context.d_migrationMutex);  // LOCK
+
+    if (context.d_migration_sp) {
+        // Previous migration is still in progress
+        return false;  // RETURN
+    }
+
+    // Sample the load of each processor since the previous round
+    const int numProcessors = static_cast<int>(
+        context.d_processorLoads.size());
+    bsl::vector<bsls::Types::Int64> loads(numProcessors, 0, d_allocator_p);
+    int                             busiest   = 0;
+    int                             leastBusy = 0;
+    for (int i = 0; i < numProcessors; ++i) {
+        loads[i] = context.d_processorLoads[i]->swap(0);
+        if (loads[i] > loads[busiest]) {
+            busiest = i;
+        }
+        if (loads[i] < loads[leastBusy]) {
+            leastBusy = i;
+        }
+    }
+
+    // Sample the load of each migratable client since the previous round
+    // (for all processors, so that the samples of the next round cover the
+    // same period), and select the busiest client of the busiest processor
+    // whose migration would reduce the load of the busiest processor without
+    // making the least busy processor busier than it.
+    const bsls::Types::Int64 imbalance = loads[busiest] - loads[leastBusy];
+    mqbi::DispatcherClient*  candidate = 0;
+    bsls::Types::Int64       candidateLoad = 0;
+
+    bsl::vector<const mqbi::DispatcherClient*> clients(d_allocator_p);
+    for (int i = 0; i < numProcessors; ++i) {
+        context.d_loadBalancer.loadClientsForProcessor(&clients, i);
+        for (size_t j = 0; j < clients.size(); ++j) {
+            // Clients are registered to the dispatcher as modifiable objects,
+            // and can't be unregistered while 'd_migrationMutex' is locked.
+            mqbi::DispatcherClient* client =
+                const_cast<mqbi::DispatcherClient*>(clients[j]);
+            mqbi::DispatcherClientData& data = client->dispatcherClientData();
+            if (!data.isMigratable()) {
+                continue;  // CONTINUE
+            }
+
+            const bsls::Types::Int64 load = data.sampleProcessingTime();
+            if (i == busiest && load < imbalance && load > candidateLoad) {
+                candidate     = client;
+                candidateLoad = load;
+            }
+        }
+    }
+
+    if (loads[busiest] < k_REBALANCE_MIN_LOAD_NS ||
+        imbalance * 100 < loads[busiest] * k_REBALANCE_MIN_IMBALANCE_PERCENT ||
+        candidate == 0) {
+        // Processors are balanced enough, or there is no client which could
+        // be migrated to improve the balance.
+        return false;  // RETURN
+    }
+
+    BALL_LOG_INFO << "Migrating client '" << candidate->description()
+                  << "' of type " << type << " from processor " << busiest
+                  << " to processor " << leastBusy << " [processorsLoad: "
+                  << bmqu::PrintUtil::prettyTimeInterval(loads[busiest])
+                  << " vs "
+                  << bmqu::PrintUtil::prettyTimeInterval(loads[leastBusy])
+                  << ", clientLoad: "
+                  << bmqu::PrintUtil::prettyTimeInterval(candidateLoad)
+                  << "]";
+
+    beginMigration(bsl::allocate_shared<Migration>(d_allocator_p,
+                                                   candidate,
+                                                   type,
+                                                   busiest,
+                                                   leastBusy));
+    return true;
+}
+
 bmqex::Executor
 Dispatcher::executor(const mqbi::DispatcherClient* client) const
 {
@@ -661,6 +1075,7 @@ Dispatcher::executor(const mqbi::DispatcherClient* client) const
     BSLS_ASSERT(client->dispatcher() == this);
     BSLS_ASSERT(client->dispatcherClientData().clientType() !=
                 mqbi::DispatcherClientType::e_UNDEFINED);
+    BSLS_ASSERT(!client->dispatcherClientData().isMigratable());
 
     return Dispatcher_Executor(this, client);
 }
@@ -668,7 +1083,9 @@ Dispatcher::executor(const mqbi::DispatcherClient* client) const
 bsl::shared_ptr<mqbi::DispatcherEventSource> Dispatcher::createEventSource()
 {
     bsl::shared_ptr<mqbi::DispatcherEventSource> res =
-        bsl::allocate_shared<mqba::DispatcherEventSource>(d_allocator_p);
+        bsl::allocate_shared<mqba::DispatcherEventSource>(
+            d_allocator_p,
+            bsl::string("CustomEventSource", d_allocator_p));
     {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_customEventSources_mtx);
         d_customEventSources.push_back(res);
@@ -691,6 +1108,225 @@ Dispatcher::eventCallbackCreator(mqbi::DispatcherClientType::Enum type,
         lastProcessingStartTime);
 }
 
+void Dispatcher::beginMigration(const MigrationSp& migration)
+{
+    DispatcherContext&          context = *(d_contexts[migration->d_type]);
+    mqbi::DispatcherClientData& data =
+        migration->d_client_p->dispatcherClientData();
+
+    // PRECONDITIONS
+    BSLMT_MUTEXASSERT_IS_LOCKED_SAFE(&context.d_migrationMutex);
+    BSLS_ASSERT_SAFE(!context.d_migration_sp);
+    BSLS_ASSERT_SAFE(data.processorHandle() == migration->d_source);
+
+    context.d_migration_sp = migration;
+
+    // Have the target processor put aside the events for the client, until
+    // the client is handed over by the source processor.
+    context.d_migrationTarget = migration->d_target;
+    context.d_migratingClient = migration->d_client_p;
+
+    // From now on, new events for the client are enqueued to the target
+    // processor.
+    data.migrateToProcessor(migration->d_target);
+    context.d_loadBalancer.moveClient(migration->d_client_p,
+                                      migration->d_target);
+
+    // Wait for the enqueues to the source processor which may have started
+    // before the client was associated to the target processor.  Enqueuing
+    // to a migratable client never blocks while pending (see
+    // 'dispatchEvent'), even if the queue of the processor is full, so this
+    // is short.
+    while (data.numPendingEnqueues() != 0) {
+        bslmt::ThreadUtil::yield();
+    }
+
+    // All events for the client enqueued to the source processor are ahead of
+    // this one.
+    bsl::shared_ptr<mqbevt::DispatcherEvent> event_sp =
+        d_defaultEventSource_sp->getEvent<mqbevt::DispatcherEvent>();
+    event_sp->setEnqueueTime(bmqu::Time::highResolutionTimer());
+    event_sp->callback().set(
+        bdlf::BindUtil::bind(&Dispatcher::onMigrationSourceDrained,
+                             this,
+                             migration));
+    dispatchEvent(bslmf::MovableRefUtil::move(event_sp),
+                  migration->d_type,
+                  migration->d_source);
+}
+
+void Dispatcher::onMigrationSourceDrained(const MigrationSp& migration)
+{
+    // executed by the *SOURCE PROCESSOR* of the migration
+
+    DispatcherContext& context = *(d_contexts[migration->d_type]);
+
+    {
+        // Prevent the client from being unregistered while it is accessed
+        bslmt::LockGuard<bslmt::Mutex> guard(&context.d_migrationMutex);
+
+        if (!migration->d_isCancelled) {
+            mqbi::DispatcherClient*     client = migration->d_client_p;
+            mqbi::DispatcherClientData& data = client->dispatcherClientData();
+
+            if (data.addedToFlushList()) {
+                // The flush list of this processor was not flushed because
+                // flushing is disabled: the client must not remain in it.
+                DispatcherClientPtrVector& flushList =
+                    context.d_flushList[migration->d_source];
+                flushList.erase(
+                    bsl::remove(flushList.begin(), flushList.end(), client),
+                    flushList.end());
+                data.setAddedToFlushList(false);
+            }
+
+            client->setThreadId(context.d_processorPool_mp->queueThreadId(
+                migration->d_target));
+            client->setEventSource(
+                context.d_eventSources[migration->d_target]);
+        }
+    }
+
+    bsl::shared_ptr<mqbevt::DispatcherEvent> event_sp =
+        context.d_eventSources[migration->d_source]
+            ->getEvent<mqbevt::DispatcherEvent>();
+    event_sp->setEnqueueTime(bmqu::Time::highResolutionTimer());
+    event_sp->callback().set(
+        bdlf::BindUtil::bind(&Dispatcher::onMigrationTargetReady,
+                             this,
+                             migration));
+    dispatchEvent(bslmf::MovableRefUtil::move(event_sp),
+                  migration->d_type,
+                  migration->d_target);
+}
+
+void Dispatcher::onMigrationTargetReady(const MigrationSp& migration)
+{
+    // executed by the *TARGET PROCESSOR* of the migration
+
+    DispatcherContext& context = *(d_contexts[migration->d_type]);
+
+    // Stop putting aside events for the client: all the events which are
+    // still enqueued for it are behind this one.
+    context.d_migratingClient = 0;
+
+    DispatcherEventSpVector& events =
+        context.d_deferredEvents[migration->d_target];
+    DispatcherEventSpVector& replayedEvents =
+        context.d_replayedEvents[migration->d_target];
+    BSLS_ASSERT_SAFE(replayedEvents.empty());
+
+    const bool   isCancelled       = migration->d_isCancelled;
+    const size_t numDeferredEvents = events.size();
+    if (isCancelled) {
+        // The client is gone: only the 'e_DISPATCHER' events, which do not
+        // access it, can still be processed.
+        for (size_t i = 0; i < events.size(); ++i) {
+            if (events[i]->type() == mqbi::DispatcherEventType::e_DISPATCHER) {
+                replayedEvents.push_back(events[i]);
+            }
+        }
+        events.clear();
+    }
+    else {
+        replayedEvents.swap(events);
+    }
+
+    // The events are processed by the event callback of this processor as
+    // soon as this method returns, and before any other event, so that they
+    // are accounted for like any other event.
+
+    BALL_LOG_INFO << "Migration of client of type " << migration->d_type
+                  << " from processor " << migration->d_source
+                  << " to processor " << migration->d_target
+                  << (isCancelled ? " cancelled" : " completed") << " in "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         bmqu::Time::highResolutionTimer() -
+                         migration->d_startTime)
+                  << " [numDeferredEvents: " << numDeferredEvents << "]";
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&context.d_migrationMutex);  // LOCK
+    context.d_migration_sp.reset();
+}
+
+void Dispatcher::processEvent(const mqbi::Dispatcher::DispatcherEventSp& event,
+                              DispatcherClientPtrVector* flushList,
+                              int*                       batchSize,
+                              bmqst::StatContext*        statContext,
+                              bmqu::GateKeeper*          flushClientsGate)
+{
+    // executed by the *DISPATCHER* thread
+
+    if (event->type() == mqbi::DispatcherEventType::e_DISPATCHER) {
+        const mqbevt::DispatcherEvent* realEvent =
+            event->the<mqbevt::DispatcherEvent>();
+
+        // We must flush now (and irrespective of a callback actually being
+        // set on the event) to ensure the flushList is empty before
+        // executing the callback: this dispatcher event may correspond to
+        // the destruction of the Client, and guaranteeing this client is
+        // not (and will not be added) to the flushList is actually the
+        // whole purpose of the 'e_DISPATCHER' event type.
+        flushClients(flushList, batchSize, statContext, flushClientsGate);
+
+        if (!realEvent->callback().empty()) {
+            // A callback may not have been set if all we wanted was to
+            // execute the 'finalizeCallback' of the event.
+            realEvent->callback()();
+        }
+    }
+    else {
+        event->destination()->onDispatcherEvent(*event.get());
+        if (!event->destination()->dispatcherClientData().addedToFlushList()) {
+            flushList->emplace_back(event->destination());
+            event->destination()->dispatcherClientData().setAddedToFlushList(
+                true);
+        }
+    }
+}
+
+void Dispatcher::flushClients(DispatcherClientPtrVector* flushList,
+                              int*                       batchSize,
+                              bmqst::StatContext*        statContext,
+                              bmqu::GateKeeper*          flushClientsGate)
+{
+    // executed by the *DISPATCHER* thread
+
+    if (*batchSize != 0) {
+        mqbstat::DispatcherStats::onBatch(statContext, *batchSize);
+        *batchSize = 0;
+    }
+
+    bmqu::GateKeeper::Status status(*flushClientsGate);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!status.isOpen())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;  // RETURN
+    }
+
+    for (size_t i = 0; i < flushList->size(); ++i) {
+        (*flushList)[i]->flush();
+        (*flushList)[i]->dispatcherClientData().setAddedToFlushList(false);
+    }
+    flushList->clear();
+}
+
+void Dispatcher::pinProcessor(mqbi::DispatcherClientType::Enum type,
+                              int                              processorId,
+                              int                              cpu)
+{
+    // executed by the *DISPATCHER* thread
+
+    const int rc = mqbu::ThreadUtil::setCpuAffinity(cpu, 1);
+    if (rc != 0) {
+        BALL_LOG_WARN << "Failed to pin processor " << processorId << " of '"
+                      << type << "' to CPU " << cpu << " [rc: " << rc << "]";
+        return;  // RETURN
+    }
+
+    BALL_LOG_INFO << "Pinned processor " << processorId << " of '" << type
+                  << "' to CPU " << cpu;
+}
+
 // -------------------------------
 // class Dispatcher::EventCallback
 // -------------------------------
@@ -706,17 +1342,102 @@ mqba::Dispatcher::EventCallback::EventCallback(
 , d_stats_sp(context_sp->d_statContexts[queueId])
 , d_flushClientsGate_p(flushClientsGate_p)
 , d_flushList_p(&context_sp->d_flushList[queueId])
+, d_batchSize_p(&context_sp->d_batchSizes[queueId])
 , d_processorPool_p(context_sp->d_processorPool_mp.get())
 , d_warningTimeoutNs(warningTimeoutNs)
 , d_type(type)
 , d_queueId(queueId)
 , d_lastProcessingStartTime_p(lastProcessingStartTime)
+, d_processorLoad_p(context_sp->d_processorLoads.empty()
+                        ? 0
+                        : context_sp->d_processorLoads[queueId].get())
+, d_context_p(context_sp.get())
+, d_deferredEvents_p(&context_sp->d_deferredEvents[queueId])
+, d_replayedEvents_p(&context_sp->d_replayedEvents[queueId])
+, d_maxBatchSize(context_sp->d_maxBatchSize)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_flushClientsGate_p);
     BSLS_ASSERT_SAFE(d_lastProcessingStartTime_p);
 }
 
+bool mqba::Dispatcher::EventCallback::mustDefer(
+    const mqbi::Dispatcher::DispatcherEventSp& event) const
+{
+    // Note that 'destination' may be dangling for 'e_DISPATCHER' events, so
+    // it is only compared, never accessed.
+    const mqbi::DispatcherClient* destination = event->destination();
+    return destination != 0 && destination == d_context_p->d_migratingClient &&
+           d_queueId == d_context_p->d_migrationTarget;
+}
+
+void mqba::Dispatcher::EventCallback::process(
+    const mqbi::Dispatcher::DispatcherEventSp& event,
+    bsls::Types::Int64                         processingStartTime)
+{
+    // executed by the *DISPATCHER* thread
+
+    d_lastProcessingStartTime_p->store(processingStartTime);
+
+    mqbi::DispatcherClient* destination = event->destination();
+
+    processEvent(event,
+                 d_flushList_p,
+                 d_batchSize_p,
+                 d_stats_sp.get(),
+                 d_flushClientsGate_p);
+
+    const bsls::Types::Int64 processingTime =
+        bmqu::Time::highResolutionTimer() - processingStartTime;
+
+    // Update stats
+    mqbstat::DispatcherStats::onProcess(d_stats_sp.get(),
+                                        event->type(),
+                                        processingTime);
+
+    if (d_processorLoad_p) {
+        // Rebalancing is enabled
+        d_processorLoad_p->addRelaxed(processingTime);
+        if (event->type() != mqbi::DispatcherEventType::e_DISPATCHER &&
+            destination->dispatcherClientData().isMigratable()) {
+            destination->dispatcherClientData().addProcessingTime(
+                processingTime);
+        }
+    }
+
+    d_lastProcessingStartTime_p->store(0);
+
+    if (processingTime > d_warningTimeoutNs) {
+        BALL_LOG_WARN << "Queue '" << d_queueName
+                      << "' has processed an event in "
+                      << bmqu::PrintUtil::prettyTimeInterval(processingTime)
+                      << ". Current queue size: "
+                      << d_processorPool_p->numElements(d_queueId);
+    }
+
+    ++*d_batchSize_p;
+    if (d_maxBatchSize > 0 && *d_batchSize_p >= d_maxBatchSize) {
+        // Under sustained load the queue may never be empty: flush the
+        // clients touched by this batch now rather than letting their pending
+        // data (and the latency of it) grow unbounded.
+        flushClients();
+    }
+}
+
+void mqba::Dispatcher::EventCallback::processReplayedEvents()
+{
+    // executed by the *DISPATCHER* thread
+
+    DispatcherEventSpVector events(d_replayedEvents_p->get_allocator());
+    events.swap(*d_replayedEvents_p);
+
+    for (size_t i = 0; i < events.size(); ++i) {
+        // The time spent in the queue was already reported when the event was
+        // put aside.
+        process(events[i], bmqu::Time::highResolutionTimer());
+    }
+}
+
 void mqba::Dispatcher::EventCallback::operator()(
     const mqbi::Dispatcher::DispatcherEventSp& event)
 {
@@ -726,59 +1447,32 @@ void mqba::Dispatcher::EventCallback::operator()(
 
         const bsls::Types::Int64 processingStartTime =
             bmqu::Time::highResolutionTimer();
-        d_lastProcessingStartTime_p->store(processingStartTime);
 
         const bsls::Types::Int64 queuedTime = processingStartTime -
                                               event->enqueueTime();
 
-        if (event->type() == mqbi::DispatcherEventType::e_DISPATCHER) {
-            const mqbevt::DispatcherEvent* realEvent =
-                event->the<mqbevt::DispatcherEvent>();
-
-            // We must flush now (and irrespective of a callback actually being
-            // set on the event) to ensure the flushList is empty before
-            // executing the callback: this dispatcher event may correspond to
-            // the destruction of the Client, and guaranteeing this client is
-            // not (and will not be added) to the flushList is actually the
-            // whole purpose of the 'e_DISPATCHER' event type.
-            flushClients();
-
-            if (!realEvent->callback().empty()) {
-                // A callback may not have been set if all we wanted was to
-                // execute the 'finalizeCallback' of the event.
-                realEvent->callback()();
-            }
-        }
-        else {
-            event->destination()->onDispatcherEvent(*event.get());
-            if (!event->destination()
-                     ->dispatcherClientData()
-                     .addedToFlushList()) {
-                d_flushList_p->emplace_back(event->destination());
-                event->destination()
-                    ->dispatcherClientData()
-                    .setAddedToFlushList(true);
-            }
+        mqbstat::DispatcherStats::onDequeue(d_stats_sp.get(), queuedTime);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_processorLoad_p &&
+                                                  mustDefer(event))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            // The destination is being migrated to this processor, and its
+            // previous processor may not have delivered all the events
+            // enqueued to it yet: put this event aside until the client is
+            // handed over to preserve ordering.
+            d_deferredEvents_p->push_back(event);
+            return;  // RETURN
         }
 
-        const bsls::Types::Int64 processingTime =
-            bmqu::Time::highResolutionTimer() - processingStartTime;
+        process(event, processingStartTime);
 
-        // Update stats
-        mqbstat::DispatcherStats::onDequeue(d_stats_sp.get(), queuedTime);
-        mqbstat::DispatcherStats::onProcess(d_stats_sp.get(),
-                                            event->type(),
-                                            processingTime);
-
-        d_lastProcessingStartTime_p->store(0);
-
-        if (processingTime > d_warningTimeoutNs) {
-            BALL_LOG_WARN << "Queue '" << d_queueName
-                          << "' has processed an event in "
-                          << bmqu::PrintUtil::prettyTimeInterval(
-                                 processingTime)
-                          << ". Current queue size: "
-                          << d_processorPool_p->numElements(d_queueId);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                !d_replayedEvents_p->empty())) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            // 'event' handed over a migrated client to this processor
+            processReplayedEvents();
         }
     }
     else {
@@ -791,17 +1485,10 @@ void mqba::Dispatcher::EventCallback::flushClients()
 {
     // executed by the *DISPATCHER* thread
 
-    bmqu::GateKeeper::Status status(*d_flushClientsGate_p);
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!status.isOpen())) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return;  // RETURN
-    }
-
-    for (size_t i = 0; i < d_flushList_p->size(); ++i) {
-        (*d_flushList_p)[i]->flush();
-        (*d_flushList_p)[i]->dispatcherClientData().setAddedToFlushList(false);
-    }
-    d_flushList_p->clear();
+    Dispatcher::flushClients(d_flushList_p,
+                             d_batchSize_p,
+                             d_stats_sp.get(),
+                             d_flushClientsGate_p);
 }
 
 }  // close package namespace
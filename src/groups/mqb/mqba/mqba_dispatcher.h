@@ -43,6 +43,69 @@
 /// executor's associated processor thread results in the submitted functor to
 /// be executed in-place.  A call to `dispatch` from outside of the executor's
 /// associated processor thread is equivalent to a call to `post`.
+///
+/// Flushing                                        {#mqba_dispatcher_flushing}
+/// ========
+///
+/// Each processor keeps track of the clients it delivered events to, and
+/// calls `flush` on them once its queue is empty, so that clients can batch
+/// the work resulting from consecutive events (e.g., writes to a channel or
+/// to a file).  Under sustained load the queue may stay non-empty for a long
+/// time, delaying the flush.  When `maxBatchSize` is non-zero in the
+/// configuration of the processors of a client type, a processor also
+/// flushes its clients after having processed that many events since the
+/// previous flush.  The number of events processed between two flushes is
+/// reported in the `batch_size` statistic of the processor.
+///
+/// CPU Affinity                                    {#mqba_dispatcher_affinity}
+/// ============
+///
+/// By default, the operating system schedules the processor threads on any
+/// CPU of the host.  When `numCpus` is non-zero in the configuration of the
+/// processors of a client type, each processor thread of that type is pinned,
+/// when the dispatcher starts, to a CPU of the range starting at `firstCpu`:
+/// the processor of index `i` runs on the CPU of index
+/// `firstCpu + i % numCpus`.  Since memory is allocated on the NUMA node of
+/// the CPU which first touches it, confining the processors of a type to the
+/// CPUs of one node keeps the memory they initialize (including the files
+/// mapped and prefaulted by the storage running on the queue processors)
+/// local to them.  A processor which can not be pinned (e.g., because the
+/// CPU is not available to the broker) is left unpinned, and a warning is
+/// logged.
+///
+/// Rebalancing                                  {#mqba_dispatcher_rebalancing}
+/// ===========
+///
+/// Clients are associated to a processor once, when they register, based on
+/// the number of clients each processor already has, regardless of the load
+/// those clients generate.  A few hot clients may therefore saturate one
+/// processor while others are idle.  When `rebalanceIntervalMs` is non-zero
+/// in the configuration of a client type, the dispatcher periodically samples
+/// the time spent by each processor of that type processing events, and may
+/// migrate one client which opted in (see
+/// @bbref{mqbi::DispatcherClientData::isMigratable}) from the busiest
+/// processor to the least busy one.  At most one migration is in progress
+/// per client type at any time.
+///
+/// A migration preserves the order in which events are delivered to the
+/// client, and the guarantee that the client is only ever invoked from a
+/// single thread at a time:
+///
+/// 1. The client is associated to the target processor, so that new events
+///    are enqueued to it, and a marker event is enqueued to the source
+///    processor once all in-flight enqueues to the source processor are done.
+/// 2. Events for the client dequeued by the target processor are put aside
+///    until the marker is processed by the source processor, which means
+///    that all events previously enqueued to the source processor have been
+///    delivered.  The source processor then hands over the client to the
+///    target processor by enqueuing a second marker to it.
+/// 3. When processing the second marker, the target processor delivers the
+///    events which were put aside, in order, and resumes normal processing.
+///
+/// Note that clients opting in must not use an executor obtained from the
+/// dispatcher, nor the `execute` overload taking a `DispatcherClientData`,
+/// as those address the processor the client was associated to at the time
+/// of the call.
 
 // MQB
 #include <mqbcfg_messages.h>
@@ -56,6 +119,7 @@
 
 // BDE
 #include <ball_log.h>
+#include <bdlmt_eventscheduler.h>
 #include <bdlmt_threadpool.h>
 #include <bsl_functional.h>
 #include <bsl_memory.h>
@@ -66,14 +130,14 @@
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
 // FORWARD DECLARATION
-namespace bdlmt {
-class EventScheduler;
-}
 namespace bmqst {
 class StatContext;
 }
@@ -162,6 +226,55 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
 
     typedef bsl::vector<mqbi::DispatcherClient*> DispatcherClientPtrVector;
 
+    typedef bsl::vector<mqbi::Dispatcher::DispatcherEventSp>
+        DispatcherEventSpVector;
+
+    /// State of the migration of a client from one processor to another (see
+    /// @bbref{mqba_dispatcher_rebalancing}).
+    struct Migration {
+      private:
+        // NOT IMPLEMENTED
+        Migration(const Migration&) BSLS_CPP11_DELETED;
+
+        /// Copy constructor and assignment operator are not implemented.
+        Migration& operator=(const Migration&) BSLS_CPP11_DELETED;
+
+      public:
+        // PUBLIC DATA
+
+        /// The client being migrated.
+        mqbi::DispatcherClient* d_client_p;
+
+        /// Type of the client being migrated.
+        const mqbi::DispatcherClientType::Enum d_type;
+
+        /// Processor the client is migrated from.
+        const int d_source;
+
+        /// Processor the client is migrated to.
+        const int d_target;
+
+        /// Time (from `bmqu::Time::highResolutionTimer`) at which the
+        /// migration started.
+        const bsls::Types::Int64 d_startTime;
+
+        /// Whether the client was unregistered while being migrated, in which
+        /// case it must no longer be accessed.
+        bsls::AtomicBool d_isCancelled;
+
+        // CREATORS
+
+        /// Create a migration of the specified `client` of the specified
+        /// `type` from the specified `source` processor to the specified
+        /// `target` processor.
+        Migration(mqbi::DispatcherClient*          client,
+                  mqbi::DispatcherClientType::Enum type,
+                  int                              source,
+                  int                              target);
+    };
+
+    typedef bsl::shared_ptr<Migration> MigrationSp;
+
     /// Context for a dispatcher, with threads and pools
     struct DispatcherContext {
       private:
@@ -189,6 +302,16 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
         /// the vector corresponds to the processor.
         bsl::vector<DispatcherClientPtrVector> d_flushList;
 
+        /// Maximum number of events a processor processes before flushing the
+        /// clients in its flush list, or 0 to only flush them once its queue
+        /// is empty.
+        const int d_maxBatchSize;
+
+        /// Number of events processed by each processor since it last
+        /// flushed the clients in its flush list.  The index of the vector
+        /// corresponds to the processor.
+        bsl::vector<int> d_batchSizes;
+
         /// An event sources that should be exclusively used by the threads
         /// assigned for each processor.
         bsl::vector<bsl::shared_ptr<mqbi::DispatcherEventSource> >
@@ -201,15 +324,49 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
         /// processor.
         bsl::vector<bsl::shared_ptr<bmqst::StatContext> > d_statContexts;
 
+        /// Time (in nanoseconds) spent by each processor processing events
+        /// since the last rebalancing round.  Empty if rebalancing is
+        /// disabled for this type of clients.
+        bsl::vector<bsl::shared_ptr<bsls::AtomicInt64> > d_processorLoads;
+
+        /// Events put aside by each processor, for the client being migrated
+        /// to it, until the client is handed over by its previous processor.
+        /// The first index of the vector corresponds to the processor.
+        bsl::vector<DispatcherEventSpVector> d_deferredEvents;
+
+        /// Events put aside by each processor which must be processed by it
+        /// once the client they are for has been handed over to it.  The
+        /// first index of the vector corresponds to the processor.
+        bsl::vector<DispatcherEventSpVector> d_replayedEvents;
+
+        /// Client currently being migrated, if any.  Reset as soon as the
+        /// migration completes or is cancelled, so that it never refers to a
+        /// client which is no longer registered.
+        bsls::AtomicPointer<mqbi::DispatcherClient> d_migratingClient;
+
+        /// Processor the client currently being migrated is migrated to.
+        bsls::AtomicInt d_migrationTarget;
+
+        /// The migration in progress, if any.
+        MigrationSp d_migration_sp;
+
+        /// Mutex serializing the rebalancing rounds and the unregistration of
+        /// clients, and protecting `d_migration_sp`.
+        bslmt::Mutex d_migrationMutex;
+
+        /// Handle to the recurring event triggering the rebalancing rounds.
+        bdlmt::EventScheduler::RecurringEventHandle d_rebalanceEventHandle;
+
         // TRAITS
         BSLMF_NESTED_TRAIT_DECLARATION(DispatcherContext,
                                        bslma::UsesBslmaAllocator)
 
         // CREATORS
 
-        /// Create a new object with the specified `config` and using the
-        /// specified `allocator`.
-        DispatcherContext(const mqbcfg::DispatcherProcessorConfig& config,
+        /// Create a new object for the clients of the specified `type` with
+        /// the specified `config` and using the specified `allocator`.
+        DispatcherContext(mqbi::DispatcherClientType::Enum         type,
+                          const mqbcfg::DispatcherProcessorConfig& config,
                           bslma::Allocator*                        allocator);
     };
 
@@ -235,6 +392,10 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
         /// Flush list for this processor queue (held, not owned).
         mqba::Dispatcher::DispatcherClientPtrVector* d_flushList_p;
 
+        /// Number of events processed by this processor since the clients
+        /// were last flushed (held, not owned).
+        int* d_batchSize_p;
+
         /// Processor pull for logging the size of the queue (held, not owned).
         const ProcessorPool* d_processorPool_p;
 
@@ -251,9 +412,49 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
         /// used by the stuck-event monitor (held, not owned).
         bsls::AtomicInt64* d_lastProcessingStartTime_p;
 
+        /// Accumulated processing time of this processor, used by the
+        /// rebalancing logic, or null if rebalancing is disabled (held, not
+        /// owned).
+        bsls::AtomicInt64* d_processorLoad_p;
+
+        /// Context of this processor, used to detect events for a client
+        /// being migrated to this processor (held, not owned).
+        DispatcherContext* d_context_p;
+
+        /// Events put aside for the client being migrated to this processor
+        /// (held, not owned).
+        DispatcherEventSpVector* d_deferredEvents_p;
+
+        /// Events put aside for a client which has been handed over to this
+        /// processor, to process before any other event (held, not owned).
+        DispatcherEventSpVector* d_replayedEvents_p;
+
+        /// Maximum number of events to process before flushing the clients,
+        /// or 0 to only flush them once the queue is empty.
+        const int d_maxBatchSize;
+
+        // PRIVATE ACCESSORS
+
+        /// Return true if the specified `event` is destined to a client being
+        /// migrated to this processor and must be put aside until the client
+        /// is handed over by its previous processor.
+        bool mustDefer(const mqbi::Dispatcher::DispatcherEventSp& event) const;
+
         // PRIVATE MANIPULATORS
 
-        /// Flush all clients in the flush list and clear it.
+        /// Deliver the specified `event`, whose processing starts at the
+        /// specified `processingStartTime`, to its destination, account for
+        /// its processing time, and flush all clients in the flush list if
+        /// the maximum batch size is reached.
+        void process(const mqbi::Dispatcher::DispatcherEventSp& event,
+                     bsls::Types::Int64 processingStartTime);
+
+        /// Process the events put aside for the client which has just been
+        /// handed over to this processor.
+        void processReplayedEvents();
+
+        /// Flush all clients in the flush list and clear it, and report the
+        /// size of the batch of events processed since the previous flush.
         void flushClients();
 
       public:
@@ -277,8 +478,9 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
         // MANIPULATORS
 
         /// Process the specified `event`.  If `event` is non-null, dispatch
-        /// it to the destination client and update stats; otherwise flush
-        /// all clients in the flush list.
+        /// it to the destination client and update stats, and flush all
+        /// clients in the flush list if the maximum batch size is reached;
+        /// otherwise flush all clients in the flush list.
         void operator()(const mqbi::Dispatcher::DispatcherEventSp& event);
     };
 
@@ -294,7 +496,7 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
     bslma::Allocator* d_allocator_p;
 
     /// True if this component is started.
-    bool d_isStarted;
+    bsls::AtomicBool d_isStarted;
 
     /// Configuration for the dispatcher.
     mqbcfg::DispatcherConfig d_config;
@@ -323,12 +525,25 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
     /// @brief Mechanism controlling enabling/disabling of client flushing.
     bmqu::GateKeeper d_flushClientsGate;
 
+    /// Number of events dropped because the processor they were dispatched
+    /// to no longer accepted events, i.e. while the dispatcher was stopping.
+    bsls::AtomicInt64 d_numDroppedEvents;
+
     // FRIENDS
     friend class Dispatcher_Executor;
 
   private:
     // PRIVATE MANIPULATORS
 
+    /// Drop the specified `event`, which could not be enqueued to the
+    /// processor having the specified `handle` in charge of clients of the
+    /// specified `type` because that processor no longer accepts events:
+    /// log it, count it and release it.  The behavior is undefined unless
+    /// the dispatcher is stopping.
+    void dropEvent(mqbi::Dispatcher::DispatcherEventSp* event,
+                   mqbi::DispatcherClientType::Enum     type,
+                   mqbi::Dispatcher::ProcessorHandle    handle);
+
     /// Start the dispatcher context associated with clients of the specified
     /// `type`, using the specified `config` and return 0 on success, or return
     /// a non-zero value and populate the specified `errorDescription` on
@@ -337,6 +552,13 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
                      mqbi::DispatcherClientType::Enum         type,
                      const mqbcfg::DispatcherProcessorConfig& config);
 
+    /// Pin each processor thread in charge of dispatcher clients of the
+    /// specified `type` to its CPU, as per the specified `config`, and wait
+    /// for all of them to be pinned.  This method has no effect if `config`
+    /// does not specify any CPU.
+    void pinProcessors(mqbi::DispatcherClientType::Enum         type,
+                       const mqbcfg::DispatcherProcessorConfig& config);
+
     /// Create a queue for the multi-fixed queue thread pool in charge of
     /// dispatcher client of the specified `type` and using the specified
     /// `config`.  This queue corresponds to the specified `processorId` and
@@ -347,6 +569,28 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
                  int                                          processorId,
                  bslma::Allocator*                            allocator);
 
+    /// Create a ring buffer queue for the multi-fixed queue thread pool in
+    /// charge of dispatcher client of the specified `type` and using the
+    /// specified `config`.  This queue corresponds to the specified
+    /// `processorId` and the specified `allocator` should be used to create
+    /// it.
+    ProcessorPool::RingBufferQueue*
+    ringBufferQueueCreator(mqbi::DispatcherClientType::Enum             type,
+                           const mqbcfg::DispatcherProcessorParameters& config,
+                           int               processorId,
+                           bslma::Allocator* allocator);
+
+    /// Configure the watermarks and the state callback of the specified
+    /// `queue` of the processor having the specified `processorId` in
+    /// charge of dispatcher clients of the specified `type`, according to
+    /// the specified `config`, and create the stat context of the queue.
+    template <class QUEUE>
+    void initializeProcessorQueue(
+        QUEUE*                                       queue,
+        mqbi::DispatcherClientType::Enum             type,
+        const mqbcfg::DispatcherProcessorParameters& config,
+        int                                          processorId);
+
     /// Create an event callback for the processor having the specified
     /// `queueId` in charge of dispatcher clients of the specified `type`,
     /// using the specified `lastProcessingStartTime` to track event
@@ -356,6 +600,60 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
                          int                              queueId,
                          bsls::AtomicInt64* lastProcessingStartTime);
 
+    /// Enqueue the specified `event` for the specified `type` of client on
+    /// the processor having the specified `handle`, without blocking.
+    /// Return 0 on success, a positive value if the queue of the processor
+    /// is full, and a negative value if the event could not be enqueued for
+    /// another reason.
+    int tryDispatchEvent(const mqbi::Dispatcher::DispatcherEventSp& event,
+                         mqbi::DispatcherClientType::Enum           type,
+                         mqbi::Dispatcher::ProcessorHandle          handle);
+
+    /// Start migrating the client described by the specified `migration`
+    /// from its source processor to its target processor.  The behavior is
+    /// undefined unless the migration mutex of the corresponding context is
+    /// locked, and no other migration is in progress for that context.
+    void beginMigration(const MigrationSp& migration);
+
+    /// Hand over the client described by the specified `migration` to its
+    /// target processor.  This method is executed by the source processor of
+    /// the migration, once all events enqueued to it for the client before
+    /// the migration started have been processed.
+    void onMigrationSourceDrained(const MigrationSp& migration);
+
+    /// Complete the specified `migration` by having the target processor
+    /// deliver the events it put aside, right after this method returns.
+    /// This method is executed by the target processor of the migration.
+    void onMigrationTargetReady(const MigrationSp& migration);
+
+    // PRIVATE CLASS METHODS
+
+    /// Deliver the specified `event` to its destination (or execute its
+    /// callback if it is an `e_DISPATCHER` event), using the specified
+    /// `flushList`, `batchSize`, `statContext` and `flushClientsGate` of the
+    /// processor executing this method.
+    static void processEvent(const mqbi::Dispatcher::DispatcherEventSp& event,
+                             DispatcherClientPtrVector* flushList,
+                             int*                       batchSize,
+                             bmqst::StatContext*        statContext,
+                             bmqu::GateKeeper*          flushClientsGate);
+
+    /// Report the specified `batchSize` number of events processed since the
+    /// previous flush to the specified `statContext` and reset it, then flush
+    /// all clients in the specified `flushList` and clear it, unless the
+    /// specified `flushClientsGate` is closed.
+    static void flushClients(DispatcherClientPtrVector* flushList,
+                             int*                       batchSize,
+                             bmqst::StatContext*        statContext,
+                             bmqu::GateKeeper*          flushClientsGate);
+
+    /// Pin the calling thread, which is the processor having the specified
+    /// `processorId` in charge of dispatcher clients of the specified
+    /// `type`, to the specified `cpu`.
+    static void pinProcessor(mqbi::DispatcherClientType::Enum type,
+                             int                              processorId,
+                             int                              cpu);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(Dispatcher, bslma::UsesBslmaAllocator)
@@ -461,7 +759,9 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
                  mqbi::DispatcherEventType::Enum type) BSLS_KEYWORD_OVERRIDE;
 
     /// Execute the specified `functor` using the `e_DISPATCHER` event type, in
-    /// the processor associated with the specified `client`.
+    /// the processor associated with the specified `client`.  Note that the
+    /// ordering of `functor` with respect to other events for `client` is
+    /// not guaranteed if `client` is being migrated to another processor.
     void
     execute(const mqbi::Dispatcher::VoidFunction& functor,
             const mqbi::DispatcherClientData& client) BSLS_KEYWORD_OVERRIDE;
@@ -484,6 +784,19 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
                      mqbi::Dispatcher::ProcessorHandle handle)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Perform a rebalancing round for the processors in charge of clients of
+    /// the specified `type`: if the time spent processing events since the
+    /// previous round by the busiest processor sufficiently exceeds the one
+    /// of the least busy processor, start migrating a client which allows it
+    /// from the former to the latter (see
+    /// @bbref{mqba_dispatcher_rebalancing}).  Return true if a migration was
+    /// started, and false otherwise.  This method has no effect and returns
+    /// false if rebalancing is disabled for `type`, or if a migration is
+    /// already in progress for `type`.  Note that this method is periodically
+    /// invoked by the dispatcher when rebalancing is enabled, and is exposed
+    /// mainly for testing purposes.
+    bool rebalance(mqbi::DispatcherClientType::Enum type);
+
     // ACCESSORS
 
     /// Return number of processors dedicated for dispatching clients of the
@@ -501,7 +814,8 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
     ///
     /// Note also that the returned executor can be used to submit work even
     /// after the specified `client` has been unregistered from this
-    /// dispatcher.
+    /// dispatcher.  The behavior is undefined if `client` is migratable (see
+    /// @bbref{mqba_dispatcher_rebalancing}).
     bmqex::Executor
     executor(const mqbi::DispatcherClient* client) const BSLS_KEYWORD_OVERRIDE;
 
@@ -509,6 +823,11 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
     /// the specified `client`.
     bsls::Types::Int64 numProcessorEvents(
         const mqbi::DispatcherClient* client) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of events dropped because the processor they were
+    /// dispatched to no longer accepted events, i.e. while the dispatcher
+    /// was stopping.
+    bsls::Types::Int64 numDroppedEvents() const;
 };
 
 // ============================================================================
@@ -562,6 +881,11 @@ Dispatcher::numProcessorEvents(const mqbi::DispatcherClient* client) const
     return d_contexts[type]->d_processorPool_mp->numElements(queueId);
 }
 
+inline bsls::Types::Int64 Dispatcher::numDroppedEvents() const
+{
+    return d_numDroppedEvents;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
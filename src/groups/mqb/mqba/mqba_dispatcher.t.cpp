@@ -20,6 +20,7 @@
 #include <mqbevt_callbackevent.h>
 #include <mqbmock_dispatcher.h>
 #include <mqbstat_dispatcherstats.h>
+#include <mqbu_threadutil.h>
 
 #include <bmqex_executionpolicy.h>
 #include <bmqex_executionutil.h>
@@ -29,10 +30,15 @@
 // BDE
 #include <bdlf_bind.h>
 #include <bdlmt_eventscheduler.h>
+#include <bdlt_timeunitratio.h>
+#include <bsl_algorithm.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
+#include <bslmt_barrier.h>
 #include <bslmt_semaphore.h>
+#include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
@@ -86,6 +92,12 @@ static mqbcfg::DispatcherConfig makeConfig()
     return config;
 }
 
+/// Load into the specified `cpu` the CPU the calling thread is running on.
+static void loadCurrentCpu(int* cpu)
+{
+    *cpu = mqbu::ThreadUtil::currentCpu();
+}
+
 // ==================
 // struct Synchronize
 // ==================
@@ -136,6 +148,8 @@ struct TestDispatcherClient : public mqbi::DispatcherClient {
 
     const bsl::string d_description;
 
+    bsls::AtomicInt d_numFlushes;
+
   private:
     // NOT IMPLEMENTED
     /// Should not allow copy/assignment because dispatcher clients are
@@ -150,6 +164,7 @@ struct TestDispatcherClient : public mqbi::DispatcherClient {
     : d_dispatcher_p(dispatcher)
     , d_data()
     , d_description()
+    , d_numFlushes(0)
     {
         // NOTHING
     }
@@ -186,10 +201,7 @@ struct TestDispatcherClient : public mqbi::DispatcherClient {
 
     /// Called by the dispatcher to flush any pending operation; mainly
     /// used to provide batch and nagling mechanism.
-    void flush() BSLS_KEYWORD_OVERRIDE
-    {
-        // NOTHING
-    }
+    void flush() BSLS_KEYWORD_OVERRIDE { ++d_numFlushes; }
 
     // ACCESSORS
 
@@ -212,6 +224,9 @@ struct TestDispatcherClient : public mqbi::DispatcherClient {
     {
         return d_description;
     }
+
+    /// Return the number of times this client was flushed.
+    int numFlushes() const { return d_numFlushes.load(); }
 };
 
 /// A helper class used to verify correctness of ExecuteOnAllQueues.
@@ -250,6 +265,154 @@ struct ExecuteOnAllQueuesHelper {
     }
 };
 
+/// A helper used to verify that the events for a client are delivered in
+/// order, and from the processor associated to the client, while the client
+/// may be migrated from one processor to another.
+struct OrderedEventsHelper {
+    // DATA
+    const mqbi::DispatcherClient* d_client_p;
+    int                           d_nextSequenceNumber;
+    int                           d_numOutOfOrder;
+    int                           d_numWrongThread;
+    bslmt::ThreadUtil::Id         d_lastThreadId;
+
+    // CREATORS
+    explicit OrderedEventsHelper(const mqbi::DispatcherClient* client)
+    : d_client_p(client)
+    , d_nextSequenceNumber(0)
+    , d_numOutOfOrder(0)
+    , d_numWrongThread(0)
+    , d_lastThreadId(bslmt::ThreadUtil::selfId())
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Record the delivery of the event having the specified
+    /// `sequenceNumber`, and keep the processor busy for the specified
+    /// `busyTimeNs`.
+    void onEvent(int sequenceNumber, bsls::Types::Int64 busyTimeNs)
+    {
+        if (sequenceNumber != d_nextSequenceNumber) {
+            ++d_numOutOfOrder;
+        }
+        d_nextSequenceNumber = sequenceNumber + 1;
+
+        if (!d_client_p->inDispatcherThread()) {
+            ++d_numWrongThread;
+        }
+        d_lastThreadId = bslmt::ThreadUtil::selfId();
+
+        const bsls::Types::Int64 end = bmqu::Time::highResolutionTimer() +
+                                       busyTimeNs;
+        while (bmqu::Time::highResolutionTimer() < end) {
+            // Busy wait
+        }
+    }
+};
+
+/// Post to the specified `client` registered to the specified `dispatcher`
+/// the specified `numEvents` events, having consecutive sequence numbers
+/// starting at the specified `firstSequenceNumber`, and recorded by the
+/// specified `helper` which keeps the processor busy for the specified
+/// `busyTimeNs` for each of them.
+static void postOrderedEvents(mqba::Dispatcher*       dispatcher,
+                              mqbi::DispatcherClient* client,
+                              OrderedEventsHelper*    helper,
+                              int                     firstSequenceNumber,
+                              int                     numEvents,
+                              bsls::Types::Int64      busyTimeNs)
+{
+    for (int i = 0; i < numEvents; ++i) {
+        dispatcher->execute(
+            bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                                  &OrderedEventsHelper::onEvent,
+                                  helper,
+                                  firstSequenceNumber + i,
+                                  busyTimeNs),
+            client,
+            mqbi::DispatcherEventType::e_CALLBACK);
+    }
+}
+
+/// A helper recording the latency of the events delivered to a client.
+struct LatencyRecorder {
+    // DATA
+    bsl::vector<bsls::Types::Int64> d_latencies;
+
+    // CREATORS
+    explicit LatencyRecorder(bslma::Allocator* allocator)
+    : d_latencies(allocator)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Record the latency of the event posted at the specified `postTime`,
+    /// and keep the processor busy for the specified `busyTimeNs`.
+    void onEvent(bsls::Types::Int64 postTime, bsls::Types::Int64 busyTimeNs)
+    {
+        const bsls::Types::Int64 now = bmqu::Time::highResolutionTimer();
+        d_latencies.push_back(now - postTime);
+
+        const bsls::Types::Int64 end = now + busyTimeNs;
+        while (bmqu::Time::highResolutionTimer() < end) {
+            // Busy wait
+        }
+    }
+};
+
+/// Post to the specified `client` registered to the specified `dispatcher`
+/// the specified `numEvents` events, one every specified `intervalNs`,
+/// recorded by the specified `recorder` which keeps the processor busy for
+/// the specified `busyTimeNs` for each of them.  Wait on the specified
+/// `barrier` before starting.
+static void postPacedEvents(mqba::Dispatcher*       dispatcher,
+                            mqbi::DispatcherClient* client,
+                            LatencyRecorder*        recorder,
+                            int                     numEvents,
+                            bsls::Types::Int64      intervalNs,
+                            bsls::Types::Int64      busyTimeNs,
+                            bslmt::Barrier*         barrier)
+{
+    barrier->wait();
+
+    bsls::Types::Int64 nextPostTime = bmqu::Time::highResolutionTimer();
+    for (int i = 0; i < numEvents; ++i) {
+        while (bmqu::Time::highResolutionTimer() < nextPostTime) {
+            // Busy wait
+        }
+        dispatcher->execute(
+            bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                                  &LatencyRecorder::onEvent,
+                                  recorder,
+                                  bmqu::Time::highResolutionTimer(),
+                                  busyTimeNs),
+            client,
+            mqbi::DispatcherEventType::e_CALLBACK);
+        nextPostTime += intervalNs;
+    }
+}
+
+/// A helper recording, for each event delivered to a client, the number of
+/// times the client was flushed before the event.
+struct FlushCountRecorder {
+    // DATA
+    const TestDispatcherClient* d_client_p;
+    bsl::vector<int>            d_numFlushes;
+
+    // CREATORS
+    FlushCountRecorder(const TestDispatcherClient* client,
+                       bslma::Allocator*           allocator)
+    : d_client_p(client)
+    , d_numFlushes(allocator)
+    {
+    }
+
+    // MANIPULATORS
+    void onEvent() { d_numFlushes.push_back(d_client_p->numFlushes()); }
+};
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -694,6 +857,406 @@ static void test5_executeOnAllQueues()
     eventScheduler.stop();
 }
 
+static void test6_rebalancing()
+// ------------------------------------------------------------------------
+// REBALANCING
+//
+// Concerns:
+//   - A rebalancing round migrates a migratable client from the busiest
+//     processor to the least busy one.
+//   - Events for a client being migrated are delivered in order, from the
+//     processor associated to the client, including the events enqueued
+//     concurrently to the migration.
+//
+// Plan:
+//   - Create a dispatcher with two queue processors and rebalancing
+//     enabled, and register two migratable clients to the first processor.
+//   - Load the first processor, then perform a rebalancing round while
+//     events are being posted to both clients.
+//   - Verify that one client was migrated to the second processor, and
+//     that all events were delivered in order, from the right thread.
+//
+// Testing:
+//   mqba::Dispatcher::rebalance
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("REBALANCING");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    const mqbi::DispatcherClientType::Enum k_QUEUE =
+        mqbi::DispatcherClientType::e_QUEUE;
+    const int                k_NUM_EVENTS = 500;
+    const bsls::Types::Int64 k_BUSY_TIME_NS =
+        20 * bdlt::TimeUnitRatio::k_NS_PER_US;
+
+    // Create and start scheduler
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         alloc);
+    eventScheduler.start();
+
+    {
+        // Create dispatcher config with two queue processors, and an interval
+        // long enough for the rebalancing rounds to only be the ones
+        // explicitly triggered by this test.
+        mqbcfg::DispatcherConfig config       = makeConfig();
+        config.queues().numProcessors()       = 2;
+        config.queues().rebalanceIntervalMs() = 3600 * 1000;
+
+        // Create Dispatcher
+        bsl::shared_ptr<bmqst::StatContext> statContext =
+            mqbstat::DispatcherStatsUtil::initializeStatContext(0, alloc);
+        mqba::Dispatcher dispatcher(config,
+                                    statContext.get(),
+                                    &eventScheduler,
+                                    alloc);
+
+        // Start the dispatcher
+        bsl::stringstream startErr(alloc);
+        const int         rc = dispatcher.start(startErr);
+        BMQTST_ASSERT_EQ(rc, 0);
+
+        // Register two migratable clients to the first processor
+        TestDispatcherClient client1(&dispatcher);
+        TestDispatcherClient client2(&dispatcher);
+        client1.dispatcherClientData().setMigratable(true);
+        client2.dispatcherClientData().setMigratable(true);
+        dispatcher.registerClient(&client1, k_QUEUE, 0);
+        dispatcher.registerClient(&client2, k_QUEUE, 0);
+
+        OrderedEventsHelper helper1(&client1);
+        OrderedEventsHelper helper2(&client2);
+
+        PV(":: No load: no migration");
+        BMQTST_ASSERT(!dispatcher.rebalance(k_QUEUE));
+        BMQTST_ASSERT(
+            !dispatcher.rebalance(mqbi::DispatcherClientType::e_SESSION));
+
+        PV(":: Load the first processor");
+        postOrderedEvents(&dispatcher,
+                          &client1,
+                          &helper1,
+                          0,
+                          k_NUM_EVENTS,
+                          k_BUSY_TIME_NS);
+        postOrderedEvents(&dispatcher,
+                          &client2,
+                          &helper2,
+                          0,
+                          k_NUM_EVENTS,
+                          k_BUSY_TIME_NS);
+        dispatcher.synchronize(&client1);
+        dispatcher.synchronize(&client2);
+
+        PV(":: Rebalance while posting events");
+        bslmt::ThreadGroup threadGroup(alloc);
+        int                rc1 = threadGroup.addThread(
+            bdlf::BindUtil::bindS(alloc,
+                                  &postOrderedEvents,
+                                  &dispatcher,
+                                  &client1,
+                                  &helper1,
+                                  k_NUM_EVENTS,
+                                  k_NUM_EVENTS,
+                                  k_BUSY_TIME_NS));
+        BSLS_ASSERT_OPT(rc1 == 0);
+        int rc2 = threadGroup.addThread(
+            bdlf::BindUtil::bindS(alloc,
+                                  &postOrderedEvents,
+                                  &dispatcher,
+                                  &client2,
+                                  &helper2,
+                                  k_NUM_EVENTS,
+                                  k_NUM_EVENTS,
+                                  k_BUSY_TIME_NS));
+        BSLS_ASSERT_OPT(rc2 == 0);
+
+        BMQTST_ASSERT(dispatcher.rebalance(k_QUEUE));
+
+        threadGroup.joinAll();
+        dispatcher.synchronize(&client1);
+        dispatcher.synchronize(&client2);
+
+        PV(":: Verify one client was migrated, and events were in order");
+        const int handle1 = client1.dispatcherClientData().processorHandle();
+        const int handle2 = client2.dispatcherClientData().processorHandle();
+        BMQTST_ASSERT_EQ(handle1 + handle2, 1);
+        BMQTST_ASSERT(helper1.d_lastThreadId != helper2.d_lastThreadId);
+
+        BMQTST_ASSERT_EQ(helper1.d_nextSequenceNumber, 2 * k_NUM_EVENTS);
+        BMQTST_ASSERT_EQ(helper2.d_nextSequenceNumber, 2 * k_NUM_EVENTS);
+        BMQTST_ASSERT_EQ(helper1.d_numOutOfOrder, 0);
+        BMQTST_ASSERT_EQ(helper2.d_numOutOfOrder, 0);
+        BMQTST_ASSERT_EQ(helper1.d_numWrongThread, 0);
+        BMQTST_ASSERT_EQ(helper2.d_numWrongThread, 0);
+
+        dispatcher.unregisterClient(&client1);
+        dispatcher.unregisterClient(&client2);
+        dispatcher.stop();
+    }
+
+    eventScheduler.stop();
+}
+
+static void test7_ringBufferQueues()
+// ------------------------------------------------------------------------
+// RING BUFFER QUEUES
+//
+// Concerns:
+//   - The dispatcher can use ring buffer queues for its processors.
+//   - Posting more events than the capacity of the queue of a processor
+//     blocks until the queue has space available, and all the events are
+//     delivered in order.
+//
+// Plan:
+//   - Create a dispatcher using small ring buffer queues, and post many
+//     events to a client.
+//   - Verify that all events were delivered in order.
+//
+// Testing:
+//   mqbcfg::DispatcherQueueType::E_RING_BUFFER
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("RING BUFFER QUEUES");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    const int                k_NUM_EVENTS = 500;
+    const bsls::Types::Int64 k_BUSY_TIME_NS =
+        2 * bdlt::TimeUnitRatio::k_NS_PER_US;
+
+    // Create and start scheduler
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         alloc);
+    eventScheduler.start();
+
+    {
+        // Create dispatcher config with ring buffer queues much smaller than
+        // the number of events posted
+        mqbcfg::DispatcherConfig config = makeConfig();
+        config.processorQueueType() =
+            mqbcfg::DispatcherQueueType::E_RING_BUFFER;
+        config.queues().processorConfig().queueSize()              = 8;
+        config.queues().processorConfig().queueSizeHighWatermark() = 8;
+
+        // Create Dispatcher
+        bsl::shared_ptr<bmqst::StatContext> statContext =
+            mqbstat::DispatcherStatsUtil::initializeStatContext(0, alloc);
+        mqba::Dispatcher dispatcher(config,
+                                    statContext.get(),
+                                    &eventScheduler,
+                                    alloc);
+
+        // Start the dispatcher
+        bsl::stringstream startErr(alloc);
+        const int         rc = dispatcher.start(startErr);
+        BMQTST_ASSERT_EQ(rc, 0);
+
+        TestDispatcherClient client(&dispatcher);
+        dispatcher.registerClient(&client,
+                                  mqbi::DispatcherClientType::e_QUEUE,
+                                  0);
+
+        OrderedEventsHelper helper(&client);
+        postOrderedEvents(&dispatcher,
+                          &client,
+                          &helper,
+                          0,
+                          k_NUM_EVENTS,
+                          k_BUSY_TIME_NS);
+        dispatcher.synchronize(&client);
+
+        BMQTST_ASSERT_EQ(helper.d_nextSequenceNumber, k_NUM_EVENTS);
+        BMQTST_ASSERT_EQ(helper.d_numOutOfOrder, 0);
+        BMQTST_ASSERT_EQ(helper.d_numWrongThread, 0);
+
+        dispatcher.unregisterClient(&client);
+        dispatcher.stop();
+    }
+
+    eventScheduler.stop();
+}
+
+static void test8_batchedFlush()
+// ------------------------------------------------------------------------
+// BATCHED FLUSH
+//
+// Concerns:
+//   - When a maximum batch size is configured, a processor whose queue is
+//     never empty flushes the clients after every batch of that many
+//     events, instead of only once its queue is drained.
+//
+// Plan:
+//   - Create a dispatcher having a maximum batch size for its queue
+//     processors, block the processor of a client, post many events to
+//     the client and then unblock the processor.
+//   - Verify that each event observed the number of flushes of the client
+//     expected from its position in the queue.
+//
+// Testing:
+//   mqbcfg::DispatcherProcessorParameters::maxBatchSize
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BATCHED FLUSH");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    const int k_MAX_BATCH_SIZE = 4;
+    const int k_NUM_EVENTS     = 5 * k_MAX_BATCH_SIZE + 2;
+
+    // Create and start scheduler
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         alloc);
+    eventScheduler.start();
+
+    {
+        mqbcfg::DispatcherConfig config = makeConfig();
+        config.queues().processorConfig().maxBatchSize() = k_MAX_BATCH_SIZE;
+
+        // Create Dispatcher
+        bsl::shared_ptr<bmqst::StatContext> statContext =
+            mqbstat::DispatcherStatsUtil::initializeStatContext(0, alloc);
+        mqba::Dispatcher dispatcher(config,
+                                    statContext.get(),
+                                    &eventScheduler,
+                                    alloc);
+
+        // Start the dispatcher
+        bsl::stringstream startErr(alloc);
+        const int         rc = dispatcher.start(startErr);
+        BMQTST_ASSERT_EQ(rc, 0);
+
+        TestDispatcherClient client(&dispatcher);
+        dispatcher.registerClient(&client,
+                                  mqbi::DispatcherClientType::e_QUEUE,
+                                  0);
+
+        // Block the processor so that all the events below are enqueued
+        // before the first one is processed.
+        bslmt::Semaphore startedSignal;
+        bslmt::Semaphore continueSignal;
+        dispatcher.execute(bdlf::BindUtil::bind(Synchronize(),
+                                                &startedSignal,
+                                                &continueSignal),
+                           &client,
+                           mqbi::DispatcherEventType::e_CALLBACK);
+        startedSignal.wait();
+
+        const int          numFlushesBefore = client.numFlushes();
+        FlushCountRecorder recorder(&client, alloc);
+        for (int i = 0; i < k_NUM_EVENTS; ++i) {
+            dispatcher.execute(
+                bdlf::BindUtil::bindS(alloc,
+                                      &FlushCountRecorder::onEvent,
+                                      &recorder),
+                &client,
+                mqbi::DispatcherEventType::e_CALLBACK);
+        }
+
+        continueSignal.post();
+        dispatcher.synchronize(&client);
+
+        // The blocking event is the first event of the first batch, so the
+        // event at index 'i' is the event at position 'i + 1' in the queue.
+        BMQTST_ASSERT_EQ(recorder.d_numFlushes.size(),
+                         static_cast<size_t>(k_NUM_EVENTS));
+        for (int i = 0; i < k_NUM_EVENTS; ++i) {
+            BMQTST_ASSERT_EQ_D(i,
+                               recorder.d_numFlushes[i] - numFlushesBefore,
+                               (i + 1) / k_MAX_BATCH_SIZE);
+        }
+
+        dispatcher.unregisterClient(&client);
+        dispatcher.stop();
+    }
+
+    eventScheduler.stop();
+}
+
+static void test9_cpuAffinity()
+// ------------------------------------------------------------------------
+// CPU AFFINITY
+//
+// Concerns:
+//   - When CPUs are configured for the processors of a client type, each
+//     processor of that type is pinned to its CPU once the dispatcher is
+//     started.
+//
+// Plan:
+//   - Create a dispatcher having two queue processors pinned to the CPU
+//     the test driver is running on (which is necessarily available to
+//     this process), and verify that events delivered to a client of each
+//     processor are executed on that CPU.
+//
+// Testing:
+//   mqbcfg::DispatcherProcessorConfig::firstCpu
+//   mqbcfg::DispatcherProcessorConfig::numCpus
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("CPU AFFINITY");
+
+    if (!mqbu::ThreadUtil::isCpuAffinitySupported()) {
+        PV("Pinning threads is not supported on this platform");
+        return;  // RETURN
+    }
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    const int k_NUM_PROCESSORS = 2;
+    const int k_CPU            = mqbu::ThreadUtil::currentCpu();
+    BMQTST_ASSERT_GE(k_CPU, 0);
+
+    // Create and start scheduler
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         alloc);
+    eventScheduler.start();
+
+    {
+        mqbcfg::DispatcherConfig config = makeConfig();
+        config.queues().numProcessors() = k_NUM_PROCESSORS;
+        config.queues().firstCpu()      = k_CPU;
+        config.queues().numCpus()       = 1;
+
+        // Create Dispatcher
+        bsl::shared_ptr<bmqst::StatContext> statContext =
+            mqbstat::DispatcherStatsUtil::initializeStatContext(0, alloc);
+        mqba::Dispatcher dispatcher(config,
+                                    statContext.get(),
+                                    &eventScheduler,
+                                    alloc);
+
+        // Start the dispatcher
+        bsl::stringstream startErr(alloc);
+        const int         rc = dispatcher.start(startErr);
+        BMQTST_ASSERT_EQ(rc, 0);
+
+        for (int i = 0; i < k_NUM_PROCESSORS; ++i) {
+            TestDispatcherClient client(&dispatcher);
+            dispatcher.registerClient(&client,
+                                      mqbi::DispatcherClientType::e_QUEUE,
+                                      i);
+            BMQTST_ASSERT_EQ_D(
+                i,
+                client.dispatcherClientData().processorHandle(),
+                i);
+
+            int cpu = -1;
+            dispatcher.execute(bdlf::BindUtil::bind(&loadCurrentCpu, &cpu),
+                               &client,
+                               mqbi::DispatcherEventType::e_CALLBACK);
+            dispatcher.synchronize(&client);
+
+            BMQTST_ASSERT_EQ_D(i, cpu, k_CPU);
+
+            dispatcher.unregisterClient(&client);
+        }
+
+        dispatcher.stop();
+    }
+
+    eventScheduler.stop();
+}
+
 static void testN1_inDispatcherThread()
 {
     const size_t k_ITERS_NUM = 10000000;
@@ -767,6 +1330,135 @@ static void testN1_inDispatcherThread()
     eventScheduler.stop();
 }
 
+static void testN2_rebalancingSkewedLoad()
+// ------------------------------------------------------------------------
+// REBALANCING WITH SKEWED LOAD
+//
+// Concerns:
+//   Measure the latency of the events delivered to clients which all happen
+//   to be associated to the same processor, with and without rebalancing.
+//
+// Plan:
+//   - Register hot clients to the first of several queue processors.
+//   - Have one thread per client post events at a fixed rate, the combined
+//     rate exceeding the capacity of a single processor.
+//   - Report the latency percentiles of the events, with rebalancing
+//     disabled and enabled.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("REBALANCING WITH SKEWED LOAD");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    const int                k_NUM_PROCESSORS  = 4;
+    const int                k_NUM_HOT_CLIENTS = 4;
+    const int                k_NUM_EVENTS      = 200000;
+    const bsls::Types::Int64 k_BUSY_TIME_NS =
+        4 * bdlt::TimeUnitRatio::k_NS_PER_US;
+    const bsls::Types::Int64 k_INTERVAL_NS =
+        10 * bdlt::TimeUnitRatio::k_NS_PER_US;
+
+    // Create and start scheduler
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         alloc);
+    eventScheduler.start();
+
+    for (int rebalancing = 0; rebalancing < 2; ++rebalancing) {
+        mqbcfg::DispatcherConfig config       = makeConfig();
+        config.queues().numProcessors()       = k_NUM_PROCESSORS;
+        config.queues().rebalanceIntervalMs() = rebalancing ? 10 : 0;
+
+        bsl::shared_ptr<bmqst::StatContext> statContext =
+            mqbstat::DispatcherStatsUtil::initializeStatContext(0, alloc);
+        mqba::Dispatcher dispatcher(config,
+                                    statContext.get(),
+                                    &eventScheduler,
+                                    alloc);
+
+        bsl::stringstream startErr(alloc);
+        const int         rc = dispatcher.start(startErr);
+        BSLS_ASSERT_OPT(rc == 0);
+
+        // Skew: all the hot clients are associated to the first processor
+        bsl::vector<bsl::shared_ptr<TestDispatcherClient> > clients(alloc);
+        bsl::vector<bsl::shared_ptr<LatencyRecorder> >      recorders(alloc);
+        for (int i = 0; i < k_NUM_HOT_CLIENTS; ++i) {
+            clients.push_back(
+                bsl::allocate_shared<TestDispatcherClient>(alloc,
+                                                           &dispatcher));
+            clients.back()->dispatcherClientData().setMigratable(true);
+            dispatcher.registerClient(clients.back().get(),
+                                      mqbi::DispatcherClientType::e_QUEUE,
+                                      0);
+
+            recorders.push_back(
+                bsl::allocate_shared<LatencyRecorder>(alloc, alloc));
+            recorders.back()->d_latencies.reserve(k_NUM_EVENTS);
+        }
+
+        bslmt::ThreadGroup threadGroup(alloc);
+        bslmt::Barrier     barrier(k_NUM_HOT_CLIENTS + 1);
+        for (int i = 0; i < k_NUM_HOT_CLIENTS; ++i) {
+            int rcThread = threadGroup.addThread(
+                bdlf::BindUtil::bindS(alloc,
+                                      &postPacedEvents,
+                                      &dispatcher,
+                                      clients[i].get(),
+                                      recorders[i].get(),
+                                      k_NUM_EVENTS,
+                                      k_INTERVAL_NS,
+                                      k_BUSY_TIME_NS,
+                                      &barrier));
+            BSLS_ASSERT_OPT(rcThread == 0);
+        }
+
+        const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+        barrier.wait();
+        threadGroup.joinAll();
+
+        bsl::vector<bsls::Types::Int64> latencies(alloc);
+        latencies.reserve(k_NUM_HOT_CLIENTS * k_NUM_EVENTS);
+        for (int i = 0; i < k_NUM_HOT_CLIENTS; ++i) {
+            dispatcher.synchronize(clients[i].get());
+            latencies.insert(latencies.end(),
+                             recorders[i]->d_latencies.begin(),
+                             recorders[i]->d_latencies.end());
+        }
+        const bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+
+        bsl::sort(latencies.begin(), latencies.end());
+        const size_t n = latencies.size();
+
+        bsl::cout << "Rebalancing " << (rebalancing ? "enabled" : "disabled")
+                  << ":" << bsl::endl;
+        bsl::cout << "       total: "
+                  << bmqu::PrintUtil::prettyTimeInterval(end - begin) << " ("
+                  << n << " events)" << bsl::endl;
+        bsl::cout << "         p50: "
+                  << bmqu::PrintUtil::prettyTimeInterval(latencies[n / 2])
+                  << bsl::endl;
+        bsl::cout << "         p99: "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         latencies[n * 99 / 100])
+                  << bsl::endl;
+        bsl::cout << "       p99.9: "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         latencies[n * 999 / 1000])
+                  << bsl::endl;
+        bsl::cout << "         max: "
+                  << bmqu::PrintUtil::prettyTimeInterval(latencies[n - 1])
+                  << bsl::endl;
+        bsl::cout << bsl::endl;
+
+        for (int i = 0; i < k_NUM_HOT_CLIENTS; ++i) {
+            dispatcher.unregisterClient(clients[i].get());
+        }
+        dispatcher.stop();
+    }
+
+    eventScheduler.stop();
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -779,12 +1471,17 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 9: test9_cpuAffinity(); break;
+    case 8: test8_batchedFlush(); break;
+    case 7: test7_ringBufferQueues(); break;
+    case 6: test6_rebalancing(); break;
     case 5: test5_executeOnAllQueues(); break;
     case 4: test4_eventSource(); break;
     case 3: test3_executorsSupport(); break;
     case 2: test2_clientTypeEnumValues(); break;
     case 1: test1_breathingTest(); break;
     case -1: testN1_inDispatcherThread(); break;
+    case -2: testN2_rebalancingSkewedLoad(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
@@ -0,0 +1,449 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MQBA_DISPATCHEREVENTPOOL
+#define INCLUDED_MQBA_DISPATCHEREVENTPOOL
+
+//@PURPOSE: Provide a pool of recycled, intrusively counted dispatcher events.
+//
+//@CLASSES:
+//  mqba::DispatcherEventPool: pool of dispatcher events of one type
+//
+//@SEE_ALSO: mqba::DispatcherEventSource, bdlcc_sharedobjectpool
+//
+//@DESCRIPTION: This component defines a mechanism,
+// 'mqba::DispatcherEventPool', which is a pool of dispatcher events of the
+// parameterized 'EVENT_TYPE', handed out as 'bsl::shared_ptr' (the type of
+// event used by the dispatcher and its clients).
+//
+// Each node of the pool is the shared pointer representation of its event:
+// it holds the event along with its reference counts, and the link to the
+// next node when it is in a free list of the pool.  The reference counting
+// of an event is therefore intrusive: getting an event only resets the
+// counts of its node, and releasing the last reference to an event resets it
+// (see 'mqbi::DispatcherEvent::reset') and pushes its node back to the pool.
+// Neither allocates memory, once the pool has grown to the steady-state
+// number of events in flight.  Nodes are allocated by blocks of the number
+// of events specified at construction, and are only freed when the pool is
+// destroyed.
+//
+// Contrary to 'bdlcc::SharedObjectPool', the pool does not keep per-node
+// reference counts of its own to make its free list safe to pop concurrently:
+// the events released by any thread are pushed to a lock-free list with a
+// single compare-and-swap, which the getters take over as a whole, with a
+// single atomic exchange, when the list of events available to them is
+// empty.  The latter list is protected by a spin lock, which is uncontended
+// when the events are mostly got from a single thread, as is the case for
+// the event source of a dispatcher processor.
+//
+/// Thread Safety
+///-------------
+// Thread safe.  Events may be got from, and released by, any thread.
+//
+/// Usage
+///-----
+//..
+//  mqba::DispatcherEventPool<mqbevt::PutEvent> pool(1024, allocator);
+//
+//  bsl::shared_ptr<mqbevt::PutEvent> event = pool.getObject();
+//  // ... populate and dispatch the event ...
+//
+//  event.reset();  // the event is reset and recycled by the pool
+//..
+
+// BDE
+#include <bsl_memory.h>
+#include <bsl_typeinfo.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_sharedptrrep.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_performancehint.h>
+#include <bsls_spinlock.h>
+
+namespace BloombergLP {
+namespace mqba {
+
+// FORWARD DECLARATIONS
+template <class EVENT_TYPE>
+class DispatcherEventPool;
+
+// ==============================
+// class DispatcherEventPool_Node
+// ==============================
+
+/// Node of a `DispatcherEventPool`: shared pointer representation holding
+/// an event of the parameterized `EVENT_TYPE`.
+template <class EVENT_TYPE>
+class DispatcherEventPool_Node BSLS_KEYWORD_FINAL
+: public bslma::SharedPtrRep {
+  private:
+    // DATA
+
+    /// The event.
+    bsls::ObjectBuffer<EVENT_TYPE> d_event;
+
+    /// Pool this node belongs to.
+    DispatcherEventPool<EVENT_TYPE>* d_pool_p;
+
+    /// Next node in the free list of the pool holding this node, if any.
+    DispatcherEventPool_Node* d_next_p;
+
+  private:
+    // NOT IMPLEMENTED
+    DispatcherEventPool_Node(const DispatcherEventPool_Node&)
+        BSLS_KEYWORD_DELETED;
+    DispatcherEventPool_Node&
+    operator=(const DispatcherEventPool_Node&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create a node of the specified `pool`, holding an event created with
+    /// the specified `allocator`.
+    DispatcherEventPool_Node(DispatcherEventPool<EVENT_TYPE>* pool,
+                             bslma::Allocator*                allocator);
+
+    /// Destroy this node and the event it holds.
+    ~DispatcherEventPool_Node();
+
+    // MANIPULATORS
+
+    /// Reset the event held by this node.  This method is invoked when the
+    /// last shared reference to the event is released.
+    void disposeObject() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return this node to its pool.  This method is invoked when the last
+    /// (shared or weak) reference to the event is released.
+    void disposeRep() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return 0: the events of a pool have no deleter.
+    void* getDeleter(const std::type_info& type) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the address of the event held by this node.
+    EVENT_TYPE* event();
+
+    /// Set the next node in the free list holding this node to the
+    /// specified `next`.
+    void setNext(DispatcherEventPool_Node* next);
+
+    // ACCESSORS
+
+    /// Return the address of the event held by this node.
+    void* originalPtr() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the next node in the free list holding this node.
+    DispatcherEventPool_Node* next() const;
+};
+
+// =========================
+// class DispatcherEventPool
+// =========================
+
+/// Pool of recycled dispatcher events of the parameterized `EVENT_TYPE`,
+/// with intrusive reference counting.
+template <class EVENT_TYPE>
+class DispatcherEventPool {
+  private:
+    // PRIVATE TYPES
+    typedef DispatcherEventPool_Node<EVENT_TYPE> Node;
+
+    // FRIENDS
+    friend class DispatcherEventPool_Node<EVENT_TYPE>;
+
+    // DATA
+
+    /// Spin lock protecting `d_available_p` and `d_blocks`.
+    mutable bsls::SpinLock d_lock;
+
+    /// Free list of the nodes available to the getters.
+    Node* d_available_p;
+
+    /// Free list of the nodes released since `d_available_p` was last
+    /// replenished.
+    bsls::AtomicPointer<Node> d_released;
+
+    /// Number of nodes to allocate when the pool is exhausted.
+    const int d_growBy;
+
+    /// Blocks of nodes allocated by this pool.
+    bsl::vector<Node*> d_blocks;
+
+    /// Number of nodes allocated by this pool.
+    bsls::AtomicInt d_numObjects;
+
+    /// Allocator used to supply memory.
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    // NOT IMPLEMENTED
+    DispatcherEventPool(const DispatcherEventPool&) BSLS_KEYWORD_DELETED;
+    DispatcherEventPool&
+    operator=(const DispatcherEventPool&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE MANIPULATORS
+
+    /// Allocate a block of `d_growBy` nodes and make them available.  The
+    /// behavior is undefined unless `d_lock` is locked and `d_available_p`
+    /// is empty.
+    void grow();
+
+    /// Return the specified `node` to this pool.
+    void release(Node* node);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DispatcherEventPool,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a pool allocating events by blocks of the specified `growBy`
+    /// number of events.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.  The behavior is undefined unless
+    /// `0 < growBy`.
+    explicit DispatcherEventPool(int               growBy,
+                                 bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this pool and all the events it allocated.  The behavior is
+    /// undefined unless all the events got from this pool were released.
+    ~DispatcherEventPool();
+
+    // MANIPULATORS
+
+    /// Return a shared pointer to an event from this pool, in its default
+    /// (reset) state.
+    bsl::shared_ptr<EVENT_TYPE> getObject();
+
+    // ACCESSORS
+
+    /// Return the number of events allocated by this pool.
+    int numObjects() const;
+
+    /// Return the number of events allocated by this pool which are not in
+    /// use.  Note that this method walks the free lists of this pool, and is
+    /// intended for testing and diagnostics only.
+    int numAvailableObjects() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ------------------------------
+// class DispatcherEventPool_Node
+// ------------------------------
+
+// CREATORS
+template <class EVENT_TYPE>
+inline DispatcherEventPool_Node<EVENT_TYPE>::DispatcherEventPool_Node(
+    DispatcherEventPool<EVENT_TYPE>* pool,
+    bslma::Allocator*                allocator)
+: d_pool_p(pool)
+, d_next_p(0)
+{
+    bslma::ConstructionUtil::construct(d_event.address(), allocator);
+}
+
+template <class EVENT_TYPE>
+inline DispatcherEventPool_Node<EVENT_TYPE>::~DispatcherEventPool_Node()
+{
+    d_event.object().~EVENT_TYPE();
+}
+
+// MANIPULATORS
+template <class EVENT_TYPE>
+inline void DispatcherEventPool_Node<EVENT_TYPE>::disposeObject()
+{
+    d_event.object().reset();
+}
+
+template <class EVENT_TYPE>
+inline void DispatcherEventPool_Node<EVENT_TYPE>::disposeRep()
+{
+    d_pool_p->release(this);
+}
+
+template <class EVENT_TYPE>
+inline void*
+DispatcherEventPool_Node<EVENT_TYPE>::getDeleter(const std::type_info&)
+{
+    return 0;
+}
+
+template <class EVENT_TYPE>
+inline EVENT_TYPE* DispatcherEventPool_Node<EVENT_TYPE>::event()
+{
+    return d_event.address();
+}
+
+template <class EVENT_TYPE>
+inline void
+DispatcherEventPool_Node<EVENT_TYPE>::setNext(DispatcherEventPool_Node* next)
+{
+    d_next_p = next;
+}
+
+// ACCESSORS
+template <class EVENT_TYPE>
+inline void* DispatcherEventPool_Node<EVENT_TYPE>::originalPtr() const
+{
+    return const_cast<void*>(static_cast<const void*>(d_event.address()));
+}
+
+template <class EVENT_TYPE>
+inline DispatcherEventPool_Node<EVENT_TYPE>*
+DispatcherEventPool_Node<EVENT_TYPE>::next() const
+{
+    return d_next_p;
+}
+
+// -------------------------
+// class DispatcherEventPool
+// -------------------------
+
+// PRIVATE MANIPULATORS
+template <class EVENT_TYPE>
+void DispatcherEventPool<EVENT_TYPE>::grow()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!d_available_p);
+
+    d_blocks.reserve(d_blocks.size() + 1);
+
+    Node* block = static_cast<Node*>(
+        d_allocator_p->allocate(d_growBy * sizeof(Node)));
+    for (int i = 0; i < d_growBy; ++i) {
+        new (block + i) Node(this, d_allocator_p);
+        block[i].setNext(i + 1 < d_growBy ? block + i + 1 : 0);
+    }
+
+    d_blocks.push_back(block);
+    d_available_p = block;
+    d_numObjects.addRelaxed(d_growBy);
+}
+
+template <class EVENT_TYPE>
+inline void DispatcherEventPool<EVENT_TYPE>::release(Node* node)
+{
+    // The list of released nodes is only ever pushed to, or taken over as a
+    // whole, so it is not subject to the ABA problem.
+    Node* head = d_released.loadRelaxed();
+    while (true) {
+        node->setNext(head);
+        Node* const previous = d_released.testAndSwap(head, node);
+        if (previous == head) {
+            break;  // BREAK
+        }
+        head = previous;
+    }
+}
+
+// CREATORS
+template <class EVENT_TYPE>
+DispatcherEventPool<EVENT_TYPE>::DispatcherEventPool(
+    int               growBy,
+    bslma::Allocator* basicAllocator)
+: d_lock(bsls::SpinLock::s_unlocked)
+, d_available_p(0)
+, d_released(0)
+, d_growBy(growBy)
+, d_blocks(basicAllocator)
+, d_numObjects(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 < growBy);
+}
+
+template <class EVENT_TYPE>
+DispatcherEventPool<EVENT_TYPE>::~DispatcherEventPool()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(numAvailableObjects() == numObjects());
+
+    for (size_t i = 0; i < d_blocks.size(); ++i) {
+        Node* block = d_blocks[i];
+        for (int j = 0; j < d_growBy; ++j) {
+            block[j].~Node();
+        }
+        d_allocator_p->deallocate(block);
+    }
+}
+
+// MANIPULATORS
+template <class EVENT_TYPE>
+inline bsl::shared_ptr<EVENT_TYPE> DispatcherEventPool<EVENT_TYPE>::getObject()
+{
+    Node* node;
+    {
+        bsls::SpinLockGuard guard(&d_lock);  // SPINLOCK LOCK
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_available_p)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            // Take over all the nodes released since the available nodes
+            // were last replenished, or grow if there is none.
+            d_available_p = d_released.swap(0);
+            if (!d_available_p) {
+                grow();
+            }
+        }
+
+        node          = d_available_p;
+        d_available_p = node->next();
+    }  // SPINLOCK UNLOCK
+
+    node->resetCountsRaw(1, 0);
+    return bsl::shared_ptr<EVENT_TYPE>(node->event(), node);
+}
+
+// ACCESSORS
+template <class EVENT_TYPE>
+inline int DispatcherEventPool<EVENT_TYPE>::numObjects() const
+{
+    return d_numObjects.loadRelaxed();
+}
+
+template <class EVENT_TYPE>
+int DispatcherEventPool<EVENT_TYPE>::numAvailableObjects() const
+{
+    bsls::SpinLockGuard guard(&d_lock);  // SPINLOCK LOCK
+
+    // Nodes are only removed from the list of released nodes with 'd_lock'
+    // locked, so it can be walked from its current head.
+    int count = 0;
+    for (const Node* node = d_available_p; node; node = node->next()) {
+        ++count;
+    }
+    for (const Node* node = d_released.load(); node; node = node->next()) {
+        ++count;
+    }
+
+    return count;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
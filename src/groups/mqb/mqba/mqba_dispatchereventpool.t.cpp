@@ -0,0 +1,387 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqba_dispatchereventpool.h>
+
+// BMQ
+#include <bmqtst_table.h>
+
+// MQB
+#include <mqbevt_putevent.h>
+
+// BDE
+#include <bdlcc_sharedobjectpool.h>
+#include <bdlf_bind.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Event type used to verify the lifecycle of the events of a pool.
+struct TestEvent {
+    // DATA
+
+    /// Value set by the user of the event, and cleared by `reset`.
+    int d_value;
+
+    /// Number of times this event was reset.
+    int d_numResets;
+
+    /// Allocator this event was created with.
+    bslma::Allocator* d_allocator_p;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TestEvent, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+    explicit TestEvent(bslma::Allocator* allocator)
+    : d_value(0)
+    , d_numResets(0)
+    , d_allocator_p(allocator)
+    {
+    }
+
+    // MANIPULATORS
+    void reset()
+    {
+        d_value = 0;
+        ++d_numResets;
+    }
+};
+
+typedef mqba::DispatcherEventPool<TestEvent> TestPool;
+
+/// Get the specified `numIterations` batches of the specified `batchSize`
+/// events from the specified `pool`, after waiting on the specified
+/// `barrier`, verifying that each event is in its reset state and marking
+/// it as in use, and release the specified `handedOver` events half way.
+/// Increment the specified `numErrors` for each event not in its reset
+/// state.
+void getAndReleaseThread(TestPool*                                 pool,
+                         bsl::vector<bsl::shared_ptr<TestEvent> >* handedOver,
+                         bslmt::Barrier*                           barrier,
+                         bsls::AtomicInt*                          numErrors,
+                         int numIterations,
+                         int batchSize)
+{
+    bsl::vector<bsl::shared_ptr<TestEvent> > events(
+        bmqtst::TestHelperUtil::allocator());
+    events.reserve(batchSize);
+
+    barrier->wait();
+
+    for (int i = 0; i < numIterations; ++i) {
+        for (int j = 0; j < batchSize; ++j) {
+            events.push_back(pool->getObject());
+            if (events.back()->d_value != 0) {
+                ++(*numErrors);
+            }
+            events.back()->d_value = 1;
+        }
+        events.clear();
+
+        if (i == numIterations / 2) {
+            handedOver->clear();
+        }
+    }
+}
+
+template <class POOL>
+double benchmarkPool(POOL* pool, int numIterations, int batchSize)
+{
+    bsl::vector<bsl::shared_ptr<mqbevt::PutEvent> > events(
+        bmqtst::TestHelperUtil::allocator());
+    events.reserve(batchSize);
+
+    bsls::Stopwatch stopwatch;
+    stopwatch.start();
+    for (int i = 0; i < numIterations; ++i) {
+        for (int j = 0; j < batchSize; ++j) {
+            events.push_back(pool->getObject());
+        }
+        events.clear();
+    }
+    stopwatch.stop();
+
+    return stopwatch.elapsedTime() * 1e9 / (numIterations * batchSize);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. Events are created with the allocator of the pool, by blocks of the
+//      specified number of events.
+//   2. Releasing the last reference to an event resets it and makes it
+//      available again, without allocating memory.
+//
+// Testing:
+//   DispatcherEventPool(int, bslma::Allocator *)
+//   getObject()
+//   numObjects()
+//   numAvailableObjects()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    bslma::TestAllocator ta("pool");
+    {
+        TestPool pool(2, &ta);
+
+        BMQTST_ASSERT_EQ(pool.numObjects(), 0);
+        BMQTST_ASSERT_EQ(pool.numAvailableObjects(), 0);
+        BMQTST_ASSERT_EQ(ta.numBlocksInUse(), 0);
+
+        // 1. Grow the pool
+        bsl::shared_ptr<TestEvent> event = pool.getObject();
+        BMQTST_ASSERT(event);
+        BMQTST_ASSERT_EQ(event.use_count(), 1);
+        BMQTST_ASSERT_EQ(event->d_value, 0);
+        BMQTST_ASSERT_EQ(event->d_numResets, 0);
+        BMQTST_ASSERT_EQ(event->d_allocator_p,
+                         static_cast<bslma::Allocator*>(&ta));
+        BMQTST_ASSERT_EQ(pool.numObjects(), 2);
+        BMQTST_ASSERT_EQ(pool.numAvailableObjects(), 1);
+
+        const TestEvent* const address     = event.get();
+        const bsls::Types::Int64 numAllocs = ta.numAllocations();
+        event->d_value                     = 42;
+
+        // 2. Release and get the event back
+        event.reset();
+        BMQTST_ASSERT_EQ(pool.numAvailableObjects(), 2);
+
+        bsl::shared_ptr<TestEvent> first  = pool.getObject();
+        bsl::shared_ptr<TestEvent> second = pool.getObject();
+        BMQTST_ASSERT_NE(first.get(), second.get());
+        BMQTST_ASSERT(first.get() == address || second.get() == address);
+
+        const TestEvent* recycled = first.get() == address ? first.get()
+                                                           : second.get();
+        BMQTST_ASSERT_EQ(recycled->d_value, 0);
+        BMQTST_ASSERT_EQ(recycled->d_numResets, 1);
+        BMQTST_ASSERT_EQ(ta.numAllocations(), numAllocs);
+        BMQTST_ASSERT_EQ(pool.numAvailableObjects(), 0);
+
+        // Exhausting the pool grows it by another block
+        bsl::shared_ptr<TestEvent> third = pool.getObject();
+        BMQTST_ASSERT_EQ(pool.numObjects(), 4);
+        BMQTST_ASSERT_EQ(pool.numAvailableObjects(), 1);
+    }
+    BMQTST_ASSERT_EQ(ta.numBlocksInUse(), 0);
+}
+
+static void test2_sharedAndWeakReferences()
+// ------------------------------------------------------------------------
+// SHARED AND WEAK REFERENCES
+//
+// Concerns:
+//   1. An event is reset when its last shared reference is released, and
+//      is recycled only when its last weak reference is released.
+//   2. Copies of, and aliases to, an event keep it in use.
+//
+// Testing:
+//   getObject()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("SHARED AND WEAK REFERENCES");
+
+    TestPool pool(1, bmqtst::TestHelperUtil::allocator());
+
+    bsl::shared_ptr<TestEvent> event = pool.getObject();
+    event->d_value                   = 42;
+
+    // 2. Copies and aliases
+    bsl::shared_ptr<TestEvent> copy = event;
+    bsl::shared_ptr<int>       alias(event, &event->d_value);
+    BMQTST_ASSERT_EQ(event.use_count(), 3);
+
+    event.reset();
+    copy.reset();
+    BMQTST_ASSERT_EQ(*alias, 42);
+    BMQTST_ASSERT_EQ(pool.numAvailableObjects(), 0);
+
+    // 1. Weak references
+    bsl::weak_ptr<int> weak(alias);
+    alias.reset();
+    BMQTST_ASSERT(weak.expired());
+    BMQTST_ASSERT_EQ(pool.numAvailableObjects(), 0);
+
+    weak.reset();
+    BMQTST_ASSERT_EQ(pool.numAvailableObjects(), 1);
+
+    event = pool.getObject();
+    BMQTST_ASSERT_EQ(pool.numObjects(), 1);
+    BMQTST_ASSERT_EQ(event->d_value, 0);
+    BMQTST_ASSERT_EQ(event->d_numResets, 1);
+}
+
+static void test3_concurrentGetAndRelease()
+// ------------------------------------------------------------------------
+// CONCURRENT GET AND RELEASE
+//
+// Concerns:
+//   1. Events got concurrently from multiple threads are never handed out
+//      twice.
+//   2. Events may be released by a thread other than the one which got
+//      them.
+//   3. All the events are available once released.
+//
+// Testing:
+//   getObject()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("CONCURRENT GET AND RELEASE");
+
+    const int k_NUM_THREADS    = 4;
+    const int k_NUM_ITERATIONS = 1000;
+    const int k_BATCH_SIZE     = 100;
+    const int k_NUM_HANDED     = 1000;
+
+    TestPool pool(64, bmqtst::TestHelperUtil::allocator());
+
+    bsl::vector<bsl::vector<bsl::shared_ptr<TestEvent> > > handedOver(
+        k_NUM_THREADS,
+        bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        for (int j = 0; j < k_NUM_HANDED; ++j) {
+            handedOver[i].push_back(pool.getObject());
+        }
+    }
+
+    bslmt::Barrier                         barrier(k_NUM_THREADS);
+    bsls::AtomicInt                        numErrors(0);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(
+        k_NUM_THREADS,
+        bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        BMQTST_ASSERT_EQ(bslmt::ThreadUtil::createWithAllocator(
+                             &handles[i],
+                             bdlf::BindUtil::bind(&getAndReleaseThread,
+                                                  &pool,
+                                                  &handedOver[i],
+                                                  &barrier,
+                                                  &numErrors,
+                                                  k_NUM_ITERATIONS,
+                                                  k_BATCH_SIZE),
+                             bmqtst::TestHelperUtil::allocator()),
+                         0);
+    }
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+
+    BMQTST_ASSERT_EQ(numErrors.load(), 0);
+    BMQTST_ASSERT_EQ(pool.numAvailableObjects(), pool.numObjects());
+    BMQTST_ASSERT_LE(pool.numObjects(),
+                     k_NUM_THREADS * (k_NUM_HANDED + k_BATCH_SIZE + 64));
+}
+
+static void testN1_poolBenchmark()
+// ------------------------------------------------------------------------
+// POOL BENCHMARK
+//
+// Concerns:
+//   Compare the cost of getting and releasing an event with this pool and
+//   with 'bdlcc::SharedObjectPool', in steady state.
+//
+// Testing:
+//   getObject()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("POOL BENCHMARK");
+
+    const int k_NUM_ITERATIONS = 10000;
+    const int k_BATCH_SIZE     = 100;
+
+    typedef bdlcc::SharedObjectPool<
+        mqbevt::PutEvent,
+        bdlcc::ObjectPoolFunctors::DefaultCreator,
+        bdlcc::ObjectPoolFunctors::Reset<mqbevt::PutEvent> >
+        SharedObjectPool;
+
+    mqba::DispatcherEventPool<mqbevt::PutEvent> pool(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    SharedObjectPool sharedObjectPool(1024,
+                                      bmqtst::TestHelperUtil::allocator());
+
+    // Grow the pools
+    benchmarkPool(&pool, 1, k_BATCH_SIZE);
+    benchmarkPool(&sharedObjectPool, 1, k_BATCH_SIZE);
+
+    bmqtst::Table results(bmqtst::TestHelperUtil::allocator());
+
+    results.column("Name").insertValue("mqba::DispatcherEventPool");
+    results.column("get and release, ns/op")
+        .insertValue(bsl::to_string(
+            benchmarkPool(&pool, k_NUM_ITERATIONS, k_BATCH_SIZE)));
+
+    results.column("Name").insertValue("bdlcc::SharedObjectPool");
+    results.column("get and release, ns/op")
+        .insertValue(bsl::to_string(benchmarkPool(&sharedObjectPool,
+                                                  k_NUM_ITERATIONS,
+                                                  k_BATCH_SIZE)));
+
+    results.print(bsl::cout);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_concurrentGetAndRelease(); break;
+    case 2: test2_sharedAndWeakReferences(); break;
+    case 1: test1_breathingTest(); break;
+    case -1: testN1_poolBenchmark(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_GBL_ALLOC);
+}
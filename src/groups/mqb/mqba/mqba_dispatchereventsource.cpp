@@ -46,18 +46,46 @@ BSLS_KEYWORD_CONSTEXPR const int k_POOL_GROW_BY = 1024;
 // --------------------------
 
 DispatcherEventSource::DispatcherEventSource(bslma::Allocator* allocator)
-: d_ackEventPool(k_POOL_GROW_BY, allocator)
-, d_callbackEventPool(k_POOL_GROW_BY, allocator)
-, d_clusterStateEventPool(k_POOL_GROW_BY, allocator)
-, d_confirmEventPool(k_POOL_GROW_BY, allocator)
-, d_controlMessageEventPool(k_POOL_GROW_BY, allocator)
-, d_dispatcherEventPool(k_POOL_GROW_BY, allocator)
-, d_pushEventPool(k_POOL_GROW_BY, allocator)
-, d_putEventPool(k_POOL_GROW_BY, allocator)
-, d_receiptEventPool(k_POOL_GROW_BY, allocator)
-, d_recoveryEventPool(k_POOL_GROW_BY, allocator)
-, d_rejectEventPool(k_POOL_GROW_BY, allocator)
-, d_storageEventPool(k_POOL_GROW_BY, allocator)
+: d_allocators(allocator)
+, d_poolAllocators(allocator)
+, d_ackEventPool(k_POOL_GROW_BY, d_poolAllocators.get("AckEvents"))
+, d_callbackEventPool(k_POOL_GROW_BY, d_poolAllocators.get("CallbackEvents"))
+, d_clusterStateEventPool(k_POOL_GROW_BY,
+                          d_poolAllocators.get("ClusterStateEvents"))
+, d_confirmEventPool(k_POOL_GROW_BY, d_poolAllocators.get("ConfirmEvents"))
+, d_controlMessageEventPool(k_POOL_GROW_BY,
+                            d_poolAllocators.get("ControlMessageEvents"))
+, d_dispatcherEventPool(k_POOL_GROW_BY,
+                        d_poolAllocators.get("DispatcherEvents"))
+, d_pushEventPool(k_POOL_GROW_BY, d_poolAllocators.get("PushEvents"))
+, d_putEventPool(k_POOL_GROW_BY, d_poolAllocators.get("PutEvents"))
+, d_receiptEventPool(k_POOL_GROW_BY, d_poolAllocators.get("ReceiptEvents"))
+, d_recoveryEventPool(k_POOL_GROW_BY, d_poolAllocators.get("RecoveryEvents"))
+, d_rejectEventPool(k_POOL_GROW_BY, d_poolAllocators.get("RejectEvents"))
+, d_storageEventPool(k_POOL_GROW_BY, d_poolAllocators.get("StorageEvents"))
+{
+    // NOTHING
+}
+
+DispatcherEventSource::DispatcherEventSource(const bsl::string& name,
+                                             bslma::Allocator*  allocator)
+: d_allocators(allocator)
+, d_poolAllocators(d_allocators.get(name))
+, d_ackEventPool(k_POOL_GROW_BY, d_poolAllocators.get("AckEvents"))
+, d_callbackEventPool(k_POOL_GROW_BY, d_poolAllocators.get("CallbackEvents"))
+, d_clusterStateEventPool(k_POOL_GROW_BY,
+                          d_poolAllocators.get("ClusterStateEvents"))
+, d_confirmEventPool(k_POOL_GROW_BY, d_poolAllocators.get("ConfirmEvents"))
+, d_controlMessageEventPool(k_POOL_GROW_BY,
+                            d_poolAllocators.get("ControlMessageEvents"))
+, d_dispatcherEventPool(k_POOL_GROW_BY,
+                        d_poolAllocators.get("DispatcherEvents"))
+, d_pushEventPool(k_POOL_GROW_BY, d_poolAllocators.get("PushEvents"))
+, d_putEventPool(k_POOL_GROW_BY, d_poolAllocators.get("PutEvents"))
+, d_receiptEventPool(k_POOL_GROW_BY, d_poolAllocators.get("ReceiptEvents"))
+, d_recoveryEventPool(k_POOL_GROW_BY, d_poolAllocators.get("RecoveryEvents"))
+, d_rejectEventPool(k_POOL_GROW_BY, d_poolAllocators.get("RejectEvents"))
+, d_storageEventPool(k_POOL_GROW_BY, d_poolAllocators.get("StorageEvents"))
 {
     // NOTHING
 }
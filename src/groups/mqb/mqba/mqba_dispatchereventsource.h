@@ -24,8 +24,24 @@
 //@DESCRIPTION: 'mqba::DispatcherEventSource' provides an implementation of
 // the 'mqbi::DispatcherEventSource' interface using object pools to
 // efficiently manage dispatcher event allocation.
+//
+/// Allocations
+///-----------
+// Each type of event has its own 'mqba::DispatcherEventPool', whose nodes
+// are the shared pointer representations of their events: the reference
+// counts of an event are intrusive, and getting an event and releasing the
+// last reference to it respectively pop its node from and push it back to
+// the pool, which resets the event for its next use, without any heap
+// allocation once the pool has grown to the steady-state number of in-flight
+// events.  To verify this, the memory of the pool of each type of event is
+// supplied by a distinct allocator obtained from a
+// 'bmqma::CountingAllocatorStore' (e.g., "PutEvents", "PushEvents"), nested
+// under an allocator having the optionally specified name of the event
+// source: when the event source is created with a 'bmqma::CountingAllocator',
+// the allocations of each pool are reported in the allocator statistics.
 
 // MQB
+#include <mqba_dispatchereventpool.h>
 #include <mqbevt_ackevent.h>
 #include <mqbevt_callbackevent.h>
 #include <mqbevt_clusterstateevent.h>
@@ -40,9 +56,12 @@
 #include <mqbevt_storageevent.h>
 #include <mqbi_dispatchereventsource.h>
 
+// BMQ
+#include <bmqma_countingallocatorstore.h>
+
 // BDE
-#include <bdlcc_sharedobjectpool.h>
 #include <bsl_memory.h>
+#include <bsl_string.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
@@ -65,29 +84,27 @@ class DispatcherEventSource BSLS_KEYWORD_FINAL
     typedef bslmf::MovableRef<DispatcherEventSp>   DispatcherEventRvRef;
 
   private:
-    // PRIVATE TYPES
-    template <class EVENT_TYPE>
-    struct PoolTraits {
-        typedef bdlcc::SharedObjectPool<
-            EVENT_TYPE,
-            bdlcc::ObjectPoolFunctors::DefaultCreator,
-            bdlcc::ObjectPoolFunctors::Reset<EVENT_TYPE> >
-            Pool;
-    };
-
     // DATA
-    PoolTraits<mqbevt::AckEvent>::Pool            d_ackEventPool;
-    PoolTraits<mqbevt::CallbackEvent>::Pool       d_callbackEventPool;
-    PoolTraits<mqbevt::ClusterStateEvent>::Pool   d_clusterStateEventPool;
-    PoolTraits<mqbevt::ConfirmEvent>::Pool        d_confirmEventPool;
-    PoolTraits<mqbevt::ControlMessageEvent>::Pool d_controlMessageEventPool;
-    PoolTraits<mqbevt::DispatcherEvent>::Pool     d_dispatcherEventPool;
-    PoolTraits<mqbevt::PushEvent>::Pool           d_pushEventPool;
-    PoolTraits<mqbevt::PutEvent>::Pool            d_putEventPool;
-    PoolTraits<mqbevt::ReceiptEvent>::Pool        d_receiptEventPool;
-    PoolTraits<mqbevt::RecoveryEvent>::Pool       d_recoveryEventPool;
-    PoolTraits<mqbevt::RejectEvent>::Pool         d_rejectEventPool;
-    PoolTraits<mqbevt::StorageEvent>::Pool        d_storageEventPool;
+
+    /// Allocator store used to obtain the named allocator of this event
+    /// source, if any.
+    bmqma::CountingAllocatorStore d_allocators;
+
+    /// Allocator store used to obtain the allocator of each pool.
+    bmqma::CountingAllocatorStore d_poolAllocators;
+
+    DispatcherEventPool<mqbevt::AckEvent>            d_ackEventPool;
+    DispatcherEventPool<mqbevt::CallbackEvent>       d_callbackEventPool;
+    DispatcherEventPool<mqbevt::ClusterStateEvent>   d_clusterStateEventPool;
+    DispatcherEventPool<mqbevt::ConfirmEvent>        d_confirmEventPool;
+    DispatcherEventPool<mqbevt::ControlMessageEvent> d_controlMessageEventPool;
+    DispatcherEventPool<mqbevt::DispatcherEvent>     d_dispatcherEventPool;
+    DispatcherEventPool<mqbevt::PushEvent>           d_pushEventPool;
+    DispatcherEventPool<mqbevt::PutEvent>            d_putEventPool;
+    DispatcherEventPool<mqbevt::ReceiptEvent>        d_receiptEventPool;
+    DispatcherEventPool<mqbevt::RecoveryEvent>       d_recoveryEventPool;
+    DispatcherEventPool<mqbevt::RejectEvent>         d_rejectEventPool;
+    DispatcherEventPool<mqbevt::StorageEvent>        d_storageEventPool;
 
   public:
     // TRAITS
@@ -96,9 +113,17 @@ class DispatcherEventSource BSLS_KEYWORD_FINAL
 
     // CREATORS
 
-    /// Create a DispatcherEventSource using the specified `allocator`.
+    /// Create a DispatcherEventSource using the optionally specified
+    /// `allocator`.
     explicit DispatcherEventSource(bslma::Allocator* allocator = 0);
 
+    /// Create a DispatcherEventSource having the specified `name`, used to
+    /// report the allocations of its pools if the optionally specified
+    /// `allocator` is a `bmqma::CountingAllocator`, and using `allocator`
+    /// to supply memory.
+    explicit DispatcherEventSource(const bsl::string& name,
+                                   bslma::Allocator*  allocator = 0);
+
     /// Destructor.
     ~DispatcherEventSource() BSLS_KEYWORD_OVERRIDE;
 
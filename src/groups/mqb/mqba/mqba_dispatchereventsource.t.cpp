@@ -16,6 +16,8 @@
 #include <mqba_dispatchereventsource.h>
 
 // BMQ
+#include <bmqma_countingallocator.h>
+#include <bmqst_statcontext.h>
 #include <bmqtst_table.h>
 
 // MQB
@@ -36,6 +38,7 @@
 #include <bdlma_localsequentialallocator.h>
 #include <bsl_iostream.h>
 #include <bsl_vector.h>
+#include <bslma_testallocator.h>
 #include <bsls_stopwatch.h>
 
 // TEST DRIVER
@@ -199,6 +202,104 @@ static void test1_breathingTest()
     }
 }
 
+static void test2_steadyStateAllocations()
+// ------------------------------------------------------------------------
+// STEADY STATE ALLOCATIONS
+//
+// Concerns:
+//   Once the pools have grown to the number of events in flight, getting
+//   events and releasing them does not allocate memory.
+//
+// Plan:
+//   - Get and release a batch of events of the types on the path of a
+//     message (PUT, storage, PUSH) to grow the pools.
+//   - Repeat several times and verify that no memory was allocated.
+//
+// Testing:
+//   - getPutEvent
+//   - getStorageEvent
+//   - getPushEvent
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("STEADY STATE ALLOCATIONS");
+
+    const int k_NUM_IN_FLIGHT = 2000;
+    const int k_NUM_ROUNDS    = 10;
+
+    bslma::TestAllocator        ta("testAlloc");
+    mqba::DispatcherEventSource obj(&ta);
+
+    bsl::vector<bsl::shared_ptr<mqbi::DispatcherEvent> > events(
+        bmqtst::TestHelperUtil::allocator());
+    events.reserve(3 * k_NUM_IN_FLIGHT);
+
+    bsls::Types::Int64 numAllocations = 0;
+    for (int round = 0; round <= k_NUM_ROUNDS; ++round) {
+        for (int i = 0; i < k_NUM_IN_FLIGHT; ++i) {
+            events.push_back(obj.getPutEvent());
+            events.push_back(obj.getStorageEvent());
+            events.push_back(obj.getPushEvent());
+        }
+        events.clear();
+
+        if (round == 0) {
+            // The first round grows the pools
+            numAllocations = ta.numAllocations();
+            BMQTST_ASSERT_GT(numAllocations, 0);
+        }
+        else {
+            BMQTST_ASSERT_EQ_D(round, ta.numAllocations(), numAllocations);
+        }
+    }
+}
+
+static void test3_allocatorStatistics()
+// ------------------------------------------------------------------------
+// ALLOCATOR STATISTICS
+//
+// Concerns:
+//   The allocations of the pool of each type of event of a named event
+//   source are reported under a counting allocator named after the event
+//   source and the type of event.
+//
+// Plan:
+//   - Create a named event source with a 'bmqma::CountingAllocator', get
+//     an event, and verify the stat contexts of the allocators.
+//
+// Testing:
+//   - DispatcherEventSource(const bsl::string&, bslma::Allocator *)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("ALLOCATOR STATISTICS");
+
+    bmqst::StatContextConfiguration config(
+        "test",
+        bmqtst::TestHelperUtil::allocator());
+    bmqst::StatContext       parentStatContext(config,
+                                         bmqtst::TestHelperUtil::allocator());
+    bmqma::CountingAllocator topAllocator("Top",
+                                          &parentStatContext,
+                                          bmqtst::TestHelperUtil::allocator());
+
+    {
+        mqba::DispatcherEventSource obj(
+            bsl::string("Source", bmqtst::TestHelperUtil::allocator()),
+            &topAllocator);
+
+        bsl::shared_ptr<mqbevt::PutEvent> event = obj.getPutEvent();
+        BMQTST_ASSERT(event);
+
+        parentStatContext.snapshot();
+
+        const bmqst::StatContext* sourceContext =
+            topAllocator.context()->getSubcontext("Source");
+        BMQTST_ASSERT(sourceContext);
+        BMQTST_ASSERT(sourceContext->getSubcontext("PutEvents"));
+        BMQTST_ASSERT(sourceContext->getSubcontext("PushEvents"));
+        BMQTST_ASSERT(sourceContext->getSubcontext("StorageEvents"));
+    }
+}
+
 static void testN1_dispatcherEventBenchmark()
 // ------------------------------------------------------------------------
 // DISPATCHER EVENT BENCHMARK
@@ -249,6 +350,8 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 3: test3_allocatorStatistics(); break;
+    case 2: test2_steadyStateAllocations(); break;
     case 1: test1_breathingTest(); break;
     case -1: testN1_dispatcherEventBenchmark(); break;
     default: {
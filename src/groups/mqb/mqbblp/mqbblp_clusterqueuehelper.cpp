@@ -2333,6 +2333,9 @@ bsl::shared_ptr<mqbi::Queue> ClusterQueueHelper::createQueueFactory(
 
     // Register this queue to the dispatcher.
     if (d_cluster_p->isRemote()) {
+        // A remote queue is not tied to the processor of a partition, so let
+        // the dispatcher migrate it to balance the load of its processors.
+        queueSp->dispatcherClientData().setMigratable(true);
         d_cluster_p->dispatcher()->registerClient(
             queueSp.get(),
             mqbi::DispatcherClientType::e_QUEUE);
@@ -78,6 +78,7 @@ LocalQueue::LocalQueue(QueueState* state, bslma::Allocator* allocator)
 , d_throttledFailedPutMessages(5000, 1)  // 1 log per 5s interval
 , d_throttledDuplicateMessages()
 , d_haveStrongConsistency(false)
+, d_syncBeforeAck(false)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_state_p->id() == bmqp::QueueId::k_PRIMARY_QUEUE_ID);
@@ -174,6 +175,7 @@ int LocalQueue::configure(bsl::ostream& errorDescription, bool isReconfigure)
     }
 
     d_haveStrongConsistency = domainCfg->consistency().isStrongValue();
+    d_syncBeforeAck = d_haveStrongConsistency && domainCfg->syncBeforeAck();
 
     d_state_p->stats()
         ->onEvent<mqbstat::QueueStatsDomain::EventType::e_CHANGE_ROLE>(
@@ -484,6 +486,7 @@ void LocalQueue::postMessage(const bmqp::PutHeader&              putHeader,
             doAck ? source : 0,
             putHeader.crc32c(),
             timePoint);  // Arrival Timepoint
+        attributes.setSyncBeforeReceipt(d_syncBeforeAck);
 
         res = d_state_p->storage()->put(&attributes,
                                         putHeader.messageGUID(),
@@ -87,6 +87,10 @@ class LocalQueue BSLS_CPP11_FINAL {
     /// Throttler for duplicates.
     bool d_haveStrongConsistency;
 
+    /// Whether PUTs are acknowledged only once synced to disk, in addition
+    /// to being replicated.  Only meaningful with strong consistency.
+    bool d_syncBeforeAck;
+
   private:
     // NOT IMPLEMENTED
     LocalQueue(const LocalQueue& other) BSLS_CPP11_DELETED;
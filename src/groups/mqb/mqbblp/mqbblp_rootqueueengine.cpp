@@ -1458,6 +1458,9 @@ void RootQueueEngine::afterNewMessage()
     unsigned int batch = 0;
 
     while (d_appsDeliveryContext.reset(storageIt)) {
+        const bsls::Types::Int64 routingStartTime =
+            bmqu::Time::highResolutionTimer();
+
         // Assume, all Apps need to deliver (some may be at capacity)
         for (Apps::iterator iter = d_apps.begin(); iter != d_apps.end();
              ++iter) {
@@ -1487,6 +1490,11 @@ void RootQueueEngine::afterNewMessage()
             queue->stats()
                 ->onEvent<mqbstat::QueueStatsDomain::EventType::e_QUEUE_TIME>(
                     d_appsDeliveryContext.timeDelta());
+
+            // Report the time spent selecting consumers for all Apps
+            typedef mqbstat::QueueStatsDomain::EventType EventType;
+            queue->stats()->onEvent<EventType::e_ROUTING_TIME>(
+                bmqu::Time::highResolutionTimer() - routingStartTime);
         }
         d_appsDeliveryContext.deliverMessage();
 
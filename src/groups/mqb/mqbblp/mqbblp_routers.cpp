@@ -32,6 +32,7 @@
 #include <bmqu_printutil.h>
 
 // BDE
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
@@ -231,6 +232,207 @@ unsigned int Routers::PriorityGroup::sId() const
     return d_itId->key();
 }
 
+// ----------------------------
+// class Routers::MatchingIndex
+// ----------------------------
+
+bool Routers::MatchingIndex::index(const PriorityGroup& group,
+                                   size_t               position)
+{
+    typedef bmqeval::SimpleEvaluator::Predicate Predicate;
+
+    const Expression& expression =
+        group.d_itId->value().d_itExpression->value();
+    Predicate predicate;
+
+    if (!expression.d_evaluator.loadPredicate(&predicate)) {
+        return false;  // RETURN
+    }
+
+    // 'property != value' matches almost everything, not worth indexing.
+    // Strings are only indexed for equality.
+    if (predicate.d_operator == Predicate::e_NE ||
+        (predicate.d_isString && predicate.d_operator != Predicate::e_EQ)) {
+        return false;  // RETURN
+    }
+
+    const size_t             property = propertyIndex(predicate.d_property);
+    const bsls::Types::Int64 value    = predicate.d_integer;
+
+    if (predicate.d_isString) {
+        d_strings[bsl::make_pair(property, predicate.d_string)].push_back(
+            position);
+        return true;  // RETURN
+    }
+
+    // Ranges are kept as inclusive bounds.  'property > MAX' and
+    // 'property < MIN' never match and are indexed as such.
+
+    switch (predicate.d_operator) {
+    case Predicate::e_EQ: {
+        d_integers[bsl::make_pair(property, value)].push_back(position);
+    } break;
+    case Predicate::e_GE: {
+        d_lowerBounds[property].push_back(Bound(value, position));
+    } break;
+    case Predicate::e_GT: {
+        if (value != bsl::numeric_limits<bsls::Types::Int64>::max()) {
+            d_lowerBounds[property].push_back(Bound(value + 1, position));
+        }
+    } break;
+    case Predicate::e_LE: {
+        d_upperBounds[property].push_back(Bound(value, position));
+    } break;
+    case Predicate::e_LT: {
+        if (value != bsl::numeric_limits<bsls::Types::Int64>::min()) {
+            d_upperBounds[property].push_back(Bound(value - 1, position));
+        }
+    } break;
+    case Predicate::e_NE:
+    default: {
+        BSLS_ASSERT_SAFE(false && "Unexpected operator");
+        return false;  // RETURN
+    }
+    }
+
+    return true;
+}
+
+size_t Routers::MatchingIndex::propertyIndex(const bslstl::StringRef& name)
+{
+    for (size_t i = 0; i < d_properties.size(); ++i) {
+        if (d_properties[i] == name) {
+            return i;  // RETURN
+        }
+    }
+
+    d_properties.emplace_back(name);
+    d_lowerBounds.resize(d_properties.size());
+    d_upperBounds.resize(d_properties.size());
+
+    return d_properties.size() - 1;
+}
+
+void Routers::MatchingIndex::build(const PriorityGroupList& groups)
+{
+    clear();
+
+    for (PriorityGroupList::const_iterator itGroup = groups.begin();
+         itGroup != groups.end();
+         ++itGroup) {
+        PriorityGroup& group    = (*itGroup)->value();
+        const size_t   position = d_groups.size();
+        const Entry    entry    = {&group, index(group, position)};
+
+        d_groups.push_back(entry);
+
+        if (entry.d_isIndexed) {
+            ++d_numIndexed;
+        }
+        else {
+            d_unindexed.push_back(position);
+        }
+    }
+
+    for (size_t i = 0; i < d_properties.size(); ++i) {
+        bsl::sort(d_lowerBounds[i].begin(), d_lowerBounds[i].end());
+        bsl::sort(d_upperBounds[i].begin(), d_upperBounds[i].end());
+    }
+}
+
+void Routers::MatchingIndex::clear()
+{
+    d_groups.clear();
+    d_properties.clear();
+    d_integers.clear();
+    d_strings.clear();
+    d_lowerBounds.clear();
+    d_upperBounds.clear();
+    d_unindexed.clear();
+    d_numIndexed = 0;
+    d_candidates.clear();
+}
+
+const Routers::MatchingIndex::Positions&
+Routers::MatchingIndex::match(bmqeval::PropertiesReader* reader)
+{
+    BSLS_ASSERT_SAFE(reader);
+
+    d_candidates.clear();
+
+    // Each indexed group has one predicate, hence it is found at most once.
+    for (size_t i = 0; i < d_properties.size(); ++i) {
+        const bdld::Datum datum = reader->get(d_properties[i], d_allocator_p);
+
+        if (datum.isInteger64() || datum.isInteger()) {
+            const bsls::Types::Int64 value = datum.isInteger64()
+                                                 ? datum.theInteger64()
+                                                 : datum.theInteger();
+
+            Integers::const_iterator itEqual = d_integers.find(
+                bsl::make_pair(i, value));
+            if (itEqual != d_integers.end()) {
+                d_candidates.insert(d_candidates.end(),
+                                    itEqual->second.begin(),
+                                    itEqual->second.end());
+            }
+
+            // 'property >= K' holds for all 'K <= value', a prefix.
+            const Bounds&          lower = d_lowerBounds[i];
+            Bounds::const_iterator itLower =
+                bsl::upper_bound(lower.begin(),
+                                 lower.end(),
+                                 Bound(value,
+                                       bsl::numeric_limits<size_t>::max()));
+            for (Bounds::const_iterator it = lower.begin(); it != itLower;
+                 ++it) {
+                d_candidates.push_back(it->second);
+            }
+
+            // 'property <= K' holds for all 'K >= value', a suffix.
+            const Bounds&          upper = d_upperBounds[i];
+            Bounds::const_iterator itUpper =
+                bsl::lower_bound(upper.begin(), upper.end(), Bound(value, 0));
+            for (; itUpper != upper.end(); ++itUpper) {
+                d_candidates.push_back(itUpper->second);
+            }
+        }
+        else if (datum.isString()) {
+            Strings::const_iterator itEqual = d_strings.find(
+                bsl::make_pair(i, datum.theString()));
+            if (itEqual != d_strings.end()) {
+                d_candidates.insert(d_candidates.end(),
+                                    itEqual->second.begin(),
+                                    itEqual->second.end());
+            }
+        }
+        // Otherwise, the property is missing or has another type, and none
+        // of the indexed expressions using it match.
+    }
+
+    d_candidates.insert(d_candidates.end(),
+                        d_unindexed.begin(),
+                        d_unindexed.end());
+
+    // Preserve the order of the groups.
+    bsl::sort(d_candidates.begin(), d_candidates.end());
+
+    return d_candidates;
+}
+
+bool Routers::MatchingIndex::canDeliver() const
+{
+    for (bsl::vector<Entry>::const_iterator it = d_groups.begin();
+         it != d_groups.end();
+         ++it) {
+        if (it->d_group->d_canDeliver) {
+            return true;  // RETURN
+        }
+    }
+
+    return false;
+}
+
 void Routers::AppContext::loadApp(const char*        appId,
                                   mqbi::QueueHandle* handle,
                                   bsl::ostream*      errorStream,
@@ -496,6 +698,7 @@ unsigned int Routers::AppContext::finalize()
             itPriority = d_priorities.erase(itPriority);
         }
         else {
+            level.d_index.build(level.d_highestGroups);
             ++itPriority;
         }
     }
@@ -676,7 +879,8 @@ Routers::Result Routers::AppContext::selectConsumer(
         }
     }
     else {
-        return d_router.iterateGroups(visitor);  // RETURN
+        return d_router.iterateGroups(visitor,
+                                      d_queue_p->d_preader.get());  // RETURN
     }
 }
 
@@ -684,7 +888,9 @@ Routers::Result Routers::AppContext::selectConsumer(
 // class Routers::RoundRobin
 // -------------------------
 
-Routers::Result Routers::RoundRobin::iterateGroups(Visitor& visitor)
+Routers::Result
+Routers::RoundRobin::iterateGroups(Visitor&                   visitor,
+                                   bmqeval::PropertiesReader* reader)
 {
     bool haveMatch        = false;
     bool noneHaveCapacity = true;
@@ -692,8 +898,20 @@ Routers::Result Routers::RoundRobin::iterateGroups(Visitor& visitor)
     for (Priorities::iterator itPriority = d_priorities.begin();
          itPriority != d_priorities.end() && !haveMatch;
          ++itPriority) {
-        Priority::PriorityGroupList& groups =
-            itPriority->second.d_highestGroups;
+        Priority& level = itPriority->second;
+
+        if (reader && level.d_index.isEnabled()) {
+            if (iterateIndex(visitor,
+                             level.d_index,
+                             reader,
+                             &haveMatch,
+                             &noneHaveCapacity)) {
+                return e_SUCCESS;  // RETURN
+            }
+            continue;  // CONTINUE
+        }
+
+        Priority::PriorityGroupList& groups = level.d_highestGroups;
 
         for (Priority::PriorityGroupList::iterator itGroup = groups.begin();
              itGroup != groups.end();
@@ -731,6 +949,44 @@ Routers::Result Routers::RoundRobin::iterateGroups(Visitor& visitor)
     }
 }
 
+bool Routers::RoundRobin::iterateIndex(Visitor&                   visitor,
+                                       MatchingIndex&             index,
+                                       bmqeval::PropertiesReader* reader,
+                                       bool*                      haveMatch,
+                                       bool* noneHaveCapacity)
+{
+    const MatchingIndex::Positions& candidates = index.match(reader);
+
+    for (MatchingIndex::Positions::const_iterator it = candidates.begin();
+         it != candidates.end();
+         ++it) {
+        PriorityGroup& group = index.group(*it);
+
+        BSLS_ASSERT_SAFE(!group.d_highestSubscriptions.empty());
+
+        if (!group.d_canDeliver) {
+            continue;  // CONTINUE
+        }
+        if (!index.isIndexed(*it) && !group.evaluate()) {
+            *noneHaveCapacity = false;
+            continue;  // CONTINUE
+        }
+        if (iterateSubscriptions(visitor, group)) {
+            return true;  // RETURN
+        }
+        group.d_canDeliver = false;
+        *haveMatch         = true;
+    }
+
+    if (*noneHaveCapacity) {
+        // Each candidate either cannot deliver or has just been marked as
+        // such.  Any other group which can deliver does not match.
+        *noneHaveCapacity = !index.canDeliver();
+    }
+
+    return false;
+}
+
 bool Routers::RoundRobin::iterateSubscriptions(Visitor&       visitor,
                                                PriorityGroup& group)
 {
@@ -174,6 +174,7 @@
 #include <bsl_utility.h>
 #include <bsl_vector.h>
 #include <bsla_annotations.h>
+#include <bslh_hash.h>
 #include <bslma_managedptr.h>
 #include <bsls_assert.h>
 #include <bsls_keyword.h>
@@ -526,6 +527,144 @@ class Routers {
         unsigned int upstreamId() const;
     };
 
+    /// Mechanism to find the `PriorityGroup`s of one `Priority` which
+    /// `Expression`s can match a message without evaluating each of them.
+    /// Expressions comparing a property with a literal (see
+    /// `bmqeval::SimpleEvaluator::Predicate`) are indexed by property: by
+    /// value for equality, and by sorted bounds for integer ranges.  Each
+    /// indexed property is read once per message.  Other expressions remain
+    /// candidates for every message and must be evaluated.
+    /// One per received priority per App.
+    class MatchingIndex {
+      public:
+        // PUBLIC TYPES
+        typedef bsl::list<PriorityGroups::SharedItem> PriorityGroupList;
+
+        /// Positions of `PriorityGroup`s in the `PriorityGroupList` the
+        /// index is built from.
+        typedef bsl::vector<size_t> Positions;
+
+        // PUBLIC CONSTANTS
+        enum {
+            /// The minimum number of indexed groups for the index to be
+            /// used.  Evaluating fewer expressions is cheaper than the
+            /// lookups.
+            k_MIN_INDEXED_GROUPS = 8
+        };
+
+      private:
+        // PRIVATE TYPES
+
+        /// An indexed group.
+        struct Entry {
+            PriorityGroup* d_group;
+
+            /// `true` if the group is matched by the index, `false` if its
+            /// `Expression` must be evaluated.
+            bool d_isIndexed;
+        };
+
+        /// A bound of an integer range, and the position of the group.
+        typedef bsl::pair<bsls::Types::Int64, size_t> Bound;
+
+        typedef bsl::vector<Bound> Bounds;
+
+        /// Groups matching an integer value of the property at an index.
+        typedef bsl::unordered_map<bsl::pair<size_t, bsls::Types::Int64>,
+                                   Positions,
+                                   bslh::Hash<> >
+            Integers;
+
+        /// Groups matching a string value of the property at an index.
+        typedef bsl::unordered_map<bsl::pair<size_t, bslstl::StringRef>,
+                                   Positions,
+                                   bslh::Hash<> >
+            Strings;
+
+        // DATA
+
+        /// All groups, in the order of the `PriorityGroupList`.
+        bsl::vector<Entry> d_groups;
+
+        /// Names of the indexed properties.
+        bsl::vector<bsl::string> d_properties;
+
+        Integers d_integers;
+
+        /// String literals refer to the compiled `Expression`s which
+        /// outlive the index.
+        Strings d_strings;
+
+        /// Per indexed property, the bounds `K` of `property >= K`, sorted.
+        bsl::vector<Bounds> d_lowerBounds;
+
+        /// Per indexed property, the bounds `K` of `property <= K`, sorted.
+        bsl::vector<Bounds> d_upperBounds;
+
+        /// Positions of the groups which are not indexed.
+        Positions d_unindexed;
+
+        size_t d_numIndexed;
+
+        /// Result of the last `match`.
+        Positions d_candidates;
+
+        bslma::Allocator* d_allocator_p;
+
+      private:
+        // PRIVATE MANIPULATORS
+
+        /// Index the specified `group` at the specified `position`, if its
+        /// `Expression` is indexable.  Return `true` if indexed.
+        bool index(const PriorityGroup& group, size_t position);
+
+        /// Return the index of the property with the specified `name`,
+        /// adding it if needed.
+        size_t propertyIndex(const bslstl::StringRef& name);
+
+      private:
+        // NOT IMPLEMENTED
+        MatchingIndex(const MatchingIndex&) BSLS_KEYWORD_DELETED;
+        MatchingIndex& operator=(const MatchingIndex&) BSLS_KEYWORD_DELETED;
+
+      public:
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(MatchingIndex,
+                                       bslma::UsesBslmaAllocator)
+
+        // CREATORS
+        explicit MatchingIndex(bslma::Allocator* allocator);
+
+        // MANIPULATORS
+
+        /// Index the specified `groups`, replacing the current contents.
+        void build(const PriorityGroupList& groups);
+
+        void clear();
+
+        /// Return positions, in ascending order, of all groups which
+        /// `Expression` can match the message read by the specified
+        /// `reader`.  Indexed groups are known to match, the others must be
+        /// evaluated.  The result is valid until the next call.
+        const Positions& match(bmqeval::PropertiesReader* reader);
+
+        // ACCESSORS
+
+        /// Return `true` if enough groups are indexed for `match` to be
+        /// cheaper than evaluating all `Expression`s.
+        bool isEnabled() const;
+
+        /// Return the group at the specified `position`.
+        PriorityGroup& group(size_t position) const;
+
+        /// Return `true` if the group at the specified `position` is
+        /// matched by the index without evaluating its `Expression`.
+        bool isIndexed(size_t position) const;
+
+        /// Return `true` if any group has `canDeliver` consumer.
+        bool canDeliver() const;
+    };
+
     /// Mechanism representing all `Subscription` `PriorityGroup`s with the
     /// same priority.  One per received priority per App
     struct Priority {
@@ -549,6 +688,10 @@ class Routers {
         /// is this one.
         size_t d_count;
 
+        /// Index of `d_highestGroups`.  Not copied, `AppContext::finalize`
+        /// builds it.
+        MatchingIndex d_index;
+
         explicit Priority(bslma::Allocator* allocator);
         Priority(const Priority& other, bslma::Allocator* allocator);
 
@@ -668,6 +811,19 @@ class Routers {
         // PRIVATE DATA
         Priorities& d_priorities;
 
+      private:
+        // PRIVATE MANIPULATORS
+
+        /// Iterate `Group`s found by the specified `index` for the message
+        /// read by the specified `reader` as `iterateGroups` does.  Return
+        /// `true` if the `visitor` returns `true`.  Otherwise, update the
+        /// specified `haveMatch` and `noneHaveCapacity`.
+        bool iterateIndex(Visitor&                   visitor,
+                          MatchingIndex&             index,
+                          bmqeval::PropertiesReader* reader,
+                          bool*                      haveMatch,
+                          bool*                      noneHaveCapacity);
+
       public:
         // CREATORS
 
@@ -684,8 +840,11 @@ class Routers {
         /// If the `visitor` returns `true`, stop iterating, move the
         /// subscription to the end of round-robind selection list if it has
         /// been selected `d_consumerPriorityCount` times , and return
-        /// `true`.
-        Result iterateGroups(Visitor& visitor);
+        /// `true`.  If the optionally specified `reader` of the message
+        /// properties is not 0, use `Priority::d_index` to skip `Group`s
+        /// which do not match without evaluating their `Expression`s.
+        Result iterateGroups(Visitor&                   visitor,
+                             bmqeval::PropertiesReader* reader = 0);
 
         /// Iterate all highest priority `Subscription`s within the
         /// specified `group` and call the specified `visitor` for each
@@ -1130,6 +1289,45 @@ inline Routers::Subscriber::~Subscriber()
     // NOTHING
 }
 
+// ----------------------------
+// class Routers::MatchingIndex
+// ----------------------------
+
+inline Routers::MatchingIndex::MatchingIndex(bslma::Allocator* allocator)
+: d_groups(allocator)
+, d_properties(allocator)
+, d_integers(allocator)
+, d_strings(allocator)
+, d_lowerBounds(allocator)
+, d_upperBounds(allocator)
+, d_unindexed(allocator)
+, d_numIndexed(0)
+, d_candidates(allocator)
+, d_allocator_p(allocator)
+{
+    // NOTHING
+}
+
+inline bool Routers::MatchingIndex::isEnabled() const
+{
+    return d_numIndexed >= k_MIN_INDEXED_GROUPS;
+}
+
+inline Routers::PriorityGroup&
+Routers::MatchingIndex::group(size_t position) const
+{
+    BSLS_ASSERT_SAFE(position < d_groups.size());
+
+    return *d_groups[position].d_group;
+}
+
+inline bool Routers::MatchingIndex::isIndexed(size_t position) const
+{
+    BSLS_ASSERT_SAFE(position < d_groups.size());
+
+    return d_groups[position].d_isIndexed;
+}
+
 // -----------------------------
 // struct Routers::Priority
 // -----------------------------
@@ -1138,6 +1336,7 @@ inline Routers::Priority::Priority(bslma::Allocator* allocator)
 : d_subscribers(allocator)
 , d_highestGroups(allocator)
 , d_count(0)
+, d_index(allocator)
 {
     // NOTHING
 }
@@ -1147,6 +1346,7 @@ inline Routers::Priority::Priority(const Priority&   other,
 : d_subscribers(other.d_subscribers, allocator)
 , d_highestGroups(other.d_highestGroups, allocator)
 , d_count(other.d_count)
+, d_index(allocator)
 {
     // NOTHING
 }
@@ -31,12 +31,14 @@
 #include <mqbs_inmemorystorage.h>
 
 // BDE
+#include <bdld_datum.h>
 #include <bdlbb_blob.h>
 #include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bsla_annotations.h>
 #include <bsls_platform.h>
 #include <bsls_protocoltest.h>
+#include <bsl_unordered_map.h>
 
 // TEST DRIVER
 #include <bmqtst_testhelper.h>
@@ -126,10 +128,14 @@ class Visitor : public mqbblp::Routers::Visitor {
     unsigned int               d_subQueueId;
     mqbblp::Routers::Consumer* d_consumer;
 
+    /// Value to return from `visit`.
+    bool d_accept;
+
     Visitor()
     : d_handle(0)
     , d_subQueueId(bmqp::QueueId::k_DEFAULT_SUBQUEUE_ID)
     , d_consumer(0)
+    , d_accept(true)
     {
         // NOTHING
     }
@@ -143,7 +149,7 @@ class Visitor : public mqbblp::Routers::Visitor {
         d_consumer   = consumer;
         d_handle     = handle;
 
-        return true;
+        return d_accept;
     }
 };
 
@@ -152,6 +158,41 @@ Visitor::~Visitor()
     // NOTHING
 }
 
+/// Properties reader returning preset values and counting reads.
+class PropertiesReader : public bmqeval::PropertiesReader {
+  public:
+    bsl::unordered_map<bsl::string, bdld::Datum> d_properties;
+    int                                          d_numReads;
+
+    explicit PropertiesReader(bslma::Allocator* allocator)
+    : d_properties(allocator)
+    , d_numReads(0)
+    {
+        // NOTHING
+    }
+    ~PropertiesReader() BSLS_KEYWORD_OVERRIDE;
+
+    bdld::Datum get(const bsl::string& name,
+                    bslma::Allocator*  allocator) BSLS_KEYWORD_OVERRIDE
+    {
+        (void)allocator;
+
+        ++d_numReads;
+
+        bsl::unordered_map<bsl::string, bdld::Datum>::const_iterator it =
+            d_properties.find(name);
+        if (it == d_properties.end()) {
+            return bdld::Datum::createError(-1);  // RETURN
+        }
+        return it->second;
+    }
+};
+
+PropertiesReader::~PropertiesReader()
+{
+    // NOTHING
+}
+
 struct Item {
     int d_i;
 
@@ -536,6 +577,293 @@ static void test4_generate()
     }
 }
 
+static void setCanDeliver(mqbblp::Routers::AppContext* appContext,
+                          bool                         value)
+{
+    mqbblp::Routers::PriorityGroups& groups = appContext->d_groups;
+    for (mqbblp::Routers::PriorityGroups::const_iterator cit = groups.begin();
+         cit != groups.end();
+         ++cit) {
+        groups.value(cit).d_canDeliver = value;
+    }
+}
+
+static void test5_matchingIndex()
+// ------------------------------------------------------------------------
+// Testing mqbblp::Routers::MatchingIndex and iterateGroups with a
+// properties reader.
+//
+//  1. Expressions comparing a property with a literal are indexed, others
+//     are not.
+//  2. Routing with the index selects the same subscription and returns the
+//     same result as evaluating all expressions, including when there is
+//     no capacity.
+//  3. Routing with the index reads fewer properties.
+// ------------------------------------------------------------------------
+{
+    bmqp_ctrlmsg::StreamParameters streamParams(
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::SchemaLearner schemaLearner(bmqtst::TestHelperUtil::allocator());
+    mqbblp::Routers::QueueRoutingContext queueContext(
+        schemaLearner,
+        bmqtst::TestHelperUtil::allocator());
+    unsigned int subQueueId = 13;
+    TestStorage  storage(subQueueId, bmqtst::TestHelperUtil::allocator());
+    PropertiesReader reader(bmqtst::TestHelperUtil::allocator());
+
+    queueContext.d_evaluationContext.setPropertiesReader(&reader);
+
+    mqbmock::QueueHandle handle = storage.getHandle();
+
+    bmqp_ctrlmsg::SubQueueIdInfo subStreamInfo(
+        bmqtst::TestHelperUtil::allocator());
+
+    bsl::string  appId("foo", bmqtst::TestHelperUtil::allocator());
+    unsigned int upstreamSubQueueId = 1;
+    subStreamInfo.appId()           = appId;
+    subStreamInfo.subId()           = subQueueId;
+
+    handle.registerSubStream(subStreamInfo,
+                             upstreamSubQueueId,
+                             mqbi::QueueCounts(1, 0));
+
+    // Subscription ids are positions + 1, all at the same priority.
+    const char* expressions[] = {
+        "x == 0",        // 1
+        "x == 1",        // 2
+        "x == 2",        // 3
+        "x == 3",        // 4
+        "x == 4",        // 5
+        "5 == x",        // 6
+        "x >= 20",       // 7
+        "x > 100",       // 8
+        "x <= -10",      // 9
+        "-5 > x",        // 10, not indexed
+        "s == \"foo\"",  // 11
+        "x != 3",        // 12, not indexed
+        "x % 7 == 6",    // 13, not indexed
+        "y < 2",         // 14
+    };
+    const size_t numExpressions = sizeof(expressions) / sizeof(*expressions);
+
+    streamParams.appId() = appId;
+    streamParams.subscriptions().resize(numExpressions);
+
+    for (size_t i = 0; i < numExpressions; ++i) {
+        bmqp_ctrlmsg::Subscription& subscription =
+            streamParams.subscriptions()[i];
+
+        subscription.sId()                  = static_cast<unsigned int>(i + 1);
+        subscription.expression().text()    = expressions[i];
+        subscription.expression().version() =
+            bmqp_ctrlmsg::ExpressionVersion::E_VERSION_1;
+        subscription.consumers().resize(1);
+
+        bmqp_ctrlmsg::ConsumerInfo& ci = subscription.consumers()[0];
+
+        ci.consumerPriority()       = 1;
+        ci.consumerPriorityCount()  = 1;
+        ci.maxUnconfirmedMessages() = 1024;
+        ci.maxUnconfirmedBytes()    = 1024;
+    }
+
+    handle.setStreamParameters(streamParams);
+
+    mqbblp::Routers::AppContext appContext(
+        &queueContext,
+        bmqtst::TestHelperUtil::allocator());
+    bmqu::MemOutStream errorStream(bmqtst::TestHelperUtil::allocator());
+
+    appContext.load(&handle,
+                    &errorStream,
+                    subStreamInfo.subId(),
+                    upstreamSubQueueId,
+                    streamParams,
+                    0);
+    BMQTST_ASSERT_EQ(errorStream.str(), "");
+    BMQTST_ASSERT_EQ(appContext.finalize(), numExpressions);
+    appContext.registerSubscriptions();
+
+    BMQTST_ASSERT_EQ(appContext.d_priorities.size(), size_t(1));
+    mqbblp::Routers::MatchingIndex& index =
+        appContext.d_priorities.begin()->second.d_index;
+
+    BMQTST_ASSERT(index.isEnabled());
+    for (size_t i = 0; i < numExpressions; ++i) {
+        const bool isIndexed = i != 9 && i != 11 && i != 12;
+
+        PV(expressions[i]);
+        BMQTST_ASSERT_EQ(index.isIndexed(i), isIndexed);
+    }
+
+    mqbblp::Routers::RoundRobin router(appContext.d_priorities);
+
+    const bdld::Datum k_MISSING = bdld::Datum::createNull();
+
+    struct TestParameters {
+        int                     d_line;
+        bdld::Datum             d_x;
+        bdld::Datum             d_s;
+        bdld::Datum             d_y;
+        mqbblp::Routers::Result d_expected;
+        unsigned int            d_sId;
+    } testParameters[] = {
+        {L_,
+         bdld::Datum::createInteger(0),
+         k_MISSING,
+         k_MISSING,
+         mqbblp::Routers::e_SUCCESS,
+         1},
+        {L_,
+         bdld::Datum::createInteger64(3, bmqtst::TestHelperUtil::allocator()),
+         k_MISSING,
+         k_MISSING,
+         mqbblp::Routers::e_SUCCESS,
+         4},
+        {L_,
+         bdld::Datum::createInteger(5),
+         k_MISSING,
+         k_MISSING,
+         mqbblp::Routers::e_SUCCESS,
+         6},
+        {L_,
+         bdld::Datum::createInteger(20),
+         k_MISSING,
+         k_MISSING,
+         mqbblp::Routers::e_SUCCESS,
+         7},
+        {L_,
+         bdld::Datum::createInteger(101),
+         k_MISSING,
+         k_MISSING,
+         mqbblp::Routers::e_SUCCESS,
+         7},
+        {L_,
+         bdld::Datum::createInteger(-10),
+         k_MISSING,
+         k_MISSING,
+         mqbblp::Routers::e_SUCCESS,
+         9},
+        {L_,
+         bdld::Datum::createInteger(-7),
+         k_MISSING,
+         k_MISSING,
+         mqbblp::Routers::e_SUCCESS,
+         10},
+        {L_,
+         bdld::Datum::createInteger(13),
+         k_MISSING,
+         k_MISSING,
+         mqbblp::Routers::e_SUCCESS,
+         12},
+        {L_,
+         k_MISSING,
+         bdld::Datum::createStringRef("foo",
+                                      bmqtst::TestHelperUtil::allocator()),
+         k_MISSING,
+         mqbblp::Routers::e_SUCCESS,
+         11},
+        {L_,
+         k_MISSING,
+         bdld::Datum::createStringRef("bar",
+                                      bmqtst::TestHelperUtil::allocator()),
+         bdld::Datum::createInteger(1),
+         mqbblp::Routers::e_SUCCESS,
+         14},
+        {L_,
+         k_MISSING,
+         bdld::Datum::createStringRef("bar",
+                                      bmqtst::TestHelperUtil::allocator()),
+         bdld::Datum::createInteger(2),
+         mqbblp::Routers::e_NO_SUBSCRIPTION,
+         0},
+        {L_,
+         bdld::Datum::createStringRef("3",
+                                      bmqtst::TestHelperUtil::allocator()),
+         bdld::Datum::createInteger(3),
+         k_MISSING,
+         mqbblp::Routers::e_NO_SUBSCRIPTION,
+         0},
+    };
+    const TestParameters* testParametersEnd = testParameters +
+                                              sizeof(testParameters) /
+                                                  sizeof(*testParameters);
+
+    for (const TestParameters* parameters = testParameters;
+         parameters < testParametersEnd;
+         ++parameters) {
+        PV(parameters->d_line);
+
+        reader.d_properties.clear();
+        if (!parameters->d_x.isNull()) {
+            reader.d_properties["x"] = parameters->d_x;
+        }
+        if (!parameters->d_s.isNull()) {
+            reader.d_properties["s"] = parameters->d_s;
+        }
+        if (!parameters->d_y.isNull()) {
+            reader.d_properties["y"] = parameters->d_y;
+        }
+
+        Visitor linearVisitor;
+        reader.d_numReads = 0;
+        BMQTST_ASSERT_EQ(router.iterateGroups(linearVisitor),
+                         parameters->d_expected);
+        const int numLinearReads = reader.d_numReads;
+
+        Visitor indexVisitor;
+        reader.d_numReads = 0;
+        BMQTST_ASSERT_EQ(router.iterateGroups(indexVisitor, &reader),
+                         parameters->d_expected);
+        BMQTST_ASSERT_LE(reader.d_numReads, numLinearReads);
+
+        if (parameters->d_expected == mqbblp::Routers::e_SUCCESS) {
+            BMQTST_ASSERT_EQ(linearVisitor.d_subQueueId, parameters->d_sId);
+            BMQTST_ASSERT_EQ(indexVisitor.d_subQueueId, parameters->d_sId);
+        }
+
+        // Without capacity in the matching group.
+        Visitor refusingVisitor;
+        refusingVisitor.d_accept = false;
+
+        const mqbblp::Routers::Result linearResult = router.iterateGroups(
+            refusingVisitor);
+        setCanDeliver(&appContext, true);
+
+        BMQTST_ASSERT_EQ(router.iterateGroups(refusingVisitor, &reader),
+                         linearResult);
+        setCanDeliver(&appContext, true);
+
+        // Without capacity in any group.
+        setCanDeliver(&appContext, false);
+        BMQTST_ASSERT_EQ(router.iterateGroups(linearVisitor),
+                         mqbblp::Routers::e_NO_CAPACITY_ALL);
+        BMQTST_ASSERT_EQ(router.iterateGroups(indexVisitor, &reader),
+                         mqbblp::Routers::e_NO_CAPACITY_ALL);
+        setCanDeliver(&appContext, true);
+    }
+
+    // Reading each indexed property once beats evaluating each expression.
+    reader.d_properties.clear();
+    reader.d_properties["x"] = bdld::Datum::createInteger(13);
+
+    Visitor visitor;
+    reader.d_numReads = 0;
+    BMQTST_ASSERT_EQ(router.iterateGroups(visitor),
+                     mqbblp::Routers::e_SUCCESS);
+    const int numLinearReads = reader.d_numReads;
+
+    reader.d_numReads = 0;
+    BMQTST_ASSERT_EQ(router.iterateGroups(visitor, &reader),
+                     mqbblp::Routers::e_SUCCESS);
+    BMQTST_ASSERT_LT(reader.d_numReads, numLinearReads);
+
+    BMQTST_ASSERT_EQ(handle.unregisterSubStream(subStreamInfo,
+                                                mqbi::QueueCounts(1, 0),
+                                                false),
+                     true);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -553,6 +881,7 @@ int main(int argc, char* argv[])
     case 2: test2_priority(); break;
     case 3: test3_parse(); break;
     case 4: test4_generate(); break;
+    case 5: test5_matchingIndex(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
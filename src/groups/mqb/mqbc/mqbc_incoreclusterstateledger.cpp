@@ -45,6 +45,7 @@
 #include <bmqu_blobobjectproxy.h>
 #include <bmqu_memoutstream.h>
 #include <bmqu_time.h>
+#include <bmqu_weakmemfn.h>
 
 // BDE
 #include <bdlbb_blob.h>
@@ -57,6 +58,7 @@
 #include <bdlt_currenttime.h>
 #include <bdlt_datetimeutil.h>
 #include <bdlt_epochutil.h>
+#include <bsl_algorithm.h>
 #include <bsl_cstring.h>
 #include <bsl_ctime.h>
 #include <bsl_functional.h>
@@ -116,6 +118,92 @@ void constructEventBlob(bdlbb::Blob* event, const bdlbb::Blob& record)
     bdlbb::BlobUtil::append(event, record);
 }
 
+/// Return the address of the LSN of the advisory in the specified `message`.
+/// The behavior is undefined unless `message` holds one of the advisories
+/// applied by the leader.
+bmqp_ctrlmsg::LeaderMessageSequence*
+advisorySequenceNumber(bmqp_ctrlmsg::ClusterMessage* message)
+{
+    typedef bmqp_ctrlmsg::ClusterMessageChoice MsgChoice;
+
+    MsgChoice& choice = message->choice();
+    switch (choice.selectionId()) {
+    case MsgChoice::SELECTION_ID_PARTITION_PRIMARY_ADVISORY: {
+        return &choice.partitionPrimaryAdvisory().sequenceNumber();  // RETURN
+    }
+    case MsgChoice::SELECTION_ID_LEADER_ADVISORY: {
+        return &choice.leaderAdvisory().sequenceNumber();  // RETURN
+    }
+    case MsgChoice::SELECTION_ID_QUEUE_ASSIGNMENT_ADVISORY: {
+        return &choice.queueAssignmentAdvisory().sequenceNumber();  // RETURN
+    }
+    case MsgChoice::SELECTION_ID_QUEUE_UN_ASSIGNMENT_ADVISORY: {
+        return &choice.queueUnAssignmentAdvisory()
+                    .sequenceNumber();  // RETURN
+    }
+    case MsgChoice::SELECTION_ID_QUEUE_UPDATE_ADVISORY: {
+        return &choice.queueUpdateAdvisory().sequenceNumber();  // RETURN
+    }
+    default: {
+        BSLS_ASSERT_SAFE(false && "Unsupported cluster message type");
+        return 0;  // RETURN
+    }
+    }
+}
+
+/// @{
+/// Return the address of the queues (un)assigned by the specified `message`
+/// if it holds a `QueueAssignmentAdvisory` or a `QueueUnAssignmentAdvisory`,
+/// which can be batched, and 0 otherwise.
+bsl::vector<bmqp_ctrlmsg::QueueInfo>*
+batchableQueues(bmqp_ctrlmsg::ClusterMessage* message)
+{
+    bmqp_ctrlmsg::ClusterMessageChoice& choice = message->choice();
+    if (choice.isQueueAssignmentAdvisoryValue()) {
+        return &choice.queueAssignmentAdvisory().queues();  // RETURN
+    }
+    if (choice.isQueueUnAssignmentAdvisoryValue()) {
+        return &choice.queueUnAssignmentAdvisory().queues();  // RETURN
+    }
+    return 0;
+}
+
+const bsl::vector<bmqp_ctrlmsg::QueueInfo>*
+batchableQueues(const bmqp_ctrlmsg::ClusterMessage& message)
+{
+    const bmqp_ctrlmsg::ClusterMessageChoice& choice = message.choice();
+    if (choice.isQueueAssignmentAdvisoryValue()) {
+        return &choice.queueAssignmentAdvisory().queues();  // RETURN
+    }
+    if (choice.isQueueUnAssignmentAdvisoryValue()) {
+        return &choice.queueUnAssignmentAdvisory().queues();  // RETURN
+    }
+    return 0;
+}
+/// @}
+
+/// Return true if the queue (un)assignment advisory in the specified
+/// `message` can be added to the specified `batch`, and false otherwise.
+bool canAddToBatch(const bmqp_ctrlmsg::ClusterMessage& batch,
+                   const bmqp_ctrlmsg::ClusterMessage& message)
+{
+    if (batch.choice().selectionId() != message.choice().selectionId()) {
+        return false;  // RETURN
+    }
+    if (!batch.choice().isQueueUnAssignmentAdvisoryValue()) {
+        return true;  // RETURN
+    }
+
+    // Unassignments also carry the primary of their partition
+    const bmqp_ctrlmsg::QueueUnAssignmentAdvisory& lhs =
+        batch.choice().queueUnAssignmentAdvisory();
+    const bmqp_ctrlmsg::QueueUnAssignmentAdvisory& rhs =
+        message.choice().queueUnAssignmentAdvisory();
+    return lhs.partitionId() == rhs.partitionId() &&
+           lhs.primaryNodeId() == rhs.primaryNodeId() &&
+           lhs.primaryLeaseId() == rhs.primaryLeaseId();
+}
+
 }  // close anonymous namespace
 
 // ============================================
@@ -237,6 +325,16 @@ int IncoreClusterStateLedger::cleanupLog(const bsl::string& logPath)
     return rc_SUCCESS;
 }
 
+void IncoreClusterStateLedger::executeInDispatcher(
+    const bsl::function<void()>& functor)
+{
+    // executed by the *SCHEDULER* thread
+
+    d_clusterData_p->cluster().dispatcher()->execute(
+        functor,
+        &d_clusterData_p->cluster());
+}
+
 int IncoreClusterStateLedger::onLogRolloverCb(const mqbu::StorageKey& oldLogId,
                                               const mqbu::StorageKey& newLogId)
 {
@@ -266,6 +364,7 @@ int IncoreClusterStateLedger::onLogRolloverCb(const mqbu::StorageKey& oldLogId,
     }
     d_clusterData_p->stats().setCslOffsetBytes(
         d_ledger_mp->currentLog()->currentOffset());
+    d_numCommitsSinceSnapshot = 0;
 
     if (oldLogId.isNull()) {
         // If this is a brand new ledger
@@ -374,6 +473,292 @@ void IncoreClusterStateLedger::onQuorumChangeCb(unsigned int ackQuorum)
     }
 }
 
+int IncoreClusterStateLedger::compact()
+{
+    // executed by the *CLUSTER DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_clusterData_p->cluster().inDispatcherThread());
+    BSLS_ASSERT_SAFE(d_isOpen);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        /// Success
+        rc_SUCCESS = 0,
+        /// Self follower's cluster state may be incomplete
+        rc_NOT_HEALED = 1,
+        /// Fail to roll over the ledger
+        rc_ROLLOVER_FAILURE = -1
+    };
+
+    const bsls::Types::Uint64 term =
+        d_clusterData_p->electorInfo().leaderMessageSequence().electorTerm();
+    if (!isSelfLeader() &&
+        (d_appliedSnapshotTerm != term || !d_gatedUpdateLsns.empty())) {
+        return rc_NOT_HEALED;  // RETURN
+    }
+
+    BALL_LOG_INFO << description() << ": Compacting the ledger after "
+                  << d_numCommitsSinceSnapshot << " commits, with "
+                  << d_uncommittedAdvisories.size()
+                  << " uncommitted advisories";
+
+    // Rolling over writes the snapshot and the uncommitted advisories to the
+    // new log (see 'onLogRolloverCb'), and resets the commit counter.
+    const int rc = d_ledger_mp->rollOver();
+    if (rc != 0) {
+        return 10 * rc + rc_ROLLOVER_FAILURE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int IncoreClusterStateLedger::applyAdvisory(
+    const bmqp_ctrlmsg::ClusterMessage&        clusterMessage,
+    const bmqp_ctrlmsg::LeaderMessageSequence& lsn,
+    ClusterStateRecordType::Enum               recordType)
+{
+    // executed by the *CLUSTER DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_clusterData_p->cluster().inDispatcherThread());
+
+    if (d_maxBatchSize > 1 && batchableQueues(clusterMessage)) {
+        return batchAdvisory(clusterMessage, lsn);  // RETURN
+    }
+
+    if (d_pendingBatchSize == 0) {
+        return applyAdvisoryInternal(clusterMessage,
+                                     lsn,
+                                     recordType);  // RETURN
+    }
+
+    if (recordType == ClusterStateRecordType::e_SNAPSHOT) {
+        // The snapshot is built from the cluster state, which does not
+        // include the queues of the pending batch until it is committed: were
+        // the batch applied first, followers would apply the snapshot over
+        // it.  Cancel the batch instead, so that the snapshot keeps its LSN.
+        cancelPendingBatch();
+        return applyAdvisoryInternal(clusterMessage,
+                                     lsn,
+                                     recordType);  // RETURN
+    }
+
+    // Apply the pending batch first to preserve the order of advisories.
+    // Since the batch is applied under a new LSN, this advisory must be
+    // assigned a new one as well.  Note that failure to apply the batch is
+    // notified via 'commitCb'.
+    flushPendingBatch();
+
+    bmqp_ctrlmsg::ClusterMessage         message(clusterMessage);
+    bmqp_ctrlmsg::LeaderMessageSequence* newLsn = advisorySequenceNumber(
+        &message);
+    d_clusterData_p->electorInfo().nextLeaderMessageSequence(newLsn);
+
+    return applyAdvisoryInternal(message, *newLsn, recordType);
+}
+
+int IncoreClusterStateLedger::batchAdvisory(
+    const bmqp_ctrlmsg::ClusterMessage&        clusterMessage,
+    const bmqp_ctrlmsg::LeaderMessageSequence& lsn)
+{
+    // executed by the *CLUSTER DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_clusterData_p->cluster().inDispatcherThread());
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        /// Success
+        rc_SUCCESS = 0,
+        /// Advisory is stale
+        rc_ADVISORY_STALE = -1
+    };
+
+    if (lsn < d_clusterData_p->electorInfo().leaderMessageSequence()) {
+        BALL_LOG_WARN
+            << description()
+            << ": Failed to apply advisory: " << clusterMessage
+            << ". Reason: advisory is stale (LSN: " << printLSN(lsn)
+            << ", self LSN: "
+            << printLSN(d_clusterData_p->electorInfo().leaderMessageSequence())
+            << ").";
+        return rc_ADVISORY_STALE;  // RETURN
+    }
+
+    if (d_pendingBatchSize != 0 &&
+        !canAddToBatch(d_pendingBatch, clusterMessage)) {
+        flushPendingBatch();
+    }
+
+    const bsl::vector<bmqp_ctrlmsg::QueueInfo>& queues = *batchableQueues(
+        clusterMessage);
+    if (d_pendingBatchSize == 0) {
+        d_pendingBatch     = clusterMessage;
+        d_pendingBatchSize = static_cast<int>(queues.size());
+        scheduleBatchFlush();
+    }
+    else {
+        bsl::vector<bmqp_ctrlmsg::QueueInfo>& batchQueues = *batchableQueues(
+            &d_pendingBatch);
+        batchQueues.insert(batchQueues.end(), queues.begin(), queues.end());
+        d_pendingBatchSize += static_cast<int>(queues.size());
+    }
+
+    if (d_pendingBatchSize >= d_maxBatchSize) {
+        flushPendingBatch();
+    }
+
+    return rc_SUCCESS;
+}
+
+void IncoreClusterStateLedger::scheduleBatchFlush()
+{
+    // executed by the *CLUSTER DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_clusterData_p->cluster().inDispatcherThread());
+
+    const int generation = d_pendingBatchGeneration;
+    if (d_maxBatchLatency == bsls::TimeInterval()) {
+        d_clusterData_p->cluster().dispatcher()->execute(
+            bdlf::BindUtil::bindS(
+                d_allocator_p,
+                bmqu::WeakMemFnUtil::weakMemFn(
+                    &IncoreClusterStateLedger::flushPendingBatchDispatched,
+                    d_self.acquireWeak()),
+                generation),
+            &d_clusterData_p->cluster());
+        return;  // RETURN
+    }
+
+    // Cancel the timer of a previous batch, if still pending, rather than
+    // only releasing the handle to it: it would otherwise still fire.  Note
+    // that its flush, if already enqueued, is discarded since it is of an
+    // older generation.
+    d_clusterData_p->scheduler().cancelEvent(d_batchFlushEventHandle);
+    d_clusterData_p->scheduler().scheduleEvent(
+        &d_batchFlushEventHandle,
+        d_clusterData_p->scheduler().now() + d_maxBatchLatency,
+        bdlf::BindUtil::bindS(
+            d_allocator_p,
+            bmqu::WeakMemFnUtil::weakMemFn(
+                &IncoreClusterStateLedger::onBatchFlushTimeout,
+                d_self.acquireWeak()),
+            generation));
+}
+
+void IncoreClusterStateLedger::onBatchFlushTimeout(int generation)
+{
+    // executed by the *SCHEDULER* thread
+
+    d_clusterData_p->cluster().dispatcher()->execute(
+        bdlf::BindUtil::bindS(
+            d_allocator_p,
+            bmqu::WeakMemFnUtil::weakMemFn(
+                &IncoreClusterStateLedger::flushPendingBatchDispatched,
+                d_self.acquireWeak()),
+            generation),
+        &d_clusterData_p->cluster());
+}
+
+void IncoreClusterStateLedger::flushPendingBatchDispatched(int generation)
+{
+    // executed by the *CLUSTER DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_clusterData_p->cluster().inDispatcherThread());
+
+    if (generation != d_pendingBatchGeneration || !d_isOpen) {
+        // Batch was already applied or canceled
+        return;  // RETURN
+    }
+
+    flushPendingBatch();
+}
+
+int IncoreClusterStateLedger::flushPendingBatch()
+{
+    // executed by the *CLUSTER DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_clusterData_p->cluster().inDispatcherThread());
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        /// Success
+        rc_SUCCESS = 0,
+        /// Self is no longer leader
+        rc_NOT_LEADER = -1,
+        /// Fail to apply the batched advisory
+        rc_APPLY_FAILURE = -2
+    };
+
+    if (d_pendingBatchSize == 0) {
+        return rc_SUCCESS;  // RETURN
+    }
+
+    if (!isSelfLeader()) {
+        BALL_LOG_WARN << description() << ": Canceling batch of "
+                      << d_pendingBatchSize << " queue (un)assignments. "
+                      << "Reason: self is no longer leader.";
+        cancelPendingBatch();
+        return rc_NOT_LEADER;  // RETURN
+    }
+
+    ++d_pendingBatchGeneration;
+    d_clusterData_p->scheduler().cancelEvent(d_batchFlushEventHandle);
+
+    bmqp_ctrlmsg::ClusterMessage batch(d_pendingBatch, d_allocator_p);
+    d_pendingBatch.reset();
+
+    bmqp_ctrlmsg::LeaderMessageSequence* lsn = advisorySequenceNumber(&batch);
+    d_clusterData_p->electorInfo().nextLeaderMessageSequence(lsn);
+
+    BALL_LOG_INFO << description() << ": Applying batch of "
+                  << d_pendingBatchSize
+                  << " queue (un)assignments with LSN " << printLSN(*lsn);
+    d_pendingBatchSize = 0;
+
+    const int rc = applyAdvisoryInternal(batch,
+                                         *lsn,
+                                         ClusterStateRecordType::e_UPDATE);
+    if (rc != 0) {
+        BALL_LOG_ERROR << description()
+                       << ": Failed to apply batched advisory: " << batch
+                       << ", rc: " << rc;
+
+        bmqp_ctrlmsg::ControlMessage controlMessage;
+        controlMessage.choice().makeClusterMessage(batch);
+        d_commitCb(controlMessage, ClusterStateLedgerCommitStatus::e_CANCELED);
+        return 10 * rc + rc_APPLY_FAILURE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+void IncoreClusterStateLedger::cancelPendingBatch()
+{
+    // executed by the *CLUSTER DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_clusterData_p->cluster().inDispatcherThread());
+
+    if (d_pendingBatchSize == 0) {
+        return;  // RETURN
+    }
+
+    ++d_pendingBatchGeneration;
+    d_clusterData_p->scheduler().cancelEvent(d_batchFlushEventHandle);
+
+    bmqp_ctrlmsg::ControlMessage controlMessage;
+    controlMessage.choice().makeClusterMessage(d_pendingBatch);
+    d_pendingBatch.reset();
+    d_pendingBatchSize = 0;
+
+    d_commitCb(controlMessage, ClusterStateLedgerCommitStatus::e_CANCELED);
+}
+
 int IncoreClusterStateLedger::applyAdvisoryInternal(
     const bmqp_ctrlmsg::ClusterMessage&        clusterMessage,
     const bmqp_ctrlmsg::LeaderMessageSequence& lsn,
@@ -690,6 +1075,22 @@ int IncoreClusterStateLedger::applyRecordInternalImpl(
                    ClusterStateLedgerCommitStatus::e_SUCCESS);
 
         d_uncommittedAdvisories.erase(iter);
+
+        // The cluster state now reflects the committed advisory, compact the
+        // ledger if due.  Failure to compact is not fatal: the records remain
+        // in the current log.
+        ++d_numCommitsSinceSnapshot;
+        if (d_snapshotInterval > 0 &&
+            d_numCommitsSinceSnapshot >= d_snapshotInterval) {
+            const int compactRc = compact();
+            if (compactRc < 0) {
+                BALL_LOG_WARN << description()
+                              << ": Failed to compact the ledger after "
+                              << d_numCommitsSinceSnapshot
+                              << " commits [rc: " << compactRc << "]";
+                d_numCommitsSinceSnapshot = 0;
+            }
+        }
     } break;  // BREAK
     case (ClusterStateRecordType::e_ACK): {
         // PRECONDITIONS
@@ -859,6 +1260,8 @@ void IncoreClusterStateLedger::cancelUncommittedAdvisories()
         }
     }
     d_uncommittedAdvisories.clear();
+
+    cancelPendingBatch();
 }
 
 void IncoreClusterStateLedger::reviewUncommittedAdvisories(
@@ -1288,6 +1691,19 @@ IncoreClusterStateLedger::IncoreClusterStateLedger(
 , d_uncommittedAdvisories(allocator)
 , d_gatedUpdateLsns(allocator)
 , d_appliedSnapshotTerm(0)
+, d_maxBatchSize(bsl::max(
+      1,
+      clusterDefinition.clusterAttributes().cslMaxBatchSize()))
+, d_maxBatchLatency()
+, d_pendingBatch(allocator)
+, d_pendingBatchSize(0)
+, d_pendingBatchGeneration(0)
+, d_batchFlushEventHandle()
+, d_self(this, allocator)
+, d_snapshotInterval(bsl::max(
+      0,
+      clusterDefinition.clusterAttributes().cslSnapshotInterval()))
+, d_numCommitsSinceSnapshot(0)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(clusterState);
@@ -1298,6 +1714,11 @@ IncoreClusterStateLedger::IncoreClusterStateLedger(
           << d_clusterData_p->identity().name() << ")";
     d_description.assign(osstr.str().data(), osstr.str().length());
 
+    const mqbcfg::ClusterAttributes& clusterAttributes =
+        clusterDefinition.clusterAttributes();
+    d_maxBatchLatency.addMilliseconds(
+        bsl::max(0, clusterAttributes.cslMaxBatchLatencyMs()));
+
     // Instantiate ledger config
     bsl::shared_ptr<mqbsi::LogIdGenerator> logIdGenerator(
         new (*d_allocator_p)
@@ -1329,7 +1750,11 @@ IncoreClusterStateLedger::IncoreClusterStateLedger(
         .setCleanupCallback(
             bdlf::BindUtil::bind(&IncoreClusterStateLedger::cleanupLog,
                                  this,
-                                 bdlf::PlaceHolders::_1));  // logPath
+                                 bdlf::PlaceHolders::_1))  // logPath
+        .setExecuteCallback(bdlf::BindUtil::bind(
+            &IncoreClusterStateLedger::executeInDispatcher,
+            this,
+            bdlf::PlaceHolders::_1));  // functor
 
     // At the moment the cluster and its *CLUSTER DISPATCHER* thread are not
     // started yet.
@@ -1341,6 +1766,8 @@ IncoreClusterStateLedger::IncoreClusterStateLedger(
 
 IncoreClusterStateLedger::~IncoreClusterStateLedger()
 {
+    d_self.invalidate();
+    d_clusterData_p->scheduler().cancelEventAndWait(&d_batchFlushEventHandle);
     d_clusterData_p->quorumManager().setCallback(0);
 }
 
@@ -1452,9 +1879,9 @@ int IncoreClusterStateLedger::apply(
     bmqp_ctrlmsg::ClusterMessage clusterMessage;
     clusterMessage.choice().makePartitionPrimaryAdvisory(advisory);
 
-    return applyAdvisoryInternal(clusterMessage,
-                                 advisory.sequenceNumber(),
-                                 ClusterStateRecordType::e_UPDATE);
+    return applyAdvisory(clusterMessage,
+                         advisory.sequenceNumber(),
+                         ClusterStateRecordType::e_UPDATE);
 }
 
 int IncoreClusterStateLedger::apply(
@@ -1469,9 +1896,9 @@ int IncoreClusterStateLedger::apply(
     bmqp_ctrlmsg::ClusterMessage clusterMessage;
     clusterMessage.choice().makeQueueAssignmentAdvisory(advisory);
 
-    return applyAdvisoryInternal(clusterMessage,
-                                 advisory.sequenceNumber(),
-                                 ClusterStateRecordType::e_UPDATE);
+    return applyAdvisory(clusterMessage,
+                         advisory.sequenceNumber(),
+                         ClusterStateRecordType::e_UPDATE);
 }
 
 int IncoreClusterStateLedger::apply(
@@ -1486,9 +1913,9 @@ int IncoreClusterStateLedger::apply(
     bmqp_ctrlmsg::ClusterMessage clusterMessage;
     clusterMessage.choice().makeQueueUnAssignmentAdvisory(advisory);
 
-    return applyAdvisoryInternal(clusterMessage,
-                                 advisory.sequenceNumber(),
-                                 ClusterStateRecordType::e_UPDATE);
+    return applyAdvisory(clusterMessage,
+                         advisory.sequenceNumber(),
+                         ClusterStateRecordType::e_UPDATE);
 }
 
 int IncoreClusterStateLedger::apply(
@@ -1503,9 +1930,9 @@ int IncoreClusterStateLedger::apply(
     bmqp_ctrlmsg::ClusterMessage clusterMessage;
     clusterMessage.choice().makeQueueUpdateAdvisory(advisory);
 
-    return applyAdvisoryInternal(clusterMessage,
-                                 advisory.sequenceNumber(),
-                                 ClusterStateRecordType::e_UPDATE);
+    return applyAdvisory(clusterMessage,
+                         advisory.sequenceNumber(),
+                         ClusterStateRecordType::e_UPDATE);
 }
 
 int IncoreClusterStateLedger::apply(
@@ -1520,9 +1947,9 @@ int IncoreClusterStateLedger::apply(
     bmqp_ctrlmsg::ClusterMessage clusterMessage;
     clusterMessage.choice().makeLeaderAdvisory(advisory);
 
-    return applyAdvisoryInternal(clusterMessage,
-                                 advisory.sequenceNumber(),
-                                 ClusterStateRecordType::e_SNAPSHOT);
+    return applyAdvisory(clusterMessage,
+                         advisory.sequenceNumber(),
+                         ClusterStateRecordType::e_SNAPSHOT);
 }
 
 int IncoreClusterStateLedger::apply(
@@ -1589,12 +2016,15 @@ void IncoreClusterStateLedger::uncommittedAdvisories(
     BSLS_ASSERT_SAFE(out);
 
     out->clear();
-    out->reserve(d_uncommittedAdvisories.size());
+    out->reserve(d_uncommittedAdvisories.size() + 1);
     for (AdvisoriesMapCIter it = d_uncommittedAdvisories.cbegin();
          it != d_uncommittedAdvisories.cend();
          ++it) {
         out->emplace_back(bsl::cref(it->second.d_clusterMessage));
     }
+    if (d_pendingBatchSize != 0) {
+        out->emplace_back(bsl::cref(d_pendingBatch));
+    }
 }
 
 bslma::ManagedPtr<ClusterStateLedgerIterator>
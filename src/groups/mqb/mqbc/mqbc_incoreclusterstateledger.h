@@ -30,9 +30,20 @@
 /// asynchronously to cluster nodes, and also advertise the update to cluster
 /// state's observers when appropriate consistency level has been achieved.
 /// Note that leader advisories are acknowledged individually by follower nodes
-/// and committed individually by the leader (as opposed to in batches or
-/// chunks).  The desired consistency level (eventual vs. strong) is configured
-/// by the user.  This component is in-core because cluster state is persisted,
+/// and committed individually by the leader.  To reduce the number of records
+/// and round-trips when many queues are (un)assigned at once (e.g., upon
+/// failover), the leader can be configured (see `cslMaxBatchSize` and
+/// `cslMaxBatchLatencyMs` in @bbref{mqbcfg::ClusterAttributes}) to coalesce
+/// consecutive queue assignment (resp. unassignment) advisories into a single
+/// advisory, which is then written, acknowledged and committed as a whole.
+/// Upon rollover to a new log, each node writes a snapshot of the cluster
+/// state at the beginning of the new log, so that a restarting node only
+/// needs to replay the latest log.  Each node can also be configured (see
+/// `cslSnapshotInterval` in @bbref{mqbcfg::ClusterAttributes}) to compact its
+/// ledger by rolling over after a number of commits, keeping that replay
+/// short regardless of the maximum size of a log.
+/// The desired consistency level (eventual vs. strong) is configured by the
+/// user.  This component is in-core because cluster state is persisted,
 /// replicated and maintained by BlazingMQ cluster nodes themselves instead of
 /// being offloaded to an external meta data server (e.g., ZooKeeper).
 ///
@@ -57,10 +68,13 @@
 #include <bmqc_orderedhashmap.h>
 #include <bmqp_ctrlmsg_messages.h>
 #include <bmqu_blob.h>
+#include <bmqu_sharedresource.h>
 
 // BDE
 #include <ball_log.h>
 #include <bdlbb_blob.h>
+#include <bdlmt_eventscheduler.h>
+#include <bsl_functional.h>
 #include <bsl_set.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
@@ -70,6 +84,7 @@
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
 
 namespace BloombergLP {
 
@@ -210,6 +225,42 @@ class IncoreClusterStateLedger BSLS_KEYWORD_FINAL : public ClusterStateLedger {
     /// An e_UPDATE whose term differs is gated, re-arming the gate each term.
     bsls::Types::Uint64 d_appliedSnapshotTerm;
 
+    /// Maximum number of queues (un)assigned by a single batched advisory.
+    /// Batching is disabled if this is 1.
+    int d_maxBatchSize;
+
+    /// Maximum time a queue (un)assignment may wait in the pending batch
+    /// before the batch is applied.
+    bsls::TimeInterval d_maxBatchLatency;
+
+    /// Queue (un)assignment advisories accepted by self leader and coalesced
+    /// into a single advisory, not applied to the ledger yet.
+    bmqp_ctrlmsg::ClusterMessage d_pendingBatch;
+
+    /// Number of queues (un)assigned by `d_pendingBatch`, 0 if there is no
+    /// pending batch.
+    int d_pendingBatchSize;
+
+    /// Generation of `d_pendingBatch`, incremented whenever a batch is
+    /// applied or canceled to invalidate stale flush events.
+    int d_pendingBatchGeneration;
+
+    /// Handle to the event applying `d_pendingBatch` upon
+    /// `d_maxBatchLatency`.
+    bdlmt::EventSchedulerEventHandle d_batchFlushEventHandle;
+
+    /// Used to make sure no flush of a pending batch is executed after this
+    /// object is destroyed.
+    bmqu::SharedResource<IncoreClusterStateLedger> d_self;
+
+    /// Number of commits after which the ledger is compacted by rolling over
+    /// to a new log starting with a snapshot.  Compaction is disabled if this
+    /// is 0.
+    int d_snapshotInterval;
+
+    /// Number of commits applied to the ledger since the last rollover.
+    int d_numCommitsSinceSnapshot;
+
   private:
     // NOT IMPLEMENTED
     IncoreClusterStateLedger(const IncoreClusterStateLedger&)
@@ -227,6 +278,13 @@ class IncoreClusterStateLedger BSLS_KEYWORD_FINAL : public ClusterStateLedger {
     /// during rollover to a new one.
     int cleanupLog(const bsl::string& logPath);
 
+    /// Callback invoked by the ledger to execute the specified `functor` in
+    /// the *CLUSTER DISPATCHER* thread, which is the thread writing to the
+    /// ledger.
+    ///
+    /// THREAD: This method is invoked in the scheduler's dispatcher thread.
+    void executeInDispatcher(const bsl::function<void()>& functor);
+
     /// Callback invoked upon internal rollover to a new log, providing the
     /// specified `oldLogId` (if any) and `newLogId`.  Return 0 on success and
     /// non-zero error value otherwise.
@@ -237,6 +295,60 @@ class IncoreClusterStateLedger BSLS_KEYWORD_FINAL : public ClusterStateLedger {
     /// value `ackQuorum`.
     void onQuorumChangeCb(unsigned int ackQuorum);
 
+    /// Compact the ledger by rolling over to a new log, which starts with a
+    /// snapshot of the cluster state followed by the uncommitted advisories,
+    /// the old log being cleaned up by the ledger.  Return 0 on success, 1 if
+    /// self is a follower which has not applied a snapshot for the current
+    /// term (in which case its cluster state may be incomplete and the ledger
+    /// is left as is), and a negative error value otherwise.
+    int compact();
+
+    /// Apply the advisory in the specified `clusterMessage`, of the specified
+    /// `recordType` and identified by the specified `lsn`, or add it to the
+    /// pending batch if it can be batched.  Notify via `commitCb` when
+    /// consistency level has been achieved.  Note that if a batch is pending
+    /// and the advisory cannot be added to it, the batch is applied first and
+    /// the advisory is assigned a new LSN to preserve their order, unless the
+    /// advisory is a snapshot, in which case the batch is canceled.  Note
+    /// that *only* a leader node may invoke this routine.
+    int applyAdvisory(const bmqp_ctrlmsg::ClusterMessage& clusterMessage,
+                      const bmqp_ctrlmsg::LeaderMessageSequence& lsn,
+                      ClusterStateRecordType::Enum recordType);
+
+    /// Add the queue (un)assignment advisory in the specified
+    /// `clusterMessage` and identified by the specified `lsn` to the pending
+    /// batch, applying the batch if it reaches `d_maxBatchSize` queues.
+    /// Return 0 if the advisory was accepted, and non-zero error value
+    /// otherwise.  Note that once accepted, failure to apply the batch is
+    /// notified via `commitCb` with `e_CANCELED` status.
+    int batchAdvisory(const bmqp_ctrlmsg::ClusterMessage& clusterMessage,
+                      const bmqp_ctrlmsg::LeaderMessageSequence& lsn);
+
+    /// Schedule the application of the pending batch after
+    /// `d_maxBatchLatency`, or once the cluster dispatcher thread has
+    /// processed its current event if `d_maxBatchLatency` is zero.
+    void scheduleBatchFlush();
+
+    /// Callback invoked by the scheduler when the pending batch of the
+    /// specified `generation` reached `d_maxBatchLatency`.
+    ///
+    /// THREAD: This method is invoked in the scheduler's dispatcher thread.
+    void onBatchFlushTimeout(int generation);
+
+    /// Apply the pending batch if it is of the specified `generation`.
+    ///
+    /// THREAD: This method can be invoked only in the associated cluster's
+    ///         dispatcher thread.
+    void flushPendingBatchDispatched(int generation);
+
+    /// Apply the pending batch, if any, under a new LSN.  Return 0 on
+    /// success, and non-zero error value otherwise, in which case the
+    /// batch is canceled and `commitCb` is notified.
+    int flushPendingBatch();
+
+    /// Cancel the pending batch, if any, and notify `commitCb`.
+    void cancelPendingBatch();
+
     /// Internal helper method to apply the advisory in the specified
     /// `clusterMessage`, of the specified `recordType` and identified by
     /// the specified `lsn`.  Notify via `commitCb` when consistency
@@ -277,7 +389,7 @@ class IncoreClusterStateLedger BSLS_KEYWORD_FINAL : public ClusterStateLedger {
     int applyCommit(const bmqp_ctrlmsg::LeaderMessageSequence& lsn,
                     unsigned int                               ackQuorum);
 
-    /// Cancel all uncommitted advisories.
+    /// Cancel all uncommitted advisories, including the pending batch.
     ///
     /// THREAD: This method can be invoked only in the associated cluster's
     ///         dispatcher thread.
@@ -352,7 +464,10 @@ class IncoreClusterStateLedger BSLS_KEYWORD_FINAL : public ClusterStateLedger {
     /// @{
     /// Apply the specified `advisory` to self and replicate to followers.
     /// Notify via `commitCb` when consistency level has been achieved.  Note
-    /// that *only* a leader node may invoke this routine.
+    /// that if batching is enabled, queue (un)assignment advisories are
+    /// coalesced and the advisory notified via `commitCb` may (un)assign
+    /// several queues.  Note that *only* a leader node may invoke this
+    /// routine.
     ///
     /// THREAD: This method can be invoked only in the associated cluster's
     ///         dispatcher thread.
@@ -33,6 +33,7 @@
 
 #include <bmqio_testchannel.h>
 #include <bmqu_memoutstream.h>
+#include <bmqu_printutil.h>
 #include <bmqu_time.h>
 
 // BDE
@@ -172,6 +173,59 @@ struct AdvisoryInfo {
     }
 };
 
+// ===================
+// struct TesterConfig
+// ===================
+
+/// Attributes of the cluster definition of the mock cluster of a `Tester`
+/// which are overridden by the `Tester`.
+struct TesterConfig {
+    // PUBLIC DATA
+    int d_maxBatchSize;
+    int d_maxBatchLatencyMs;
+
+    /// Maximum size of the CSL file, keeping the one of the mock cluster if
+    /// 0.
+    bsls::Types::Uint64 d_maxCSLFileSize;
+
+    int d_snapshotInterval;
+
+    // CREATORS
+    TesterConfig()
+    : d_maxBatchSize(1)
+    , d_maxBatchLatencyMs(0)
+    , d_maxCSLFileSize(0)
+    , d_snapshotInterval(0)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+    TesterConfig& setMaxBatchSize(int value)
+    {
+        d_maxBatchSize = value;
+        return *this;
+    }
+
+    TesterConfig& setMaxBatchLatencyMs(int value)
+    {
+        d_maxBatchLatencyMs = value;
+        return *this;
+    }
+
+    TesterConfig& setMaxCSLFileSize(bsls::Types::Uint64 value)
+    {
+        d_maxCSLFileSize = value;
+        return *this;
+    }
+
+    TesterConfig& setSnapshotInterval(int value)
+    {
+        d_snapshotInterval = value;
+        return *this;
+    }
+};
+
 // =============
 // struct Tester
 // =============
@@ -195,8 +249,13 @@ struct Tester {
 
   public:
     // CREATORS
+    /// Create a `Tester` for a cluster node which is the leader if the
+    /// optionally specified `isLeader` is true, storing the ledger at the
+    /// optionally specified `location`, and with the optionally specified
+    /// `config` overriding the cluster definition of the mock cluster.
     explicit Tester(bool                     isLeader = true,
-                    const bslstl::StringRef& location = "")
+                    const bslstl::StringRef& location = "",
+                    const TesterConfig&      config   = TesterConfig())
     : d_isLeader(isLeader)
     , d_tempDir(bmqtst::TestHelperUtil::allocator())
     , d_location(
@@ -285,10 +344,24 @@ struct Tester {
             ++pid;
         }
 
+        mqbcfg::ClusterDefinition clusterDefinition(
+            d_cluster_mp->_clusterDefinition(),
+            bmqtst::TestHelperUtil::allocator());
+        clusterDefinition.clusterAttributes().cslMaxBatchSize() =
+            config.d_maxBatchSize;
+        clusterDefinition.clusterAttributes().cslMaxBatchLatencyMs() =
+            config.d_maxBatchLatencyMs;
+        clusterDefinition.clusterAttributes().cslSnapshotInterval() =
+            config.d_snapshotInterval;
+        if (config.d_maxCSLFileSize != 0) {
+            clusterDefinition.partitionConfig().maxCSLFileSize() =
+                config.d_maxCSLFileSize;
+        }
+
         d_clusterStateLedger_mp.load(
             new (*bmqtst::TestHelperUtil::allocator())
                 mqbc::IncoreClusterStateLedger(
-                    d_cluster_mp->_clusterDefinition(),
+                    clusterDefinition,
                     d_cluster_mp->_clusterData(),
                     d_cluster_mp->_state(),
                     d_cluster_mp->_blobSpPool(),
@@ -2343,6 +2416,495 @@ static void test13_quorumChangeCb()
     BMQTST_ASSERT(tester.hasNoMoreBroadcastedMessages(2));
 }
 
+static void test14_batchQueueAssignments()
+// ------------------------------------------------------------------------
+// BATCH QUEUE ASSIGNMENTS
+//
+// Concerns:
+//   With batching enabled, queue assignment advisories applied at leader
+//   are coalesced into a single advisory, which is broadcast, acked and
+//   committed as a whole, when the batch is full, when its latency
+//   expires, or when an advisory which cannot be batched is applied, in
+//   which case the order of the advisories is preserved by re-sequencing
+//   that advisory after the batch.  A pending batch is canceled rather than
+//   applied before a snapshot, which does not include it.
+//
+// Testing:
+//   int apply(const bmqp_ctrlmsg::QueueAssignmentAdvisory& advisory);
+//   (with 'cslMaxBatchSize' and 'cslMaxBatchLatencyMs')
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BATCH QUEUE ASSIGNMENTS");
+
+    const int k_MAX_BATCH_SIZE       = 3;
+    const int k_MAX_BATCH_LATENCY_MS = 1000;
+
+    Tester                          tester(
+        true,  // isLeader
+        "",
+        TesterConfig()
+            .setMaxBatchSize(k_MAX_BATCH_SIZE)
+            .setMaxBatchLatencyMs(k_MAX_BATCH_LATENCY_MS));
+    mqbc::IncoreClusterStateLedger* obj = tester.d_clusterStateLedger_mp.get();
+    BSLS_ASSERT_OPT(obj->open() == 0);
+
+    // Flush events of the batch are executed from the test thread
+    tester.d_cluster_mp->_dispatcher().setEnqueueOnly(true);
+
+    // Like the callers of the ledger, assign its LSN to each advisory right
+    // before applying it, since applying a batch takes a new LSN.
+    mqbc::ElectorInfo& electorInfo =
+        tester.d_cluster_mp->_clusterData()->electorInfo();
+
+    bmqp_ctrlmsg::QueueAssignmentAdvisory qadvisories[6];
+    for (int i = 0; i < 6; ++i) {
+        bmqu::MemOutStream uri(bmqtst::TestHelperUtil::allocator());
+        uri << "bmq://bmq.test.mmap.priority/q" << i;
+
+        bmqp_ctrlmsg::QueueInfo qinfo;
+        qinfo.uri()         = uri.str();
+        qinfo.partitionId() = 1U;
+        mqbu::StorageKey key(mqbu::StorageKey::BinaryRepresentation(),
+                             "7777");
+        key.loadBinary(&qinfo.key());
+        qadvisories[i].queues().push_back(qinfo);
+    }
+
+    // 1. The batch is applied as soon as it is full
+    electorInfo.nextLeaderMessageSequence(&qadvisories[0].sequenceNumber());
+    BMQTST_ASSERT_EQ(obj->apply(qadvisories[0]), 0);
+    electorInfo.nextLeaderMessageSequence(&qadvisories[1].sequenceNumber());
+    BMQTST_ASSERT_EQ(obj->apply(qadvisories[1]), 0);
+    BMQTST_ASSERT(tester.hasNoMoreBroadcastedMessages(0));
+    electorInfo.nextLeaderMessageSequence(&qadvisories[2].sequenceNumber());
+    BMQTST_ASSERT_EQ(obj->apply(qadvisories[2]), 0);
+    BMQTST_ASSERT(tester.hasBroadcastedMessages(1));
+
+    const bmqp_ctrlmsg::ClusterMessage batch1 =
+        tester.broadcastedMessage(0).choice().clusterMessage();
+    BSLS_ASSERT_OPT(batch1.choice().isQueueAssignmentAdvisoryValue());
+    BMQTST_ASSERT_EQ(batch1.choice().queueAssignmentAdvisory().queues().size(),
+                     3U);
+    BMQTST_ASSERT_GT(
+        batch1.choice().queueAssignmentAdvisory().sequenceNumber(),
+        qadvisories[2].sequenceNumber());
+
+    // 2. The batch is applied before an advisory which cannot be batched
+    electorInfo.nextLeaderMessageSequence(&qadvisories[3].sequenceNumber());
+    BMQTST_ASSERT_EQ(obj->apply(qadvisories[3]), 0);
+
+    bmqp_ctrlmsg::PartitionPrimaryInfo pinfo;
+    pinfo.primaryNodeId()  = mqbmock::Cluster::k_LEADER_NODE_ID;
+    pinfo.partitionId()    = 1U;
+    pinfo.primaryLeaseId() = 2U;
+
+    bmqp_ctrlmsg::PartitionPrimaryAdvisory pmAdvisory;
+    pmAdvisory.partitions().push_back(pinfo);
+    electorInfo.nextLeaderMessageSequence(&pmAdvisory.sequenceNumber());
+    BMQTST_ASSERT_EQ(obj->apply(pmAdvisory), 0);
+    BMQTST_ASSERT(tester.hasBroadcastedMessages(3));
+
+    const bmqp_ctrlmsg::ClusterMessage batch2 =
+        tester.broadcastedMessage(1).choice().clusterMessage();
+    BSLS_ASSERT_OPT(batch2.choice().isQueueAssignmentAdvisoryValue());
+    BMQTST_ASSERT_EQ(batch2.choice().queueAssignmentAdvisory().queues(),
+                     qadvisories[3].queues());
+
+    const bmqp_ctrlmsg::ClusterMessage pmMessage =
+        tester.broadcastedMessage(2).choice().clusterMessage();
+    BSLS_ASSERT_OPT(pmMessage.choice().isPartitionPrimaryAdvisoryValue());
+    BMQTST_ASSERT_EQ(
+        pmMessage.choice().partitionPrimaryAdvisory().partitions(),
+        pmAdvisory.partitions());
+    BMQTST_ASSERT_GT(
+        pmMessage.choice().partitionPrimaryAdvisory().sequenceNumber(),
+        batch2.choice().queueAssignmentAdvisory().sequenceNumber());
+    BMQTST_ASSERT_GT(
+        batch2.choice().queueAssignmentAdvisory().sequenceNumber(),
+        pmAdvisory.sequenceNumber());
+
+    // The next LSN follows the one of the re-sequenced advisory
+    BMQTST_ASSERT_EQ(
+        electorInfo.leaderMessageSequence(),
+        pmMessage.choice().partitionPrimaryAdvisory().sequenceNumber());
+
+    // 3. The batch is applied upon its latency
+    electorInfo.nextLeaderMessageSequence(&qadvisories[4].sequenceNumber());
+    BMQTST_ASSERT_EQ(obj->apply(qadvisories[4]), 0);
+    tester.d_cluster_mp->_dispatcher().processQueue();
+    BMQTST_ASSERT(tester.hasNoMoreBroadcastedMessages(3));
+
+    tester.d_cluster_mp->advanceTime(1);
+    tester.d_cluster_mp->waitForScheduler();
+    tester.d_cluster_mp->_dispatcher().processQueue();
+    BMQTST_ASSERT(tester.hasBroadcastedMessages(4));
+
+    const bmqp_ctrlmsg::ClusterMessage batch3 =
+        tester.broadcastedMessage(3).choice().clusterMessage();
+    BSLS_ASSERT_OPT(batch3.choice().isQueueAssignmentAdvisoryValue());
+    BMQTST_ASSERT_EQ(batch3.choice().queueAssignmentAdvisory().queues(),
+                     qadvisories[4].queues());
+    BMQTST_ASSERT_GT(
+        batch3.choice().queueAssignmentAdvisory().sequenceNumber(),
+        pmMessage.choice().partitionPrimaryAdvisory().sequenceNumber());
+
+    // Each advisory is acked and committed as a whole
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), 0U);
+    tester.receiveAck(
+        obj,
+        batch1.choice().queueAssignmentAdvisory().sequenceNumber(),
+        3);
+    tester.receiveAck(
+        obj,
+        batch2.choice().queueAssignmentAdvisory().sequenceNumber(),
+        3);
+    tester.receiveAck(
+        obj,
+        pmMessage.choice().partitionPrimaryAdvisory().sequenceNumber(),
+        3);
+    tester.receiveAck(
+        obj,
+        batch3.choice().queueAssignmentAdvisory().sequenceNumber(),
+        3);
+
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), 4U);
+    BMQTST_ASSERT_EQ(tester.committedMessage(0).choice().clusterMessage(),
+                     batch1);
+    BMQTST_ASSERT_EQ(tester.committedMessage(1).choice().clusterMessage(),
+                     batch2);
+    BMQTST_ASSERT_EQ(tester.committedMessage(2).choice().clusterMessage(),
+                     pmMessage);
+    BMQTST_ASSERT_EQ(tester.committedMessage(3).choice().clusterMessage(),
+                     batch3);
+    BMQTST_ASSERT(tester.hasBroadcastedMessages(8));
+
+    // 4. The batch is canceled before a snapshot
+    electorInfo.nextLeaderMessageSequence(&qadvisories[5].sequenceNumber());
+    BMQTST_ASSERT_EQ(obj->apply(qadvisories[5]), 0);
+
+    bmqp_ctrlmsg::LeaderAdvisory leaderAdvisory;
+    leaderAdvisory.partitions().push_back(pinfo);
+    electorInfo.nextLeaderMessageSequence(&leaderAdvisory.sequenceNumber());
+    BMQTST_ASSERT_EQ(obj->apply(leaderAdvisory), 0);
+
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(), 5U);
+    const bmqp_ctrlmsg::ClusterMessage canceled =
+        tester.committedMessage(4).choice().clusterMessage();
+    BSLS_ASSERT_OPT(canceled.choice().isQueueAssignmentAdvisoryValue());
+    BMQTST_ASSERT_EQ(canceled.choice().queueAssignmentAdvisory().queues(),
+                     qadvisories[5].queues());
+
+    BMQTST_ASSERT(tester.hasBroadcastedMessages(9));
+    const bmqp_ctrlmsg::ClusterMessage snapshot =
+        tester.broadcastedMessage(8).choice().clusterMessage();
+    BSLS_ASSERT_OPT(snapshot.choice().isLeaderAdvisoryValue());
+    BMQTST_ASSERT_EQ(snapshot.choice().leaderAdvisory().sequenceNumber(),
+                     leaderAdvisory.sequenceNumber());
+
+    BSLS_ASSERT_OPT(obj->close() == 0);
+    BMQTST_ASSERT(tester.hasNoMoreBroadcastedMessages(9));
+}
+
+static void test15_compaction()
+// ------------------------------------------------------------------------
+// COMPACTION
+//
+// Concerns:
+//   With a snapshot interval configured, the ledger rolls over to a new log
+//   after that many commits, the new log starting with a snapshot of the
+//   cluster state, and the old log is cleaned up.  Loading the cluster state
+//   from the ledger yields all the committed advisories.
+//
+// Plan:
+//   1 Apply and commit 'k_SNAPSHOT_INTERVAL' queue assignments
+//   2 Verify the ledger rolled over and cleaned up its old log
+//   3 Apply and commit more queue assignments, triggering another rollover
+//   4 Verify the ledger consists of the latest snapshot, then the
+//     advisories committed since
+//   5 Load the cluster state from the ledger
+//
+// Testing:
+//   Compaction upon 'cslSnapshotInterval' commits.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COMPACTION");
+
+    const int                 k_SNAPSHOT_INTERVAL = 3;
+    const int                 k_NUM_QUEUES = 2 * k_SNAPSHOT_INTERVAL + 1;
+    const bsls::Types::Uint64 k_MAX_CSL_FILE_SIZE = 1024 * 1024;
+
+    Tester                          tester(
+        true,  // isLeader
+        "",
+        TesterConfig()
+            .setMaxCSLFileSize(k_MAX_CSL_FILE_SIZE)
+            .setSnapshotInterval(k_SNAPSHOT_INTERVAL));
+    mqbc::IncoreClusterStateLedger* obj = tester.d_clusterStateLedger_mp.get();
+    BSLS_ASSERT_OPT(obj->open() == 0);
+    BMQTST_ASSERT_EQ(obj->ledger()->numLogs(), 1U);
+
+    bsl::vector<bmqp_ctrlmsg::QueueAssignmentAdvisory> qadvisories(
+        k_NUM_QUEUES,
+        bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_NUM_QUEUES; ++i) {
+        tester.d_cluster_mp->_clusterData()
+            ->electorInfo()
+            .nextLeaderMessageSequence(&qadvisories[i].sequenceNumber());
+
+        bmqu::MemOutStream uri(bmqtst::TestHelperUtil::allocator());
+        uri << "bmq://bmq.test.mmap.priority/q" << i;
+
+        bmqp_ctrlmsg::QueueInfo qinfo;
+        qinfo.uri()         = uri.str();
+        qinfo.partitionId() = 1U;
+        mqbu::StorageKey(static_cast<unsigned int>(i + 1))
+            .loadBinary(&qinfo.key());
+        qadvisories[i].queues().push_back(qinfo);
+    }
+
+    // 1. Apply and commit 'k_SNAPSHOT_INTERVAL' queue assignments
+    for (int i = 0; i < k_SNAPSHOT_INTERVAL; ++i) {
+        BMQTST_ASSERT_EQ(obj->ledger()->numLogs(), 1U);
+        BMQTST_ASSERT_EQ(obj->apply(qadvisories[i]), 0);
+        tester.receiveAck(obj, qadvisories[i].sequenceNumber(), 3);
+    }
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(),
+                     static_cast<size_t>(k_SNAPSHOT_INTERVAL));
+
+    // 2. Verify the ledger rolled over and cleaned up its old log
+    BMQTST_ASSERT_EQ(obj->ledger()->numLogs(), 2U);
+    tester.d_cluster_mp->advanceTime(10);
+    tester.d_cluster_mp->waitForScheduler();
+    BMQTST_ASSERT_EQ(obj->ledger()->numLogs(), 1U);
+
+    // 3. Apply and commit more queue assignments, triggering another rollover
+    for (int i = k_SNAPSHOT_INTERVAL; i < k_NUM_QUEUES; ++i) {
+        BMQTST_ASSERT_EQ(obj->apply(qadvisories[i]), 0);
+        tester.receiveAck(obj, qadvisories[i].sequenceNumber(), 3);
+    }
+    BMQTST_ASSERT_EQ(tester.numCommittedMessages(),
+                     static_cast<size_t>(k_NUM_QUEUES));
+    tester.d_cluster_mp->advanceTime(10);
+    tester.d_cluster_mp->waitForScheduler();
+    BMQTST_ASSERT_EQ(obj->ledger()->numLogs(), 1U);
+
+    // 4. Verify the ledger consists of the latest snapshot, then the
+    //    advisories committed since
+    bslma::ManagedPtr<mqbc::ClusterStateLedgerIterator> cslIter =
+        obj->getIterator();
+
+    BMQTST_ASSERT_EQ(cslIter->next(), 0);
+    BMQTST_ASSERT_EQ(cslIter->header().recordType(),
+                     mqbc::ClusterStateRecordType::e_SNAPSHOT);
+    bmqp_ctrlmsg::ClusterMessage message;
+    BMQTST_ASSERT_EQ(cslIter->loadClusterMessage(&message), 0);
+    BSLS_ASSERT_OPT(message.choice().isLeaderAdvisoryValue());
+    BMQTST_ASSERT_EQ(message.choice().leaderAdvisory().queues().size(),
+                     static_cast<size_t>(2 * k_SNAPSHOT_INTERVAL));
+
+    BMQTST_ASSERT_EQ(cslIter->next(), 0);
+    BMQTST_ASSERT_EQ(cslIter->header().recordType(),
+                     mqbc::ClusterStateRecordType::e_UPDATE);
+    BMQTST_ASSERT_EQ(cslIter->loadClusterMessage(&message), 0);
+    BSLS_ASSERT_OPT(message.choice().isQueueAssignmentAdvisoryValue());
+    BMQTST_ASSERT_EQ(message.choice().queueAssignmentAdvisory(),
+                     qadvisories[k_NUM_QUEUES - 1]);
+
+    BMQTST_ASSERT_EQ(cslIter->next(), 0);
+    BMQTST_ASSERT_EQ(cslIter->header().recordType(),
+                     mqbc::ClusterStateRecordType::e_COMMIT);
+    BMQTST_ASSERT_EQ(cslIter->next(), 1);
+
+    // 5. Load the cluster state from the ledger
+    mqbc::ClusterState state(
+        tester.d_cluster_mp.get(),
+        tester.d_cluster_mp->_state()->partitions().size(),
+        true,  // isTemporary
+        bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(
+        mqbc::ClusterUtil::load(&state,
+                                obj->getIterator().get(),
+                                *tester.d_cluster_mp->_clusterData(),
+                                bmqtst::TestHelperUtil::allocator()),
+        0);
+
+    bsl::vector<bmqp_ctrlmsg::QueueInfo> queues(
+        bmqtst::TestHelperUtil::allocator());
+    mqbc::ClusterUtil::loadQueuesInfo(&queues, state);
+    BMQTST_ASSERT_EQ(queues.size(), static_cast<size_t>(k_NUM_QUEUES));
+
+    BSLS_ASSERT_OPT(obj->close() == 0);
+}
+
+static void testN1_queueAssignmentsConvergence()
+// ------------------------------------------------------------------------
+// QUEUE ASSIGNMENTS CONVERGENCE BENCHMARK
+//
+// Concerns:
+//   Measure the time for the leader to commit 10k queue assignments, as
+//   upon failover, with and without batching of the advisories.
+//
+// Testing:
+//   Performance of batched queue assignment advisories.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName(
+        "QUEUE ASSIGNMENTS CONVERGENCE BENCHMARK");
+
+    const int                 k_NUM_QUEUES        = 10000;
+    const int                 k_MAX_BATCH_SIZES[] = {1, 10, 100, 1000};
+    const bsls::Types::Uint64 k_MAX_CSL_FILE_SIZE = 256 * 1024 * 1024;
+
+    for (size_t i = 0; i < sizeof(k_MAX_BATCH_SIZES) / sizeof(int); ++i) {
+        const int maxBatchSize = k_MAX_BATCH_SIZES[i];
+
+        // The ledger must not roll over, as the rollover snapshot of all the
+        // queues assigned so far would not fit in the mock's CSL file.
+        Tester tester(true,  // isLeader
+                      "",
+                      TesterConfig()
+                          .setMaxBatchSize(maxBatchSize)
+                          .setMaxBatchLatencyMs(1000)
+                          .setMaxCSLFileSize(k_MAX_CSL_FILE_SIZE));
+        mqbc::IncoreClusterStateLedger* obj =
+            tester.d_clusterStateLedger_mp.get();
+        BSLS_ASSERT_OPT(obj->open() == 0);
+
+        mqbc::ElectorInfo& electorInfo =
+            tester.d_cluster_mp->_clusterData()->electorInfo();
+
+        const bsls::Types::Int64 start = bmqu::Time::highResolutionTimer();
+        for (int q = 0; q < k_NUM_QUEUES; ++q) {
+            bmqp_ctrlmsg::QueueAssignmentAdvisory qadvisory;
+            electorInfo.nextLeaderMessageSequence(&qadvisory.sequenceNumber());
+
+            bmqu::MemOutStream uri(bmqtst::TestHelperUtil::allocator());
+            uri << "bmq://bmq.test.mmap.priority/q" << q;
+
+            qadvisory.queues().resize(1);
+            qadvisory.queues().back().uri()         = uri.str();
+            qadvisory.queues().back().partitionId() = q % 4;
+            BSLS_ASSERT_OPT(obj->apply(qadvisory) == 0);
+
+            if ((q + 1) % maxBatchSize == 0) {
+                // The advisory was applied, possibly as part of a batch, and
+                // holds the latest LSN: let the followers ack it.
+                tester.receiveAck(obj,
+                                  electorInfo.leaderMessageSequence(),
+                                  3);
+            }
+        }
+        const bsls::Types::Int64 end = bmqu::Time::highResolutionTimer();
+
+        BMQTST_ASSERT_EQ(tester.numCommittedMessages(),
+                         static_cast<size_t>(k_NUM_QUEUES / maxBatchSize));
+
+        cout << "Committed " << k_NUM_QUEUES << " queue assignments with "
+             << "cslMaxBatchSize " << maxBatchSize << " in "
+             << bmqu::PrintUtil::prettyTimeInterval(end - start) << " ("
+             << tester.numMessagesSent() << " messages sent)" << endl;
+
+        BSLS_ASSERT_OPT(obj->close() == 0);
+    }
+}
+
+static void testN2_openAndReplay()
+// ------------------------------------------------------------------------
+// OPEN AND REPLAY BENCHMARK
+//
+// Concerns:
+//   Measure the time for a restarting node to open its ledger and load the
+//   cluster state from it, with 100k queues assigned by batches of 100, with
+//   and without compaction of the ledger.
+//
+// Testing:
+//   Performance of opening and replaying a compacted ledger.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("OPEN AND REPLAY BENCHMARK");
+
+    const int                 k_NUM_QUEUES           = 100000;
+    const int                 k_BATCH_SIZE           = 100;
+    const int                 k_SNAPSHOT_INTERVALS[] = {0, 100, 10};
+    const bsls::Types::Uint64 k_MAX_CSL_FILE_SIZE    = 512 * 1024 * 1024;
+
+    for (size_t i = 0; i < sizeof(k_SNAPSHOT_INTERVALS) / sizeof(int); ++i) {
+        const int snapshotInterval = k_SNAPSHOT_INTERVALS[i];
+
+        // Queue assignments are batched to keep the number of records
+        // written to the test channels reasonable.
+        Tester tester(true,  // isLeader
+                      "",
+                      TesterConfig()
+                          .setMaxBatchSize(k_BATCH_SIZE)
+                          .setMaxBatchLatencyMs(1000)
+                          .setMaxCSLFileSize(k_MAX_CSL_FILE_SIZE)
+                          .setSnapshotInterval(snapshotInterval));
+        mqbc::IncoreClusterStateLedger* obj =
+            tester.d_clusterStateLedger_mp.get();
+        BSLS_ASSERT_OPT(obj->open() == 0);
+
+        mqbc::ElectorInfo& electorInfo =
+            tester.d_cluster_mp->_clusterData()->electorInfo();
+
+        for (int q = 0; q < k_NUM_QUEUES; ++q) {
+            bmqp_ctrlmsg::QueueAssignmentAdvisory qadvisory;
+            electorInfo.nextLeaderMessageSequence(&qadvisory.sequenceNumber());
+
+            bmqu::MemOutStream uri(bmqtst::TestHelperUtil::allocator());
+            uri << "bmq://bmq.test.mmap.priority/q" << q;
+
+            qadvisory.queues().resize(1);
+            qadvisory.queues().back().uri()         = uri.str();
+            qadvisory.queues().back().partitionId() = q % 4;
+            mqbu::StorageKey(static_cast<unsigned int>(q + 1))
+                .loadBinary(&qadvisory.queues().back().key());
+            BSLS_ASSERT_OPT(obj->apply(qadvisory) == 0);
+
+            if ((q + 1) % k_BATCH_SIZE == 0) {
+                tester.receiveAck(obj,
+                                  electorInfo.leaderMessageSequence(),
+                                  3);
+            }
+        }
+
+        // Let the ledger clean up the logs it rolled over from
+        tester.d_cluster_mp->advanceTime(10);
+        tester.d_cluster_mp->waitForScheduler();
+        BSLS_ASSERT_OPT(obj->close() == 0);
+
+        // Reopen the ledger and load the cluster state from it
+        const bsls::Types::Int64 start = bmqu::Time::highResolutionTimer();
+        BSLS_ASSERT_OPT(obj->open() == 0);
+        const bsls::Types::Int64 opened = bmqu::Time::highResolutionTimer();
+
+        mqbc::ClusterState state(
+            tester.d_cluster_mp.get(),
+            tester.d_cluster_mp->_state()->partitions().size(),
+            true,  // isTemporary
+            bmqtst::TestHelperUtil::allocator());
+        BSLS_ASSERT_OPT(
+            mqbc::ClusterUtil::load(&state,
+                                    obj->getIterator().get(),
+                                    *tester.d_cluster_mp->_clusterData(),
+                                    bmqtst::TestHelperUtil::allocator()) == 0);
+        const bsls::Types::Int64 end = bmqu::Time::highResolutionTimer();
+
+        bsl::vector<bmqp_ctrlmsg::QueueInfo> queues(
+            bmqtst::TestHelperUtil::allocator());
+        mqbc::ClusterUtil::loadQueuesInfo(&queues, state);
+        BMQTST_ASSERT_EQ(queues.size(), static_cast<size_t>(k_NUM_QUEUES));
+
+        cout << "cslSnapshotInterval " << snapshotInterval << ": opened "
+             << obj->ledger()->totalNumBytes() << " bytes in "
+             << bmqu::PrintUtil::prettyTimeInterval(opened - start)
+             << ", loaded " << queues.size() << " queues in "
+             << bmqu::PrintUtil::prettyTimeInterval(end - opened) << endl;
+
+        BSLS_ASSERT_OPT(obj->close() == 0);
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2355,6 +2917,8 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 15: test15_compaction(); break;
+    case 14: test14_batchQueueAssignments(); break;
     case 13: test13_quorumChangeCb(); break;
     // @TODO RENABLE AND FIX THIS TEST
     //
@@ -2372,6 +2936,8 @@ int main(int argc, char* argv[])
     case 3: test3_apply_QueueAssignmentAdvisory(); break;
     case 2: test2_apply_PartitionPrimaryAdvisory(); break;
     case 1: test1_breathingTest(); break;
+    case -1: testN1_queueAssignmentsConvergence(); break;
+    case -2: testN2_openAndReplay(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND.\n";
         bmqtst::TestHelperUtil::testStatus() = -1;
@@ -1394,6 +1394,11 @@ int StorageUtil::assignPartitionDispatcherThreads(
             .setMaxJournalFileSize(config.maxJournalFileSize())
             .setMaxQlistFileSize(config.maxQlistFileSize())
             .setMaxArchivedFileSets(config.maxArchivedFileSets())
+            .setNextFileSetCreationPercent(
+                config.nextFileSetCreationPercent())
+            .setRecoveryParallelism(config.recoveryParallelism())
+            .setCheckpointInterval(config.checkpointInterval())
+            .setReplicationLatencyBudgetUs(config.replicationLatencyBudgetUs())
             .setRecoveredQueuesCb(recoveredQueuesCb)
             .setQueueCreationCb(queueCreationCb)
             .setQueueDeletionCb(queueDeletionCb);
@@ -206,6 +206,12 @@ const int
     ClusterAttributes::DEFAULT_INITIALIZER_PARTITION_FSM_WATCHDOG_NUM_RETRIES =
         1;
 
+const int ClusterAttributes::DEFAULT_INITIALIZER_CSL_MAX_BATCH_SIZE = 1;
+
+const int ClusterAttributes::DEFAULT_INITIALIZER_CSL_MAX_BATCH_LATENCY_MS = 0;
+
+const int ClusterAttributes::DEFAULT_INITIALIZER_CSL_SNAPSHOT_INTERVAL = 0;
+
 const bdlat_AttributeInfo ClusterAttributes::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_IS_C_S_L_MODE_ENABLED,
      "isCSLModeEnabled",
@@ -241,6 +247,21 @@ const bdlat_AttributeInfo ClusterAttributes::ATTRIBUTE_INFO_ARRAY[] = {
      "partitionFsmWatchdogNumRetries",
      sizeof("partitionFsmWatchdogNumRetries") - 1,
      "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_CSL_MAX_BATCH_SIZE,
+     "cslMaxBatchSize",
+     sizeof("cslMaxBatchSize") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_CSL_MAX_BATCH_LATENCY_MS,
+     "cslMaxBatchLatencyMs",
+     sizeof("cslMaxBatchLatencyMs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_CSL_SNAPSHOT_INTERVAL,
+     "cslSnapshotInterval",
+     sizeof("cslSnapshotInterval") - 1,
+     "",
      bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
@@ -248,7 +269,7 @@ const bdlat_AttributeInfo ClusterAttributes::ATTRIBUTE_INFO_ARRAY[] = {
 const bdlat_AttributeInfo*
 ClusterAttributes::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 7; ++i) {
+    for (int i = 0; i < 10; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             ClusterAttributes::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -283,6 +304,12 @@ const bdlat_AttributeInfo* ClusterAttributes::lookupAttributeInfo(int id)
     case ATTRIBUTE_ID_PARTITION_FSM_WATCHDOG_NUM_RETRIES:
         return &ATTRIBUTE_INFO_ARRAY
             [ATTRIBUTE_INDEX_PARTITION_FSM_WATCHDOG_NUM_RETRIES];
+    case ATTRIBUTE_ID_CSL_MAX_BATCH_SIZE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CSL_MAX_BATCH_SIZE];
+    case ATTRIBUTE_ID_CSL_MAX_BATCH_LATENCY_MS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CSL_MAX_BATCH_LATENCY_MS];
+    case ATTRIBUTE_ID_CSL_SNAPSHOT_INTERVAL:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CSL_SNAPSHOT_INTERVAL];
     default: return 0;
     }
 }
@@ -298,6 +325,9 @@ ClusterAttributes::ClusterAttributes()
       DEFAULT_INITIALIZER_PARTITION_FSM_WATCHDOG_TIMEOUT_SEC)
 , d_partitionFsmWatchdogNumRetries(
       DEFAULT_INITIALIZER_PARTITION_FSM_WATCHDOG_NUM_RETRIES)
+, d_cslMaxBatchSize(DEFAULT_INITIALIZER_CSL_MAX_BATCH_SIZE)
+, d_cslMaxBatchLatencyMs(DEFAULT_INITIALIZER_CSL_MAX_BATCH_LATENCY_MS)
+, d_cslSnapshotInterval(DEFAULT_INITIALIZER_CSL_SNAPSHOT_INTERVAL)
 , d_isCSLModeEnabled(DEFAULT_INITIALIZER_IS_C_S_L_MODE_ENABLED)
 , d_isFSMWorkflow(DEFAULT_INITIALIZER_IS_F_S_M_WORKFLOW)
 , d_doesFSMwriteQLIST(DEFAULT_INITIALIZER_DOES_F_S_MWRITE_Q_L_I_S_T)
@@ -319,6 +349,9 @@ void ClusterAttributes::reset()
         DEFAULT_INITIALIZER_PARTITION_FSM_WATCHDOG_TIMEOUT_SEC;
     d_partitionFsmWatchdogNumRetries =
         DEFAULT_INITIALIZER_PARTITION_FSM_WATCHDOG_NUM_RETRIES;
+    d_cslMaxBatchSize      = DEFAULT_INITIALIZER_CSL_MAX_BATCH_SIZE;
+    d_cslMaxBatchLatencyMs = DEFAULT_INITIALIZER_CSL_MAX_BATCH_LATENCY_MS;
+    d_cslSnapshotInterval  = DEFAULT_INITIALIZER_CSL_SNAPSHOT_INTERVAL;
 }
 
 // ACCESSORS
@@ -340,6 +373,11 @@ bsl::ostream& ClusterAttributes::print(bsl::ostream& stream,
                            this->partitionFsmWatchdogTimeoutSec());
     printer.printAttribute("partitionFsmWatchdogNumRetries",
                            this->partitionFsmWatchdogNumRetries());
+    printer.printAttribute("cslMaxBatchSize", this->cslMaxBatchSize());
+    printer.printAttribute("cslMaxBatchLatencyMs",
+                           this->cslMaxBatchLatencyMs());
+    printer.printAttribute("cslSnapshotInterval",
+                           this->cslSnapshotInterval());
     printer.end();
     return stream;
 }
@@ -675,6 +713,9 @@ bsl::ostream& Disallow::print(bsl::ostream& stream, int, int) const
 const char DispatcherProcessorParameters::CLASS_NAME[] =
     "DispatcherProcessorParameters";
 
+const int
+    DispatcherProcessorParameters::DEFAULT_INITIALIZER_MAX_BATCH_SIZE = 0;
+
 const bdlat_AttributeInfo
     DispatcherProcessorParameters::ATTRIBUTE_INFO_ARRAY[] = {
         {ATTRIBUTE_ID_QUEUE_SIZE,
@@ -691,7 +732,12 @@ const bdlat_AttributeInfo
          "queueSizeHighWatermark",
          sizeof("queueSizeHighWatermark") - 1,
          "",
-         bdlat_FormattingMode::e_DEC}};
+         bdlat_FormattingMode::e_DEC},
+        {ATTRIBUTE_ID_MAX_BATCH_SIZE,
+         "maxBatchSize",
+         sizeof("maxBatchSize") - 1,
+         "",
+         bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
@@ -699,7 +745,7 @@ const bdlat_AttributeInfo*
 DispatcherProcessorParameters::lookupAttributeInfo(const char* name,
                                                    int         nameLength)
 {
-    for (int i = 0; i < 3; ++i) {
+    for (int i = 0; i < 4; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             DispatcherProcessorParameters::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -723,6 +769,8 @@ DispatcherProcessorParameters::lookupAttributeInfo(int id)
     case ATTRIBUTE_ID_QUEUE_SIZE_HIGH_WATERMARK:
         return &ATTRIBUTE_INFO_ARRAY
             [ATTRIBUTE_INDEX_QUEUE_SIZE_HIGH_WATERMARK];
+    case ATTRIBUTE_ID_MAX_BATCH_SIZE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_BATCH_SIZE];
     default: return 0;
     }
 }
@@ -733,6 +781,7 @@ DispatcherProcessorParameters::DispatcherProcessorParameters()
 : d_queueSize()
 , d_queueSizeLowWatermark()
 , d_queueSizeHighWatermark()
+, d_maxBatchSize(DEFAULT_INITIALIZER_MAX_BATCH_SIZE)
 {
 }
 
@@ -743,6 +792,7 @@ void DispatcherProcessorParameters::reset()
     bdlat_ValueTypeFunctions::reset(&d_queueSize);
     bdlat_ValueTypeFunctions::reset(&d_queueSizeLowWatermark);
     bdlat_ValueTypeFunctions::reset(&d_queueSizeHighWatermark);
+    d_maxBatchSize = DEFAULT_INITIALIZER_MAX_BATCH_SIZE;
 }
 
 // ACCESSORS
@@ -758,10 +808,77 @@ bsl::ostream& DispatcherProcessorParameters::print(bsl::ostream& stream,
                            this->queueSizeLowWatermark());
     printer.printAttribute("queueSizeHighWatermark",
                            this->queueSizeHighWatermark());
+    printer.printAttribute("maxBatchSize", this->maxBatchSize());
     printer.end();
     return stream;
 }
 
+// -------------------------
+// class DispatcherQueueType
+// -------------------------
+
+// CONSTANTS
+
+const char DispatcherQueueType::CLASS_NAME[] = "DispatcherQueueType";
+
+const bdlat_EnumeratorInfo DispatcherQueueType::ENUMERATOR_INFO_ARRAY[] = {
+    {DispatcherQueueType::e_E_SINGLE_CONSUMER_QUEUE,
+     "E_SINGLE_CONSUMER_QUEUE",
+     sizeof("E_SINGLE_CONSUMER_QUEUE") - 1,
+     ""},
+    {DispatcherQueueType::e_E_RING_BUFFER,
+     "E_RING_BUFFER",
+     sizeof("E_RING_BUFFER") - 1,
+     ""}};
+
+// CLASS METHODS
+
+int DispatcherQueueType::fromInt(DispatcherQueueType::Value* result,
+                                 int                         number)
+{
+    switch (number) {
+    case DispatcherQueueType::e_E_SINGLE_CONSUMER_QUEUE:
+    case DispatcherQueueType::e_E_RING_BUFFER:
+        *result = static_cast<DispatcherQueueType::Value>(number);
+        return 0;
+    default: return -1;
+    }
+}
+
+int DispatcherQueueType::fromString(DispatcherQueueType::Value* result,
+                                    const char*                 string,
+                                    int                         stringLength)
+{
+    for (int i = 0; i < 2; ++i) {
+        const bdlat_EnumeratorInfo& enumeratorInfo =
+            DispatcherQueueType::ENUMERATOR_INFO_ARRAY[i];
+
+        if (stringLength == enumeratorInfo.d_nameLength &&
+            0 == bsl::memcmp(enumeratorInfo.d_name_p, string, stringLength)) {
+            *result = static_cast<DispatcherQueueType::Value>(
+                enumeratorInfo.d_value);
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+const char* DispatcherQueueType::toString(DispatcherQueueType::Value value)
+{
+    switch (value) {
+    case e_E_SINGLE_CONSUMER_QUEUE: {
+        return "E_SINGLE_CONSUMER_QUEUE";
+    }
+    case e_E_RING_BUFFER: {
+        return "E_RING_BUFFER";
+    }
+    }
+
+    BSLS_ASSERT(!"invalid enumerator");
+    return 0;
+}
+
 // -------------------
 // class ElectorConfig
 // -------------------
@@ -4086,6 +4203,13 @@ const char* ClusterNodeConnection::selectionName() const
 const char DispatcherProcessorConfig::CLASS_NAME[] =
     "DispatcherProcessorConfig";
 
+const int
+    DispatcherProcessorConfig::DEFAULT_INITIALIZER_REBALANCE_INTERVAL_MS = 0;
+
+const int DispatcherProcessorConfig::DEFAULT_INITIALIZER_FIRST_CPU = 0;
+
+const int DispatcherProcessorConfig::DEFAULT_INITIALIZER_NUM_CPUS = 0;
+
 const bdlat_AttributeInfo DispatcherProcessorConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NUM_PROCESSORS,
      "numProcessors",
@@ -4096,7 +4220,22 @@ const bdlat_AttributeInfo DispatcherProcessorConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "processorConfig",
      sizeof("processorConfig") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_REBALANCE_INTERVAL_MS,
+     "rebalanceIntervalMs",
+     sizeof("rebalanceIntervalMs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_FIRST_CPU,
+     "firstCpu",
+     sizeof("firstCpu") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_NUM_CPUS,
+     "numCpus",
+     sizeof("numCpus") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
@@ -4104,7 +4243,7 @@ const bdlat_AttributeInfo*
 DispatcherProcessorConfig::lookupAttributeInfo(const char* name,
                                                int         nameLength)
 {
-    for (int i = 0; i < 2; ++i) {
+    for (int i = 0; i < 5; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             DispatcherProcessorConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -4125,6 +4264,12 @@ DispatcherProcessorConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_PROCESSORS];
     case ATTRIBUTE_ID_PROCESSOR_CONFIG:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_CONFIG];
+    case ATTRIBUTE_ID_REBALANCE_INTERVAL_MS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REBALANCE_INTERVAL_MS];
+    case ATTRIBUTE_ID_FIRST_CPU:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIRST_CPU];
+    case ATTRIBUTE_ID_NUM_CPUS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_CPUS];
     default: return 0;
     }
 }
@@ -4134,6 +4279,9 @@ DispatcherProcessorConfig::lookupAttributeInfo(int id)
 DispatcherProcessorConfig::DispatcherProcessorConfig()
 : d_processorConfig()
 , d_numProcessors()
+, d_rebalanceIntervalMs(DEFAULT_INITIALIZER_REBALANCE_INTERVAL_MS)
+, d_firstCpu(DEFAULT_INITIALIZER_FIRST_CPU)
+, d_numCpus(DEFAULT_INITIALIZER_NUM_CPUS)
 {
 }
 
@@ -4143,6 +4291,9 @@ void DispatcherProcessorConfig::reset()
 {
     bdlat_ValueTypeFunctions::reset(&d_numProcessors);
     bdlat_ValueTypeFunctions::reset(&d_processorConfig);
+    d_rebalanceIntervalMs = DEFAULT_INITIALIZER_REBALANCE_INTERVAL_MS;
+    d_firstCpu            = DEFAULT_INITIALIZER_FIRST_CPU;
+    d_numCpus             = DEFAULT_INITIALIZER_NUM_CPUS;
 }
 
 // ACCESSORS
@@ -4155,6 +4306,9 @@ bsl::ostream& DispatcherProcessorConfig::print(bsl::ostream& stream,
     printer.start();
     printer.printAttribute("numProcessors", this->numProcessors());
     printer.printAttribute("processorConfig", this->processorConfig());
+    printer.printAttribute("rebalanceIntervalMs", this->rebalanceIntervalMs());
+    printer.printAttribute("firstCpu", this->firstCpu());
+    printer.printAttribute("numCpus", this->numCpus());
     printer.end();
     return stream;
 }
@@ -4452,6 +4606,16 @@ const bool PartitionConfig::DEFAULT_INITIALIZER_PREFAULT_PAGES = false;
 
 const bool PartitionConfig::DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN = true;
 
+const int PartitionConfig::DEFAULT_INITIALIZER_NEXT_FILE_SET_CREATION_PERCENT =
+    0;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_RECOVERY_PARALLELISM = 0;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_CHECKPOINT_INTERVAL = 0;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_REPLICATION_LATENCY_BUDGET_US =
+    0;
+
 const bdlat_AttributeInfo PartitionConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NUM_PARTITIONS,
      "numPartitions",
@@ -4512,14 +4676,34 @@ const bdlat_AttributeInfo PartitionConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "syncConfig",
      sizeof("syncConfig") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_NEXT_FILE_SET_CREATION_PERCENT,
+     "nextFileSetCreationPercent",
+     sizeof("nextFileSetCreationPercent") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_RECOVERY_PARALLELISM,
+     "recoveryParallelism",
+     sizeof("recoveryParallelism") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_CHECKPOINT_INTERVAL,
+     "checkpointInterval",
+     sizeof("checkpointInterval") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_REPLICATION_LATENCY_BUDGET_US,
+     "replicationLatencyBudgetUs",
+     sizeof("replicationLatencyBudgetUs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 PartitionConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 12; ++i) {
+    for (int i = 0; i < 16; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             PartitionConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -4559,6 +4743,16 @@ const bdlat_AttributeInfo* PartitionConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN];
     case ATTRIBUTE_ID_SYNC_CONFIG:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG];
+    case ATTRIBUTE_ID_NEXT_FILE_SET_CREATION_PERCENT:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_NEXT_FILE_SET_CREATION_PERCENT];
+    case ATTRIBUTE_ID_RECOVERY_PARALLELISM:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_PARALLELISM];
+    case ATTRIBUTE_ID_CHECKPOINT_INTERVAL:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CHECKPOINT_INTERVAL];
+    case ATTRIBUTE_ID_REPLICATION_LATENCY_BUDGET_US:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_REPLICATION_LATENCY_BUDGET_US];
     default: return 0;
     }
 }
@@ -4575,6 +4769,12 @@ PartitionConfig::PartitionConfig(bslma::Allocator* basicAllocator)
 , d_syncConfig()
 , d_numPartitions()
 , d_maxArchivedFileSets()
+, d_nextFileSetCreationPercent(
+      DEFAULT_INITIALIZER_NEXT_FILE_SET_CREATION_PERCENT)
+, d_recoveryParallelism(DEFAULT_INITIALIZER_RECOVERY_PARALLELISM)
+, d_checkpointInterval(DEFAULT_INITIALIZER_CHECKPOINT_INTERVAL)
+, d_replicationLatencyBudgetUs(
+      DEFAULT_INITIALIZER_REPLICATION_LATENCY_BUDGET_US)
 , d_preallocate(DEFAULT_INITIALIZER_PREALLOCATE)
 , d_prefaultPages(DEFAULT_INITIALIZER_PREFAULT_PAGES)
 , d_flushAtShutdown(DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN)
@@ -4592,6 +4792,10 @@ PartitionConfig::PartitionConfig(const PartitionConfig& original,
 , d_syncConfig(original.d_syncConfig)
 , d_numPartitions(original.d_numPartitions)
 , d_maxArchivedFileSets(original.d_maxArchivedFileSets)
+, d_nextFileSetCreationPercent(original.d_nextFileSetCreationPercent)
+, d_recoveryParallelism(original.d_recoveryParallelism)
+, d_checkpointInterval(original.d_checkpointInterval)
+, d_replicationLatencyBudgetUs(original.d_replicationLatencyBudgetUs)
 , d_preallocate(original.d_preallocate)
 , d_prefaultPages(original.d_prefaultPages)
 , d_flushAtShutdown(original.d_flushAtShutdown)
@@ -4610,6 +4814,12 @@ PartitionConfig::PartitionConfig(PartitionConfig&& original) noexcept
   d_syncConfig(bsl::move(original.d_syncConfig)),
   d_numPartitions(bsl::move(original.d_numPartitions)),
   d_maxArchivedFileSets(bsl::move(original.d_maxArchivedFileSets)),
+  d_nextFileSetCreationPercent(
+      bsl::move(original.d_nextFileSetCreationPercent)),
+  d_recoveryParallelism(bsl::move(original.d_recoveryParallelism)),
+  d_checkpointInterval(bsl::move(original.d_checkpointInterval)),
+  d_replicationLatencyBudgetUs(
+      bsl::move(original.d_replicationLatencyBudgetUs)),
   d_preallocate(bsl::move(original.d_preallocate)),
   d_prefaultPages(bsl::move(original.d_prefaultPages)),
   d_flushAtShutdown(bsl::move(original.d_flushAtShutdown))
@@ -4627,6 +4837,12 @@ PartitionConfig::PartitionConfig(PartitionConfig&& original,
 , d_syncConfig(bsl::move(original.d_syncConfig))
 , d_numPartitions(bsl::move(original.d_numPartitions))
 , d_maxArchivedFileSets(bsl::move(original.d_maxArchivedFileSets))
+, d_nextFileSetCreationPercent(
+      bsl::move(original.d_nextFileSetCreationPercent))
+, d_recoveryParallelism(bsl::move(original.d_recoveryParallelism))
+, d_checkpointInterval(bsl::move(original.d_checkpointInterval))
+, d_replicationLatencyBudgetUs(
+      bsl::move(original.d_replicationLatencyBudgetUs))
 , d_preallocate(bsl::move(original.d_preallocate))
 , d_prefaultPages(bsl::move(original.d_prefaultPages))
 , d_flushAtShutdown(bsl::move(original.d_flushAtShutdown))
@@ -4643,18 +4859,22 @@ PartitionConfig::~PartitionConfig()
 PartitionConfig& PartitionConfig::operator=(const PartitionConfig& rhs)
 {
     if (this != &rhs) {
-        d_numPartitions       = rhs.d_numPartitions;
-        d_location            = rhs.d_location;
-        d_archiveLocation     = rhs.d_archiveLocation;
-        d_maxDataFileSize     = rhs.d_maxDataFileSize;
-        d_maxJournalFileSize  = rhs.d_maxJournalFileSize;
-        d_maxQlistFileSize    = rhs.d_maxQlistFileSize;
-        d_maxCSLFileSize      = rhs.d_maxCSLFileSize;
-        d_preallocate         = rhs.d_preallocate;
-        d_maxArchivedFileSets = rhs.d_maxArchivedFileSets;
-        d_prefaultPages       = rhs.d_prefaultPages;
-        d_flushAtShutdown     = rhs.d_flushAtShutdown;
-        d_syncConfig          = rhs.d_syncConfig;
+        d_numPartitions              = rhs.d_numPartitions;
+        d_location                   = rhs.d_location;
+        d_archiveLocation            = rhs.d_archiveLocation;
+        d_maxDataFileSize            = rhs.d_maxDataFileSize;
+        d_maxJournalFileSize         = rhs.d_maxJournalFileSize;
+        d_maxQlistFileSize           = rhs.d_maxQlistFileSize;
+        d_maxCSLFileSize             = rhs.d_maxCSLFileSize;
+        d_preallocate                = rhs.d_preallocate;
+        d_maxArchivedFileSets        = rhs.d_maxArchivedFileSets;
+        d_prefaultPages              = rhs.d_prefaultPages;
+        d_flushAtShutdown            = rhs.d_flushAtShutdown;
+        d_syncConfig                 = rhs.d_syncConfig;
+        d_nextFileSetCreationPercent = rhs.d_nextFileSetCreationPercent;
+        d_recoveryParallelism        = rhs.d_recoveryParallelism;
+        d_checkpointInterval         = rhs.d_checkpointInterval;
+        d_replicationLatencyBudgetUs = rhs.d_replicationLatencyBudgetUs;
     }
 
     return *this;
@@ -4665,18 +4885,24 @@ PartitionConfig& PartitionConfig::operator=(const PartitionConfig& rhs)
 PartitionConfig& PartitionConfig::operator=(PartitionConfig&& rhs)
 {
     if (this != &rhs) {
-        d_numPartitions       = bsl::move(rhs.d_numPartitions);
-        d_location            = bsl::move(rhs.d_location);
-        d_archiveLocation     = bsl::move(rhs.d_archiveLocation);
-        d_maxDataFileSize     = bsl::move(rhs.d_maxDataFileSize);
-        d_maxJournalFileSize  = bsl::move(rhs.d_maxJournalFileSize);
-        d_maxQlistFileSize    = bsl::move(rhs.d_maxQlistFileSize);
-        d_maxCSLFileSize      = bsl::move(rhs.d_maxCSLFileSize);
-        d_preallocate         = bsl::move(rhs.d_preallocate);
-        d_maxArchivedFileSets = bsl::move(rhs.d_maxArchivedFileSets);
-        d_prefaultPages       = bsl::move(rhs.d_prefaultPages);
-        d_flushAtShutdown     = bsl::move(rhs.d_flushAtShutdown);
-        d_syncConfig          = bsl::move(rhs.d_syncConfig);
+        d_numPartitions              = bsl::move(rhs.d_numPartitions);
+        d_location                   = bsl::move(rhs.d_location);
+        d_archiveLocation            = bsl::move(rhs.d_archiveLocation);
+        d_maxDataFileSize            = bsl::move(rhs.d_maxDataFileSize);
+        d_maxJournalFileSize         = bsl::move(rhs.d_maxJournalFileSize);
+        d_maxQlistFileSize           = bsl::move(rhs.d_maxQlistFileSize);
+        d_maxCSLFileSize             = bsl::move(rhs.d_maxCSLFileSize);
+        d_preallocate                = bsl::move(rhs.d_preallocate);
+        d_maxArchivedFileSets        = bsl::move(rhs.d_maxArchivedFileSets);
+        d_prefaultPages              = bsl::move(rhs.d_prefaultPages);
+        d_flushAtShutdown            = bsl::move(rhs.d_flushAtShutdown);
+        d_syncConfig                 = bsl::move(rhs.d_syncConfig);
+        d_nextFileSetCreationPercent = bsl::move(
+            rhs.d_nextFileSetCreationPercent);
+        d_recoveryParallelism        = bsl::move(rhs.d_recoveryParallelism);
+        d_checkpointInterval         = bsl::move(rhs.d_checkpointInterval);
+        d_replicationLatencyBudgetUs = bsl::move(
+            rhs.d_replicationLatencyBudgetUs);
     }
 
     return *this;
@@ -4697,6 +4923,12 @@ void PartitionConfig::reset()
     d_prefaultPages   = DEFAULT_INITIALIZER_PREFAULT_PAGES;
     d_flushAtShutdown = DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN;
     bdlat_ValueTypeFunctions::reset(&d_syncConfig);
+    d_nextFileSetCreationPercent =
+        DEFAULT_INITIALIZER_NEXT_FILE_SET_CREATION_PERCENT;
+    d_recoveryParallelism = DEFAULT_INITIALIZER_RECOVERY_PARALLELISM;
+    d_checkpointInterval  = DEFAULT_INITIALIZER_CHECKPOINT_INTERVAL;
+    d_replicationLatencyBudgetUs =
+        DEFAULT_INITIALIZER_REPLICATION_LATENCY_BUDGET_US;
 }
 
 // ACCESSORS
@@ -4719,6 +4951,12 @@ bsl::ostream& PartitionConfig::print(bsl::ostream& stream,
     printer.printAttribute("prefaultPages", this->prefaultPages());
     printer.printAttribute("flushAtShutdown", this->flushAtShutdown());
     printer.printAttribute("syncConfig", this->syncConfig());
+    printer.printAttribute("nextFileSetCreationPercent",
+                           this->nextFileSetCreationPercent());
+    printer.printAttribute("recoveryParallelism", this->recoveryParallelism());
+    printer.printAttribute("checkpointInterval", this->checkpointInterval());
+    printer.printAttribute("replicationLatencyBudgetUs",
+                           this->replicationLatencyBudgetUs());
     printer.end();
     return stream;
 }
@@ -6039,6 +6277,10 @@ const int DispatcherConfig::DEFAULT_INITIALIZER_ALARM_TIMEOUT_MS = 180000;
 
 const int DispatcherConfig::DEFAULT_INITIALIZER_WARNING_TIMEOUT_MS = 10000;
 
+const DispatcherQueueType::Value
+    DispatcherConfig::DEFAULT_INITIALIZER_PROCESSOR_QUEUE_TYPE =
+        DispatcherQueueType::E_SINGLE_CONSUMER_QUEUE;
+
 const bdlat_AttributeInfo DispatcherConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_SESSIONS,
      "sessions",
@@ -6064,14 +6306,19 @@ const bdlat_AttributeInfo DispatcherConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "warningTimeoutMs",
      sizeof("warningTimeoutMs") - 1,
      "",
-     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_PROCESSOR_QUEUE_TYPE,
+     "processorQueueType",
+     sizeof("processorQueueType") - 1,
+     "",
+     bdlat_FormattingMode::e_DEFAULT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 DispatcherConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 5; ++i) {
+    for (int i = 0; i < 6; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             DispatcherConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -6097,6 +6344,8 @@ const bdlat_AttributeInfo* DispatcherConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ALARM_TIMEOUT_MS];
     case ATTRIBUTE_ID_WARNING_TIMEOUT_MS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WARNING_TIMEOUT_MS];
+    case ATTRIBUTE_ID_PROCESSOR_QUEUE_TYPE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_QUEUE_TYPE];
     default: return 0;
     }
 }
@@ -6109,6 +6358,7 @@ DispatcherConfig::DispatcherConfig()
 , d_clusters()
 , d_alarmTimeoutMs(DEFAULT_INITIALIZER_ALARM_TIMEOUT_MS)
 , d_warningTimeoutMs(DEFAULT_INITIALIZER_WARNING_TIMEOUT_MS)
+, d_processorQueueType(DEFAULT_INITIALIZER_PROCESSOR_QUEUE_TYPE)
 {
 }
 
@@ -6119,8 +6369,9 @@ void DispatcherConfig::reset()
     bdlat_ValueTypeFunctions::reset(&d_sessions);
     bdlat_ValueTypeFunctions::reset(&d_queues);
     bdlat_ValueTypeFunctions::reset(&d_clusters);
-    d_alarmTimeoutMs   = DEFAULT_INITIALIZER_ALARM_TIMEOUT_MS;
-    d_warningTimeoutMs = DEFAULT_INITIALIZER_WARNING_TIMEOUT_MS;
+    d_alarmTimeoutMs     = DEFAULT_INITIALIZER_ALARM_TIMEOUT_MS;
+    d_warningTimeoutMs   = DEFAULT_INITIALIZER_WARNING_TIMEOUT_MS;
+    d_processorQueueType = DEFAULT_INITIALIZER_PROCESSOR_QUEUE_TYPE;
 }
 
 // ACCESSORS
@@ -6136,6 +6387,7 @@ bsl::ostream& DispatcherConfig::print(bsl::ostream& stream,
     printer.printAttribute("clusters", this->clusters());
     printer.printAttribute("alarmTimeoutMs", this->alarmTimeoutMs());
     printer.printAttribute("warningTimeoutMs", this->warningTimeoutMs());
+    printer.printAttribute("processorQueueType", this->processorQueueType());
     printer.end();
     return stream;
 }
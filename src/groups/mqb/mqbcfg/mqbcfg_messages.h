@@ -460,7 +460,18 @@ namespace mqbcfg {
 /// in seconds for Partition FSM watchdog.  Only applies when 'isFSMWorkflow'
 /// is true.  partitionFsmWatchdogNumRetries.: number of retries for Partition
 /// FSM watchdog before we give up and terminate the broker.  Only applies when
-/// 'isFSMWorkflow' is true.
+/// 'isFSMWorkflow' is true.  cslMaxBatchSize................: maximum number
+/// of queue (un)assignments the leader coalesces into a single cluster state
+/// ledger advisory, acknowledged and committed as a whole.  A value of 1
+/// disables batching.  cslMaxBatchLatencyMs...........: maximum time in
+/// milliseconds a queue (un)assignment may wait in a pending batch.  A value
+/// of 0 flushes the batch once the cluster dispatcher thread has processed
+/// its current event.  Only applies when 'cslMaxBatchSize' is greater than 1.
+/// cslSnapshotInterval............: number of committed advisories after
+/// which each node compacts its cluster state ledger by rolling over to a new
+/// file starting with a snapshot of the cluster state, so that a restarting
+/// node replays the snapshot and a short tail only.  A value of 0 disables
+/// compaction, the ledger then rolling over only when full.
 class ClusterAttributes {
     // INSTANCE DATA
 
@@ -468,6 +479,9 @@ class ClusterAttributes {
     int  d_clusterFsmWatchdogNumRetries;
     int  d_partitionFsmWatchdogTimeoutSec;
     int  d_partitionFsmWatchdogNumRetries;
+    int  d_cslMaxBatchSize;
+    int  d_cslMaxBatchLatencyMs;
+    int  d_cslSnapshotInterval;
     bool d_isCSLModeEnabled;
     bool d_isFSMWorkflow;
     bool d_doesFSMwriteQLIST;
@@ -489,10 +503,13 @@ class ClusterAttributes {
         ATTRIBUTE_ID_CLUSTER_FSM_WATCHDOG_TIMEOUT_SEC   = 3,
         ATTRIBUTE_ID_CLUSTER_FSM_WATCHDOG_NUM_RETRIES   = 4,
         ATTRIBUTE_ID_PARTITION_FSM_WATCHDOG_TIMEOUT_SEC = 5,
-        ATTRIBUTE_ID_PARTITION_FSM_WATCHDOG_NUM_RETRIES = 6
+        ATTRIBUTE_ID_PARTITION_FSM_WATCHDOG_NUM_RETRIES = 6,
+        ATTRIBUTE_ID_CSL_MAX_BATCH_SIZE                 = 7,
+        ATTRIBUTE_ID_CSL_MAX_BATCH_LATENCY_MS           = 8,
+        ATTRIBUTE_ID_CSL_SNAPSHOT_INTERVAL              = 9
     };
 
-    enum { NUM_ATTRIBUTES = 7 };
+    enum { NUM_ATTRIBUTES = 10 };
 
     enum {
         ATTRIBUTE_INDEX_IS_C_S_L_MODE_ENABLED              = 0,
@@ -501,7 +518,10 @@ class ClusterAttributes {
         ATTRIBUTE_INDEX_CLUSTER_FSM_WATCHDOG_TIMEOUT_SEC   = 3,
         ATTRIBUTE_INDEX_CLUSTER_FSM_WATCHDOG_NUM_RETRIES   = 4,
         ATTRIBUTE_INDEX_PARTITION_FSM_WATCHDOG_TIMEOUT_SEC = 5,
-        ATTRIBUTE_INDEX_PARTITION_FSM_WATCHDOG_NUM_RETRIES = 6
+        ATTRIBUTE_INDEX_PARTITION_FSM_WATCHDOG_NUM_RETRIES = 6,
+        ATTRIBUTE_INDEX_CSL_MAX_BATCH_SIZE                 = 7,
+        ATTRIBUTE_INDEX_CSL_MAX_BATCH_LATENCY_MS           = 8,
+        ATTRIBUTE_INDEX_CSL_SNAPSHOT_INTERVAL              = 9
     };
 
     // CONSTANTS
@@ -522,6 +542,12 @@ class ClusterAttributes {
 
     static const int DEFAULT_INITIALIZER_PARTITION_FSM_WATCHDOG_NUM_RETRIES;
 
+    static const int DEFAULT_INITIALIZER_CSL_MAX_BATCH_SIZE;
+
+    static const int DEFAULT_INITIALIZER_CSL_MAX_BATCH_LATENCY_MS;
+
+    static const int DEFAULT_INITIALIZER_CSL_SNAPSHOT_INTERVAL;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -605,6 +631,18 @@ class ClusterAttributes {
     /// attribute of this object.
     int& partitionFsmWatchdogNumRetries();
 
+    /// Return a reference to the modifiable "CslMaxBatchSize" attribute of
+    /// this object.
+    int& cslMaxBatchSize();
+
+    /// Return a reference to the modifiable "CslMaxBatchLatencyMs" attribute
+    /// of this object.
+    int& cslMaxBatchLatencyMs();
+
+    /// Return a reference to the modifiable "CslSnapshotInterval" attribute
+    /// of this object.
+    int& cslSnapshotInterval();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -674,6 +712,17 @@ class ClusterAttributes {
     /// this object.
     int partitionFsmWatchdogNumRetries() const;
 
+    /// Return the value of the "CslMaxBatchSize" attribute of this object.
+    int cslMaxBatchSize() const;
+
+    /// Return the value of the "CslMaxBatchLatencyMs" attribute of this
+    /// object.
+    int cslMaxBatchLatencyMs() const;
+
+    /// Return the value of the "CslSnapshotInterval" attribute of this
+    /// object.
+    int cslSnapshotInterval() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -1410,33 +1459,40 @@ class DispatcherProcessorParameters {
     int d_queueSize;
     int d_queueSizeLowWatermark;
     int d_queueSizeHighWatermark;
+    int d_maxBatchSize;
 
     // PRIVATE ACCESSORS
 
     template <typename t_HASH_ALGORITHM>
     void hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const;
 
+    bool isEqualTo(const DispatcherProcessorParameters& rhs) const;
+
   public:
     // TYPES
 
     enum {
         ATTRIBUTE_ID_QUEUE_SIZE                = 0,
         ATTRIBUTE_ID_QUEUE_SIZE_LOW_WATERMARK  = 1,
-        ATTRIBUTE_ID_QUEUE_SIZE_HIGH_WATERMARK = 2
+        ATTRIBUTE_ID_QUEUE_SIZE_HIGH_WATERMARK = 2,
+        ATTRIBUTE_ID_MAX_BATCH_SIZE            = 3
     };
 
-    enum { NUM_ATTRIBUTES = 3 };
+    enum { NUM_ATTRIBUTES = 4 };
 
     enum {
         ATTRIBUTE_INDEX_QUEUE_SIZE                = 0,
         ATTRIBUTE_INDEX_QUEUE_SIZE_LOW_WATERMARK  = 1,
-        ATTRIBUTE_INDEX_QUEUE_SIZE_HIGH_WATERMARK = 2
+        ATTRIBUTE_INDEX_QUEUE_SIZE_HIGH_WATERMARK = 2,
+        ATTRIBUTE_INDEX_MAX_BATCH_SIZE            = 3
     };
 
     // CONSTANTS
 
     static const char CLASS_NAME[];
 
+    static const int DEFAULT_INITIALIZER_MAX_BATCH_SIZE;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -1505,6 +1561,10 @@ class DispatcherProcessorParameters {
     /// of this object.
     int& queueSizeHighWatermark();
 
+    /// Return a reference to the modifiable "MaxBatchSize" attribute of this
+    /// object.
+    int& maxBatchSize();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -1560,6 +1620,9 @@ class DispatcherProcessorParameters {
     /// object.
     int queueSizeHighWatermark() const;
 
+    /// Return the value of the "MaxBatchSize" attribute of this object.
+    int maxBatchSize() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -1568,9 +1631,7 @@ class DispatcherProcessorParameters {
     friend bool operator==(const DispatcherProcessorParameters& lhs,
                            const DispatcherProcessorParameters& rhs)
     {
-        return lhs.queueSize() == rhs.queueSize() &&
-               lhs.queueSizeLowWatermark() == rhs.queueSizeLowWatermark() &&
-               lhs.queueSizeHighWatermark() == rhs.queueSizeHighWatermark();
+        return lhs.isEqualTo(rhs);
     }
 
     /// Return `true` if the specified `lhs` and `rhs` objects do not have the
@@ -1613,6 +1674,77 @@ struct bdlat_UsesDefaultValueFlag<mqbcfg::DispatcherProcessorParameters>
 
 namespace mqbcfg {
 
+// =========================
+// class DispatcherQueueType
+// =========================
+
+/// Enumeration of the queue implementations available to the processors of
+/// the dispatcher: - E_SINGLE_CONSUMER_QUEUE: unbounded, node-based, queue -
+/// E_RING_BUFFER:           bounded, preallocated, lock-free ring buffer,
+/// sized by the 'queueSize' of the processors
+struct DispatcherQueueType {
+  public:
+    // TYPES
+    enum Value {
+        e_E_SINGLE_CONSUMER_QUEUE = 0,
+        e_E_RING_BUFFER           = 1,
+
+        E_SINGLE_CONSUMER_QUEUE = e_E_SINGLE_CONSUMER_QUEUE,
+        E_RING_BUFFER           = e_E_RING_BUFFER
+    };
+
+    enum { k_NUM_ENUMERATORS = 2, NUM_ENUMERATORS = k_NUM_ENUMERATORS };
+
+    // CONSTANTS
+    static const char CLASS_NAME[];
+
+    static const bdlat_EnumeratorInfo ENUMERATOR_INFO_ARRAY[];
+
+    // CLASS METHODS
+    /// Return the string representation exactly matching the enumerator
+    /// name corresponding to the specified enumeration `value`.
+    static const char* toString(Value value);
+
+    /// Load into the specified `result` the enumerator matching the
+    /// specified `string` of the specified `stringLength`.  Return 0 on
+    /// success, and a non-zero value with no effect on `result` otherwise
+    /// (i.e., `string` does not match any enumerator).
+    static int fromString(Value* result, const char* string, int stringLength);
+
+    /// Load into the specified `result` the enumerator matching the
+    /// specified `string`.  Return 0 on success, and a non-zero value with
+    /// no effect on `result` otherwise (i.e., `string` does not match any
+    /// enumerator).
+    static int fromString(Value* result, const bsl::string& string);
+
+    /// Load into the specified `result` the enumerator matching the
+    /// specified `number`.  Return 0 on success, and a non-zero value with
+    /// no effect on `result` otherwise (i.e., `number` does not match any
+    /// enumerator).
+    static int fromInt(Value* result, int number);
+
+    /// Write to the specified `stream` the string representation of
+    /// the specified enumeration `value`.  Return a reference to
+    /// the modifiable `stream`.
+    static bsl::ostream& print(bsl::ostream& stream, Value value);
+
+    // HIDDEN FRIENDS
+    /// Format the specified `rhs` to the specified output `stream` and
+    /// return a reference to the modifiable `stream`.
+    friend bsl::ostream& operator<<(bsl::ostream& stream, Value rhs)
+    {
+        return DispatcherQueueType::print(stream, rhs);
+    }
+};
+
+}  // close package namespace
+
+// TRAITS
+
+BDLAT_DECL_ENUMERATION_TRAITS(mqbcfg::DispatcherQueueType);
+
+namespace mqbcfg {
+
 // ===================
 // class ElectorConfig
 // ===================
@@ -6308,26 +6440,48 @@ class DispatcherProcessorConfig {
 
     DispatcherProcessorParameters d_processorConfig;
     int                           d_numProcessors;
+    int                           d_rebalanceIntervalMs;
+    int                           d_firstCpu;
+    int                           d_numCpus;
+
+    // PRIVATE ACCESSORS
+
+    template <typename t_HASH_ALGORITHM>
+    void hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const;
+
+    bool isEqualTo(const DispatcherProcessorConfig& rhs) const;
 
   public:
     // TYPES
 
     enum {
-        ATTRIBUTE_ID_NUM_PROCESSORS   = 0,
-        ATTRIBUTE_ID_PROCESSOR_CONFIG = 1
+        ATTRIBUTE_ID_NUM_PROCESSORS        = 0,
+        ATTRIBUTE_ID_PROCESSOR_CONFIG      = 1,
+        ATTRIBUTE_ID_REBALANCE_INTERVAL_MS = 2,
+        ATTRIBUTE_ID_FIRST_CPU             = 3,
+        ATTRIBUTE_ID_NUM_CPUS              = 4
     };
 
-    enum { NUM_ATTRIBUTES = 2 };
+    enum { NUM_ATTRIBUTES = 5 };
 
     enum {
-        ATTRIBUTE_INDEX_NUM_PROCESSORS   = 0,
-        ATTRIBUTE_INDEX_PROCESSOR_CONFIG = 1
+        ATTRIBUTE_INDEX_NUM_PROCESSORS        = 0,
+        ATTRIBUTE_INDEX_PROCESSOR_CONFIG      = 1,
+        ATTRIBUTE_INDEX_REBALANCE_INTERVAL_MS = 2,
+        ATTRIBUTE_INDEX_FIRST_CPU             = 3,
+        ATTRIBUTE_INDEX_NUM_CPUS              = 4
     };
 
     // CONSTANTS
 
     static const char CLASS_NAME[];
 
+    static const int DEFAULT_INITIALIZER_REBALANCE_INTERVAL_MS;
+
+    static const int DEFAULT_INITIALIZER_FIRST_CPU;
+
+    static const int DEFAULT_INITIALIZER_NUM_CPUS;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -6392,6 +6546,18 @@ class DispatcherProcessorConfig {
     /// this object.
     DispatcherProcessorParameters& processorConfig();
 
+    /// Return a reference to the modifiable "RebalanceIntervalMs" attribute
+    /// of this object.
+    int& rebalanceIntervalMs();
+
+    /// Return a reference to the modifiable "FirstCpu" attribute of this
+    /// object.
+    int& firstCpu();
+
+    /// Return a reference to the modifiable "NumCpus" attribute of this
+    /// object.
+    int& numCpus();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -6443,6 +6609,16 @@ class DispatcherProcessorConfig {
     /// "ProcessorConfig" attribute of this object.
     const DispatcherProcessorParameters& processorConfig() const;
 
+    /// Return the value of the "RebalanceIntervalMs" attribute of this
+    /// object.
+    int rebalanceIntervalMs() const;
+
+    /// Return the value of the "FirstCpu" attribute of this object.
+    int firstCpu() const;
+
+    /// Return the value of the "NumCpus" attribute of this object.
+    int numCpus() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -6451,8 +6627,7 @@ class DispatcherProcessorConfig {
     friend bool operator==(const DispatcherProcessorConfig& lhs,
                            const DispatcherProcessorConfig& rhs)
     {
-        return lhs.numProcessors() == rhs.numProcessors() &&
-               lhs.processorConfig() == rhs.processorConfig();
+        return lhs.isEqualTo(rhs);
     }
 
     /// Return `true` if the specified `lhs` and `rhs` objects do not have the
@@ -6478,9 +6653,7 @@ class DispatcherProcessorConfig {
     friend void hashAppend(t_HASH_ALGORITHM&                hashAlg,
                            const DispatcherProcessorConfig& object)
     {
-        using bslh::hashAppend;
-        hashAppend(hashAlg, object.numProcessors());
-        hashAppend(hashAlg, object.processorConfig());
+        object.hashAppendImpl(hashAlg);
     }
 };
 
@@ -6850,7 +7023,22 @@ namespace mqbcfg {
 /// to populate (prefault) page tables for a mapping.  flushAtShutdown......:
 /// flag to indicate whether broker should flush storage files to disk at
 /// shutdown syncConfig...........: configuration for storage synchronization
-/// and recovery
+/// and recovery nextFileSetCreationPercent: fill ratio, in percent, of the
+/// active file set of a partition above which the next file set is created in
+/// the background, so that rollover does not have to create it.  0 disables
+/// background creation recoveryParallelism..: maximum number of threads
+/// validating the messages of a partition recovered from local storage at
+/// startup: the partition's dispatcher thread and up to `recoveryParallelism
+/// - 1` threads started for the duration of the validation, each validating
+/// at least 4096 messages.  0 or 1 validates on the dispatcher thread only
+/// checkpointInterval...: number of regular sync points between two
+/// checkpoints of the journal written alongside the active file set, so that
+/// recovery only replays the journal records written after the last
+/// checkpoint.  0 disables checkpoints replicationLatencyBudgetUs: latency, in
+/// microseconds, that batching the storage messages replicated by the
+/// primary may add to their replication.  Batches grow with the rate of
+/// messages and are sent early when it drops, so as to stay within this
+/// budget.  0 sends a batch every 100 messages
 class PartitionConfig {
     // INSTANCE DATA
 
@@ -6863,6 +7051,10 @@ class PartitionConfig {
     StorageSyncConfig   d_syncConfig;
     int                 d_numPartitions;
     int                 d_maxArchivedFileSets;
+    int                 d_nextFileSetCreationPercent;
+    int                 d_recoveryParallelism;
+    int                 d_checkpointInterval;
+    int                 d_replicationLatencyBudgetUs;
     bool                d_preallocate;
     bool                d_prefaultPages;
     bool                d_flushAtShutdown;
@@ -6878,35 +7070,43 @@ class PartitionConfig {
     // TYPES
 
     enum {
-        ATTRIBUTE_ID_NUM_PARTITIONS         = 0,
-        ATTRIBUTE_ID_LOCATION               = 1,
-        ATTRIBUTE_ID_ARCHIVE_LOCATION       = 2,
-        ATTRIBUTE_ID_MAX_DATA_FILE_SIZE     = 3,
-        ATTRIBUTE_ID_MAX_JOURNAL_FILE_SIZE  = 4,
-        ATTRIBUTE_ID_MAX_QLIST_FILE_SIZE    = 5,
-        ATTRIBUTE_ID_MAX_C_S_L_FILE_SIZE    = 6,
-        ATTRIBUTE_ID_PREALLOCATE            = 7,
-        ATTRIBUTE_ID_MAX_ARCHIVED_FILE_SETS = 8,
-        ATTRIBUTE_ID_PREFAULT_PAGES         = 9,
-        ATTRIBUTE_ID_FLUSH_AT_SHUTDOWN      = 10,
-        ATTRIBUTE_ID_SYNC_CONFIG            = 11
+        ATTRIBUTE_ID_NUM_PARTITIONS                 = 0,
+        ATTRIBUTE_ID_LOCATION                       = 1,
+        ATTRIBUTE_ID_ARCHIVE_LOCATION               = 2,
+        ATTRIBUTE_ID_MAX_DATA_FILE_SIZE             = 3,
+        ATTRIBUTE_ID_MAX_JOURNAL_FILE_SIZE          = 4,
+        ATTRIBUTE_ID_MAX_QLIST_FILE_SIZE            = 5,
+        ATTRIBUTE_ID_MAX_C_S_L_FILE_SIZE            = 6,
+        ATTRIBUTE_ID_PREALLOCATE                    = 7,
+        ATTRIBUTE_ID_MAX_ARCHIVED_FILE_SETS         = 8,
+        ATTRIBUTE_ID_PREFAULT_PAGES                 = 9,
+        ATTRIBUTE_ID_FLUSH_AT_SHUTDOWN              = 10,
+        ATTRIBUTE_ID_SYNC_CONFIG                    = 11,
+        ATTRIBUTE_ID_NEXT_FILE_SET_CREATION_PERCENT = 12,
+        ATTRIBUTE_ID_RECOVERY_PARALLELISM           = 13,
+        ATTRIBUTE_ID_CHECKPOINT_INTERVAL            = 14,
+        ATTRIBUTE_ID_REPLICATION_LATENCY_BUDGET_US  = 15
     };
 
-    enum { NUM_ATTRIBUTES = 12 };
+    enum { NUM_ATTRIBUTES = 16 };
 
     enum {
-        ATTRIBUTE_INDEX_NUM_PARTITIONS         = 0,
-        ATTRIBUTE_INDEX_LOCATION               = 1,
-        ATTRIBUTE_INDEX_ARCHIVE_LOCATION       = 2,
-        ATTRIBUTE_INDEX_MAX_DATA_FILE_SIZE     = 3,
-        ATTRIBUTE_INDEX_MAX_JOURNAL_FILE_SIZE  = 4,
-        ATTRIBUTE_INDEX_MAX_QLIST_FILE_SIZE    = 5,
-        ATTRIBUTE_INDEX_MAX_C_S_L_FILE_SIZE    = 6,
-        ATTRIBUTE_INDEX_PREALLOCATE            = 7,
-        ATTRIBUTE_INDEX_MAX_ARCHIVED_FILE_SETS = 8,
-        ATTRIBUTE_INDEX_PREFAULT_PAGES         = 9,
-        ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN      = 10,
-        ATTRIBUTE_INDEX_SYNC_CONFIG            = 11
+        ATTRIBUTE_INDEX_NUM_PARTITIONS                 = 0,
+        ATTRIBUTE_INDEX_LOCATION                       = 1,
+        ATTRIBUTE_INDEX_ARCHIVE_LOCATION               = 2,
+        ATTRIBUTE_INDEX_MAX_DATA_FILE_SIZE             = 3,
+        ATTRIBUTE_INDEX_MAX_JOURNAL_FILE_SIZE          = 4,
+        ATTRIBUTE_INDEX_MAX_QLIST_FILE_SIZE            = 5,
+        ATTRIBUTE_INDEX_MAX_C_S_L_FILE_SIZE            = 6,
+        ATTRIBUTE_INDEX_PREALLOCATE                    = 7,
+        ATTRIBUTE_INDEX_MAX_ARCHIVED_FILE_SETS         = 8,
+        ATTRIBUTE_INDEX_PREFAULT_PAGES                 = 9,
+        ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN              = 10,
+        ATTRIBUTE_INDEX_SYNC_CONFIG                    = 11,
+        ATTRIBUTE_INDEX_NEXT_FILE_SET_CREATION_PERCENT = 12,
+        ATTRIBUTE_INDEX_RECOVERY_PARALLELISM           = 13,
+        ATTRIBUTE_INDEX_CHECKPOINT_INTERVAL            = 14,
+        ATTRIBUTE_INDEX_REPLICATION_LATENCY_BUDGET_US  = 15
     };
 
     // CONSTANTS
@@ -6921,6 +7121,14 @@ class PartitionConfig {
 
     static const bool DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN;
 
+    static const int DEFAULT_INITIALIZER_NEXT_FILE_SET_CREATION_PERCENT;
+
+    static const int DEFAULT_INITIALIZER_RECOVERY_PARALLELISM;
+
+    static const int DEFAULT_INITIALIZER_CHECKPOINT_INTERVAL;
+
+    static const int DEFAULT_INITIALIZER_REPLICATION_LATENCY_BUDGET_US;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -7065,6 +7273,22 @@ class PartitionConfig {
     /// object.
     StorageSyncConfig& syncConfig();
 
+    /// Return a reference to the modifiable "NextFileSetCreationPercent"
+    /// attribute of this object.
+    int& nextFileSetCreationPercent();
+
+    /// Return a reference to the modifiable "RecoveryParallelism" attribute
+    /// of this object.
+    int& recoveryParallelism();
+
+    /// Return a reference to the modifiable "CheckpointInterval" attribute of
+    /// this object.
+    int& checkpointInterval();
+
+    /// Return a reference to the modifiable "ReplicationLatencyBudgetUs"
+    /// attribute of this object.
+    int& replicationLatencyBudgetUs();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -7148,6 +7372,21 @@ class PartitionConfig {
     /// attribute of this object.
     const StorageSyncConfig& syncConfig() const;
 
+    /// Return the value of the "NextFileSetCreationPercent" attribute of this
+    /// object.
+    int nextFileSetCreationPercent() const;
+
+    /// Return the value of the "RecoveryParallelism" attribute of this
+    /// object.
+    int recoveryParallelism() const;
+
+    /// Return the value of the "CheckpointInterval" attribute of this object.
+    int checkpointInterval() const;
+
+    /// Return the value of the "ReplicationLatencyBudgetUs" attribute of this
+    /// object.
+    int replicationLatencyBudgetUs() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -9276,11 +9515,12 @@ namespace mqbcfg {
 class DispatcherConfig {
     // INSTANCE DATA
 
-    DispatcherProcessorConfig d_sessions;
-    DispatcherProcessorConfig d_queues;
-    DispatcherProcessorConfig d_clusters;
-    int                       d_alarmTimeoutMs;
-    int                       d_warningTimeoutMs;
+    DispatcherProcessorConfig  d_sessions;
+    DispatcherProcessorConfig  d_queues;
+    DispatcherProcessorConfig  d_clusters;
+    int                        d_alarmTimeoutMs;
+    int                        d_warningTimeoutMs;
+    DispatcherQueueType::Value d_processorQueueType;
 
     // PRIVATE ACCESSORS
 
@@ -9293,21 +9533,23 @@ class DispatcherConfig {
     // TYPES
 
     enum {
-        ATTRIBUTE_ID_SESSIONS           = 0,
-        ATTRIBUTE_ID_QUEUES             = 1,
-        ATTRIBUTE_ID_CLUSTERS           = 2,
-        ATTRIBUTE_ID_ALARM_TIMEOUT_MS   = 3,
-        ATTRIBUTE_ID_WARNING_TIMEOUT_MS = 4
+        ATTRIBUTE_ID_SESSIONS             = 0,
+        ATTRIBUTE_ID_QUEUES               = 1,
+        ATTRIBUTE_ID_CLUSTERS             = 2,
+        ATTRIBUTE_ID_ALARM_TIMEOUT_MS     = 3,
+        ATTRIBUTE_ID_WARNING_TIMEOUT_MS   = 4,
+        ATTRIBUTE_ID_PROCESSOR_QUEUE_TYPE = 5
     };
 
-    enum { NUM_ATTRIBUTES = 5 };
+    enum { NUM_ATTRIBUTES = 6 };
 
     enum {
-        ATTRIBUTE_INDEX_SESSIONS           = 0,
-        ATTRIBUTE_INDEX_QUEUES             = 1,
-        ATTRIBUTE_INDEX_CLUSTERS           = 2,
-        ATTRIBUTE_INDEX_ALARM_TIMEOUT_MS   = 3,
-        ATTRIBUTE_INDEX_WARNING_TIMEOUT_MS = 4
+        ATTRIBUTE_INDEX_SESSIONS             = 0,
+        ATTRIBUTE_INDEX_QUEUES               = 1,
+        ATTRIBUTE_INDEX_CLUSTERS             = 2,
+        ATTRIBUTE_INDEX_ALARM_TIMEOUT_MS     = 3,
+        ATTRIBUTE_INDEX_WARNING_TIMEOUT_MS   = 4,
+        ATTRIBUTE_INDEX_PROCESSOR_QUEUE_TYPE = 5
     };
 
     // CONSTANTS
@@ -9318,6 +9560,9 @@ class DispatcherConfig {
 
     static const int DEFAULT_INITIALIZER_WARNING_TIMEOUT_MS;
 
+    static const DispatcherQueueType::Value
+        DEFAULT_INITIALIZER_PROCESSOR_QUEUE_TYPE;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -9392,6 +9637,10 @@ class DispatcherConfig {
     /// this object.
     int& warningTimeoutMs();
 
+    /// Return a reference to the modifiable "ProcessorQueueType" attribute of
+    /// this object.
+    DispatcherQueueType::Value& processorQueueType();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -9454,6 +9703,9 @@ class DispatcherConfig {
     /// Return the value of the "WarningTimeoutMs" attribute of this object.
     int warningTimeoutMs() const;
 
+    /// Return the value of the "ProcessorQueueType" attribute of this object.
+    DispatcherQueueType::Value processorQueueType() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -12775,6 +13027,9 @@ void ClusterAttributes::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->clusterFsmWatchdogNumRetries());
     hashAppend(hashAlgorithm, this->partitionFsmWatchdogTimeoutSec());
     hashAppend(hashAlgorithm, this->partitionFsmWatchdogNumRetries());
+    hashAppend(hashAlgorithm, this->cslMaxBatchSize());
+    hashAppend(hashAlgorithm, this->cslMaxBatchLatencyMs());
+    hashAppend(hashAlgorithm, this->cslSnapshotInterval());
 }
 
 inline bool ClusterAttributes::isEqualTo(const ClusterAttributes& rhs) const
@@ -12789,7 +13044,10 @@ inline bool ClusterAttributes::isEqualTo(const ClusterAttributes& rhs) const
            this->partitionFsmWatchdogTimeoutSec() ==
                rhs.partitionFsmWatchdogTimeoutSec() &&
            this->partitionFsmWatchdogNumRetries() ==
-               rhs.partitionFsmWatchdogNumRetries();
+               rhs.partitionFsmWatchdogNumRetries() &&
+           this->cslMaxBatchSize() == rhs.cslMaxBatchSize() &&
+           this->cslMaxBatchLatencyMs() == rhs.cslMaxBatchLatencyMs() &&
+           this->cslSnapshotInterval() == rhs.cslSnapshotInterval();
 }
 
 // CLASS METHODS
@@ -12849,6 +13107,27 @@ int ClusterAttributes::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_cslMaxBatchSize,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CSL_MAX_BATCH_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_cslMaxBatchLatencyMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CSL_MAX_BATCH_LATENCY_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_cslSnapshotInterval,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CSL_SNAPSHOT_INTERVAL]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -12897,6 +13176,21 @@ int ClusterAttributes::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             ATTRIBUTE_INFO_ARRAY
                 [ATTRIBUTE_INDEX_PARTITION_FSM_WATCHDOG_NUM_RETRIES]);
     }
+    case ATTRIBUTE_ID_CSL_MAX_BATCH_SIZE: {
+        return manipulator(
+            &d_cslMaxBatchSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CSL_MAX_BATCH_SIZE]);
+    }
+    case ATTRIBUTE_ID_CSL_MAX_BATCH_LATENCY_MS: {
+        return manipulator(
+            &d_cslMaxBatchLatencyMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CSL_MAX_BATCH_LATENCY_MS]);
+    }
+    case ATTRIBUTE_ID_CSL_SNAPSHOT_INTERVAL: {
+        return manipulator(
+            &d_cslSnapshotInterval,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CSL_SNAPSHOT_INTERVAL]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -12952,6 +13246,21 @@ inline int& ClusterAttributes::partitionFsmWatchdogNumRetries()
     return d_partitionFsmWatchdogNumRetries;
 }
 
+inline int& ClusterAttributes::cslMaxBatchSize()
+{
+    return d_cslMaxBatchSize;
+}
+
+inline int& ClusterAttributes::cslMaxBatchLatencyMs()
+{
+    return d_cslMaxBatchLatencyMs;
+}
+
+inline int& ClusterAttributes::cslSnapshotInterval()
+{
+    return d_cslSnapshotInterval;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int ClusterAttributes::accessAttributes(t_ACCESSOR& accessor) const
@@ -13006,6 +13315,26 @@ int ClusterAttributes::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_cslMaxBatchSize,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CSL_MAX_BATCH_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_cslMaxBatchLatencyMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CSL_MAX_BATCH_LATENCY_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_cslSnapshotInterval,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CSL_SNAPSHOT_INTERVAL]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -13054,6 +13383,21 @@ int ClusterAttributes::accessAttribute(t_ACCESSOR& accessor, int id) const
             ATTRIBUTE_INFO_ARRAY
                 [ATTRIBUTE_INDEX_PARTITION_FSM_WATCHDOG_NUM_RETRIES]);
     }
+    case ATTRIBUTE_ID_CSL_MAX_BATCH_SIZE: {
+        return accessor(
+            d_cslMaxBatchSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CSL_MAX_BATCH_SIZE]);
+    }
+    case ATTRIBUTE_ID_CSL_MAX_BATCH_LATENCY_MS: {
+        return accessor(
+            d_cslMaxBatchLatencyMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CSL_MAX_BATCH_LATENCY_MS]);
+    }
+    case ATTRIBUTE_ID_CSL_SNAPSHOT_INTERVAL: {
+        return accessor(
+            d_cslSnapshotInterval,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CSL_SNAPSHOT_INTERVAL]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -13109,6 +13453,21 @@ inline int ClusterAttributes::partitionFsmWatchdogNumRetries() const
     return d_partitionFsmWatchdogNumRetries;
 }
 
+inline int ClusterAttributes::cslMaxBatchSize() const
+{
+    return d_cslMaxBatchSize;
+}
+
+inline int ClusterAttributes::cslMaxBatchLatencyMs() const
+{
+    return d_cslMaxBatchLatencyMs;
+}
+
+inline int ClusterAttributes::cslSnapshotInterval() const
+{
+    return d_cslSnapshotInterval;
+}
+
 // --------------------------
 // class ClusterMonitorConfig
 // --------------------------
@@ -13689,6 +14048,16 @@ void DispatcherProcessorParameters::hashAppendImpl(
     hashAppend(hashAlgorithm, this->queueSize());
     hashAppend(hashAlgorithm, this->queueSizeLowWatermark());
     hashAppend(hashAlgorithm, this->queueSizeHighWatermark());
+    hashAppend(hashAlgorithm, this->maxBatchSize());
+}
+
+inline bool DispatcherProcessorParameters::isEqualTo(
+    const DispatcherProcessorParameters& rhs) const
+{
+    return this->queueSize() == rhs.queueSize() &&
+           this->queueSizeLowWatermark() == rhs.queueSizeLowWatermark() &&
+           this->queueSizeHighWatermark() == rhs.queueSizeHighWatermark() &&
+           this->maxBatchSize() == rhs.maxBatchSize();
 }
 
 // CLASS METHODS
@@ -13719,6 +14088,12 @@ int DispatcherProcessorParameters::manipulateAttributes(
         return ret;
     }
 
+    ret = manipulator(&d_maxBatchSize,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_BATCH_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -13744,6 +14119,11 @@ int DispatcherProcessorParameters::manipulateAttribute(
             &d_queueSizeHighWatermark,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_SIZE_HIGH_WATERMARK]);
     }
+    case ATTRIBUTE_ID_MAX_BATCH_SIZE: {
+        return manipulator(
+            &d_maxBatchSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_BATCH_SIZE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -13780,6 +14160,11 @@ inline int& DispatcherProcessorParameters::queueSizeHighWatermark()
     return d_queueSizeHighWatermark;
 }
 
+inline int& DispatcherProcessorParameters::maxBatchSize()
+{
+    return d_maxBatchSize;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int DispatcherProcessorParameters::accessAttributes(t_ACCESSOR& accessor) const
@@ -13806,6 +14191,12 @@ int DispatcherProcessorParameters::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_maxBatchSize,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_BATCH_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -13830,6 +14221,10 @@ int DispatcherProcessorParameters::accessAttribute(t_ACCESSOR& accessor,
             d_queueSizeHighWatermark,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_SIZE_HIGH_WATERMARK]);
     }
+    case ATTRIBUTE_ID_MAX_BATCH_SIZE: {
+        return accessor(d_maxBatchSize,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_BATCH_SIZE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -13865,6 +14260,31 @@ inline int DispatcherProcessorParameters::queueSizeHighWatermark() const
     return d_queueSizeHighWatermark;
 }
 
+inline int DispatcherProcessorParameters::maxBatchSize() const
+{
+    return d_maxBatchSize;
+}
+
+// -------------------------
+// class DispatcherQueueType
+// -------------------------
+
+// CLASS METHODS
+inline int DispatcherQueueType::fromString(Value*             result,
+                                           const bsl::string& string)
+{
+    return fromString(result,
+                      string.c_str(),
+                      static_cast<int>(string.length()));
+}
+
+inline bsl::ostream&
+DispatcherQueueType::print(bsl::ostream&              stream,
+                           DispatcherQueueType::Value value)
+{
+    return stream << toString(value);
+}
+
 // -------------------
 // class ElectorConfig
 // -------------------
@@ -17647,6 +18067,29 @@ inline bool ClusterNodeConnection::isUndefinedValue() const
 // class DispatcherProcessorConfig
 // -------------------------------
 
+// PRIVATE ACCESSORS
+template <typename t_HASH_ALGORITHM>
+void DispatcherProcessorConfig::hashAppendImpl(
+    t_HASH_ALGORITHM& hashAlgorithm) const
+{
+    using bslh::hashAppend;
+    hashAppend(hashAlgorithm, this->numProcessors());
+    hashAppend(hashAlgorithm, this->processorConfig());
+    hashAppend(hashAlgorithm, this->rebalanceIntervalMs());
+    hashAppend(hashAlgorithm, this->firstCpu());
+    hashAppend(hashAlgorithm, this->numCpus());
+}
+
+inline bool DispatcherProcessorConfig::isEqualTo(
+    const DispatcherProcessorConfig& rhs) const
+{
+    return this->numProcessors() == rhs.numProcessors() &&
+           this->processorConfig() == rhs.processorConfig() &&
+           this->rebalanceIntervalMs() == rhs.rebalanceIntervalMs() &&
+           this->firstCpu() == rhs.firstCpu() &&
+           this->numCpus() == rhs.numCpus();
+}
+
 // CLASS METHODS
 // MANIPULATORS
 template <typename t_MANIPULATOR>
@@ -17666,6 +18109,25 @@ int DispatcherProcessorConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_rebalanceIntervalMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REBALANCE_INTERVAL_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_firstCpu,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIRST_CPU]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_numCpus,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_CPUS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -17686,6 +18148,19 @@ int DispatcherProcessorConfig::manipulateAttribute(t_MANIPULATOR& manipulator,
             &d_processorConfig,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_CONFIG]);
     }
+    case ATTRIBUTE_ID_REBALANCE_INTERVAL_MS: {
+        return manipulator(
+            &d_rebalanceIntervalMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REBALANCE_INTERVAL_MS]);
+    }
+    case ATTRIBUTE_ID_FIRST_CPU: {
+        return manipulator(&d_firstCpu,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIRST_CPU]);
+    }
+    case ATTRIBUTE_ID_NUM_CPUS: {
+        return manipulator(&d_numCpus,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_CPUS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -17717,6 +18192,21 @@ DispatcherProcessorConfig::processorConfig()
     return d_processorConfig;
 }
 
+inline int& DispatcherProcessorConfig::rebalanceIntervalMs()
+{
+    return d_rebalanceIntervalMs;
+}
+
+inline int& DispatcherProcessorConfig::firstCpu()
+{
+    return d_firstCpu;
+}
+
+inline int& DispatcherProcessorConfig::numCpus()
+{
+    return d_numCpus;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int DispatcherProcessorConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -17735,6 +18225,24 @@ int DispatcherProcessorConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_rebalanceIntervalMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REBALANCE_INTERVAL_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_firstCpu,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIRST_CPU]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_numCpus, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_CPUS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -17754,6 +18262,19 @@ int DispatcherProcessorConfig::accessAttribute(t_ACCESSOR& accessor,
             d_processorConfig,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_CONFIG]);
     }
+    case ATTRIBUTE_ID_REBALANCE_INTERVAL_MS: {
+        return accessor(
+            d_rebalanceIntervalMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REBALANCE_INTERVAL_MS]);
+    }
+    case ATTRIBUTE_ID_FIRST_CPU: {
+        return accessor(d_firstCpu,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIRST_CPU]);
+    }
+    case ATTRIBUTE_ID_NUM_CPUS: {
+        return accessor(d_numCpus,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_CPUS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -17785,6 +18306,21 @@ DispatcherProcessorConfig::processorConfig() const
     return d_processorConfig;
 }
 
+inline int DispatcherProcessorConfig::rebalanceIntervalMs() const
+{
+    return d_rebalanceIntervalMs;
+}
+
+inline int DispatcherProcessorConfig::firstCpu() const
+{
+    return d_firstCpu;
+}
+
+inline int DispatcherProcessorConfig::numCpus() const
+{
+    return d_numCpus;
+}
+
 // -------------------
 // class LogController
 // -------------------
@@ -18257,6 +18793,10 @@ void PartitionConfig::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->prefaultPages());
     hashAppend(hashAlgorithm, this->flushAtShutdown());
     hashAppend(hashAlgorithm, this->syncConfig());
+    hashAppend(hashAlgorithm, this->nextFileSetCreationPercent());
+    hashAppend(hashAlgorithm, this->recoveryParallelism());
+    hashAppend(hashAlgorithm, this->checkpointInterval());
+    hashAppend(hashAlgorithm, this->replicationLatencyBudgetUs());
 }
 
 inline bool PartitionConfig::isEqualTo(const PartitionConfig& rhs) const
@@ -18272,7 +18812,13 @@ inline bool PartitionConfig::isEqualTo(const PartitionConfig& rhs) const
            this->maxArchivedFileSets() == rhs.maxArchivedFileSets() &&
            this->prefaultPages() == rhs.prefaultPages() &&
            this->flushAtShutdown() == rhs.flushAtShutdown() &&
-           this->syncConfig() == rhs.syncConfig();
+           this->syncConfig() == rhs.syncConfig() &&
+           this->nextFileSetCreationPercent() ==
+               rhs.nextFileSetCreationPercent() &&
+           this->recoveryParallelism() == rhs.recoveryParallelism() &&
+           this->checkpointInterval() == rhs.checkpointInterval() &&
+           this->replicationLatencyBudgetUs() ==
+               rhs.replicationLatencyBudgetUs();
 }
 
 // CLASS METHODS
@@ -18359,6 +18905,34 @@ int PartitionConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_nextFileSetCreationPercent,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NEXT_FILE_SET_CREATION_PERCENT]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_recoveryParallelism,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_PARALLELISM]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_checkpointInterval,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CHECKPOINT_INTERVAL]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_replicationLatencyBudgetUs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICATION_LATENCY_BUDGET_US]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -18425,6 +18999,28 @@ int PartitionConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_syncConfig,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG]);
     }
+    case ATTRIBUTE_ID_NEXT_FILE_SET_CREATION_PERCENT: {
+        return manipulator(
+            &d_nextFileSetCreationPercent,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_NEXT_FILE_SET_CREATION_PERCENT]);
+    }
+    case ATTRIBUTE_ID_RECOVERY_PARALLELISM: {
+        return manipulator(
+            &d_recoveryParallelism,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_PARALLELISM]);
+    }
+    case ATTRIBUTE_ID_CHECKPOINT_INTERVAL: {
+        return manipulator(
+            &d_checkpointInterval,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CHECKPOINT_INTERVAL]);
+    }
+    case ATTRIBUTE_ID_REPLICATION_LATENCY_BUDGET_US: {
+        return manipulator(
+            &d_replicationLatencyBudgetUs,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_REPLICATION_LATENCY_BUDGET_US]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -18505,6 +19101,26 @@ inline StorageSyncConfig& PartitionConfig::syncConfig()
     return d_syncConfig;
 }
 
+inline int& PartitionConfig::nextFileSetCreationPercent()
+{
+    return d_nextFileSetCreationPercent;
+}
+
+inline int& PartitionConfig::recoveryParallelism()
+{
+    return d_recoveryParallelism;
+}
+
+inline int& PartitionConfig::checkpointInterval()
+{
+    return d_checkpointInterval;
+}
+
+inline int& PartitionConfig::replicationLatencyBudgetUs()
+{
+    return d_replicationLatencyBudgetUs;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int PartitionConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -18584,6 +19200,32 @@ int PartitionConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_nextFileSetCreationPercent,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NEXT_FILE_SET_CREATION_PERCENT]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_recoveryParallelism,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_PARALLELISM]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_checkpointInterval,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CHECKPOINT_INTERVAL]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_replicationLatencyBudgetUs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICATION_LATENCY_BUDGET_US]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -18648,6 +19290,28 @@ int PartitionConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_syncConfig,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG]);
     }
+    case ATTRIBUTE_ID_NEXT_FILE_SET_CREATION_PERCENT: {
+        return accessor(
+            d_nextFileSetCreationPercent,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_NEXT_FILE_SET_CREATION_PERCENT]);
+    }
+    case ATTRIBUTE_ID_RECOVERY_PARALLELISM: {
+        return accessor(
+            d_recoveryParallelism,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_PARALLELISM]);
+    }
+    case ATTRIBUTE_ID_CHECKPOINT_INTERVAL: {
+        return accessor(
+            d_checkpointInterval,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CHECKPOINT_INTERVAL]);
+    }
+    case ATTRIBUTE_ID_REPLICATION_LATENCY_BUDGET_US: {
+        return accessor(
+            d_replicationLatencyBudgetUs,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_REPLICATION_LATENCY_BUDGET_US]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -18728,6 +19392,26 @@ inline const StorageSyncConfig& PartitionConfig::syncConfig() const
     return d_syncConfig;
 }
 
+inline int PartitionConfig::nextFileSetCreationPercent() const
+{
+    return d_nextFileSetCreationPercent;
+}
+
+inline int PartitionConfig::recoveryParallelism() const
+{
+    return d_recoveryParallelism;
+}
+
+inline int PartitionConfig::checkpointInterval() const
+{
+    return d_checkpointInterval;
+}
+
+inline int PartitionConfig::replicationLatencyBudgetUs() const
+{
+    return d_replicationLatencyBudgetUs;
+}
+
 // ---------------------------
 // class PluginSettingKeyValue
 // ---------------------------
@@ -20337,6 +21021,7 @@ void DispatcherConfig::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->clusters());
     hashAppend(hashAlgorithm, this->alarmTimeoutMs());
     hashAppend(hashAlgorithm, this->warningTimeoutMs());
+    hashAppend(hashAlgorithm, this->processorQueueType());
 }
 
 inline bool DispatcherConfig::isEqualTo(const DispatcherConfig& rhs) const
@@ -20345,7 +21030,8 @@ inline bool DispatcherConfig::isEqualTo(const DispatcherConfig& rhs) const
            this->queues() == rhs.queues() &&
            this->clusters() == rhs.clusters() &&
            this->alarmTimeoutMs() == rhs.alarmTimeoutMs() &&
-           this->warningTimeoutMs() == rhs.warningTimeoutMs();
+           this->warningTimeoutMs() == rhs.warningTimeoutMs() &&
+           this->processorQueueType() == rhs.processorQueueType();
 }
 
 // CLASS METHODS
@@ -20385,6 +21071,13 @@ int DispatcherConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_processorQueueType,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_QUEUE_TYPE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -20416,6 +21109,11 @@ int DispatcherConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             &d_warningTimeoutMs,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WARNING_TIMEOUT_MS]);
     }
+    case ATTRIBUTE_ID_PROCESSOR_QUEUE_TYPE: {
+        return manipulator(
+            &d_processorQueueType,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_QUEUE_TYPE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -20461,6 +21159,11 @@ inline int& DispatcherConfig::warningTimeoutMs()
     return d_warningTimeoutMs;
 }
 
+inline DispatcherQueueType::Value& DispatcherConfig::processorQueueType()
+{
+    return d_processorQueueType;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int DispatcherConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -20494,6 +21197,12 @@ int DispatcherConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_processorQueueType,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_QUEUE_TYPE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -20525,6 +21234,11 @@ int DispatcherConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
             d_warningTimeoutMs,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WARNING_TIMEOUT_MS]);
     }
+    case ATTRIBUTE_ID_PROCESSOR_QUEUE_TYPE: {
+        return accessor(
+            d_processorQueueType,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_QUEUE_TYPE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -20570,6 +21284,11 @@ inline int DispatcherConfig::warningTimeoutMs() const
     return d_warningTimeoutMs;
 }
 
+inline DispatcherQueueType::Value DispatcherConfig::processorQueueType() const
+{
+    return d_processorQueueType;
+}
+
 // -----------------------
 // class NetworkInterfaces
 // -----------------------
@@ -467,8 +467,26 @@ void printFileStoreSummary(bsl::ostream&           os,
        << newlineAndIndent(level + 1, spacesPerLevel)
        << "Current Nagle count: "
        << prettyNumber(
-              static_cast<bsls::Types::Int64>(summary.naglePacketCount()))
-       << '\n'
+              static_cast<bsls::Types::Int64>(summary.naglePacketCount()));
+
+    typedef bsl::vector<ReplicaStatus> Replicas;
+    const Replicas&                    replicas = summary.replicas();
+    if (!replicas.empty()) {
+        os << '\n'
+           << newlineAndIndent(level + 1, spacesPerLevel)
+           << "Replicas (unreceipted bytes / receipt lag): ";
+        for (Replicas::const_iterator cit = replicas.cbegin();
+             cit != replicas.cend();
+             ++cit) {
+            os << newlineAndIndent(level + 2, spacesPerLevel)
+               << cit->nodeDescription() << " : "
+               << prettyBytes(static_cast<bsls::Types::Int64>(
+                      cit->unreceiptedBytes()))
+               << " / " << prettyTimeInterval(cit->receiptLagNanoseconds());
+        }
+    }
+
+    os << '\n'
        << newlineAndIndent(level + 1, spacesPerLevel)
        << "Number of assigned queue-storages: "
        << prettyNumber(static_cast<bsls::Types::Int64>(
@@ -3428,6 +3428,151 @@ bsl::ostream& RemoteStreamInfo::print(bsl::ostream& stream,
     return stream;
 }
 
+// -------------------
+// class ReplicaStatus
+// -------------------
+
+// CONSTANTS
+
+const char ReplicaStatus::CLASS_NAME[] = "ReplicaStatus";
+
+const bdlat_AttributeInfo ReplicaStatus::ATTRIBUTE_INFO_ARRAY[] = {
+    {ATTRIBUTE_ID_NODE_DESCRIPTION,
+     "nodeDescription",
+     sizeof("nodeDescription") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_UNRECEIPTED_BYTES,
+     "unreceiptedBytes",
+     sizeof("unreceiptedBytes") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_RECEIPT_LAG_NANOSECONDS,
+     "receiptLagNanoseconds",
+     sizeof("receiptLagNanoseconds") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC}};
+
+// CLASS METHODS
+
+const bdlat_AttributeInfo*
+ReplicaStatus::lookupAttributeInfo(const char* name, int nameLength)
+{
+    for (int i = 0; i < 3; ++i) {
+        const bdlat_AttributeInfo& attributeInfo =
+            ReplicaStatus::ATTRIBUTE_INFO_ARRAY[i];
+
+        if (nameLength == attributeInfo.d_nameLength &&
+            0 == bsl::memcmp(attributeInfo.d_name_p, name, nameLength)) {
+            return &attributeInfo;
+        }
+    }
+
+    return 0;
+}
+
+const bdlat_AttributeInfo* ReplicaStatus::lookupAttributeInfo(int id)
+{
+    switch (id) {
+    case ATTRIBUTE_ID_NODE_DESCRIPTION:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NODE_DESCRIPTION];
+    case ATTRIBUTE_ID_UNRECEIPTED_BYTES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_UNRECEIPTED_BYTES];
+    case ATTRIBUTE_ID_RECEIPT_LAG_NANOSECONDS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECEIPT_LAG_NANOSECONDS];
+    default: return 0;
+    }
+}
+
+// CREATORS
+
+ReplicaStatus::ReplicaStatus(bslma::Allocator* basicAllocator)
+: d_unreceiptedBytes()
+, d_receiptLagNanoseconds()
+, d_nodeDescription(basicAllocator)
+{
+}
+
+ReplicaStatus::ReplicaStatus(const ReplicaStatus& original,
+                             bslma::Allocator*    basicAllocator)
+: d_unreceiptedBytes(original.d_unreceiptedBytes)
+, d_receiptLagNanoseconds(original.d_receiptLagNanoseconds)
+, d_nodeDescription(original.d_nodeDescription, basicAllocator)
+{
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+ReplicaStatus::ReplicaStatus(ReplicaStatus&& original) noexcept
+: d_unreceiptedBytes(bsl::move(original.d_unreceiptedBytes)),
+  d_receiptLagNanoseconds(bsl::move(original.d_receiptLagNanoseconds)),
+  d_nodeDescription(bsl::move(original.d_nodeDescription))
+{
+}
+
+ReplicaStatus::ReplicaStatus(ReplicaStatus&&   original,
+                             bslma::Allocator* basicAllocator)
+: d_unreceiptedBytes(bsl::move(original.d_unreceiptedBytes))
+, d_receiptLagNanoseconds(bsl::move(original.d_receiptLagNanoseconds))
+, d_nodeDescription(bsl::move(original.d_nodeDescription), basicAllocator)
+{
+}
+#endif
+
+ReplicaStatus::~ReplicaStatus()
+{
+}
+
+// MANIPULATORS
+
+ReplicaStatus& ReplicaStatus::operator=(const ReplicaStatus& rhs)
+{
+    if (this != &rhs) {
+        d_nodeDescription       = rhs.d_nodeDescription;
+        d_unreceiptedBytes      = rhs.d_unreceiptedBytes;
+        d_receiptLagNanoseconds = rhs.d_receiptLagNanoseconds;
+    }
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+ReplicaStatus& ReplicaStatus::operator=(ReplicaStatus&& rhs)
+{
+    if (this != &rhs) {
+        d_nodeDescription       = bsl::move(rhs.d_nodeDescription);
+        d_unreceiptedBytes      = bsl::move(rhs.d_unreceiptedBytes);
+        d_receiptLagNanoseconds = bsl::move(rhs.d_receiptLagNanoseconds);
+    }
+
+    return *this;
+}
+#endif
+
+void ReplicaStatus::reset()
+{
+    bdlat_ValueTypeFunctions::reset(&d_nodeDescription);
+    bdlat_ValueTypeFunctions::reset(&d_unreceiptedBytes);
+    bdlat_ValueTypeFunctions::reset(&d_receiptLagNanoseconds);
+}
+
+// ACCESSORS
+
+bsl::ostream& ReplicaStatus::print(bsl::ostream& stream,
+                                   int           level,
+                                   int           spacesPerLevel) const
+{
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("nodeDescription", this->nodeDescription());
+    printer.printAttribute("unreceiptedBytes", this->unreceiptedBytes());
+    printer.printAttribute("receiptLagNanoseconds",
+                           this->receiptLagNanoseconds());
+    printer.end();
+    return stream;
+}
+
 // -------------------------------
 // class ResourceUsageMonitorState
 // -------------------------------
@@ -11196,6 +11341,11 @@ const bdlat_AttributeInfo FileStoreSummary::ATTRIBUTE_INFO_ARRAY[] = {
      "storageContent",
      sizeof("storageContent") - 1,
      "",
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_REPLICAS,
+     "replicas",
+     sizeof("replicas") - 1,
+     "",
      bdlat_FormattingMode::e_DEFAULT}};
 
 // CLASS METHODS
@@ -11203,7 +11353,7 @@ const bdlat_AttributeInfo FileStoreSummary::ATTRIBUTE_INFO_ARRAY[] = {
 const bdlat_AttributeInfo*
 FileStoreSummary::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 11; ++i) {
+    for (int i = 0; i < 12; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             FileStoreSummary::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -11241,6 +11391,8 @@ const bdlat_AttributeInfo* FileStoreSummary::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NAGLE_PACKET_COUNT];
     case ATTRIBUTE_ID_STORAGE_CONTENT:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_STORAGE_CONTENT];
+    case ATTRIBUTE_ID_REPLICAS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICAS];
     default: return 0;
     }
 }
@@ -11251,6 +11403,7 @@ FileStoreSummary::FileStoreSummary(bslma::Allocator* basicAllocator)
 : d_sequenceNum()
 , d_totalMappedBytes()
 , d_fileSets(basicAllocator)
+, d_replicas(basicAllocator)
 , d_primaryNodeDescription(basicAllocator)
 , d_storageContent(basicAllocator)
 , d_activeFileSet()
@@ -11267,6 +11420,7 @@ FileStoreSummary::FileStoreSummary(const FileStoreSummary& original,
 : d_sequenceNum(original.d_sequenceNum)
 , d_totalMappedBytes(original.d_totalMappedBytes)
 , d_fileSets(original.d_fileSets, basicAllocator)
+, d_replicas(original.d_replicas, basicAllocator)
 , d_primaryNodeDescription(original.d_primaryNodeDescription, basicAllocator)
 , d_storageContent(original.d_storageContent, basicAllocator)
 , d_activeFileSet(original.d_activeFileSet)
@@ -11284,6 +11438,7 @@ FileStoreSummary::FileStoreSummary(FileStoreSummary&& original) noexcept
 : d_sequenceNum(bsl::move(original.d_sequenceNum)),
   d_totalMappedBytes(bsl::move(original.d_totalMappedBytes)),
   d_fileSets(bsl::move(original.d_fileSets)),
+  d_replicas(bsl::move(original.d_replicas)),
   d_primaryNodeDescription(bsl::move(original.d_primaryNodeDescription)),
   d_storageContent(bsl::move(original.d_storageContent)),
   d_activeFileSet(bsl::move(original.d_activeFileSet)),
@@ -11300,6 +11455,7 @@ FileStoreSummary::FileStoreSummary(FileStoreSummary&& original,
 : d_sequenceNum(bsl::move(original.d_sequenceNum))
 , d_totalMappedBytes(bsl::move(original.d_totalMappedBytes))
 , d_fileSets(bsl::move(original.d_fileSets), basicAllocator)
+, d_replicas(bsl::move(original.d_replicas), basicAllocator)
 , d_primaryNodeDescription(bsl::move(original.d_primaryNodeDescription),
                            basicAllocator)
 , d_storageContent(bsl::move(original.d_storageContent), basicAllocator)
@@ -11333,6 +11489,7 @@ FileStoreSummary& FileStoreSummary::operator=(const FileStoreSummary& rhs)
         d_numUnreceiptedMessages = rhs.d_numUnreceiptedMessages;
         d_naglePacketCount       = rhs.d_naglePacketCount;
         d_storageContent         = rhs.d_storageContent;
+        d_replicas               = rhs.d_replicas;
     }
 
     return *this;
@@ -11354,6 +11511,7 @@ FileStoreSummary& FileStoreSummary::operator=(FileStoreSummary&& rhs)
         d_numUnreceiptedMessages = bsl::move(rhs.d_numUnreceiptedMessages);
         d_naglePacketCount       = bsl::move(rhs.d_naglePacketCount);
         d_storageContent         = bsl::move(rhs.d_storageContent);
+        d_replicas               = bsl::move(rhs.d_replicas);
     }
 
     return *this;
@@ -11373,6 +11531,7 @@ void FileStoreSummary::reset()
     bdlat_ValueTypeFunctions::reset(&d_numUnreceiptedMessages);
     bdlat_ValueTypeFunctions::reset(&d_naglePacketCount);
     bdlat_ValueTypeFunctions::reset(&d_storageContent);
+    bdlat_ValueTypeFunctions::reset(&d_replicas);
 }
 
 // ACCESSORS
@@ -11397,6 +11556,7 @@ bsl::ostream& FileStoreSummary::print(bsl::ostream& stream,
                            this->numUnreceiptedMessages());
     printer.printAttribute("naglePacketCount", this->naglePacketCount());
     printer.printAttribute("storageContent", this->storageContent());
+    printer.printAttribute("replicas", this->replicas());
     printer.end();
     return stream;
 }
@@ -129,6 +129,9 @@ namespace mqbcmd {
 class RemoteStreamInfo;
 }
 namespace mqbcmd {
+class ReplicaStatus;
+}
+namespace mqbcmd {
 class RouteResponse;
 }
 namespace mqbcmd {
@@ -5710,6 +5713,248 @@ struct bdlat_UsesDefaultValueFlag<mqbcmd::RemoteStreamInfo> : bsl::true_type {
 
 namespace mqbcmd {
 
+// ===================
+// class ReplicaStatus
+// ===================
+
+class ReplicaStatus {
+    // Replication progress of a replica of a partition, as observed by the
+    // primary of the partition from the Receipts of the replica.
+
+    // INSTANCE DATA
+    bsls::Types::Uint64 d_unreceiptedBytes;
+    bsls::Types::Int64  d_receiptLagNanoseconds;
+    bsl::string         d_nodeDescription;
+
+    // PRIVATE ACCESSORS
+    template <typename t_HASH_ALGORITHM>
+    void hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const;
+
+  public:
+    // TYPES
+    enum {
+        ATTRIBUTE_ID_NODE_DESCRIPTION        = 0,
+        ATTRIBUTE_ID_UNRECEIPTED_BYTES       = 1,
+        ATTRIBUTE_ID_RECEIPT_LAG_NANOSECONDS = 2
+    };
+
+    enum { NUM_ATTRIBUTES = 3 };
+
+    enum {
+        ATTRIBUTE_INDEX_NODE_DESCRIPTION        = 0,
+        ATTRIBUTE_INDEX_UNRECEIPTED_BYTES       = 1,
+        ATTRIBUTE_INDEX_RECEIPT_LAG_NANOSECONDS = 2
+    };
+
+    // CONSTANTS
+    static const char CLASS_NAME[];
+
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+  public:
+    // CLASS METHODS
+    static const bdlat_AttributeInfo* lookupAttributeInfo(int id);
+    // Return attribute information for the attribute indicated by the
+    // specified 'id' if the attribute exists, and 0 otherwise.
+
+    static const bdlat_AttributeInfo* lookupAttributeInfo(const char* name,
+                                                          int nameLength);
+    // Return attribute information for the attribute indicated by the
+    // specified 'name' of the specified 'nameLength' if the attribute
+    // exists, and 0 otherwise.
+
+    // CREATORS
+    explicit ReplicaStatus(bslma::Allocator* basicAllocator = 0);
+    // Create an object of type 'ReplicaStatus' having the default value.
+    // Use the optionally specified 'basicAllocator' to supply memory.  If
+    // 'basicAllocator' is 0, the currently installed default allocator is
+    // used.
+
+    ReplicaStatus(const ReplicaStatus& original,
+                  bslma::Allocator*    basicAllocator = 0);
+    // Create an object of type 'ReplicaStatus' having the value of the
+    // specified 'original' object.  Use the optionally specified
+    // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+    // currently installed default allocator is used.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    ReplicaStatus(ReplicaStatus&& original) noexcept;
+    // Create an object of type 'ReplicaStatus' having the value of the
+    // specified 'original' object.  After performing this action, the
+    // 'original' object will be left in a valid, but unspecified state.
+
+    ReplicaStatus(ReplicaStatus&& original, bslma::Allocator* basicAllocator);
+    // Create an object of type 'ReplicaStatus' having the value of the
+    // specified 'original' object.  After performing this action, the
+    // 'original' object will be left in a valid, but unspecified state.
+    // Use the optionally specified 'basicAllocator' to supply memory.  If
+    // 'basicAllocator' is 0, the currently installed default allocator is
+    // used.
+#endif
+
+    ~ReplicaStatus();
+    // Destroy this object.
+
+    // MANIPULATORS
+    ReplicaStatus& operator=(const ReplicaStatus& rhs);
+    // Assign to this object the value of the specified 'rhs' object.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    ReplicaStatus& operator=(ReplicaStatus&& rhs);
+    // Assign to this object the value of the specified 'rhs' object.
+    // After performing this action, the 'rhs' object will be left in a
+    // valid, but unspecified state.
+#endif
+
+    void reset();
+    // Reset this object to the default value (i.e., its value upon
+    // default construction).
+
+    template <typename t_MANIPULATOR>
+    int manipulateAttributes(t_MANIPULATOR& manipulator);
+    // Invoke the specified 'manipulator' sequentially on the address of
+    // each (modifiable) attribute of this object, supplying 'manipulator'
+    // with the corresponding attribute information structure until such
+    // invocation returns a non-zero value.  Return the value from the
+    // last invocation of 'manipulator' (i.e., the invocation that
+    // terminated the sequence).
+
+    template <typename t_MANIPULATOR>
+    int manipulateAttribute(t_MANIPULATOR& manipulator, int id);
+    // Invoke the specified 'manipulator' on the address of
+    // the (modifiable) attribute indicated by the specified 'id',
+    // supplying 'manipulator' with the corresponding attribute
+    // information structure.  Return the value returned from the
+    // invocation of 'manipulator' if 'id' identifies an attribute of this
+    // class, and -1 otherwise.
+
+    template <typename t_MANIPULATOR>
+    int manipulateAttribute(t_MANIPULATOR& manipulator,
+                            const char*    name,
+                            int            nameLength);
+    // Invoke the specified 'manipulator' on the address of
+    // the (modifiable) attribute indicated by the specified 'name' of the
+    // specified 'nameLength', supplying 'manipulator' with the
+    // corresponding attribute information structure.  Return the value
+    // returned from the invocation of 'manipulator' if 'name' identifies
+    // an attribute of this class, and -1 otherwise.
+
+    bsl::string& nodeDescription();
+    // Return a reference to the modifiable "NodeDescription" attribute of
+    // this object.
+
+    bsls::Types::Uint64& unreceiptedBytes();
+    // Return a reference to the modifiable "UnreceiptedBytes" attribute of
+    // this object.
+
+    bsls::Types::Int64& receiptLagNanoseconds();
+    // Return a reference to the modifiable "ReceiptLagNanoseconds"
+    // attribute of this object.
+
+    // ACCESSORS
+    bsl::ostream&
+    print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
+    // Format this object to the specified output 'stream' at the
+    // optionally specified indentation 'level' and return a reference to
+    // the modifiable 'stream'.  If 'level' is specified, optionally
+    // specify 'spacesPerLevel', the number of spaces per indentation level
+    // for this and all of its nested objects.  Each line is indented by
+    // the absolute value of 'level * spacesPerLevel'.  If 'level' is
+    // negative, suppress indentation of the first line.  If
+    // 'spacesPerLevel' is negative, suppress line breaks and format the
+    // entire output on one line.  If 'stream' is initially invalid, this
+    // operation has no effect.  Note that a trailing newline is provided
+    // in multiline mode only.
+
+    template <typename t_ACCESSOR>
+    int accessAttributes(t_ACCESSOR& accessor) const;
+    // Invoke the specified 'accessor' sequentially on each
+    // (non-modifiable) attribute of this object, supplying 'accessor'
+    // with the corresponding attribute information structure until such
+    // invocation returns a non-zero value.  Return the value from the
+    // last invocation of 'accessor' (i.e., the invocation that terminated
+    // the sequence).
+
+    template <typename t_ACCESSOR>
+    int accessAttribute(t_ACCESSOR& accessor, int id) const;
+    // Invoke the specified 'accessor' on the (non-modifiable) attribute
+    // of this object indicated by the specified 'id', supplying 'accessor'
+    // with the corresponding attribute information structure.  Return the
+    // value returned from the invocation of 'accessor' if 'id' identifies
+    // an attribute of this class, and -1 otherwise.
+
+    template <typename t_ACCESSOR>
+    int accessAttribute(t_ACCESSOR& accessor,
+                        const char* name,
+                        int         nameLength) const;
+    // Invoke the specified 'accessor' on the (non-modifiable) attribute
+    // of this object indicated by the specified 'name' of the specified
+    // 'nameLength', supplying 'accessor' with the corresponding attribute
+    // information structure.  Return the value returned from the
+    // invocation of 'accessor' if 'name' identifies an attribute of this
+    // class, and -1 otherwise.
+
+    const bsl::string& nodeDescription() const;
+    // Return a reference offering non-modifiable access to the
+    // "NodeDescription" attribute of this object.
+
+    bsls::Types::Uint64 unreceiptedBytes() const;
+    // Return the value of the "UnreceiptedBytes" attribute of this object.
+
+    bsls::Types::Int64 receiptLagNanoseconds() const;
+    // Return the value of the "ReceiptLagNanoseconds" attribute of this
+    // object.
+
+    // HIDDEN FRIENDS
+    friend bool operator==(const ReplicaStatus& lhs, const ReplicaStatus& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' attribute objects
+    // have the same value, and 'false' otherwise.  Two attribute objects
+    // have the same value if each respective attribute has the same value.
+    {
+        return lhs.nodeDescription() == rhs.nodeDescription() &&
+               lhs.unreceiptedBytes() == rhs.unreceiptedBytes() &&
+               lhs.receiptLagNanoseconds() == rhs.receiptLagNanoseconds();
+    }
+
+    friend bool operator!=(const ReplicaStatus& lhs, const ReplicaStatus& rhs)
+    // Returns '!(lhs == rhs)'
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bsl::ostream& operator<<(bsl::ostream&        stream,
+                                    const ReplicaStatus& rhs)
+    // Format the specified 'rhs' to the specified output 'stream' and
+    // return a reference to the modifiable 'stream'.
+    {
+        return rhs.print(stream, 0, -1);
+    }
+
+    template <typename t_HASH_ALGORITHM>
+    friend void hashAppend(t_HASH_ALGORITHM&    hashAlg,
+                           const ReplicaStatus& object)
+    // Pass the specified 'object' to the specified 'hashAlg'.  This
+    // function integrates with the 'bslh' modular hashing system and
+    // effectively provides a 'bsl::hash' specialization for
+    // 'ReplicaStatus'.
+    {
+        object.hashAppendImpl(hashAlg);
+    }
+};
+
+}  // close package namespace
+
+// TRAITS
+
+BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(
+    mqbcmd::ReplicaStatus);
+template <>
+struct bdlat_UsesDefaultValueFlag<mqbcmd::ReplicaStatus> : bsl::true_type {};
+
+namespace mqbcmd {
+
 // ===============================
 // class ResourceUsageMonitorState
 // ===============================
@@ -14766,17 +15011,18 @@ namespace mqbcmd {
 
 class FileStoreSummary {
     // INSTANCE DATA
-    bsls::Types::Uint64  d_sequenceNum;
-    bsls::Types::Uint64  d_totalMappedBytes;
-    bsl::vector<FileSet> d_fileSets;
-    bsl::string          d_primaryNodeDescription;
-    StorageContent       d_storageContent;
-    ActiveFileSet        d_activeFileSet;
-    unsigned int         d_primaryLeaseId;
-    unsigned int         d_numOutstandingRecords;
-    unsigned int         d_numUnreceiptedMessages;
-    unsigned int         d_naglePacketCount;
-    bool                 d_isAvailable;
+    bsls::Types::Uint64        d_sequenceNum;
+    bsls::Types::Uint64        d_totalMappedBytes;
+    bsl::vector<FileSet>       d_fileSets;
+    bsl::vector<ReplicaStatus> d_replicas;
+    bsl::string                d_primaryNodeDescription;
+    StorageContent             d_storageContent;
+    ActiveFileSet              d_activeFileSet;
+    unsigned int               d_primaryLeaseId;
+    unsigned int               d_numOutstandingRecords;
+    unsigned int               d_numUnreceiptedMessages;
+    unsigned int               d_naglePacketCount;
+    bool                       d_isAvailable;
 
     // PRIVATE ACCESSORS
     template <typename t_HASH_ALGORITHM>
@@ -14797,10 +15043,11 @@ class FileStoreSummary {
         ATTRIBUTE_ID_NUM_OUTSTANDING_RECORDS  = 7,
         ATTRIBUTE_ID_NUM_UNRECEIPTED_MESSAGES = 8,
         ATTRIBUTE_ID_NAGLE_PACKET_COUNT       = 9,
-        ATTRIBUTE_ID_STORAGE_CONTENT          = 10
+        ATTRIBUTE_ID_STORAGE_CONTENT          = 10,
+        ATTRIBUTE_ID_REPLICAS                 = 11
     };
 
-    enum { NUM_ATTRIBUTES = 11 };
+    enum { NUM_ATTRIBUTES = 12 };
 
     enum {
         ATTRIBUTE_INDEX_PRIMARY_NODE_DESCRIPTION = 0,
@@ -14813,7 +15060,8 @@ class FileStoreSummary {
         ATTRIBUTE_INDEX_NUM_OUTSTANDING_RECORDS  = 7,
         ATTRIBUTE_INDEX_NUM_UNRECEIPTED_MESSAGES = 8,
         ATTRIBUTE_INDEX_NAGLE_PACKET_COUNT       = 9,
-        ATTRIBUTE_INDEX_STORAGE_CONTENT          = 10
+        ATTRIBUTE_INDEX_STORAGE_CONTENT          = 10,
+        ATTRIBUTE_INDEX_REPLICAS                 = 11
     };
 
     // CONSTANTS
@@ -14956,6 +15204,10 @@ class FileStoreSummary {
     // Return a reference to the modifiable "StorageContent" attribute of
     // this object.
 
+    bsl::vector<ReplicaStatus>& replicas();
+    // Return a reference to the modifiable "Replicas" attribute of this
+    // object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -15038,6 +15290,10 @@ class FileStoreSummary {
     // Return a reference offering non-modifiable access to the
     // "StorageContent" attribute of this object.
 
+    const bsl::vector<ReplicaStatus>& replicas() const;
+    // Return a reference offering non-modifiable access to the "Replicas"
+    // attribute of this object.
+
     // HIDDEN FRIENDS
     friend bool operator==(const FileStoreSummary& lhs,
                            const FileStoreSummary& rhs)
@@ -35150,6 +35406,189 @@ inline bsls::Types::Int64 RemoteStreamInfo::genCount() const
     return d_genCount;
 }
 
+// -------------------
+// class ReplicaStatus
+// -------------------
+
+// PRIVATE ACCESSORS
+template <typename t_HASH_ALGORITHM>
+void ReplicaStatus::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
+{
+    using bslh::hashAppend;
+    hashAppend(hashAlgorithm, this->nodeDescription());
+    hashAppend(hashAlgorithm, this->unreceiptedBytes());
+    hashAppend(hashAlgorithm, this->receiptLagNanoseconds());
+}
+
+// CLASS METHODS
+// MANIPULATORS
+template <typename t_MANIPULATOR>
+int ReplicaStatus::manipulateAttributes(t_MANIPULATOR& manipulator)
+{
+    int ret;
+
+    ret = manipulator(&d_nodeDescription,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NODE_DESCRIPTION]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_unreceiptedBytes,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_UNRECEIPTED_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_receiptLagNanoseconds,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECEIPT_LAG_NANOSECONDS]);
+    if (ret) {
+        return ret;
+    }
+
+    return 0;
+}
+
+template <typename t_MANIPULATOR>
+int ReplicaStatus::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
+{
+    enum { NOT_FOUND = -1 };
+
+    switch (id) {
+    case ATTRIBUTE_ID_NODE_DESCRIPTION: {
+        return manipulator(
+            &d_nodeDescription,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NODE_DESCRIPTION]);
+    }
+    case ATTRIBUTE_ID_UNRECEIPTED_BYTES: {
+        return manipulator(
+            &d_unreceiptedBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_UNRECEIPTED_BYTES]);
+    }
+    case ATTRIBUTE_ID_RECEIPT_LAG_NANOSECONDS: {
+        return manipulator(
+            &d_receiptLagNanoseconds,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECEIPT_LAG_NANOSECONDS]);
+    }
+    default: return NOT_FOUND;
+    }
+}
+
+template <typename t_MANIPULATOR>
+int ReplicaStatus::manipulateAttribute(t_MANIPULATOR& manipulator,
+                                       const char*    name,
+                                       int            nameLength)
+{
+    enum { NOT_FOUND = -1 };
+
+    const bdlat_AttributeInfo* attributeInfo = lookupAttributeInfo(name,
+                                                                   nameLength);
+    if (0 == attributeInfo) {
+        return NOT_FOUND;
+    }
+
+    return manipulateAttribute(manipulator, attributeInfo->d_id);
+}
+
+inline bsl::string& ReplicaStatus::nodeDescription()
+{
+    return d_nodeDescription;
+}
+
+inline bsls::Types::Uint64& ReplicaStatus::unreceiptedBytes()
+{
+    return d_unreceiptedBytes;
+}
+
+inline bsls::Types::Int64& ReplicaStatus::receiptLagNanoseconds()
+{
+    return d_receiptLagNanoseconds;
+}
+
+// ACCESSORS
+template <typename t_ACCESSOR>
+int ReplicaStatus::accessAttributes(t_ACCESSOR& accessor) const
+{
+    int ret;
+
+    ret = accessor(d_nodeDescription,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NODE_DESCRIPTION]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_unreceiptedBytes,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_UNRECEIPTED_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_receiptLagNanoseconds,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECEIPT_LAG_NANOSECONDS]);
+    if (ret) {
+        return ret;
+    }
+
+    return 0;
+}
+
+template <typename t_ACCESSOR>
+int ReplicaStatus::accessAttribute(t_ACCESSOR& accessor, int id) const
+{
+    enum { NOT_FOUND = -1 };
+
+    switch (id) {
+    case ATTRIBUTE_ID_NODE_DESCRIPTION: {
+        return accessor(
+            d_nodeDescription,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NODE_DESCRIPTION]);
+    }
+    case ATTRIBUTE_ID_UNRECEIPTED_BYTES: {
+        return accessor(
+            d_unreceiptedBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_UNRECEIPTED_BYTES]);
+    }
+    case ATTRIBUTE_ID_RECEIPT_LAG_NANOSECONDS: {
+        return accessor(
+            d_receiptLagNanoseconds,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECEIPT_LAG_NANOSECONDS]);
+    }
+    default: return NOT_FOUND;
+    }
+}
+
+template <typename t_ACCESSOR>
+int ReplicaStatus::accessAttribute(t_ACCESSOR& accessor,
+                                   const char* name,
+                                   int         nameLength) const
+{
+    enum { NOT_FOUND = -1 };
+
+    const bdlat_AttributeInfo* attributeInfo = lookupAttributeInfo(name,
+                                                                   nameLength);
+    if (0 == attributeInfo) {
+        return NOT_FOUND;
+    }
+
+    return accessAttribute(accessor, attributeInfo->d_id);
+}
+
+inline const bsl::string& ReplicaStatus::nodeDescription() const
+{
+    return d_nodeDescription;
+}
+
+inline bsls::Types::Uint64 ReplicaStatus::unreceiptedBytes() const
+{
+    return d_unreceiptedBytes;
+}
+
+inline bsls::Types::Int64 ReplicaStatus::receiptLagNanoseconds() const
+{
+    return d_receiptLagNanoseconds;
+}
+
 // -------------------------------
 // class ResourceUsageMonitorState
 // -------------------------------
@@ -41825,6 +42264,7 @@ void FileStoreSummary::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->numUnreceiptedMessages());
     hashAppend(hashAlgorithm, this->naglePacketCount());
     hashAppend(hashAlgorithm, this->storageContent());
+    hashAppend(hashAlgorithm, this->replicas());
 }
 
 inline bool FileStoreSummary::isEqualTo(const FileStoreSummary& rhs) const
@@ -41839,7 +42279,8 @@ inline bool FileStoreSummary::isEqualTo(const FileStoreSummary& rhs) const
            this->numOutstandingRecords() == rhs.numOutstandingRecords() &&
            this->numUnreceiptedMessages() == rhs.numUnreceiptedMessages() &&
            this->naglePacketCount() == rhs.naglePacketCount() &&
-           this->storageContent() == rhs.storageContent();
+           this->storageContent() == rhs.storageContent() &&
+           this->replicas() == rhs.replicas();
 }
 
 // CLASS METHODS
@@ -41920,6 +42361,12 @@ int FileStoreSummary::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_replicas,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICAS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -41981,6 +42428,10 @@ int FileStoreSummary::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             &d_storageContent,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_STORAGE_CONTENT]);
     }
+    case ATTRIBUTE_ID_REPLICAS: {
+        return manipulator(&d_replicas,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICAS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -42056,6 +42507,11 @@ inline StorageContent& FileStoreSummary::storageContent()
     return d_storageContent;
 }
 
+inline bsl::vector<ReplicaStatus>& FileStoreSummary::replicas()
+{
+    return d_replicas;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int FileStoreSummary::accessAttributes(t_ACCESSOR& accessor) const
@@ -42131,6 +42587,11 @@ int FileStoreSummary::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_replicas, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICAS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -42190,6 +42651,10 @@ int FileStoreSummary::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_storageContent,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_STORAGE_CONTENT]);
     }
+    case ATTRIBUTE_ID_REPLICAS: {
+        return accessor(d_replicas,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLICAS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -42265,6 +42730,11 @@ inline const StorageContent& FileStoreSummary::storageContent() const
     return d_storageContent;
 }
 
+inline const bsl::vector<ReplicaStatus>& FileStoreSummary::replicas() const
+{
+    return d_replicas;
+}
+
 // ----------------
 // class GetTunable
 // ----------------
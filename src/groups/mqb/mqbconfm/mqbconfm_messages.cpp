@@ -2034,6 +2034,8 @@ const int Domain::DEFAULT_INITIALIZER_MAX_DELIVERY_ATTEMPTS = 0;
 
 const int Domain::DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS = 300000;
 
+const bool Domain::DEFAULT_INITIALIZER_SYNC_BEFORE_ACK = false;
+
 const bdlat_AttributeInfo Domain::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NAME,
      "name",
@@ -2099,14 +2101,19 @@ const bdlat_AttributeInfo Domain::ATTRIBUTE_INFO_ARRAY[] = {
      "subscriptions",
      sizeof("subscriptions") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_SYNC_BEFORE_ACK,
+     "syncBeforeAck",
+     sizeof("syncBeforeAck") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo* Domain::lookupAttributeInfo(const char* name,
                                                        int         nameLength)
 {
-    for (int i = 0; i < 13; ++i) {
+    for (int i = 0; i < 14; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             Domain::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -2146,6 +2153,8 @@ const bdlat_AttributeInfo* Domain::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENCY];
     case ATTRIBUTE_ID_SUBSCRIPTIONS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS];
+    case ATTRIBUTE_ID_SYNC_BEFORE_ACK:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_BEFORE_ACK];
     default: return 0;
     }
 }
@@ -2166,6 +2175,7 @@ Domain::Domain(bslma::Allocator* basicAllocator)
 , d_maxIdleTime(DEFAULT_INITIALIZER_MAX_IDLE_TIME)
 , d_maxDeliveryAttempts(DEFAULT_INITIALIZER_MAX_DELIVERY_ATTEMPTS)
 , d_deduplicationTimeMs(DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS)
+, d_syncBeforeAck(DEFAULT_INITIALIZER_SYNC_BEFORE_ACK)
 {
 }
 
@@ -2183,6 +2193,7 @@ Domain::Domain(const Domain& original, bslma::Allocator* basicAllocator)
 , d_maxIdleTime(original.d_maxIdleTime)
 , d_maxDeliveryAttempts(original.d_maxDeliveryAttempts)
 , d_deduplicationTimeMs(original.d_deduplicationTimeMs)
+, d_syncBeforeAck(original.d_syncBeforeAck)
 {
 }
 
@@ -2201,7 +2212,8 @@ Domain::Domain(Domain&& original) noexcept
   d_maxQueues(bsl::move(original.d_maxQueues)),
   d_maxIdleTime(bsl::move(original.d_maxIdleTime)),
   d_maxDeliveryAttempts(bsl::move(original.d_maxDeliveryAttempts)),
-  d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs))
+  d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs)),
+  d_syncBeforeAck(bsl::move(original.d_syncBeforeAck))
 {
 }
 
@@ -2219,6 +2231,7 @@ Domain::Domain(Domain&& original, bslma::Allocator* basicAllocator)
 , d_maxIdleTime(bsl::move(original.d_maxIdleTime))
 , d_maxDeliveryAttempts(bsl::move(original.d_maxDeliveryAttempts))
 , d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs))
+, d_syncBeforeAck(bsl::move(original.d_syncBeforeAck))
 {
 }
 #endif
@@ -2245,6 +2258,7 @@ Domain& Domain::operator=(const Domain& rhs)
         d_deduplicationTimeMs = rhs.d_deduplicationTimeMs;
         d_consistency         = rhs.d_consistency;
         d_subscriptions       = rhs.d_subscriptions;
+        d_syncBeforeAck       = rhs.d_syncBeforeAck;
     }
 
     return *this;
@@ -2268,6 +2282,7 @@ Domain& Domain::operator=(Domain&& rhs)
         d_deduplicationTimeMs = bsl::move(rhs.d_deduplicationTimeMs);
         d_consistency         = bsl::move(rhs.d_consistency);
         d_subscriptions       = bsl::move(rhs.d_subscriptions);
+        d_syncBeforeAck       = bsl::move(rhs.d_syncBeforeAck);
     }
 
     return *this;
@@ -2289,6 +2304,7 @@ void Domain::reset()
     d_deduplicationTimeMs = DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS;
     bdlat_ValueTypeFunctions::reset(&d_consistency);
     bdlat_ValueTypeFunctions::reset(&d_subscriptions);
+    d_syncBeforeAck = DEFAULT_INITIALIZER_SYNC_BEFORE_ACK;
 }
 
 // ACCESSORS
@@ -2311,6 +2327,7 @@ Domain::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("deduplicationTimeMs", this->deduplicationTimeMs());
     printer.printAttribute("consistency", this->consistency());
     printer.printAttribute("subscriptions", this->subscriptions());
+    printer.printAttribute("syncBeforeAck", this->syncBeforeAck());
     printer.end();
     return stream;
 }
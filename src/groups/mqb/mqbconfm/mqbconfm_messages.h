@@ -3190,6 +3190,8 @@ class Domain {
     // timeout, in milliseconds, to keep GUID of PUT message for the purpose of
     // detecting duplicate PUTs.  consistency.........: optional consistency
     // mode.  subscriptions.......: optional application subscriptions
+    // syncBeforeAck.......: if true, a PUT to a queue with strong consistency
+    // is acknowledged only once its records are synced to disk on the primary
 
     // INSTANCE DATA
     bsls::Types::Int64                    d_messageTtl;
@@ -3205,6 +3207,7 @@ class Domain {
     int                                   d_maxIdleTime;
     int                                   d_maxDeliveryAttempts;
     int                                   d_deduplicationTimeMs;
+    bool                                  d_syncBeforeAck;
 
     // PRIVATE ACCESSORS
     template <typename t_HASH_ALGORITHM>
@@ -3227,10 +3230,11 @@ class Domain {
         ATTRIBUTE_ID_MAX_DELIVERY_ATTEMPTS = 9,
         ATTRIBUTE_ID_DEDUPLICATION_TIME_MS = 10,
         ATTRIBUTE_ID_CONSISTENCY           = 11,
-        ATTRIBUTE_ID_SUBSCRIPTIONS         = 12
+        ATTRIBUTE_ID_SUBSCRIPTIONS         = 12,
+        ATTRIBUTE_ID_SYNC_BEFORE_ACK       = 13
     };
 
-    enum { NUM_ATTRIBUTES = 13 };
+    enum { NUM_ATTRIBUTES = 14 };
 
     enum {
         ATTRIBUTE_INDEX_NAME                  = 0,
@@ -3245,7 +3249,8 @@ class Domain {
         ATTRIBUTE_INDEX_MAX_DELIVERY_ATTEMPTS = 9,
         ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS = 10,
         ATTRIBUTE_INDEX_CONSISTENCY           = 11,
-        ATTRIBUTE_INDEX_SUBSCRIPTIONS         = 12
+        ATTRIBUTE_INDEX_SUBSCRIPTIONS         = 12,
+        ATTRIBUTE_INDEX_SYNC_BEFORE_ACK       = 13
     };
 
     // CONSTANTS
@@ -3263,6 +3268,8 @@ class Domain {
 
     static const int DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS;
 
+    static const bool DEFAULT_INITIALIZER_SYNC_BEFORE_ACK;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -3406,6 +3413,10 @@ class Domain {
     // Return a reference to the modifiable "Subscriptions" attribute of
     // this object.
 
+    bool& syncBeforeAck();
+    // Return a reference to the modifiable "SyncBeforeAck" attribute of
+    // this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -3496,6 +3507,9 @@ class Domain {
     // Return a reference offering non-modifiable access to the
     // "Subscriptions" attribute of this object.
 
+    bool syncBeforeAck() const;
+    // Return the value of the "SyncBeforeAck" attribute of this object.
+
     // HIDDEN FRIENDS
     friend bool operator==(const Domain& lhs, const Domain& rhs)
     // Return 'true' if the specified 'lhs' and 'rhs' attribute objects
@@ -5897,6 +5911,7 @@ void Domain::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->deduplicationTimeMs());
     hashAppend(hashAlgorithm, this->consistency());
     hashAppend(hashAlgorithm, this->subscriptions());
+    hashAppend(hashAlgorithm, this->syncBeforeAck());
 }
 
 inline bool Domain::isEqualTo(const Domain& rhs) const
@@ -5912,7 +5927,8 @@ inline bool Domain::isEqualTo(const Domain& rhs) const
            this->maxDeliveryAttempts() == rhs.maxDeliveryAttempts() &&
            this->deduplicationTimeMs() == rhs.deduplicationTimeMs() &&
            this->consistency() == rhs.consistency() &&
-           this->subscriptions() == rhs.subscriptions();
+           this->subscriptions() == rhs.subscriptions() &&
+           this->syncBeforeAck() == rhs.syncBeforeAck();
 }
 
 // CLASS METHODS
@@ -6001,6 +6017,12 @@ int Domain::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_syncBeforeAck,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_BEFORE_ACK]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -6069,6 +6091,11 @@ int Domain::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             &d_subscriptions,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS]);
     }
+    case ATTRIBUTE_ID_SYNC_BEFORE_ACK: {
+        return manipulator(
+            &d_syncBeforeAck,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_BEFORE_ACK]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -6154,6 +6181,11 @@ inline bsl::vector<Subscription>& Domain::subscriptions()
     return d_subscriptions;
 }
 
+inline bool& Domain::syncBeforeAck()
+{
+    return d_syncBeforeAck;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int Domain::accessAttributes(t_ACCESSOR& accessor) const
@@ -6237,6 +6269,12 @@ int Domain::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_syncBeforeAck,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_BEFORE_ACK]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -6299,6 +6337,10 @@ int Domain::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_subscriptions,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS]);
     }
+    case ATTRIBUTE_ID_SYNC_BEFORE_ACK: {
+        return accessor(d_syncBeforeAck,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_BEFORE_ACK]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -6385,6 +6427,11 @@ inline const bsl::vector<Subscription>& Domain::subscriptions() const
     return d_subscriptions;
 }
 
+inline bool Domain::syncBeforeAck() const
+{
+    return d_syncBeforeAck;
+}
+
 // ----------------------
 // class DomainDefinition
 // ----------------------
@@ -197,9 +197,10 @@ bsl::ostream& DispatcherClientData::print(bsl::ostream& stream,
     bslim::Printer printer(&stream, level, spacesPerLevel);
     printer.start();
     printer.printAttribute("clientType", d_clientType);
-    printer.printAttribute("processorHandle", d_processorHandle);
+    printer.printAttribute("processorHandle", d_processorHandle.load());
     printer.printAttribute("addedToFlushList",
                            (d_addedToFlushList ? "yes" : "no"));
+    printer.printAttribute("isMigratable", (d_isMigratable ? "yes" : "no"));
     printer.end();
 
     return stream;
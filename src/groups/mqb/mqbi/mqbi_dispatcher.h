@@ -117,6 +117,9 @@
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_spinlock.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -572,8 +575,10 @@ class DispatcherClientData {
     /// Type of dispatcher client.
     DispatcherClientType::Enum d_clientType;
 
-    /// Processor handle to which the client is associated with.
-    Dispatcher::ProcessorHandle d_processorHandle;
+    /// Processor handle to which the client is associated with.  Atomic
+    /// because it may be changed by the dispatcher while the client is
+    /// migrated to another processor (see `isMigratable`).
+    bsls::AtomicInt d_processorHandle;
 
     /// The dispatcher associated with the client.
     Dispatcher* d_dispatcher_p;
@@ -584,22 +589,74 @@ class DispatcherClientData {
     /// clients.
     bool d_addedToFlushList;
 
+    /// Whether the dispatcher is allowed to migrate the client from one
+    /// processor to another one at runtime.  This must be set before the
+    /// client is registered to the dispatcher.  A client opting in must only
+    /// rely on its associated `dispatcherClientData()` and `getEvent()` to
+    /// address its processor, and in particular must not keep an executor
+    /// obtained from the dispatcher.
+    bool d_isMigratable;
+
+    /// Number of threads currently enqueuing an event to the processor of
+    /// this client -- Dispatcher internal member, only maintained for
+    /// migratable clients.
+    bsls::AtomicInt d_numPendingEnqueues;
+
+    /// Time (in nanoseconds) spent processing events for this client since
+    /// the last time the dispatcher sampled it -- Dispatcher internal member,
+    /// only maintained for migratable clients.
+    bsls::AtomicInt64 d_processingTimeNs;
+
   public:
     // CREATORS
 
     /// Default constructor
     explicit DispatcherClientData();
 
+    /// Create a `DispatcherClientData` having the same value as the
+    /// specified `original` object.  Note that the Dispatcher internal
+    /// counters are not copied, and start at zero.
+    DispatcherClientData(const DispatcherClientData& original);
+
     // MANIPULATORS
+
+    /// Assign to this object the value of the specified `rhs` object, and
+    /// return a reference providing modifiable access to this object.  Note
+    /// that the Dispatcher internal counters are left untouched.
+    DispatcherClientData& operator=(const DispatcherClientData& rhs);
+
     DispatcherClientData& setClientType(DispatcherClientType::Enum value);
     DispatcherClientData&
     setProcessorHandle(Dispatcher::ProcessorHandle value);
     DispatcherClientData& setAddedToFlushList(bool value);
+    DispatcherClientData& setMigratable(bool value);
 
     /// Set the corresponding member to the specified `value` and return a
     /// reference offering modifiable access to this object.
     DispatcherClientData& setDispatcher(Dispatcher* value);
 
+    /// Associate the client to the specified processor `value`, overriding
+    /// the currently associated one.  This is a Dispatcher internal method,
+    /// used while migrating the client to another processor.
+    DispatcherClientData&
+    migrateToProcessor(Dispatcher::ProcessorHandle value);
+
+    /// Increment (resp. decrement) the number of threads currently
+    /// enqueuing an event to the processor of this client -- Dispatcher
+    /// internal methods.
+    void incrementPendingEnqueues();
+    void decrementPendingEnqueues();
+
+    /// Add the specified `value` nanoseconds to the processing time spent
+    /// for this client -- Dispatcher internal method, must only be called
+    /// from the processor of this client.
+    void addProcessingTime(bsls::Types::Int64 value);
+
+    /// Return the processing time (in nanoseconds) spent for this client
+    /// since the previous call to this method, and reset it to zero --
+    /// Dispatcher internal method.
+    bsls::Types::Int64 sampleProcessingTime();
+
     /// Return a pointer to the dispatcher associated with this object; or
     /// null is this client is not (yet) registered to a dispatcher.
     Dispatcher* dispatcher();
@@ -608,10 +665,15 @@ class DispatcherClientData {
     DispatcherClientType::Enum  clientType() const;
     Dispatcher::ProcessorHandle processorHandle() const;
     bool                        addedToFlushList() const;
+    bool                        isMigratable() const;
 
     /// Return the value of the corresponding member.
     const Dispatcher* dispatcher() const;
 
+    /// Return the number of threads currently enqueuing an event to the
+    /// processor of this client.
+    int numPendingEnqueues() const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -637,10 +699,20 @@ bsl::ostream& operator<<(bsl::ostream&               stream,
 // ======================
 
 /// Interface for a client of the Dispatcher.
+///
+/// Thread Safety
+/// -------------
+/// The thread id and the event source assigned to the client may be changed
+/// by the dispatcher (e.g., when the client is migrated to another
+/// processor) while other threads read them, and are therefore protected by
+/// a spin lock.
 class DispatcherClient {
   private:
     // DATA
 
+    /// Spin lock protecting `d_threadId` and `d_eventSource_sp`.
+    mutable bsls::SpinLock d_lock;
+
     /// The id of the thread this dispatcher client is assigned to.
     bslmt::ThreadUtil::Id d_threadId;
 
@@ -653,7 +725,8 @@ class DispatcherClient {
 
     // CREATORS
     DispatcherClient()
-    : d_threadId(k_ANY_THREAD_ID)
+    : d_lock(bsls::SpinLock::s_unlocked)
+    , d_threadId(k_ANY_THREAD_ID)
     {
         // NOTHING
     }
@@ -667,6 +740,7 @@ class DispatcherClient {
     /// @param threadId to assign.
     inline void setThreadId(bslmt::ThreadUtil::Id threadId)
     {
+        bsls::SpinLockGuard guard(&d_lock);  // SPINLOCK LOCK
         d_threadId = threadId;
     }
 
@@ -678,7 +752,11 @@ class DispatcherClient {
         // PRECONDITIONS
         BSLS_ASSERT(eventSource_sp);
 
-        d_eventSource_sp = eventSource_sp;
+        // Release the previous event source outside of the lock
+        bsl::shared_ptr<mqbi::DispatcherEventSource> previous(eventSource_sp);
+
+        bsls::SpinLockGuard guard(&d_lock);  // SPINLOCK LOCK
+        d_eventSource_sp.swap(previous);
     }
 
     /// Return a pointer to the dispatcher this client is associated with.
@@ -714,28 +792,38 @@ class DispatcherClient {
     /// associated with in dispatcher.
     inline bool inDispatcherThread() const
     {
+        const bslmt::ThreadUtil::Id threadId = getThreadId();
+
         // In most cases the following condition should short-circuit on
         // the first operand:
-        return (d_threadId == bslmt::ThreadUtil::selfId()) ||
-               (d_threadId == k_ANY_THREAD_ID);
+        return (threadId == bslmt::ThreadUtil::selfId()) ||
+               (threadId == k_ANY_THREAD_ID);
     }
 
-    bslmt::ThreadUtil::Id getThreadId() const { return d_threadId; }
+    bslmt::ThreadUtil::Id getThreadId() const
+    {
+        bsls::SpinLockGuard guard(&d_lock);  // SPINLOCK LOCK
+        return d_threadId;
+    }
 
     template <class EVENT_TYPE>
     bsl::shared_ptr<EVENT_TYPE> getEvent() const
     {
-        // PRECONDITIONS
-        BSLS_ASSERT(d_eventSource_sp);
-        return d_eventSource_sp->getEvent<EVENT_TYPE>();
+        return getEventSource()->getEvent<EVENT_TYPE>();
     }
 
-    inline const bsl::shared_ptr<mqbi::DispatcherEventSource>&
-    getEventSource() const
+    /// Return the event source assigned to this dispatcher client.  Note
+    /// that it is returned by value as it may be concurrently reassigned.
+    inline bsl::shared_ptr<mqbi::DispatcherEventSource> getEventSource() const
     {
-        // PRECONDITIONS
-        BSLS_ASSERT(d_eventSource_sp);
-        return d_eventSource_sp;
+        bsl::shared_ptr<mqbi::DispatcherEventSource> eventSource_sp;
+        {
+            bsls::SpinLockGuard guard(&d_lock);  // SPINLOCK LOCK
+            eventSource_sp = d_eventSource_sp;
+        }
+
+        BSLS_ASSERT(eventSource_sp);
+        return eventSource_sp;
     }
 };
 
@@ -786,10 +874,40 @@ inline DispatcherClientData::DispatcherClientData()
 , d_processorHandle(Dispatcher::k_INVALID_PROCESSOR_HANDLE)
 , d_dispatcher_p(0)
 , d_addedToFlushList(false)
+, d_isMigratable(false)
+, d_numPendingEnqueues(0)
+, d_processingTimeNs(0)
+{
+    // NOTHING
+}
+
+inline DispatcherClientData::DispatcherClientData(
+    const DispatcherClientData& original)
+: d_clientType(original.d_clientType)
+, d_processorHandle(original.d_processorHandle.load())
+, d_dispatcher_p(original.d_dispatcher_p)
+, d_addedToFlushList(original.d_addedToFlushList)
+, d_isMigratable(original.d_isMigratable)
+, d_numPendingEnqueues(0)
+, d_processingTimeNs(0)
 {
     // NOTHING
 }
 
+inline DispatcherClientData&
+DispatcherClientData::operator=(const DispatcherClientData& rhs)
+{
+    if (this != &rhs) {
+        d_clientType       = rhs.d_clientType;
+        d_processorHandle  = rhs.d_processorHandle.load();
+        d_dispatcher_p     = rhs.d_dispatcher_p;
+        d_addedToFlushList = rhs.d_addedToFlushList;
+        d_isMigratable     = rhs.d_isMigratable;
+    }
+
+    return *this;
+}
+
 inline DispatcherClientData&
 DispatcherClientData::setClientType(DispatcherClientType::Enum value)
 {
@@ -821,6 +939,12 @@ DispatcherClientData::setAddedToFlushList(bool value)
     return *this;
 }
 
+inline DispatcherClientData& DispatcherClientData::setMigratable(bool value)
+{
+    d_isMigratable = value;
+    return *this;
+}
+
 inline DispatcherClientData&
 DispatcherClientData::setDispatcher(Dispatcher* value)
 {
@@ -828,6 +952,39 @@ DispatcherClientData::setDispatcher(Dispatcher* value)
     return *this;
 }
 
+inline DispatcherClientData&
+DispatcherClientData::migrateToProcessor(Dispatcher::ProcessorHandle value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isMigratable);
+    BSLS_ASSERT_SAFE(d_processorHandle !=
+                     Dispatcher::k_INVALID_PROCESSOR_HANDLE);
+    BSLS_ASSERT_SAFE(value != Dispatcher::k_INVALID_PROCESSOR_HANDLE);
+
+    d_processorHandle = value;
+    return *this;
+}
+
+inline void DispatcherClientData::incrementPendingEnqueues()
+{
+    ++d_numPendingEnqueues;
+}
+
+inline void DispatcherClientData::decrementPendingEnqueues()
+{
+    --d_numPendingEnqueues;
+}
+
+inline void DispatcherClientData::addProcessingTime(bsls::Types::Int64 value)
+{
+    d_processingTimeNs.addRelaxed(value);
+}
+
+inline bsls::Types::Int64 DispatcherClientData::sampleProcessingTime()
+{
+    return d_processingTimeNs.swap(0);
+}
+
 inline Dispatcher* DispatcherClientData::dispatcher()
 {
     return d_dispatcher_p;
@@ -849,11 +1006,21 @@ inline bool DispatcherClientData::addedToFlushList() const
     return d_addedToFlushList;
 }
 
+inline bool DispatcherClientData::isMigratable() const
+{
+    return d_isMigratable;
+}
+
 inline const Dispatcher* DispatcherClientData::dispatcher() const
 {
     return d_dispatcher_p;
 }
 
+inline int DispatcherClientData::numPendingEnqueues() const
+{
+    return d_numPendingEnqueues;
+}
+
 }  // close package namespace
 
 // ---------------------------
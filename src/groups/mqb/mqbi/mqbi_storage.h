@@ -180,6 +180,10 @@ class StorageMessageAttributes {
 
     bool d_hasReceipt;
 
+    /// Whether the receipt for this message must additionally wait until the
+    /// message is synced to disk on this node.
+    bool d_syncBeforeReceipt;
+
     mqbi::QueueHandle* d_queueHandle;
 
     unsigned int d_crc32c;
@@ -233,6 +237,7 @@ class StorageMessageAttributes {
     StorageMessageAttributes&
     setCompressionAlgorithmType(bmqt::CompressionAlgorithmType::Enum value);
     StorageMessageAttributes& setReceipt(bool value);
+    StorageMessageAttributes& setSyncBeforeReceipt(bool value);
 
     /// Set the corresponding attribute to the specified `value` and return
     /// a reference offering modifiable access to this object.
@@ -248,6 +253,7 @@ class StorageMessageAttributes {
     unsigned int                       appDataLen() const;
     const bmqp::MessagePropertiesInfo& messagePropertiesInfo() const;
     bool                               hasReceipt() const;
+    bool                               syncBeforeReceipt() const;
     mqbi::QueueHandle*                 queueHandle() const;
 
     /// Return the CRC32-C associated with this object.
@@ -801,6 +807,7 @@ inline StorageMessageAttributes::StorageMessageAttributes()
 , d_appDataLen(0)
 , d_messagePropertiesInfo()
 , d_hasReceipt(true)
+, d_syncBeforeReceipt(false)
 , d_queueHandle(0)
 , d_crc32c(0)
 , d_compressionAlgorithmType(bmqt::CompressionAlgorithmType::e_NONE)
@@ -823,6 +830,7 @@ inline StorageMessageAttributes::StorageMessageAttributes(
 , d_appDataLen(appDataLen)
 , d_messagePropertiesInfo(messagePropertiesInfo)
 , d_hasReceipt(hasReceipt)
+, d_syncBeforeReceipt(false)
 , d_queueHandle(queueHandle)
 , d_crc32c(crc32c)
 , d_compressionAlgorithmType(compressionAlgorithmType)
@@ -881,6 +889,13 @@ StorageMessageAttributes::setReceipt(bool value)
     return *this;
 }
 
+inline StorageMessageAttributes&
+StorageMessageAttributes::setSyncBeforeReceipt(bool value)
+{
+    d_syncBeforeReceipt = value;
+    return *this;
+}
+
 inline StorageMessageAttributes&
 StorageMessageAttributes::setMessagePropertiesInfo(
     const bmqp::MessagePropertiesInfo& value)
@@ -898,6 +913,7 @@ inline void StorageMessageAttributes::reset()
     d_messagePropertiesInfo    = bmqp::MessagePropertiesInfo();
     d_queueHandle              = 0;
     d_hasReceipt               = true;
+    d_syncBeforeReceipt        = false;
     d_crc32c                   = 0;
     d_compressionAlgorithmType = bmqt::CompressionAlgorithmType::e_NONE;
 }
@@ -934,6 +950,11 @@ inline bool StorageMessageAttributes::hasReceipt() const
     return d_hasReceipt;
 }
 
+inline bool StorageMessageAttributes::syncBeforeReceipt() const
+{
+    return d_syncBeforeReceipt;
+}
+
 inline mqbi::QueueHandle* StorageMessageAttributes::queueHandle() const
 {
     return d_queueHandle;
@@ -455,6 +455,9 @@ class Cluster : public mqbi::Cluster {
     /// Get a modifiable reference to this object's blob shared pointer pool.
     BlobSpPool* _blobSpPool();
 
+    /// Get a modifiable reference to this object's dispatcher.
+    mqbmock::Dispatcher& _dispatcher();
+
     /// Get a modifiable reference to this object's _scheduler.
     bdlmt::EventScheduler& _scheduler();
 
@@ -614,6 +617,11 @@ inline Cluster::BlobSpPool* Cluster::_blobSpPool()
     return &d_blobSpPool;
 }
 
+inline mqbmock::Dispatcher& Cluster::_dispatcher()
+{
+    return d_dispatcher;
+}
+
 inline bdlmt::EventScheduler& Cluster::_scheduler()
 {
     return d_scheduler;
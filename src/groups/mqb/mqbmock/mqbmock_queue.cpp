@@ -58,6 +58,8 @@ Queue::Queue(mqbi::Domain* domain, bslma::Allocator* allocator)
 , d_queueEngine_p(0)
 , d_storage_p(0)
 , d_schemaLearner(allocator)
+, d_numReceipts(0)
+, d_numRemovals(0)
 {
     BSLS_ASSERT_SAFE(d_uri.isValid());
 
@@ -372,14 +374,14 @@ void Queue::onOpenFailure(BSLA_MAYBE_UNUSED unsigned int subQueueId)
 void Queue::onReceipt(BSLA_MAYBE_UNUSED const bmqt::MessageGUID& msgGUID,
                       BSLA_MAYBE_UNUSED mqbi::QueueHandle* qH)
 {
-    // NOTHING
+    ++d_numReceipts;
 }
 
 void Queue::onRemoval(BSLA_MAYBE_UNUSED const bmqt::MessageGUID& msgGUID,
                       BSLA_MAYBE_UNUSED mqbi::QueueHandle* qH,
                       BSLA_MAYBE_UNUSED bmqt::AckResult::Enum result)
 {
-    // NOTHING
+    ++d_numRemovals;
 }
 
 void Queue::onReplicatedBatch()
@@ -534,6 +536,16 @@ bmqp::SchemaLearner& Queue::schemaLearner() const
     return d_schemaLearner;
 }
 
+int Queue::_numReceipts() const
+{
+    return d_numReceipts;
+}
+
+int Queue::_numRemovals() const
+{
+    return d_numRemovals;
+}
+
 // -------------------
 // class HandleFactory
 // -------------------
@@ -157,6 +157,14 @@ class Queue : public mqbi::Queue {
 
     mutable bmqp::SchemaLearner d_schemaLearner;
 
+    int d_numReceipts;
+    // Number of times `onReceipt` has been
+    // invoked.
+
+    int d_numRemovals;
+    // Number of times `onRemoval` has been
+    // invoked.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(Queue, bslma::UsesBslmaAllocator)
@@ -436,6 +444,14 @@ class Queue : public mqbi::Queue {
 
     // ACCESSORS
     //   (specific to mqbi::MockQueue)
+
+    /// Return the number of messages this queue has been notified the
+    /// Receipt of through `onReceipt`.
+    int _numReceipts() const;
+
+    /// Return the number of messages this queue has been notified the
+    /// removal of through `onRemoval`.
+    int _numRemovals() const;
 };
 
 // ===================
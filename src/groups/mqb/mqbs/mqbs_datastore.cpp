@@ -122,6 +122,10 @@ DataStoreConfig::DataStoreConfig()
 , d_maxJournalFileSize(0)
 , d_maxQlistFileSize(0)
 , d_maxArchivedFileSets(0)
+, d_nextFileSetCreationPercent(0)
+, d_recoveryParallelism(0)
+, d_checkpointInterval(0)
+, d_replicationLatencyBudgetUs(0)
 {
     // NOTHING
 }
@@ -153,6 +157,12 @@ bsl::ostream& DataStoreConfig::print(bsl::ostream& stream,
     printer.printAttribute("hasRecoveredQueuesCb",
                            (recoveredQueuesCb() ? "yes" : "no"));
     printer.printAttribute("maxArchiveFileSets", maxArchivedFileSets());
+    printer.printAttribute("nextFileSetCreationPercent",
+                           nextFileSetCreationPercent());
+    printer.printAttribute("recoveryParallelism", recoveryParallelism());
+    printer.printAttribute("checkpointInterval", checkpointInterval());
+    printer.printAttribute("replicationLatencyBudgetUs",
+                           replicationLatencyBudgetUs());
     printer.end();
     return stream;
 }
@@ -446,6 +446,31 @@ class DataStoreConfig {
 
     int d_maxArchivedFileSets;
 
+    int d_nextFileSetCreationPercent;
+    // Fill ratio, in percent, of the
+    // active file set above which the next
+    // file set is created in the
+    // background.  0 disables background
+    // creation.
+
+    int d_recoveryParallelism;
+    // Maximum number of threads validating
+    // the messages recovered from local
+    // storage, including the dispatcher
+    // thread.  0 or 1 validates on the
+    // dispatcher thread only.
+
+    int d_checkpointInterval;
+    // Number of regular sync points
+    // between two checkpoints of the
+    // journal.  0 disables checkpoints.
+
+    int d_replicationLatencyBudgetUs;
+    // Latency, in microseconds, that
+    // batching replicated messages may
+    // add.  0 sends a batch every fixed
+    // number of messages.
+
   public:
     // CREATORS
     DataStoreConfig();
@@ -471,6 +496,31 @@ class DataStoreConfig {
     /// reference offering modifiable access to this object.
     DataStoreConfig& setMaxArchivedFileSets(int value);
 
+    /// Set the fill ratio, in percent, of the active file set above which
+    /// the next file set is created in the background to the specified
+    /// `value` and return a reference offering modifiable access to this
+    /// object.  A `value` of 0 disables background creation.
+    DataStoreConfig& setNextFileSetCreationPercent(int value);
+
+    /// Set the maximum number of threads validating the messages recovered
+    /// from local storage to the specified `value` and return a reference
+    /// offering modifiable access to this object.  A `value` of 0 or 1
+    /// validates them on the dispatcher thread only.
+    DataStoreConfig& setRecoveryParallelism(int value);
+
+    /// Set the number of regular sync points between two checkpoints of the
+    /// journal to the specified `value` and return a reference offering
+    /// modifiable access to this object.  A `value` of 0 disables
+    /// checkpoints.
+    DataStoreConfig& setCheckpointInterval(int value);
+
+    /// Set the latency, in microseconds, that batching the messages
+    /// replicated by the primary may add to their replication to the
+    /// specified `value` and return a reference offering modifiable access
+    /// to this object.  A `value` of 0 sends a batch every fixed number of
+    /// messages.
+    DataStoreConfig& setReplicationLatencyBudgetUs(int value);
+
     // ACCESSORS
     bdlbb::BlobBufferFactory* bufferFactory() const;
     bdlmt::EventScheduler*    scheduler() const;
@@ -491,6 +541,24 @@ class DataStoreConfig {
     /// Return the value of the corresponding member.
     int maxArchivedFileSets() const;
 
+    /// Return the fill ratio, in percent, of the active file set above which
+    /// the next file set is created in the background, or 0 if background
+    /// creation is disabled.
+    int nextFileSetCreationPercent() const;
+
+    /// Return the maximum number of threads validating the messages
+    /// recovered from local storage, including the dispatcher thread.
+    int recoveryParallelism() const;
+
+    /// Return the number of regular sync points between two checkpoints of
+    /// the journal.  A value of 0 means that checkpoints are disabled.
+    int checkpointInterval() const;
+
+    /// Return the latency, in microseconds, that batching the messages
+    /// replicated by the primary may add to their replication.  A value of 0
+    /// means that a batch is sent every fixed number of messages.
+    int replicationLatencyBudgetUs() const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -1070,6 +1138,32 @@ inline DataStoreConfig& DataStoreConfig::setMaxArchivedFileSets(int value)
     return *this;
 }
 
+inline DataStoreConfig&
+DataStoreConfig::setNextFileSetCreationPercent(int value)
+{
+    d_nextFileSetCreationPercent = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setRecoveryParallelism(int value)
+{
+    d_recoveryParallelism = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setCheckpointInterval(int value)
+{
+    d_checkpointInterval = value;
+    return *this;
+}
+
+inline DataStoreConfig&
+DataStoreConfig::setReplicationLatencyBudgetUs(int value)
+{
+    d_replicationLatencyBudgetUs = value;
+    return *this;
+}
+
 // ACCESSORS
 inline bdlbb::BlobBufferFactory* DataStoreConfig::bufferFactory() const
 {
@@ -1154,6 +1248,26 @@ inline int DataStoreConfig::maxArchivedFileSets() const
     return d_maxArchivedFileSets;
 }
 
+inline int DataStoreConfig::nextFileSetCreationPercent() const
+{
+    return d_nextFileSetCreationPercent;
+}
+
+inline int DataStoreConfig::recoveryParallelism() const
+{
+    return d_recoveryParallelism;
+}
+
+inline int DataStoreConfig::checkpointInterval() const
+{
+    return d_checkpointInterval;
+}
+
+inline int DataStoreConfig::replicationLatencyBudgetUs() const
+{
+    return d_replicationLatencyBudgetUs;
+}
+
 // ---------------------------
 // class DataStoreRecordHandle
 // ---------------------------
@@ -33,6 +33,7 @@
 #include <mqbs_filestoreutil.h>
 #include <mqbs_filesystemutil.h>
 #include <mqbs_inmemorystorage.h>
+#include <mqbs_journalcheckpoint.h>
 #include <mqbs_journalfileiterator.h>
 #include <mqbs_memoryblock.h>
 #include <mqbs_offsetptr.h>
@@ -71,6 +72,10 @@
 #include <bdlt_datetime.h>
 #include <bdlt_epochutil.h>
 #include <bdlt_timeunitratio.h>
+#include <bslmt_latch.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
 #include <bsl_algorithm.h>
 #include <bsl_c_errno.h>
 #include <bsl_cstddef.h>
@@ -106,6 +111,16 @@ const double k_PARTITION_AVAILABLESPACE_SECS = 20;
 
 const int k_NAGLE_PACKET_COUNT = 100;
 
+/// Maximum number of messages in a batch when a replication latency budget
+/// is configured.
+const int k_MAX_ADAPTIVE_BATCH_COUNT = 10 * k_NAGLE_PACKET_COUNT;
+
+/// Maximum number of replicated batches the primary keeps track of to
+/// measure the receipt latency and lag of its replicas.  The oldest batches
+/// are dropped beyond this limit, which only makes the measurement of a
+/// replica lagging that far behind less precise.
+const size_t k_MAX_REPLICATED_BATCHES = 64 * 1024;
+
 const int k_KEY_LEN = FileStoreProtocol::k_KEY_LENGTH;
 
 /// k_RESERVED1_SYNC_POINT_SIZE is the space in the end of the JOURNAL file
@@ -296,6 +311,297 @@ void printNextEventRecord(bsl::ostream&                       stream,
     allocator->deallocate(p);
 }
 
+/// Minimum number of recovered messages per segment when their validation
+/// is split across threads during recovery.  Smaller segments are not worth
+/// the cost of dispatching them to another thread.
+const size_t k_MIN_RECOVERY_SEGMENT_SIZE = 4096;
+
+/// Outstanding message retrieved from the JOURNAL during recovery, whose
+/// record in the DATA file is validated once the JOURNAL has been iterated.
+struct RecoveredMessage {
+    // TYPES
+    enum Status {
+        e_VALID                 = 0,
+        e_INVALID_HEADER_WORDS  = 1,
+        e_INVALID_MESSAGE_WORDS = 2,
+        e_INVALID_WORDS         = 3,
+        e_INVALID_PADDING       = 4,
+        e_INVALID_LENGTHS       = 5
+    };
+
+    // PUBLIC DATA
+
+    /// Record of the message in the in-memory record mapping, whose DATA
+    /// file related fields are populated once validated.
+    DataStoreConfig::RecordIterator d_recordIt;
+
+    /// Index of the MESSAGE record in the JOURNAL.
+    bsls::Types::Uint64 d_journalRecordIndex;
+
+    /// CRC32-C of the payload, as found in the MESSAGE record.
+    unsigned int d_crc32c;
+
+    /// Outcome of the validation.
+    Status d_status;
+
+    /// Header, options and total length of the DATA file record, as read
+    /// from its 'DataHeader', and value of its padding byte.
+    unsigned int d_headerSize;
+    unsigned int d_optionsSize;
+    unsigned int d_totalLen;
+    int          d_padding;
+
+    /// CRC32-C of the payload as found in the DATA file.
+    unsigned int d_checksum;
+};
+
+typedef bsl::vector<RecoveredMessage> RecoveredMessages;
+
+/// Validate the DATA file records, in the specified `dataFd`, of the
+/// specified `numMessages` recovered messages starting at the specified
+/// `messages`, and load the outcome into each of them.  Arrive on the
+/// specified `latch`, if any, once done.
+void validateRecoveredMessagesSegment(RecoveredMessage*           messages,
+                                      size_t                      numMessages,
+                                      const MappedFileDescriptor* dataFd,
+                                      bslmt::Latch*               latch)
+{
+    for (size_t i = 0; i < numMessages; ++i) {
+        RecoveredMessage& message = messages[i];
+        DataStoreRecord&  record  = message.d_recordIt->second;
+
+        OffsetPtr<const DataHeader> dataHeader(dataFd->block(),
+                                               record.d_messageOffset);
+
+        message.d_headerSize = dataHeader->headerWords() *
+                               bmqp::Protocol::k_WORD_SIZE;
+        message.d_optionsSize = dataHeader->optionsWords() *
+                                bmqp::Protocol::k_WORD_SIZE;
+        message.d_totalLen = dataHeader->messageWords() *
+                             bmqp::Protocol::k_WORD_SIZE;
+        message.d_padding  = 0;
+        message.d_checksum = 0;
+
+        if (0 == message.d_headerSize) {
+            message.d_status = RecoveredMessage::e_INVALID_HEADER_WORDS;
+            continue;  // CONTINUE
+        }
+
+        if (0 == message.d_totalLen) {
+            message.d_status = RecoveredMessage::e_INVALID_MESSAGE_WORDS;
+            continue;  // CONTINUE
+        }
+
+        if ((message.d_headerSize + message.d_optionsSize) >=
+            message.d_totalLen) {
+            message.d_status = RecoveredMessage::e_INVALID_WORDS;
+            continue;  // CONTINUE
+        }
+
+        const char* begin = dataFd->block().base() + record.d_messageOffset;
+        message.d_padding = static_cast<int>(begin[message.d_totalLen - 1]);
+
+        if (message.d_padding < 1 ||
+            message.d_padding > bmqp::Protocol::k_DWORD_SIZE) {
+            message.d_status = RecoveredMessage::e_INVALID_PADDING;
+            continue;  // CONTINUE
+        }
+
+        if (message.d_totalLen < (message.d_headerSize +
+                                  message.d_optionsSize + message.d_padding)) {
+            message.d_status = RecoveredMessage::e_INVALID_LENGTHS;
+            continue;  // CONTINUE
+        }
+
+        const unsigned int appDataLen = message.d_totalLen -
+                                        message.d_headerSize -
+                                        message.d_optionsSize -
+                                        message.d_padding;
+
+        message.d_checksum = bmqp::Crc32c::calculate(
+            begin + message.d_headerSize + message.d_optionsSize,
+            appDataLen);
+        message.d_status = RecoveredMessage::e_VALID;
+
+        // Only this thread touches this record until the validation of all
+        // recovered messages is complete.
+
+        record.d_appDataUnpaddedLen         = appDataLen;
+        record.d_dataOrQlistRecordPaddedLen = message.d_totalLen;
+        record.d_messagePropertiesInfo = bmqp::MessagePropertiesInfo(
+            *dataHeader);
+    }
+
+    if (latch) {
+        latch->arrive();
+    }
+}
+
+/// Validate the DATA file records, in the specified `dataFd`, of the
+/// specified recovered `messages`, splitting them in up to the specified
+/// `parallelism` segments.  All segments but the first one are validated by
+/// a thread pool dedicated to this validation, created using the specified
+/// `allocator`, while the calling thread validates the first one, and this
+/// function returns once all of them are validated.  Return the number of
+/// threads which shared the validation.
+int validateRecoveredMessages(RecoveredMessages*          messages,
+                              const MappedFileDescriptor& dataFd,
+                              int                         parallelism,
+                              bslma::Allocator*           allocator)
+{
+    const size_t numMessages = messages->size();
+    size_t       numSegments = 1;
+    if (1 < parallelism) {
+        numSegments = bsl::min(static_cast<size_t>(parallelism),
+                               numMessages / k_MIN_RECOVERY_SEGMENT_SIZE);
+    }
+
+    // The threads are only needed for the duration of the validation, and
+    // are not shared with the other background work of the cluster, so that
+    // 'parallelism' is honored.
+
+    bdlmt::FixedThreadPool threadPool(
+        bslmt::ThreadAttributes().setThreadName("bmqRecoveryTP"),
+        bsl::max(1, static_cast<int>(numSegments) - 1),  // numThreads
+        bsl::max(1, static_cast<int>(numSegments) - 1),  // maxNumPendingJobs
+        allocator);
+    if (1 < numSegments && 0 != threadPool.start()) {
+        // Validate on the calling thread only.
+        numSegments = 1;
+    }
+
+    if (1 >= numSegments) {
+        validateRecoveredMessagesSegment(messages->data(),
+                                         numMessages,
+                                         &dataFd,
+                                         0);
+        return 1;  // RETURN
+    }
+
+    const size_t segmentSize = (numMessages + numSegments - 1) / numSegments;
+    bslmt::Latch latch(static_cast<int>(numSegments - 1));
+
+    for (size_t segment = 1; segment < numSegments; ++segment) {
+        const size_t begin = bsl::min(segment * segmentSize, numMessages);
+        const size_t count = bsl::min(segmentSize, numMessages - begin);
+
+        const int rc = threadPool.enqueueJob(
+            bdlf::BindUtil::bind(&validateRecoveredMessagesSegment,
+                                 messages->data() + begin,
+                                 count,
+                                 &dataFd,
+                                 &latch));
+        if (0 != rc) {
+            // Thread pool is not accepting jobs; validate in this thread.
+            validateRecoveredMessagesSegment(messages->data() + begin,
+                                             count,
+                                             &dataFd,
+                                             &latch);
+        }
+    }
+
+    validateRecoveredMessagesSegment(messages->data(),
+                                     segmentSize,
+                                     &dataFd,
+                                     0);
+    latch.wait();
+
+    return static_cast<int>(numSegments);
+}
+
+/// Mechanism to iterate backward over the JOURNAL records to recover.  These
+/// are all the records of the JOURNAL unless a checkpoint of it is provided,
+/// in which case these are the records following the sync point of the
+/// checkpoint, that sync point, and the records listed in the checkpoint.
+class RecoveryJournalCursor {
+  private:
+    // DATA
+
+    /// Checkpoint of the JOURNAL, if any.  Held, not owned.
+    const JournalCheckpoint* d_checkpoint_p;
+
+    /// Whether the sync point of the checkpoint has been reached.
+    bool d_isInCheckpoint;
+
+    /// Number of records listed in the checkpoint which are still to be
+    /// iterated over.
+    size_t d_numRemainingOffsets;
+
+  public:
+    // CREATORS
+
+    /// Create a cursor over the records to recover, given the specified
+    /// `checkpoint` of the JOURNAL, which may be null.
+    explicit RecoveryJournalCursor(const JournalCheckpoint* checkpoint)
+    : d_checkpoint_p(checkpoint)
+    , d_isInCheckpoint(false)
+    , d_numRemainingOffsets(checkpoint ? checkpoint->recordOffsets().size()
+                                       : 0)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+
+    /// Move the specified reverse mode journal iterator `it` to the next
+    /// record to recover.  Return 1 if it is on a valid record, 0 if all
+    /// records to recover have been iterated over, or a negative value if
+    /// an error was encountered, like `JournalFileIterator::nextRecord`.
+    int nextRecord(JournalFileIterator* it)
+    {
+        if (!d_checkpoint_p) {
+            return it->nextRecord();  // RETURN
+        }
+
+        if (!d_isInCheckpoint) {
+            const int rc = it->nextRecord();
+            if (1 == rc &&
+                it->recordOffset() == d_checkpoint_p->syncPointOffset()) {
+                d_isInCheckpoint = true;
+            }
+            return rc;  // RETURN
+        }
+
+        if (0 == d_numRemainingOffsets) {
+            it->clear();
+            return 0;  // RETURN
+        }
+
+        const bsls::Types::Uint64 offset =
+            d_checkpoint_p->recordOffsets()[--d_numRemainingOffsets];
+        BSLS_ASSERT_SAFE(offset < it->recordOffset());
+
+        return it->advance((it->recordOffset() - offset) /
+                           (it->header().recordWords() *
+                            bmqp::Protocol::k_WORD_SIZE));
+    }
+
+    // ACCESSORS
+
+    /// Return true if the sync point of the checkpoint has been reached, in
+    /// which case the records iterated over are not consecutive anymore.
+    bool isInCheckpoint() const { return d_isInCheckpoint; }
+};
+
+// =============================
+// struct ReplicatedBatchKeyLess
+// =============================
+
+/// Comparator to binary search replicated batches by record key.
+struct ReplicatedBatchKeyLess {
+    template <class BATCH>
+    bool operator()(const BATCH& lhs, const DataStoreRecordKey& rhs) const
+    {
+        return lhs.d_key < rhs;
+    }
+
+    template <class BATCH>
+    bool operator()(const DataStoreRecordKey& lhs, const BATCH& rhs) const
+    {
+        return lhs < rhs.d_key;
+    }
+};
+
 }  // close unnamed namespace
 
 // ---------------
@@ -367,6 +673,8 @@ int FileStore::openInRecoveryMode(bsl::ostream&    errorDescription,
         rc_SYNC_POINT_FAILURE                  = -11
     };
 
+    const bsls::Types::Int64 startTime = bmqu::Time::highResolutionTimer();
+
     MappedFileDescriptor journalFd;
     MappedFileDescriptor dataFd;
     MappedFileDescriptor qlistFd;
@@ -822,8 +1130,44 @@ int FileStore::openInRecoveryMode(bsl::ostream&    errorDescription,
                   << "Attempting to recover messages from the local storage "
                   << (asPrimary ? "as primary." : "as replica.");
 
+    // Load the checkpoint of the journal, if any, so that only the records
+    // written after it are replayed.  Any issue with it is not fatal, since
+    // the whole journal can be replayed instead.
+
+    JournalCheckpoint  checkpoint(d_allocator_p);
+    JournalCheckpoint* checkpoint_p = 0;
+    bsl::string        checkpointFile(d_allocator_p);
+    FileStoreUtil::createCheckpointFileName(&checkpointFile,
+                                            recoveryFileSet.journalFile());
+    {
+        bmqu::MemOutStream checkpointErrorDesc;
+        rc = JournalCheckpointUtil::load(checkpointErrorDesc,
+                                         &checkpoint,
+                                         checkpointFile,
+                                         d_allocator_p);
+        if (0 == rc) {
+            rc = JournalCheckpointUtil::validate(checkpointErrorDesc,
+                                                 checkpoint,
+                                                 jit);
+            if (0 == rc) {
+                checkpoint_p = &checkpoint;
+                BALL_LOG_INFO << partitionDesc() << "Loaded checkpoint ["
+                              << checkpointFile << "]: " << checkpoint;
+            }
+        }
+
+        if (0 != rc && 1 != rc) {
+            BALL_LOG_WARN << partitionDesc() << "Ignoring checkpoint ["
+                          << checkpointFile << "], rc: " << rc << ", error: "
+                          << checkpointErrorDesc.str()
+                          << ". Replaying the whole journal.";
+        }
+    }
+
     // jit, qit & dit may get invalidated after the call below.
 
+    const bsls::Types::Int64 recoverMessagesStartTime =
+        bmqu::Time::highResolutionTimer();
     rc = recoverMessages(queueKeyInfoMap,
                          &journalFileOffset,
                          &qlistFileOffset,
@@ -831,7 +1175,8 @@ int FileStore::openInRecoveryMode(bsl::ostream&    errorDescription,
                          &jit,
                          &qit,
                          &dit,
-                         asPrimary);
+                         asPrimary,
+                         checkpoint_p);
     if (0 != rc) {
         BALL_LOG_ERROR << partitionDesc() << "Failed to recover messages from"
                        << " storage, rc: " << rc;
@@ -839,10 +1184,13 @@ int FileStore::openInRecoveryMode(bsl::ostream&    errorDescription,
     }
 
     BALL_LOG_INFO << partitionDesc()
-                  << "Finished recovering messages from local storage. End "
-                  << "offsets of JOURNAL, QLIST and DATA files respectively: "
-                  << journalFileOffset << ", " << qlistFileOffset << ", "
-                  << dataFileOffset;
+                  << "Finished recovering messages from local storage in "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         bmqu::Time::highResolutionTimer() -
+                         recoverMessagesStartTime)
+                  << ". End offsets of JOURNAL, QLIST and DATA files "
+                  << "respectively: " << journalFileOffset << ", "
+                  << qlistFileOffset << ", " << dataFileOffset;
 
     // Offsets populated above must not be greater than the file size.
     BSLS_ASSERT_SAFE(journalFileOffset <= journalFd.fileSize());
@@ -1059,17 +1407,27 @@ int FileStore::openInRecoveryMode(bsl::ostream&    errorDescription,
         }
     }
 
+    BALL_LOG_INFO << partitionDesc()
+                  << "Opened partition from local storage in "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         bmqu::Time::highResolutionTimer() - startTime)
+                  << " (of which "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         recoverMessagesStartTime - startTime)
+                  << " opening the file set for recovery).";
+
     return rc_SUCCESS;
 }
 
-int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
-                               bsls::Types::Uint64* journalOffset,
-                               bsls::Types::Uint64* qlistOffset,
-                               bsls::Types::Uint64* dataOffset,
-                               JournalFileIterator* jit,
-                               QlistFileIterator*   qit,
-                               DataFileIterator*    dit,
-                               bool                 withCSL)
+int FileStore::recoverMessages(QueueKeyInfoMap*         queueKeyInfoMap,
+                               bsls::Types::Uint64*     journalOffset,
+                               bsls::Types::Uint64*     qlistOffset,
+                               bsls::Types::Uint64*     dataOffset,
+                               JournalFileIterator*     jit,
+                               QlistFileIterator*       qit,
+                               DataFileIterator*        dit,
+                               bool                     withCSL,
+                               const JournalCheckpoint* checkpoint)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(queueKeyInfoMap);
@@ -1148,8 +1506,11 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
     BSLS_ASSERT_SAFE(journalIt.isReverseMode());
 
     // First pass.
-    int rc = 0;
-    while ((rc = journalIt.nextRecord()) == 1) {
+    const bsls::Types::Int64 firstPassStartTime =
+        bmqu::Time::highResolutionTimer();
+    RecoveryJournalCursor firstPassCursor(checkpoint);
+    int                   rc = 0;
+    while ((rc = firstPassCursor.nextRecord(&journalIt)) == 1) {
         const RecordHeader& recHeader = journalIt.recordHeader();
         RecordType::Enum    rt        = recHeader.type();
         if (rt == RecordType::e_UNDEFINED) {
@@ -1473,7 +1834,10 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
     }
 
     BALL_LOG_INFO << partitionDesc() << "Completed first pass over the journal"
-                  << " with rc: " << rc
+                  << " with rc: " << rc << " in "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         bmqu::Time::highResolutionTimer() -
+                         firstPassStartTime)
                   << ". Offset of 1st sync point: " << firstSyncPtOffset
                   << ".";
 
@@ -1490,6 +1854,10 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
     bool         isLastQlistRecord   = true;  // ie, first in iteration
     unsigned int primaryLeaseId      = d_writeHeadLeaseId;
 
+    // Outstanding messages, in iteration order, whose DATA file records are
+    // validated after the second pass.
+    RecoveredMessages recoveredMessages(d_allocator_p);
+
     // Highest sequence number recovered so far for 'primaryLeaseId', captured
     // before 'd_highestSeqNums' is cleared below.
     const bsls::Types::Uint64 currentSeqNum = sequenceNumber();
@@ -1507,13 +1875,40 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
     }
 
     // Second pass.
-    while (1 == (rc = jit->nextRecord())) {
+    const bsls::Types::Int64 secondPassStartTime =
+        bmqu::Time::highResolutionTimer();
+    RecoveryJournalCursor secondPassCursor(checkpoint);
+    while (1 == (rc = secondPassCursor.nextRecord(jit))) {
         const RecordHeader& recHeader = jit->recordHeader();
         RecordType::Enum    rt        = recHeader.type();
         BSLS_ASSERT_SAFE(RecordType::e_UNDEFINED != rt);
         BSLS_ASSERT_SAFE(0 != recHeader.primaryLeaseId());
         BSLS_ASSERT_SAFE(0 != recHeader.sequenceNumber());
 
+        if (secondPassCursor.isInCheckpoint() &&
+            (isLastMessageRecord || isLastQlistRecord)) {
+            // Reached the sync point of the checkpoint without encountering
+            // any MESSAGE (resp. QueueOp.CREATION/ADDITION) record after it.
+            // The records before it are not all iterated over, so retrieve
+            // the end of the DATA (resp. QLIST) file from the sync point,
+            // which is where the last such record ended.
+
+            BSLS_ASSERT_SAFE(RecordType::e_JOURNAL_OP == rt);
+            const JournalOpRecord& syncPt = jit->asJournalOpRecord();
+            if (isLastMessageRecord) {
+                *dataOffset = static_cast<bsls::Types::Uint64>(
+                                  syncPt.dataFileOffsetDwords()) *
+                              bmqp::Protocol::k_DWORD_SIZE;
+                isLastMessageRecord = false;
+            }
+            if (d_qListAware && isLastQlistRecord) {
+                *qlistOffset = static_cast<bsls::Types::Uint64>(
+                                   syncPt.qlistFileOffsetWords()) *
+                               bmqp::Protocol::k_WORD_SIZE;
+            }
+            isLastQlistRecord = false;
+        }
+
         // Validate PSN in the RecordHeader. Note that leaseId in
         // the RecordHeader can be smaller than 'primaryLeaseId'.
 
@@ -1532,16 +1927,19 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
         if (recHeader.primaryLeaseId() == primaryLeaseId) {
             bool invalidSeqNum = false;
 
-            if (jit->recordOffset() >= firstSyncPtOffset) {
-                // Not a rolled-over record.
+            if (jit->recordOffset() >= firstSyncPtOffset &&
+                !secondPassCursor.isInCheckpoint()) {
+                // Not a rolled-over record, nor a record listed in the
+                // checkpoint.
 
                 if (recHeader.sequenceNumber() != (sequenceNum - 1)) {
                     invalidSeqNum = true;
                 }
             }
             else {
-                // PSNs of rolled over records may not increment by
-                // 1, but they should still be monotonically increasing.
+                // PSNs of rolled over records, and of records listed in
+                // the checkpoint, may not increment by 1, but they should
+                // still be monotonically increasing.
 
                 if (recHeader.sequenceNumber() > (sequenceNum - 1)) {
                     invalidSeqNum = true;
@@ -2509,90 +2907,6 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
             }
 
             // The message needs to be recovered as it is an outstanding one.
-            // Check various fields in the message header etc as well as the
-            // CRC32C.
-
-            OffsetPtr<const DataHeader> dataHeader(dataFd->block(),
-                                                   dataHeaderOffset);
-
-            const unsigned int headerSize = dataHeader->headerWords() *
-                                            bmqp::Protocol::k_WORD_SIZE;
-            const unsigned int optionsSize = dataHeader->optionsWords() *
-                                             bmqp::Protocol::k_WORD_SIZE;
-            const unsigned int totalLen = dataHeader->messageWords() *
-                                          bmqp::Protocol::k_WORD_SIZE;
-
-            if (0 == headerSize) {
-                BALL_LOG_ERROR
-                    << partitionDesc() << "MESSAGE record with GUID ["
-                    << rec.messageGUID() << "], queueKey [" << rec.queueKey()
-                    << "] at journal offset: " << jit->recordOffset()
-                    << ", the DATA record present at offset: "
-                    << dataHeaderOffset << " in the DATA file has invalid "
-                    << "'headerWords' field in its 'DataHeader'.";
-
-                return rc_INVALID_DATA_RECORD;  // RETURN
-            }
-
-            if (0 == totalLen) {
-                BALL_LOG_ERROR
-                    << partitionDesc() << "MESSAGE record with GUID ["
-                    << rec.messageGUID() << "], queueKey [" << rec.queueKey()
-                    << "] at journal offset: " << jit->recordOffset()
-                    << ", the DATA record present at offset: "
-                    << dataHeaderOffset
-                    << " in the DATA file has invalid 'messageWords' field in "
-                    << "its 'DataHeader'.";
-
-                return rc_INVALID_DATA_RECORD;  // RETURN
-            }
-
-            if ((headerSize + optionsSize) >= totalLen) {
-                BALL_LOG_ERROR
-                    << partitionDesc() << "MESSAGE record with GUID ["
-                    << rec.messageGUID() << "], queueKey [" << rec.queueKey()
-                    << "] at journal offset: " << jit->recordOffset()
-                    << ", the DATA record present at offset: "
-                    << dataHeaderOffset
-                    << " in the DATA file has invalid 'headerWords', "
-                    << "optionsWords and/or 'messageWords' fields in its "
-                    << "'DataHeader'. headerSize: " << headerSize
-                    << ", optionsSize: " << optionsSize
-                    << ", total length: " << totalLen << ".";
-
-                return rc_INVALID_DATA_RECORD;  // RETURN
-            }
-
-            const char* begin    = dataFd->block().base() + dataHeaderOffset;
-            const int   lastByte = static_cast<int>(begin[totalLen - 1]);
-
-            if (lastByte < 1 || lastByte > bmqp::Protocol::k_DWORD_SIZE) {
-                BALL_LOG_ERROR
-                    << partitionDesc() << "MESSAGE record with GUID ["
-                    << rec.messageGUID() << "], queueKey [" << rec.queueKey()
-                    << "] at journal offset: " << jit->recordOffset()
-                    << ", the DATA record present at offset: "
-                    << dataHeaderOffset
-                    << " in the DATA file has invalid padding: " << lastByte
-                    << ".";
-
-                return rc_INVALID_DATA_RECORD;  // RETURN
-            }
-
-            if (totalLen < (headerSize + optionsSize + lastByte)) {
-                BALL_LOG_ERROR
-                    << partitionDesc() << "MESSAGE record with GUID ["
-                    << rec.messageGUID() << "], queueKey [" << rec.queueKey()
-                    << "] at journal offset: " << jit->recordOffset()
-                    << ", the DATA record present at offset: "
-                    << dataHeaderOffset
-                    << " in the DATA file has invalid messageWords/headerWords"
-                    << "/optionsWords/padding fields -- " << totalLen << "/"
-                    << headerSize << "/" << optionsSize << "/" << lastByte
-                    << ".";
-
-                return rc_INVALID_DATA_RECORD;  // RETURN
-            }
 
             if (0 == queueKeyInfoMap->count(rec.queueKey())) {
                 if (withCSL) {
@@ -2620,53 +2934,141 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
                 }
             }
 
-            bsls::Types::Uint64 appDataOffset = dataHeaderOffset + headerSize +
-                                                optionsSize;
-            unsigned int appDataLen = totalLen - headerSize - optionsSize -
-                                      lastByte;
-
-            // Check CRC32C
-            unsigned int checksum = bmqp::Crc32c::calculate(
-                dataFd->block().base() + appDataOffset,
-                appDataLen);
-
-            if (rec.crc32c() != checksum) {
-                BMQTSK_ALARMLOG_ALARM("RECOVERY")
-                    << partitionDesc() << "Recovery: CRC mismatch for guid ["
-                    << rec.messageGUID() << "] for queueKey ["
-                    << rec.queueKey() << "] in journal file ["
-                    << activeFileSet->d_journal.d_fileName
-                    << "], offset: " << jit->recordOffset()
-                    << ", index: " << jit->recordIndex()
-                    << ". CRC32-C in JOURNAL record: " << rec.crc32c()
-                    << ". CRC32-C of payload in DATA file: " << checksum
-                    << ". Payload offset in DATA file: " << appDataOffset
-                    << BMQTSK_ALARMLOG_END;
-            }
+            // Update in-memory record mapping.  Fields describing the record
+            // in the DATA file are populated once the DATA file has been
+            // validated, after this pass.
 
             DataStoreRecordKey key(sequenceNum, primaryLeaseId);
             DataStoreRecord record(RecordType::e_MESSAGE, jit->recordOffset());
-            record.d_messageOffset              = dataHeaderOffset;
-            record.d_appDataUnpaddedLen         = appDataLen;
-            record.d_dataOrQlistRecordPaddedLen = totalLen;
-            record.d_hasReceipt                 = true;
-            record.d_arrivalTimestamp           = recHeader.timestamp();
-            record.d_messagePropertiesInfo      = bmqp::MessagePropertiesInfo(
-                *dataHeader);
-
-            // Update in-memory record mapping.
-            d_records.rinsert(bsl::make_pair(key, record));
+            record.d_messageOffset    = dataHeaderOffset;
+            record.d_hasReceipt       = true;
+            record.d_arrivalTimestamp = recHeader.timestamp();
+
+            RecoveredMessage message;
+            message.d_recordIt =
+                d_records.rinsert(bsl::make_pair(key, record)).first;
+            message.d_journalRecordIndex = jit->recordIndex();
+            message.d_crc32c             = rec.crc32c();
+            recoveredMessages.push_back(message);
 
-            // Update outstanding JOURNAL and DATA bytes.
+            // Update outstanding JOURNAL bytes.  Outstanding DATA bytes are
+            // updated once the DATA file has been validated.
 
             activeFileSet->d_journal.d_outstandingBytes +=
                 FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
-            activeFileSet->d_data.d_outstandingBytes += totalLen;
         }
     }
 
+    if (checkpoint) {
+        // Records skipped thanks to the checkpoint may have had a higher
+        // sequence number than the ones iterated over for their primary
+        // lease id.
+
+        const JournalCheckpoint::HighestSeqNums& highestSeqNums =
+            checkpoint->highestSeqNums();
+        for (JournalCheckpoint::HighestSeqNums::const_iterator cit =
+                 highestSeqNums.cbegin();
+             cit != highestSeqNums.cend();
+             ++cit) {
+            bsls::Types::Uint64& seqNum = d_highestSeqNums[cit->first];
+            seqNum                      = bsl::max(seqNum, cit->second);
+        }
+    }
+
+    const bsls::Types::Int64 validationStartTime =
+        bmqu::Time::highResolutionTimer();
+
     BALL_LOG_INFO << partitionDesc() << "Completed second pass over the "
-                  << "journal with rc: " << rc;
+                  << "journal with rc: " << rc << " in "
+                  << bmqu::PrintUtil::prettyTimeInterval(validationStartTime -
+                                                         secondPassStartTime)
+                  << ". Validating " << recoveredMessages.size()
+                  << " outstanding messages in the DATA file.";
+
+    // Validate the DATA file records of the outstanding messages, which is
+    // the bulk of the work for large partitions as their payload has to be
+    // read to verify its CRC32-C, possibly in parallel.  Then report the
+    // outcome in the order records were iterated.
+
+    const int numValidationThreads = validateRecoveredMessages(
+        &recoveredMessages,
+        *dataFd,
+        d_config.recoveryParallelism(),
+        d_allocator_p);
+
+    for (RecoveredMessages::const_iterator cit = recoveredMessages.cbegin();
+         cit != recoveredMessages.cend();
+         ++cit) {
+        const DataStoreRecord&               record = cit->d_recordIt->second;
+        const OffsetPtr<const MessageRecord> rec(
+            jit->mappedFileDescriptor()->block(),
+            record.d_recordOffset);
+
+        if (RecoveredMessage::e_VALID != cit->d_status) {
+            bmqu::MemOutStream out;
+            out << partitionDesc() << "MESSAGE record with GUID ["
+                << rec->messageGUID() << "], queueKey [" << rec->queueKey()
+                << "] at journal offset: " << record.d_recordOffset
+                << ", the DATA record present at offset: "
+                << record.d_messageOffset << " in the DATA file has ";
+
+            switch (cit->d_status) {
+            case RecoveredMessage::e_INVALID_HEADER_WORDS: {
+                out << "invalid 'headerWords' field in its 'DataHeader'.";
+            } break;
+            case RecoveredMessage::e_INVALID_MESSAGE_WORDS: {
+                out << "invalid 'messageWords' field in its 'DataHeader'.";
+            } break;
+            case RecoveredMessage::e_INVALID_WORDS: {
+                out << "invalid 'headerWords', optionsWords and/or "
+                    << "'messageWords' fields in its 'DataHeader'. "
+                    << "headerSize: " << cit->d_headerSize
+                    << ", optionsSize: " << cit->d_optionsSize
+                    << ", total length: " << cit->d_totalLen << ".";
+            } break;
+            case RecoveredMessage::e_INVALID_PADDING: {
+                out << "invalid padding: " << cit->d_padding << ".";
+            } break;
+            case RecoveredMessage::e_INVALID_LENGTHS:
+            default: {
+                out << "invalid messageWords/headerWords/optionsWords/padding"
+                    << " fields -- " << cit->d_totalLen << "/"
+                    << cit->d_headerSize << "/" << cit->d_optionsSize << "/"
+                    << cit->d_padding << ".";
+            } break;
+            }
+
+            BALL_LOG_ERROR << out.str();
+            return rc_INVALID_DATA_RECORD;  // RETURN
+        }
+
+        if (cit->d_crc32c != cit->d_checksum) {
+            BMQTSK_ALARMLOG_ALARM("RECOVERY")
+                << partitionDesc() << "Recovery: CRC mismatch for guid ["
+                << rec->messageGUID() << "] for queueKey [" << rec->queueKey()
+                << "] in journal file [" << activeFileSet->d_journal.d_fileName
+                << "], offset: " << record.d_recordOffset
+                << ", index: " << cit->d_journalRecordIndex
+                << ". CRC32-C in JOURNAL record: " << cit->d_crc32c
+                << ". CRC32-C of payload in DATA file: " << cit->d_checksum
+                << ". Payload offset in DATA file: "
+                << (record.d_messageOffset + cit->d_headerSize +
+                    cit->d_optionsSize)
+                << BMQTSK_ALARMLOG_END;
+        }
+
+        // Update outstanding DATA bytes.
+
+        activeFileSet->d_data.d_outstandingBytes += cit->d_totalLen;
+    }
+
+    BALL_LOG_INFO << partitionDesc() << "Validated "
+                  << recoveredMessages.size()
+                  << " outstanding messages in the DATA file in "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         bmqu::Time::highResolutionTimer() -
+                         validationStartTime)
+                  << " using " << numValidationThreads << " threads.";
 
     BALL_LOG_INFO_BLOCK
     {
@@ -2711,6 +3113,290 @@ int FileStore::create(FileSetSp* fileSetSp)
     return rc;
 }
 
+int FileStore::createOrTakeNextFileSet(FileSetSp*          fileSetSp,
+                                       bsls::Types::Int64* stallTime)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(fileSetSp);
+    BSLS_ASSERT_SAFE(stallTime);
+
+    const bsls::Types::Int64 startTime = bmqu::Time::highResolutionTimer();
+
+    // If a worker thread is creating the next file set, wait for it rather
+    // than racing it for the file names.
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_nextFileSetMutex);  // LOCK
+
+    int rc = 0;
+    if (d_nextFileSet_sp) {
+        fileSetSp->swap(d_nextFileSet_sp);
+
+        FileSet* fs = fileSetSp->get();
+        fs->d_aliasedChunk_sp.reset(
+            fs,
+            bdlf::BindUtil::bind(&FileStore::gc, this, fs));
+        fs->d_aliasedChunk_wp = fs->d_aliasedChunk_sp;
+
+        BALL_LOG_INFO << partitionDesc() << "Using file set ["
+                      << fs->d_data.d_fileName << "], ["
+                      << fs->d_journal.d_fileName
+                      << "] created in the background.";
+    }
+    else {
+        rc = create(fileSetSp);
+    }
+
+    *stallTime = bmqu::Time::highResolutionTimer() - startTime;
+    return rc;
+}
+
+void FileStore::createNextFileSetIfNeeded()
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    const int threshold = d_config.nextFileSetCreationPercent();
+    if (0 >= threshold || d_isNextFileSetRequested || d_fileSets.empty()) {
+        return;  // RETURN
+    }
+
+    const FileSet*      activeFileSet = d_fileSets[0].get();
+    bsls::Types::Uint64 percent       = bsl::max(
+        computePercentage(activeFileSet->d_journal.d_filePosition,
+                          activeFileSet->d_journal.d_file.fileSize()),
+        computePercentage(activeFileSet->d_data.d_filePosition,
+                          activeFileSet->d_data.d_file.fileSize()));
+    if (d_qListAware) {
+        percent = bsl::max(
+            percent,
+            computePercentage(activeFileSet->d_qlist.d_filePosition,
+                              activeFileSet->d_qlist.d_file.fileSize()));
+    }
+
+    if (percent < static_cast<bsls::Types::Uint64>(threshold)) {
+        return;  // RETURN
+    }
+
+    const int rc = d_miscWorkThreadPool_p->enqueueJob(
+        bdlf::BindUtil::bind(&FileStore::createNextFileSetWorkerDispatched,
+                             this));
+    if (0 != rc) {
+        // Rollover will create the file set if it has to.
+        BALL_LOG_WARN << partitionDesc() << "Failed to enqueue creation of "
+                      << "the next file set, rc: " << rc;
+    }
+
+    // Do not ask again before next rollover, whatever the outcome.
+    d_isNextFileSetRequested = true;
+}
+
+void FileStore::createNextFileSetWorkerDispatched()
+{
+    // executed by a *WORKER* thread
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_nextFileSetMutex);  // LOCK
+
+    if (!d_isOpen || d_nextFileSet_sp) {
+        // Either this instance has been closed, or the file set has already
+        // been created.
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 startTime = bmqu::Time::highResolutionTimer();
+
+    bmqu::MemOutStream errorDesc;
+    FileSetSp          fileSetSp;
+    const int          rc = FileStoreUtil::create(errorDesc,
+                                         &fileSetSp,
+                                         this,
+                                         d_config.partitionId(),
+                                         d_config,
+                                         partitionDesc(),
+                                         d_qListAware,
+                                         d_allocator_p);
+    if (0 != rc) {
+        // Rollover will try again.
+        BALL_LOG_WARN << partitionDesc() << "Failed to create the next file "
+                      << "set in the background, rc: " << rc
+                      << ", error: " << errorDesc.str();
+        return;  // RETURN
+    }
+
+    d_nextFileSet_sp = fileSetSp;
+
+    BALL_LOG_INFO << partitionDesc() << "Created the next file set ["
+                  << fileSetSp->d_data.d_fileName << "], ["
+                  << fileSetSp->d_journal.d_fileName
+                  << "] in the background. Time taken: "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         bmqu::Time::highResolutionTimer() - startTime);
+}
+
+void FileStore::discardNextFileSet()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_nextFileSetMutex);  // LOCK
+
+    if (!d_nextFileSet_sp) {
+        return;  // RETURN
+    }
+
+    FileSetSp fileSetSp;
+    fileSetSp.swap(d_nextFileSet_sp);
+
+    BALL_LOG_INFO << partitionDesc() << "Removing unused file set ["
+                  << fileSetSp->d_data.d_fileName << "], ["
+                  << fileSetSp->d_journal.d_fileName << "]";
+
+    // The files hold nothing but their headers.  Failing to remove them is
+    // harmless, since recovery skips a file set without a first sync point.
+    int rc = close(*fileSetSp, false);
+    if (0 != rc) {
+        return;  // RETURN
+    }
+
+    bdls::FilesystemUtil::remove(fileSetSp->d_data.d_fileName);
+    bdls::FilesystemUtil::remove(fileSetSp->d_journal.d_fileName);
+    if (d_qListAware) {
+        bdls::FilesystemUtil::remove(fileSetSp->d_qlist.d_fileName);
+    }
+}
+
+void FileStore::checkpointIfNeeded(bsls::Types::Uint64 syncPointOffset)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+    BSLS_ASSERT_SAFE(0 < d_fileSets.size());
+
+    const int interval = d_config.checkpointInterval();
+    if (0 >= interval) {
+        return;  // RETURN
+    }
+
+    if (++d_numSyncPointsSinceCheckpoint < interval ||
+        d_isCheckpointInProgress) {
+        // Either it is too early, or a checkpoint will be taken at a later
+        // sync point once the one in progress is saved.
+        return;  // RETURN
+    }
+
+    // The sync point has just been written, so the outstanding records and
+    // previous sync points all precede it in the journal, and it carries the
+    // highest sequence number of its primary lease id.
+
+    const FileSet* activeFileSet = d_fileSets[0].get();
+    const OffsetPtr<const RecordHeader> syncPointHeader(
+        activeFileSet->d_journal.d_file.block(),
+        syncPointOffset);
+    const unsigned int primaryLeaseId = syncPointHeader->primaryLeaseId();
+
+    bsl::shared_ptr<JournalCheckpoint> checkpoint;
+    checkpoint.createInplace(d_allocator_p, d_allocator_p);
+    checkpoint->setSyncPoint(syncPointOffset,
+                             primaryLeaseId,
+                             syncPointHeader->sequenceNumber());
+
+    JournalCheckpoint::RecordOffsets& recordOffsets =
+        checkpoint->recordOffsets();
+    recordOffsets.reserve(d_records.size() + d_syncPoints.size());
+    for (RecordIterator it = d_records.begin(); it != d_records.end(); ++it) {
+        if (it->second.d_recordOffset < syncPointOffset) {
+            recordOffsets.push_back(it->second.d_recordOffset);
+        }
+    }
+    for (SyncPointOffsetPairs::const_iterator cit = d_syncPoints.cbegin();
+         cit != d_syncPoints.cend();
+         ++cit) {
+        if (cit->offset() < syncPointOffset) {
+            recordOffsets.push_back(cit->offset());
+        }
+    }
+    bsl::sort(recordOffsets.begin(), recordOffsets.end());
+
+    JournalCheckpoint::HighestSeqNums& highestSeqNums =
+        checkpoint->highestSeqNums();
+    for (LeaseIdToSeqNumMapCIter cit = d_highestSeqNums.cbegin();
+         cit != d_highestSeqNums.cend();
+         ++cit) {
+        if (cit->first < primaryLeaseId && 0 != cit->second) {
+            highestSeqNums.push_back(*cit);
+        }
+    }
+    highestSeqNums.push_back(
+        bsl::make_pair(primaryLeaseId, syncPointHeader->sequenceNumber()));
+
+    const int rc = d_miscWorkThreadPool_p->enqueueJob(
+        bdlf::BindUtil::bind(&FileStore::checkpointWorkerDispatched,
+                             this,
+                             checkpoint,
+                             activeFileSet->d_journal.d_fileName));
+    if (0 != rc) {
+        // Try again at next sync point.
+        BALL_LOG_WARN << partitionDesc() << "Failed to enqueue checkpoint of "
+                      << "the journal, rc: " << rc;
+        return;  // RETURN
+    }
+
+    d_isCheckpointInProgress       = true;
+    d_numSyncPointsSinceCheckpoint = 0;
+}
+
+void FileStore::checkpointWorkerDispatched(
+    const bsl::shared_ptr<JournalCheckpoint>& checkpoint,
+    const bsl::string&                        journalFileName)
+{
+    // executed by a *WORKER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(checkpoint);
+
+    const bsls::Types::Int64 startTime = bmqu::Time::highResolutionTimer();
+
+    bsl::string checkpointFile(d_allocator_p);
+    FileStoreUtil::createCheckpointFileName(&checkpointFile, journalFileName);
+
+    bmqu::MemOutStream errorDesc;
+    const int          rc = JournalCheckpointUtil::save(errorDesc,
+                                               checkpointFile,
+                                               *checkpoint,
+                                               d_allocator_p);
+    if (0 != rc) {
+        // Recovery replays the journal from the previous checkpoint, if any,
+        // which remains valid.
+        BALL_LOG_WARN << partitionDesc() << "Failed to save checkpoint ["
+                      << checkpointFile << "], rc: " << rc
+                      << ", error: " << errorDesc.str();
+    }
+    else if (!bdls::FilesystemUtil::exists(journalFileName)) {
+        // The journal has been archived meanwhile, possibly before its
+        // checkpoint file could be removed along with it.
+        bdls::FilesystemUtil::remove(checkpointFile);
+    }
+    else {
+        BALL_LOG_INFO << partitionDesc() << "Saved checkpoint ["
+                      << checkpointFile << "] listing "
+                      << checkpoint->recordOffsets().size()
+                      << " records. Time taken: "
+                      << bmqu::PrintUtil::prettyTimeInterval(
+                             bmqu::Time::highResolutionTimer() - startTime);
+    }
+
+    execute(bdlf::BindUtil::bind(&FileStore::checkpointCompleteDispatched,
+                                 this));
+}
+
+void FileStore::checkpointCompleteDispatched()
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    d_isCheckpointInProgress = false;
+}
+
 int FileStore::rolloverImpl(bsls::Types::Uint64 timestamp)
 {
     // PRECONDITIONS
@@ -2736,14 +3422,20 @@ int FileStore::rolloverImpl(bsls::Types::Uint64 timestamp)
     mqbstat::StatMonitorSnapshotRecorder statRecorder(partitionDesc(),
                                                       d_allocator_p);
 
-    // Create new files, add header etc.
-    FileSetSp newActiveFileSetSp;
-    int       rc = create(&newActiveFileSetSp);
+    // Create new files, add header etc., unless this has been done in the
+    // background already.
+    FileSetSp          newActiveFileSetSp;
+    bsls::Types::Int64 stallTime = 0;
+    int rc = createOrTakeNextFileSet(&newActiveFileSetSp, &stallTime);
     if (0 != rc) {
         // 'create' will log error
         return rc;  // RETURN
     }
 
+    d_isNextFileSetRequested      = false;
+    d_numSyncPointsSinceCheckpoint = 0;
+    d_partitionStats_sp->setRolloverStallTime(stallTime);
+
     // Iterate over outstanding records in the active set, and copy them to the
     // rollover set.
 
@@ -3003,6 +3695,14 @@ int FileStore::rolloverImpl(bsls::Types::Uint64 timestamp)
     // Add 'newActiveFileSetSp' as the first element of 'd_fileSets'.
     d_fileSets.insert(d_fileSets.begin(), newActiveFileSetSp);
 
+    // Outstanding records, including those waiting for a group commit, have
+    // been copied to the new active file set, which has not been synced yet.
+    // A group commit in progress on the old file set can no longer release
+    // any Receipt.
+    d_syncedJournalPosition = 0;
+    d_syncedDataPosition    = 0;
+    ++d_syncGeneration;
+
     BALL_LOG_INFO_BLOCK
     {
         BALL_LOG_OUTPUT_STREAM << partitionDesc()
@@ -3632,6 +4332,238 @@ void FileStore::gcWorkerDispatched(const bsl::shared_ptr<FileSet>& fileSet)
                                                          archiveStartTime);
 }
 
+void FileStore::syncIfNeeded()
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    if (0 == d_numUnsyncedRecords || d_isSyncInProgress) {
+        // Either nothing waits for a group commit, or the records will be
+        // committed together once the group commit in progress completes.
+        return;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(0 < d_fileSets.size());
+    const FileSetSp&          activeFileSetSp = d_fileSets[0];
+    const bsls::Types::Uint64 journalPos =
+        activeFileSetSp->d_journal.d_filePosition;
+    const bsls::Types::Uint64 dataPos = activeFileSetSp->d_data.d_filePosition;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_syncMutex);  // LOCK
+        ++d_numSyncsInFlight;
+        ++d_numSyncWorkers;
+    }
+
+    const int rc = d_miscWorkThreadPool_p->enqueueJob(
+        bdlf::BindUtil::bind(&FileStore::syncWorkerDispatched,
+                             this,
+                             activeFileSetSp,
+                             d_syncedJournalPosition,
+                             journalPos,
+                             d_syncedDataPosition,
+                             dataPos,
+                             d_unsyncedKey,
+                             d_numUnsyncedRecords,
+                             d_syncGeneration));
+    if (0 != rc) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_syncMutex);  // LOCK
+            --d_numSyncsInFlight;
+            --d_numSyncWorkers;
+        }
+
+        // Try again on next flush.
+        BALL_LOG_ERROR << partitionDesc()
+                       << "Failed to enqueue group commit of "
+                       << d_numUnsyncedRecords << " records, rc: " << rc;
+        return;  // RETURN
+    }
+
+    d_isSyncInProgress      = true;
+    d_syncedJournalPosition = journalPos;
+    d_syncedDataPosition    = dataPos;
+    d_unsyncedKey           = DataStoreRecordKey();
+    d_numUnsyncedRecords    = 0;
+}
+
+void FileStore::syncWorkerDispatched(const bsl::shared_ptr<FileSet>& fileSet,
+                                     bsls::Types::Uint64 journalBegin,
+                                     bsls::Types::Uint64 journalEnd,
+                                     bsls::Types::Uint64 dataBegin,
+                                     bsls::Types::Uint64 dataEnd,
+                                     const DataStoreRecordKey& key,
+                                     int                       numRecords,
+                                     unsigned int              generation)
+{
+    // executed by a *WORKER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(fileSet);
+    BSLS_ASSERT_SAFE(journalBegin <= journalEnd);
+    BSLS_ASSERT_SAFE(dataBegin <= dataEnd);
+
+    const bsls::Types::Int64 startTime = bmqu::Time::highResolutionTimer();
+
+    // Sync the data file first, so that a journal record found on disk never
+    // refers to a message which is not.
+
+    bmqu::MemOutStream errorDesc;
+    int                rc = FileSystemUtil::flushRange(
+        fileSet->d_data.d_file.mapping(),
+        dataBegin,
+        dataEnd - dataBegin,
+        errorDesc);
+    if (0 == rc) {
+        rc = FileSystemUtil::flushRange(fileSet->d_journal.d_file.mapping(),
+                                        journalBegin,
+                                        journalEnd - journalBegin,
+                                        errorDesc);
+    }
+
+    const bsls::Types::Int64 syncTime = bmqu::Time::highResolutionTimer() -
+                                        startTime;
+
+    if (0 != rc) {
+        BMQTSK_ALARMLOG_ALARM("FILE_IO")
+            << partitionDesc() << "Group commit of " << numRecords
+            << " records failed to sync file set ["
+            << fileSet->d_data.d_fileName << "], ["
+            << fileSet->d_journal.d_fileName
+            << "], error: " << errorDesc.str() << BMQTSK_ALARMLOG_END;
+    }
+
+    // The mappings of 'fileSet' are not used past this point, so let 'close'
+    // proceed.  Note that this must not wait for the completion callback to
+    // be enqueued, which could block on the dispatcher thread waiting in
+    // 'close'.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_syncMutex);  // LOCK
+        --d_numSyncsInFlight;
+        d_syncCondition.broadcast();
+    }
+
+    execute(bdlf::BindUtil::bind(&FileStore::syncCompleteDispatched,
+                                 this,
+                                 key,
+                                 numRecords,
+                                 generation,
+                                 0 == rc,
+                                 syncTime));
+
+    // This object is not accessed past this point, so let the destructor
+    // proceed.
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_syncMutex);  // LOCK
+    --d_numSyncWorkers;
+    d_syncCondition.broadcast();
+}
+
+void FileStore::syncCompleteDispatched(const DataStoreRecordKey& key,
+                                       int                       numRecords,
+                                       unsigned int              generation,
+                                       bool                      success,
+                                       bsls::Types::Int64        syncTime)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    d_isSyncInProgress = false;
+
+    if (!d_isOpen || !d_isPrimary) {
+        return;  // RETURN
+    }
+
+    if (generation != d_syncGeneration) {
+        // The records have been rolled over to a new active file set while
+        // syncing the previous one, and must be committed again.
+        if (d_unsyncedKey < key) {
+            d_unsyncedKey = key;
+        }
+        d_numUnsyncedRecords += numRecords;
+
+        syncIfNeeded();
+        return;  // RETURN
+    }
+
+    if (success) {
+        d_partitionStats_sp->setCommitBatchSize(numRecords);
+        d_partitionStats_sp->setSyncTime(syncTime);
+    }
+
+    // Every record up to 'key' waiting for this group commit is now synced.
+    // If syncing failed, durability cannot be guaranteed: NACK these records
+    // with an unknown outcome rather than risk a false positive from a later
+    // sync of the same pages.
+
+    bsl::unordered_set<mqbi::Queue*> affectedQueues(d_allocator_p);
+    mqbu::StorageKey                 lastKey;
+    mqbi::Queue*                     lastQueue = 0;
+    Unreceipted::iterator            it        = d_unreceipted.begin();
+
+    while (it != d_unreceipted.end() && !(key < it->first)) {
+        if (!it->second.d_isSyncPending) {
+            ++it;
+            continue;  // CONTINUE
+        }
+
+        it->second.d_isSyncPending = false;
+
+        if (success && it->second.d_count < d_replicationFactor) {
+            // Still waiting for Receipts from replicas.
+            ++it;
+            continue;  // CONTINUE
+        }
+
+        const mqbu::StorageKey& queueKey  = it->second.d_queueKey;
+        bool                    haveQueue = (queueKey == lastKey);
+        if (!haveQueue) {
+            StorageMapIter sit = d_storages.find(queueKey);
+            if (sit != d_storages.end()) {
+                haveQueue = true;
+                lastKey   = queueKey;
+                lastQueue = sit->second->queue();
+                BSLS_ASSERT_SAFE(lastQueue);
+            }
+            // else the queue and its storage are gone; ignore the receipt
+        }
+
+        if (success) {
+            it->second.d_handle->second.d_hasReceipt = true;
+
+            const bsls::Types::Int64 timeDelta =
+                bmqu::Time::highResolutionTimer() -
+                it->second.d_handle->second.d_arrivalTimepoint;
+            d_partitionStats_sp->setReplicationTime(timeDelta);
+
+            if (haveQueue) {
+                lastQueue->onReceipt(it->second.d_guid, it->second.d_qH);
+                affectedQueues.insert(lastQueue);
+            }  // else the queue is gone
+        }
+        else if (haveQueue) {
+            lastQueue->onRemoval(it->second.d_guid,
+                                 it->second.d_qH,
+                                 bmqt::AckResult::e_UNKNOWN);
+        }  // else the queue is gone
+
+        it = d_unreceipted.erase(it);
+    }
+
+    for (bsl::unordered_set<mqbi::Queue*>::iterator qit =
+             affectedQueues.begin();
+         qit != affectedQueues.end();
+         ++qit) {
+        (*qit)->onReplicatedBatch();
+    }
+
+    // Commit what has been written meanwhile.
+    syncIfNeeded();
+}
+
 int FileStore::writeQueueOpRecord(DataStoreRecordHandle*  handle,
                                   const mqbu::StorageKey& queueKey,
                                   const mqbu::StorageKey& appKey,
@@ -4166,6 +5098,10 @@ int FileStore::issueSyncPointInternal(SyncPointType::Enum            type,
                     syncPointJournalOffset,
                     true /* immediateFlush */);
 
+    if (SyncPointType::e_REGULAR == type) {
+        checkpointIfNeeded(syncPointJournalOffset);
+    }
+
     // Report cluster's partition stats
     d_partitionStats_sp->setPartitionBytes(fs->d_data.d_outstandingBytes,
                                            fs->d_journal.d_outstandingBytes,
@@ -4187,7 +5123,12 @@ void FileStore::processReceiptEvent(unsigned int         primaryLeaseId,
     }
 
     const DataStoreRecordKey recordKey(sequenceNumber, primaryLeaseId);
-    Unreceipted::iterator    to = d_unreceipted.find(recordKey);
+
+    // Receipts of a replica which is not part of the quorum are otherwise
+    // ignored, so keep track of its progress before anything else.
+    updateReplicaReceiptStats(recordKey, source);
+
+    Unreceipted::iterator to = d_unreceipted.find(recordKey);
     // end of of Receipt range
 
     if (to == d_unreceipted.end()) {
@@ -4239,7 +5180,8 @@ void FileStore::processReceiptEvent(unsigned int         primaryLeaseId,
             // This is the last in the range
             isEndOfRange = true;
         }
-        if (++(from->second.d_count) >= d_replicationFactor) {
+        if (++(from->second.d_count) >= d_replicationFactor &&
+            !from->second.d_isSyncPending) {
             from->second.d_handle->second.d_hasReceipt = true;
 
             // Calculate time it took for the message to be stored and
@@ -4866,6 +5808,8 @@ int FileStore::writeJournalRecord(const bmqp::StorageHeader& header,
                               << "Received regular sync point: " << syncPoint
                               << ", at journal offset: " << recordOffset
                               << ".";
+
+                checkpointIfNeeded(recordOffset);
             }
 
             // If self is stopping, update the flag which indicates that self
@@ -5016,7 +5960,7 @@ void FileStore::replicateRecord(bmqp::StorageMessageType::Enum type,
         activeFileSet->d_aliasedChunk_sp,
         journal.mapping() + journalOffset);
     bdlbb::BlobBuffer journalRecordBlobBuffer(
-        journalRecordBufferSp,
+        bslmf::MovableRefUtil::move(journalRecordBufferSp),
         FileStoreProtocol::k_JOURNAL_RECORD_SIZE);
 
     bmqt::EventBuilderResult::Enum buildRc;
@@ -5162,6 +6106,10 @@ void FileStore::replicateRecord(bmqp::StorageMessageType::Enum type,
         return;  // RETURN
     }
 
+    if (flags & bmqp::StorageHeaderFlags::e_RECEIPT_REQUESTED) {
+        d_isReceiptRequestedInBatch = true;
+    }
+
     // Flush if the builder is 'full'.
     flushIfNeeded(false);
 }
@@ -5291,8 +6239,19 @@ void FileStore::aliasMessage(bsl::shared_ptr<bdlbb::Blob>* appData,
 
 void FileStore::flushIfNeeded(bool immediateFlush)
 {
-    if (immediateFlush ||
-        d_storageEventBuilder.messageCount() >= k_NAGLE_PACKET_COUNT) {
+    bool isDue = immediateFlush;
+    if (!isDue) {
+        if (0 < d_config.replicationLatencyBudgetUs()) {
+            isDue = d_replicationBatchPolicy.onMessage(
+                bmqu::Time::highResolutionTimer());
+        }
+        else {
+            isDue = d_storageEventBuilder.messageCount() >=
+                    k_NAGLE_PACKET_COUNT;
+        }
+    }
+
+    if (isDue) {
         // Should notify weak consistency queues after replicated batch
         flushStorage();
         notifyQueuesOnReplicatedBatch();
@@ -5331,8 +6290,27 @@ FileStore::FileStore(
 , d_replicationNotifications(allocator)
 , d_replicationFactor(replicationFactor)
 , d_nodes(allocator)
+, d_replicatedBatches(allocator)
+, d_replicatedBytes(0)
+, d_isReceiptRequestedInBatch(false)
+, d_replicas(allocator)
+, d_unsyncedKey()
+, d_numUnsyncedRecords(0)
+, d_syncedJournalPosition(0)
+, d_syncedDataPosition(0)
+, d_syncGeneration(0)
+, d_isSyncInProgress(false)
+, d_syncMutex()
+, d_syncCondition()
+, d_numSyncsInFlight(0)
+, d_numSyncWorkers(0)
 , d_lastRecoveredStrongConsistency()
 , d_fileSets(allocator)
+, d_nextFileSet_sp()
+, d_nextFileSetMutex()
+, d_isNextFileSetRequested(false)
+, d_numSyncPointsSinceCheckpoint(0)
+, d_isCheckpointInProgress(false)
 , d_cluster_p(cluster)
 , d_miscWorkThreadPool_p(miscWorkThreadPool)
 , d_syncPointEventHandle()
@@ -5348,6 +6326,10 @@ FileStore::FileStore(
                         bmqp::EventType::e_STORAGE,
                         d_blobSpPool_p,
                         allocator)
+, d_replicationBatchPolicy(
+      bdlt::TimeUnitRatio::k_NS_PER_US *
+          bsl::max(config.replicationLatencyBudgetUs(), 1),
+      k_MAX_ADAPTIVE_BATCH_COUNT)
 , d_firstSyncPointAfterRolloverSeqNum()
 , d_highestSeqNums(allocator)
 , d_messageTransmitter(blobSpPool, cluster, allocator)
@@ -5375,6 +6357,15 @@ FileStore::~FileStore()
 {
     BSLS_ASSERT(!d_isOpen && "'close()' must be called before the destructor");
 
+    // A worker which completed a group commit may still be reporting it to
+    // the dispatcher thread.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_syncMutex);  // LOCK
+        while (0 < d_numSyncWorkers) {
+            d_syncCondition.wait(&d_syncMutex);
+        }
+    }
+
     // Unregister from the dispatcher
     dispatcher()->unregisterClient(this);
 }
@@ -5485,6 +6476,31 @@ int FileStore::close(bool flush, bool archive)
     d_unreceipted.clear();
     d_records.clear();
 
+    clearReplicas();
+
+    // Forget about any pending group commit.
+    d_unsyncedKey           = DataStoreRecordKey();
+    d_numUnsyncedRecords    = 0;
+    d_syncedJournalPosition = 0;
+    d_syncedDataPosition    = 0;
+    ++d_syncGeneration;
+
+    // A group commit enqueued before may still be syncing the active file
+    // set: wait for it before unmapping the files.  Its completion callback
+    // is ignored, since this instance is no longer open.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_syncMutex);  // LOCK
+        while (0 < d_numSyncsInFlight) {
+            d_syncCondition.wait(&d_syncMutex);
+        }
+    }
+
+    // Remove the next file set if it has been created in the background.  Note
+    // that a worker thread will not create one now that 'd_isOpen' is false.
+    discardNextFileSet();
+    d_isNextFileSetRequested      = false;
+    d_numSyncPointsSinceCheckpoint = 0;
+
     // After mapped data files have been gc'd, there should be only 1 file set
     // remaining in 'd_fileSets' (the active one).  Truncate and close it out.
     BSLS_ASSERT_SAFE(1 == d_fileSets.size());
@@ -5688,8 +6704,10 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
 
     // If 'd_replicationFactor' is 1, then the message need not be persisted to
     // any replicas (i.e. eventual consistency). Therefore the writing of the
-    // message by this node is sufficient to set the receipt.
-    if (1 == d_replicationFactor && !attributes->hasReceipt()) {
+    // message by this node is sufficient to set the receipt, unless the
+    // message must also be synced to disk first.
+    if (1 == d_replicationFactor && !attributes->hasReceipt() &&
+        !attributes->syncBeforeReceipt()) {
         attributes->setReceipt(true);
     }
 
@@ -5782,13 +6800,21 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
     int flags = 0;
     // If this requires Receipt
     if (!attributes->hasReceipt()) {
+        const bool isSyncPending = attributes->syncBeforeReceipt();
+
         d_unreceipted.insert(
             bsl::make_pair(key,
                            ReceiptContext(queueKey,
                                           guid,
                                           recordIt,
                                           1,  // receipt count
-                                          attributes->queueHandle())));
+                                          attributes->queueHandle(),
+                                          isSyncPending)));
+        if (isSyncPending) {
+            // The next group commit must cover this record.
+            d_unsyncedKey = key;
+            ++d_numUnsyncedRecords;
+        }
         flags = bmqp::StorageHeaderFlags::e_RECEIPT_REQUESTED;
     }
     else {
@@ -6754,6 +7780,94 @@ FileStore::generateReceipt(NodeContext*         nodeContext,
     return nodeContext;
 }
 
+void FileStore::updateReplicaReceiptStats(const DataStoreRecordKey& key,
+                                          mqbnet::ClusterNode*      node)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isPrimary);
+    BSLS_ASSERT_SAFE(node);
+
+    const int                 nodeId    = node->nodeId();
+    ReplicaContexts::iterator itReplica = d_replicas.find(nodeId);
+    if (itReplica == d_replicas.end()) {
+        itReplica =
+            d_replicas.insert(bsl::make_pair(nodeId, ReplicaContext(node)))
+                .first;
+    }
+
+    ReplicaContext& replica = itReplica->second;
+    if (!(replica.d_key < key)) {
+        // outdated receipt
+        return;  // RETURN
+    }
+    replica.d_key = key;
+
+    // The Receipt confirms the whole batch carrying `key`, which is the first
+    // batch not older than `key`.  The first batch is always kept receipted
+    // by every replica, so if `key` is older than it, the batch was dropped
+    // or not broadcast by this node and nothing can be measured.
+    const ReplicatedBatches::const_iterator batchIt = bsl::lower_bound(
+        d_replicatedBatches.begin(),
+        d_replicatedBatches.end(),
+        key,
+        ReplicatedBatchKeyLess());
+    if (batchIt == d_replicatedBatches.end() ||
+        (batchIt == d_replicatedBatches.begin() && batchIt->d_key != key)) {
+        return;  // RETURN
+    }
+
+    replica.d_receiptedBytes = batchIt->d_replicatedBytes;
+    d_partitionStats_sp->setReplicaReceiptTime(
+        nodeId,
+        node->nodeDescription(),
+        bmqu::Time::highResolutionTimer() - batchIt->d_timepoint);
+    d_partitionStats_sp->setReplicaUnreceiptedBytes(
+        nodeId,
+        node->nodeDescription(),
+        d_replicatedBytes - replica.d_receiptedBytes);
+
+    // Drop the batches receipted by every replica, keeping the newest of them
+    // to delimit the next one.
+    DataStoreRecordKey minKey = key;
+    for (ReplicaContexts::const_iterator cit = d_replicas.begin();
+         cit != d_replicas.end();
+         ++cit) {
+        if (cit->second.d_key < minKey) {
+            minKey = cit->second.d_key;
+        }
+    }
+    while (d_replicatedBatches.size() > 1 &&
+           !(minKey < d_replicatedBatches[1].d_key)) {
+        d_replicatedBatches.pop_front();
+    }
+}
+
+void FileStore::reportUnreceiptedBytes()
+{
+    // executed by the *DISPATCHER* thread
+
+    for (ReplicaContexts::const_iterator cit = d_replicas.begin();
+         cit != d_replicas.end();
+         ++cit) {
+        d_partitionStats_sp->setReplicaUnreceiptedBytes(
+            cit->first,
+            cit->second.d_node_p->nodeDescription(),
+            d_replicatedBytes - cit->second.d_receiptedBytes);
+    }
+}
+
+void FileStore::clearReplicas()
+{
+    // executed by the *DISPATCHER* thread
+
+    d_replicatedBatches.clear();
+    d_replicatedBytes = 0;
+    d_replicas.clear();
+    d_partitionStats_sp->clearReplicas();
+}
+
 void FileStore::sendReceipt(mqbnet::ClusterNode* node,
                             NodeContext*         nodeContext)
 {
@@ -6912,6 +8026,10 @@ void FileStore::setActivePrimary(mqbnet::ClusterNode* primaryNode,
                   << primaryNode->nodeDescription() << " with PSN: "
                   << printPSN(d_writeHeadLeaseId, sequenceNumber()) << ".";
 
+    // Replication progress is only tracked by the primary, and only for its
+    // own term.
+    clearReplicas();
+
     if (primaryNode->nodeId() != d_config.nodeId()) {
         d_isPrimary = false;
         d_partitionStats_sp->setNodeRole(
@@ -6927,6 +8045,20 @@ void FileStore::setActivePrimary(mqbnet::ClusterNode* primaryNode,
     d_partitionStats_sp->setNodeRole(
         mqbstat::PartitionStats::PrimaryStatus::e_PRIMARY);
 
+    // Track every other node from the start, so that a replica which never
+    // sends a Receipt is reported as well.
+    const mqbnet::Cluster::NodesList& nodes = d_cluster_p->nodes();
+    for (mqbnet::Cluster::NodesList::const_iterator cit = nodes.begin();
+         cit != nodes.end();
+         ++cit) {
+        if ((*cit)->nodeId() != d_config.nodeId()) {
+            d_replicas.insert(
+                bsl::make_pair((*cit)->nodeId(), ReplicaContext(*cit)));
+        }
+    }
+    reportUnreceiptedBytes();
+    d_replicationBatchPolicy.reset();
+
     for (StorageMapIter sIt = d_storages.begin(); sIt != d_storages.end();
          ++sIt) {
         sIt->second->setPrimary();
@@ -7124,6 +8256,7 @@ void FileStore::clearPrimary()
                   << d_primaryNode_p->nodeDescription() << ". Current PSN: "
                   << printPSN(d_writeHeadLeaseId, sequenceNumber()) << ".";
     d_primaryNode_p = 0;
+    clearReplicas();
 
     // If self has a valid leaseId and zero sequence number (ie, previous
     // primary went away after issuing active primary stats advisory, but
@@ -7170,6 +8303,10 @@ void FileStore::clearPrimary()
 
 void FileStore::flushStorage()
 {
+    // This is the end of a batch of writes: group commit them if needed.
+    syncIfNeeded();
+    createNextFileSetIfNeeded();
+
     if (d_storageEventBuilder.messageCount() == 0) {
         return;
     }
@@ -7178,6 +8315,24 @@ void FileStore::flushStorage()
                    << d_storageEventBuilder.messageCount()
                    << " STORAGE messages.";
     d_cluster_p->broadcast(d_storageEventBuilder.blob());
+    d_replicationBatchPolicy.onFlush();
+
+    if (d_isPrimary && d_isReceiptRequestedInBatch) {
+        // Only the batches which replicas will send a Receipt for can be
+        // measured: tracking the other ones would only let them pile up.
+        d_replicatedBytes += d_storageEventBuilder.eventSize();
+        d_replicatedBatches.push_back(
+            ReplicatedBatch(DataStoreRecordKey(sequenceNumber(),
+                                               d_writeHeadLeaseId),
+                            bmqu::Time::highResolutionTimer(),
+                            d_replicatedBytes));
+        if (d_replicatedBatches.size() > k_MAX_REPLICATED_BATCHES) {
+            d_replicatedBatches.pop_front();
+        }
+        reportUnreceiptedBytes();
+    }
+
+    d_isReceiptRequestedInBatch = false;
     d_storageEventBuilder.reset();
 }
 
@@ -7401,6 +8556,9 @@ void FileStore::flush()
 
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    syncIfNeeded();
+    createNextFileSetIfNeeded();
 }
 
 void FileStore::scheduledCleanupStorages()
@@ -7444,7 +8602,12 @@ void FileStore::setReplicationFactor(int value)
     mqbu::StorageKey      lastKey;
     mqbi::Queue*          lastQueue = 0;
     while (it != d_unreceipted.end()) {
-        if (it->second.d_count >= d_replicationFactor) {
+        if (it->second.d_count >= d_replicationFactor &&
+            it->second.d_isSyncPending) {
+            // Replicated enough, but still waiting for a group commit.
+            ++it;
+        }
+        else if (it->second.d_count >= d_replicationFactor) {
             it->second.d_handle->second.d_hasReceipt = true;
 
             // Calculate time it took for the message to be stored and
@@ -7532,6 +8695,36 @@ void FileStore::loadSummary(mqbcmd::FileStore* fileStore) const
                                     k_NAGLE_PACKET_COUNT,
                                     d_fileSets,
                                     d_storages);
+
+    if (!d_isPrimary) {
+        return;  // RETURN
+    }
+
+    // Report the replication progress of each replica: the lag is the age of
+    // the oldest batch not yet receipted by the replica.
+    const bsls::Types::Int64 now = bmqu::Time::highResolutionTimer();
+    bsl::vector<mqbcmd::ReplicaStatus>& replicas =
+        fileStore->summary().replicas();
+    replicas.reserve(d_replicas.size());
+    for (ReplicaContexts::const_iterator cit = d_replicas.begin();
+         cit != d_replicas.end();
+         ++cit) {
+        const ReplicaContext& replica = cit->second;
+        const ReplicatedBatches::const_iterator batchIt = bsl::upper_bound(
+            d_replicatedBatches.begin(),
+            d_replicatedBatches.end(),
+            replica.d_key,
+            ReplicatedBatchKeyLess());
+
+        replicas.resize(replicas.size() + 1);
+        mqbcmd::ReplicaStatus& status = replicas.back();
+        status.nodeDescription() = replica.d_node_p->nodeDescription();
+        status.unreceiptedBytes() = d_replicatedBytes -
+                                    replica.d_receiptedBytes;
+        if (batchIt != d_replicatedBatches.end()) {
+            status.receiptLagNanoseconds() = now - batchIt->d_timepoint;
+        }
+    }
 }
 
 // ACCESSORS
@@ -41,6 +41,7 @@
 #include <mqbs_fileset.h>
 #include <mqbs_filestoreprotocol.h>
 #include <mqbs_mappedfiledescriptor.h>
+#include <mqbs_replicationbatchpolicy.h>
 #include <mqbs_storagecollectionutil.h>
 #include <mqbu_storagekey.h>
 
@@ -63,6 +64,8 @@
 #include <bdlmt_eventscheduler.h>
 #include <bdlmt_fixedthreadpool.h>
 #include <bdlmt_throttle.h>
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
 #include <bsl_deque.h>
 #include <bsl_functional.h>
 #include <bsl_limits.h>
@@ -104,6 +107,7 @@ namespace mqbs {
 class DataFileIterator;
 class FileStore;
 class FileStoreSet;
+class JournalCheckpoint;
 class JournalFileIterator;
 class QlistFileIterator;
 class ReplicatedStorage;
@@ -206,11 +210,16 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
                                           // Receipt'ed messages are
                                           // strong consistent.
 
+        /// Whether the Receipt also waits for the message to be synced to
+        /// disk by a group commit on this node.
+        bool d_isSyncPending;
+
         ReceiptContext(const mqbu::StorageKey&  queueKey,
                        const bmqt::MessageGUID& guid,
                        const RecordIterator&    handle,
                        int                      count,
-                       mqbi::QueueHandle*       qH);
+                       mqbi::QueueHandle*       qH,
+                       bool                     isSyncPending = false);
     };
 
     struct NodeContext {
@@ -232,6 +241,48 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// Map of NodeId -> NodeContext to assist in Receipt processing
     typedef bsl::unordered_map<int, NodeContext> NodeReceiptContexts;
 
+    /// Marker of a batch of storage messages broadcast by the primary and
+    /// carrying at least one record for which a Receipt is requested, i.e. a
+    /// message of a strong consistency queue.  Replicas only send Receipts
+    /// for such records, so the other batches cannot be measured.
+    struct ReplicatedBatch {
+        /// Key of the last record in the batch.
+        DataStoreRecordKey d_key;
+
+        /// Time (from `bmqu::Time::highResolutionTimer`) at which the batch
+        /// was broadcast.
+        bsls::Types::Int64 d_timepoint;
+
+        /// Total number of bytes of the measured batches replicated up to
+        /// and including the batch.
+        bsls::Types::Uint64 d_replicatedBytes;
+
+        ReplicatedBatch(const DataStoreRecordKey& key,
+                        bsls::Types::Int64        timepoint,
+                        bsls::Types::Uint64       replicatedBytes);
+    };
+
+    /// Replicated batches, from oldest to newest, not yet receipted by every
+    /// replica.
+    typedef bsl::deque<ReplicatedBatch> ReplicatedBatches;
+
+    /// Replication progress of a replica as seen by the primary.
+    struct ReplicaContext {
+        mqbnet::ClusterNode* d_node_p;
+
+        /// Newest Receipt from this replica.
+        DataStoreRecordKey d_key;
+
+        /// Total number of bytes of the measured batches replicated to this
+        /// replica and receipted by it.
+        bsls::Types::Uint64 d_receiptedBytes;
+
+        explicit ReplicaContext(mqbnet::ClusterNode* node);
+    };
+
+    /// Map of NodeId -> ReplicaContext
+    typedef bsl::unordered_map<int, ReplicaContext> ReplicaContexts;
+
   private:
     // DATA
     bslma::Allocator* d_allocator_p;
@@ -310,6 +361,64 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
 
     NodeReceiptContexts d_nodes;
 
+    /// Batches carrying records of strong consistency queues broadcast by
+    /// this node while primary, used to measure the receipt latency and lag
+    /// of each replica.  Bounded by `k_MAX_REPLICATED_BATCHES`.  Note that
+    /// the replication of eventual consistency queues is not measured.
+    ReplicatedBatches d_replicatedBatches;
+
+    /// Total number of bytes of the batches in `d_replicatedBatches`
+    /// broadcast by this node since it became primary.
+    bsls::Types::Uint64 d_replicatedBytes;
+
+    /// Whether the batch of storage messages being built carries a record
+    /// for which a Receipt is requested, and must therefore be measured.
+    bool d_isReceiptRequestedInBatch;
+
+    /// Replication progress of each replica since this node became primary:
+    /// every other node of the cluster, plus any node which sent a Receipt.
+    ReplicaContexts d_replicas;
+
+    /// Key of the newest record whose Receipt waits for a group commit that
+    /// has not been issued yet, or a default key if there is none.
+    DataStoreRecordKey d_unsyncedKey;
+
+    /// Number of records whose Receipt waits for a group commit that has not
+    /// been issued yet.
+    int d_numUnsyncedRecords;
+
+    /// Positions in the journal and data files of the active file set up to
+    /// which a group commit has been issued.
+    bsls::Types::Uint64 d_syncedJournalPosition;
+
+    bsls::Types::Uint64 d_syncedDataPosition;
+
+    /// Incremented whenever the active file set is replaced or this instance
+    /// is closed, so that a group commit issued before can be recognized.
+    unsigned int d_syncGeneration;
+
+    /// Whether a group commit is being executed by a worker thread.
+    bool d_isSyncInProgress;
+
+    /// Mutex protecting `d_numSyncsInFlight` and `d_numSyncWorkers`.
+    bslmt::Mutex d_syncMutex;
+
+    /// Condition signaled whenever `d_numSyncsInFlight` or
+    /// `d_numSyncWorkers` is decremented.
+    bslmt::Condition d_syncCondition;
+
+    /// Number of group commits enqueued to the misc work thread pool whose
+    /// worker has not finished syncing the files yet.  `close` waits for it
+    /// to drop to zero before unmapping the files.  Protected by
+    /// `d_syncMutex`.
+    int d_numSyncsInFlight;
+
+    /// Number of group commits enqueued to the misc work thread pool whose
+    /// worker has not finished reporting their completion to the dispatcher
+    /// thread yet, and therefore still accesses this object.  The destructor
+    /// waits for it to drop to zero.  Protected by `d_syncMutex`.
+    int d_numSyncWorkers;
+
     DataStoreRecordKey d_lastRecoveredStrongConsistency;
 
     FileSets d_fileSets;
@@ -323,6 +432,28 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     // rollover file set, which is then
     // inserted to the front of the list.
 
+    /// File set created in the background by a worker thread, which becomes
+    /// the active one at next rollover instead of being created then, if
+    /// any.  Protected by `d_nextFileSetMutex`.
+    FileSetSp d_nextFileSet_sp;
+
+    /// Mutex protecting `d_nextFileSet_sp` and serializing the creation of
+    /// file sets by the dispatcher and worker threads, so that file names
+    /// follow creation order.
+    bslmt::Mutex d_nextFileSetMutex;
+
+    /// Whether a worker thread has been asked to create the next file set
+    /// since last rollover.
+    bool d_isNextFileSetRequested;
+
+    /// Number of regular sync points written to the journal of the active
+    /// file set since the last checkpoint of that journal was requested.
+    int d_numSyncPointsSinceCheckpoint;
+
+    /// Whether a checkpoint of the journal is being saved by a worker
+    /// thread.
+    bool d_isCheckpointInProgress;
+
     mqbnet::Cluster* d_cluster_p;
 
     bdlmt::FixedThreadPool* d_miscWorkThreadPool_p;
@@ -366,6 +497,12 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     bmqp::StorageEventBuilder d_storageEventBuilder;
     // Storage event builder to use.
 
+    ReplicationBatchPolicy d_replicationBatchPolicy;
+    // Policy deciding when the batch in
+    // 'd_storageEventBuilder' is due, if
+    // a replication latency budget is
+    // configured.
+
     bmqp_ctrlmsg::PartitionSequenceNumber d_firstSyncPointAfterRolloverSeqNum;
     // First sync point after rollover sequence number, it is set at the last
     // step of rollover, together with journal file header
@@ -405,6 +542,58 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// written to the newly created files.
     int create(FileSetSp* fileSetSp);
 
+    /// Load into the specified `fileSetSp` a new file set to become the
+    /// active one, either the one created in the background if any, or a
+    /// newly created one, and load into the specified `stallTime` the time
+    /// in nanoseconds spent waiting for or creating it.  Return zero on
+    /// success and non-zero value otherwise.
+    int createOrTakeNextFileSet(FileSetSp*          fileSetSp,
+                                bsls::Types::Int64* stallTime);
+
+    /// Ask a worker thread to create the next file set if background
+    /// creation is enabled and the active file set is filled above the
+    /// configured ratio.
+    ///
+    /// THREAD: This method should only be invoked by the partition
+    /// *dispatcher* thread.
+    void createNextFileSetIfNeeded();
+
+    /// Create the next file set, unless it has already been created or this
+    /// instance is closed.
+    ///
+    /// THREAD: This method is invoked in a thread from the miscellaneous
+    /// *worker* thread pool.
+    void createNextFileSetWorkerDispatched();
+
+    /// Close and remove the files of the next file set created in the
+    /// background, if any.
+    void discardNextFileSet();
+
+    /// Ask a worker thread to save a checkpoint of the journal of the active
+    /// file set, taken at the regular sync point which has just been written
+    /// at the specified `syncPointOffset` in that journal, if checkpoints are
+    /// enabled and the configured number of regular sync points have been
+    /// written since the last one.
+    ///
+    /// THREAD: This method should only be invoked by the partition
+    /// *dispatcher* thread.
+    void checkpointIfNeeded(bsls::Types::Uint64 syncPointOffset);
+
+    /// Save the specified `checkpoint` of the journal having the specified
+    /// `journalFileName` to its checkpoint file, and notify the dispatcher
+    /// thread once done.
+    ///
+    /// THREAD: This method is invoked in a thread from the miscellaneous
+    /// *worker* thread pool.
+    void checkpointWorkerDispatched(
+        const bsl::shared_ptr<JournalCheckpoint>& checkpoint,
+        const bsl::string&                        journalFileName);
+
+    /// Record that the checkpoint requested last is not in progress anymore.
+    ///
+    /// THREAD: This method is invoked in the partition *dispatcher* thread.
+    void checkpointCompleteDispatched();
+
     /// Truncate the files contained in the specified `fileSet` to their
     /// current sizes.  Note that files are not closed.
     void truncate(FileSet* fileSet);
@@ -446,6 +635,51 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// *worker* thread pool.
     void gcWorkerDispatched(const bsl::shared_ptr<FileSet>& fileSet);
 
+    /// Issue a group commit syncing to disk everything written to the
+    /// active file set since the previous group commit, if any Receipt
+    /// waits for it and no group commit is already in progress.  Note that
+    /// this is invoked whenever the replication batch is flushed, i.e. when
+    /// it reaches its size limit or its latency budget expires, and at the
+    /// end of each batch of dispatcher events, so that a group commit never
+    /// covers more records than one replication batch.
+    ///
+    /// THREAD: This method should only be invoked by the partition
+    /// *dispatcher* thread.
+    void syncIfNeeded();
+
+    /// Sync to disk the range [`journalBegin`, `journalEnd`) of the journal
+    /// file and the range [`dataBegin`, `dataEnd`) of the data file of the
+    /// specified `fileSet`, and report the outcome of the group commit
+    /// identified by the specified `key`, `numRecords` and `generation` to
+    /// the partition dispatcher thread.
+    ///
+    /// THREAD: This method is invoked in a thread from the miscellaneous
+    /// *worker* thread pool.
+    void syncWorkerDispatched(const bsl::shared_ptr<FileSet>& fileSet,
+                              bsls::Types::Uint64             journalBegin,
+                              bsls::Types::Uint64             journalEnd,
+                              bsls::Types::Uint64             dataBegin,
+                              bsls::Types::Uint64             dataEnd,
+                              const DataStoreRecordKey&       key,
+                              int                             numRecords,
+                              unsigned int                    generation);
+
+    /// Complete the group commit of the specified `numRecords` records up
+    /// to the specified `key`, issued in the specified `generation`, which
+    /// took the specified `syncTime` nanoseconds.  If the active file set has
+    /// been replaced since the group commit was issued, mark the records as
+    /// unsynced again.  Otherwise, if `success` is true, release the Receipts
+    /// that were only waiting for the group commit, and NACK the
+    /// corresponding messages with an unknown result if `success` is false.
+    ///
+    /// THREAD: This method should only be invoked by the partition
+    /// *dispatcher* thread.
+    void syncCompleteDispatched(const DataStoreRecordKey& key,
+                                int                       numRecords,
+                                unsigned int              generation,
+                                bool                      success,
+                                bsls::Types::Int64        syncTime);
+
     /// Open this instance in non-recovery mode.  Return zero on success and
     /// a non-zero value otherwise.  Note that this routine can be used in
     /// recovery mode when there are no files to recover messages from.
@@ -476,18 +710,31 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// end of the journal, data and qlist files respectively.  Also, populate
     /// the map of primaryLeaseId to highest sequence number.
     ///
+    /// - Validation: Check the records in `dit` of the outstanding messages
+    /// retrieved in the second pass, including the CRC32-C of their payload.
+    /// Up to `d_config.recoveryParallelism()` threads (this one and the
+    /// threads of a pool started for the duration of the validation) share
+    /// this work, and its outcome is reported in iteration order.
+    ///
+    /// If the specified `checkpoint` is not null, both passes only iterate
+    /// over the records following its sync point, that sync point, and the
+    /// records it lists, as if the journal had been rolled over at that
+    /// sync point.  The behavior is undefined unless `checkpoint` has been
+    /// validated against `jit`.
+    ///
     /// Return zero on success, non zero value otherwise.  The behavior is
     /// undefined unless the journal iterator `jit` is in reverse mode.
     ///
     /// WARNING: This method invalidates all iterators.
-    int recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
-                        bsls::Types::Uint64* journalOffset,
-                        bsls::Types::Uint64* qlistOffset,
-                        bsls::Types::Uint64* dataOffset,
-                        JournalFileIterator* jit,
-                        QlistFileIterator*   qit,
-                        DataFileIterator*    dit,
-                        bool                 withCSL);
+    int recoverMessages(QueueKeyInfoMap*         queueKeyInfoMap,
+                        bsls::Types::Uint64*     journalOffset,
+                        bsls::Types::Uint64*     qlistOffset,
+                        bsls::Types::Uint64*     dataOffset,
+                        JournalFileIterator*     jit,
+                        QlistFileIterator*       qit,
+                        DataFileIterator*        dit,
+                        bool                     withCSL,
+                        const JournalCheckpoint* checkpoint);
 
     /// Rollover the outstanding messages belonging to the storages mapped
     /// to this file store, from active file set into the rollover file set,
@@ -605,7 +852,9 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// or `e_QLIST`.  Note that upon return of this method, it is
     /// guaranteed that a valid packet was created and enqueued to be sent
     /// to all peers; it does not mean that packet was successfully sent to
-    /// any/all peers.
+    /// any/all peers.  Also note that the records are not copied: the
+    /// packet refers to the mapped files, whose active file set is kept
+    /// alive (across rollover) until the packet is released.
     void replicateRecord(bmqp::StorageMessageType::Enum type,
                          int                            flags,
                          bsls::Types::Uint64            journalOffset,
@@ -634,6 +883,22 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
                                  unsigned int         primaryLeaseId,
                                  bsls::Types::Uint64  sequenceNumber);
 
+    /// Update the receipt latency and the receipted bytes of the specified
+    /// replica `node` which just sent a Receipt for the specified `key`, and
+    /// drop the replicated batches receipted by every replica.
+    void updateReplicaReceiptStats(const DataStoreRecordKey& key,
+                                   mqbnet::ClusterNode*      node);
+
+    /// Report the number of bytes replicated and not yet receipted by each
+    /// replica.  Note that the reported value is kept until reported again,
+    /// so every stats snapshot samples it, even for a replica which never
+    /// sends a Receipt.
+    void reportUnreceiptedBytes();
+
+    /// Forget the replication progress of the replicas and remove their
+    /// stats, e.g. because the primary of the partition changed.
+    void clearReplicas();
+
     /// Send previously generated Replication Receipt to the specified `node`
     /// using the specified `nodeContext`.
     void sendReceipt(mqbnet::ClusterNode* node, NodeContext* nodeContext);
@@ -666,7 +931,9 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
         bsls::Types::Uint64            recordOffset);
 
     /// Flush the storage if the specified `immediateFlush` is `true` or the
-    /// `d_storageEventBuilder` is over the `k_NAGLE_PACKET_COUNT` limit.
+    /// batch in `d_storageEventBuilder` is due: as decided by
+    /// `d_replicationBatchPolicy` if a replication latency budget is
+    /// configured, or once over the `k_NAGLE_PACKET_COUNT` limit otherwise.
     void flushIfNeeded(bool immediateFlush);
 
     // PRIVATE ACCESSORS
@@ -716,8 +983,9 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
               int                     replicationFactor,
               bslma::Allocator*       allocator);
 
-    /// Destroy this instance.  The behavior is undefined unless this
-    /// instance has been closed.
+    /// Destroy this instance, after waiting for the group commits in
+    /// progress to report their completion.  The behavior is undefined
+    /// unless this instance has been closed.
     ~FileStore() BSLS_KEYWORD_OVERRIDE;
 
     // MANIPULATORS
@@ -1133,12 +1401,14 @@ inline FileStore::ReceiptContext::ReceiptContext(
     const bmqt::MessageGUID& guid,
     const RecordIterator&    handle,
     int                      count,
-    mqbi::QueueHandle*       qH)
+    mqbi::QueueHandle*       qH,
+    bool                     isSyncPending)
 : d_queueKey(queueKey)
 , d_guid(guid)
 , d_handle(handle)
 , d_qH(qH)
 , d_count(count)
+, d_isSyncPending(isSyncPending)
 {
     // NOTHING
 }
@@ -1155,6 +1425,33 @@ inline FileStore::NodeContext::NodeContext(BlobSpPool* blobSpPool_p,
     // NOTHING
 }
 
+// --------------------------------
+// class FileStore::ReplicatedBatch
+// --------------------------------
+
+inline FileStore::ReplicatedBatch::ReplicatedBatch(
+    const DataStoreRecordKey& key,
+    bsls::Types::Int64        timepoint,
+    bsls::Types::Uint64       replicatedBytes)
+: d_key(key)
+, d_timepoint(timepoint)
+, d_replicatedBytes(replicatedBytes)
+{
+    // NOTHING
+}
+
+// -------------------------------
+// class FileStore::ReplicaContext
+// -------------------------------
+
+inline FileStore::ReplicaContext::ReplicaContext(mqbnet::ClusterNode* node)
+: d_node_p(node)
+, d_key()
+, d_receiptedBytes(0)
+{
+    // NOTHING
+}
+
 // ---------------
 // class FileStore
 // ---------------
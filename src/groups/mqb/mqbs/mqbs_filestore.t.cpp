@@ -17,6 +17,7 @@
 
 // MQB
 #include <mqbcfg_messages.h>
+#include <mqbcmd_messages.h>
 #include <mqbi_dispatcher.h>
 #include <mqbi_storage.h>
 #include <mqbmock_cluster.h>
@@ -28,6 +29,8 @@
 #include <mqbs_filestoreprotocol.h>
 #include <mqbs_filestoreset.h>
 #include <mqbs_filestoretestutil.h>
+#include <mqbs_filestoreutil.h>
+#include <mqbs_journalcheckpoint.h>
 #include <mqbstat_clusterstats.h>
 #include <mqbu_messageguidutil.h>
 #include <mqbu_storagekey.h>
@@ -36,10 +39,17 @@
 #include <bmqp_blobpoolutil.h>
 #include <bmqp_crc32c.h>
 #include <bmqp_ctrlmsg_messages.h>
+#include <bmqp_event.h>
+#include <bmqp_protocol.h>
+#include <bmqst_statcontext.h>
 #include <bmqt_messageguid.h>
 #include <bmqt_uri.h>
 
+#include <bmqio_testchannel.h>
+#include <bmqu_blob.h>
+#include <bmqu_blobobjectproxy.h>
 #include <bmqu_memoutstream.h>
+#include <bmqu_printutil.h>
 #include <bmqu_time.h>
 
 // TEST DRIVER
@@ -57,6 +67,10 @@
 #include <bdls_filesystemutil.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_epochutil.h>
+#include <bdlt_timeunitratio.h>
+#include <bsl_algorithm.h>
+#include <bsl_deque.h>
+#include <bsl_fstream.h>
 #include <bsl_iostream.h>
 #include <bsl_map.h>
 #include <bsl_memory.h>
@@ -66,8 +80,10 @@
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_threadutil.h>
 #include <bsls_platform.h>
 #include <bsls_systemclocktype.h>
+#include <bsls_timeutil.h>
 #include <bsls_types.h>
 
 // CONVENIENCE
@@ -105,13 +121,36 @@ class StoragePoster {
     /// Factory for allocating blob buffers for message payloads.
     bdlbb::PooledBlobBufferFactory d_bufferFactory;
 
+    /// Size of the payload of each posted message.
+    size_t d_payloadSize;
+
+    /// Whether posted messages are receipted when written locally, or need
+    /// to be receipted by the replicas.
+    bool d_hasReceipt;
+
+    /// Whether the Receipt of posted messages waits for them to be synced
+    /// to disk.
+    bool d_syncBeforeReceipt;
+
   public:
-    /// Create a `StoragePoster` that posts to the specified `storage`,
-    /// using the specified `allocator` for memory allocation.
+    /// Create a `StoragePoster` that posts to the specified `storage`
+    /// messages having a payload of the optionally specified `payloadSize`,
+    /// using the specified `allocator` for memory allocation.  Optionally
+    /// specify `hasReceipt` to indicate whether posted messages are
+    /// receipted when written locally (the default) or need to be receipted
+    /// by the replicas.  Optionally specify `syncBeforeReceipt` to indicate
+    /// whether the Receipt of posted messages also waits for them to be
+    /// synced to disk by a group commit (false by default).
     StoragePoster(const bsl::shared_ptr<mqbs::ReplicatedStorage>& storage,
-                  bslma::Allocator*                               allocator)
+                  bslma::Allocator*                               allocator,
+                  size_t payloadSize       = 10,
+                  bool   hasReceipt        = true,
+                  bool   syncBeforeReceipt = false)
     : d_storage_sp(storage)
     , d_bufferFactory(1024, allocator)
+    , d_payloadSize(payloadSize)
+    , d_hasReceipt(hasReceipt)
+    , d_syncBeforeReceipt(syncBeforeReceipt)
     {
     }
 
@@ -126,7 +165,9 @@ class StoragePoster {
         appData_sp.createInplace(bmqtst::TestHelperUtil::allocator(),
                                  &d_bufferFactory,
                                  bmqtst::TestHelperUtil::allocator());
-        bsl::string payload(10, 'x', bmqtst::TestHelperUtil::allocator());
+        bsl::string payload(d_payloadSize,
+                            'x',
+                            bmqtst::TestHelperUtil::allocator());
         bdlbb::BlobUtil::append(appData_sp.get(),
                                 payload.c_str(),
                                 payload.length());
@@ -140,9 +181,10 @@ class StoragePoster {
             static_cast<unsigned int>(appData_sp->length()),
             bmqp::MessagePropertiesInfo(),
             bmqt::CompressionAlgorithmType::e_NONE,
-            true,  // hasReceipt
-            0,     // queueHandle
+            d_hasReceipt,
+            0,  // queueHandle
             bmqp::Crc32c::calculate(*appData_sp));
+        attributes.setSyncBeforeReceipt(d_syncBeforeReceipt);
 
         bsl::shared_ptr<bdlbb::Blob> options_sp;
 
@@ -160,7 +202,112 @@ void recoveredQueuesCb(
     static_cast<void>(queueKeyInfoMap);
 }
 
+/// Replicas create the storage of a queue upon replication of its creation
+/// record.  Tests register that storage upfront instead.
+void queueCreationCb(int                     partitionId,
+                     const bmqt::Uri&        uri,
+                     const mqbu::StorageKey& queueKey,
+                     const AppInfos&         appIdKeyPairs,
+                     bool                    isNewQueue)
+{
+    static_cast<void>(partitionId);
+    static_cast<void>(uri);
+    static_cast<void>(queueKey);
+    static_cast<void>(appIdKeyPairs);
+    static_cast<void>(isNewQueue);
+}
+
+/// Return the name of the most recent data file found in the specified
+/// `location`.  File names embed their creation time, so the most recent
+/// one sorts last.
+bsl::string newestDataFile(const bsl::string& location)
+{
+    bsl::vector<bsl::string> files(bmqtst::TestHelperUtil::allocator());
+    bsl::string pattern(location, bmqtst::TestHelperUtil::allocator());
+    pattern.append("/*");
+    pattern.append(mqbs::FileStoreProtocol::k_DATA_FILE_EXTENSION);
+    bdls::FilesystemUtil::findMatchingPaths(&files, pattern.c_str());
+    if (files.empty()) {
+        return bsl::string(bmqtst::TestHelperUtil::allocator());  // RETURN
+    }
+
+    return *bsl::max_element(files.begin(), files.end());
+}
+
 // CLASSES
+// ==================
+// class TesterConfig
+// ==================
+
+/// Configuration of a `Tester`, whose default values describe a standalone
+/// node whose partition is configured with the defaults of the component.
+class TesterConfig {
+  public:
+    // DATA
+
+    // Attributes of the partition, see `mqbs::DataStoreConfig`.
+    int d_nextFileSetCreationPercent;
+    int d_recoveryParallelism;
+    int d_checkpointInterval;
+    int d_replicationLatencyBudgetUs;
+
+    /// Number of nodes in the cluster, self being one of them.
+    int d_numNodes;
+
+    /// Index of self in the nodes of the cluster, whose ids are consecutive
+    /// starting from `k_NODE_ID`.
+    int d_selfIndex;
+
+    // CREATORS
+    TesterConfig()
+    : d_nextFileSetCreationPercent(0)
+    , d_recoveryParallelism(0)
+    , d_checkpointInterval(0)
+    , d_replicationLatencyBudgetUs(0)
+    , d_numNodes(1)
+    , d_selfIndex(0)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+    TesterConfig& setNextFileSetCreationPercent(int value)
+    {
+        d_nextFileSetCreationPercent = value;
+        return *this;
+    }
+
+    TesterConfig& setRecoveryParallelism(int value)
+    {
+        d_recoveryParallelism = value;
+        return *this;
+    }
+
+    TesterConfig& setCheckpointInterval(int value)
+    {
+        d_checkpointInterval = value;
+        return *this;
+    }
+
+    TesterConfig& setReplicationLatencyBudgetUs(int value)
+    {
+        d_replicationLatencyBudgetUs = value;
+        return *this;
+    }
+
+    TesterConfig& setNumNodes(int value)
+    {
+        d_numNodes = value;
+        return *this;
+    }
+
+    TesterConfig& setSelfIndex(int value)
+    {
+        d_selfIndex = value;
+        return *this;
+    }
+};
+
 // ============
 // class Tester
 // ============
@@ -177,6 +324,8 @@ class Tester {
     mqbcfg::ClusterDefinition              d_clusterCfg;
     bsl::vector<mqbcfg::ClusterNode>       d_clusterNodesCfg;
     mqbcfg::ClusterNode                    d_clusterNodeCfg;
+    bsl::vector<bsl::shared_ptr<bmqio::TestChannel> > d_channels;
+    // channels to the peers, must outlive the cluster
     bslma::ManagedPtr<mqbnet::MockCluster> d_cluster_mp;
     bsl::shared_ptr<bmqst::StatContext>    d_clusterStatsRootContext_sp;
     mqbstat::ClusterStats                  d_clusterStats;
@@ -190,7 +339,8 @@ class Tester {
 
   public:
     // CREATORS
-    explicit Tester(bsl::string_view location)
+    explicit Tester(bsl::string_view    location,
+                    const TesterConfig& config = TesterConfig())
     : d_allocator_p(bmqtst::TestHelperUtil::allocator())
     , d_scheduler(bsls::SystemClockType::e_MONOTONIC, d_allocator_p)
     , d_bufferFactory(1024, d_allocator_p)
@@ -202,12 +352,13 @@ class Tester {
     , d_clusterCfg(d_allocator_p)
     , d_clusterNodesCfg(d_allocator_p)
     , d_clusterNodeCfg(d_allocator_p)
+    , d_channels(d_allocator_p)
     , d_clusterStatsRootContext_sp(
           mqbstat::ClusterStatsUtil::initializeStatContextCluster(
               2,
               d_allocator_p))
     , d_clusterStats(d_allocator_p)
-    , d_miscWorkThreadPool(1, 1, d_allocator_p)
+    , d_miscWorkThreadPool(1, 100, d_allocator_p)
     , d_dispatcher(d_allocator_p)
     , d_statePool(1024, d_allocator_p)
     {
@@ -248,14 +399,49 @@ class Tester {
             "tcp://localhost:34567");
         d_clusterNodesCfg.push_back(d_clusterNodeCfg);
 
+        for (int i = 1; i < config.d_numNodes; ++i) {
+            // Peers, which are only reachable through a test channel.
+            mqbcfg::ClusterNode peerCfg(d_clusterNodeCfg, d_allocator_p);
+            bmqu::MemOutStream  os(d_allocator_p);
+            os << "foobar" << i;
+            peerCfg.name().assign(os.str().data(), os.str().length());
+            peerCfg.id() = k_NODE_ID + i;
+            os.reset();
+            os << "tcp://localhost:" << 34567 + i;
+            peerCfg.transport().makeTcp().endpoint().assign(
+                os.str().data(),
+                os.str().length());
+            d_clusterNodesCfg.push_back(peerCfg);
+        }
+
         d_clusterCfg.nodes() = d_clusterNodesCfg;
 
+        const int selfNodeId = k_NODE_ID + config.d_selfIndex;
+
         d_cluster_mp =
             bslma::ManagedPtrUtil::allocateManaged<mqbnet::MockCluster>(
                 d_allocator_p,
                 d_clusterCfg,
                 &d_bufferFactory);
-        d_node_p = d_cluster_mp->lookupNode(k_NODE_ID);
+        if (1 < config.d_numNodes) {
+            d_cluster_mp->_setSelfNodeId(selfNodeId);
+
+            mqbnet::Cluster::NodesList& nodes = d_cluster_mp->nodes();
+            for (mqbnet::Cluster::NodesList::iterator it = nodes.begin();
+                 it != nodes.end();
+                 ++it) {
+                if ((*it)->nodeId() == selfNodeId) {
+                    continue;  // CONTINUE
+                }
+                d_channels.push_back(
+                    bsl::allocate_shared<bmqio::TestChannel>(d_allocator_p));
+                bsl::weak_ptr<bmqio::Channel> channelWp(d_channels.back());
+                (*it)->setChannel(channelWp,
+                                  bmqp_ctrlmsg::ClientIdentity(),
+                                  bmqio::Channel::ReadCallback());
+            }
+        }
+        d_node_p = d_cluster_mp->lookupNode(selfNodeId);
 
         d_dsCfg
             .setScheduler(&d_scheduler)
@@ -265,15 +451,20 @@ class Tester {
             .setPrefaultPages(d_partitionCfg.prefaultPages())
             .setLocation(d_partitionCfg.location())
             .setArchiveLocation(d_partitionCfg.archiveLocation())
-            .setNodeId(k_NODE_ID)  // TBD: clusterNodeCfg.id())
+            .setNodeId(selfNodeId)
             .setPartitionId(0)
             .setMaxDataFileSize(d_partitionCfg.maxDataFileSize())
             .setMaxJournalFileSize(d_partitionCfg.maxJournalFileSize())
             .setMaxQlistFileSize(d_partitionCfg.maxQlistFileSize())
+            .setNextFileSetCreationPercent(config.d_nextFileSetCreationPercent)
+            .setRecoveryParallelism(config.d_recoveryParallelism)
+            .setCheckpointInterval(config.d_checkpointInterval)
+            .setReplicationLatencyBudgetUs(config.d_replicationLatencyBudgetUs)
             .setRecoveredQueuesCb(bdlf::BindUtil::bind(
                 &recoveredQueuesCb,
-                bdlf::PlaceHolders::_1,    // partitionId
-                bdlf::PlaceHolders::_2));  // queueKeyInfoMap
+                bdlf::PlaceHolders::_1,   // partitionId
+                bdlf::PlaceHolders::_2))  // queueKeyInfoMap
+            .setQueueCreationCb(&queueCreationCb);
 
         d_clusterStats.initialize("testCluster",
                                   1,  // numPartitions
@@ -289,9 +480,9 @@ class Tester {
             d_blobSpPool_sp.get(),
             &d_statePool,
             &d_miscWorkThreadPool,
-            true,  // isFSMWorkflow
-            true,  // doesFSMwriteQLIST
-            1);    // replicationFactor
+            true,               // isFSMWorkflow
+            true,               // doesFSMwriteQLIST
+            config.d_numNodes / 2 + 1);  // replicationFactor
 
         // To pass `inDispatcherThread` checks:
         d_fs_mp->setThreadId(bslmt::ThreadUtil::selfId());
@@ -299,6 +490,9 @@ class Tester {
 
     ~Tester()
     {
+        if (!d_channels.empty()) {
+            d_cluster_mp->closeChannels();
+        }
         d_scheduler.stop();
         d_miscWorkThreadPool.stop();
 
@@ -776,6 +970,24 @@ class Tester {
 
     mqbnet::ClusterNode* node() const { return d_node_p; }
 
+    /// Return the node having the specified `nodeId` in the cluster of this
+    /// object.
+    mqbnet::ClusterNode* node(int nodeId) const
+    {
+        return d_cluster_mp->lookupNode(nodeId);
+    }
+
+    /// Return the test channel to the peer having the specified `nodeId`.
+    /// The behavior is undefined unless this object was created with more
+    /// than one node and `nodeId` is not the id of self.
+    bmqio::TestChannel& channel(int nodeId) const
+    {
+        const int index = nodeId - k_NODE_ID;
+        return *d_channels[index < d_node_p->nodeId() - k_NODE_ID
+                               ? index
+                               : index - 1];
+    }
+
     bdlmt::FixedThreadPool& miscWorkThreadPool()
     {
         return d_miscWorkThreadPool;
@@ -784,8 +996,529 @@ class Tester {
     mqbmock::Dispatcher& dispatcher() { return d_dispatcher; }
 
     bdlmt::EventScheduler& scheduler() { return d_scheduler; }
+
+    /// Snapshot the stats of the cluster of this object, and remove the stat
+    /// contexts released before the snapshot.
+    void snapshotStats()
+    {
+        d_clusterStatsRootContext_sp->snapshot();
+        d_clusterStatsRootContext_sp->cleanup();
+    }
+
+    /// Return the stat context of the partition of this object.
+    const bmqst::StatContext& partitionStatContext() const
+    {
+        return *d_clusterStats.getPartitionStats(d_dsCfg.partitionId())
+                    ->statContext();
+    }
+};
+
+/// Open the partition of the specified `tester` as primary, post the
+/// specified `numMessages` messages having a payload of the specified
+/// `payloadSize` to a newly created queue, and close the partition.  Return
+/// the number of records in the partition before it was closed, or 0 on
+/// failure.
+bsls::Types::Uint64
+populatePartition(Tester* tester, size_t numMessages, size_t payloadSize)
+{
+    mqbs::FileStore& fs = tester->fileStore();
+
+    // Disable in-place callback execution in mock dispatcher to prevent
+    // thread races between the main thread (that modifies FileStore) and
+    // scheduler thread (that performs gc on FileStore).
+    tester->dispatcher().setEnqueueOnly(true);
+
+    int rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    if (rc) {
+        cout << "Failed to open partition, rc: " << rc << endl;
+        return 0;  // RETURN
+    }
+
+    fs.setActivePrimary(tester->node(), 1);
+
+    // Create a storage and register it with the FileStore.
+    bmqt::Uri        queueUri("bmq://si.amw.bmq.stats/testQueue",
+                       bmqtst::TestHelperUtil::allocator());
+    mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                              "ABCDE");
+
+    mqbmock::Cluster mockCluster(bmqtst::TestHelperUtil::allocator());
+    mqbmock::Domain  mockDomain(&mockCluster,
+                               bmqtst::TestHelperUtil::allocator());
+    mqbconfm::Domain domainCfg(bmqtst::TestHelperUtil::allocator());
+    domainCfg.messageTtl() = bsl::numeric_limits<bsls::Types::Int64>::max();
+    domainCfg.storage().config().makeFileBacked();
+    bmqu::MemOutStream errDesc(bmqtst::TestHelperUtil::allocator());
+    mockDomain.configure(errDesc, domainCfg);
+
+    bsl::shared_ptr<mqbs::ReplicatedStorage> storage_sp;
+    fs.createStorage(&storage_sp, queueUri, queueKey, &mockDomain);
+
+    mqbconfm::Limits limits;
+    limits.messages() = bsl::numeric_limits<bsls::Types::Int64>::max();
+    limits.bytes()    = bsl::numeric_limits<bsls::Types::Int64>::max();
+    limits.messagesWatermarkRatio() = 0.8;
+    limits.bytesWatermarkRatio()    = 0.8;
+    storage_sp->configure(domainCfg.storage().config(),
+                          limits,
+                          domainCfg.messageTtl(),
+                          0);  // maxDeliveryAttempts
+
+    fs.registerStorage(storage_sp.get());
+
+    mqbmock::Queue mockQueue(&mockDomain, bmqtst::TestHelperUtil::allocator());
+    storage_sp->setQueue(&mockQueue);
+
+    mqbs::DataStoreRecordHandle queueHandle;
+    bsls::Types::Uint64         timestamp = bdlt::EpochUtil::convertToTimeT64(
+        bdlt::CurrentTime::utc());
+    rc = fs.writeQueueCreationRecord(&queueHandle,
+                                     queueUri,
+                                     queueKey,
+                                     AppInfos(),
+                                     timestamp,
+                                     true);  // isNewQueue
+    BMQTST_ASSERT_EQ(0, rc);
+
+    StoragePoster poster(storage_sp,
+                         bmqtst::TestHelperUtil::allocator(),
+                         payloadSize);
+    for (size_t i = 0; i < numMessages; ++i) {
+        BMQTST_ASSERT_EQ_D(i,
+                           poster.postMessage(),
+                           mqbi::StorageResult::e_SUCCESS);
+    }
+
+    const bsls::Types::Uint64 numRecords = fs.numRecords();
+
+    tester->miscWorkThreadPool().drain();
+    tester->scheduler().cancelAllEventsAndWait();
+    tester->dispatcher().processQueue();
+    fs.unregisterStorage(storage_sp.get());
+    fs.close();
+
+    return numRecords;
+}
+
+/// Queue whose storage is registered with the `FileStore` of one node of a
+/// replicated partition.  Replicas create the storage upfront rather than
+/// upon replication of the queue creation record.
+class TestQueue {
+  private:
+    // DATA
+    mqbs::FileStore*                         d_fs_p;
+    mqbmock::Cluster                         d_cluster;
+    mqbmock::Domain                          d_domain;
+    bslma::ManagedPtr<mqbmock::Queue>        d_queue_mp;
+    bsl::shared_ptr<mqbs::ReplicatedStorage> d_storage_sp;
+
+  public:
+    // CREATORS
+
+    /// Create the storage of a queue and register it with the specified
+    /// `fs`.
+    explicit TestQueue(mqbs::FileStore* fs)
+    : d_fs_p(fs)
+    , d_cluster(bmqtst::TestHelperUtil::allocator())
+    , d_domain(&d_cluster, bmqtst::TestHelperUtil::allocator())
+    , d_queue_mp()
+    , d_storage_sp()
+    {
+        mqbconfm::Domain domainCfg(bmqtst::TestHelperUtil::allocator());
+        domainCfg.messageTtl() =
+            bsl::numeric_limits<bsls::Types::Int64>::max();
+        domainCfg.storage().config().makeFileBacked();
+        bmqu::MemOutStream errDesc(bmqtst::TestHelperUtil::allocator());
+        d_domain.configure(errDesc, domainCfg);
+
+        d_fs_p->createStorage(&d_storage_sp, uri(), key(), &d_domain);
+
+        mqbconfm::Limits limits;
+        limits.messages() = bsl::numeric_limits<bsls::Types::Int64>::max();
+        limits.bytes()    = bsl::numeric_limits<bsls::Types::Int64>::max();
+        limits.messagesWatermarkRatio() = 0.8;
+        limits.bytesWatermarkRatio()    = 0.8;
+        d_storage_sp->configure(domainCfg.storage().config(),
+                                limits,
+                                domainCfg.messageTtl(),
+                                0);  // maxDeliveryAttempts
+
+        d_fs_p->registerStorage(d_storage_sp.get());
+
+        d_queue_mp = bslma::ManagedPtrUtil::allocateManaged<mqbmock::Queue>(
+            bmqtst::TestHelperUtil::allocator(),
+            &d_domain);
+        d_storage_sp->setQueue(d_queue_mp.get());
+    }
+
+    ~TestQueue() { d_fs_p->unregisterStorage(d_storage_sp.get()); }
+
+    // CLASS METHODS
+    static bmqt::Uri uri()
+    {
+        return bmqt::Uri("bmq://si.amw.bmq.stats/testQueue",
+                         bmqtst::TestHelperUtil::allocator());
+    }
+
+    static mqbu::StorageKey key()
+    {
+        return mqbu::StorageKey(mqbu::StorageKey::BinaryRepresentation(),
+                                "ABCDE");
+    }
+
+    // ACCESSORS
+    const bsl::shared_ptr<mqbs::ReplicatedStorage>& storage() const
+    {
+        return d_storage_sp;
+    }
+
+    /// Return the queue notified of the Receipts of the messages posted to
+    /// the storage.
+    const mqbmock::Queue& queue() const { return *d_queue_mp; }
+};
+
+/// In-process replicated partition made of a primary and replicas, each
+/// having its own `FileStore`, exchanging storage events and Receipts over
+/// test channels which are pumped by the thread driving the partition.
+class ReplicatedPartition {
+  private:
+    // PRIVATE TYPES
+
+    /// Sequence number of a posted message and time it was posted at.
+    typedef bsl::pair<bsls::Types::Uint64, bsls::Types::Int64> PostedMessage;
+
+    // DATA
+    bsl::vector<bsl::shared_ptr<Tester> >    d_testers;
+    bsl::vector<bsl::shared_ptr<TestQueue> > d_queues;
+    bslma::ManagedPtr<StoragePoster>         d_poster_mp;
+
+    /// Messages posted to the primary and not yet receipted by the first
+    /// replica, in order.
+    bsl::deque<PostedMessage> d_unreceipted;
+
+    /// Time between the posting of each message and its Receipt by the
+    /// first replica, in nanoseconds.
+    bsl::vector<bsls::Types::Int64> d_latencies;
+
+    /// Number of storage events received by the first replica.
+    size_t d_numEvents;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Process the Receipt for the specified `sequenceNum` received by the
+    /// primary from the first replica at the specified `now` time.
+    void onReceipt(bsls::Types::Uint64 sequenceNum, bsls::Types::Int64 now)
+    {
+        while (!d_unreceipted.empty() &&
+               d_unreceipted.front().first <= sequenceNum) {
+            d_latencies.push_back(now - d_unreceipted.front().second);
+            d_unreceipted.pop_front();
+        }
+    }
+
+  public:
+    // CREATORS
+
+    /// Create a partition of the specified `numNodes` nodes storing their
+    /// files under the specified `location`, whose primary batches
+    /// replicated messages within the specified `latencyBudgetUs` (or every
+    /// fixed number of messages if 0), open it and create a queue.
+    ReplicatedPartition(const bsl::string& location,
+                        int                numNodes,
+                        int                latencyBudgetUs)
+    : d_testers(bmqtst::TestHelperUtil::allocator())
+    , d_queues(bmqtst::TestHelperUtil::allocator())
+    , d_poster_mp()
+    , d_unreceipted(bmqtst::TestHelperUtil::allocator())
+    , d_latencies(bmqtst::TestHelperUtil::allocator())
+    , d_numEvents(0)
+    {
+        for (int i = 0; i < numNodes; ++i) {
+            bmqu::MemOutStream os(bmqtst::TestHelperUtil::allocator());
+            os << location << "-" << i;
+            d_testers.push_back(bsl::allocate_shared<Tester>(
+                bmqtst::TestHelperUtil::allocator(),
+                os.str(),
+                TesterConfig()
+                    .setReplicationLatencyBudgetUs(latencyBudgetUs)
+                    .setNumNodes(numNodes)
+                    .setSelfIndex(i)));
+
+            Tester& tester = *d_testers.back();
+
+            // Disable in-place callback execution in mock dispatcher, so that
+            // sync points and gc do not interleave with the measurement.
+            tester.dispatcher().setEnqueueOnly(true);
+
+            BSLA_MAYBE_UNUSED const int rc = tester.fileStore().open(0);
+            BMQTST_ASSERT_EQ_D(i, 0, rc);
+
+            d_queues.push_back(bsl::allocate_shared<TestQueue>(
+                bmqtst::TestHelperUtil::allocator(),
+                &tester.fileStore()));
+        }
+
+        // Replicas first, so that they are ready to process what the
+        // primary replicates.
+
+        for (int i = numNodes - 1; 0 <= i; --i) {
+            d_testers[i]->fileStore().setActivePrimary(
+                d_testers[i]->node(k_NODE_ID),
+                1);  // primaryLeaseId
+        }
+
+        mqbs::DataStoreRecordHandle queueHandle;
+        BSLA_MAYBE_UNUSED const int rc = primary().writeQueueCreationRecord(
+            &queueHandle,
+            TestQueue::uri(),
+            TestQueue::key(),
+            AppInfos(),
+            bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+            true);  // isNewQueue
+        BMQTST_ASSERT_EQ(0, rc);
+        primary().flushStorage();
+
+        d_poster_mp = bslma::ManagedPtrUtil::allocateManaged<StoragePoster>(
+            bmqtst::TestHelperUtil::allocator(),
+            d_queues[0]->storage(),
+            bmqtst::TestHelperUtil::allocator(),
+            10,      // payloadSize
+            false);  // hasReceipt
+    }
+
+    ~ReplicatedPartition()
+    {
+        for (size_t i = 0; i < d_testers.size(); ++i) {
+            Tester& tester = *d_testers[i];
+            tester.miscWorkThreadPool().drain();
+            tester.scheduler().cancelAllEventsAndWait();
+            tester.dispatcher().processQueue();
+        }
+
+        d_poster_mp.reset();
+        d_queues.clear();
+
+        for (size_t i = 0; i < d_testers.size(); ++i) {
+            d_testers[i]->fileStore().close();
+        }
+    }
+
+    // MANIPULATORS
+
+    /// Return the `FileStore` of the primary.
+    mqbs::FileStore& primary() { return d_testers[0]->fileStore(); }
+
+    /// Post a message to the queue on the primary.
+    void post()
+    {
+        const bsls::Types::Int64 now = bmqu::Time::highResolutionTimer();
+        BMQTST_ASSERT_EQ(d_poster_mp->postMessage(),
+                         mqbi::StorageResult::e_SUCCESS);
+        d_unreceipted.push_back(
+            bsl::make_pair(primary().sequenceNumber(), now));
+    }
+
+    /// Deliver to the replicas the storage events broadcast by the primary,
+    /// and to the primary the Receipts sent by the replicas so far.
+    void pump()
+    {
+        Tester& primaryTester = *d_testers[0];
+
+        for (size_t i = 1; i < d_testers.size(); ++i) {
+            Tester&   replicaTester = *d_testers[i];
+            const int replicaId     = k_NODE_ID + static_cast<int>(i);
+
+            bmqio::TestChannel& toReplica = primaryTester.channel(replicaId);
+            while (0 != toReplica.numWriteCalls()) {
+                bsl::shared_ptr<bdlbb::Blob> event_sp =
+                    bsl::allocate_shared<bdlbb::Blob>(
+                        bmqtst::TestHelperUtil::allocator(),
+                        toReplica.popWriteCall().d_blob);
+                replicaTester.fileStore().processStorageEvent(
+                    event_sp,
+                    false,  // isPartitionSyncEvent
+                    replicaTester.node(k_NODE_ID));
+                if (1 == i) {
+                    ++d_numEvents;
+                }
+            }
+
+            bmqio::TestChannel& toPrimary = replicaTester.channel(k_NODE_ID);
+            while (0 != toPrimary.numWriteCalls()) {
+                const bmqio::TestChannel::WriteCall call =
+                    toPrimary.popWriteCall();
+
+                bmqu::BlobPosition          position;
+                BSLA_MAYBE_UNUSED const int rc =
+                    bmqu::BlobUtil::findOffsetSafe(&position,
+                                                   call.d_blob,
+                                                   sizeof(bmqp::EventHeader));
+                BSLS_ASSERT_OPT(0 == rc);
+
+                bmqu::BlobObjectProxy<bmqp::ReplicationReceipt> receipt(
+                    &call.d_blob,
+                    position,
+                    true,    // read mode
+                    false);  // no write
+                BSLS_ASSERT_OPT(receipt.isSet());
+
+                primary().processReceiptEvent(receipt->primaryLeaseId(),
+                                              receipt->sequenceNum(),
+                                              primaryTester.node(replicaId));
+                if (1 == i) {
+                    onReceipt(receipt->sequenceNum(),
+                              bmqu::Time::highResolutionTimer());
+                }
+            }
+        }
+    }
+
+    // ACCESSORS
+
+    /// Return the number of messages posted and not yet receipted by the
+    /// first replica.
+    size_t numUnreceipted() const { return d_unreceipted.size(); }
+
+    /// Return the number of storage events received by the first replica.
+    size_t numEvents() const { return d_numEvents; }
+
+    /// Return the time between the posting of each receipted message and
+    /// its Receipt by the first replica, in nanoseconds, in order.
+    const bsl::vector<bsls::Types::Int64>& latencies() const
+    {
+        return d_latencies;
+    }
 };
 
+/// Replicate, over a partition of three nodes whose primary batches
+/// replicated messages within the specified `latencyBudgetUs` (or every
+/// fixed number of messages if 0), the specified `numMessages` posted every
+/// specified `interval` nanoseconds (as fast as possible if 0), and print
+/// the throughput and replication latency observed.
+void measureReplication(int                latencyBudgetUs,
+                        bsls::Types::Int64 interval,
+                        size_t             numMessages)
+{
+    // Number of messages the dispatcher of the primary processes before
+    // finding its queue empty and flushing the storage.
+    const size_t             k_DISPATCHER_BATCH_SIZE = 1000;
+    const bsls::Types::Int64 k_TIMEOUT = 5 * bdlt::TimeUnitRatio::k_NS_PER_S;
+
+    ReplicatedPartition partition("./test-cluster123-N2",
+                                  3,  // numNodes
+                                  latencyBudgetUs);
+    partition.pump();
+
+    const bsls::Types::Int64 begin = bmqu::Time::highResolutionTimer();
+    for (size_t i = 0; i < numMessages; ++i) {
+        const bsls::Types::Int64 due = begin +
+                                       static_cast<bsls::Types::Int64>(i) *
+                                           interval;
+        while (bmqu::Time::highResolutionTimer() < due) {
+            partition.pump();
+        }
+
+        partition.post();
+
+        if (0 == (i + 1) % k_DISPATCHER_BATCH_SIZE) {
+            partition.primary().flushStorage();
+            partition.pump();
+        }
+    }
+    partition.primary().flushStorage();
+
+    while (0 != partition.numUnreceipted() &&
+           bmqu::Time::highResolutionTimer() - begin <
+               k_TIMEOUT + static_cast<bsls::Types::Int64>(numMessages) *
+                               interval) {
+        partition.pump();
+    }
+    const bsls::Types::Int64 end = bmqu::Time::highResolutionTimer();
+
+    BMQTST_ASSERT_EQ(partition.numUnreceipted(), 0u);
+
+    bsl::vector<bsls::Types::Int64> latencies(
+        partition.latencies(),
+        bmqtst::TestHelperUtil::allocator());
+    if (latencies.empty()) {
+        return;  // RETURN
+    }
+    bsl::sort(latencies.begin(), latencies.end());
+
+    cout << "budget: ";
+    if (latencyBudgetUs) {
+        cout << bmqu::PrintUtil::prettyTimeInterval(
+            latencyBudgetUs * bdlt::TimeUnitRatio::k_NS_PER_US);
+    }
+    else {
+        cout << "none (fixed batches)";
+    }
+    cout << ", interval: " << bmqu::PrintUtil::prettyTimeInterval(interval)
+         << ", throughput: "
+         << bmqu::PrintUtil::prettyNumber(static_cast<bsls::Types::Int64>(
+                static_cast<double>(numMessages) *
+                bdlt::TimeUnitRatio::k_NS_PER_S / (end - begin)))
+         << " msgs/s, events: " << partition.numEvents()
+         << ", latency p50: "
+         << bmqu::PrintUtil::prettyTimeInterval(
+                latencies[latencies.size() / 2])
+         << ", p99: "
+         << bmqu::PrintUtil::prettyTimeInterval(
+                latencies[latencies.size() * 99 / 100])
+         << ", max: "
+         << bmqu::PrintUtil::prettyTimeInterval(latencies.back()) << "\n";
+}
+
+/// Open the partition of the specified `tester` as its primary, create the
+/// specified `queue` on it and replicate its creation record.
+void openGroupCommitPartition(Tester*                       tester,
+                              bslma::ManagedPtr<TestQueue>* queue)
+{
+    mqbs::FileStore& fs = tester->fileStore();
+
+    // Let the test decide when the completion of a group commit is processed
+    // by the dispatcher thread.
+    tester->dispatcher().setEnqueueOnly(true);
+
+    BSLA_MAYBE_UNUSED int rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    fs.setActivePrimary(tester->node(k_NODE_ID), 1);  // primaryLeaseId
+
+    *queue = bslma::ManagedPtrUtil::allocateManaged<TestQueue>(
+        bmqtst::TestHelperUtil::allocator(),
+        &fs);
+
+    mqbs::DataStoreRecordHandle queueHandle;
+    rc = fs.writeQueueCreationRecord(
+        &queueHandle,
+        TestQueue::uri(),
+        TestQueue::key(),
+        AppInfos(),
+        bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+        true);  // isNewQueue
+    BMQTST_ASSERT_EQ(0, rc);
+    fs.flushStorage();
+
+    bmqio::TestChannel& channel = tester->channel(k_NODE_ID + 1);
+    while (0 != channel.numWriteCalls()) {
+        channel.popWriteCall();
+    }
+}
+
+/// Close the partition of the specified `tester` having the specified
+/// `queue`.
+void closeGroupCommitPartition(Tester*                       tester,
+                               bslma::ManagedPtr<TestQueue>* queue)
+{
+    tester->miscWorkThreadPool().drain();
+    tester->scheduler().cancelAllEventsAndWait();
+    tester->dispatcher().processQueue();
+    queue->reset();
+    tester->fileStore().close();
+}
+
 // ============================================================================
 //                                    TESTS
 // ----------------------------------------------------------------------------
@@ -1274,6 +2007,895 @@ static void test4_recoverMessagesAcrossLeaseIds()
     fs.close();
 }
 
+static void test5_groupCommit()
+// ------------------------------------------------------------------------
+// GROUP COMMIT
+//
+// Concerns:
+//   1. The Receipt of a message which must be synced to disk is held back,
+//      even once replicated, until the group commit covering it completes.
+//   2. A group commit is issued when the replication batch reaches its size
+//      limit, without waiting for the end of the dispatcher batch.
+//   3. A group commit is issued when the latency budget of the replication
+//      batch expires.
+//
+// Testing:
+//   flushStorage
+//   processReceiptEvent
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const int k_NUM_NODES  = 3;
+    const int k_REPLICA_ID = k_NODE_ID + 1;
+
+    // Number of messages replicated in one batch without latency budget
+    // (i.e. 'k_NAGLE_PACKET_COUNT' in the component).
+    const int k_BATCH_SIZE = 100;
+
+    const int k_LATENCY_BUDGET_US = 100 * 1000;
+
+    {
+        PV("Receipts wait for the group commit");
+
+        Tester tester("./test-cluster123-5",
+                      TesterConfig().setNumNodes(k_NUM_NODES));
+        mqbs::FileStore&             fs = tester.fileStore();
+        bslma::ManagedPtr<TestQueue> queue;
+        openGroupCommitPartition(&tester, &queue);
+
+        StoragePoster poster(queue->storage(),
+                             bmqtst::TestHelperUtil::allocator(),
+                             10,     // payloadSize
+                             false,  // hasReceipt
+                             true);  // syncBeforeReceipt
+
+        const int k_NUM_MSGS = 10;
+        for (int i = 0; i < k_NUM_MSGS; ++i) {
+            BMQTST_ASSERT_EQ_D(i,
+                               poster.postMessage(),
+                               mqbi::StorageResult::e_SUCCESS);
+        }
+
+        // Replicated, but not synced yet.
+        fs.processReceiptEvent(1,  // primaryLeaseId
+                               fs.sequenceNumber(),
+                               tester.node(k_REPLICA_ID));
+        BMQTST_ASSERT_EQ(queue->queue()._numReceipts(), 0);
+
+        // End of the batch: the group commit is issued, and the Receipts are
+        // released once its completion reaches the dispatcher thread.
+        fs.flushStorage();
+        tester.miscWorkThreadPool().drain();
+        BMQTST_ASSERT_EQ(queue->queue()._numReceipts(), 0);
+
+        tester.dispatcher().processQueue();
+        BMQTST_ASSERT_EQ(queue->queue()._numReceipts(), k_NUM_MSGS);
+        BMQTST_ASSERT_EQ(queue->queue()._numRemovals(), 0);
+
+        PV("A batch reaching its size limit is committed");
+
+        bmqio::TestChannel& channel = tester.channel(k_REPLICA_ID);
+        while (0 != channel.numWriteCalls()) {
+            channel.popWriteCall();
+        }
+
+        int numPosted = 0;
+        while (0 == channel.numWriteCalls() && numPosted < 2 * k_BATCH_SIZE) {
+            BMQTST_ASSERT_EQ_D(numPosted,
+                               poster.postMessage(),
+                               mqbi::StorageResult::e_SUCCESS);
+            ++numPosted;
+        }
+        BMQTST_ASSERT_EQ(numPosted, k_BATCH_SIZE);
+
+        fs.processReceiptEvent(1,  // primaryLeaseId
+                               fs.sequenceNumber(),
+                               tester.node(k_REPLICA_ID));
+        BMQTST_ASSERT_EQ(queue->queue()._numReceipts(), k_NUM_MSGS);
+
+        tester.miscWorkThreadPool().drain();
+        tester.dispatcher().processQueue();
+        BMQTST_ASSERT_EQ(queue->queue()._numReceipts(),
+                         k_NUM_MSGS + k_BATCH_SIZE);
+
+        closeGroupCommitPartition(&tester, &queue);
+    }
+
+    {
+        PV("A batch whose latency budget expires is committed");
+
+        Tester tester("./test-cluster123-5",
+                      TesterConfig()
+                          .setReplicationLatencyBudgetUs(k_LATENCY_BUDGET_US)
+                          .setNumNodes(k_NUM_NODES));
+        mqbs::FileStore&             fs = tester.fileStore();
+        bslma::ManagedPtr<TestQueue> queue;
+        openGroupCommitPartition(&tester, &queue);
+
+        StoragePoster poster(queue->storage(),
+                             bmqtst::TestHelperUtil::allocator(),
+                             10,     // payloadSize
+                             false,  // hasReceipt
+                             true);  // syncBeforeReceipt
+
+        bmqio::TestChannel& channel = tester.channel(k_REPLICA_ID);
+
+        BMQTST_ASSERT_EQ(poster.postMessage(), mqbi::StorageResult::e_SUCCESS);
+        BMQTST_ASSERT_EQ(channel.numWriteCalls(), 0u);
+
+        bslmt::ThreadUtil::microSleep(2 * k_LATENCY_BUDGET_US);
+
+        // The oldest message of the batch has now waited longer than the
+        // budget.
+        BMQTST_ASSERT_EQ(poster.postMessage(), mqbi::StorageResult::e_SUCCESS);
+        BMQTST_ASSERT_NE(channel.numWriteCalls(), 0u);
+
+        fs.processReceiptEvent(1,  // primaryLeaseId
+                               fs.sequenceNumber(),
+                               tester.node(k_REPLICA_ID));
+        BMQTST_ASSERT_EQ(queue->queue()._numReceipts(), 0);
+
+        tester.miscWorkThreadPool().drain();
+        tester.dispatcher().processQueue();
+        BMQTST_ASSERT_EQ(queue->queue()._numReceipts(), 2);
+
+        closeGroupCommitPartition(&tester, &queue);
+    }
+}
+
+static void test6_rolloverUnderLoad()
+// ------------------------------------------------------------------------
+// ROLLOVER UNDER LOAD
+//
+// Concerns:
+//   With 'nextFileSetCreationPercent' enabled, verify that the next file
+//   set is created in the background once the active one crosses the
+//   threshold, that rollover switches to that pre-created file set rather
+//   than creating one, and that writes keep succeeding across several
+//   consecutive rollovers under sustained load.
+//
+// Testing:
+//   flushStorage (background creation of the next file set)
+//   rolloverIfNeeded
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const bsl::string k_LOCATION("./test-cluster123-6",
+                                 bmqtst::TestHelperUtil::allocator());
+    Tester            tester(k_LOCATION,
+                             TesterConfig().setNextFileSetCreationPercent(50));
+    mqbs::FileStore&  fs = tester.fileStore();
+
+    // Disable in-place callback execution in mock dispatcher to prevent
+    // thread races between the main thread (that modifies FileStore) and
+    // scheduler thread (that performs gc on FileStore).
+    tester.dispatcher().setEnqueueOnly(true);
+
+    int rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    if (rc) {
+        cout << "Failed to open partition, rc: " << rc << endl;
+        return;  // RETURN
+    }
+
+    // Set primary.
+    unsigned int primaryLeaseId = 1;
+    fs.setActivePrimary(tester.node(), primaryLeaseId);
+
+    // Create a storage and register it with the FileStore.
+    bmqt::Uri        queueUri("bmq://si.amw.bmq.stats/testQueue",
+                       bmqtst::TestHelperUtil::allocator());
+    mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                              "ABCDE");
+
+    mqbmock::Cluster mockCluster(bmqtst::TestHelperUtil::allocator());
+    mqbmock::Domain  mockDomain(&mockCluster,
+                               bmqtst::TestHelperUtil::allocator());
+    mqbconfm::Domain domainCfg(bmqtst::TestHelperUtil::allocator());
+    domainCfg.messageTtl() = bsl::numeric_limits<bsls::Types::Int64>::max();
+    domainCfg.storage().config().makeFileBacked();
+    bmqu::MemOutStream errDesc(bmqtst::TestHelperUtil::allocator());
+    mockDomain.configure(errDesc, domainCfg);
+
+    bsl::shared_ptr<mqbs::ReplicatedStorage> storage_sp;
+    fs.createStorage(&storage_sp, queueUri, queueKey, &mockDomain);
+
+    mqbconfm::Limits limits;
+    limits.messages() = bsl::numeric_limits<bsls::Types::Int64>::max();
+    limits.bytes()    = bsl::numeric_limits<bsls::Types::Int64>::max();
+    limits.messagesWatermarkRatio() = 0.8;
+    limits.bytesWatermarkRatio()    = 0.8;
+    storage_sp->configure(domainCfg.storage().config(),
+                          limits,
+                          domainCfg.messageTtl(),
+                          0);  // maxDeliveryAttempts
+
+    fs.registerStorage(storage_sp.get());
+
+    mqbmock::Queue mockQueue(&mockDomain, bmqtst::TestHelperUtil::allocator());
+    storage_sp->setQueue(&mockQueue);
+
+    mqbs::DataStoreRecordHandle queueHandle;
+    bsls::Types::Uint64         timestamp = bdlt::EpochUtil::convertToTimeT64(
+        bdlt::CurrentTime::utc());
+
+    rc = fs.writeQueueCreationRecord(&queueHandle,
+                                     queueUri,
+                                     queueKey,
+                                     AppInfos(),
+                                     timestamp,
+                                     true);  // isNewQueue
+    BMQTST_ASSERT_EQ(0, rc);
+
+    // Post batches of messages, purging the queue after each batch so that
+    // the outstanding bytes stay low and rollover is always possible.  End
+    // each batch the way the dispatcher does, by flushing the storage, which
+    // is where the next file set creation gets triggered.
+    StoragePoster poster(storage_sp, bmqtst::TestHelperUtil::allocator());
+
+    const int    k_NUM_ROLLOVERS   = 3;
+    const size_t k_BATCH_SIZE      = 100;
+    const size_t k_MAX_NUM_BATCHES = 2000;
+    int          numRollovers      = 0;
+    size_t       numBatches        = 0;
+    size_t       numFailedPuts     = 0;
+    bsl::string  preCreatedDataFile(bmqtst::TestHelperUtil::allocator());
+
+    mqbs::FileStoreSet fileSet(bmqtst::TestHelperUtil::allocator());
+    fs.loadCurrentFiles(&fileSet);
+    bsl::string activeDataFile(fileSet.dataFile(),
+                               bmqtst::TestHelperUtil::allocator());
+
+    while (numRollovers < k_NUM_ROLLOVERS && numBatches < k_MAX_NUM_BATCHES) {
+        ++numBatches;
+
+        for (size_t i = 0; i < k_BATCH_SIZE; ++i) {
+            if (poster.postMessage() != mqbi::StorageResult::e_SUCCESS) {
+                ++numFailedPuts;
+            }
+        }
+
+        storage_sp->removeAll(mqbu::StorageKey());
+        tester.dispatcher().processQueue();
+        fs.flushStorage();
+
+        // Let the background creation (and the gc of any rolled over file
+        // set) complete before looking at the files on disk.
+        tester.miscWorkThreadPool().drain();
+
+        fs.loadCurrentFiles(&fileSet);
+        if (fileSet.dataFile() != activeDataFile) {
+            // Rollover happened during this batch: it must have switched to
+            // the file set which was created in the background.
+            BMQTST_ASSERT_D(numRollovers, !preCreatedDataFile.empty());
+            BMQTST_ASSERT_EQ_D(numRollovers,
+                               fileSet.dataFile(),
+                               preCreatedDataFile);
+
+            activeDataFile = fileSet.dataFile();
+            preCreatedDataFile.clear();
+            ++numRollovers;
+        }
+
+        const bsl::string newest = newestDataFile(k_LOCATION);
+        if (newest != activeDataFile) {
+            // The next file set has been created in the background.
+            preCreatedDataFile = newest;
+        }
+    }
+
+    BMQTST_ASSERT_EQ(numRollovers, k_NUM_ROLLOVERS);
+    BMQTST_ASSERT_EQ(numFailedPuts, 0u);
+
+    // Close the partition.  Wait for background work from the rollovers
+    // (gcWorkerDispatched, deleteArchiveFilesCb) to finish.
+    tester.miscWorkThreadPool().drain();
+    tester.scheduler().cancelAllEventsAndWait();
+    tester.dispatcher().processQueue();
+    fs.unregisterStorage(storage_sp.get());
+    fs.close();
+    BMQTST_ASSERT_EQ(false, fs.isOpen());
+
+    // A pre-created file set which has not been rolled over to yet must not
+    // survive the close.
+    if (!preCreatedDataFile.empty()) {
+        BMQTST_ASSERT(!bdls::FilesystemUtil::exists(preCreatedDataFile));
+    }
+}
+
+static void test7_parallelRecovery()
+// ------------------------------------------------------------------------
+// PARALLEL RECOVERY
+//
+// Concerns:
+//   With 'recoveryParallelism' enabled, verify that the outstanding
+//   messages of a partition recovered from local storage are validated
+//   across threads, and that the partition recovers the same records as
+//   when they are validated on the dispatcher thread only.  The misc work
+//   thread pool has a single thread, as in the broker, which must not cap
+//   the parallelism of the validation.
+//
+// Testing:
+//   open (recovery of outstanding messages with 'recoveryParallelism')
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    // Enough messages for their validation to be split in several segments.
+    const size_t k_NUM_MSGS     = 12000;
+    const size_t k_PAYLOAD_SIZE = 100;
+
+    bsls::Types::Uint64 numRecoveredRecords[2] = {0, 0};
+    const int           k_PARALLELISM[2]       = {0, 4};
+
+    for (size_t i = 0; i < 2; ++i) {
+        Tester tester(
+            "./test-cluster123-7",
+            TesterConfig().setRecoveryParallelism(k_PARALLELISM[i]));
+        mqbs::FileStore& fs = tester.fileStore();
+
+        const bsls::Types::Uint64 numRecords =
+            populatePartition(&tester, k_NUM_MSGS, k_PAYLOAD_SIZE);
+        BMQTST_ASSERT_D(i, numRecords > k_NUM_MSGS);
+
+        const int rc = fs.open(0);
+        BMQTST_ASSERT_EQ_D(i, 0, rc);
+        BMQTST_ASSERT_EQ_D(i, fs.numRecords(), numRecords);
+
+        numRecoveredRecords[i] = fs.numRecords();
+        fs.close();
+    }
+
+    BMQTST_ASSERT_EQ(numRecoveredRecords[0], numRecoveredRecords[1]);
+}
+
+static void test8_recoveryFromCheckpoint()
+// ------------------------------------------------------------------------
+// RECOVERY FROM CHECKPOINT
+//
+// Concerns:
+//   With 'checkpointInterval' enabled, verify that a checkpoint of the
+//   journal is saved at regular sync points, and that recovering from it
+//   retrieves the same records as replaying the whole journal, which is
+//   still done when the checkpoint is missing or invalid.
+//
+// Plan:
+//   - Post messages, purge them, post more messages, issue a sync point
+//     taking a checkpoint, and post more messages, so that the checkpoint
+//     skips the purged messages and the tail of the journal is replayed.
+//   - Recover with the checkpoint, without it, and with a corrupted one.
+//
+// Testing:
+//   open (recovery from a checkpoint of the journal)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("RECOVERY FROM CHECKPOINT");
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const size_t k_NUM_MSGS = 500;
+
+    Tester tester("./test-cluster123-8",
+                  TesterConfig().setCheckpointInterval(1));
+    mqbs::FileStore& fs = tester.fileStore();
+
+    // Disable in-place callback execution in mock dispatcher, see
+    // 'populatePartition'.
+    tester.dispatcher().setEnqueueOnly(true);
+
+    int rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+
+    fs.setActivePrimary(tester.node(), 1);
+
+    // Let the checkpoint taken at the sync point issued above complete.
+    tester.miscWorkThreadPool().drain();
+    tester.dispatcher().processQueue();
+
+    bmqt::Uri        queueUri("bmq://si.amw.bmq.stats/testQueue",
+                       bmqtst::TestHelperUtil::allocator());
+    mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                              "ABCDE");
+
+    mqbmock::Cluster mockCluster(bmqtst::TestHelperUtil::allocator());
+    mqbmock::Domain  mockDomain(&mockCluster,
+                               bmqtst::TestHelperUtil::allocator());
+    mqbconfm::Domain domainCfg(bmqtst::TestHelperUtil::allocator());
+    domainCfg.messageTtl() = bsl::numeric_limits<bsls::Types::Int64>::max();
+    domainCfg.storage().config().makeFileBacked();
+    bmqu::MemOutStream errDesc(bmqtst::TestHelperUtil::allocator());
+    mockDomain.configure(errDesc, domainCfg);
+
+    bsl::shared_ptr<mqbs::ReplicatedStorage> storage_sp;
+    fs.createStorage(&storage_sp, queueUri, queueKey, &mockDomain);
+
+    mqbconfm::Limits limits;
+    limits.messages() = bsl::numeric_limits<bsls::Types::Int64>::max();
+    limits.bytes()    = bsl::numeric_limits<bsls::Types::Int64>::max();
+    limits.messagesWatermarkRatio() = 0.8;
+    limits.bytesWatermarkRatio()    = 0.8;
+    storage_sp->configure(domainCfg.storage().config(),
+                          limits,
+                          domainCfg.messageTtl(),
+                          0);  // maxDeliveryAttempts
+
+    fs.registerStorage(storage_sp.get());
+
+    mqbmock::Queue mockQueue(&mockDomain, bmqtst::TestHelperUtil::allocator());
+    storage_sp->setQueue(&mockQueue);
+
+    mqbs::DataStoreRecordHandle queueHandle;
+    bsls::Types::Uint64         timestamp = bdlt::EpochUtil::convertToTimeT64(
+        bdlt::CurrentTime::utc());
+    rc = fs.writeQueueCreationRecord(&queueHandle,
+                                     queueUri,
+                                     queueKey,
+                                     AppInfos(),
+                                     timestamp,
+                                     true);  // isNewQueue
+    BMQTST_ASSERT_EQ(0, rc);
+
+    StoragePoster poster(storage_sp, bmqtst::TestHelperUtil::allocator());
+    for (size_t i = 0; i < k_NUM_MSGS; ++i) {
+        BMQTST_ASSERT_EQ_D(i,
+                           poster.postMessage(),
+                           mqbi::StorageResult::e_SUCCESS);
+    }
+
+    BMQTST_ASSERT_EQ(storage_sp->removeAll(mqbu::StorageKey::k_NULL_KEY),
+                     mqbi::StorageResult::e_SUCCESS);
+
+    for (size_t i = 0; i < k_NUM_MSGS; ++i) {
+        BMQTST_ASSERT_EQ_D(i,
+                           poster.postMessage(),
+                           mqbi::StorageResult::e_SUCCESS);
+    }
+
+    BMQTST_ASSERT_EQ(0, fs.issueSyncPoint());
+    tester.miscWorkThreadPool().drain();
+    tester.dispatcher().processQueue();
+
+    for (size_t i = 0; i < k_NUM_MSGS; ++i) {
+        BMQTST_ASSERT_EQ_D(i,
+                           poster.postMessage(),
+                           mqbi::StorageResult::e_SUCCESS);
+    }
+
+    mqbs::FileStoreSet fileSet(bmqtst::TestHelperUtil::allocator());
+    fs.loadCurrentFiles(&fileSet);
+    bsl::string checkpointFile(bmqtst::TestHelperUtil::allocator());
+    mqbs::FileStoreUtil::createCheckpointFileName(&checkpointFile,
+                                                  fileSet.journalFile());
+
+    tester.miscWorkThreadPool().drain();
+    tester.scheduler().cancelAllEventsAndWait();
+    tester.dispatcher().processQueue();
+    fs.unregisterStorage(storage_sp.get());
+    fs.close();
+
+    // The checkpoint lists the messages posted after the purge, but neither
+    // the purged ones nor the ones posted after it.
+
+    mqbs::JournalCheckpoint checkpoint(bmqtst::TestHelperUtil::allocator());
+    rc = mqbs::JournalCheckpointUtil::load(
+        errDesc,
+        &checkpoint,
+        checkpointFile,
+        bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, rc);
+    BMQTST_ASSERT_GE(checkpoint.recordOffsets().size(), k_NUM_MSGS);
+    BMQTST_ASSERT_LT(checkpoint.recordOffsets().size(), 2 * k_NUM_MSGS);
+
+    PV("Recover from the checkpoint");
+    rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    const bsls::Types::Uint64 numRecords = fs.numRecords();
+    BMQTST_ASSERT_GT(numRecords, 2 * k_NUM_MSGS);
+    fs.close();
+    tester.miscWorkThreadPool().drain();
+
+    PV("Recover without checkpoint");
+    BMQTST_ASSERT_EQ(0, bdls::FilesystemUtil::remove(checkpointFile));
+    rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    BMQTST_ASSERT_EQ(fs.numRecords(), numRecords);
+    fs.close();
+    tester.miscWorkThreadPool().drain();
+
+    PV("Recover with an invalid checkpoint");
+    rc = mqbs::JournalCheckpointUtil::save(
+        errDesc,
+        checkpointFile,
+        checkpoint,
+        bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, rc);
+    {
+        bsl::fstream file(checkpointFile.c_str(),
+                          bsl::ios::in | bsl::ios::out | bsl::ios::binary);
+        file.seekp(8);  // Sync point offset
+        file.put('\x7f');
+    }
+    rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    BMQTST_ASSERT_EQ(fs.numRecords(), numRecords);
+    fs.close();
+}
+
+static void test9_replicaStats()
+// ------------------------------------------------------------------------
+// REPLICA STATS
+//
+// Concerns:
+//   1. The primary reports the Receipt time and the unreceipted bytes of
+//      each replica in a stat context per replica.
+//   2. A replica which never sends a Receipt is reported, and its
+//      unreceipted bytes are sampled by every snapshot, even without any
+//      activity.
+//   3. The receipt lag of each replica is reported in the summary.
+//   4. The stat contexts of the replicas are removed once self is no longer
+//      the primary.
+//
+// Testing:
+//   setActivePrimary
+//   processReceiptEvent
+//   loadSummary
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    typedef mqbstat::ClusterStats::Stat Stat;
+
+    const int k_NUM_NODES  = 3;
+    const int k_REPLICA_ID = k_NODE_ID + 1;
+    const int k_SILENT_ID  = k_NODE_ID + 2;
+    const int k_NUM_MSGS   = 10;
+
+    Tester tester("./test-cluster123-9",
+                  TesterConfig().setNumNodes(k_NUM_NODES));
+    mqbs::FileStore&             fs = tester.fileStore();
+    bslma::ManagedPtr<TestQueue> queue;
+    openGroupCommitPartition(&tester, &queue);
+
+    const bsl::string& replicaName =
+        tester.node(k_REPLICA_ID)->nodeDescription();
+    const bsl::string& silentName =
+        tester.node(k_SILENT_ID)->nodeDescription();
+
+    StoragePoster poster(queue->storage(),
+                         bmqtst::TestHelperUtil::allocator(),
+                         10,      // payloadSize
+                         false);  // hasReceipt
+    for (int i = 0; i < k_NUM_MSGS; ++i) {
+        BMQTST_ASSERT_EQ_D(i,
+                           poster.postMessage(),
+                           mqbi::StorageResult::e_SUCCESS);
+    }
+    fs.flushStorage();
+
+    // Only one replica confirms what was replicated.
+    bslmt::ThreadUtil::microSleep(1000);
+    fs.processReceiptEvent(1,  // primaryLeaseId
+                           fs.sequenceNumber(),
+                           tester.node(k_REPLICA_ID));
+
+    tester.snapshotStats();
+
+    const bmqst::StatContext& partitionContext = tester.partitionStatContext();
+    BMQTST_ASSERT_EQ(partitionContext.numSubcontexts(), k_NUM_NODES - 1);
+
+    const bmqst::StatContext* replicaContext = partitionContext.getSubcontext(
+        replicaName);
+    const bmqst::StatContext* silentContext = partitionContext.getSubcontext(
+        silentName);
+    BMQTST_ASSERT(replicaContext);
+    BMQTST_ASSERT(silentContext);
+    if (!replicaContext || !silentContext) {
+        closeGroupCommitPartition(&tester, &queue);
+        return;  // RETURN
+    }
+
+    BMQTST_ASSERT_GT(mqbstat::ClusterStats::getValue(
+                         *replicaContext,
+                         0,
+                         Stat::e_PARTITION_REPLICA_RECEIPT_TIME_NS_MAX),
+                     0);
+    BMQTST_ASSERT_EQ(mqbstat::ClusterStats::getValue(
+                         *silentContext,
+                         0,
+                         Stat::e_PARTITION_REPLICA_RECEIPT_TIME_NS_MAX),
+                     0);
+
+    const bsls::Types::Int64 silentBytes = mqbstat::ClusterStats::getValue(
+        *silentContext,
+        0,
+        Stat::e_PARTITION_REPLICA_UNRECEIPTED_BYTES_MAX);
+    BMQTST_ASSERT_GT(silentBytes, 0);
+
+    // Nothing happens between the snapshots: the unreceipted bytes are still
+    // reported.
+    tester.snapshotStats();
+
+    BMQTST_ASSERT_EQ(mqbstat::ClusterStats::getValue(
+                         *replicaContext,
+                         0,
+                         Stat::e_PARTITION_REPLICA_UNRECEIPTED_BYTES_MAX),
+                     0);
+    BMQTST_ASSERT_EQ(mqbstat::ClusterStats::getValue(
+                         *silentContext,
+                         0,
+                         Stat::e_PARTITION_REPLICA_UNRECEIPTED_BYTES_MAX),
+                     silentBytes);
+
+    mqbcmd::FileStore summary(bmqtst::TestHelperUtil::allocator());
+    fs.loadSummary(&summary);
+
+    const bsl::vector<mqbcmd::ReplicaStatus>& replicas =
+        summary.summary().replicas();
+    BMQTST_ASSERT_EQ(replicas.size(), static_cast<size_t>(k_NUM_NODES - 1));
+    for (size_t i = 0; i < replicas.size(); ++i) {
+        const mqbcmd::ReplicaStatus& status = replicas[i];
+        if (status.nodeDescription() == silentName) {
+            BMQTST_ASSERT_EQ_D(
+                i,
+                static_cast<bsls::Types::Int64>(status.unreceiptedBytes()),
+                silentBytes);
+            BMQTST_ASSERT_GT_D(i, status.receiptLagNanoseconds(), 0);
+        }
+        else {
+            BMQTST_ASSERT_EQ_D(i, status.nodeDescription(), replicaName);
+            BMQTST_ASSERT_EQ_D(i, status.unreceiptedBytes(), 0u);
+            BMQTST_ASSERT_EQ_D(i, status.receiptLagNanoseconds(), 0);
+        }
+    }
+
+    // Another node becomes the primary: the replicas are no longer reported.
+    fs.setActivePrimary(tester.node(k_REPLICA_ID), 2);  // primaryLeaseId
+    tester.snapshotStats();
+    BMQTST_ASSERT_EQ(partitionContext.numSubcontexts(), 0);
+
+    closeGroupCommitPartition(&tester, &queue);
+}
+
+static void testN1_recoveryPerformance()
+// ------------------------------------------------------------------------
+// RECOVERY PERFORMANCE
+//
+// Concerns:
+//   Measure how long it takes to recover a partition from local storage
+//   depending on 'recoveryParallelism'.
+//
+// Plan:
+//   - For each parallelism, populate a partition with outstanding
+//     messages, then time re-opening it, which recovers them.  Note that
+//     the files are likely still in the page cache.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("RECOVERY PERFORMANCE");
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const size_t k_NUM_MSGS        = 14000;
+    const size_t k_PAYLOAD_SIZE    = 4096;
+    const int    k_PARALLELISM[]   = {1, 2, 4};
+    const size_t k_NUM_PARALLELISM = sizeof(k_PARALLELISM) /
+                                     sizeof(*k_PARALLELISM);
+
+    for (size_t i = 0; i < k_NUM_PARALLELISM; ++i) {
+        Tester tester(
+            "./test-cluster123-N1",
+            TesterConfig().setRecoveryParallelism(k_PARALLELISM[i]));
+        mqbs::FileStore& fs = tester.fileStore();
+
+        populatePartition(&tester, k_NUM_MSGS, k_PAYLOAD_SIZE);
+
+        const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+        const int                rc    = fs.open(0);
+        const bsls::Types::Int64 end   = bsls::TimeUtil::getTimer();
+        BMQTST_ASSERT_EQ_D(i, 0, rc);
+
+        cout << "Recovered " << fs.numRecords() << " records ("
+             << k_NUM_MSGS << " messages of " << k_PAYLOAD_SIZE
+             << " bytes) with a parallelism of " << k_PARALLELISM[i]
+             << " in " << bmqu::PrintUtil::prettyTimeInterval(end - begin)
+             << ".\n";
+
+        fs.close();
+    }
+}
+
+static void testN2_replicationBatchingPerformance()
+// ------------------------------------------------------------------------
+// REPLICATION BATCHING PERFORMANCE
+//
+// Concerns:
+//   Compare the throughput and replication latency of a partition whose
+//   primary sends a batch every fixed number of messages with those of a
+//   partition whose primary adapts batches to a latency budget.
+//
+// Plan:
+//   - For each message rate and each batching policy, replicate messages
+//     over an in-process partition of three nodes exchanging storage
+//     events and Receipts over test channels.  The primary flushes its
+//     storage every 1000 messages, as its dispatcher would when finding
+//     its queue empty under load.  Latency is measured from the posting of
+//     a message to the primary receiving its Receipt from a replica, which
+//     includes the processing by the replicas on the same thread.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("REPLICATION BATCHING PERFORMANCE");
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const size_t             k_NUM_MSGS       = 10000;
+    const int                k_BUDGETS_US[]   = {0, 100, 1000};
+    const bsls::Types::Int64 k_INTERVALS_NS[] = {0, 1000, 10000, 100000};
+    const size_t k_NUM_BUDGETS = sizeof(k_BUDGETS_US) / sizeof(*k_BUDGETS_US);
+    const size_t k_NUM_INTERVALS = sizeof(k_INTERVALS_NS) /
+                                   sizeof(*k_INTERVALS_NS);
+
+    for (size_t i = 0; i < k_NUM_INTERVALS; ++i) {
+        for (size_t j = 0; j < k_NUM_BUDGETS; ++j) {
+            measureReplication(k_BUDGETS_US[j],
+                               k_INTERVALS_NS[i],
+                               k_NUM_MSGS);
+        }
+    }
+}
+
+static void testN3_replicationCpuCost()
+// ------------------------------------------------------------------------
+// REPLICATION CPU COST
+//
+// Concerns:
+//   Measure the CPU spent by the primary per GB of replicated messages.
+//   Replicated records are not copied into the storage events, which
+//   refer to the mapped files instead: report what copying the payloads
+//   would add for comparison.
+//
+// Plan:
+//   - Post messages to the primary of a partition of two nodes, purging
+//     the queue and flushing the storage every 100 messages, and discard
+//     the storage events written to the channel to the replica.  Measure
+//     the process CPU time (which includes posting the messages and the
+//     channel thread) per GB of storage events written.
+//   - Measure the CPU time to copy the same payloads into blobs.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("REPLICATION CPU COST");
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const size_t              k_PAYLOAD_SIZE = 64 * 1024;
+    const size_t              k_NUM_MSGS     = 16 * 1024;  // 1 GB
+    const size_t              k_BATCH_SIZE   = 100;
+    const bsls::Types::Uint64 k_GB           = 1024 * 1024 * 1024;
+
+    Tester           tester("./test-cluster123-N3",
+                            TesterConfig().setNumNodes(2));
+    mqbs::FileStore& fs = tester.fileStore();
+
+    // Disable in-place callback execution in mock dispatcher to prevent
+    // thread races between the main thread (that modifies FileStore) and
+    // scheduler thread (that performs gc on FileStore).
+    tester.dispatcher().setEnqueueOnly(true);
+
+    int rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    if (rc) {
+        cout << "Failed to open partition, rc: " << rc << endl;
+        return;  // RETURN
+    }
+
+    fs.setActivePrimary(tester.node(k_NODE_ID), 1);
+
+    bsls::Types::Uint64 replicatedBytes = 0;
+    bsls::Types::Int64  cpuTime         = 0;
+    {
+        TestQueue queue(&fs);
+
+        mqbs::DataStoreRecordHandle queueHandle;
+        rc = fs.writeQueueCreationRecord(
+            &queueHandle,
+            TestQueue::uri(),
+            TestQueue::key(),
+            AppInfos(),
+            bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+            true);  // isNewQueue
+        BMQTST_ASSERT_EQ(0, rc);
+
+        StoragePoster       poster(queue.storage(),
+                             bmqtst::TestHelperUtil::allocator(),
+                             k_PAYLOAD_SIZE);
+        bmqio::TestChannel& toReplica = tester.channel(k_NODE_ID + 1);
+
+        bsls::Types::Int64 systemBegin;
+        bsls::Types::Int64 userBegin;
+        bsls::TimeUtil::getProcessTimers(&systemBegin, &userBegin);
+
+        for (size_t i = 0; i < k_NUM_MSGS; ++i) {
+            BMQTST_ASSERT_EQ_D(i,
+                               poster.postMessage(),
+                               mqbi::StorageResult::e_SUCCESS);
+
+            if (0 == (i + 1) % k_BATCH_SIZE || i + 1 == k_NUM_MSGS) {
+                queue.storage()->removeAll(mqbu::StorageKey());
+                tester.dispatcher().processQueue();
+                fs.flushStorage();
+                tester.miscWorkThreadPool().drain();
+            }
+
+            while (0 != toReplica.numWriteCalls()) {
+                replicatedBytes += toReplica.popWriteCall().d_blob.length();
+            }
+        }
+
+        // Let the channel thread write the last events.
+        while (toReplica.waitFor(1, bsls::TimeInterval(0.1))) {
+            replicatedBytes += toReplica.popWriteCall().d_blob.length();
+        }
+
+        bsls::Types::Int64 systemEnd;
+        bsls::Types::Int64 userEnd;
+        bsls::TimeUtil::getProcessTimers(&systemEnd, &userEnd);
+        cpuTime = (systemEnd - systemBegin) + (userEnd - userBegin);
+
+        tester.miscWorkThreadPool().drain();
+        tester.scheduler().cancelAllEventsAndWait();
+        tester.dispatcher().processQueue();
+    }
+    fs.close();
+
+    // Baseline: copy the same payloads into blobs, as replication would if
+    // the storage events did not refer to the mapped files.
+
+    bsls::Types::Int64 copyTime = 0;
+    {
+        bdlbb::PooledBlobBufferFactory bufferFactory(
+            4 * 1024,
+            bmqtst::TestHelperUtil::allocator());
+        const bsl::string payload(k_PAYLOAD_SIZE,
+                                  'x',
+                                  bmqtst::TestHelperUtil::allocator());
+
+        bsls::Types::Int64 systemBegin;
+        bsls::Types::Int64 userBegin;
+        bsls::TimeUtil::getProcessTimers(&systemBegin, &userBegin);
+
+        for (size_t i = 0; i < k_NUM_MSGS; ++i) {
+            bdlbb::Blob blob(&bufferFactory,
+                             bmqtst::TestHelperUtil::allocator());
+            bdlbb::BlobUtil::append(&blob,
+                                    payload.data(),
+                                    static_cast<int>(payload.length()));
+        }
+
+        bsls::Types::Int64 systemEnd;
+        bsls::Types::Int64 userEnd;
+        bsls::TimeUtil::getProcessTimers(&systemEnd, &userEnd);
+        copyTime = (systemEnd - systemBegin) + (userEnd - userBegin);
+    }
+
+    BMQTST_ASSERT_GE(replicatedBytes, k_NUM_MSGS * k_PAYLOAD_SIZE);
+    if (0 == replicatedBytes) {
+        return;  // RETURN
+    }
+
+    const double numGB = static_cast<double>(replicatedBytes) / k_GB;
+    cout << "Replicated "
+         << bmqu::PrintUtil::prettyBytes(
+                static_cast<bsls::Types::Int64>(replicatedBytes))
+         << " (" << k_NUM_MSGS << " messages of " << k_PAYLOAD_SIZE
+         << " bytes) using "
+         << bmqu::PrintUtil::prettyTimeInterval(
+                static_cast<bsls::Types::Int64>(cpuTime / numGB))
+         << " of CPU per GB.  Copying the payloads would add "
+         << bmqu::PrintUtil::prettyTimeInterval(
+                static_cast<bsls::Types::Int64>(copyTime / numGB))
+         << " per GB.\n";
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -1288,10 +2910,18 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 9: test9_replicaStats(); break;
+    case 8: test8_recoveryFromCheckpoint(); break;
+    case 7: test7_parallelRecovery(); break;
+    case 6: test6_rolloverUnderLoad(); break;
+    case 5: test5_groupCommit(); break;
     case 4: test4_recoverMessagesAcrossLeaseIds(); break;
     case 3: test3_partitionFullAlarm(); break;
     case 2: test2_printTest(); break;
     case 1: test1_breathingTest(); break;
+    case -1: testN1_recoveryPerformance(); break;
+    case -2: testN2_replicationBatchingPerformance(); break;
+    case -3: testN3_replicationCpuCost(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
@@ -80,6 +80,7 @@ const int FileStoreProtocol::k_VERSION;
 const char* FileStoreProtocol::k_DATA_FILE_EXTENSION(".bmq_data");
 const char* FileStoreProtocol::k_JOURNAL_FILE_EXTENSION(".bmq_journal");
 const char* FileStoreProtocol::k_QLIST_FILE_EXTENSION(".bmq_qlist");
+const char* FileStoreProtocol::k_CHECKPOINT_FILE_EXTENSION(".bmq_checkpoint");
 const char* FileStoreProtocol::k_COMMON_FILE_EXTENSION_PREFIX(".bmq_");
 const char* FileStoreProtocol::k_COMMON_FILE_PREFIX("bmq_");
 
@@ -183,6 +183,10 @@ struct FileStoreProtocol {
 
     static const char* k_QLIST_FILE_EXTENSION;
 
+    /// Extension of the checkpoint file written alongside a journal file.
+    /// See `mqbs::JournalCheckpoint`.
+    static const char* k_CHECKPOINT_FILE_EXTENSION;
+
     static const char* k_COMMON_FILE_EXTENSION_PREFIX;
 
     static const char* k_COMMON_FILE_PREFIX;
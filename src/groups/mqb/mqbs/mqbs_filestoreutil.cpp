@@ -263,6 +263,12 @@ int FileStoreUtil::findFileStoreSetsFromPaths(
         // size
         for (bsl::vector<bsl::string>::size_type i = 0; i < files.size();
              ++i) {
+            if (isCheckpointFile(files[i])) {
+                // Checkpoint files are not part of the file set, and are
+                // looked up from the journal file name when needed.
+                continue;  // CONTINUE
+            }
+
             bsl::string timestamp;
             localRC = extractTimestamp(&timestamp, files[i]);
             if (localRC != 0) {
@@ -304,6 +310,12 @@ int FileStoreUtil::findFileStoreSetsFromPaths(
         // For every file in the output, populate only the file name
         for (bsl::vector<bsl::string>::size_type i = 0; i < files.size();
              ++i) {
+            if (isCheckpointFile(files[i])) {
+                // Checkpoint files are not part of the file set, and are
+                // looked up from the journal file name when needed.
+                continue;  // CONTINUE
+            }
+
             bsl::string timestamp;
             localRC = extractTimestamp(&timestamp, files[i]);
             if (localRC != 0) {
@@ -407,6 +419,23 @@ void FileStoreUtil::createQlistFileName(bsl::string*             filename,
                    FileStoreProtocol::k_QLIST_FILE_EXTENSION);
 }
 
+void FileStoreUtil::createCheckpointFileName(bsl::string*     filename,
+                                             bsl::string_view journalFileName)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(filename);
+
+    filename->assign(journalFileName.data(), journalFileName.length());
+    if (bmqu::StringUtil::endsWith(
+            *filename,
+            FileStoreProtocol::k_JOURNAL_FILE_EXTENSION)) {
+        filename->resize(filename->length() -
+                         bsl::strlen(
+                             FileStoreProtocol::k_JOURNAL_FILE_EXTENSION));
+    }
+    filename->append(FileStoreProtocol::k_CHECKPOINT_FILE_EXTENSION);
+}
+
 bool FileStoreUtil::hasDataFileExtension(const bsl::string& filename)
 {
     return bmqu::StringUtil::endsWith(
@@ -428,6 +457,12 @@ bool FileStoreUtil::hasQlistFileExtension(const bsl::string& filename)
         FileStoreProtocol::k_QLIST_FILE_EXTENSION);
 }
 
+bool FileStoreUtil::isCheckpointFile(const bsl::string& filename)
+{
+    return bsl::string::npos !=
+           filename.find(FileStoreProtocol::k_CHECKPOINT_FILE_EXTENSION);
+}
+
 int FileStoreUtil::createFilePattern(bsl::string*             pattern,
                                      const bslstl::StringRef& basePath,
                                      int                      partitionId)
@@ -840,6 +875,21 @@ int FileStoreUtil::archiveFileSet(bsl::string_view dataFile,
     BALL_LOG_INFO << "Archived journal file [" << journalFile
                   << "] to location [" << archiveLocation << "]";
 
+    // The checkpoint of an archived journal is never used, so remove it
+    // instead of archiving it.
+
+    bsl::string checkpointFile;
+    createCheckpointFileName(&checkpointFile, journalFile);
+    if (bdls::FilesystemUtil::exists(checkpointFile)) {
+        rc = bdls::FilesystemUtil::remove(checkpointFile);
+        if (0 != rc) {
+            // Not a failure to archive the file set.
+
+            BALL_LOG_WARN << "Failed to remove checkpoint file ["
+                          << checkpointFile << "], rc: " << rc;
+        }
+    }
+
     if (qlistAware) {
         rc = FileSystemUtil::move(qlistFile, archiveLocation);
         if (0 != rc) {
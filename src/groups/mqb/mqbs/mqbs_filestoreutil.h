@@ -126,6 +126,12 @@ struct FileStoreUtil {
                                     int                      partitionId,
                                     const bdlt::Datetime&    datetime);
 
+    /// Populate the specified `filename` with the name of the checkpoint
+    /// file written alongside the journal file having the specified
+    /// `journalFileName`.
+    static void createCheckpointFileName(bsl::string*     filename,
+                                         bsl::string_view journalFileName);
+
     static bool hasDataFileExtension(const bsl::string& filename);
     static bool hasJournalFileExtension(const bsl::string& filename);
 
@@ -133,6 +139,10 @@ struct FileStoreUtil {
     /// (data, journal or qlist respectively) extension.
     static bool hasQlistFileExtension(const bsl::string& filename);
 
+    /// Return true if the specified `filename` is a journal checkpoint file,
+    /// or a temporary file used while writing one, and false otherwise.
+    static bool isCheckpointFile(const bsl::string& filename);
+
     /// Populate the specified `pattern` with a string pattern which can be
     /// used to search BlazingMQ files belonging to the specified
     /// `partitionId` located at the specified `basePath` location.  Return
@@ -202,8 +212,8 @@ struct FileStoreUtil {
 
     /// Move the specified `dataFile` and `journalFile` (and optionally
     /// `qlistFile` if the specified `qlistAware` is true) to the specified
-    /// `archiveLocation` directory.  Return zero on success, non-zero value
-    /// otherwise.
+    /// `archiveLocation` directory, and remove the checkpoint file of the
+    /// journal, if any.  Return zero on success, non-zero value otherwise.
     static int archiveFileSet(bsl::string_view dataFile,
                               bsl::string_view journalFile,
                               bsl::string_view qlistFile,
@@ -211,8 +221,9 @@ struct FileStoreUtil {
                               bool             qlistAware = true);
 
     /// Move the data, journal, and qlist files if `qlistAware` is true, from
-    /// the specified `fileSet` to the specified `archiveLocation` directory.
-    /// Return zero on success, non-zero value otherwise.
+    /// the specified `fileSet` to the specified `archiveLocation` directory,
+    /// and remove the checkpoint file of the journal, if any.  Return zero
+    /// on success, non-zero value otherwise.
     static int archiveFileSet(const FileStoreSet& fileSet,
                               bsl::string_view    archiveLocation,
                               bool                qlistAware = true);
@@ -665,6 +665,27 @@ int FileSystemUtil::flush(void*               mapping,
     return rc_SUCCESS;
 }
 
+int FileSystemUtil::flushRange(void*               mapping,
+                               bsls::Types::Uint64 offset,
+                               bsls::Types::Uint64 length,
+                               bsl::ostream&       errorDescription)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(mapping);
+
+    if (0 == length) {
+        return 0;  // RETURN
+    }
+
+    // 'msync' requires a page-aligned address.
+    const bsls::Types::Uint64 pageSize = ::sysconf(_SC_PAGESIZE);
+    const bsls::Types::Uint64 begin    = offset - offset % pageSize;
+
+    return flush(static_cast<char*>(mapping) + begin,
+                 offset + length - begin,
+                 errorDescription);
+}
+
 void FileSystemUtil::disableDump(BSLA_MAYBE_UNUSED void* mapping,
                                  BSLA_MAYBE_UNUSED bsls::Types::Uint64 size)
 {
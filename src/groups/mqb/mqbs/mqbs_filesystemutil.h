@@ -151,6 +151,16 @@ struct FileSystemUtil {
                      bsls::Types::Uint64 size,
                      bsl::ostream&       errorDescription);
 
+    /// Flush the memory-mapped `mapping` segment in the range starting at the
+    /// specified `offset` and having the specified `length`, extended
+    /// backwards to the start of the enclosing page.  Return zero on success,
+    /// a non-zero value otherwise with specified `errorDescription`
+    /// containing a detailed error.
+    static int flushRange(void*               mapping,
+                          bsls::Types::Uint64 offset,
+                          bsls::Types::Uint64 length,
+                          bsl::ostream&       errorDescription);
+
     /// Indicate to the OS not to dump the specified `mapping` of the
     /// specified `size` to file.  Note that this method only has effect if
     /// on Linux and the `MADV_DONTDUMP` flag is defined.
@@ -0,0 +1,538 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbs_journalcheckpoint.h>
+
+#include <mqbscm_version.h>
+// MQB
+#include <mqbs_filestoreprotocol.h>
+#include <mqbs_mappedfiledescriptor.h>
+#include <mqbs_offsetptr.h>
+
+// BMQ
+#include <bmqp_crc32c.h>
+#include <bmqp_protocol.h>
+
+// BDE
+#include <bdlb_bigendian.h>
+#include <bdlb_scopeexit.h>
+#include <bdlf_bind.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bslim_printer.h>
+#include <bsls_assert.h>
+
+// SYSTEM
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+namespace {
+
+// CONSTANTS
+
+/// Magic word identifying a checkpoint file ("BMQC").
+const unsigned int k_MAGIC = 0x424D5143;
+
+/// Version of the checkpoint file layout.
+const unsigned int k_VERSION = 1;
+
+/// Size of the fixed-length header of a checkpoint file.
+const bsls::Types::Uint64 k_HEADER_SIZE = 40;
+
+/// Size of each (primary lease id, highest sequence number) pair.
+const bsls::Types::Uint64 k_LEASE_ID_SEQ_NUM_SIZE = 12;
+
+/// Size of each record offset, stored in words.
+const bsls::Types::Uint64 k_RECORD_OFFSET_SIZE = 4;
+
+/// Size of the trailing CRC32-C.
+const bsls::Types::Uint64 k_CRC_SIZE = 4;
+
+/// Maximum number of bytes read or written by a single system call.
+const bsls::Types::Uint64 k_MAX_IO_SIZE = 1 << 30;
+
+// UTILITY FUNCTIONS
+
+/// Append the specified `value` to the specified `buffer` in network byte
+/// order.
+void appendUint32(bsl::vector<char>* buffer, unsigned int value)
+{
+    const bdlb::BigEndianUint32 bigEndian = bdlb::BigEndianUint32::make(value);
+    const char* begin = reinterpret_cast<const char*>(&bigEndian);
+    buffer->insert(buffer->end(), begin, begin + sizeof(bigEndian));
+}
+
+/// Append the specified `value` to the specified `buffer` in network byte
+/// order.
+void appendUint64(bsl::vector<char>* buffer, bsls::Types::Uint64 value)
+{
+    const bdlb::BigEndianUint64 bigEndian = bdlb::BigEndianUint64::make(value);
+    const char* begin = reinterpret_cast<const char*>(&bigEndian);
+    buffer->insert(buffer->end(), begin, begin + sizeof(bigEndian));
+}
+
+/// Return the value stored in network byte order at the specified `data`.
+unsigned int readUint32(const char* data)
+{
+    bdlb::BigEndianUint32 bigEndian;
+    bsl::memcpy(&bigEndian, data, sizeof(bigEndian));
+    return bigEndian;
+}
+
+/// Return the value stored in network byte order at the specified `data`.
+bsls::Types::Uint64 readUint64(const char* data)
+{
+    bdlb::BigEndianUint64 bigEndian;
+    bsl::memcpy(&bigEndian, data, sizeof(bigEndian));
+    return bigEndian;
+}
+
+/// Return true if the journal having the specified `journal` file descriptor
+/// has a valid record at the specified `offset`, given the specified
+/// `recordSize`, and false otherwise.
+bool isValidRecord(const MappedFileDescriptor& journal,
+                   bsls::Types::Uint64         offset,
+                   unsigned int                recordSize)
+{
+    const OffsetPtr<const RecordHeader> recHeader(journal.block(), offset);
+    if (RecordType::e_UNDEFINED == recHeader->type() ||
+        0 == recHeader->primaryLeaseId() ||
+        0 == recHeader->sequenceNumber()) {
+        return false;  // RETURN
+    }
+
+    const OffsetPtr<const bdlb::BigEndianUint32> magic(
+        journal.block(),
+        offset + recordSize - sizeof(bdlb::BigEndianUint32));
+    return RecordHeader::k_MAGIC == *magic;
+}
+
+}  // close unnamed namespace
+
+// -----------------------
+// class JournalCheckpoint
+// -----------------------
+
+// CREATORS
+JournalCheckpoint::JournalCheckpoint(bslma::Allocator* allocator)
+: d_syncPointOffset(0)
+, d_syncPointPrimaryLeaseId(0)
+, d_syncPointSequenceNumber(0)
+, d_highestSeqNums(allocator)
+, d_recordOffsets(allocator)
+{
+    // NOTHING
+}
+
+JournalCheckpoint::JournalCheckpoint(const JournalCheckpoint& other,
+                                     bslma::Allocator*        allocator)
+: d_syncPointOffset(other.d_syncPointOffset)
+, d_syncPointPrimaryLeaseId(other.d_syncPointPrimaryLeaseId)
+, d_syncPointSequenceNumber(other.d_syncPointSequenceNumber)
+, d_highestSeqNums(other.d_highestSeqNums, allocator)
+, d_recordOffsets(other.d_recordOffsets, allocator)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+void JournalCheckpoint::reset()
+{
+    d_syncPointOffset         = 0;
+    d_syncPointPrimaryLeaseId = 0;
+    d_syncPointSequenceNumber = 0;
+    d_highestSeqNums.clear();
+    d_recordOffsets.clear();
+}
+
+// ACCESSORS
+bsl::ostream& JournalCheckpoint::print(bsl::ostream& stream,
+                                       int           level,
+                                       int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;  // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("syncPointOffset", syncPointOffset());
+    printer.printAttribute("syncPointPrimaryLeaseId",
+                           syncPointPrimaryLeaseId());
+    printer.printAttribute("syncPointSequenceNumber",
+                           syncPointSequenceNumber());
+    printer.printAttribute("numHighestSeqNums", highestSeqNums().size());
+    printer.printAttribute("numRecordOffsets", recordOffsets().size());
+    printer.end();
+
+    return stream;
+}
+
+// ----------------------------
+// struct JournalCheckpointUtil
+// ----------------------------
+
+// CLASS METHODS
+int JournalCheckpointUtil::save(bsl::ostream&            errorDescription,
+                                const bsl::string&       fileName,
+                                const JournalCheckpoint& checkpoint,
+                                bslma::Allocator*        allocator)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS        = 0,
+        rc_OPEN_FAILURE   = -1,
+        rc_WRITE_FAILURE  = -2,
+        rc_SYNC_FAILURE   = -3,
+        rc_RENAME_FAILURE = -4
+    };
+
+    const JournalCheckpoint::HighestSeqNums& highestSeqNums =
+        checkpoint.highestSeqNums();
+    const JournalCheckpoint::RecordOffsets& recordOffsets =
+        checkpoint.recordOffsets();
+
+    bsl::vector<char> buffer(allocator);
+    buffer.reserve(k_HEADER_SIZE +
+                   highestSeqNums.size() * k_LEASE_ID_SEQ_NUM_SIZE +
+                   recordOffsets.size() * k_RECORD_OFFSET_SIZE + k_CRC_SIZE);
+
+    appendUint32(&buffer, k_MAGIC);
+    appendUint32(&buffer, k_VERSION);
+    appendUint64(&buffer, checkpoint.syncPointOffset());
+    appendUint32(&buffer, checkpoint.syncPointPrimaryLeaseId());
+    appendUint32(&buffer, static_cast<unsigned int>(highestSeqNums.size()));
+    appendUint64(&buffer, checkpoint.syncPointSequenceNumber());
+    appendUint64(&buffer, recordOffsets.size());
+    BSLS_ASSERT_SAFE(k_HEADER_SIZE == buffer.size());
+
+    for (JournalCheckpoint::HighestSeqNums::const_iterator cit =
+             highestSeqNums.cbegin();
+         cit != highestSeqNums.cend();
+         ++cit) {
+        appendUint32(&buffer, cit->first);
+        appendUint64(&buffer, cit->second);
+    }
+
+    for (JournalCheckpoint::RecordOffsets::const_iterator cit =
+             recordOffsets.cbegin();
+         cit != recordOffsets.cend();
+         ++cit) {
+        BSLS_ASSERT_SAFE(0 == *cit % bmqp::Protocol::k_WORD_SIZE);
+        appendUint32(&buffer,
+                     static_cast<unsigned int>(*cit /
+                                               bmqp::Protocol::k_WORD_SIZE));
+    }
+
+    appendUint32(&buffer,
+                 bmqp::Crc32c::calculate(
+                     buffer.data(),
+                     static_cast<unsigned int>(buffer.size())));
+
+    // Write to a temporary file first, and rename it only once it has been
+    // synced to disk, so that a crash never leaves a partial checkpoint
+    // behind.
+
+    bsl::string tmpFileName(fileName, allocator);
+    tmpFileName.append(".tmp");
+
+    int fd = ::open(tmpFileName.c_str(),
+                    O_CREAT | O_TRUNC | O_WRONLY,
+                    S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fd < 0) {
+        errorDescription << "Failed to open file [" << tmpFileName
+                         << "], errno: " << errno << " ("
+                         << bsl::strerror(errno) << ")";
+        return rc_OPEN_FAILURE;  // RETURN
+    }
+
+    bdlb::ScopeExitAny guard(bdlf::BindUtil::bind(::close, fd));
+
+    bsls::Types::Uint64 numWritten = 0;
+    while (numWritten < buffer.size()) {
+        const ssize_t rc = ::write(
+            fd,
+            buffer.data() + numWritten,
+            bsl::min(buffer.size() - numWritten, k_MAX_IO_SIZE));
+        if (rc < 0) {
+            if (EINTR == errno) {
+                continue;  // CONTINUE
+            }
+
+            errorDescription << "Failed to write file [" << tmpFileName
+                             << "], errno: " << errno << " ("
+                             << bsl::strerror(errno) << ")";
+            ::unlink(tmpFileName.c_str());
+            return rc_WRITE_FAILURE;  // RETURN
+        }
+        numWritten += rc;
+    }
+
+    if (0 != ::fsync(fd)) {
+        errorDescription << "Failed to sync file [" << tmpFileName
+                         << "], errno: " << errno << " ("
+                         << bsl::strerror(errno) << ")";
+        ::unlink(tmpFileName.c_str());
+        return rc_SYNC_FAILURE;  // RETURN
+    }
+
+    if (0 != ::rename(tmpFileName.c_str(), fileName.c_str())) {
+        errorDescription << "Failed to rename file [" << tmpFileName
+                         << "] to [" << fileName << "], errno: " << errno
+                         << " (" << bsl::strerror(errno) << ")";
+        ::unlink(tmpFileName.c_str());
+        return rc_RENAME_FAILURE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int JournalCheckpointUtil::load(bsl::ostream&      errorDescription,
+                                JournalCheckpoint* checkpoint,
+                                const bsl::string& fileName,
+                                bslma::Allocator*  allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(checkpoint);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_NOT_FOUND           = 1,
+        rc_SUCCESS             = 0,
+        rc_OPEN_FAILURE        = -1,
+        rc_READ_FAILURE        = -2,
+        rc_TRUNCATED_FILE      = -3,
+        rc_CRC_MISMATCH        = -4,
+        rc_INVALID_MAGIC       = -5,
+        rc_UNSUPPORTED_VERSION = -6,
+        rc_SIZE_MISMATCH       = -7
+    };
+
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) {
+        if (ENOENT == errno) {
+            return rc_NOT_FOUND;  // RETURN
+        }
+
+        errorDescription << "Failed to open file [" << fileName
+                         << "], errno: " << errno << " ("
+                         << bsl::strerror(errno) << ")";
+        return rc_OPEN_FAILURE;  // RETURN
+    }
+
+    bdlb::ScopeExitAny guard(bdlf::BindUtil::bind(::close, fd));
+
+    struct stat fileStat;
+    if (0 != ::fstat(fd, &fileStat)) {
+        errorDescription << "Failed to stat file [" << fileName
+                         << "], errno: " << errno << " ("
+                         << bsl::strerror(errno) << ")";
+        return rc_READ_FAILURE;  // RETURN
+    }
+
+    const bsls::Types::Uint64 fileSize = fileStat.st_size;
+    if (fileSize < k_HEADER_SIZE + k_CRC_SIZE) {
+        errorDescription << "File [" << fileName << "] is too small ("
+                         << fileSize << " bytes) to contain a checkpoint";
+        return rc_TRUNCATED_FILE;  // RETURN
+    }
+
+    bsl::vector<char> buffer(fileSize, allocator);
+
+    bsls::Types::Uint64 numRead = 0;
+    while (numRead < fileSize) {
+        const ssize_t rc = ::read(fd,
+                                  buffer.data() + numRead,
+                                  bsl::min(fileSize - numRead, k_MAX_IO_SIZE));
+        if (rc < 0 && EINTR == errno) {
+            continue;  // CONTINUE
+        }
+
+        if (rc <= 0) {
+            errorDescription << "Failed to read file [" << fileName
+                             << "] after " << numRead << " bytes, errno: "
+                             << errno << " (" << bsl::strerror(errno) << ")";
+            return rc_READ_FAILURE;  // RETURN
+        }
+        numRead += rc;
+    }
+
+    const char*        data = buffer.data();
+    const unsigned int crc  = bmqp::Crc32c::calculate(
+        data,
+        static_cast<unsigned int>(fileSize - k_CRC_SIZE));
+    if (crc != readUint32(data + fileSize - k_CRC_SIZE)) {
+        errorDescription << "CRC32-C mismatch in file [" << fileName << "]";
+        return rc_CRC_MISMATCH;  // RETURN
+    }
+
+    if (k_MAGIC != readUint32(data)) {
+        errorDescription << "Invalid magic in file [" << fileName << "]";
+        return rc_INVALID_MAGIC;  // RETURN
+    }
+
+    const unsigned int version = readUint32(data + 4);
+    if (k_VERSION != version) {
+        errorDescription << "Unsupported version " << version << " of file ["
+                         << fileName << "]";
+        return rc_UNSUPPORTED_VERSION;  // RETURN
+    }
+
+    const bsls::Types::Uint64 syncPointOffset   = readUint64(data + 8);
+    const unsigned int        primaryLeaseId    = readUint32(data + 16);
+    const bsls::Types::Uint64 numHighestSeqNums = readUint32(data + 20);
+    const bsls::Types::Uint64 sequenceNumber    = readUint64(data + 24);
+    const bsls::Types::Uint64 numRecordOffsets  = readUint64(data + 32);
+
+    if (fileSize != k_HEADER_SIZE +
+                        numHighestSeqNums * k_LEASE_ID_SEQ_NUM_SIZE +
+                        numRecordOffsets * k_RECORD_OFFSET_SIZE + k_CRC_SIZE) {
+        errorDescription << "Size of file [" << fileName << "] (" << fileSize
+                         << " bytes) does not match its "
+                         << numHighestSeqNums << " highest sequence numbers "
+                         << "and " << numRecordOffsets << " record offsets";
+        return rc_SIZE_MISMATCH;  // RETURN
+    }
+
+    checkpoint->reset();
+    checkpoint->setSyncPoint(syncPointOffset, primaryLeaseId, sequenceNumber);
+
+    data += k_HEADER_SIZE;
+
+    JournalCheckpoint::HighestSeqNums& highestSeqNums =
+        checkpoint->highestSeqNums();
+    highestSeqNums.reserve(numHighestSeqNums);
+    for (bsls::Types::Uint64 i = 0; i < numHighestSeqNums; ++i) {
+        highestSeqNums.push_back(
+            bsl::make_pair(readUint32(data), readUint64(data + 4)));
+        data += k_LEASE_ID_SEQ_NUM_SIZE;
+    }
+
+    JournalCheckpoint::RecordOffsets& recordOffsets =
+        checkpoint->recordOffsets();
+    recordOffsets.reserve(numRecordOffsets);
+    for (bsls::Types::Uint64 i = 0; i < numRecordOffsets; ++i) {
+        recordOffsets.push_back(
+            static_cast<bsls::Types::Uint64>(readUint32(data)) *
+            bmqp::Protocol::k_WORD_SIZE);
+        data += k_RECORD_OFFSET_SIZE;
+    }
+
+    return rc_SUCCESS;
+}
+
+int JournalCheckpointUtil::validate(
+    bsl::ostream&              errorDescription,
+    const JournalCheckpoint&   checkpoint,
+    const JournalFileIterator& journalIt)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(journalIt.isValid());
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS                 = 0,
+        rc_EMPTY_JOURNAL           = -1,
+        rc_INVALID_SYNC_POINT      = -2,
+        rc_SYNC_POINT_PSN_MISMATCH = -3,
+        rc_INVALID_RECORD_OFFSET   = -4,
+        rc_INVALID_RECORD          = -5
+    };
+
+    const MappedFileDescriptor& journal = *journalIt.mappedFileDescriptor();
+    const bsls::Types::Uint64   firstRecordOffset =
+        journalIt.firstRecordPosition();
+    const bsls::Types::Uint64 lastRecordOffset =
+        journalIt.lastRecordPosition();
+    const unsigned int recordSize = journalIt.header().recordWords() *
+                                    bmqp::Protocol::k_WORD_SIZE;
+
+    if (0 == firstRecordOffset || 0 == lastRecordOffset) {
+        errorDescription << "Journal has no records";
+        return rc_EMPTY_JOURNAL;  // RETURN
+    }
+
+    const bsls::Types::Uint64 syncPointOffset = checkpoint.syncPointOffset();
+    if (syncPointOffset < firstRecordOffset ||
+        syncPointOffset > lastRecordOffset ||
+        0 != (syncPointOffset - firstRecordOffset) % recordSize ||
+        !isValidRecord(journal, syncPointOffset, recordSize)) {
+        errorDescription << "No valid record at sync point offset "
+                         << syncPointOffset << " (journal records span ["
+                         << firstRecordOffset << ", " << lastRecordOffset
+                         << "])";
+        return rc_INVALID_SYNC_POINT;  // RETURN
+    }
+
+    const OffsetPtr<const JournalOpRecord> syncPoint(journal.block(),
+                                                     syncPointOffset);
+    if (RecordType::e_JOURNAL_OP != syncPoint->header().type() ||
+        JournalOpType::e_SYNCPOINT != syncPoint->type()) {
+        errorDescription << "Record at sync point offset " << syncPointOffset
+                         << " is not a sync point";
+        return rc_INVALID_SYNC_POINT;  // RETURN
+    }
+
+    if (syncPoint->header().primaryLeaseId() !=
+            checkpoint.syncPointPrimaryLeaseId() ||
+        syncPoint->header().sequenceNumber() !=
+            checkpoint.syncPointSequenceNumber()) {
+        errorDescription << "Sync point at offset " << syncPointOffset
+                         << " has PSN ["
+                         << syncPoint->header().primaryLeaseId() << ", "
+                         << syncPoint->header().sequenceNumber()
+                         << "], expected ["
+                         << checkpoint.syncPointPrimaryLeaseId() << ", "
+                         << checkpoint.syncPointSequenceNumber() << "]";
+        return rc_SYNC_POINT_PSN_MISMATCH;  // RETURN
+    }
+
+    const JournalCheckpoint::RecordOffsets& recordOffsets =
+        checkpoint.recordOffsets();
+    bsls::Types::Uint64 previousOffset = 0;
+    for (JournalCheckpoint::RecordOffsets::const_iterator cit =
+             recordOffsets.cbegin();
+         cit != recordOffsets.cend();
+         ++cit) {
+        const bsls::Types::Uint64 offset = *cit;
+        if (offset < firstRecordOffset || offset >= syncPointOffset ||
+            offset <= previousOffset ||
+            0 != (offset - firstRecordOffset) % recordSize) {
+            errorDescription << "Invalid record offset " << offset
+                             << " (previous offset: " << previousOffset
+                             << ", sync point offset: " << syncPointOffset
+                             << ")";
+            return rc_INVALID_RECORD_OFFSET;  // RETURN
+        }
+
+        if (!isValidRecord(journal, offset, recordSize)) {
+            errorDescription << "No valid record at offset " << offset;
+            return rc_INVALID_RECORD;  // RETURN
+        }
+
+        previousOffset = offset;
+    }
+
+    return rc_SUCCESS;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
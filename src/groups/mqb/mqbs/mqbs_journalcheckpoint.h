@@ -0,0 +1,340 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MQBS_JOURNALCHECKPOINT
+#define INCLUDED_MQBS_JOURNALCHECKPOINT
+
+//@PURPOSE: Provide a VST and utilities for checkpoints of a BlazingMQ journal.
+//
+//@CLASSES:
+//  mqbs::JournalCheckpoint:     VST representing a checkpoint of a journal
+//  mqbs::JournalCheckpointUtil: utilities to save, load and validate one
+//
+//@SEE ALSO: mqbs::FileStore
+//
+//@DESCRIPTION: This component provides a value-semantic type,
+// 'mqbs::JournalCheckpoint', representing a checkpoint of a BlazingMQ journal
+// taken at a sync point, and a utility struct, 'mqbs::JournalCheckpointUtil',
+// to save it to, and load it from, the checkpoint file written alongside the
+// journal.
+//
+// A checkpoint lists the offsets of the journal records which were still
+// outstanding when the checkpoint was taken (in other words, the records
+// which a rollover at that time would have copied to the next file set),
+// along with the sync points preceding it.  Recovering a journal having a
+// checkpoint therefore only requires iterating over the records written after
+// the sync point of the checkpoint, followed by the records listed in the
+// checkpoint, instead of iterating over the whole journal.
+//
+/// Checkpoint file layout
+///----------------------
+// All fields are stored in network byte order.
+//..
+//  +---------------+---------------+---------------+---------------+
+//  |                          Magic ("BMQC")                       |
+//  +---------------+---------------+---------------+---------------+
+//  |                             Version                           |
+//  +---------------+---------------+---------------+---------------+
+//  |                  Sync point journal offset (64 bits)          |
+//  +---------------+---------------+---------------+---------------+
+//  |                  Sync point primary lease id                  |
+//  +---------------+---------------+---------------+---------------+
+//  |                  Number of highest sequence numbers           |
+//  +---------------+---------------+---------------+---------------+
+//  |                  Sync point sequence number (64 bits)         |
+//  +---------------+---------------+---------------+---------------+
+//  |                  Number of record offsets (64 bits)           |
+//  +---------------+---------------+---------------+---------------+
+//  |   (primary lease id, highest sequence number (64 bits)) pairs |
+//  +---------------+---------------+---------------+---------------+
+//  |              Record offsets (in words, 32 bits each)          |
+//  +---------------+---------------+---------------+---------------+
+//  |                  CRC32-C of all the above                     |
+//  +---------------+---------------+---------------+---------------+
+//..
+
+// MQB
+#include <mqbs_journalfileiterator.h>
+
+// BDE
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// =======================
+// class JournalCheckpoint
+// =======================
+
+/// Value-semantic type representing a checkpoint of a BlazingMQ journal.
+class JournalCheckpoint {
+  public:
+    // TYPES
+
+    /// Journal offsets of the records listed in a checkpoint, in
+    /// increasing order.
+    typedef bsl::vector<bsls::Types::Uint64> RecordOffsets;
+
+    /// Pair of primary lease id and highest sequence number.
+    typedef bsl::pair<unsigned int, bsls::Types::Uint64> LeaseIdSeqNum;
+
+    /// Highest sequence number for each primary lease id.
+    typedef bsl::vector<LeaseIdSeqNum> HighestSeqNums;
+
+  private:
+    // DATA
+
+    /// Journal offset of the sync point record at which this checkpoint was
+    /// taken.
+    bsls::Types::Uint64 d_syncPointOffset;
+
+    /// Primary lease id in the record header of the sync point.
+    unsigned int d_syncPointPrimaryLeaseId;
+
+    /// Sequence number in the record header of the sync point.
+    bsls::Types::Uint64 d_syncPointSequenceNumber;
+
+    /// Highest sequence number for each primary lease id when this
+    /// checkpoint was taken.
+    HighestSeqNums d_highestSeqNums;
+
+    /// Journal offsets of the records outstanding when this checkpoint was
+    /// taken, and of the sync points preceding it, in increasing order.
+    RecordOffsets d_recordOffsets;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(JournalCheckpoint,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty instance using the optionally specified `allocator`.
+    explicit JournalCheckpoint(bslma::Allocator* allocator = 0);
+
+    /// Create an instance having the value of the specified `other`, using
+    /// the optionally specified `allocator`.
+    JournalCheckpoint(const JournalCheckpoint& other,
+                      bslma::Allocator*        allocator = 0);
+
+    // MANIPULATORS
+
+    /// Set the sync point of this checkpoint to the record at the specified
+    /// `offset` in the journal, having the specified `primaryLeaseId` and
+    /// `sequenceNumber` in its record header, and return a reference
+    /// offering modifiable access to this object.
+    JournalCheckpoint& setSyncPoint(bsls::Types::Uint64 offset,
+                                    unsigned int        primaryLeaseId,
+                                    bsls::Types::Uint64 sequenceNumber);
+
+    /// Return a reference offering modifiable access to the highest
+    /// sequence numbers of this checkpoint.
+    HighestSeqNums& highestSeqNums();
+
+    /// Return a reference offering modifiable access to the record offsets
+    /// of this checkpoint.
+    RecordOffsets& recordOffsets();
+
+    /// Reset this instance to the empty state.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return the journal offset of the sync point of this checkpoint.
+    bsls::Types::Uint64 syncPointOffset() const;
+
+    /// Return the primary lease id in the record header of the sync point.
+    unsigned int syncPointPrimaryLeaseId() const;
+
+    /// Return the sequence number in the record header of the sync point.
+    bsls::Types::Uint64 syncPointSequenceNumber() const;
+
+    /// Return a reference offering non-modifiable access to the highest
+    /// sequence numbers of this checkpoint.
+    const HighestSeqNums& highestSeqNums() const;
+
+    /// Return a reference offering non-modifiable access to the record
+    /// offsets of this checkpoint.
+    const RecordOffsets& recordOffsets() const;
+
+    /// Format this object to the specified output `stream` at the (absolute
+    /// value of) the optionally specified indentation `level` and return a
+    /// reference to `stream`.  If `level` is specified, optionally specify
+    /// `spacesPerLevel`, the number of spaces per indentation level for
+    /// this and all of its nested objects.  If `level` is negative,
+    /// suppress indentation of the first line.  If `spacesPerLevel` is
+    /// negative format the entire output on one line, suppressing all but
+    /// the initial indentation (as governed by `level`).  If `stream` is
+    /// not valid on entry, this operation has no effect.  Note that the
+    /// record offsets are summarized by their number.
+    bsl::ostream&
+    print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` have the same value, and
+/// `false` otherwise.
+bool operator==(const JournalCheckpoint& lhs, const JournalCheckpoint& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` do not have the same
+/// value, and `false` otherwise.
+bool operator!=(const JournalCheckpoint& lhs, const JournalCheckpoint& rhs);
+
+/// Format the specified `rhs` to the specified output `stream` and return a
+/// reference to the modifiable `stream`.
+bsl::ostream& operator<<(bsl::ostream& stream, const JournalCheckpoint& rhs);
+
+// ============================
+// struct JournalCheckpointUtil
+// ============================
+
+/// This component provides utilities to work with checkpoints of a
+/// BlazingMQ journal.
+struct JournalCheckpointUtil {
+    // CLASS METHODS
+
+    /// Save the specified `checkpoint` to the file having the specified
+    /// `fileName`, replacing it if it exists, and using the optionally
+    /// specified `allocator` to supply temporary memory.  Return zero on
+    /// success, non-zero value otherwise along with populating the specified
+    /// `errorDescription` with a brief reason for logging purposes.  Note
+    /// that the checkpoint is first written to a temporary file which is
+    /// then renamed, so that `fileName` never contains a partial checkpoint.
+    static int save(bsl::ostream&            errorDescription,
+                    const bsl::string&       fileName,
+                    const JournalCheckpoint& checkpoint,
+                    bslma::Allocator*        allocator = 0);
+
+    /// Load into the specified `checkpoint` the checkpoint saved in the file
+    /// having the specified `fileName`, using the optionally specified
+    /// `allocator` to supply temporary memory.  Return zero on success, 1 if
+    /// that file does not exist, or a negative value otherwise along with
+    /// populating the specified `errorDescription` with a brief reason for
+    /// logging purposes.
+    static int load(bsl::ostream&      errorDescription,
+                    JournalCheckpoint* checkpoint,
+                    const bsl::string& fileName,
+                    bslma::Allocator*  allocator = 0);
+
+    /// Return zero if the specified `checkpoint` is consistent with the
+    /// journal over which the specified `journalIt` iterates, non-zero value
+    /// otherwise along with populating the specified `errorDescription` with
+    /// a brief reason for logging purposes.  The checkpoint is consistent if
+    /// its sync point is a sync point record of the journal having the same
+    /// PSN in its record header, and if each of its record offsets refers to
+    /// a valid journal record preceding that sync point.
+    static int validate(bsl::ostream&              errorDescription,
+                        const JournalCheckpoint&   checkpoint,
+                        const JournalFileIterator& journalIt);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -----------------------
+// class JournalCheckpoint
+// -----------------------
+
+// MANIPULATORS
+inline JournalCheckpoint&
+JournalCheckpoint::setSyncPoint(bsls::Types::Uint64 offset,
+                                unsigned int        primaryLeaseId,
+                                bsls::Types::Uint64 sequenceNumber)
+{
+    d_syncPointOffset         = offset;
+    d_syncPointPrimaryLeaseId = primaryLeaseId;
+    d_syncPointSequenceNumber = sequenceNumber;
+    return *this;
+}
+
+inline JournalCheckpoint::HighestSeqNums& JournalCheckpoint::highestSeqNums()
+{
+    return d_highestSeqNums;
+}
+
+inline JournalCheckpoint::RecordOffsets& JournalCheckpoint::recordOffsets()
+{
+    return d_recordOffsets;
+}
+
+// ACCESSORS
+inline bsls::Types::Uint64 JournalCheckpoint::syncPointOffset() const
+{
+    return d_syncPointOffset;
+}
+
+inline unsigned int JournalCheckpoint::syncPointPrimaryLeaseId() const
+{
+    return d_syncPointPrimaryLeaseId;
+}
+
+inline bsls::Types::Uint64 JournalCheckpoint::syncPointSequenceNumber() const
+{
+    return d_syncPointSequenceNumber;
+}
+
+inline const JournalCheckpoint::HighestSeqNums&
+JournalCheckpoint::highestSeqNums() const
+{
+    return d_highestSeqNums;
+}
+
+inline const JournalCheckpoint::RecordOffsets&
+JournalCheckpoint::recordOffsets() const
+{
+    return d_recordOffsets;
+}
+
+}  // close package namespace
+
+// -----------------------
+// class JournalCheckpoint
+// -----------------------
+
+// FREE OPERATORS
+inline bool mqbs::operator==(const mqbs::JournalCheckpoint& lhs,
+                             const mqbs::JournalCheckpoint& rhs)
+{
+    return lhs.syncPointOffset() == rhs.syncPointOffset() &&
+           lhs.syncPointPrimaryLeaseId() == rhs.syncPointPrimaryLeaseId() &&
+           lhs.syncPointSequenceNumber() == rhs.syncPointSequenceNumber() &&
+           lhs.highestSeqNums() == rhs.highestSeqNums() &&
+           lhs.recordOffsets() == rhs.recordOffsets();
+}
+
+inline bool mqbs::operator!=(const mqbs::JournalCheckpoint& lhs,
+                             const mqbs::JournalCheckpoint& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline bsl::ostream& mqbs::operator<<(bsl::ostream&                  stream,
+                                      const mqbs::JournalCheckpoint& rhs)
+{
+    return rhs.print(stream, 0, -1);
+}
+
+}  // close enterprise namespace
+
+#endif
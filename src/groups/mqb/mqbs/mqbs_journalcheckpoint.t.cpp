@@ -0,0 +1,324 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbs_journalcheckpoint.h>
+
+// BMQ
+#include <bmqu_memoutstream.h>
+#include <bmqu_tempdirectory.h>
+
+// BDE
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+#include <bsl_fstream.h>
+#include <bsl_string.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Populate the specified `checkpoint` with a few highest sequence numbers
+/// and the specified `numRecords` record offsets.
+void populate(mqbs::JournalCheckpoint* checkpoint, size_t numRecords)
+{
+    const bsls::Types::Uint64 k_RECORD_SIZE = 60;
+
+    checkpoint->highestSeqNums().push_back(bsl::make_pair(1U, 1234ULL));
+    checkpoint->highestSeqNums().push_back(bsl::make_pair(2U, 56ULL));
+
+    for (size_t i = 0; i < numRecords; ++i) {
+        checkpoint->recordOffsets().push_back(64 + i * k_RECORD_SIZE);
+    }
+
+    checkpoint->setSyncPoint(64 + numRecords * k_RECORD_SIZE, 2, 57);
+}
+
+/// Truncate the file having the specified `fileName` by the specified
+/// `numBytes`.
+void truncate(const bsl::string& fileName, bsls::Types::Int64 numBytes)
+{
+    const bsls::Types::Int64 size = bdls::FilesystemUtil::getFileSize(
+        fileName);
+    BMQTST_ASSERT_GT(size, numBytes);
+
+    bdls::FilesystemUtil::FileDescriptor fd = bdls::FilesystemUtil::open(
+        fileName,
+        bdls::FilesystemUtil::e_OPEN,
+        bdls::FilesystemUtil::e_READ_WRITE);
+    BMQTST_ASSERT_NE(fd, bdls::FilesystemUtil::k_INVALID_FD);
+    BMQTST_ASSERT_EQ(0,
+                     bdls::FilesystemUtil::truncateFileSize(fd,
+                                                            size - numBytes));
+    bdls::FilesystemUtil::close(fd);
+}
+
+/// Flip a bit of the byte at the specified `offset` in the file having the
+/// specified `fileName`.
+void corrupt(const bsl::string& fileName, bsls::Types::Int64 offset)
+{
+    bsl::fstream file(fileName.c_str(),
+                      bsl::ios::in | bsl::ios::out | bsl::ios::binary);
+    BMQTST_ASSERT(file.good());
+
+    char byte = 0;
+    file.seekg(offset);
+    file.read(&byte, 1);
+    byte ^= 0x10;
+    file.seekp(offset);
+    file.write(&byte, 1);
+    file.close();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component.
+//
+// Testing:
+//   Basic functionality
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    mqbs::JournalCheckpoint obj1(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(obj1.syncPointOffset(), 0U);
+    BMQTST_ASSERT_EQ(obj1.syncPointPrimaryLeaseId(), 0U);
+    BMQTST_ASSERT_EQ(obj1.syncPointSequenceNumber(), 0U);
+    BMQTST_ASSERT(obj1.highestSeqNums().empty());
+    BMQTST_ASSERT(obj1.recordOffsets().empty());
+
+    populate(&obj1, 3);
+    BMQTST_ASSERT_EQ(obj1.syncPointOffset(), 244U);
+    BMQTST_ASSERT_EQ(obj1.syncPointPrimaryLeaseId(), 2U);
+    BMQTST_ASSERT_EQ(obj1.syncPointSequenceNumber(), 57U);
+    BMQTST_ASSERT_EQ(obj1.highestSeqNums().size(), 2U);
+    BMQTST_ASSERT_EQ(obj1.recordOffsets().size(), 3U);
+
+    PV("Copy constructor");
+    mqbs::JournalCheckpoint obj2(obj1, bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(obj1, obj2);
+
+    obj2.recordOffsets().pop_back();
+    BMQTST_ASSERT_NE(obj1, obj2);
+
+    PV("Print");
+    bmqu::MemOutStream out(bmqtst::TestHelperUtil::allocator());
+    out << obj1;
+    BMQTST_ASSERT_EQ(out.str(),
+                     "[ syncPointOffset = 244 syncPointPrimaryLeaseId = 2"
+                     " syncPointSequenceNumber = 57 numHighestSeqNums = 2"
+                     " numRecordOffsets = 3 ]");
+
+    PV("Reset");
+    obj1.reset();
+    BMQTST_ASSERT_EQ(obj1,
+                     mqbs::JournalCheckpoint(
+                         bmqtst::TestHelperUtil::allocator()));
+}
+
+static void test2_saveLoad()
+// ------------------------------------------------------------------------
+// SAVE LOAD
+//
+// Concerns:
+//   1. A saved checkpoint is loaded with the same value, and replaces any
+//      checkpoint previously saved to the same file.
+//   2. Loading a checkpoint from a missing file returns 1.
+//
+// Testing:
+//   JournalCheckpointUtil::save
+//   JournalCheckpointUtil::load
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("SAVE LOAD");
+
+    bmqu::TempDirectory tempDir(bmqtst::TestHelperUtil::allocator());
+    bsl::string         fileName(tempDir.path(),
+                         bmqtst::TestHelperUtil::allocator());
+    bdls::PathUtil::appendRaw(&fileName, "journal.bmq_checkpoint");
+
+    bmqu::MemOutStream errorDesc(bmqtst::TestHelperUtil::allocator());
+    mqbs::JournalCheckpoint loaded(bmqtst::TestHelperUtil::allocator());
+
+    PV("Missing file");
+    BMQTST_ASSERT_EQ(1,
+                     mqbs::JournalCheckpointUtil::load(
+                         errorDesc,
+                         &loaded,
+                         fileName,
+                         bmqtst::TestHelperUtil::allocator()));
+
+    PV("Empty checkpoint");
+    mqbs::JournalCheckpoint empty(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0,
+                     mqbs::JournalCheckpointUtil::save(
+                         errorDesc,
+                         fileName,
+                         empty,
+                         bmqtst::TestHelperUtil::allocator()));
+    populate(&loaded, 1);
+    BMQTST_ASSERT_EQ(0,
+                     mqbs::JournalCheckpointUtil::load(
+                         errorDesc,
+                         &loaded,
+                         fileName,
+                         bmqtst::TestHelperUtil::allocator()));
+    BMQTST_ASSERT_EQ(empty, loaded);
+
+    PV("Non-empty checkpoint replacing the previous one");
+    mqbs::JournalCheckpoint checkpoint(bmqtst::TestHelperUtil::allocator());
+    populate(&checkpoint, 1000);
+    BMQTST_ASSERT_EQ(0,
+                     mqbs::JournalCheckpointUtil::save(
+                         errorDesc,
+                         fileName,
+                         checkpoint,
+                         bmqtst::TestHelperUtil::allocator()));
+    bsl::string tmpFileName(fileName, bmqtst::TestHelperUtil::allocator());
+    tmpFileName.append(".tmp");
+    BMQTST_ASSERT(!bdls::FilesystemUtil::exists(tmpFileName));
+    BMQTST_ASSERT_EQ(0,
+                     mqbs::JournalCheckpointUtil::load(
+                         errorDesc,
+                         &loaded,
+                         fileName,
+                         bmqtst::TestHelperUtil::allocator()));
+    BMQTST_ASSERT_EQ(checkpoint, loaded);
+    BMQTST_ASSERT_EQ(errorDesc.str(), "");
+}
+
+static void test3_loadInvalidFile()
+// ------------------------------------------------------------------------
+// LOAD INVALID FILE
+//
+// Concerns:
+//   A truncated or corrupted checkpoint file is rejected with a negative
+//   return code and an error description.
+//
+// Testing:
+//   JournalCheckpointUtil::load
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("LOAD INVALID FILE");
+
+    bmqu::TempDirectory tempDir(bmqtst::TestHelperUtil::allocator());
+    bsl::string         fileName(tempDir.path(),
+                         bmqtst::TestHelperUtil::allocator());
+    bdls::PathUtil::appendRaw(&fileName, "journal.bmq_checkpoint");
+
+    mqbs::JournalCheckpoint checkpoint(bmqtst::TestHelperUtil::allocator());
+    populate(&checkpoint, 10);
+
+    const bsls::Types::Int64 k_OFFSETS[] = {
+        0,   // magic
+        5,   // version
+        12,  // sync point offset
+        30,  // sync point sequence number
+        45,  // highest sequence numbers
+        70,  // record offsets
+        -1   // CRC
+    };
+
+    for (size_t i = 0; i < sizeof(k_OFFSETS) / sizeof(*k_OFFSETS); ++i) {
+        PVV("Corrupted byte " << k_OFFSETS[i]);
+
+        bmqu::MemOutStream errorDesc(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(0,
+                         mqbs::JournalCheckpointUtil::save(
+                             errorDesc,
+                             fileName,
+                             checkpoint,
+                             bmqtst::TestHelperUtil::allocator()));
+
+        const bsls::Types::Int64 offset =
+            k_OFFSETS[i] >= 0
+                ? k_OFFSETS[i]
+                : bdls::FilesystemUtil::getFileSize(fileName) + k_OFFSETS[i];
+        corrupt(fileName, offset);
+
+        mqbs::JournalCheckpoint loaded(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_LT(mqbs::JournalCheckpointUtil::load(
+                             errorDesc,
+                             &loaded,
+                             fileName,
+                             bmqtst::TestHelperUtil::allocator()),
+                         0);
+        BMQTST_ASSERT_NE(errorDesc.str(), "");
+    }
+
+    const bsls::Types::Int64 k_TRUNCATIONS[] = {1, 4, 40, 100};
+
+    for (size_t i = 0; i < sizeof(k_TRUNCATIONS) / sizeof(*k_TRUNCATIONS);
+         ++i) {
+        PVV("Truncated by " << k_TRUNCATIONS[i] << " bytes");
+
+        bmqu::MemOutStream errorDesc(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(0,
+                         mqbs::JournalCheckpointUtil::save(
+                             errorDesc,
+                             fileName,
+                             checkpoint,
+                             bmqtst::TestHelperUtil::allocator()));
+        truncate(fileName, k_TRUNCATIONS[i]);
+
+        mqbs::JournalCheckpoint loaded(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_LT(mqbs::JournalCheckpointUtil::load(
+                             errorDesc,
+                             &loaded,
+                             fileName,
+                             bmqtst::TestHelperUtil::allocator()),
+                         0);
+        BMQTST_ASSERT_NE(errorDesc.str(), "");
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_loadInvalidFile(); break;
+    case 2: test2_saveLoad(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
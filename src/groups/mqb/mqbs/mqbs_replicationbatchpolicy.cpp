@@ -0,0 +1,127 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbs_replicationbatchpolicy.h>
+
+#include <mqbscm_version.h>
+// BDE
+#include <bslim_printer.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// ----------------------------
+// class ReplicationBatchPolicy
+// ----------------------------
+
+// CREATORS
+ReplicationBatchPolicy::ReplicationBatchPolicy(
+    bsls::Types::Int64 latencyBudget,
+    int                maxBatchSize)
+: d_latencyBudget(latencyBudget)
+, d_maxBatchSize(maxBatchSize)
+, d_interArrivalTime(0)
+, d_lastArrivalTime(0)
+, d_batchStartTime(0)
+, d_batchSize(0)
+, d_targetBatchSize(maxBatchSize)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < latencyBudget);
+    BSLS_ASSERT_SAFE(0 < maxBatchSize);
+}
+
+// MANIPULATORS
+bool ReplicationBatchPolicy::onMessage(bsls::Types::Int64 now)
+{
+    bsls::Types::Int64 gap = 0;
+    if (0 != d_lastArrivalTime && now > d_lastArrivalTime) {
+        gap = now - d_lastArrivalTime;
+        if (0 == d_interArrivalTime) {
+            d_interArrivalTime = gap;
+        }
+        else {
+            d_interArrivalTime += (gap - d_interArrivalTime) /
+                                  k_AVERAGE_WEIGHT;
+        }
+    }
+    d_lastArrivalTime = now;
+
+    if (0 == d_batchSize) {
+        d_batchStartTime = now;
+    }
+    ++d_batchSize;
+
+    // Number of messages expected to arrive within the budget.  As long as
+    // the rate is unknown, let the budget alone bound the batch.
+
+    d_targetBatchSize = d_maxBatchSize;
+    if (0 != d_interArrivalTime) {
+        const bsls::Types::Int64 target = d_latencyBudget /
+                                          d_interArrivalTime;
+        if (target < d_maxBatchSize) {
+            d_targetBatchSize = target < 1 ? 1 : static_cast<int>(target);
+        }
+    }
+
+    if (d_batchSize >= d_targetBatchSize) {
+        return true;  // RETURN
+    }
+
+    const bsls::Types::Int64 age = now - d_batchStartTime;
+    if (age >= d_latencyBudget) {
+        return true;  // RETURN
+    }
+
+    // At the pace of the last arrival, the batch would not fill up before
+    // its oldest message exceeds the budget: the rate dropped, so do not
+    // wait for the moving average to catch up.
+
+    return 0 != gap &&
+           age + (d_targetBatchSize - d_batchSize) * gap > d_latencyBudget;
+}
+
+void ReplicationBatchPolicy::reset()
+{
+    d_interArrivalTime = 0;
+    d_lastArrivalTime  = 0;
+    d_batchStartTime   = 0;
+    d_batchSize        = 0;
+    d_targetBatchSize  = d_maxBatchSize;
+}
+
+// ACCESSORS
+bsl::ostream& ReplicationBatchPolicy::print(bsl::ostream& stream,
+                                            int           level,
+                                            int spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;  // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("latencyBudget", d_latencyBudget);
+    printer.printAttribute("maxBatchSize", d_maxBatchSize);
+    printer.printAttribute("interArrivalTime", d_interArrivalTime);
+    printer.printAttribute("batchSize", d_batchSize);
+    printer.printAttribute("targetBatchSize", d_targetBatchSize);
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
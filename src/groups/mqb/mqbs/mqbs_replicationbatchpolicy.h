@@ -0,0 +1,223 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MQBS_REPLICATIONBATCHPOLICY
+#define INCLUDED_MQBS_REPLICATIONBATCHPOLICY
+
+//@PURPOSE: Provide an adaptive policy to batch replicated storage messages.
+//
+//@CLASSES:
+//  mqbs::ReplicationBatchPolicy: latency-targeting batching policy
+//
+//@SEE ALSO: mqbs::FileStore
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'mqbs::ReplicationBatchPolicy', deciding when the primary of a partition
+// should send the batch of storage messages it is building to the replicas,
+// given a budget of latency that batching may add to the replication of a
+// message.
+//
+// The policy keeps an exponentially weighted moving average of the time
+// between two consecutive messages, from which it derives the number of
+// messages expected to arrive within the latency budget: the target size of
+// a batch.  A high message rate therefore grows batches (up to a maximum),
+// which amortizes the cost of sending one event over more messages, while a
+// low rate shrinks them so that messages do not wait for a batch which will
+// not fill up in time.  In addition, a batch is due as soon as its oldest
+// message has waited for the whole budget, or as soon as the pace of the
+// last arrival shows that the batch would not fill up before that happens,
+// so that a sudden drop of the rate is reacted upon before the moving
+// average catches up.
+//
+// Note that the policy only decides when a batch is due while messages keep
+// arriving: the owner of the batch remains responsible for sending it when
+// there is no more work to do (e.g., when its dispatcher queue is empty).
+//
+/// Thread Safety
+///-------------
+// NOT thread-safe.
+//
+/// Usage
+///-----
+//..
+//  mqbs::ReplicationBatchPolicy policy(500 * 1000,  // 500us budget
+//                                      1000);       // max batch size
+//
+//  // For every message added to the batch:
+//  if (policy.onMessage(bmqu::Time::highResolutionTimer())) {
+//      // send the batch
+//      policy.onFlush();
+//  }
+//..
+
+// BDE
+#include <bsl_ostream.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// ============================
+// class ReplicationBatchPolicy
+// ============================
+
+/// Mechanism deciding when a batch of replicated messages is due, given a
+/// latency budget and the measured inter-arrival time of the messages.
+class ReplicationBatchPolicy {
+  private:
+    // DATA
+
+    /// Maximum time, in nanoseconds, a message may wait in a batch.
+    bsls::Types::Int64 d_latencyBudget;
+
+    /// Maximum number of messages in a batch.
+    int d_maxBatchSize;
+
+    /// Moving average of the time, in nanoseconds, between two consecutive
+    /// messages, or 0 if unknown yet.
+    bsls::Types::Int64 d_interArrivalTime;
+
+    /// Time of the last message, or 0 if there was none yet.
+    bsls::Types::Int64 d_lastArrivalTime;
+
+    /// Time of the first message of the current batch.
+    bsls::Types::Int64 d_batchStartTime;
+
+    /// Number of messages in the current batch.
+    int d_batchSize;
+
+    /// Target size of a batch, as of the last message.
+    int d_targetBatchSize;
+
+  public:
+    // CONSTANTS
+
+    /// Weight of the newest inter-arrival time in the moving average,
+    /// expressed as the inverse of the fraction it accounts for.
+    static const int k_AVERAGE_WEIGHT = 8;
+
+    // CREATORS
+
+    /// Create a policy targeting the specified `latencyBudget`, in
+    /// nanoseconds, and never letting a batch grow beyond the specified
+    /// `maxBatchSize` messages.  The behavior is undefined unless
+    /// `0 < latencyBudget` and `0 < maxBatchSize`.
+    ReplicationBatchPolicy(bsls::Types::Int64 latencyBudget, int maxBatchSize);
+
+    // MANIPULATORS
+
+    /// Account for a message added to the current batch at the specified
+    /// `now` time, in nanoseconds (as returned by
+    /// `bmqu::Time::highResolutionTimer`), and return `true` if the batch
+    /// is due, or `false` otherwise.
+    bool onMessage(bsls::Types::Int64 now);
+
+    /// Account for the current batch having been sent.
+    void onFlush();
+
+    /// Forget about the current batch and the measured inter-arrival time.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return the latency budget, in nanoseconds.
+    bsls::Types::Int64 latencyBudget() const;
+
+    /// Return the maximum number of messages in a batch.
+    int maxBatchSize() const;
+
+    /// Return the moving average of the time, in nanoseconds, between two
+    /// consecutive messages, or 0 if it is not known yet.
+    bsls::Types::Int64 interArrivalTime() const;
+
+    /// Return the number of messages in the current batch.
+    int batchSize() const;
+
+    /// Return the target size of a batch, as of the last message.
+    int targetBatchSize() const;
+
+    /// Format this object to the specified output `stream` at the (absolute
+    /// value of) the optionally specified indentation `level` and return a
+    /// reference to `stream`.  If `level` is specified, optionally specify
+    /// `spacesPerLevel`, the number of spaces per indentation level for
+    /// this and all of its nested objects.  If `level` is negative,
+    /// suppress indentation of the first line.  If `spacesPerLevel` is
+    /// negative format the entire output on one line, suppressing all but
+    /// the initial indentation (as governed by `level`).  If `stream` is
+    /// not valid on entry, this operation has no effect.
+    bsl::ostream&
+    print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
+};
+
+// FREE OPERATORS
+
+/// Format the specified `rhs` to the specified output `stream` and return a
+/// reference to the modifiable `stream`.
+bsl::ostream& operator<<(bsl::ostream&                 stream,
+                         const ReplicationBatchPolicy& rhs);
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ----------------------------
+// class ReplicationBatchPolicy
+// ----------------------------
+
+// MANIPULATORS
+inline void ReplicationBatchPolicy::onFlush()
+{
+    d_batchSize = 0;
+}
+
+// ACCESSORS
+inline bsls::Types::Int64 ReplicationBatchPolicy::latencyBudget() const
+{
+    return d_latencyBudget;
+}
+
+inline int ReplicationBatchPolicy::maxBatchSize() const
+{
+    return d_maxBatchSize;
+}
+
+inline bsls::Types::Int64 ReplicationBatchPolicy::interArrivalTime() const
+{
+    return d_interArrivalTime;
+}
+
+inline int ReplicationBatchPolicy::batchSize() const
+{
+    return d_batchSize;
+}
+
+inline int ReplicationBatchPolicy::targetBatchSize() const
+{
+    return d_targetBatchSize;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline bsl::ostream& mqbs::operator<<(bsl::ostream&                 stream,
+                                      const ReplicationBatchPolicy& rhs)
+{
+    return rhs.print(stream, 0, -1);
+}
+
+}  // close enterprise namespace
+
+#endif
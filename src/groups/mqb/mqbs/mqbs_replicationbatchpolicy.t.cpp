@@ -0,0 +1,230 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbs_replicationbatchpolicy.h>
+
+// BMQ
+#include <bmqu_memoutstream.h>
+
+// BDE
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Feed the specified `policy` with messages spaced by the specified `gap`
+/// nanoseconds, starting at the specified `*now` time, until a batch is due
+/// or the specified `maxMessages` have been fed.  Return the number of
+/// messages fed and advance `*now` past the last one.
+int feedUntilDue(mqbs::ReplicationBatchPolicy* policy,
+                 bsls::Types::Int64*           now,
+                 bsls::Types::Int64            gap,
+                 int                           maxMessages)
+{
+    for (int i = 1; i <= maxMessages; ++i) {
+        const bool isDue = policy->onMessage(*now);
+        *now += gap;
+        if (isDue) {
+            return i;  // RETURN
+        }
+    }
+    return maxMessages;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component.
+//
+// Testing:
+//   Basic functionality
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    mqbs::ReplicationBatchPolicy obj(1000, 100);
+    BMQTST_ASSERT_EQ(obj.latencyBudget(), 1000);
+    BMQTST_ASSERT_EQ(obj.maxBatchSize(), 100);
+    BMQTST_ASSERT_EQ(obj.interArrivalTime(), 0);
+    BMQTST_ASSERT_EQ(obj.batchSize(), 0);
+    BMQTST_ASSERT_EQ(obj.targetBatchSize(), 100);
+
+    PV("First message: rate unknown, batch not due");
+    BMQTST_ASSERT(!obj.onMessage(10000));
+    BMQTST_ASSERT_EQ(obj.batchSize(), 1);
+    BMQTST_ASSERT_EQ(obj.interArrivalTime(), 0);
+
+    PV("Second message: rate measured");
+    BMQTST_ASSERT(!obj.onMessage(10010));
+    BMQTST_ASSERT_EQ(obj.batchSize(), 2);
+    BMQTST_ASSERT_EQ(obj.interArrivalTime(), 10);
+    BMQTST_ASSERT_EQ(obj.targetBatchSize(), 100);
+
+    PV("Flush");
+    obj.onFlush();
+    BMQTST_ASSERT_EQ(obj.batchSize(), 0);
+    BMQTST_ASSERT_EQ(obj.interArrivalTime(), 10);
+
+    PV("Print");
+    bmqu::MemOutStream out(bmqtst::TestHelperUtil::allocator());
+    out << obj;
+    BMQTST_ASSERT_EQ(out.str(),
+                     "[ latencyBudget = 1000 maxBatchSize = 100"
+                     " interArrivalTime = 10 batchSize = 0"
+                     " targetBatchSize = 100 ]");
+
+    PV("Reset");
+    obj.reset();
+    BMQTST_ASSERT_EQ(obj.interArrivalTime(), 0);
+    BMQTST_ASSERT_EQ(obj.batchSize(), 0);
+    BMQTST_ASSERT_EQ(obj.targetBatchSize(), 100);
+}
+
+static void test2_highRate()
+// ------------------------------------------------------------------------
+// HIGH RATE
+//
+// Concerns:
+//   1. At a steady rate, a batch is due once it holds the number of
+//      messages expected to arrive within the latency budget.
+//   2. A batch never grows beyond the maximum batch size.
+//
+// Testing:
+//   onMessage
+//   onFlush
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("HIGH RATE");
+
+    bsls::Types::Int64 now = 10 * 1000 * 1000;
+
+    {
+        PV("Batch sized by the latency budget");
+        mqbs::ReplicationBatchPolicy obj(1000 * 1000, 1000);
+
+        BMQTST_ASSERT_EQ(feedUntilDue(&obj, &now, 10 * 1000, 1000), 100);
+        BMQTST_ASSERT_EQ(obj.targetBatchSize(), 100);
+        obj.onFlush();
+
+        BMQTST_ASSERT_EQ(feedUntilDue(&obj, &now, 10 * 1000, 1000), 100);
+        obj.onFlush();
+
+        // Twice the rate, about twice the batch once the average caught up
+        for (int i = 0; i < 3; ++i) {
+            feedUntilDue(&obj, &now, 5 * 1000, 1000);
+            obj.onFlush();
+        }
+        const int batchSize = feedUntilDue(&obj, &now, 5 * 1000, 1000);
+        BMQTST_ASSERT_GE(batchSize, 190);
+        BMQTST_ASSERT_LE(batchSize, 200);
+    }
+
+    {
+        PV("Batch capped by the maximum size");
+        mqbs::ReplicationBatchPolicy obj(1000 * 1000, 50);
+
+        BMQTST_ASSERT_EQ(feedUntilDue(&obj, &now, 10 * 1000, 1000), 50);
+        BMQTST_ASSERT_EQ(obj.targetBatchSize(), 50);
+    }
+}
+
+static void test3_lowRate()
+// ------------------------------------------------------------------------
+// LOW RATE
+//
+// Concerns:
+//   1. At a low rate, batches shrink down to a single message.
+//   2. When the rate drops, the current batch is due right away, without
+//      waiting for the moving average to catch up.
+//
+// Testing:
+//   onMessage
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("LOW RATE");
+
+    bsls::Types::Int64 now = 10000;
+
+    {
+        PV("Messages spaced by more than the budget");
+        mqbs::ReplicationBatchPolicy obj(1000, 1000);
+
+        BMQTST_ASSERT(!obj.onMessage(now));
+        BMQTST_ASSERT(obj.onMessage(now + 2000));
+        BMQTST_ASSERT_EQ(obj.targetBatchSize(), 1);
+        obj.onFlush();
+        BMQTST_ASSERT(obj.onMessage(now + 4000));
+    }
+
+    {
+        PV("Rate drop");
+        mqbs::ReplicationBatchPolicy obj(1000 * 1000, 1000);
+
+        BMQTST_ASSERT_EQ(feedUntilDue(&obj, &now, 10 * 1000, 1000), 100);
+        obj.onFlush();
+
+        BMQTST_ASSERT_EQ(feedUntilDue(&obj, &now, 10 * 1000, 5), 5);
+        BMQTST_ASSERT_EQ(obj.batchSize(), 5);
+
+        // The batch is far from its target size and its oldest message is
+        // well within the budget, but at the new pace it would not fill up
+        // in time.
+
+        now += 300 * 1000;
+        BMQTST_ASSERT(obj.onMessage(now));
+        BMQTST_ASSERT_EQ(obj.batchSize(), 6);
+        BMQTST_ASSERT_GT(obj.targetBatchSize(), 6);
+        BMQTST_ASSERT_LT(obj.targetBatchSize(), 100);
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_lowRate(); break;
+    case 2: test2_highRate(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -188,6 +188,7 @@ LedgerConfig::LedgerConfig(bslma::Allocator* allocator)
 , d_validateLogCallback(bsl::allocator_arg, allocator)
 , d_rolloverCallback(bsl::allocator_arg, allocator)
 , d_cleanupCallback(bsl::allocator_arg, allocator)
+, d_executeCallback(bsl::allocator_arg, allocator)
 {
     // NOTHING
 }
@@ -211,6 +212,7 @@ LedgerConfig::LedgerConfig(const LedgerConfig& other,
                         other.d_validateLogCallback)
 , d_rolloverCallback(bsl::allocator_arg, allocator, other.d_rolloverCallback)
 , d_cleanupCallback(bsl::allocator_arg, allocator, other.d_cleanupCallback)
+, d_executeCallback(bsl::allocator_arg, allocator, other.d_executeCallback)
 {
     // NOTHING
 }
@@ -301,6 +303,12 @@ LedgerConfig& LedgerConfig::setCleanupCallback(const CleanupCb& value)
     return *this;
 }
 
+LedgerConfig& LedgerConfig::setExecuteCallback(const ExecuteCb& value)
+{
+    d_executeCallback = value;
+    return *this;
+}
+
 // ACCESSORS
 const bsl::string& LedgerConfig::location() const
 {
@@ -367,6 +375,11 @@ const LedgerConfig::CleanupCb& LedgerConfig::cleanupCallback() const
     return d_cleanupCallback;
 }
 
+const LedgerConfig::ExecuteCb& LedgerConfig::executeCallback() const
+{
+    return d_executeCallback;
+}
+
 bsl::ostream&
 LedgerConfig::print(bsl::ostream& stream, int level, int spacesPerLevel) const
 {
@@ -266,6 +266,13 @@ class LedgerConfig {
     /// invoked by the ledger after it closes the old log during rollover.
     typedef bsl::function<int(const bsl::string& logPath)> CleanupCb;
 
+    /// Callback invoked to execute the specified `functor` in the thread
+    /// writing to the ledger.  Note that if the `keepOldLogs` flag is false,
+    /// the ledger uses this callback to remove a rolled over log from its
+    /// list of logs, as the list may only be modified by the writing thread.
+    typedef bsl::function<void(const bsl::function<void()>& functor)>
+        ExecuteCb;
+
   private:
     // DATA
     bsl::string d_location;
@@ -317,6 +324,11 @@ class LedgerConfig {
     // Callback invoked after closing a log
     // to perform additional cleanup.
 
+    ExecuteCb d_executeCallback;
+    // Callback invoked to execute a
+    // functor in the thread writing to
+    // the ledger.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(LedgerConfig, bslma::UsesBslmaAllocator)
@@ -347,10 +359,11 @@ class LedgerConfig {
     LedgerConfig& setExtractLogIdCallback(const ExtractLogIdCb& value);
     LedgerConfig& setValidateLogCallback(const ValidateLogCb& value);
     LedgerConfig& setRolloverCallback(const OnRolloverCb& value);
+    LedgerConfig& setCleanupCallback(const CleanupCb& value);
 
     /// Set the corresponding attribute to the specified `value` and return
     /// a reference offering modifiable access to this object.
-    LedgerConfig& setCleanupCallback(const CleanupCb& value);
+    LedgerConfig& setExecuteCallback(const ExecuteCb& value);
 
     // ACCESSORS
     const bsl::string&     location() const;
@@ -365,9 +378,10 @@ class LedgerConfig {
     const ExtractLogIdCb&  extractLogIdCallback() const;
     const ValidateLogCb&   validateLogCallback() const;
     const OnRolloverCb&    rolloverCallback() const;
+    const CleanupCb&       cleanupCallback() const;
 
     /// Get the value of the corresponding attribute.
-    const CleanupCb& cleanupCallback() const;
+    const ExecuteCb& executeCallback() const;
 
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
@@ -475,6 +489,11 @@ class Ledger {
     /// mechanism, and return 0 on success, or a non-zero value on error.
     virtual int flush() = 0;
 
+    /// Roll over from the current log to a new one, even if the current log
+    /// is not full, and return 0 on success, or a non-zero value otherwise.
+    /// If successful, invoke the `OnRolloverCb` found in the ledger config.
+    virtual int rollOver() = 0;
+
     // ACCESSORS
 
     /// Copy the specified `length` bytes from the specified `recordId` in
@@ -265,7 +265,7 @@ int Ledger::rollOverImpl(const mqbu::StorageKey& oldLogId)
             << ". Aborting rollover and reverting back to old log."
             << BMQTSK_ALARMLOG_END;
 
-        closeAndCleanup(currentLog(), d_logs.size() - 1);
+        closeAndCleanup(newLog);
 
         return rc * 100 + LedgerOpResult::e_LOG_ROLLOVER_CB_FAILURE;  // RETURN
     }
@@ -273,36 +273,6 @@ int Ledger::rollOverImpl(const mqbu::StorageKey& oldLogId)
     return LedgerOpResult::e_SUCCESS;
 }
 
-int Ledger::rollOver()
-{
-    LogSp& lastLog = currentLog();
-    const size_t lastLogIndex = d_logs.size() - 1;
-
-    // Flush the log and roll over
-    int rc = lastLog->flush();
-    if (rc != LogOpResult::e_SUCCESS) {
-        return rc * 100 + LedgerOpResult::e_LOG_FLUSH_FAILURE;  // RETURN
-    }
-
-    rc = rollOverImpl(lastLog->logConfig().logId());
-    if (rc != LedgerOpResult::e_SUCCESS) {
-        return rc;  // RETURN
-    }
-
-    // If not keeping old logs, enqueue an event in the scheduler thread
-    // to be executed right away to close and cleanup the log file.
-    if (!d_config.keepOldLogs()) {
-        d_config.scheduler()->scheduleEvent(
-            bmqu::Time::nowMonotonicClock(),
-            bdlf::BindUtil::bind(&Ledger::closeAndCleanup,
-                                 this,
-                                 lastLog,
-                                 lastLogIndex));
-    }
-
-    return LedgerOpResult::e_SUCCESS;
-}
-
 template <typename RECORD, typename OFFSET>
 int Ledger::writeRecordImpl(LedgerRecordId* recordId,
                             const RECORD&   record,
@@ -347,7 +317,7 @@ int Ledger::writeRecordImpl(LedgerRecordId* recordId,
     return LedgerOpResult::e_SUCCESS;
 }
 
-int Ledger::closeAndCleanup(const LogSp& log, const size_t logIndex)
+int Ledger::closeAndCleanup(const LogSp& log)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_logs.size() == d_logList.size());
@@ -367,7 +337,9 @@ int Ledger::closeAndCleanup(const LogSp& log, const size_t logIndex)
     BSLS_ASSERT_SAFE(cit != d_logs.end());
     d_totalNumBytes -= cit->second->totalNumBytes();
     d_logs.erase(cit);
-    d_logList.erase(d_logList.begin() + logIndex);
+    Logs::iterator logIt = bsl::find(d_logList.begin(), d_logList.end(), log);
+    BSLS_ASSERT_SAFE(logIt != d_logList.end());
+    d_logList.erase(logIt);
 
     int rc = log->close();
     if (rc != LogOpResult::e_SUCCESS) {
@@ -392,6 +364,36 @@ int Ledger::closeAndCleanup(const LogSp& log, const size_t logIndex)
     return LedgerOpResult::e_SUCCESS;
 }
 
+void Ledger::onCleanupEvent(const LogSp& log)
+{
+    // executed by the *SCHEDULER* thread
+
+    if (!d_config.executeCallback()) {
+        closeAndCleanupDispatched(log);
+        return;  // RETURN
+    }
+
+    // The list of logs is read and modified by the thread writing to this
+    // ledger, so the log must be removed from that thread.
+    d_config.executeCallback()(
+        bdlf::BindUtil::bind(&Ledger::closeAndCleanupDispatched, this, log));
+}
+
+void Ledger::closeAndCleanupDispatched(const LogSp& log)
+{
+    if (d_state != LedgerState::e_OPENED) {
+        // All logs were closed along with the ledger.
+        return;  // RETURN
+    }
+
+    if (bsl::find(d_logList.begin(), d_logList.end(), log) ==
+        d_logList.end()) {
+        return;  // RETURN
+    }
+
+    closeAndCleanup(log);
+}
+
 // CREATORS
 Ledger::Ledger(const mqbsi::LedgerConfig& config, bslma::Allocator* allocator)
 : d_isFirstOpen(true)
@@ -679,6 +681,44 @@ int Ledger::flush()
     return LedgerOpResult::e_SUCCESS;
 }
 
+int Ledger::rollOver()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_state == LedgerState::e_OPENED);
+    BSLS_ASSERT_SAFE(!d_logs.empty());
+
+    if (d_isReadOnly) {
+        return LedgerOpResult::e_LEDGER_READ_ONLY;  // RETURN
+    }
+
+    // Hold the last log by value, as adding the new log may invalidate
+    // references into the list of logs.
+    const LogSp lastLog = currentLog();
+
+    // Flush the log and roll over
+    int rc = lastLog->flush();
+    if (rc != LogOpResult::e_SUCCESS) {
+        return rc * 100 + LedgerOpResult::e_LOG_FLUSH_FAILURE;  // RETURN
+    }
+
+    rc = rollOverImpl(lastLog->logConfig().logId());
+    if (rc != LedgerOpResult::e_SUCCESS) {
+        return rc;  // RETURN
+    }
+
+    // If not keeping old logs, enqueue an event in the scheduler thread
+    // to be executed right away to close and cleanup the log file.  Note
+    // that the log is removed from the list of logs in the thread writing to
+    // this ledger, if an 'ExecuteCb' is configured.
+    if (!d_config.keepOldLogs()) {
+        d_config.scheduler()->scheduleEvent(
+            bmqu::Time::nowMonotonicClock(),
+            bdlf::BindUtil::bind(&Ledger::onCleanupEvent, this, lastLog));
+    }
+
+    return LedgerOpResult::e_SUCCESS;
+}
+
 // ACCESSORS
 //   (virtual 'mqbsi::Ledger')
 int Ledger::readRecord(void*                 entry,
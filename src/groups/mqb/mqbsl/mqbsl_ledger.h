@@ -174,22 +174,34 @@ class Ledger BSLS_KEYWORD_FINAL : public mqbsi::Ledger {
     /// config) when finished.
     int rollOverImpl(const mqbu::StorageKey& oldLogId);
 
-    /// Roll over the current log being written to and return 0 on success, or
-    /// a non-zero `mqbsi::LedgerOpResult` otherwise.  If successful, invoke
-    /// the optional `OnRolloverCb` when finished.
-    int rollOver();
-
     template <typename RECORD, typename OFFSET>
     int writeRecordImpl(LedgerRecordId* recordId,
                         const RECORD&   record,
                         OFFSET          offset,
                         int             length);
 
-    /// Close and cleanup the specified `log` at the specified `logIndex`.
-    /// Return 0 on success, and non-zero error code otherwise.
+    /// Close and cleanup the specified `log`.  Return 0 on success, and
+    /// non-zero error code otherwise.  Note that the `log` is looked up by
+    /// identity, as its position in the list of logs may have changed since
+    /// this cleanup was scheduled (e.g., if several rollovers happened).
+    ///
+    /// THREAD: This method must be invoked from the thread writing to this
+    ///         ledger.
+    int closeAndCleanup(const LogSp& log);
+
+    /// Close and cleanup the specified `log` rolled over from, in the thread
+    /// writing to this ledger if the `ExecuteCb` found in the ledger config
+    /// is set, and in the calling thread otherwise.
     ///
-    /// THREAD: Scheduled to run in seperate thread.
-    int closeAndCleanup(const LogSp& log, const size_t logIndex);
+    /// THREAD: Executed by the scheduler thread.
+    void onCleanupEvent(const LogSp& log);
+
+    /// Close and cleanup the specified `log` rolled over from, unless this
+    /// ledger was closed or the `log` was already removed since the cleanup
+    /// was scheduled.
+    ///
+    /// THREAD: Executed by the thread writing to this ledger.
+    void closeAndCleanupDispatched(const LogSp& log);
 
     // PRIVATE ACCESSORS
 
@@ -276,6 +288,13 @@ class Ledger BSLS_KEYWORD_FINAL : public mqbsi::Ledger {
     /// mechanism, and return 0 on success, or a non-zero value on error.
     int flush() BSLS_KEYWORD_OVERRIDE;
 
+    /// Roll over the current log being written to, even if it is not full,
+    /// and return 0 on success, or a non-zero `mqbsi::LedgerOpResult`
+    /// otherwise.  If successful, invoke the `OnRolloverCb` when finished.
+    /// If the `keepOldLogs` flag is false, the old log is then closed and
+    /// cleaned up asynchronously in the scheduler thread.
+    int rollOver() BSLS_KEYWORD_OVERRIDE;
+
     // ACCESSORS
     //   (virtual 'mqbsi::Ledger')
     int readRecord(void*                 entry,
@@ -27,14 +27,22 @@
 #include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlf_bind.h>
+#include <bdlmt_eventscheduler.h>
 #include <bdls_pathutil.h>
 #include <bsl_cstring.h>  // for memcmp
+#include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bsla_annotations.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_systemclocktype.h>
 #include <bsls_types.h>
 
 // SYS
@@ -139,7 +147,75 @@ int onRolloverCallback(BSLA_MAYBE_UNUSED const mqbu::StorageKey& oldLogId,
     return 0;
 }
 
+/// Cleanup callback counting in the specified `numCleanups` the cleanups of
+/// logs, and in the specified `numForeignCleanups` the ones not invoked by
+/// the thread identified by the specified `writerThreadId`.  Sleep a little
+/// to widen the window during which the cleanup is in progress.
+int countingCleanupCallback(bsls::AtomicInt*    numCleanups,
+                            bsls::AtomicInt*    numForeignCleanups,
+                            bsls::Types::Uint64 writerThreadId,
+                            BSLA_MAYBE_UNUSED const bsl::string& logPath)
+{
+    bslmt::ThreadUtil::microSleep(1000);
+
+    if (bslmt::ThreadUtil::selfIdAsUint64() != writerThreadId) {
+        ++(*numForeignCleanups);
+    }
+    ++(*numCleanups);
+
+    return 0;
+}
+
 // CLASSES
+// ==================
+// struct WriterQueue
+// ==================
+
+/// Queue of functors standing for the thread writing to a ledger: functors
+/// passed to `execute` from any thread are invoked by `drain`.
+struct WriterQueue {
+  private:
+    // DATA
+    bslmt::Mutex                         d_mutex;
+    bsl::vector<bsl::function<void()> > d_functors;
+
+  public:
+    // CREATORS
+    explicit WriterQueue(bslma::Allocator* allocator)
+    : d_mutex()
+    , d_functors(allocator)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+
+    /// Enqueue the specified `functor`.
+    void execute(const bsl::function<void()>& functor)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        d_functors.push_back(functor);
+    }
+
+    /// Invoke, in the calling thread, all the functors enqueued so far and
+    /// return their number.
+    int drain()
+    {
+        bsl::vector<bsl::function<void()> > functors(
+            d_functors.get_allocator());
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+            functors.swap(d_functors);
+        }
+
+        for (size_t i = 0; i < functors.size(); ++i) {
+            functors[i]();
+        }
+
+        return static_cast<int>(functors.size());
+    }
+};
+
 // =============
 // struct Tester
 // =============
@@ -260,6 +336,10 @@ struct Tester {
         return ledger;
     }
 
+    /// Return a reference offering modifiable access to the config used to
+    /// create new ledgers.
+    mqbsi::LedgerConfig& config() { return d_config; }
+
     // ACCESSORS
     mqbsi::Ledger* ledger() const { return d_ledger_mp.get(); }
 
@@ -1728,6 +1808,159 @@ static void test12_aliasRecordBlob()
     BSLS_ASSERT_OPT(ledger->close() == LedgerOpResult::e_SUCCESS);
 }
 
+static void test13_rollOver()
+// ------------------------------------------------------------------------
+// ROLL OVER
+//
+// Concerns:
+//   Verify that 'rollOver' switches the ledger to a new log even if the
+//   current log is not full, that subsequent records are written to the new
+//   log, and that records of the old log can still be read.
+//
+// Testing:
+//   rollOver()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("ROLL OVER");
+
+    Tester         tester;
+    mqbsi::Ledger* ledger = tester.ledger();
+    BSLS_ASSERT_OPT(ledger->open(mqbsi::Ledger::e_CREATE_IF_MISSING) ==
+                    LedgerOpResult::e_SUCCESS);
+    BSLS_ASSERT_OPT(ledger->numLogs() == 1U);
+
+    const mqbu::StorageKey logId1 = ledger->currentLog()->logConfig().logId();
+
+    LedgerRecordId recordId1;
+    BMQTST_ASSERT_EQ(
+        ledger->writeRecord(&recordId1, k_ENTRIES[0], 0, k_ENTRY_LEN),
+        LedgerOpResult::e_SUCCESS);
+    BMQTST_ASSERT_EQ(recordId1.logId(), logId1);
+
+    // Roll over although the current log is far from full
+    BMQTST_ASSERT_EQ(ledger->rollOver(), LedgerOpResult::e_SUCCESS);
+    BMQTST_ASSERT_EQ(ledger->numLogs(), 2U);
+
+    const mqbu::StorageKey logId2 = ledger->currentLog()->logConfig().logId();
+    BMQTST_ASSERT_NE(logId2, logId1);
+    BMQTST_ASSERT_EQ(ledger->totalNumBytes(logId1), k_ENTRY_LEN);
+    BMQTST_ASSERT_EQ(ledger->totalNumBytes(logId2), 0);
+
+    LedgerRecordId recordId2;
+    BMQTST_ASSERT_EQ(
+        ledger->writeRecord(&recordId2, k_ENTRIES[1], 0, k_ENTRY_LEN),
+        LedgerOpResult::e_SUCCESS);
+    BMQTST_ASSERT_EQ(recordId2.logId(), logId2);
+    BMQTST_ASSERT_EQ(recordId2.offset(), 0);
+    BMQTST_ASSERT_EQ(ledger->totalNumBytes(), 2 * k_ENTRY_LEN);
+
+    char entry[k_ENTRY_LEN];
+    BMQTST_ASSERT_EQ(ledger->readRecord(entry, k_ENTRY_LEN, recordId1),
+                     LedgerOpResult::e_SUCCESS);
+    BMQTST_ASSERT_EQ(bsl::memcmp(entry, k_ENTRIES[0], k_ENTRY_LEN), 0);
+    BMQTST_ASSERT_EQ(ledger->readRecord(entry, k_ENTRY_LEN, recordId2),
+                     LedgerOpResult::e_SUCCESS);
+    BMQTST_ASSERT_EQ(bsl::memcmp(entry, k_ENTRIES[1], k_ENTRY_LEN), 0);
+
+    BSLS_ASSERT_OPT(ledger->close() == LedgerOpResult::e_SUCCESS);
+}
+
+static void test14_rollOverCleanupWhileWriting()
+// ------------------------------------------------------------------------
+// ROLL OVER CLEANUP WHILE WRITING
+//
+// Concerns:
+//   When not keeping old logs, the old log is cleaned up after 'rollOver'
+//   by an event of the scheduler thread.  Verify that writing to the ledger
+//   while these cleanups are in progress is safe, i.e. that the list of
+//   logs is only modified by the thread writing to the ledger, through the
+//   configured 'ExecuteCb', and that all old logs are eventually removed.
+//
+// Testing:
+//   rollOver()
+//   mqbsi::LedgerConfig::setExecuteCallback()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("ROLL OVER CLEANUP WHILE WRITING");
+
+    const int                k_NUM_ROLLOVERS      = 20;
+    const int                k_NUM_WRITES_PER_LOG = 200;
+    const int                k_MAX_NUM_DRAINS     = 10000;
+    const bsls::Types::Int64 k_MAX_LOG_SIZE       = 1024 * 1024;
+
+    bdlmt::EventScheduler scheduler(bsls::SystemClockType::e_MONOTONIC,
+                                    bmqtst::TestHelperUtil::allocator());
+    BSLS_ASSERT_OPT(scheduler.start() == 0);
+
+    WriterQueue     writerQueue(bmqtst::TestHelperUtil::allocator());
+    bsls::AtomicInt numCleanups(0);
+    bsls::AtomicInt numForeignCleanups(0);
+
+    Tester tester(false, k_MAX_LOG_SIZE);
+    tester.config()
+        .setScheduler(&scheduler)
+        .setExecuteCallback(bdlf::BindUtil::bind(&WriterQueue::execute,
+                                                 &writerQueue,
+                                                 bdlf::PlaceHolders::_1))
+        .setCleanupCallback(
+            bdlf::BindUtil::bind(&countingCleanupCallback,
+                                 &numCleanups,
+                                 &numForeignCleanups,
+                                 bslmt::ThreadUtil::selfIdAsUint64(),
+                                 bdlf::PlaceHolders::_1));  // logPath
+
+    bslma::ManagedPtr<mqbsi::Ledger> ledger = tester.createNewLedger(false);
+    BSLS_ASSERT_OPT(ledger->open(mqbsi::Ledger::e_CREATE_IF_MISSING) ==
+                    LedgerOpResult::e_SUCCESS);
+
+    LedgerRecordId recordId;
+    for (int i = 0; i < k_NUM_ROLLOVERS; ++i) {
+        BMQTST_ASSERT_EQ_D(i, ledger->rollOver(), LedgerOpResult::e_SUCCESS);
+
+        // Keep writing while the scheduler thread processes the cleanup of
+        // the old log, executing the cleanups it enqueues as we go.
+        for (int j = 0; j < k_NUM_WRITES_PER_LOG; ++j) {
+            BMQTST_ASSERT_EQ_D(i << ", " << j,
+                               ledger->writeRecord(&recordId,
+                                                   k_ENTRIES[j %
+                                                             k_NUM_ENTRIES],
+                                                   0,
+                                                   k_ENTRY_LEN),
+                               LedgerOpResult::e_SUCCESS);
+            BMQTST_ASSERT_EQ_D(i << ", " << j,
+                               recordId.logId(),
+                               ledger->currentLog()->logConfig().logId());
+            writerQueue.drain();
+        }
+    }
+
+    // Wait for the cleanup of all the old logs
+    for (int i = 0; i < k_MAX_NUM_DRAINS && ledger->numLogs() > 1U; ++i) {
+        bslmt::ThreadUtil::microSleep(1000);
+        writerQueue.drain();
+    }
+
+    scheduler.stop();
+
+    BMQTST_ASSERT_EQ(ledger->numLogs(), 1U);
+    BMQTST_ASSERT_EQ(numCleanups.load(), k_NUM_ROLLOVERS);
+    BMQTST_ASSERT_EQ(numForeignCleanups.load(), 0);
+    BMQTST_ASSERT_EQ(ledger->totalNumBytes(),
+                     k_NUM_WRITES_PER_LOG * k_ENTRY_LEN);
+
+    // Records of the current log can still be read
+    char entry[k_ENTRY_LEN];
+    BMQTST_ASSERT_EQ(ledger->readRecord(entry, k_ENTRY_LEN, recordId),
+                     LedgerOpResult::e_SUCCESS);
+    BMQTST_ASSERT_EQ(bsl::memcmp(entry,
+                                 k_ENTRIES[(k_NUM_WRITES_PER_LOG - 1) %
+                                           k_NUM_ENTRIES],
+                                 k_ENTRY_LEN),
+                     0);
+
+    BSLS_ASSERT_OPT(ledger->close() == LedgerOpResult::e_SUCCESS);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1753,6 +1986,8 @@ int main(int argc, char* argv[])
         case 10: test10_readRecordBlob(); break;
         case 11: test11_aliasRecordRaw(); break;
         case 12: test12_aliasRecordBlob(); break;
+        case 13: test13_rollOver(); break;
+        case 14: test14_rollOverCleanupWhileWriting(); break;
         default: {
             cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
             bmqtst::TestHelperUtil::testStatus() = -1;
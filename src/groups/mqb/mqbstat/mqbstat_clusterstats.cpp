@@ -30,6 +30,7 @@
 #include <bdlma_localsequentialallocator.h>
 #include <bsl_limits.h>
 #include <bsl_ostream.h>
+#include <bsl_utility.h>
 #include <bsla_annotations.h>
 #include <bslmf_assert.h>
 #include <bslmf_movableref.h>
@@ -155,6 +156,12 @@ bsls::Types::Int64 ClusterStats::getValue(const bmqst::StatContext& context,
         return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
                                                                        : value;
     }
+    case Stat::e_PARTITION_ROLLOVER_STALL_TIME: {
+        const bsls::Types::Int64 value =
+            STAT_RANGE(rangeMax, e_PARTITION_ROLLOVER_STALL_TIME);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
     case Stat::e_PARTITION_DATA_CONTENT: {
         const bsls::Types::Int64 value = STAT_RANGE(rangeMax,
                                                     e_PARTITION_DATA_BYTES);
@@ -210,6 +217,72 @@ bsls::Types::Int64 ClusterStats::getValue(const bmqst::StatContext& context,
         return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
                                                                        : value;
     }
+    case Stat::e_PARTITION_COMMIT_BATCH_SIZE_AVG: {
+        const bsls::Types::Int64 value =
+            STAT_RANGE(averagePerEvent, e_PARTITION_COMMIT_BATCH_SIZE);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0
+                                                                       : value;
+    }
+    case Stat::e_PARTITION_COMMIT_BATCH_SIZE_MAX: {
+        const bsls::Types::Int64 value =
+            STAT_RANGE(rangeMax, e_PARTITION_COMMIT_BATCH_SIZE);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
+    case Stat::e_PARTITION_COMMIT_BATCH_SIZE_P50: {
+        return STAT_RANGE(percentile50, e_PARTITION_COMMIT_BATCH_SIZE);
+    }
+    case Stat::e_PARTITION_COMMIT_BATCH_SIZE_P90: {
+        return STAT_RANGE(percentile90, e_PARTITION_COMMIT_BATCH_SIZE);
+    }
+    case Stat::e_PARTITION_COMMIT_BATCH_SIZE_P99: {
+        return STAT_RANGE(percentile99, e_PARTITION_COMMIT_BATCH_SIZE);
+    }
+    case Stat::e_PARTITION_COMMIT_BATCH_SIZE_P999: {
+        return STAT_RANGE(percentile999, e_PARTITION_COMMIT_BATCH_SIZE);
+    }
+    case Stat::e_PARTITION_SYNC_TIME_NS_AVG: {
+        const bsls::Types::Int64 value =
+            STAT_RANGE(averagePerEvent, e_PARTITION_SYNC_TIME_NS);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0
+                                                                       : value;
+    }
+    case Stat::e_PARTITION_SYNC_TIME_NS_MAX: {
+        const bsls::Types::Int64 value = STAT_RANGE(rangeMax,
+                                                    e_PARTITION_SYNC_TIME_NS);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
+    case Stat::e_PARTITION_SYNC_TIME_NS_P50: {
+        return STAT_RANGE(percentile50, e_PARTITION_SYNC_TIME_NS);
+    }
+    case Stat::e_PARTITION_SYNC_TIME_NS_P90: {
+        return STAT_RANGE(percentile90, e_PARTITION_SYNC_TIME_NS);
+    }
+    case Stat::e_PARTITION_SYNC_TIME_NS_P99: {
+        return STAT_RANGE(percentile99, e_PARTITION_SYNC_TIME_NS);
+    }
+    case Stat::e_PARTITION_SYNC_TIME_NS_P999: {
+        return STAT_RANGE(percentile999, e_PARTITION_SYNC_TIME_NS);
+    }
+    case Stat::e_PARTITION_REPLICA_RECEIPT_TIME_NS_AVG: {
+        const bsls::Types::Int64 value =
+            STAT_RANGE(averagePerEvent, e_PARTITION_REPLICA_RECEIPT_TIME_NS);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0
+                                                                       : value;
+    }
+    case Stat::e_PARTITION_REPLICA_RECEIPT_TIME_NS_MAX: {
+        const bsls::Types::Int64 value =
+            STAT_RANGE(rangeMax, e_PARTITION_REPLICA_RECEIPT_TIME_NS);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
+    case Stat::e_PARTITION_REPLICA_UNRECEIPTED_BYTES_MAX: {
+        const bsls::Types::Int64 value =
+            STAT_RANGE(rangeMax, e_PARTITION_REPLICA_UNRECEIPTED_BYTES);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
 
     default: {
         BSLS_ASSERT_SAFE(false && "Attempting to access an unknown stat");
@@ -276,7 +349,7 @@ void ClusterStats::initialize(const bsl::string&  name,
                                                 &localAllocator)),
             allocator);
         bsl::shared_ptr<PartitionStats> partitionStats_sp;
-        partitionStats_sp.createInplace(allocator, statContext_sp);
+        partitionStats_sp.createInplace(allocator, statContext_sp, allocator);
         partitionStats_sp->setNodeRole(
             PartitionStats::PrimaryStatus::e_UNKNOWN);
         d_partitionsStats.emplace_back(
@@ -346,12 +419,43 @@ void ClusterStats::setPartitionCfgBytes(bsls::Types::Int64 dataBytes,
 // --------------------
 
 PartitionStats::PartitionStats(
-    const bsl::shared_ptr<bmqst::StatContext>& statContext)
+    const bsl::shared_ptr<bmqst::StatContext>& statContext,
+    bslma::Allocator*                          allocator)
 : d_statContext_sp(statContext)
+, d_replicaStatContexts(allocator)
+, d_allocator_p(allocator)
 {
     // NOTHING
 }
 
+bmqst::StatContext*
+PartitionStats::replicaStatContext(int                nodeId,
+                                   const bsl::string& nodeDescription)
+{
+    ReplicaStatContexts::const_iterator it = d_replicaStatContexts.find(
+        nodeId);
+    if (it != d_replicaStatContexts.end()) {
+        return it->second.get();  // RETURN
+    }
+
+    bdlma::LocalSequentialAllocator<1024> localAllocator(d_allocator_p);
+    bsl::shared_ptr<bmqst::StatContext>   statContext_sp(
+        d_statContext_sp->addSubcontext(
+            bmqst::StatContextConfiguration(nodeDescription,
+                                            &localAllocator)),
+        d_allocator_p);
+    d_replicaStatContexts.insert(bsl::make_pair(nodeId, statContext_sp));
+
+    return statContext_sp.get();
+}
+
+void PartitionStats::clearReplicas()
+{
+    // Releasing the subcontexts removes them from the stat context tree at
+    // the next snapshot.
+    d_replicaStatContexts.clear();
+}
+
 // -------------------------
 // struct ClusterStats::Role
 // -------------------------
@@ -396,6 +500,8 @@ const char* ClusterStats::Stat::toString(Stat::Enum value)
                      "cluster_partition_cfg_journal_bytes")
         MQBSTAT_CASE(e_PARTITION_PRIMARY_STATUS, "partition_primary_status")
         MQBSTAT_CASE(e_PARTITION_ROLLOVER_TIME, "partition_rollover_time_ns")
+        MQBSTAT_CASE(e_PARTITION_ROLLOVER_STALL_TIME,
+                     "partition_rollover_stall_time_ns")
         MQBSTAT_CASE(e_PARTITION_DATA_CONTENT, "partition_data_content_bytes")
         MQBSTAT_CASE(e_PARTITION_JOURNAL_CONTENT,
                      "partition_journal_content_bytes")
@@ -411,6 +517,36 @@ const char* ClusterStats::Stat::toString(Stat::Enum value)
                      "partition_replication_time_avg_ns")
         MQBSTAT_CASE(e_PARTITION_REPLICATION_TIME_NS_MAX,
                      "partition_replication_time_max_ns")
+        MQBSTAT_CASE(e_PARTITION_COMMIT_BATCH_SIZE_AVG,
+                     "partition_commit_batch_size_avg")
+        MQBSTAT_CASE(e_PARTITION_COMMIT_BATCH_SIZE_MAX,
+                     "partition_commit_batch_size_max")
+        MQBSTAT_CASE(e_PARTITION_COMMIT_BATCH_SIZE_P50,
+                     "partition_commit_batch_size_p50")
+        MQBSTAT_CASE(e_PARTITION_COMMIT_BATCH_SIZE_P90,
+                     "partition_commit_batch_size_p90")
+        MQBSTAT_CASE(e_PARTITION_COMMIT_BATCH_SIZE_P99,
+                     "partition_commit_batch_size_p99")
+        MQBSTAT_CASE(e_PARTITION_COMMIT_BATCH_SIZE_P999,
+                     "partition_commit_batch_size_p999")
+        MQBSTAT_CASE(e_PARTITION_SYNC_TIME_NS_AVG,
+                     "partition_sync_time_avg_ns")
+        MQBSTAT_CASE(e_PARTITION_SYNC_TIME_NS_MAX,
+                     "partition_sync_time_max_ns")
+        MQBSTAT_CASE(e_PARTITION_SYNC_TIME_NS_P50,
+                     "partition_sync_time_p50_ns")
+        MQBSTAT_CASE(e_PARTITION_SYNC_TIME_NS_P90,
+                     "partition_sync_time_p90_ns")
+        MQBSTAT_CASE(e_PARTITION_SYNC_TIME_NS_P99,
+                     "partition_sync_time_p99_ns")
+        MQBSTAT_CASE(e_PARTITION_SYNC_TIME_NS_P999,
+                     "partition_sync_time_p999_ns")
+        MQBSTAT_CASE(e_PARTITION_REPLICA_RECEIPT_TIME_NS_AVG,
+                     "partition_replica_receipt_time_avg_ns")
+        MQBSTAT_CASE(e_PARTITION_REPLICA_RECEIPT_TIME_NS_MAX,
+                     "partition_replica_receipt_time_max_ns")
+        MQBSTAT_CASE(e_PARTITION_REPLICA_UNRECEIPTED_BYTES_MAX,
+                     "partition_replica_unreceipted_bytes_max")
     default:
         BSLS_ASSERT(false && "invalid enumerator");
         BSLS_ASSERT_INVOKE_NORETURN("");
@@ -458,20 +594,28 @@ ClusterStatsUtil::initializeStatContextCluster(int               historySize,
         .value("cluster.partition.cfg_journal_bytes")
         .value("partition_status")
         .value("partition.rollover_time", bmqst::StatValue::e_DISCRETE)
+        .value("partition.rollover_stall_time", bmqst::StatValue::e_DISCRETE)
         .value("partition.data_bytes", bmqst::StatValue::e_DISCRETE)
         .value("partition.journal_bytes", bmqst::StatValue::e_DISCRETE)
         .value("partition.data_offset_bytes")
         .value("partition.journal_offset_bytes")
         .value("partition.sequence_number")
-        .value("partition.replication_time_ns", bmqst::StatValue::e_DISCRETE);
-
-    // NOTE: For the clusters, the stat context will have two levels of
-    //       children, first level is per cluster, and second level is per
-    //       partition in the cluster.  For convenience, we configure the stat
-    //       context at the root, meaning that not all columns will be relevant
-    //       to all rows, but this is ok, the drawback is a slight waste of
-    //       memory - which is acceptable here since a broker will not have
-    //       thousands of clusters and partitions.
+        .value("partition.replication_time_ns", bmqst::StatValue::e_DISCRETE)
+        .value("partition.commit_batch_size", bmqst::StatValue::e_HISTOGRAM)
+        .value("partition.sync_time_ns", bmqst::StatValue::e_HISTOGRAM)
+        .value("partition.replica_receipt_time_ns",
+               bmqst::StatValue::e_DISCRETE)
+        .value("partition.replica_unreceipted_bytes");
+
+    // NOTE: For the clusters, the stat context will have three levels of
+    //       children, first level is per cluster, second level is per
+    //       partition in the cluster, and third level is per replica of the
+    //       partition (only populated on the primary of the partition).
+    //       For convenience, we configure the stat context at the root,
+    //       meaning that not all columns will be relevant to all rows, but
+    //       this is ok, the drawback is a slight waste of memory - which is
+    //       acceptable here since a broker will not have thousands of
+    //       clusters, partitions and replicas.
 
     return bsl::shared_ptr<bmqst::StatContext>(
         new (*allocator) bmqst::StatContext(config, allocator),
@@ -38,6 +38,7 @@
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
+#include <bsl_unordered_map.h>
 #include <bsl_vector.h>
 #include <bsla_annotations.h>
 #include <bslma_allocator.h>
@@ -103,6 +104,12 @@ class ClusterStats {
             /// happened during the report interval, then the maximum time is
             /// returned.
             e_PARTITION_ROLLOVER_TIME,
+            /// Time in nanoseconds the partition was stalled creating the next
+            /// file set during rollover, which is 0 when that file set had
+            /// been created in the background.  Note that in case when more
+            /// than one rollover operations happened during the report
+            /// interval, then the maximum time is returned.
+            e_PARTITION_ROLLOVER_STALL_TIME,
             /// Maximum observed outstanding bytes in the data file of the
             /// partition.
             e_PARTITION_DATA_CONTENT,
@@ -128,7 +135,67 @@ class ClusterStats {
             /// Maximum observed time in nanoseconds it took to store a message
             /// record at primary and replicate it to a majority of nodes in
             /// the cluster.
-            e_PARTITION_REPLICATION_TIME_NS_MAX
+            e_PARTITION_REPLICATION_TIME_NS_MAX,
+            /// Average observed number of records made durable by one group
+            /// commit of the partition.
+            e_PARTITION_COMMIT_BATCH_SIZE_AVG,
+            /// Maximum observed number of records made durable by one group
+            /// commit of the partition.
+            e_PARTITION_COMMIT_BATCH_SIZE_MAX,
+            /// 50th percentile of the observed number of records made
+            /// durable by one group commit of the partition.
+            e_PARTITION_COMMIT_BATCH_SIZE_P50,
+            /// 90th percentile of the observed number of records made
+            /// durable by one group commit of the partition.
+            e_PARTITION_COMMIT_BATCH_SIZE_P90,
+            /// 99th percentile of the observed number of records made
+            /// durable by one group commit of the partition.
+            e_PARTITION_COMMIT_BATCH_SIZE_P99,
+            /// 99.9th percentile of the observed number of records made
+            /// durable by one group commit of the partition.
+            e_PARTITION_COMMIT_BATCH_SIZE_P999,
+            /// Average observed time in nanoseconds it took to sync the files
+            /// of the partition to disk for one group commit.
+            e_PARTITION_SYNC_TIME_NS_AVG,
+            /// Maximum observed time in nanoseconds it took to sync the files
+            /// of the partition to disk for one group commit.
+            e_PARTITION_SYNC_TIME_NS_MAX,
+            /// 50th percentile of the observed time in nanoseconds it took
+            /// to sync the files of the partition to disk for one group
+            /// commit.
+            e_PARTITION_SYNC_TIME_NS_P50,
+            /// 90th percentile of the observed time in nanoseconds it took
+            /// to sync the files of the partition to disk for one group
+            /// commit.
+            e_PARTITION_SYNC_TIME_NS_P90,
+            /// 99th percentile of the observed time in nanoseconds it took
+            /// to sync the files of the partition to disk for one group
+            /// commit.
+            e_PARTITION_SYNC_TIME_NS_P99,
+            /// 99.9th percentile of the observed time in nanoseconds it took
+            /// to sync the files of the partition to disk for one group
+            /// commit.
+            e_PARTITION_SYNC_TIME_NS_P999,
+
+            // ReplicaStats: those metrics make sense only from the 'replica
+            //               level' stat context, child of the 'partition
+            //               level' one, and are only reported by the primary
+            //               of the partition.  Only the batches carrying
+            //               records of strong consistency queues are
+            //               measured, since replicas do not send Receipts
+            //               for the other ones.
+
+            /// Average observed time in nanoseconds between the primary
+            /// sending a batch of records to the replica and receiving the
+            /// Receipt of the replica for it.
+            e_PARTITION_REPLICA_RECEIPT_TIME_NS_AVG,
+            /// Maximum observed time in nanoseconds between the primary
+            /// sending a batch of records to the replica and receiving the
+            /// Receipt of the replica for it.
+            e_PARTITION_REPLICA_RECEIPT_TIME_NS_MAX,
+            /// Maximum number of bytes replicated by the primary and not yet
+            /// Receipted by the replica, sampled at each snapshot.
+            e_PARTITION_REPLICA_UNRECEIPTED_BYTES_MAX
         };
 
         // CLASS METHODS
@@ -180,14 +247,10 @@ class ClusterStats {
         static const char* toAscii(Enum value);
     };
 
-  private:
-    // FRIENDS
-    friend class PartitionStats;
-
-    // PRIVATE TYPES
-
     /// Namespace for the constants of stat values that applies to the
-    /// partition.
+    /// partition.  Consumers needing more than the values exposed through
+    /// `Stat` (e.g., the buckets of a histogram value) use these indices to
+    /// access the `bmqst::StatValue` directly.
     struct ClusterStatsIndex {
         enum Enum {
             // Cluster stats
@@ -219,6 +282,9 @@ class ClusterStats {
             e_PRIMARY_STATUS,
             /// Value: Nanoseconds time it took for rolling over the partition.
             e_PARTITION_ROLLOVER_TIME,
+            /// Value: Nanoseconds time the partition was stalled creating the
+            ///        next file set during rollover.
+            e_PARTITION_ROLLOVER_STALL_TIME,
             /// Value: Outstanding bytes in the data file of the partition.
             e_PARTITION_DATA_BYTES,
             /// Value: Outstanding bytes in the journal file of the partition.
@@ -231,7 +297,20 @@ class ClusterStats {
             e_PARTITION_SEQUENCE_NUMBER,
             /// Value: Time in nanoseconds it took for replication of a new
             /// entry in journal file.
-            e_PARTITION_REPLICATION_TIME_NS
+            e_PARTITION_REPLICATION_TIME_NS,
+            /// Value: Number of records made durable by a group commit.
+            e_PARTITION_COMMIT_BATCH_SIZE,
+            /// Value: Time in nanoseconds it took to sync the partition files
+            /// to disk for a group commit.
+            e_PARTITION_SYNC_TIME_NS,
+
+            // Per replica stats
+
+            /// Value: Time in nanoseconds between sending a batch of records
+            ///        to a replica and receiving its Receipt.
+            e_PARTITION_REPLICA_RECEIPT_TIME_NS,
+            /// Value: Bytes replicated and not yet Receipted by a replica.
+            e_PARTITION_REPLICA_UNRECEIPTED_BYTES
         };
     };
 
@@ -244,6 +323,10 @@ class ClusterStats {
         };
     };
 
+  private:
+    // FRIENDS
+    friend class PartitionStats;
+
     // DATA
 
     /// StatContext for the cluster
@@ -355,11 +438,23 @@ class PartitionStats {
     };
 
   private:
+    // PRIVATE TYPES
+
+    /// Map of NodeId -> StatContext of the replica having this NodeId.
+    typedef bsl::unordered_map<int, bsl::shared_ptr<bmqst::StatContext> >
+        ReplicaStatContexts;
+
     // DATA
 
     /// StatContext for the partition
     bsl::shared_ptr<bmqst::StatContext> d_statContext_sp;
 
+    /// StatContext for each replica of the partition, created as a child of
+    /// the above `d_statContext_sp` when first reported to.
+    ReplicaStatContexts d_replicaStatContexts;
+
+    bslma::Allocator* d_allocator_p;
+
   private:
     // NOT IMPLEMENTED
     PartitionStats(const PartitionStats&) BSLS_CPP11_DELETED;
@@ -367,24 +462,72 @@ class PartitionStats {
     /// Copy constructor and assignment operator are not implemented.
     PartitionStats& operator=(const PartitionStats&) BSLS_CPP11_DELETED;
 
+    // PRIVATE MANIPULATORS
+
+    /// Return the StatContext of the replica having the specified `nodeId`,
+    /// creating it with the specified `nodeDescription` as name if needed.
+    bmqst::StatContext* replicaStatContext(int                nodeId,
+                                           const bsl::string& nodeDescription);
+
   public:
     // CREATORS
 
-    /// Create a new object in an uninitialized state.
-    explicit PartitionStats(
-        const bsl::shared_ptr<bmqst::StatContext>& statContext);
+    /// Create a new object in an uninitialized state, reporting to the
+    /// specified `statContext` and using the specified `allocator`.
+    PartitionStats(const bsl::shared_ptr<bmqst::StatContext>& statContext,
+                   bslma::Allocator*                          allocator);
 
     /// Set the time in nanoseconds it took for the rollover operation to the
     /// specified `value`.
     void setRoloverTime(bsls::Types::Int64 value);
 
+    /// Set the time in nanoseconds the rollover operation was stalled
+    /// creating the next file set to the specified `value`.
+    void setRolloverStallTime(bsls::Types::Int64 value);
+
     /// Set the time in nanoseconds it took for the replication of a new entry
     /// in journal file to the specified `value`.
     void setReplicationTime(bsls::Types::Int64 value);
 
+    /// Set the number of records made durable by a group commit to the
+    /// specified `value`.
+    void setCommitBatchSize(bsls::Types::Int64 value);
+
+    /// Set the time in nanoseconds it took to sync the partition files to disk
+    /// for a group commit to the specified `value`.
+    void setSyncTime(bsls::Types::Int64 value);
+
     /// Set the primary status of the partition to the specified `value`.
     void setNodeRole(PrimaryStatus::Enum value);
 
+    /// Set the time in nanoseconds between sending a batch of records to
+    /// the replica having the specified `nodeId` and `nodeDescription` and
+    /// receiving its Receipt to the specified `value`.
+    ///
+    /// THREAD: This method must be invoked from the dispatcher thread of
+    ///         the partition.
+    void setReplicaReceiptTime(int                nodeId,
+                               const bsl::string& nodeDescription,
+                               bsls::Types::Int64 value);
+
+    /// Set the number of bytes replicated to and not yet Receipted by the
+    /// replica having the specified `nodeId` and `nodeDescription` to the
+    /// specified `value`.  The value is kept until set again, so that it is
+    /// sampled by every snapshot of the stat context.
+    ///
+    /// THREAD: This method must be invoked from the dispatcher thread of
+    ///         the partition.
+    void setReplicaUnreceiptedBytes(int                nodeId,
+                                    const bsl::string& nodeDescription,
+                                    bsls::Types::Int64 value);
+
+    /// Remove the StatContext of every replica of the partition, e.g.
+    /// because the primary of the partition changed.
+    ///
+    /// THREAD: This method must be invoked from the dispatcher thread of
+    ///         the partition.
+    void clearReplicas();
+
     /// Set the partition outstanding bytes of the partition data and journal
     /// files to the corresponding specified `outstandingDataBytes`,
     /// `outstandingJournalBytes`, `offsetDataBytes`, `offsetJournalBytes` and
@@ -479,6 +622,13 @@ inline void PartitionStats::setRoloverTime(bsls::Types::Int64 value)
         value);
 }
 
+inline void PartitionStats::setRolloverStallTime(bsls::Types::Int64 value)
+{
+    d_statContext_sp->reportValue(
+        ClusterStats::ClusterStatsIndex::e_PARTITION_ROLLOVER_STALL_TIME,
+        value);
+}
+
 inline void PartitionStats::setReplicationTime(bsls::Types::Int64 value)
 {
     d_statContext_sp->reportValue(
@@ -486,6 +636,20 @@ inline void PartitionStats::setReplicationTime(bsls::Types::Int64 value)
         value);
 }
 
+inline void PartitionStats::setCommitBatchSize(bsls::Types::Int64 value)
+{
+    d_statContext_sp->reportValue(
+        ClusterStats::ClusterStatsIndex::e_PARTITION_COMMIT_BATCH_SIZE,
+        value);
+}
+
+inline void PartitionStats::setSyncTime(bsls::Types::Int64 value)
+{
+    d_statContext_sp->reportValue(
+        ClusterStats::ClusterStatsIndex::e_PARTITION_SYNC_TIME_NS,
+        value);
+}
+
 inline void PartitionStats::setNodeRole(PrimaryStatus::Enum value)
 {
     d_statContext_sp->setValue(
@@ -493,6 +657,28 @@ inline void PartitionStats::setNodeRole(PrimaryStatus::Enum value)
         value);
 }
 
+inline void
+PartitionStats::setReplicaReceiptTime(int                nodeId,
+                                      const bsl::string& nodeDescription,
+                                      bsls::Types::Int64 value)
+{
+    replicaStatContext(nodeId, nodeDescription)
+        ->reportValue(ClusterStats::ClusterStatsIndex::
+                          e_PARTITION_REPLICA_RECEIPT_TIME_NS,
+                      value);
+}
+
+inline void
+PartitionStats::setReplicaUnreceiptedBytes(int                nodeId,
+                                           const bsl::string& nodeDescription,
+                                           bsls::Types::Int64 value)
+{
+    replicaStatContext(nodeId, nodeDescription)
+        ->setValue(ClusterStats::ClusterStatsIndex::
+                       e_PARTITION_REPLICA_UNRECEIPTED_BYTES,
+                   value);
+}
+
 inline void
 PartitionStats::setPartitionBytes(bsls::Types::Uint64 outstandingDataBytes,
                                   bsls::Types::Uint64 outstandingJournalBytes,
@@ -161,6 +161,20 @@ bsls::Types::Int64 DispatcherStats::getValue(const bmqst::StatContext& context,
     }
     case Stat::e_QUEUE_TIME_ABS_MAX: {
         return STAT_SINGLE_ABS(absoluteMax, DispatcherStatsIndex::e_STAT_TIME);
+    }
+    case Stat::e_BATCH_COUNT: {
+        return STAT_RANGE(eventsDifference,
+                          DispatcherStatsIndex::e_STAT_BATCH);
+    }
+    case Stat::e_BATCH_SIZE_AVG: {
+        const bsls::Types::Int64 avg =
+            STAT_RANGE(averagePerEvent, DispatcherStatsIndex::e_STAT_BATCH);
+        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+    }
+    case Stat::e_BATCH_SIZE_MAX: {
+        const bsls::Types::Int64 max =
+            STAT_RANGE(rangeMax, DispatcherStatsIndex::e_STAT_BATCH);
+        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
     }
         CASE_PROCESSING(UNDEFINED)
         CASE_PROCESSING(DISPATCHER)
@@ -220,7 +234,8 @@ DispatcherStatsUtil::initializeStatContext(int               historySize,
         .value("processing_time_replication_receipt",
                bmqst::StatValue::e_DISCRETE)
         .value("queued_count")
-        .value("queued_time", bmqst::StatValue::e_DISCRETE);
+        .value("queued_time", bmqst::StatValue::e_DISCRETE)
+        .value("batch_size", bmqst::StatValue::e_DISCRETE);
 
     return bsl::shared_ptr<bmqst::StatContext>(
         new (*allocator) bmqst::StatContext(config, allocator),
@@ -114,6 +114,9 @@ class DispatcherStats {
             e_PROCESSING_TIME_REPLICATION_RECEIPT_AVG,
             e_PROCESSING_TIME_REPLICATION_RECEIPT_SUM,
             e_PROCESSED_COUNT_REPLICATION_RECEIPT,
+            e_BATCH_COUNT,
+            e_BATCH_SIZE_AVG,
+            e_BATCH_SIZE_MAX,
         };
     };
 
@@ -140,6 +143,7 @@ class DispatcherStats {
             /// Other queue metrics
             e_STAT_QUEUE = 13,  // Queue/Dequeue
             e_STAT_TIME  = 14,  // Event queued time
+            e_STAT_BATCH = 15,  // Events processed between two flushes
         };
     };
 
@@ -170,6 +174,11 @@ class DispatcherStats {
                           int                 eventType,
                           bsls::Types::Int64  processedTime);
 
+    /// Update the `batch_size` field of the specified `queueStatContext`
+    /// with the specified `batchSize` number of events processed since the
+    /// last time the clients of the associated queue were flushed.
+    static void onBatch(bmqst::StatContext* queueStatContext, int batchSize);
+
   private:
     // NOT IMPLEMENTED
     DispatcherStats(const DispatcherStats&) BSLS_CPP11_DELETED;
@@ -250,6 +259,15 @@ inline void DispatcherStats::onProcess(bmqst::StatContext* queueStatContext,
     queueStatContext->reportValue(eventType, processedTime);
 }
 
+inline void DispatcherStats::onBatch(bmqst::StatContext* queueStatContext,
+                                     int                 batchSize)
+{
+    BSLS_ASSERT_SAFE(queueStatContext && "Stat context is not initialized");
+
+    queueStatContext->reportValue(DispatcherStatsIndex::e_STAT_BATCH,
+                                  batchSize);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
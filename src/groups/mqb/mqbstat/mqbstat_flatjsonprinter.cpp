@@ -224,6 +224,7 @@ class ClusterStatsTraversal {
     // PUBLIC TYPES
     typedef bsl::function<void(bsl::string_view          clusterName,
                                bsl::string_view          partitionName,
+                               bsl::string_view          replicaName,
                                const bmqst::StatContext& ctx)>
         OnClusterStatsVisited;
 
@@ -239,9 +240,10 @@ class ClusterStatsTraversal {
 
     // ACCESSORS
 
-    /// Iterate all clusters and partitions, calling the specified
+    /// Iterate all clusters, partitions and replicas, calling the specified
     /// `onClusterStatsVisited` for each stat context found.  For
-    /// cluster-level contexts, `partitionName` is empty.
+    /// cluster-level contexts, `partitionName` is empty, and for cluster and
+    /// partition level contexts, `replicaName` is empty.
     void
     forEachCluster(const OnClusterStatsVisited& onClusterStatsVisited) const;
 };
@@ -261,13 +263,29 @@ inline void ClusterStatsTraversal::forEachCluster(
          ++clusterIt) {
         const bsl::string_view clusterName = clusterIt->name();
 
-        onClusterStatsVisited(clusterName, bsl::string_view(), *clusterIt);
+        onClusterStatsVisited(clusterName,
+                              bsl::string_view(),
+                              bsl::string_view(),
+                              *clusterIt);
 
         for (bmqst::StatContextIterator partIt =
                  clusterIt->subcontextIterator();
              partIt;
              ++partIt) {
-            onClusterStatsVisited(clusterName, partIt->name(), *partIt);
+            onClusterStatsVisited(clusterName,
+                                  partIt->name(),
+                                  bsl::string_view(),
+                                  *partIt);
+
+            for (bmqst::StatContextIterator replicaIt =
+                     partIt->subcontextIterator();
+                 replicaIt;
+                 ++replicaIt) {
+                onClusterStatsVisited(clusterName,
+                                      partIt->name(),
+                                      replicaIt->name(),
+                                      *replicaIt);
+            }
         }
     }
 }
@@ -304,12 +322,22 @@ class ClustersVisitor {
 
     void operator()(bsl::string_view          clusterName,
                     bsl::string_view          partitionName,
+                    bsl::string_view          replicaName,
                     const bmqst::StatContext& ctx) const
     {
         typedef mqbstat::ClusterStats::Stat Stat;
 
         d_os << "{" << d_prefix;
-        if (partitionName.empty()) {
+        if (!replicaName.empty()) {
+            wrap("stat", "cluster_partition_replica");
+            wrap("cluster", clusterName);
+            wrap("partition", partitionName);
+            wrap("replica", replicaName);
+            metric(ctx, Stat::e_PARTITION_REPLICA_RECEIPT_TIME_NS_AVG);
+            metric(ctx, Stat::e_PARTITION_REPLICA_RECEIPT_TIME_NS_MAX);
+            metric(ctx, Stat::e_PARTITION_REPLICA_UNRECEIPTED_BYTES_MAX);
+        }
+        else if (partitionName.empty()) {
             wrap("stat", "cluster");
             wrap("cluster", clusterName);
             metric(ctx, Stat::e_CLUSTER_STATUS);
@@ -329,6 +357,7 @@ class ClustersVisitor {
             wrap("partition", partitionName);
             metric(ctx, Stat::e_PARTITION_PRIMARY_STATUS);
             metric(ctx, Stat::e_PARTITION_ROLLOVER_TIME);
+            metric(ctx, Stat::e_PARTITION_ROLLOVER_STALL_TIME);
             metric(ctx, Stat::e_PARTITION_DATA_CONTENT);
             metric(ctx, Stat::e_PARTITION_JOURNAL_CONTENT);
             metric(ctx, Stat::e_PARTITION_DATA_OFFSET);
@@ -338,6 +367,18 @@ class ClustersVisitor {
             metric(ctx, Stat::e_PARTITION_SEQUENCE_NUMBER);
             metric(ctx, Stat::e_PARTITION_REPLICATION_TIME_NS_AVG);
             metric(ctx, Stat::e_PARTITION_REPLICATION_TIME_NS_MAX);
+            metric(ctx, Stat::e_PARTITION_COMMIT_BATCH_SIZE_AVG);
+            metric(ctx, Stat::e_PARTITION_COMMIT_BATCH_SIZE_MAX);
+            metric(ctx, Stat::e_PARTITION_COMMIT_BATCH_SIZE_P50);
+            metric(ctx, Stat::e_PARTITION_COMMIT_BATCH_SIZE_P90);
+            metric(ctx, Stat::e_PARTITION_COMMIT_BATCH_SIZE_P99);
+            metric(ctx, Stat::e_PARTITION_COMMIT_BATCH_SIZE_P999);
+            metric(ctx, Stat::e_PARTITION_SYNC_TIME_NS_AVG);
+            metric(ctx, Stat::e_PARTITION_SYNC_TIME_NS_MAX);
+            metric(ctx, Stat::e_PARTITION_SYNC_TIME_NS_P50);
+            metric(ctx, Stat::e_PARTITION_SYNC_TIME_NS_P90);
+            metric(ctx, Stat::e_PARTITION_SYNC_TIME_NS_P99);
+            metric(ctx, Stat::e_PARTITION_SYNC_TIME_NS_P999);
         }
         d_os << "}" << bsl::endl;
     }
@@ -97,6 +97,10 @@ struct ConversionUtils {
         populateMetric(&values, ctx, Stat::e_ACK_ABS);
         populateMetric(&values, ctx, Stat::e_ACK_TIME_AVG);
         populateMetric(&values, ctx, Stat::e_ACK_TIME_MAX);
+        populateMetric(&values, ctx, Stat::e_ACK_TIME_P50);
+        populateMetric(&values, ctx, Stat::e_ACK_TIME_P90);
+        populateMetric(&values, ctx, Stat::e_ACK_TIME_P99);
+        populateMetric(&values, ctx, Stat::e_ACK_TIME_P999);
 
         populateMetric(&values, ctx, Stat::e_NACK_DELTA);
         populateMetric(&values, ctx, Stat::e_NACK_ABS);
@@ -105,12 +109,20 @@ struct ConversionUtils {
         populateMetric(&values, ctx, Stat::e_CONFIRM_ABS);
         populateMetric(&values, ctx, Stat::e_CONFIRM_TIME_AVG);
         populateMetric(&values, ctx, Stat::e_CONFIRM_TIME_MAX);
+        populateMetric(&values, ctx, Stat::e_CONFIRM_TIME_P50);
+        populateMetric(&values, ctx, Stat::e_CONFIRM_TIME_P90);
+        populateMetric(&values, ctx, Stat::e_CONFIRM_TIME_P99);
+        populateMetric(&values, ctx, Stat::e_CONFIRM_TIME_P999);
 
         populateMetric(&values, ctx, Stat::e_REJECT_ABS);
         populateMetric(&values, ctx, Stat::e_REJECT_DELTA);
 
         populateMetric(&values, ctx, Stat::e_QUEUE_TIME_AVG);
         populateMetric(&values, ctx, Stat::e_QUEUE_TIME_MAX);
+        populateMetric(&values, ctx, Stat::e_QUEUE_TIME_P50);
+        populateMetric(&values, ctx, Stat::e_QUEUE_TIME_P90);
+        populateMetric(&values, ctx, Stat::e_QUEUE_TIME_P99);
+        populateMetric(&values, ctx, Stat::e_QUEUE_TIME_P999);
 
         populateMetric(&values, ctx, Stat::e_GC_MSGS_DELTA);
         populateMetric(&values, ctx, Stat::e_GC_MSGS_ABS);
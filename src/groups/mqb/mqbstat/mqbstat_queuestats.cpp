@@ -142,16 +142,34 @@ const char* QueueStatsDomain::Stat::toString(Stat::Enum value)
         MQBSTAT_CASE(e_ACK_ABS, "queue_ack_msgs_abs")
         MQBSTAT_CASE(e_ACK_TIME_AVG, "queue_ack_time_avg")
         MQBSTAT_CASE(e_ACK_TIME_MAX, "queue_ack_time_max")
+        MQBSTAT_CASE(e_ACK_TIME_P50, "queue_ack_time_p50")
+        MQBSTAT_CASE(e_ACK_TIME_P90, "queue_ack_time_p90")
+        MQBSTAT_CASE(e_ACK_TIME_P99, "queue_ack_time_p99")
+        MQBSTAT_CASE(e_ACK_TIME_P999, "queue_ack_time_p999")
         MQBSTAT_CASE(e_NACK_DELTA, "queue_nack_msgs")
         MQBSTAT_CASE(e_NACK_ABS, "queue_nack_msgs_abs")
         MQBSTAT_CASE(e_CONFIRM_DELTA, "queue_confirm_msgs")
         MQBSTAT_CASE(e_CONFIRM_ABS, "queue_confirm_msgs_abs")
         MQBSTAT_CASE(e_CONFIRM_TIME_AVG, "queue_confirm_time_avg")
         MQBSTAT_CASE(e_CONFIRM_TIME_MAX, "queue_confirm_time_max")
+        MQBSTAT_CASE(e_CONFIRM_TIME_P50, "queue_confirm_time_p50")
+        MQBSTAT_CASE(e_CONFIRM_TIME_P90, "queue_confirm_time_p90")
+        MQBSTAT_CASE(e_CONFIRM_TIME_P99, "queue_confirm_time_p99")
+        MQBSTAT_CASE(e_CONFIRM_TIME_P999, "queue_confirm_time_p999")
         MQBSTAT_CASE(e_REJECT_ABS, "queue_reject_msgs_abs")
         MQBSTAT_CASE(e_REJECT_DELTA, "queue_reject_msgs")
         MQBSTAT_CASE(e_QUEUE_TIME_AVG, "queue_queue_time_avg")
         MQBSTAT_CASE(e_QUEUE_TIME_MAX, "queue_queue_time_max")
+        MQBSTAT_CASE(e_QUEUE_TIME_P50, "queue_queue_time_p50")
+        MQBSTAT_CASE(e_QUEUE_TIME_P90, "queue_queue_time_p90")
+        MQBSTAT_CASE(e_QUEUE_TIME_P99, "queue_queue_time_p99")
+        MQBSTAT_CASE(e_QUEUE_TIME_P999, "queue_queue_time_p999")
+        MQBSTAT_CASE(e_ROUTING_TIME_AVG, "queue_routing_time_avg")
+        MQBSTAT_CASE(e_ROUTING_TIME_MAX, "queue_routing_time_max")
+        MQBSTAT_CASE(e_ROUTING_TIME_P50, "queue_routing_time_p50")
+        MQBSTAT_CASE(e_ROUTING_TIME_P90, "queue_routing_time_p90")
+        MQBSTAT_CASE(e_ROUTING_TIME_P99, "queue_routing_time_p99")
+        MQBSTAT_CASE(e_ROUTING_TIME_P999, "queue_routing_time_p999")
         MQBSTAT_CASE(e_GC_MSGS_DELTA, "queue_gc_msgs")
         MQBSTAT_CASE(e_GC_MSGS_ABS, "queue_gc_msgs_abs")
         MQBSTAT_CASE(e_ROLE, "queue_role")
@@ -286,6 +304,18 @@ QueueStatsDomain::getValue(const bmqst::StatContext& context,
             STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_ACK_TIME);
         return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
     }
+    case QueueStatsDomain::Stat::e_ACK_TIME_P50: {
+        return STAT_RANGE(percentile50, DomainQueueStats::e_STAT_ACK_TIME);
+    }
+    case QueueStatsDomain::Stat::e_ACK_TIME_P90: {
+        return STAT_RANGE(percentile90, DomainQueueStats::e_STAT_ACK_TIME);
+    }
+    case QueueStatsDomain::Stat::e_ACK_TIME_P99: {
+        return STAT_RANGE(percentile99, DomainQueueStats::e_STAT_ACK_TIME);
+    }
+    case QueueStatsDomain::Stat::e_ACK_TIME_P999: {
+        return STAT_RANGE(percentile999, DomainQueueStats::e_STAT_ACK_TIME);
+    }
     case QueueStatsDomain::Stat::e_NACK_ABS: {
         return STAT_SINGLE(value, DomainQueueStats::e_STAT_NACK);
     }
@@ -305,6 +335,19 @@ QueueStatsDomain::getValue(const bmqst::StatContext& context,
             STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_CONFIRM_TIME);
         return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
     }
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P50: {
+        return STAT_RANGE(percentile50, DomainQueueStats::e_STAT_CONFIRM_TIME);
+    }
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P90: {
+        return STAT_RANGE(percentile90, DomainQueueStats::e_STAT_CONFIRM_TIME);
+    }
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P99: {
+        return STAT_RANGE(percentile99, DomainQueueStats::e_STAT_CONFIRM_TIME);
+    }
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P999: {
+        return STAT_RANGE(percentile999,
+                          DomainQueueStats::e_STAT_CONFIRM_TIME);
+    }
     case QueueStatsDomain::Stat::e_QUEUE_TIME_AVG: {
         const bsls::Types::Int64 avg =
             STAT_RANGE(averagePerEvent, DomainQueueStats::e_STAT_QUEUE_TIME);
@@ -315,6 +358,41 @@ QueueStatsDomain::getValue(const bmqst::StatContext& context,
             STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_QUEUE_TIME);
         return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
     }
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P50: {
+        return STAT_RANGE(percentile50, DomainQueueStats::e_STAT_QUEUE_TIME);
+    }
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P90: {
+        return STAT_RANGE(percentile90, DomainQueueStats::e_STAT_QUEUE_TIME);
+    }
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P99: {
+        return STAT_RANGE(percentile99, DomainQueueStats::e_STAT_QUEUE_TIME);
+    }
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P999: {
+        return STAT_RANGE(percentile999, DomainQueueStats::e_STAT_QUEUE_TIME);
+    }
+    case QueueStatsDomain::Stat::e_ROUTING_TIME_AVG: {
+        const bsls::Types::Int64 avg =
+            STAT_RANGE(averagePerEvent, DomainQueueStats::e_STAT_ROUTING_TIME);
+        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+    }
+    case QueueStatsDomain::Stat::e_ROUTING_TIME_MAX: {
+        const bsls::Types::Int64 max =
+            STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_ROUTING_TIME);
+        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
+    }
+    case QueueStatsDomain::Stat::e_ROUTING_TIME_P50: {
+        return STAT_RANGE(percentile50, DomainQueueStats::e_STAT_ROUTING_TIME);
+    }
+    case QueueStatsDomain::Stat::e_ROUTING_TIME_P90: {
+        return STAT_RANGE(percentile90, DomainQueueStats::e_STAT_ROUTING_TIME);
+    }
+    case QueueStatsDomain::Stat::e_ROUTING_TIME_P99: {
+        return STAT_RANGE(percentile99, DomainQueueStats::e_STAT_ROUTING_TIME);
+    }
+    case QueueStatsDomain::Stat::e_ROUTING_TIME_P999: {
+        return STAT_RANGE(percentile999,
+                          DomainQueueStats::e_STAT_ROUTING_TIME);
+    }
     case QueueStatsDomain::Stat::e_GC_MSGS_ABS: {
         return STAT_SINGLE(value, DomainQueueStats::e_STAT_GC_MSGS);
     }
@@ -532,6 +610,7 @@ void QueueStatsDomain::onEvent(EventType::Enum    type,
     // per entire queue instead
     case EventType::e_ACK: BSLA_FALLTHROUGH;
     case EventType::e_ACK_TIME: BSLA_FALLTHROUGH;
+    case EventType::e_ROUTING_TIME: BSLA_FALLTHROUGH;
     case EventType::e_NACK: BSLA_FALLTHROUGH;
     case EventType::e_CONFIRM: BSLA_FALLTHROUGH;
     case EventType::e_REJECT: BSLA_FALLTHROUGH;
@@ -782,12 +861,13 @@ QueueStatsUtil::initializeStatContextDomains(int               historySize,
         .value("messages")
         .value("bytes")
         .value("ack")
-        .value("ack_time", bmqst::StatValue::e_DISCRETE)
+        .value("ack_time", bmqst::StatValue::e_HISTOGRAM)
         .value("nack")
         .value("confirm")
-        .value("confirm_time", bmqst::StatValue::e_DISCRETE)
+        .value("confirm_time", bmqst::StatValue::e_HISTOGRAM)
         .value("reject")
-        .value("queue_time", bmqst::StatValue::e_DISCRETE)
+        .value("queue_time", bmqst::StatValue::e_HISTOGRAM)
+        .value("routing_time", bmqst::StatValue::e_HISTOGRAM)
         .value("gc")
         .value("push")
         .value("put")
@@ -922,6 +1002,26 @@ void QueueStatsUtil::initializeTableAndTipDomains(
                      bmqst::StatUtil::rangeMax,
                      start,
                      end);
+    schema.addColumn("ack_time_p50",
+                     DomainQueueStats::e_STAT_ACK_TIME,
+                     bmqst::StatUtil::percentile50,
+                     start,
+                     end);
+    schema.addColumn("ack_time_p90",
+                     DomainQueueStats::e_STAT_ACK_TIME,
+                     bmqst::StatUtil::percentile90,
+                     start,
+                     end);
+    schema.addColumn("ack_time_p99",
+                     DomainQueueStats::e_STAT_ACK_TIME,
+                     bmqst::StatUtil::percentile99,
+                     start,
+                     end);
+    schema.addColumn("ack_time_p999",
+                     DomainQueueStats::e_STAT_ACK_TIME,
+                     bmqst::StatUtil::percentile999,
+                     start,
+                     end);
     schema.addColumn("nack_delta",
                      DomainQueueStats::e_STAT_NACK,
                      bmqst::StatUtil::valueDifference,
@@ -950,6 +1050,26 @@ void QueueStatsUtil::initializeTableAndTipDomains(
                      bmqst::StatUtil::rangeMax,
                      start,
                      end);
+    schema.addColumn("confirm_time_p50",
+                     DomainQueueStats::e_STAT_CONFIRM_TIME,
+                     bmqst::StatUtil::percentile50,
+                     start,
+                     end);
+    schema.addColumn("confirm_time_p90",
+                     DomainQueueStats::e_STAT_CONFIRM_TIME,
+                     bmqst::StatUtil::percentile90,
+                     start,
+                     end);
+    schema.addColumn("confirm_time_p99",
+                     DomainQueueStats::e_STAT_CONFIRM_TIME,
+                     bmqst::StatUtil::percentile99,
+                     start,
+                     end);
+    schema.addColumn("confirm_time_p999",
+                     DomainQueueStats::e_STAT_CONFIRM_TIME,
+                     bmqst::StatUtil::percentile999,
+                     start,
+                     end);
     schema.addColumn("reject_delta",
                      DomainQueueStats::e_STAT_REJECT,
                      bmqst::StatUtil::valueDifference,
@@ -969,6 +1089,56 @@ void QueueStatsUtil::initializeTableAndTipDomains(
                      bmqst::StatUtil::rangeMax,
                      start,
                      end);
+    schema.addColumn("queue_time_p50",
+                     DomainQueueStats::e_STAT_QUEUE_TIME,
+                     bmqst::StatUtil::percentile50,
+                     start,
+                     end);
+    schema.addColumn("queue_time_p90",
+                     DomainQueueStats::e_STAT_QUEUE_TIME,
+                     bmqst::StatUtil::percentile90,
+                     start,
+                     end);
+    schema.addColumn("queue_time_p99",
+                     DomainQueueStats::e_STAT_QUEUE_TIME,
+                     bmqst::StatUtil::percentile99,
+                     start,
+                     end);
+    schema.addColumn("queue_time_p999",
+                     DomainQueueStats::e_STAT_QUEUE_TIME,
+                     bmqst::StatUtil::percentile999,
+                     start,
+                     end);
+    schema.addColumn("routing_time_avg",
+                     DomainQueueStats::e_STAT_ROUTING_TIME,
+                     bmqst::StatUtil::averagePerEvent,
+                     start,
+                     end);
+    schema.addColumn("routing_time_max",
+                     DomainQueueStats::e_STAT_ROUTING_TIME,
+                     bmqst::StatUtil::rangeMax,
+                     start,
+                     end);
+    schema.addColumn("routing_time_p50",
+                     DomainQueueStats::e_STAT_ROUTING_TIME,
+                     bmqst::StatUtil::percentile50,
+                     start,
+                     end);
+    schema.addColumn("routing_time_p90",
+                     DomainQueueStats::e_STAT_ROUTING_TIME,
+                     bmqst::StatUtil::percentile90,
+                     start,
+                     end);
+    schema.addColumn("routing_time_p99",
+                     DomainQueueStats::e_STAT_ROUTING_TIME,
+                     bmqst::StatUtil::percentile99,
+                     start,
+                     end);
+    schema.addColumn("routing_time_p999",
+                     DomainQueueStats::e_STAT_ROUTING_TIME,
+                     bmqst::StatUtil::percentile999,
+                     start,
+                     end);
     schema.addColumn("gc_msgs_delta",
                      DomainQueueStats::e_STAT_GC_MSGS,
                      bmqst::StatUtil::valueDifference,
@@ -1031,6 +1201,48 @@ void QueueStatsUtil::initializeTableAndTipDomains(
         .zeroString("")
         .extremeValueString("")
         .printAsNsTimeInterval();
+    tip->addColumn("queue_time_p50", "p50")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("queue_time_p90", "p90")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("queue_time_p99", "p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("queue_time_p999", "p99.9")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+
+    tip->setColumnGroup("Routing Time");
+    tip->addColumn("routing_time_avg", "avg")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("routing_time_max", "max")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("routing_time_p50", "p50")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("routing_time_p90", "p90")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("routing_time_p99", "p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("routing_time_p999", "p99.9")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
 
     tip->setColumnGroup("Ack");
     tip->addColumn("ack_delta", "delta").zeroString("");
@@ -1043,6 +1255,22 @@ void QueueStatsUtil::initializeTableAndTipDomains(
         .zeroString("")
         .extremeValueString("")
         .printAsNsTimeInterval();
+    tip->addColumn("ack_time_p50", "time p50")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("ack_time_p90", "time p90")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("ack_time_p99", "time p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("ack_time_p999", "time p99.9")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
     tip->setColumnGroup("Nack");
     tip->addColumn("nack_delta", "delta").zeroString("");
     tip->addColumn("nack_abs", "abs").zeroString("");
@@ -1058,6 +1286,22 @@ void QueueStatsUtil::initializeTableAndTipDomains(
         .zeroString("")
         .extremeValueString("")
         .printAsNsTimeInterval();
+    tip->addColumn("confirm_time_p50", "time p50")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("confirm_time_p90", "time p90")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("confirm_time_p99", "time p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("confirm_time_p999", "time p99.9")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
     tip->setColumnGroup("Reject");
     tip->addColumn("reject_delta", "delta").zeroString("");
     tip->addColumn("reject_abs", "abs").zeroString("");
@@ -95,6 +95,7 @@ class QueueStatsDomain {
             e_CONFIRM_TIME,
             e_REJECT,
             e_QUEUE_TIME,
+            e_ROUTING_TIME,
             e_PURGE,
             e_CHANGE_ROLE,
             e_CFG_MSGS,
@@ -129,16 +130,34 @@ class QueueStatsDomain {
             e_ACK_ABS,
             e_ACK_TIME_AVG,
             e_ACK_TIME_MAX,
+            e_ACK_TIME_P50,
+            e_ACK_TIME_P90,
+            e_ACK_TIME_P99,
+            e_ACK_TIME_P999,
             e_NACK_DELTA,
             e_NACK_ABS,
             e_CONFIRM_DELTA,
             e_CONFIRM_ABS,
             e_CONFIRM_TIME_AVG,
             e_CONFIRM_TIME_MAX,
+            e_CONFIRM_TIME_P50,
+            e_CONFIRM_TIME_P90,
+            e_CONFIRM_TIME_P99,
+            e_CONFIRM_TIME_P999,
             e_REJECT_ABS,
             e_REJECT_DELTA,
             e_QUEUE_TIME_AVG,
             e_QUEUE_TIME_MAX,
+            e_QUEUE_TIME_P50,
+            e_QUEUE_TIME_P90,
+            e_QUEUE_TIME_P99,
+            e_QUEUE_TIME_P999,
+            e_ROUTING_TIME_AVG,
+            e_ROUTING_TIME_MAX,
+            e_ROUTING_TIME_P50,
+            e_ROUTING_TIME_P90,
+            e_ROUTING_TIME_P99,
+            e_ROUTING_TIME_P999,
             e_GC_MSGS_DELTA,
             e_GC_MSGS_ABS,
             e_ROLE,
@@ -476,6 +495,10 @@ struct DomainQueueStats {
         ///             nanoseconds).
         e_STAT_QUEUE_TIME,
 
+        /// Value:      The time spent selecting the consumers of a message
+        ///             (in nanoseconds).
+        e_STAT_ROUTING_TIME,
+
         /// Value:      Accumulated bytes of all messages ever pushed from
         ///             the queue
         /// Increment:  Number of messages ever pushed from the queue
@@ -585,6 +608,16 @@ QueueStatsDomain::onEvent<QueueStatsDomain::EventType::e_QUEUE_TIME>(
     d_statContext_mp->reportValue(DomainQueueStats::e_STAT_QUEUE_TIME, value);
 }
 
+template <>
+inline void
+QueueStatsDomain::onEvent<QueueStatsDomain::EventType::e_ROUTING_TIME>(
+    bsls::Types::Int64 value)
+{
+    BSLS_ASSERT_SAFE(d_statContext_mp && "initialize was not called");
+    d_statContext_mp->reportValue(DomainQueueStats::e_STAT_ROUTING_TIME,
+                                  value);
+}
+
 template <>
 inline void QueueStatsDomain::onEvent<QueueStatsDomain::EventType::e_PUSH>(
     bsls::Types::Int64 value)
@@ -682,6 +682,78 @@ static void test5_appIdMetrics()
     }
 }
 
+static void test6_routingTime()
+// ------------------------------------------------------------------------
+// ROUTING TIME
+//
+// Concerns:
+//   - The routing time of a queue is reported as a histogram, so that its
+//     percentiles are available along with its maximum.
+//
+// Plan:
+//   - Report routing times small enough to each have their own bucket in
+//     the histogram, snapshot, and verify the maximum and the percentiles.
+//   - Snapshot without reporting any routing time and verify that the
+//     percentiles of the last snapshot are 0.
+//
+// Testing:
+//   QueueStatsDomain::onEvent<e_ROUTING_TIME>
+//   QueueStatsDomain::getValue
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("ROUTING TIME");
+
+#define BMQTST_ASSERT_EQ_DOMAINSTAT(PARAM, SNAPSHOT, VALUE)                   \
+    BMQTST_ASSERT_EQ(VALUE,                                                   \
+                     mqbstat::QueueStatsDomain::getValue(                     \
+                         *obj.statContext(),                                  \
+                         SNAPSHOT,                                            \
+                         mqbstat::QueueStatsDomain::Stat::PARAM));
+
+    mqbmock::Cluster    mockCluster(bmqtst::TestHelperUtil::allocator());
+    mqbmock::Domain     mockDomain(&mockCluster,
+                               bmqtst::TestHelperUtil::allocator());
+    bmqst::StatContext* sc = mockDomain.queueStatContext();
+
+    mqbstat::QueueStatsDomain obj(bmqtst::TestHelperUtil::allocator());
+    obj.initialize(bmqt::Uri(bmqtst::TestHelperUtil::allocator()),
+                   &mockDomain);
+
+    sc->snapshot();
+
+    // 50 x 1ns, 40 x 2ns, 9 x 4ns and 1 x 7ns
+    const struct {
+        bsls::Types::Int64 d_value;
+        int                d_count;
+    } k_DATA[] = {{1, 50}, {2, 40}, {4, 9}, {7, 1}};
+
+    for (size_t i = 0; i < sizeof(k_DATA) / sizeof(*k_DATA); ++i) {
+        for (int j = 0; j < k_DATA[i].d_count; ++j) {
+            obj.onEvent<mqbstat::QueueStatsDomain::EventType::e_ROUTING_TIME>(
+                k_DATA[i].d_value);
+        }
+    }
+
+    sc->snapshot();
+
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_ROUTING_TIME_MAX, 1, 7);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_ROUTING_TIME_P50, 1, 1);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_ROUTING_TIME_P90, 1, 2);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_ROUTING_TIME_P99, 1, 4);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_ROUTING_TIME_P999, 1, 7);
+
+    sc->snapshot();
+
+    // No routing time was reported in the last snapshot, but the previous
+    // one is still in range.
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_ROUTING_TIME_P50, 1, 0);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_ROUTING_TIME_P999, 1, 0);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_ROUTING_TIME_P50, 2, 1);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_ROUTING_TIME_P999, 2, 7);
+
+#undef BMQTST_ASSERT_EQ_DOMAINSTAT
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -700,6 +772,7 @@ int main(int argc, char* argv[])
                 bmqtst::TestHelperUtil::allocator());
         switch (_testCase) {
         case 0:
+        case 6: test6_routingTime(); break;
         case 5: test5_appIdMetrics(); break;
         case 4: test4_queueStatsDomainContent(); break;
         case 3: test3_queueStatsDomain(); break;
@@ -144,6 +144,13 @@ class LoadBalancer {
     /// client must be preserved and restored.
     void setProcessorForClient(const TYPE* client, int processorId);
 
+    /// Change the processor associated to the specified `client` to the
+    /// specified `processorId`.  The behaviour is undefined unless
+    /// `0 <= processorId < processorsCount()` and `client` is currently
+    /// associated with a processor.  This method is useful when a client is
+    /// migrated from one processor to another one at runtime.
+    void moveClient(const TYPE* client, int processorId);
+
     /// Remove the association of the specified `client` with its processor.
     /// This method has no effect if `client` is not associated with any
     /// processor.
@@ -161,6 +168,13 @@ class LoadBalancer {
     /// `processorId`.  The behavior is undefined unless '0 <= processorId <
     /// processorsCount()'.
     int clientsCountForProcessor(int processorId) const;
+
+    /// Load into the specified `clients` all the clients currently
+    /// associated to the specified `processorId`, in no particular order.
+    /// The behavior is undefined unless '0 <= processorId <
+    /// processorsCount()'.
+    void loadClientsForProcessor(bsl::vector<const TYPE*>* clients,
+                                 int                       processorId) const;
 };
 
 // ============================================================================
@@ -231,6 +245,22 @@ void LoadBalancer<TYPE>::setProcessorForClient(const TYPE* client,
     d_clients[client] = processorId;
 }
 
+template <class TYPE>
+void LoadBalancer<TYPE>::moveClient(const TYPE* client, int processorId)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // d_mutex LOCKED
+
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 <= processorId && processorId < processorsCount());
+
+    typename ClientMap::iterator it = d_clients.find(client);
+    BSLS_ASSERT_SAFE(it != d_clients.end());
+
+    d_counters[it->second] -= 1;
+    d_counters[processorId] += 1;
+    it->second = processorId;
+}
+
 template <class TYPE>
 void LoadBalancer<TYPE>::removeClient(const TYPE* client)
 {
@@ -272,6 +302,30 @@ int LoadBalancer<TYPE>::clientsCountForProcessor(int processorId) const
     return d_counters[processorId];
 }
 
+template <class TYPE>
+void LoadBalancer<TYPE>::loadClientsForProcessor(
+    bsl::vector<const TYPE*>* clients,
+    int                       processorId) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(clients);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // d_mutex LOCKED
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(processorId >= 0 && processorId < processorsCount());
+
+    clients->clear();
+    clients->reserve(d_counters[processorId]);
+    for (typename ClientMap::const_iterator it = d_clients.begin();
+         it != d_clients.end();
+         ++it) {
+        if (it->second == processorId) {
+            clients->push_back(it->first);
+        }
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
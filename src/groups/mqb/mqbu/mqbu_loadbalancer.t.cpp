@@ -16,6 +16,7 @@
 #include <mqbu_loadbalancer.h>
 
 #include <bsl_limits.h>
+#include <bsl_vector.h>
 
 // TEST DRIVER
 #include <bmqtst_testhelper.h>
@@ -236,6 +237,53 @@ static void test4_forceAssociate()
         obj.setProcessorForClient(reinterpret_cast<MyDummyType*>(4), -1));
 }
 
+static void test5_moveClient()
+{
+    bmqtst::TestHelper::printTestName("MOVE CLIENT");
+
+    const int                       k_NUM_PROCESSORS = 3;
+    mqbu::LoadBalancer<MyDummyType> obj(k_NUM_PROCESSORS,
+                                        bmqtst::TestHelperUtil::allocator());
+
+    const MyDummyType* client0 = reinterpret_cast<MyDummyType*>(1);
+    const MyDummyType* client1 = reinterpret_cast<MyDummyType*>(2);
+
+    obj.setProcessorForClient(client0, 0);
+    obj.setProcessorForClient(client1, 0);
+
+    bsl::vector<const MyDummyType*> clients(
+        bmqtst::TestHelperUtil::allocator());
+
+    PV(":: Load clients of processor '0'");
+    obj.loadClientsForProcessor(&clients, 0);
+    BMQTST_ASSERT_EQ(clients.size(), 2U);
+    obj.loadClientsForProcessor(&clients, 1);
+    BMQTST_ASSERT(clients.empty());
+
+    PV(":: Move client '1' to processor '2'");
+    obj.moveClient(client1, 2);
+    BMQTST_ASSERT_EQ(obj.clientsCount(), 2);
+    BMQTST_ASSERT_EQ(obj.clientsCountForProcessor(0), 1);
+    BMQTST_ASSERT_EQ(obj.clientsCountForProcessor(1), 0);
+    BMQTST_ASSERT_EQ(obj.clientsCountForProcessor(2), 1);
+    BMQTST_ASSERT_EQ(obj.getProcessorForClient(client1), 2);
+
+    obj.loadClientsForProcessor(&clients, 0);
+    BMQTST_ASSERT_EQ(clients.size(), 1U);
+    BMQTST_ASSERT_EQ(clients[0], client0);
+    obj.loadClientsForProcessor(&clients, 2);
+    BMQTST_ASSERT_EQ(clients.size(), 1U);
+    BMQTST_ASSERT_EQ(clients[0], client1);
+
+    PV(":: Remove moved client");
+    obj.removeClient(client1);
+    BMQTST_ASSERT_EQ(obj.clientsCountForProcessor(2), 0);
+
+    PV(":: Testing 'moveClient' with invalid processor");
+    BMQTST_ASSERT_OPT_FAIL(obj.moveClient(client0, k_NUM_PROCESSORS));
+    BMQTST_ASSERT_OPT_FAIL(obj.moveClient(client0, -1));
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -246,6 +294,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_moveClient(); break;
     case 4: test4_forceAssociate(); break;
     case 3: test3_loadBalancing(); break;
     case 2: test2_singleProcessorLoadBalancer(); break;
@@ -0,0 +1,92 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbu_threadutil.h>
+
+#include <mqbscm_version.h>
+// BDE
+#include <bsls_platform.h>
+
+// SYS
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace BloombergLP {
+namespace mqbu {
+
+// -----------------
+// struct ThreadUtil
+// -----------------
+
+bool ThreadUtil::isCpuAffinitySupported()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    return true;
+#else
+    return false;
+#endif
+}
+
+int ThreadUtil::setCpuAffinity(int firstCpu, int numCpus)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS            = 0,
+        rc_INVALID_CPU_RANGE  = -1,
+        rc_NOT_SUPPORTED      = -2,
+        rc_SET_AFFINITY_ERROR = -3
+    };
+
+    if (firstCpu < 0 || numCpus <= 0) {
+        return rc_INVALID_CPU_RANGE;  // RETURN
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (numCpus > CPU_SETSIZE || firstCpu > CPU_SETSIZE - numCpus) {
+        return rc_INVALID_CPU_RANGE;  // RETURN
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (int cpu = firstCpu; cpu < firstCpu + numCpus; ++cpu) {
+        CPU_SET(cpu, &cpuSet);
+    }
+
+    const int rc = pthread_setaffinity_np(pthread_self(),
+                                          sizeof(cpuSet),
+                                          &cpuSet);
+    if (rc != 0) {
+        return (rc * 10) + rc_SET_AFFINITY_ERROR;  // RETURN
+    }
+
+    return rc_SUCCESS;
+#else
+    return rc_NOT_SUPPORTED;
+#endif
+}
+
+int ThreadUtil::currentCpu()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    return sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
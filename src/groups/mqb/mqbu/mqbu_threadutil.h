@@ -0,0 +1,82 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MQBU_THREADUTIL
+#define INCLUDED_MQBU_THREADUTIL
+
+//@PURPOSE: Provide utilities related to thread management.
+//
+//@CLASSES:
+//  mqbu::ThreadUtil: Utilities related to thread management
+//
+//@DESCRIPTION: 'mqbu::ThreadUtil' provides a set of utility methods to
+// control the placement of the threads of the broker on the CPUs of the host.
+//
+// Pinning a thread to a set of CPUs also pins the memory it allocates: on
+// Linux, the default memory policy allocates a page on the NUMA node of the
+// CPU which first touches it, so that memory first written by a pinned thread
+// (e.g., the buffers it allocates, or the pages of a file it maps and
+// prefaults) is local to that thread.
+//
+/// Thread Safety
+///-------------
+// All methods of this component are thread safe, and apply to the calling
+// thread only.
+//
+/// Usage
+///-----
+// Pin the calling thread to the CPUs of index 2 and 3:
+//..
+//  int rc = mqbu::ThreadUtil::setCpuAffinity(2, 2);
+//  if (rc != 0) {
+//      BALL_LOG_WARN << "Failed to pin thread [rc: " << rc << "]";
+//  }
+//..
+
+namespace BloombergLP {
+namespace mqbu {
+
+// =================
+// struct ThreadUtil
+// =================
+
+/// Provide utilities related to thread management.
+struct ThreadUtil {
+    // CLASS METHODS
+
+    /// Return true if pinning threads to CPUs is supported on this platform,
+    /// and false otherwise.
+    static bool isCpuAffinitySupported();
+
+    /// Restrict the calling thread to only run on the specified `numCpus`
+    /// CPUs starting at the one of the specified `firstCpu` index.  Return 0
+    /// on success, or a non-zero value if the range of CPUs is invalid, if
+    /// the operating system rejected it (e.g., none of those CPUs is
+    /// available to this process) or if pinning threads is not supported on
+    /// this platform.  The affinity of the thread is left untouched on
+    /// failure.
+    static int setCpuAffinity(int firstCpu, int numCpus);
+
+    /// Return the index of the CPU the calling thread is currently running
+    /// on, or -1 if it can not be determined on this platform.  Note that
+    /// unless the calling thread is pinned to a single CPU, the returned
+    /// value may be outdated by the time it is used.
+    static int currentCpu();
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
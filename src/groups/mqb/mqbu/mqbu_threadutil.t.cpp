@@ -0,0 +1,152 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbu_threadutil.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bsl_limits.h>
+#include <bslmt_threadgroup.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Pin the calling thread to the CPU it is currently running on, and load
+/// into the specified `rc` the result of the operation and into the
+/// specified `cpuBefore` and `cpuAfter` the CPU the thread was running on
+/// respectively before and after being pinned.
+static void pinToCurrentCpu(int* rc, int* cpuBefore, int* cpuAfter)
+{
+    *cpuBefore = mqbu::ThreadUtil::currentCpu();
+    *rc        = mqbu::ThreadUtil::setCpuAffinity(*cpuBefore, 1);
+    *cpuAfter  = mqbu::ThreadUtil::currentCpu();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   - Invalid ranges of CPUs are rejected on all platforms.
+//   - The current CPU can be retrieved where pinning is supported.
+//
+// Testing:
+//   isCpuAffinitySupported
+//   setCpuAffinity
+//   currentCpu
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    BMQTST_ASSERT_NE(mqbu::ThreadUtil::setCpuAffinity(-1, 1), 0);
+    BMQTST_ASSERT_NE(mqbu::ThreadUtil::setCpuAffinity(0, 0), 0);
+    BMQTST_ASSERT_NE(mqbu::ThreadUtil::setCpuAffinity(0, -1), 0);
+    BMQTST_ASSERT_NE(
+        mqbu::ThreadUtil::setCpuAffinity(bsl::numeric_limits<int>::max(), 2),
+        0);
+
+    if (mqbu::ThreadUtil::isCpuAffinitySupported()) {
+        BMQTST_ASSERT_GE(mqbu::ThreadUtil::currentCpu(), 0);
+    }
+    else {
+        BMQTST_ASSERT_NE(mqbu::ThreadUtil::setCpuAffinity(0, 1), 0);
+        BMQTST_ASSERT_EQ(mqbu::ThreadUtil::currentCpu(), -1);
+    }
+}
+
+static void test2_setCpuAffinity()
+// ------------------------------------------------------------------------
+// SET CPU AFFINITY
+//
+// Concerns:
+//   - A thread pinned to a single CPU runs on that CPU.
+//
+// Plan:
+//   - From a dedicated thread (so that the affinity of the main thread of
+//     the test driver is not altered), pin the thread to the CPU it is
+//     running on, which is necessarily available to this process, and
+//     verify it still runs on that CPU.
+//
+// Testing:
+//   setCpuAffinity
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckGblAlloc() = true;
+    // Can't ensure no global memory is allocated because
+    // 'bslmt::ThreadUtil::create()' uses the global allocator to allocate
+    // memory.
+
+    bmqtst::TestHelper::printTestName("SET CPU AFFINITY");
+
+    if (!mqbu::ThreadUtil::isCpuAffinitySupported()) {
+        PV("Pinning threads is not supported on this platform");
+        return;  // RETURN
+    }
+
+    int rc        = -1;
+    int cpuBefore = -1;
+    int cpuAfter  = -1;
+
+    bslmt::ThreadGroup threadGroup(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(threadGroup.addThread(bdlf::BindUtil::bind(
+                         &pinToCurrentCpu,
+                         &rc,
+                         &cpuBefore,
+                         &cpuAfter)),
+                     0);
+    threadGroup.joinAll();
+
+    PV("Pinned thread to CPU " << cpuBefore << " [rc: " << rc << "]");
+
+    BMQTST_ASSERT_GE(cpuBefore, 0);
+    BMQTST_ASSERT_EQ(rc, 0);
+    BMQTST_ASSERT_EQ(cpuAfter, cpuBefore);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_setCpuAffinity(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_GBL_ALLOC);
+}
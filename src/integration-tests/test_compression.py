@@ -19,6 +19,8 @@ payload in various scenarios as listed below:
     - cluster gets restarted after sending ack to producer.
 """
 
+import pytest
+
 import blazingmq.dev.it.testconstants as tc
 from blazingmq.dev.it.fixtures import (
     Cluster,
@@ -29,7 +31,10 @@ from blazingmq.dev.it.util import random_string
 pytestmark = order(10)
 
 
-def test_compression_restart(cluster: Cluster, domain_urls: tc.DomainUrls):
+@pytest.mark.parametrize("compression_algorithm_type", ["ZLIB", "LZ4", "ZSTD"])
+def test_compression_restart(
+    cluster: Cluster, domain_urls: tc.DomainUrls, compression_algorithm_type: str
+):
     # Start a producer and post a message.
     uri_priority = domain_urls.uri_priority
     proxies = cluster.proxy_cycle()
@@ -47,7 +52,7 @@ def test_compression_restart(cluster: Cluster, domain_urls: tc.DomainUrls):
         payload=[payload],
         wait_ack=True,
         succeed=True,
-        compression_algorithm_type="ZLIB",
+        compression_algorithm_type=compression_algorithm_type,
     )
 
     # Use strong consistency (SC) to ensure that majority nodes in the
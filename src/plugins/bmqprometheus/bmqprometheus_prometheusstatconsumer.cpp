@@ -28,6 +28,7 @@
 
 // BMQ
 #include <bmqio_statchannelfactory.h>
+#include <bmqst_statutil.h>
 #include <bmqu_memoutstream.h>
 #include <bmqu_time.h>
 
@@ -37,6 +38,7 @@
 #include <bdld_manageddatum.h>
 #include <bdlf_bind.h>
 #include <bdlt_currenttime.h>
+#include <bsl_algorithm.h>
 #include <bsl_atomic.h>
 #include <bsl_cstddef.h>
 #include <bsl_exception.h>
@@ -55,6 +57,7 @@
 #include "prometheus/exposer.h"
 #include "prometheus/gateway.h"
 #include "prometheus/gauge.h"
+#include "prometheus/histogram.h"
 #include "prometheus/labels.h"
 
 namespace BloombergLP {
@@ -149,6 +152,45 @@ class Tagger {
     ::prometheus::Labels& getLabels() { return labels; }
 };
 
+/// Return the upper bounds, in nanoseconds, of the buckets of the latency
+/// histograms published to Prometheus: every other power of two from 2^10
+/// (about 1us) to 2^36 (about 69s).  Powers of two are also boundaries of
+/// the `bmqst::StatValue` histogram buckets these are built from.
+const ::prometheus::Histogram::BucketBoundaries& latencyBucketBoundaries()
+{
+    static const ::prometheus::Histogram::BucketBoundaries s_boundaries =
+        [] {
+            ::prometheus::Histogram::BucketBoundaries boundaries;
+            for (int exponent = 10; exponent <= 36; exponent += 2) {
+                boundaries.push_back(
+                    static_cast<double>(bsls::Types::Int64(1) << exponent));
+            }
+            return boundaries;
+        }();
+    return s_boundaries;
+}
+
+/// Return `true` if the specified `stat` is published for each AppId,
+/// rather than for the whole queue, when the queue has AppId subcontexts.
+bool isPerAppIdStat(mqbstat::QueueStatsDomain::Stat::Enum stat)
+{
+    typedef mqbstat::QueueStatsDomain::Stat Stat;
+
+    switch (stat) {
+    case Stat::e_CONFIRM_TIME_MAX:
+    case Stat::e_CONFIRM_TIME_P50:
+    case Stat::e_CONFIRM_TIME_P90:
+    case Stat::e_CONFIRM_TIME_P99:
+    case Stat::e_CONFIRM_TIME_P999:
+    case Stat::e_QUEUE_TIME_MAX:
+    case Stat::e_QUEUE_TIME_P50:
+    case Stat::e_QUEUE_TIME_P90:
+    case Stat::e_QUEUE_TIME_P99:
+    case Stat::e_QUEUE_TIME_P999: return true;  // RETURN
+    default: return false;                      // RETURN
+    }
+}
+
 bsl::unique_ptr<PrometheusStatExporter>
 makeExporter(const mqbcfg::ExportMode::Value&          mode,
              const bsl::string&                        host,
@@ -346,20 +388,29 @@ void PrometheusStatConsumer::captureQueueStats()
                     {"queue_ack_msgs", Stat::e_ACK_ABS},
                     {"queue_ack_time_avg", Stat::e_ACK_TIME_AVG},
                     {"queue_ack_time_max", Stat::e_ACK_TIME_MAX},
+                    {"queue_ack_time_p50", Stat::e_ACK_TIME_P50},
+                    {"queue_ack_time_p90", Stat::e_ACK_TIME_P90},
+                    {"queue_ack_time_p99", Stat::e_ACK_TIME_P99},
+                    {"queue_ack_time_p999", Stat::e_ACK_TIME_P999},
                     {"queue_nack_msgs_delta", Stat::e_NACK_DELTA},
                     {"queue_nack_msgs", Stat::e_NACK_ABS},
                     {"queue_confirm_msgs", Stat::e_CONFIRM_DELTA},
                     {"queue_confirm_msgs", Stat::e_CONFIRM_ABS},
                     {"queue_confirm_time_avg", Stat::e_CONFIRM_TIME_AVG},
-                    {"queue_confirm_time_max", Stat::e_CONFIRM_TIME_MAX}};
+                    {"queue_confirm_time_max", Stat::e_CONFIRM_TIME_MAX},
+                    {"queue_confirm_time_p50", Stat::e_CONFIRM_TIME_P50},
+                    {"queue_confirm_time_p90", Stat::e_CONFIRM_TIME_P90},
+                    {"queue_confirm_time_p99", Stat::e_CONFIRM_TIME_P99},
+                    {"queue_confirm_time_p999", Stat::e_CONFIRM_TIME_P999}};
 
                 for (DatapointDefCIter dpIt = bdlb::ArrayUtil::begin(defs);
                      dpIt != bdlb::ArrayUtil::end(defs);
                      ++dpIt) {
-                    // If there are subcontexts, skip 'confirm_time_max'
-                    // metric, it will be processed later.
-                    if (static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
-                            dpIt->d_stat) == Stat::e_CONFIRM_TIME_MAX &&
+                    // If there are subcontexts, skip 'confirm_time' max and
+                    // percentiles metrics, they will be processed later.
+                    if (isPerAppIdStat(
+                            static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
+                                dpIt->d_stat)) &&
                         queueIt->numSubcontexts() > 0) {
                         continue;
                     }
@@ -372,6 +423,16 @@ void PrometheusStatConsumer::captureQueueStats()
                                 dpIt->d_stat));
                     updateMetric(dpIt->d_name, labels, value);
                 }
+
+                updateHistogram("queue_ack_time",
+                                labels,
+                                *queueIt,
+                                mqbstat::DomainQueueStats::e_STAT_ACK_TIME);
+                updateHistogram(
+                    "queue_confirm_time",
+                    labels,
+                    *queueIt,
+                    mqbstat::DomainQueueStats::e_STAT_CONFIRM_TIME);
             }
 
             // The following metrics only make sense to be reported from the
@@ -390,6 +451,16 @@ void PrometheusStatConsumer::captureQueueStats()
                      Stat::e_BYTES_UTILIZATION_MAX},
                     {"queue_queue_time_avg", Stat::e_QUEUE_TIME_AVG},
                     {"queue_queue_time_max", Stat::e_QUEUE_TIME_MAX},
+                    {"queue_queue_time_p50", Stat::e_QUEUE_TIME_P50},
+                    {"queue_queue_time_p90", Stat::e_QUEUE_TIME_P90},
+                    {"queue_queue_time_p99", Stat::e_QUEUE_TIME_P99},
+                    {"queue_queue_time_p999", Stat::e_QUEUE_TIME_P999},
+                    {"queue_routing_time_avg", Stat::e_ROUTING_TIME_AVG},
+                    {"queue_routing_time_max", Stat::e_ROUTING_TIME_MAX},
+                    {"queue_routing_time_p50", Stat::e_ROUTING_TIME_P50},
+                    {"queue_routing_time_p90", Stat::e_ROUTING_TIME_P90},
+                    {"queue_routing_time_p99", Stat::e_ROUTING_TIME_P99},
+                    {"queue_routing_time_p999", Stat::e_ROUTING_TIME_P999},
                     {"queue_reject_msgs_delta", Stat::e_REJECT_DELTA},
                     {"queue_reject_msgs", Stat::e_REJECT_ABS},
                     {"queue_nack_noquorum_msgs_delta",
@@ -400,10 +471,11 @@ void PrometheusStatConsumer::captureQueueStats()
                 for (DatapointDefCIter dpIt = bdlb::ArrayUtil::begin(defs);
                      dpIt != bdlb::ArrayUtil::end(defs);
                      ++dpIt) {
-                    // If there are subcontexts, skip 'cqueue_time_max' metric,
-                    // it will be processed later.
-                    if (static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
-                            dpIt->d_stat) == Stat::e_QUEUE_TIME_MAX &&
+                    // If there are subcontexts, skip 'queue_time' max and
+                    // percentiles metrics, they will be processed later.
+                    if (isPerAppIdStat(
+                            static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
+                                dpIt->d_stat)) &&
                         queueIt->numSubcontexts() > 0) {
                         continue;
                     }
@@ -416,6 +488,16 @@ void PrometheusStatConsumer::captureQueueStats()
                                 dpIt->d_stat));
                     updateMetric(dpIt->d_name, labels, value);
                 }
+
+                updateHistogram("queue_queue_time",
+                                labels,
+                                *queueIt,
+                                mqbstat::DomainQueueStats::e_STAT_QUEUE_TIME);
+                updateHistogram(
+                    "queue_routing_time",
+                    labels,
+                    *queueIt,
+                    mqbstat::DomainQueueStats::e_STAT_ROUTING_TIME);
             }
 
             // Add `appId` tag to metrics.
@@ -423,11 +505,19 @@ void PrometheusStatConsumer::captureQueueStats()
             // These per-appId metrics exist for both primary and replica
             static const DatapointDef defsCommon[] = {
                 {"queue_confirm_time_max", Stat::e_CONFIRM_TIME_MAX},
+                {"queue_confirm_time_p50", Stat::e_CONFIRM_TIME_P50},
+                {"queue_confirm_time_p90", Stat::e_CONFIRM_TIME_P90},
+                {"queue_confirm_time_p99", Stat::e_CONFIRM_TIME_P99},
+                {"queue_confirm_time_p999", Stat::e_CONFIRM_TIME_P999},
             };
 
             // These per-appId metrics exist only for primary
             static const DatapointDef defsPrimary[] = {
                 {"queue_queue_time_max", Stat::e_QUEUE_TIME_MAX},
+                {"queue_queue_time_p50", Stat::e_QUEUE_TIME_P50},
+                {"queue_queue_time_p90", Stat::e_QUEUE_TIME_P90},
+                {"queue_queue_time_p99", Stat::e_QUEUE_TIME_P99},
+                {"queue_queue_time_p999", Stat::e_QUEUE_TIME_P999},
                 {"queue_content_msgs_max", Stat::e_MESSAGES_MAX},
                 {"queue_content_bytes_max", Stat::e_BYTES_MAX},
             };
@@ -737,6 +827,8 @@ void PrometheusStatConsumer::captureClusterPartitionsStats()
             // 'cluster_partition1_rollover_time')
             const bsl::string prefix = "cluster_" + partitionIt->name() + "_";
             const bsl::string rollover_time        = prefix + "rollover_time";
+            const bsl::string rollover_stall_time  = prefix +
+                                                    "rollover_stall_time";
             const bsl::string journal_offset_bytes = prefix +
                                                      "journal_offset_bytes";
             const bsl::string journal_outstanding_bytes =
@@ -753,9 +845,29 @@ void PrometheusStatConsumer::captureClusterPartitionsStats()
                                                      "replication_time_ns_avg";
             const bsl::string replication_time_max = prefix +
                                                      "replication_time_ns_max";
+            const bsl::string commit_batch_size_avg = prefix +
+                                                      "commit_batch_size_avg";
+            const bsl::string commit_batch_size_max = prefix +
+                                                      "commit_batch_size_max";
+            const bsl::string sync_time_avg = prefix + "sync_time_ns_avg";
+            const bsl::string sync_time_max = prefix + "sync_time_ns_max";
+            const bsl::string commit_batch_size_p50 =
+                prefix + "commit_batch_size_p50";
+            const bsl::string commit_batch_size_p90 =
+                prefix + "commit_batch_size_p90";
+            const bsl::string commit_batch_size_p99 =
+                prefix + "commit_batch_size_p99";
+            const bsl::string commit_batch_size_p999 =
+                prefix + "commit_batch_size_p999";
+            const bsl::string sync_time_p50 = prefix + "sync_time_ns_p50";
+            const bsl::string sync_time_p90 = prefix + "sync_time_ns_p90";
+            const bsl::string sync_time_p99 = prefix + "sync_time_ns_p99";
+            const bsl::string sync_time_p999 = prefix + "sync_time_ns_p999";
 
             const DatapointDef defs[] = {
                 {rollover_time.c_str(), Stat::e_PARTITION_ROLLOVER_TIME},
+                {rollover_stall_time.c_str(),
+                 Stat::e_PARTITION_ROLLOVER_STALL_TIME},
                 {journal_offset_bytes.c_str(),
                  Stat::e_PARTITION_JOURNAL_OFFSET},
                 {journal_outstanding_bytes.c_str(),
@@ -771,7 +883,25 @@ void PrometheusStatConsumer::captureClusterPartitionsStats()
                 {replication_time_avg.c_str(),
                  Stat::e_PARTITION_REPLICATION_TIME_NS_AVG},
                 {replication_time_max.c_str(),
-                 Stat::e_PARTITION_REPLICATION_TIME_NS_MAX}};
+                 Stat::e_PARTITION_REPLICATION_TIME_NS_MAX},
+                {commit_batch_size_avg.c_str(),
+                 Stat::e_PARTITION_COMMIT_BATCH_SIZE_AVG},
+                {commit_batch_size_max.c_str(),
+                 Stat::e_PARTITION_COMMIT_BATCH_SIZE_MAX},
+                {commit_batch_size_p50.c_str(),
+                 Stat::e_PARTITION_COMMIT_BATCH_SIZE_P50},
+                {commit_batch_size_p90.c_str(),
+                 Stat::e_PARTITION_COMMIT_BATCH_SIZE_P90},
+                {commit_batch_size_p99.c_str(),
+                 Stat::e_PARTITION_COMMIT_BATCH_SIZE_P99},
+                {commit_batch_size_p999.c_str(),
+                 Stat::e_PARTITION_COMMIT_BATCH_SIZE_P999},
+                {sync_time_avg.c_str(), Stat::e_PARTITION_SYNC_TIME_NS_AVG},
+                {sync_time_max.c_str(), Stat::e_PARTITION_SYNC_TIME_NS_MAX},
+                {sync_time_p50.c_str(), Stat::e_PARTITION_SYNC_TIME_NS_P50},
+                {sync_time_p90.c_str(), Stat::e_PARTITION_SYNC_TIME_NS_P90},
+                {sync_time_p99.c_str(), Stat::e_PARTITION_SYNC_TIME_NS_P99},
+                {sync_time_p999.c_str(), Stat::e_PARTITION_SYNC_TIME_NS_P999}};
 
             Tagger tagger;
             tagger.setCluster(clusterIt->name())
@@ -789,6 +919,56 @@ void PrometheusStatConsumer::captureClusterPartitionsStats()
                             dpIt->d_stat));
                 updateMetric(dpIt->d_name, tagger.getLabels(), value);
             }
+
+            const bsl::string sync_time = prefix + "sync_time_ns";
+            updateHistogram(
+                sync_time.c_str(),
+                tagger.getLabels(),
+                *partitionIt,
+                mqbstat::ClusterStats::ClusterStatsIndex::
+                    e_PARTITION_SYNC_TIME_NS);
+
+            // Report the replication lag of each replica of the partition,
+            // as observed by the primary (e.g.,
+            // 'cluster_partition1_replica_receipt_time_ns_max' with the
+            // replica node as 'RemoteHost').
+            const bsl::string replica_receipt_time_avg =
+                prefix + "replica_receipt_time_ns_avg";
+            const bsl::string replica_receipt_time_max =
+                prefix + "replica_receipt_time_ns_max";
+            const bsl::string replica_unreceipted_bytes =
+                prefix + "replica_unreceipted_bytes_max";
+
+            const DatapointDef replicaDefs[] = {
+                {replica_receipt_time_avg.c_str(),
+                 Stat::e_PARTITION_REPLICA_RECEIPT_TIME_NS_AVG},
+                {replica_receipt_time_max.c_str(),
+                 Stat::e_PARTITION_REPLICA_RECEIPT_TIME_NS_MAX},
+                {replica_unreceipted_bytes.c_str(),
+                 Stat::e_PARTITION_REPLICA_UNRECEIPTED_BYTES_MAX}};
+
+            for (bmqst::StatContextIterator replicaIt =
+                     partitionIt->subcontextIterator();
+                 replicaIt;
+                 ++replicaIt) {
+                Tagger replicaTagger(tagger);
+                replicaTagger.setRemoteHost(replicaIt->name());
+
+                for (DatapointDefCIter dpIt =
+                         bdlb::ArrayUtil::begin(replicaDefs);
+                     dpIt != bdlb::ArrayUtil::end(replicaDefs);
+                     ++dpIt) {
+                    const bsls::Types::Int64 value =
+                        mqbstat::ClusterStats::getValue(
+                            *replicaIt,
+                            d_snapshotId,
+                            static_cast<mqbstat::ClusterStats::Stat::Enum>(
+                                dpIt->d_stat));
+                    updateMetric(dpIt->d_name,
+                                 replicaTagger.getLabels(),
+                                 value);
+                }
+            }
         }
     }
 }
@@ -983,6 +1163,9 @@ void PrometheusStatConsumer::captureDispatcherStats()
                  Stat::e_PROCESSING_TIME_REPLICATION_RECEIPT_SUM},
                 {"dispatcher_processed_count_replication_receipt",
                  Stat::e_PROCESSED_COUNT_REPLICATION_RECEIPT},
+                {"dispatcher_batch_count", Stat::e_BATCH_COUNT},
+                {"dispatcher_batch_size_avg", Stat::e_BATCH_SIZE_AVG},
+                {"dispatcher_batch_size_max", Stat::e_BATCH_SIZE_MAX},
             };
 
             for (DatapointDefCIter dpIt = bdlb::ArrayUtil::begin(defs);
@@ -1008,6 +1191,56 @@ void PrometheusStatConsumer::updateMetric(const char*                 name,
     gauge.Add(labels).Set(static_cast<double>(value));
 }
 
+void PrometheusStatConsumer::updateHistogram(
+    const char*                 name,
+    const ::prometheus::Labels& labels,
+    const bmqst::StatContext&   context,
+    int                         valueIndex)
+{
+    const bmqst::StatValue& value =
+        context.value(bmqst::StatContext::e_DIRECT_VALUE, valueIndex);
+    const bmqst::StatValue::SnapshotLocation latestSnapshot(0, 0);
+    const bmqst::StatValue::SnapshotLocation oldestSnapshot(0, d_snapshotId);
+
+    const ::prometheus::Histogram::BucketBoundaries& boundaries =
+        latencyBucketBoundaries();
+    auto& histogram = ::prometheus::BuildHistogram().Name(name).Register(
+        *d_prometheusRegistry_p);
+    ::prometheus::Histogram& metric = histogram.Add(labels, boundaries);
+
+    bsl::vector<bsls::Types::Int64> counts;
+    if (bmqst::StatUtil::histogramDifference(&counts,
+                                             value,
+                                             latestSnapshot,
+                                             oldestSnapshot) <= 0) {
+        return;  // RETURN
+    }
+
+    // Fold the 'bmqst::StatValue' buckets into the (coarser) Prometheus
+    // buckets, which count the values less than or equal to their bound.
+    std::vector<double> increments(boundaries.size() + 1, 0.0);
+    for (int bucket = 0; bucket < bmqst::StatValue::k_NUM_HISTOGRAM_BUCKETS;
+         ++bucket) {
+        if (counts[bucket] <= 0) {
+            continue;  // CONTINUE
+        }
+
+        const double maxValue = static_cast<double>(
+            bmqst::StatValue::histogramBucketUpperBound(bucket) - 1);
+        const bsl::size_t index = bsl::lower_bound(boundaries.begin(),
+                                                   boundaries.end(),
+                                                   maxValue) -
+                                  boundaries.begin();
+        increments[index] += static_cast<double>(counts[bucket]);
+    }
+
+    metric.ObserveMultiple(
+        increments,
+        static_cast<double>(bmqst::StatUtil::sumDifference(value,
+                                                           latestSnapshot,
+                                                           oldestSnapshot)));
+}
+
 void PrometheusStatConsumer::setPublishInterval(
     bsls::TimeInterval publishInterval)
 {
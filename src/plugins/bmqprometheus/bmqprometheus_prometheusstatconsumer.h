@@ -214,6 +214,15 @@ class PrometheusStatConsumer : public mqbplug::StatConsumer {
                       const ::prometheus::Labels& labels,
                       const bsls::Types::Int64    value);
 
+    /// Observe into the Prometheus histogram with the specified `name` and
+    /// `labels` the values reported since the last publication to the
+    /// histogram stat value at the specified `valueIndex` in the specified
+    /// `context`.
+    void updateHistogram(const char*                 name,
+                         const ::prometheus::Labels& labels,
+                         const bmqst::StatContext&   context,
+                         int                         valueIndex);
+
     /// Stop plugin
     void stopImpl();
 
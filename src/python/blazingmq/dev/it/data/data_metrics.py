@@ -85,6 +85,10 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_ack_msgs_abs": 0,
                 "queue_ack_time_avg": 0,
                 "queue_ack_time_max": 0,
+                "queue_ack_time_p50": 0,
+                "queue_ack_time_p90": 0,
+                "queue_ack_time_p99": 0,
+                "queue_ack_time_p999": 0,
                 "queue_bytes_current": 0,
                 "queue_bytes_utilization_max": 0,
                 "queue_cfg_bytes": 0,
@@ -93,6 +97,10 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_confirm_msgs_abs": 0,
                 "queue_confirm_time_avg": 0,
                 "queue_confirm_time_max": 0,
+                "queue_confirm_time_p50": 0,
+                "queue_confirm_time_p90": 0,
+                "queue_confirm_time_p99": 0,
+                "queue_confirm_time_p999": 0,
                 "queue_consumers_count": 0,
                 "queue_content_bytes": 0,
                 "queue_content_msgs": 0,
@@ -116,6 +124,10 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_put_msgs_abs": 0,
                 "queue_queue_time_avg": 0,
                 "queue_queue_time_max": 0,
+                "queue_queue_time_p50": 0,
+                "queue_queue_time_p90": 0,
+                "queue_queue_time_p99": 0,
+                "queue_queue_time_p999": 0,
                 "queue_reject_msgs": 0,
                 "queue_reject_msgs_abs": 0,
                 "queue_role": 0,
@@ -127,6 +139,10 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_ack_msgs_abs": 0,
                 "queue_ack_time_avg": 0,
                 "queue_ack_time_max": 0,
+                "queue_ack_time_p50": 0,
+                "queue_ack_time_p90": 0,
+                "queue_ack_time_p99": 0,
+                "queue_ack_time_p999": 0,
                 "queue_bytes_current": 0,
                 "queue_bytes_utilization_max": 0,
                 "queue_cfg_bytes": 0,
@@ -135,6 +151,10 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_confirm_msgs_abs": 0,
                 "queue_confirm_time_avg": 0,
                 "queue_confirm_time_max": 0,
+                "queue_confirm_time_p50": 0,
+                "queue_confirm_time_p90": 0,
+                "queue_confirm_time_p99": 0,
+                "queue_confirm_time_p999": 0,
                 "queue_consumers_count": 0,
                 "queue_content_bytes": 0,
                 "queue_content_msgs": 0,
@@ -158,6 +178,10 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_put_msgs_abs": 0,
                 "queue_queue_time_avg": 0,
                 "queue_queue_time_max": 0,
+                "queue_queue_time_p50": 0,
+                "queue_queue_time_p90": 0,
+                "queue_queue_time_p99": 0,
+                "queue_queue_time_p999": 0,
                 "queue_reject_msgs": 0,
                 "queue_reject_msgs_abs": 0,
                 "queue_role": 0,
@@ -169,6 +193,10 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_ack_msgs_abs": 0,
                 "queue_ack_time_avg": 0,
                 "queue_ack_time_max": 0,
+                "queue_ack_time_p50": 0,
+                "queue_ack_time_p90": 0,
+                "queue_ack_time_p99": 0,
+                "queue_ack_time_p999": 0,
                 "queue_bytes_current": 0,
                 "queue_bytes_utilization_max": 0,
                 "queue_cfg_bytes": 0,
@@ -177,6 +205,10 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_confirm_msgs_abs": 0,
                 "queue_confirm_time_avg": 0,
                 "queue_confirm_time_max": 0,
+                "queue_confirm_time_p50": 0,
+                "queue_confirm_time_p90": 0,
+                "queue_confirm_time_p99": 0,
+                "queue_confirm_time_p999": 0,
                 "queue_consumers_count": 0,
                 "queue_content_bytes": 0,
                 "queue_content_msgs": 0,
@@ -200,6 +232,10 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_put_msgs_abs": 0,
                 "queue_queue_time_avg": 0,
                 "queue_queue_time_max": 0,
+                "queue_queue_time_p50": 0,
+                "queue_queue_time_p90": 0,
+                "queue_queue_time_p99": 0,
+                "queue_queue_time_p999": 0,
                 "queue_reject_msgs": 0,
                 "queue_reject_msgs_abs": 0,
                 "queue_role": 0,
@@ -211,6 +247,10 @@ TEST_QUEUE_STATS_EMPTY = {
         "queue_ack_msgs_abs": 0,
         "queue_ack_time_avg": 0,
         "queue_ack_time_max": 0,
+        "queue_ack_time_p50": 0,
+        "queue_ack_time_p90": 0,
+        "queue_ack_time_p99": 0,
+        "queue_ack_time_p999": 0,
         "queue_bytes_current": 0,
         "queue_bytes_utilization_max": 0,
         "queue_cfg_bytes": 0,
@@ -219,6 +259,10 @@ TEST_QUEUE_STATS_EMPTY = {
         "queue_confirm_msgs_abs": 0,
         "queue_confirm_time_avg": 0,
         "queue_confirm_time_max": 0,
+        "queue_confirm_time_p50": 0,
+        "queue_confirm_time_p90": 0,
+        "queue_confirm_time_p99": 0,
+        "queue_confirm_time_p999": 0,
         "queue_consumers_count": 0,
         "queue_content_bytes": 0,
         "queue_content_msgs": 0,
@@ -242,6 +286,10 @@ TEST_QUEUE_STATS_EMPTY = {
         "queue_put_msgs_abs": 0,
         "queue_queue_time_avg": 0,
         "queue_queue_time_max": 0,
+        "queue_queue_time_p50": 0,
+        "queue_queue_time_p90": 0,
+        "queue_queue_time_p99": 0,
+        "queue_queue_time_p999": 0,
         "queue_reject_msgs": 0,
         "queue_reject_msgs_abs": 0,
         "queue_role": 0,
@@ -282,6 +330,10 @@ TEST_QUEUE_STATS_AFTER_POST = _deep_merge(
             "queue_ack_msgs_abs": 32,
             "queue_ack_time_avg": GreaterThan(0),
             "queue_ack_time_max": GreaterThan(0),
+            "queue_ack_time_p50": GreaterThan(0),
+            "queue_ack_time_p90": GreaterThan(0),
+            "queue_ack_time_p99": GreaterThan(0),
+            "queue_ack_time_p999": GreaterThan(0),
             "queue_bytes_current": 96,
             "queue_cfg_bytes": 1048576,
             "queue_cfg_msgs": 1000,
@@ -307,11 +359,19 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_SINGLE_NODE = _deep_merge(
                     "queue_bytes_current": 30,
                     "queue_confirm_time_avg": GreaterThan(0),
                     "queue_confirm_time_max": GreaterThan(0),
+                    "queue_confirm_time_p50": GreaterThan(0),
+                    "queue_confirm_time_p90": GreaterThan(0),
+                    "queue_confirm_time_p99": GreaterThan(0),
+                    "queue_confirm_time_p999": GreaterThan(0),
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
                     "queue_msgs_current": 10,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p90": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "baz": {
@@ -319,11 +379,19 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_SINGLE_NODE = _deep_merge(
                     "queue_bytes_current": 63,
                     "queue_confirm_time_avg": GreaterThan(0),
                     "queue_confirm_time_max": GreaterThan(0),
+                    "queue_confirm_time_p50": GreaterThan(0),
+                    "queue_confirm_time_p90": GreaterThan(0),
+                    "queue_confirm_time_p99": GreaterThan(0),
+                    "queue_confirm_time_p999": GreaterThan(0),
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
                     "queue_msgs_current": 21,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p90": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "foo": {
@@ -331,11 +399,19 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_SINGLE_NODE = _deep_merge(
                     "queue_bytes_current": 0,
                     "queue_confirm_time_avg": GreaterThan(0),
                     "queue_confirm_time_max": GreaterThan(0),
+                    "queue_confirm_time_p50": GreaterThan(0),
+                    "queue_confirm_time_p90": GreaterThan(0),
+                    "queue_confirm_time_p99": GreaterThan(0),
+                    "queue_confirm_time_p999": GreaterThan(0),
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
                     "queue_msgs_current": 0,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p90": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
         },
@@ -344,6 +420,10 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_SINGLE_NODE = _deep_merge(
             "queue_ack_msgs_abs": 32,
             "queue_ack_time_avg": GreaterThan(0),
             "queue_ack_time_max": GreaterThan(0),
+            "queue_ack_time_p50": GreaterThan(0),
+            "queue_ack_time_p90": GreaterThan(0),
+            "queue_ack_time_p99": GreaterThan(0),
+            "queue_ack_time_p999": GreaterThan(0),
             "queue_bytes_current": 63,
             "queue_cfg_bytes": 1048576,
             "queue_cfg_msgs": 1000,
@@ -351,6 +431,10 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_SINGLE_NODE = _deep_merge(
             "queue_confirm_msgs_abs": 65,
             "queue_confirm_time_avg": GreaterThan(0),
             "queue_confirm_time_max": GreaterThan(0),
+            "queue_confirm_time_p50": GreaterThan(0),
+            "queue_confirm_time_p90": GreaterThan(0),
+            "queue_confirm_time_p99": GreaterThan(0),
+            "queue_confirm_time_p999": GreaterThan(0),
             "queue_consumers_count": 3,
             "queue_content_bytes": 96,
             "queue_content_msgs": 32,
@@ -367,6 +451,10 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_SINGLE_NODE = _deep_merge(
             "queue_put_msgs_abs": 32,
             "queue_queue_time_avg": GreaterThan(0),
             "queue_queue_time_max": GreaterThan(0),
+            "queue_queue_time_p50": GreaterThan(0),
+            "queue_queue_time_p90": GreaterThan(0),
+            "queue_queue_time_p99": GreaterThan(0),
+            "queue_queue_time_p999": GreaterThan(0),
             "queue_role": 1,
         },
     },
@@ -384,6 +472,10 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_MULTI_NODE = _deep_merge(
                     "queue_msgs_current": 10,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p90": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "baz": {
@@ -394,6 +486,10 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_MULTI_NODE = _deep_merge(
                     "queue_msgs_current": 21,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p90": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "foo": {
@@ -404,6 +500,10 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_MULTI_NODE = _deep_merge(
                     "queue_msgs_current": 0,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p90": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
         },
@@ -423,6 +523,10 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_MULTI_NODE = _deep_merge(
             "queue_push_msgs_abs": AnyValue(),
             "queue_queue_time_avg": GreaterThan(0),
             "queue_queue_time_max": GreaterThan(0),
+            "queue_queue_time_p50": GreaterThan(0),
+            "queue_queue_time_p90": GreaterThan(0),
+            "queue_queue_time_p99": GreaterThan(0),
+            "queue_queue_time_p999": GreaterThan(0),
             "queue_role": 1,
         },
     },
@@ -437,11 +541,19 @@ TEST_QUEUE_STATS_AFTER_PURGE_SINGLE_NODE = _deep_merge(
                     "queue_bytes_current": 30,
                     "queue_confirm_time_avg": GreaterThan(0),
                     "queue_confirm_time_max": GreaterThan(0),
+                    "queue_confirm_time_p50": GreaterThan(0),
+                    "queue_confirm_time_p90": GreaterThan(0),
+                    "queue_confirm_time_p99": GreaterThan(0),
+                    "queue_confirm_time_p999": GreaterThan(0),
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
                     "queue_msgs_current": 10,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p90": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "baz": {
@@ -449,11 +561,19 @@ TEST_QUEUE_STATS_AFTER_PURGE_SINGLE_NODE = _deep_merge(
                     "queue_bytes_current": 0,
                     "queue_confirm_time_avg": GreaterThan(0),
                     "queue_confirm_time_max": GreaterThan(0),
+                    "queue_confirm_time_p50": GreaterThan(0),
+                    "queue_confirm_time_p90": GreaterThan(0),
+                    "queue_confirm_time_p99": GreaterThan(0),
+                    "queue_confirm_time_p999": GreaterThan(0),
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
                     "queue_msgs_current": 0,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p90": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "foo": {
@@ -461,11 +581,19 @@ TEST_QUEUE_STATS_AFTER_PURGE_SINGLE_NODE = _deep_merge(
                     "queue_bytes_current": 0,
                     "queue_confirm_time_avg": GreaterThan(0),
                     "queue_confirm_time_max": GreaterThan(0),
+                    "queue_confirm_time_p50": GreaterThan(0),
+                    "queue_confirm_time_p90": GreaterThan(0),
+                    "queue_confirm_time_p99": GreaterThan(0),
+                    "queue_confirm_time_p999": GreaterThan(0),
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
                     "queue_msgs_current": 0,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p90": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
         },
@@ -474,6 +602,10 @@ TEST_QUEUE_STATS_AFTER_PURGE_SINGLE_NODE = _deep_merge(
             "queue_ack_msgs_abs": 32,
             "queue_ack_time_avg": GreaterThan(0),
             "queue_ack_time_max": GreaterThan(0),
+            "queue_ack_time_p50": GreaterThan(0),
+            "queue_ack_time_p90": GreaterThan(0),
+            "queue_ack_time_p99": GreaterThan(0),
+            "queue_ack_time_p999": GreaterThan(0),
             "queue_bytes_current": 30,
             "queue_cfg_bytes": 1048576,
             "queue_cfg_msgs": 1000,
@@ -481,6 +613,10 @@ TEST_QUEUE_STATS_AFTER_PURGE_SINGLE_NODE = _deep_merge(
             "queue_confirm_msgs_abs": 65,
             "queue_confirm_time_avg": GreaterThan(0),
             "queue_confirm_time_max": GreaterThan(0),
+            "queue_confirm_time_p50": GreaterThan(0),
+            "queue_confirm_time_p90": GreaterThan(0),
+            "queue_confirm_time_p99": GreaterThan(0),
+            "queue_confirm_time_p999": GreaterThan(0),
             "queue_consumers_count": 3,
             "queue_content_bytes": 96,
             "queue_content_msgs": 32,
@@ -497,6 +633,10 @@ TEST_QUEUE_STATS_AFTER_PURGE_SINGLE_NODE = _deep_merge(
             "queue_put_msgs_abs": 32,
             "queue_queue_time_avg": GreaterThan(0),
             "queue_queue_time_max": GreaterThan(0),
+            "queue_queue_time_p50": GreaterThan(0),
+            "queue_queue_time_p90": GreaterThan(0),
+            "queue_queue_time_p99": GreaterThan(0),
+            "queue_queue_time_p999": GreaterThan(0),
             "queue_role": 1,
         },
     },
@@ -514,6 +654,10 @@ TEST_QUEUE_STATS_AFTER_PURGE_MULTI_NODE = _deep_merge(
                     "queue_msgs_current": 10,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p90": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "baz": {
@@ -524,6 +668,10 @@ TEST_QUEUE_STATS_AFTER_PURGE_MULTI_NODE = _deep_merge(
                     "queue_msgs_current": 0,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p90": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "foo": {
@@ -534,6 +682,10 @@ TEST_QUEUE_STATS_AFTER_PURGE_MULTI_NODE = _deep_merge(
                     "queue_msgs_current": 0,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p90": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
         },
@@ -553,6 +705,10 @@ TEST_QUEUE_STATS_AFTER_PURGE_MULTI_NODE = _deep_merge(
             "queue_push_msgs_abs": 31,
             "queue_queue_time_avg": GreaterThan(0),
             "queue_queue_time_max": GreaterThan(0),
+            "queue_queue_time_p50": GreaterThan(0),
+            "queue_queue_time_p90": GreaterThan(0),
+            "queue_queue_time_p99": GreaterThan(0),
+            "queue_queue_time_p999": GreaterThan(0),
             "queue_role": 1,
         },
     },
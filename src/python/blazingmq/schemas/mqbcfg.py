@@ -64,6 +64,21 @@ class ClusterAttributes:
     partitionFsmWatchdogNumRetries.:
     number of retries for Partition FSM watchdog before we give up and
     terminate the broker.  Only applies when 'isFSMWorkflow' is true.
+    cslMaxBatchSize................:
+    maximum number of queue (un)assignments the leader coalesces into
+    a single cluster state ledger advisory, acknowledged and committed
+    as a whole.  A value of 1 disables batching.
+    cslMaxBatchLatencyMs...........:
+    maximum time in milliseconds a queue (un)assignment may wait in a
+    pending batch.  A value of 0 flushes the batch once the cluster
+    dispatcher thread has processed its current event.  Only applies
+    when 'cslMaxBatchSize' is greater than 1.
+    cslSnapshotInterval............:
+    number of committed advisories after which each node compacts its
+    cluster state ledger by rolling over to a new file starting with a
+    snapshot of the cluster state, so that a restarting node replays
+    the snapshot and a short tail only.  A value of 0 disables
+    compaction, the ledger then rolling over only when full.
     """
 
     is_cslmode_enabled: bool = field(
@@ -129,6 +144,33 @@ class ClusterAttributes:
             "required": True,
         },
     )
+    csl_max_batch_size: int = field(
+        default=1,
+        metadata={
+            "name": "cslMaxBatchSize",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    csl_max_batch_latency_ms: int = field(
+        default=0,
+        metadata={
+            "name": "cslMaxBatchLatencyMs",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    csl_snapshot_interval: int = field(
+        default=0,
+        metadata={
+            "name": "cslSnapshotInterval",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -281,6 +323,19 @@ class Disallow:
 
 @dataclass
 class DispatcherProcessorParameters:
+    """Configuration of one processor of the dispatcher.
+
+    queueSize..............: initial capacity of the processor's queue
+    queueSizeLowWatermark..: queue size below which the queue is back to
+    normal state
+    queueSizeHighWatermark.: queue size above which the queue is
+    considered in high watermark state
+    maxBatchSize...........: maximum number of events processed before
+    the clients touched by those events are
+    flushed (0 to only flush once the queue is
+    empty)
+    """
+
     queue_size: Optional[int] = field(
         default=None,
         metadata={
@@ -308,6 +363,29 @@ class DispatcherProcessorParameters:
             "required": True,
         },
     )
+    max_batch_size: int = field(
+        default=0,
+        metadata={
+            "name": "maxBatchSize",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+
+
+class DispatcherQueueType(Enum):
+    """Enumeration of the queue implementations available to the processors
+    of the dispatcher:
+
+    - E_SINGLE_CONSUMER_QUEUE: unbounded, node-based, queue
+    - E_RING_BUFFER:           bounded, preallocated, lock-free ring
+    buffer, sized by the 'queueSize' of the
+    processors
+    """
+
+    E_SINGLE_CONSUMER_QUEUE = "E_SINGLE_CONSUMER_QUEUE"
+    E_RING_BUFFER = "E_RING_BUFFER"
 
 
 @dataclass
@@ -1287,6 +1365,24 @@ class ClusterNodeConnection:
 
 @dataclass
 class DispatcherProcessorConfig:
+    """Configuration of the processors of one type of dispatcher client.
+
+    numProcessors.......: number of processors (threads)
+    processorConfig.....: configuration of each processor
+    rebalanceIntervalMs.: interval at which the load of the processors
+    is sampled in order to migrate clients which
+    allow it from the busiest processor to the
+    least busy one (0 to disable)
+    firstCpu............: index of the first CPU the processors are
+    pinned to
+    numCpus.............: number of CPUs, starting at 'firstCpu', the
+    processors are pinned to; the processor of
+    index 'i' is pinned to the CPU of index
+    'firstCpu + i % numCpus' (0 to let the
+    operating system schedule the processors on
+    any CPU)
+    """
+
     num_processors: Optional[int] = field(
         default=None,
         metadata={
@@ -1305,6 +1401,33 @@ class DispatcherProcessorConfig:
             "required": True,
         },
     )
+    rebalance_interval_ms: int = field(
+        default=0,
+        metadata={
+            "name": "rebalanceIntervalMs",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    first_cpu: int = field(
+        default=0,
+        metadata={
+            "name": "firstCpu",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    num_cpus: int = field(
+        default=0,
+        metadata={
+            "name": "numCpus",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -1429,6 +1552,30 @@ class PartitionConfig:
     storage files to disk at shutdown
     syncConfig...........: configuration for storage synchronization and
     recovery
+    nextFileSetCreationPercent:
+    fill ratio, in percent, of the active file set
+    of a partition above which the next file set is
+    created in the background, so that rollover
+    does not have to create it.  0 disables
+    background creation
+    recoveryParallelism..: maximum number of threads validating the
+    messages of a partition recovered from local
+    storage at startup: the partition's dispatcher
+    thread and up to 'recoveryParallelism - 1'
+    cluster worker threads.  0 or 1 validates on
+    the dispatcher thread only
+    checkpointInterval...: number of regular sync points between two
+    checkpoints of the journal written alongside
+    the active file set, so that recovery only
+    replays the journal records written after the
+    last checkpoint.  0 disables checkpoints
+    replicationLatencyBudgetUs:
+    latency, in microseconds, that batching the
+    storage messages replicated by the primary may
+    add to their replication.  Batches grow with
+    the rate of messages and are sent early when
+    it drops, so as to stay within this budget.  0
+    sends a batch every 100 messages
     """
 
     num_partitions: Optional[int] = field(
@@ -1537,6 +1684,42 @@ class PartitionConfig:
             "required": True,
         },
     )
+    next_file_set_creation_percent: int = field(
+        default=0,
+        metadata={
+            "name": "nextFileSetCreationPercent",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    recovery_parallelism: int = field(
+        default=0,
+        metadata={
+            "name": "recoveryParallelism",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    checkpoint_interval: int = field(
+        default=0,
+        metadata={
+            "name": "checkpointInterval",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    replication_latency_budget_us: int = field(
+        default=0,
+        metadata={
+            "name": "replicationLatencyBudgetUs",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -1904,6 +2087,15 @@ class DispatcherConfig:
             "required": True,
         },
     )
+    processor_queue_type: DispatcherQueueType = field(
+        default=DispatcherQueueType.E_SINGLE_CONSUMER_QUEUE,
+        metadata={
+            "name": "processorQueueType",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
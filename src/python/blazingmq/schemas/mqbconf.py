@@ -408,6 +408,9 @@ class Domain:
     PUTs.
     consistency.........: optional consistency mode.
     subscriptions.......: optional application subscriptions
+    syncBeforeAck.......: if true, a PUT to a queue with strong
+    consistency is acknowledged only once its
+    records are synced to disk on the primary
     """
 
     name: Optional[str] = field(
@@ -521,6 +524,15 @@ class Domain:
             "min_occurs": 1,
         },
     )
+    sync_before_ack: bool = field(
+        default=False,
+        metadata={
+            "name": "syncBeforeAck",
+            "type": "Element",
+            "namespace": "urn:x-bloomberg-com:mqbconfm",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -27,23 +27,31 @@ using namespace BloombergLP;
 
 extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
 {
-    if (size > bsl::numeric_limits<int>::max()) {
+    if (size == 0 || size > bsl::numeric_limits<int>::max()) {
         return 0;
     }
 
+    // The first byte selects the algorithm, the rest is the compressed data.
+    const bmqt::CompressionAlgorithmType::Enum k_ALGORITHMS[] = {
+        bmqt::CompressionAlgorithmType::e_ZLIB,
+        bmqt::CompressionAlgorithmType::e_LZ4,
+        bmqt::CompressionAlgorithmType::e_ZSTD};
+    const bmqt::CompressionAlgorithmType::Enum algorithm =
+        k_ALGORITHMS[data[0] % (sizeof(k_ALGORITHMS) / sizeof(*k_ALGORITHMS))];
+
     bslma::Allocator*              alloc = bslma::Default::defaultAllocator();
     bdlbb::PooledBlobBufferFactory bufferFactory(1024, alloc);
 
     bdlbb::Blob input(&bufferFactory, alloc);
     bdlbb::BlobUtil::append(&input,
-                            reinterpret_cast<const char*>(data),
-                            static_cast<int>(size));
+                            reinterpret_cast<const char*>(data + 1),
+                            static_cast<int>(size - 1));
 
     bdlbb::Blob        output(&bufferFactory, alloc);
     bsl::ostringstream errorStream(alloc);
     bmqp::Compression::decompress(&output,
                                   &bufferFactory,
-                                  bmqt::CompressionAlgorithmType::e_ZLIB,
+                                  algorithm,
                                   input,
                                   64 * 1024 * 1024,  // maxOutputSize cap
                                   &errorStream,